@@ -0,0 +1,290 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_ATOMIC_FLAT_HASH_MAP_H_
+#define CYBER_BASE_ATOMIC_FLAT_HASH_MAP_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+/**
+ * @brief A lock-free open-addressing hash map with incremental growth
+ *
+ * Slots hold the key inline, so a hit costs one probe over a flat array
+ * instead of a pointer chase through per-bucket lists. When a table
+ * passes 3/4 occupancy a table of twice the size is linked in front and
+ * entries migrate a few at a time on subsequent inserts; lookups walk
+ * tables newest-first. Grown-out tables are retained until destruction
+ * (at most log2(capacity) of them), which keeps readers safe without an
+ * epoch scheme. Keys are insert-only, must be integral and non-zero
+ * (zero marks an empty slot).
+ *
+ * @tparam K Type of key, must be integral; key 0 is reserved
+ * @tparam V Type of value
+ * @tparam InitSize Initial table size, must be a power of two
+ */
+template <typename K, typename V, std::size_t InitSize = 128,
+          typename std::enable_if<std::is_integral<K>::value &&
+                                      (InitSize & (InitSize - 1)) == 0,
+                                  int>::type = 0>
+class AtomicFlatHashMap {
+ public:
+  AtomicFlatHashMap() {
+    head_.store(new Table(InitSize), std::memory_order_release);
+  }
+  ~AtomicFlatHashMap() {
+    Table *table = head_.load(std::memory_order_acquire);
+    while (table) {
+      auto old = table->old.load(std::memory_order_acquire);
+      delete table;
+      table = old;
+    }
+  }
+  AtomicFlatHashMap(const AtomicFlatHashMap &other) = delete;
+  AtomicFlatHashMap &operator=(const AtomicFlatHashMap &other) = delete;
+
+  bool Has(K key) {
+    V *value = nullptr;
+    return Get(key, &value);
+  }
+
+  bool Get(K key, V **value) {
+    while (true) {
+      bool migrating = false;
+      for (Table *table = head_.load(std::memory_order_acquire);
+           table != nullptr;
+           table = table->old.load(std::memory_order_acquire)) {
+        Slot *slot = table->Find(key);
+        if (slot == nullptr) {
+          continue;
+        }
+        V *val = slot->value.load(std::memory_order_acquire);
+        if (val != nullptr) {
+          *value = val;
+          return true;
+        }
+        // found the key but its value moved to a newer table while we
+        // were probing; rescan from the head
+        migrating = true;
+        break;
+      }
+      if (!migrating) {
+        return false;
+      }
+    }
+  }
+
+  bool Get(K key, V *value) {
+    V *val = nullptr;
+    if (Get(key, &val)) {
+      *value = *val;
+      return true;
+    }
+    return false;
+  }
+
+  // resolves many keys in one pass, prefetching every key's slot before
+  // the first is probed; values[i] is nullptr for missing keys, returns
+  // the number of hits
+  uint64_t GetBulk(const K *keys, uint64_t num, V **values) {
+    Table *table = head_.load(std::memory_order_acquire);
+    for (uint64_t i = 0; i < num; ++i) {
+      __builtin_prefetch(&table->slots[keys[i] & table->mask], 0, 1);
+    }
+    uint64_t hits = 0;
+    for (uint64_t i = 0; i < num; ++i) {
+      values[i] = nullptr;
+      if (Get(keys[i], &values[i])) {
+        ++hits;
+      }
+    }
+    return hits;
+  }
+
+  void Set(K key) { Insert(key, new V()); }
+
+  void Set(K key, const V &value) { Insert(key, new V(value)); }
+
+  void Set(K key, V &&value) { Insert(key, new V(std::forward<V>(value))); }
+
+ private:
+  struct Slot {
+    std::atomic<K> key = {0};
+    std::atomic<V *> value = {nullptr};
+  };
+
+  struct Table {
+    explicit Table(uint64_t size)
+        : slots(new Slot[size]), mask(size - 1), capacity(size) {}
+    ~Table() {
+      for (uint64_t i = 0; i < capacity; ++i) {
+        delete slots[i].value.load(std::memory_order_acquire);
+      }
+      delete[] slots;
+    }
+
+    // returns the slot holding key, or nullptr; insert-only keys make a
+    // plain linear probe safe for concurrent readers
+    Slot *Find(K key) {
+      for (uint64_t i = 0; i <= mask; ++i) {
+        Slot *slot = &slots[(key + i) & mask];
+        K slot_key = slot->key.load(std::memory_order_acquire);
+        if (slot_key == key) {
+          return slot;
+        }
+        if (slot_key == 0) {
+          return nullptr;
+        }
+      }
+      return nullptr;
+    }
+
+    // claims a slot for key, or returns nullptr when the probe run is
+    // too long and the table should grow
+    Slot *FindOrClaim(K key) {
+      const uint64_t max_probe = mask / 4 + 1;
+      for (uint64_t i = 0; i < max_probe; ++i) {
+        Slot *slot = &slots[(key + i) & mask];
+        K slot_key = slot->key.load(std::memory_order_acquire);
+        if (slot_key == key) {
+          return slot;
+        }
+        if (slot_key == 0) {
+          K expected = 0;
+          if (slot->key.compare_exchange_strong(expected, key,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+            used.fetch_add(1, std::memory_order_relaxed);
+            return slot;
+          }
+          if (expected == key) {
+            return slot;
+          }
+          // lost the claim to another key, keep probing from here
+          --i;
+          continue;
+        }
+      }
+      return nullptr;
+    }
+
+    Slot *slots;
+    uint64_t mask;
+    uint64_t capacity;
+    std::atomic<uint64_t> used = {0};
+    std::atomic<uint64_t> migrated = {0};
+    std::atomic<Table *> old = {nullptr};
+  };
+
+  void Insert(K key, V *value) {
+    while (true) {
+      Table *table = head_.load(std::memory_order_acquire);
+      if (table->used.load(std::memory_order_relaxed) >
+          table->capacity - (table->capacity >> 2)) {
+        Grow(table);
+        continue;
+      }
+      Slot *slot = table->FindOrClaim(key);
+      if (slot == nullptr) {
+        Grow(table);
+        continue;
+      }
+      // mirror AtomicHashMap: the previous value is intentionally not
+      // reclaimed, readers may still hold it
+      slot->value.store(value, std::memory_order_release);
+      if (head_.load(std::memory_order_acquire) != table) {
+        // the table was grown out underneath us and migration may have
+        // copied the slot before our store landed; take the value back
+        // if it is still ours and redo the write in the newest table so
+        // a migrated copy cannot shadow this update
+        V *ours = value;
+        slot->value.compare_exchange_strong(ours, nullptr,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire);
+        continue;
+      }
+      MigrateSome(table);
+      return;
+    }
+  }
+
+  void Grow(Table *current) {
+    if (current->old.load(std::memory_order_acquire) != nullptr &&
+        current->migrated.load(std::memory_order_acquire) <
+            current->old.load(std::memory_order_acquire)->capacity) {
+      // finish moving out of the previous table before growing again
+      MigrateSome(current);
+      return;
+    }
+    Table *bigger = new Table(current->capacity * 2);
+    bigger->old.store(current, std::memory_order_release);
+    Table *expected = current;
+    if (!head_.compare_exchange_strong(expected, bigger,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+      bigger->old.store(nullptr, std::memory_order_release);
+      delete bigger;
+    }
+  }
+
+  // moves a few slots from the previous table into table; called on the
+  // insert path so resize cost is spread across writers
+  void MigrateSome(Table *table) {
+    Table *old = table->old.load(std::memory_order_acquire);
+    if (old == nullptr) {
+      return;
+    }
+    constexpr uint64_t kMigrateBatch = 4;
+    for (uint64_t n = 0; n < kMigrateBatch; ++n) {
+      uint64_t idx = table->migrated.fetch_add(1, std::memory_order_acq_rel);
+      if (idx >= old->capacity) {
+        return;
+      }
+      Slot *slot = &old->slots[idx];
+      K key = slot->key.load(std::memory_order_acquire);
+      if (key == 0) {
+        continue;
+      }
+      V *value = slot->value.exchange(nullptr, std::memory_order_acq_rel);
+      if (value == nullptr) {
+        continue;
+      }
+      Slot *dest = table->FindOrClaim(key);
+      if (dest != nullptr) {
+        dest->value.store(value, std::memory_order_release);
+      } else {
+        // destination full mid-migration; put it back and let a later
+        // grow pick it up
+        slot->value.store(value, std::memory_order_release);
+        return;
+      }
+    }
+  }
+
+  std::atomic<Table *> head_ = {nullptr};
+};
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_ATOMIC_FLAT_HASH_MAP_H_
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/atomic_flat_hash_map.h"
+
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(AtomicFlatHashMapTest, int_int) {
+  AtomicFlatHashMap<int, int> map;
+  int value = 0;
+  for (int i = 1; i <= 1000; i++) {
+    map.Set(i, i);
+    EXPECT_TRUE(map.Has(i));
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(i, value);
+  }
+
+  for (int i = 1; i <= 1000; i++) {
+    map.Set(i, 1000 - i);
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(1000 - i, value);
+  }
+  EXPECT_FALSE(map.Has(1001));
+}
+
+TEST(AtomicFlatHashMapTest, int_str) {
+  AtomicFlatHashMap<int, std::string> map;
+  std::string value("");
+  for (int i = 1; i <= 1000; i++) {
+    map.Set(i, std::to_string(i));
+    EXPECT_TRUE(map.Has(i));
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(std::to_string(i), value);
+  }
+  map.Set(2000);
+  EXPECT_TRUE(map.Get(2000, &value));
+  EXPECT_TRUE(value.empty());
+  map.Set(2000, std::move(std::string("test")));
+  EXPECT_TRUE(map.Get(2000, &value));
+  EXPECT_EQ("test", value);
+}
+
+TEST(AtomicFlatHashMapTest, get_bulk) {
+  AtomicFlatHashMap<uint64_t, int> map;
+  for (uint64_t i = 1; i <= 100; i++) {
+    map.Set(i, static_cast<int>(i));
+  }
+  uint64_t keys[128];
+  int *values[128];
+  for (uint64_t i = 0; i < 128; i++) {
+    keys[i] = i + 1;
+  }
+  EXPECT_EQ(100, map.GetBulk(keys, 128, values));
+  for (uint64_t i = 0; i < 100; i++) {
+    ASSERT_NE(nullptr, values[i]);
+    EXPECT_EQ(static_cast<int>(i + 1), *values[i]);
+  }
+  for (uint64_t i = 100; i < 128; i++) {
+    EXPECT_EQ(nullptr, values[i]);
+  }
+}
+
+TEST(AtomicFlatHashMapTest, concurrency) {
+  AtomicFlatHashMap<int, std::string, 16> map;
+  int thread_num = 32;
+  std::thread t[32];
+  volatile bool ready = false;
+
+  for (int i = 0; i < thread_num; i++) {
+    t[i] = std::thread([&, i]() {
+      while (!ready) {
+        asm volatile("rep; nop" ::: "memory");
+      }
+      for (int j = 1; j <= 1024; j++) {
+        map.Set(j, std::to_string(j));
+        std::string value;
+        EXPECT_TRUE(map.Get(j, &value));
+      }
+    });
+  }
+  ready = true;
+  for (int i = 0; i < thread_num; i++) {
+    t[i].join();
+  }
+  std::string value;
+  for (int j = 1; j <= 1024; j++) {
+    EXPECT_TRUE(map.Get(j, &value));
+    EXPECT_EQ(std::to_string(j), value);
+  }
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
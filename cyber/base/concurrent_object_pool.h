@@ -48,6 +48,10 @@ class CCObjectPool : public std::enable_shared_from_this<CCObjectPool<T>> {
   void ReleaseObject(T *);
   uint32_t size() const;
 
+  uint32_t capacity() const { return capacity_; }
+  // objects currently handed out (magazine-cached nodes count as free)
+  uint32_t in_use() const { return in_use_.load(std::memory_order_relaxed); }
+
  private:
   struct Node {
     T object;
@@ -59,14 +63,44 @@ class CCObjectPool : public std::enable_shared_from_this<CCObjectPool<T>> {
     Node *node;
   };
 
+  // Per-thread cache of free nodes. Releases land here and acquires are
+  // served from here first, so a thread cycling objects does not bounce
+  // the shared free-list head between cores; only refills and spills
+  // touch the depot, in batches. The destructor hands cached nodes back
+  // when the thread exits, and an expired owner means the pool is gone,
+  // so the pointers are simply dropped.
+  static constexpr uint32_t kMagazineSize = 8;
+  struct Magazine {
+    ~Magazine() {
+      auto pool = owner.lock();
+      if (pool) {
+        pool->PushBatch(nodes, count);
+      }
+    }
+
+    std::weak_ptr<CCObjectPool<T>> owner;
+    CCObjectPool<T> *owner_ptr = nullptr;
+    Node *nodes[kMagazineSize];
+    uint32_t count = 0;
+  };
+
  private:
   CCObjectPool(CCObjectPool &) = delete;
   CCObjectPool &operator=(CCObjectPool &) = delete;
   bool FindFreeHead(Head *head);
+  bool FindFreeBatch(Node **nodes, uint32_t want, uint32_t *got);
+  void PushBatch(Node *const *nodes, uint32_t num);
+  Node *AcquireNode();
+
+  static Magazine &LocalMagazine() {
+    static thread_local Magazine magazine;
+    return magazine;
+  }
 
   std::atomic<Head> free_head_;
   Node *node_arena_ = nullptr;
   uint32_t capacity_ = 0;
+  alignas(CACHELINE_SIZE) std::atomic<uint32_t> in_use_ = {0};
 };
 
 template <typename T>
@@ -108,25 +142,91 @@ bool CCObjectPool<T>::FindFreeHead(Head *head) {
 }
 
 template <typename T>
-std::shared_ptr<T> CCObjectPool<T>::GetObject() {
+bool CCObjectPool<T>::FindFreeBatch(Node **nodes, uint32_t want,
+                                    uint32_t *got) {
+  Head new_head;
+  Head old_head = free_head_.load(std::memory_order_acquire);
+  uint32_t num = 0;
+  do {
+    if (unlikely(old_head.node == nullptr)) {
+      return false;
+    }
+    num = 0;
+    Node *node = old_head.node;
+    while (node != nullptr && num < want) {
+      nodes[num++] = node;
+      node = node->next;
+    }
+    new_head.node = node;
+    new_head.count = old_head.count + 1;
+  } while (!free_head_.compare_exchange_weak(old_head, new_head,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire));
+  *got = num;
+  return true;
+}
+
+template <typename T>
+void CCObjectPool<T>::PushBatch(Node *const *nodes, uint32_t num) {
+  if (num == 0) {
+    return;
+  }
+  for (uint32_t i = 0; i + 1 < num; ++i) {
+    nodes[i]->next = nodes[i + 1];
+  }
+  Head new_head;
+  Head old_head = free_head_.load(std::memory_order_acquire);
+  do {
+    nodes[num - 1]->next = old_head.node;
+    new_head.node = nodes[0];
+    new_head.count = old_head.count + 1;
+  } while (!free_head_.compare_exchange_weak(old_head, new_head,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire));
+}
+
+template <typename T>
+typename CCObjectPool<T>::Node *CCObjectPool<T>::AcquireNode() {
+  Magazine &magazine = LocalMagazine();
+  if (magazine.owner_ptr == this && likely(!magazine.owner.expired())) {
+    if (magazine.count == 0) {
+      FindFreeBatch(magazine.nodes, kMagazineSize / 2, &magazine.count);
+    }
+    if (likely(magazine.count > 0)) {
+      return magazine.nodes[--magazine.count];
+    }
+    return nullptr;
+  }
+  // this thread has not released to this pool yet, go to the depot
   Head free_head;
   if (unlikely(!FindFreeHead(&free_head))) {
     return nullptr;
   }
+  return free_head.node;
+}
+
+template <typename T>
+std::shared_ptr<T> CCObjectPool<T>::GetObject() {
+  Node *node = AcquireNode();
+  if (unlikely(node == nullptr)) {
+    return nullptr;
+  }
+  in_use_.fetch_add(1, std::memory_order_relaxed);
   auto self = this->shared_from_this();
-  return std::shared_ptr<T>(reinterpret_cast<T *>(free_head.node),
+  return std::shared_ptr<T>(reinterpret_cast<T *>(node),
                             [self](T *object) { self->ReleaseObject(object); });
 }
 
 template <typename T>
 template <typename... Args>
 std::shared_ptr<T> CCObjectPool<T>::ConstructObject(Args &&... args) {
-  Head free_head;
-  if (unlikely(!FindFreeHead(&free_head))) {
+  Node *node = AcquireNode();
+  if (unlikely(node == nullptr)) {
     return nullptr;
   }
+  in_use_.fetch_add(1, std::memory_order_relaxed);
   auto self = this->shared_from_this();
-  T *ptr = new (free_head.node) T(std::forward<Args>(args)...);
+  T *ptr = new (node) T(std::forward<Args>(args)...);
   return std::shared_ptr<T>(ptr, [self](T *object) {
     object->~T();
     self->ReleaseObject(object);
@@ -135,16 +235,29 @@ std::shared_ptr<T> CCObjectPool<T>::ConstructObject(Args &&... args) {
 
 template <typename T>
 void CCObjectPool<T>::ReleaseObject(T *object) {
-  Head new_head;
+  in_use_.fetch_sub(1, std::memory_order_relaxed);
   Node *node = reinterpret_cast<Node *>(object);
-  Head old_head = free_head_.load(std::memory_order_acquire);
-  do {
-    node->next = old_head.node;
-    new_head.node = node;
-    new_head.count = old_head.count + 1;
-  } while (!free_head_.compare_exchange_weak(old_head, new_head,
-                                             std::memory_order_acq_rel,
-                                             std::memory_order_acquire));
+  Magazine &magazine = LocalMagazine();
+  if (unlikely(magazine.owner_ptr != this || magazine.owner.expired())) {
+    // rebind the magazine: return what it caches to its previous pool
+    // (or drop the pointers if that pool is gone)
+    auto previous = magazine.owner.lock();
+    if (previous) {
+      previous->PushBatch(magazine.nodes, magazine.count);
+    }
+    magazine.count = 0;
+    magazine.owner = this->shared_from_this();
+    magazine.owner_ptr = this;
+  }
+  if (likely(magazine.count < kMagazineSize)) {
+    magazine.nodes[magazine.count++] = node;
+    return;
+  }
+  // magazine full, spill half back to the depot in one push
+  constexpr uint32_t spill = kMagazineSize / 2;
+  PushBatch(magazine.nodes + (kMagazineSize - spill), spill);
+  magazine.count -= spill;
+  magazine.nodes[magazine.count++] = node;
 }
 
 }  // namespace base
@@ -0,0 +1,241 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_MPMC_BOUNDED_QUEUE_H_
+#define CYBER_BASE_MPMC_BOUNDED_QUEUE_H_
+
+#include <stdint.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+
+#include "cyber/base/macros.h"
+#include "cyber/base/wait_strategy.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+// Bounded MPMC ring with a per-slot sequence number. Producers and
+// consumers each claim a slot with one fetch-style CAS on their own
+// cursor and then hand the slot over through its sequence, so heavy
+// fan-in does not retry on a shared commit counter the way
+// BoundedQueue does. Capacity is rounded up to a power of two.
+template <typename T>
+class MpmcBoundedQueue {
+ public:
+  using value_type = T;
+  using size_type = uint64_t;
+
+ public:
+  MpmcBoundedQueue() {}
+  MpmcBoundedQueue& operator=(const MpmcBoundedQueue& other) = delete;
+  MpmcBoundedQueue(const MpmcBoundedQueue& other) = delete;
+  ~MpmcBoundedQueue();
+  bool Init(uint64_t size);
+  bool Init(uint64_t size, WaitStrategy* strategy);
+  bool Enqueue(const T& element);
+  bool Enqueue(T&& element);
+  bool Dequeue(T* element);
+  // dequeues up to num elements into elements[0..), returns the count;
+  // lets a consumer drain a burst with one wakeup
+  uint64_t DequeueBatch(T* elements, uint64_t num);
+  bool WaitDequeue(T* element);
+  uint64_t WaitDequeueBatch(T* elements, uint64_t num);
+  uint64_t Size();
+  bool Empty();
+  void SetWaitStrategy(WaitStrategy* strategy);
+  void BreakAllWait();
+
+ private:
+  struct Cell {
+    std::atomic<uint64_t> seq;
+    T data;
+  };
+
+  uint64_t mask_ = 0;
+  Cell* pool_ = nullptr;
+  alignas(CACHELINE_SIZE) std::atomic<uint64_t> head_ = {0};
+  alignas(CACHELINE_SIZE) std::atomic<uint64_t> tail_ = {0};
+  std::unique_ptr<WaitStrategy> wait_strategy_ = nullptr;
+  volatile bool break_all_wait_ = false;
+};
+
+template <typename T>
+MpmcBoundedQueue<T>::~MpmcBoundedQueue() {
+  if (wait_strategy_) {
+    BreakAllWait();
+  }
+  if (pool_) {
+    for (uint64_t i = 0; i <= mask_; ++i) {
+      pool_[i].data.~T();
+    }
+    std::free(pool_);
+  }
+}
+
+template <typename T>
+inline bool MpmcBoundedQueue<T>::Init(uint64_t size) {
+  return Init(size, new SleepWaitStrategy());
+}
+
+template <typename T>
+bool MpmcBoundedQueue<T>::Init(uint64_t size, WaitStrategy* strategy) {
+  uint64_t pool_size = 2;
+  while (pool_size < size) {
+    pool_size <<= 1;
+  }
+  pool_ = reinterpret_cast<Cell*>(std::calloc(pool_size, sizeof(Cell)));
+  if (pool_ == nullptr) {
+    return false;
+  }
+  for (uint64_t i = 0; i < pool_size; ++i) {
+    new (&(pool_[i].data)) T();
+    pool_[i].seq.store(i, std::memory_order_relaxed);
+  }
+  mask_ = pool_size - 1;
+  wait_strategy_.reset(strategy);
+  return true;
+}
+
+template <typename T>
+bool MpmcBoundedQueue<T>::Enqueue(const T& element) {
+  T value = element;
+  return Enqueue(std::move(value));
+}
+
+template <typename T>
+bool MpmcBoundedQueue<T>::Enqueue(T&& element) {
+  uint64_t pos = tail_.load(std::memory_order_relaxed);
+  Cell* cell = nullptr;
+  while (true) {
+    cell = &pool_[pos & mask_];
+    uint64_t seq = cell->seq.load(std::memory_order_acquire);
+    int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+    if (diff == 0) {
+      if (tail_.compare_exchange_weak(pos, pos + 1,
+                                      std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // slot not yet consumed from the previous lap, queue is full
+      return false;
+    } else {
+      pos = tail_.load(std::memory_order_relaxed);
+    }
+  }
+  cell->data = std::move(element);
+  cell->seq.store(pos + 1, std::memory_order_release);
+  wait_strategy_->NotifyOne();
+  return true;
+}
+
+template <typename T>
+bool MpmcBoundedQueue<T>::Dequeue(T* element) {
+  uint64_t pos = head_.load(std::memory_order_relaxed);
+  Cell* cell = nullptr;
+  while (true) {
+    cell = &pool_[pos & mask_];
+    uint64_t seq = cell->seq.load(std::memory_order_acquire);
+    int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos + 1);
+    if (diff == 0) {
+      if (head_.compare_exchange_weak(pos, pos + 1,
+                                      std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = head_.load(std::memory_order_relaxed);
+    }
+  }
+  *element = std::move(cell->data);
+  cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+uint64_t MpmcBoundedQueue<T>::DequeueBatch(T* elements, uint64_t num) {
+  uint64_t count = 0;
+  while (count < num && Dequeue(&elements[count])) {
+    ++count;
+  }
+  return count;
+}
+
+template <typename T>
+bool MpmcBoundedQueue<T>::WaitDequeue(T* element) {
+  while (!break_all_wait_) {
+    if (Dequeue(element)) {
+      return true;
+    }
+    if (wait_strategy_->EmptyWait()) {
+      continue;
+    }
+    // wait timeout
+    break;
+  }
+
+  return false;
+}
+
+template <typename T>
+uint64_t MpmcBoundedQueue<T>::WaitDequeueBatch(T* elements, uint64_t num) {
+  while (!break_all_wait_) {
+    auto count = DequeueBatch(elements, num);
+    if (count > 0) {
+      return count;
+    }
+    if (wait_strategy_->EmptyWait()) {
+      continue;
+    }
+    // wait timeout
+    break;
+  }
+
+  return 0;
+}
+
+template <typename T>
+inline uint64_t MpmcBoundedQueue<T>::Size() {
+  uint64_t tail = tail_.load(std::memory_order_acquire);
+  uint64_t head = head_.load(std::memory_order_acquire);
+  return tail > head ? tail - head : 0;
+}
+
+template <typename T>
+inline bool MpmcBoundedQueue<T>::Empty() {
+  return Size() == 0;
+}
+
+template <typename T>
+inline void MpmcBoundedQueue<T>::SetWaitStrategy(WaitStrategy* strategy) {
+  wait_strategy_.reset(strategy);
+}
+
+template <typename T>
+inline void MpmcBoundedQueue<T>::BreakAllWait() {
+  break_all_wait_ = true;
+  wait_strategy_->BreakAllWait();
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_MPMC_BOUNDED_QUEUE_H_
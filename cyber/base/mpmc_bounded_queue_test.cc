@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/mpmc_bounded_queue.h"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(MpmcBoundedQueueTest, enqueue_dequeue) {
+  MpmcBoundedQueue<int> queue;
+  queue.Init(64);
+  EXPECT_TRUE(queue.Empty());
+  for (int i = 0; i < 64; i++) {
+    EXPECT_TRUE(queue.Enqueue(i));
+  }
+  EXPECT_FALSE(queue.Enqueue(64));
+  int value = 0;
+  for (int i = 0; i < 64; i++) {
+    EXPECT_TRUE(queue.Dequeue(&value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_FALSE(queue.Dequeue(&value));
+}
+
+TEST(MpmcBoundedQueueTest, dequeue_batch) {
+  MpmcBoundedQueue<int> queue;
+  queue.Init(64);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_TRUE(queue.Enqueue(i));
+  }
+  int values[64];
+  EXPECT_EQ(10, queue.DequeueBatch(values, 64));
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(i, values[i]);
+  }
+  EXPECT_EQ(0, queue.DequeueBatch(values, 64));
+}
+
+TEST(MpmcBoundedQueueTest, concurrency) {
+  MpmcBoundedQueue<int> queue;
+  queue.Init(16);
+  std::atomic_int enqueued = {0};
+  std::atomic_int dequeued = {0};
+  std::thread threads[48];
+  for (int i = 0; i < 48; ++i) {
+    if (i % 2 == 0) {
+      threads[i] = std::thread([&]() {
+        for (int j = 0; j < 10000; ++j) {
+          if (queue.Enqueue(j)) {
+            enqueued++;
+          }
+        }
+      });
+    } else {
+      threads[i] = std::thread([&]() {
+        int value = 0;
+        for (int j = 0; j < 10000; ++j) {
+          if (queue.Dequeue(&value)) {
+            dequeued++;
+          }
+        }
+      });
+    }
+  }
+  for (int i = 0; i < 48; ++i) {
+    threads[i].join();
+  }
+  int remain = 0;
+  int value = 0;
+  while (queue.Dequeue(&value)) {
+    remain++;
+  }
+  EXPECT_EQ(enqueued.load(), dequeued.load() + remain);
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
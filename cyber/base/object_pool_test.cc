@@ -127,6 +127,18 @@ TEST(CCObjectPoolTest, construct_all) {
   vec.clear();
 }
 
+TEST(CCObjectPoolTest, occupancy_stats) {
+  const uint32_t capacity = 16;
+  auto pool = std::make_shared<CCObjectPool<TestNode>>(capacity);
+  EXPECT_EQ(capacity, pool->capacity());
+  EXPECT_EQ(0, pool->in_use());
+
+  auto obj = pool->ConstructObject(1);
+  EXPECT_EQ(1, pool->in_use());
+  obj.reset();
+  EXPECT_EQ(0, pool->in_use());
+}
+
 TEST(ObjectPoolTest, get_object) {
   auto pool = std::make_shared<ObjectPool<TestNode>>(100, 10);
   FOR_EACH(i, 0, 10) { EXPECT_EQ(10, pool->GetObject()->value); }
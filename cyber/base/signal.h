@@ -18,10 +18,11 @@
 #define CYBER_BASE_SIGNAL_H_
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace apollo {
 namespace cyber {
@@ -33,40 +34,42 @@ class Slot;
 template <typename... Args>
 class Connection;
 
+/**
+ * @brief Signal delivers every emission to its connected slots.
+ *
+ * The slot list is an immutable snapshot published through an atomic
+ * shared_ptr (RCU style): emission only loads the current snapshot and
+ * never takes a lock, while Connect/Disconnect serialize on a mutex,
+ * build a new snapshot and swap it in. Emissions running on the old
+ * snapshot keep it alive until they finish; a slot disconnected
+ * mid-emission is silenced by its connected flag.
+ */
 template <typename... Args>
 class Signal {
  public:
   using Callback = std::function<void(Args...)>;
   using SlotPtr = std::shared_ptr<Slot<Args...>>;
-  using SlotList = std::list<SlotPtr>;
+  using SlotList = std::vector<SlotPtr>;
   using ConnectionType = Connection<Args...>;
 
-  Signal() {}
+  Signal() : slots_(std::make_shared<SlotList>()) {}
   virtual ~Signal() { DisconnectAllSlots(); }
 
   void operator()(Args... args) {
-    SlotList local;
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      for (auto& slot : slots_) {
-        local.emplace_back(slot);
-      }
+    auto local = std::atomic_load_explicit(&slots_, std::memory_order_acquire);
+    for (auto& slot : *local) {
+      (*slot)(args...);
     }
-
-    if (!local.empty()) {
-      for (auto& slot : local) {
-        (*slot)(args...);
-      }
-    }
-
-    ClearDisconnectedSlots();
   }
 
   ConnectionType Connect(const Callback& cb) {
     auto slot = std::make_shared<Slot<Args...>>(cb);
     {
       std::lock_guard<std::mutex> lock(mutex_);
-      slots_.emplace_back(slot);
+      auto next = std::make_shared<SlotList>(*slots_);
+      next->emplace_back(slot);
+      std::atomic_store_explicit(&slots_, std::move(next),
+                                 std::memory_order_release);
     }
 
     return ConnectionType(slot, this);
@@ -76,41 +79,39 @@ class Signal {
     bool find = false;
     {
       std::lock_guard<std::mutex> lock(mutex_);
-      for (auto& slot : slots_) {
+      auto next = std::make_shared<SlotList>();
+      next->reserve(slots_->size());
+      for (auto& slot : *slots_) {
         if (conn.HasSlot(slot)) {
           find = true;
           slot->Disconnect();
+        } else {
+          next->emplace_back(slot);
         }
       }
-    }
-
-    if (find) {
-      ClearDisconnectedSlots();
+      if (find) {
+        std::atomic_store_explicit(&slots_, std::move(next),
+                                   std::memory_order_release);
+      }
     }
     return find;
   }
 
   void DisconnectAllSlots() {
     std::lock_guard<std::mutex> lock(mutex_);
-    for (auto& slot : slots_) {
+    for (auto& slot : *slots_) {
       slot->Disconnect();
     }
-    slots_.clear();
+    std::atomic_store_explicit(&slots_, std::make_shared<SlotList>(),
+                               std::memory_order_release);
   }
 
  private:
   Signal(const Signal&) = delete;
   Signal& operator=(const Signal&) = delete;
 
-  void ClearDisconnectedSlots() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    slots_.erase(
-        std::remove_if(slots_.begin(), slots_.end(),
-                       [](const SlotPtr& slot) { return !slot->connected(); }),
-        slots_.end());
-  }
-
-  SlotList slots_;
+  // current snapshot; replaced as a whole, never modified in place
+  std::shared_ptr<SlotList> slots_;
   std::mutex mutex_;
 };
 
@@ -167,23 +168,26 @@ class Slot {
  public:
   using Callback = std::function<void(Args...)>;
   Slot(const Slot& another)
-      : cb_(another.cb_), connected_(another.connected_) {}
+      : cb_(another.cb_), connected_(another.connected()) {}
   explicit Slot(const Callback& cb, bool connected = true)
       : cb_(cb), connected_(connected) {}
   virtual ~Slot() {}
 
   void operator()(Args... args) {
-    if (connected_ && cb_) {
+    if (connected() && cb_) {
       cb_(args...);
     }
   }
 
-  void Disconnect() { connected_ = false; }
-  bool connected() const { return connected_; }
+  void Disconnect() { connected_.store(false, std::memory_order_release); }
+  bool connected() const {
+    return connected_.load(std::memory_order_acquire);
+  }
 
  private:
   Callback cb_;
-  bool connected_ = true;
+  // flipped by Disconnect while emissions may still hold the slot
+  std::atomic<bool> connected_ = {true};
 };
 
 }  // namespace base
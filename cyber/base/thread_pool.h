@@ -18,51 +18,233 @@
 #define CYBER_BASE_THREAD_POOL_H_
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
-#include <queue>
-#include <stdexcept>
+#include <mutex>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-#include "cyber/base/bounded_queue.h"
-
 namespace apollo {
 namespace cyber {
 namespace base {
 
+// Work-stealing thread pool. Every worker owns a deque guarded by its own
+// mutex, so producers and consumers of different workers never contend on a
+// shared queue. Submit(tag, ...) routes all tasks with the same tag to the
+// same worker, keeping e.g. per-camera work on one core's warm cache; an
+// idle worker steals from the back of other deques, so affinity is a hint,
+// not a partition. Tasks are stored in a move-only small-buffer callable
+// instead of std::function, so the usual shared_ptr<packaged_task> capture
+// and its heap allocation are not needed.
 class ThreadPool {
  public:
   explicit ThreadPool(std::size_t thread_num, std::size_t max_task_num = 1000);
 
+  // Round-robin submission. Before using the return value, you should check
+  // value.valid(): the future is empty when the pool is stopped or full.
   template <typename F, typename... Args>
   auto Enqueue(F&& f, Args&&... args)
       -> std::future<typename std::result_of<F(Args...)>::type>;
 
+  // Submission with an affinity hint: tasks sharing a tag go to the same
+  // worker deque in FIFO order, unless stolen by an idle worker.
+  template <typename F, typename... Args>
+  auto Submit(std::size_t tag, F&& f, Args&&... args)
+      -> std::future<typename std::result_of<F(Args...)>::type>;
+
   ~ThreadPool();
 
  private:
+  // Move-only callable with inline storage for small callables; larger ones
+  // fall back to the heap.
+  class Task {
+   public:
+    Task() = default;
+
+    template <typename Callable,
+              typename = typename std::enable_if<!std::is_same<
+                  typename std::decay<Callable>::type, Task>::value>::type>
+    explicit Task(Callable&& callable) {
+      using Impl = CallableImpl<typename std::decay<Callable>::type>;
+      if (sizeof(Impl) <= kInlineCapacity) {
+        callable_ = new (&storage_) Impl(std::forward<Callable>(callable));
+        inlined_ = true;
+      } else {
+        callable_ = new Impl(std::forward<Callable>(callable));
+        inlined_ = false;
+      }
+    }
+
+    Task(Task&& other) { MoveFrom(&other); }
+    Task& operator=(Task&& other) {
+      if (this != &other) {
+        Destroy();
+        MoveFrom(&other);
+      }
+      return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() { Destroy(); }
+
+    explicit operator bool() const { return callable_ != nullptr; }
+    void operator()() { callable_->Invoke(); }
+
+   private:
+    struct CallableBase {
+      virtual ~CallableBase() = default;
+      virtual void Invoke() = 0;
+      virtual CallableBase* MoveTo(void* storage) = 0;
+    };
+
+    template <typename C>
+    struct CallableImpl : public CallableBase {
+      explicit CallableImpl(C&& c) : callable(std::move(c)) {}
+      explicit CallableImpl(const C& c) : callable(c) {}
+      void Invoke() override { callable(); }
+      CallableBase* MoveTo(void* storage) override {
+        return new (storage) CallableImpl(std::move(callable));
+      }
+      C callable;
+    };
+
+    void MoveFrom(Task* other) {
+      if (other->callable_ == nullptr) {
+        return;
+      }
+      if (other->inlined_) {
+        callable_ = other->callable_->MoveTo(&storage_);
+        inlined_ = true;
+        other->Destroy();
+      } else {
+        callable_ = other->callable_;
+        inlined_ = false;
+        other->callable_ = nullptr;
+      }
+    }
+
+    void Destroy() {
+      if (callable_ == nullptr) {
+        return;
+      }
+      if (inlined_) {
+        callable_->~CallableBase();
+      } else {
+        delete callable_;
+      }
+      callable_ = nullptr;
+    }
+
+    static constexpr std::size_t kInlineCapacity = 64;
+
+    typename std::aligned_storage<kInlineCapacity,
+                                  alignof(std::max_align_t)>::type storage_;
+    CallableBase* callable_ = nullptr;
+    bool inlined_ = false;
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Task> tasks;
+  };
+
+  bool Push(std::size_t index, Task&& task);
+  bool PopLocal(Worker* worker, Task* task);
+  bool Steal(std::size_t thief_index, Task* task);
+  void WorkerLoop(std::size_t index);
+
   std::vector<std::thread> workers_;
-  BoundedQueue<std::function<void()>> task_queue_;
+  std::vector<std::unique_ptr<Worker>> worker_data_;
+  std::size_t max_task_num_;
+  std::atomic<std::size_t> task_num_;
+  std::atomic<std::size_t> next_worker_;
   std::atomic_bool stop_;
 };
 
 inline ThreadPool::ThreadPool(std::size_t threads, std::size_t max_task_num)
-    : stop_(false) {
-  if (!task_queue_.Init(max_task_num, new BlockWaitStrategy())) {
-    throw std::runtime_error("Task queue init failed.");
+    : max_task_num_(max_task_num),
+      task_num_(0),
+      next_worker_(0),
+      stop_(false) {
+  if (threads == 0) {
+    threads = 1;
   }
-  for (size_t i = 0; i < threads; ++i) {
-    workers_.emplace_back([this] {
-      while (!stop_) {
-        std::function<void()> task;
-        if (task_queue_.WaitDequeue(&task)) {
-          task();
-        }
-      }
-    });
+  worker_data_.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i) {
+    worker_data_.emplace_back(new Worker());
+  }
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+}
+
+inline bool ThreadPool::Push(std::size_t index, Task&& task) {
+  if (stop_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  if (task_num_.fetch_add(1, std::memory_order_relaxed) >= max_task_num_) {
+    task_num_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+  Worker& worker = *worker_data_[index];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.push_back(std::move(task));
+  }
+  worker.cv.notify_one();
+  return true;
+}
+
+inline bool ThreadPool::PopLocal(Worker* worker, Task* task) {
+  std::lock_guard<std::mutex> lock(worker->mutex);
+  if (worker->tasks.empty()) {
+    return false;
+  }
+  *task = std::move(worker->tasks.front());
+  worker->tasks.pop_front();
+  return true;
+}
+
+inline bool ThreadPool::Steal(std::size_t thief_index, Task* task) {
+  const std::size_t worker_num = worker_data_.size();
+  for (std::size_t i = 1; i < worker_num; ++i) {
+    Worker& victim = *worker_data_[(thief_index + i) % worker_num];
+    // try_lock: a busy victim is being drained already, move on.
+    std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+    if (!lock.owns_lock() || victim.tasks.empty()) {
+      continue;
+    }
+    *task = std::move(victim.tasks.back());
+    victim.tasks.pop_back();
+    return true;
+  }
+  return false;
+}
+
+inline void ThreadPool::WorkerLoop(std::size_t index) {
+  Worker& self = *worker_data_[index];
+  while (!stop_.load(std::memory_order_acquire)) {
+    Task task;
+    if (PopLocal(&self, &task) || Steal(index, &task)) {
+      task_num_.fetch_sub(1, std::memory_order_relaxed);
+      task();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(self.mutex);
+    if (!self.tasks.empty() || stop_.load(std::memory_order_acquire)) {
+      continue;
+    }
+    // Bounded wait so a sleeping worker rechecks other deques for stealable
+    // work that was pushed without a notification for it.
+    self.cv.wait_for(lock, std::chrono::milliseconds(10));
   }
 }
 
@@ -70,27 +252,36 @@ inline ThreadPool::ThreadPool(std::size_t threads, std::size_t max_task_num)
 template <typename F, typename... Args>
 auto ThreadPool::Enqueue(F&& f, Args&&... args)
     -> std::future<typename std::result_of<F(Args...)>::type> {
+  return Submit(next_worker_.fetch_add(1, std::memory_order_relaxed),
+                std::forward<F>(f), std::forward<Args>(args)...);
+}
+
+template <typename F, typename... Args>
+auto ThreadPool::Submit(std::size_t tag, F&& f, Args&&... args)
+    -> std::future<typename std::result_of<F(Args...)>::type> {
   using return_type = typename std::result_of<F(Args...)>::type;
 
-  auto task = std::make_shared<std::packaged_task<return_type()>>(
+  std::packaged_task<return_type()> packaged(
       std::bind(std::forward<F>(f), std::forward<Args>(args)...));
-
-  std::future<return_type> res = task->get_future();
+  std::future<return_type> res = packaged.get_future();
 
   // don't allow enqueueing after stopping the pool
-  if (stop_) {
+  if (!Push(tag % worker_data_.size(),
+            Task([task = std::move(packaged)]() mutable { task(); }))) {
     return std::future<return_type>();
   }
-  task_queue_.Enqueue([task]() { (*task)(); });
   return res;
-};
+}
 
 // the destructor joins all threads
 inline ThreadPool::~ThreadPool() {
   if (stop_.exchange(true)) {
     return;
   }
-  task_queue_.BreakAllWait();
+  for (auto& worker : worker_data_) {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    worker->cv.notify_all();
+  }
   for (std::thread& worker : workers_) {
     worker.join();
   }
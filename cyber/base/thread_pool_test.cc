@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/thread_pool.h"
+
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(ThreadPoolTest, Enqueue) {
+  ThreadPool pool(4);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; ++i) {
+    results.push_back(pool.Enqueue([](int value) { return value * 2; }, i));
+  }
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(results[i].valid());
+    EXPECT_EQ(i * 2, results[i].get());
+  }
+}
+
+TEST(ThreadPoolTest, SubmitAffinity) {
+  ThreadPool pool(4);
+  // Pin the other three workers so nobody is idle enough to steal.
+  std::promise<void> release;
+  std::shared_future<void> gate(release.get_future());
+  std::atomic<int> pinned_running = {0};
+  std::vector<std::future<void>> pinned;
+  for (std::size_t tag = 0; tag < 3; ++tag) {
+    pinned.push_back(pool.Submit(tag, [gate, &pinned_running]() {
+      pinned_running.fetch_add(1);
+      gate.wait();
+    }));
+  }
+  while (pinned_running.load() < 3) {
+    std::this_thread::yield();
+  }
+
+  constexpr std::size_t kTag = 7;
+  std::vector<std::future<std::thread::id>> results;
+  for (int i = 0; i < 50; ++i) {
+    results.push_back(
+        pool.Submit(kTag, []() { return std::this_thread::get_id(); }));
+  }
+  // One worker runs the whole tag.
+  std::set<std::thread::id> worker_ids;
+  for (auto& result : results) {
+    ASSERT_TRUE(result.valid());
+    worker_ids.insert(result.get());
+  }
+  EXPECT_EQ(1, worker_ids.size());
+
+  release.set_value();
+  for (auto& result : pinned) {
+    result.get();
+  }
+}
+
+TEST(ThreadPoolTest, StealKeepsAllWorkersBusy) {
+  ThreadPool pool(4);
+  // Pile everything on one tag; idle workers must steal to finish.
+  std::atomic<int> done = {0};
+  std::vector<std::future<void>> results;
+  for (int i = 0; i < 200; ++i) {
+    results.push_back(pool.Submit(0, [&done]() {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+      done.fetch_add(1);
+    }));
+  }
+  for (auto& result : results) {
+    ASSERT_TRUE(result.valid());
+    result.get();
+  }
+  EXPECT_EQ(200, done.load());
+}
+
+TEST(ThreadPoolTest, RejectsWhenFull) {
+  ThreadPool pool(1, 2);
+  std::promise<void> release;
+  std::shared_future<void> gate(release.get_future());
+  auto blocker = pool.Submit(0, [gate]() { gate.wait(); });
+  ASSERT_TRUE(blocker.valid());
+
+  // Fill the queue, then expect an invalid future.
+  std::vector<std::future<void>> queued;
+  bool rejected = false;
+  for (int i = 0; i < 10; ++i) {
+    auto result = pool.Submit(0, [gate]() { gate.wait(); });
+    if (!result.valid()) {
+      rejected = true;
+      break;
+    }
+    queued.push_back(std::move(result));
+  }
+  EXPECT_TRUE(rejected);
+
+  release.set_value();
+  blocker.get();
+  for (auto& result : queued) {
+    result.get();
+  }
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
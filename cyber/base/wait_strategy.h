@@ -17,12 +17,21 @@
 #ifndef CYBER_BASE_WAIT_STRATEGY_H_
 #define CYBER_BASE_WAIT_STRATEGY_H_
 
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
 #include <chrono>
+#include <climits>
 #include <condition_variable>
 #include <cstdlib>
+#include <ctime>
 #include <mutex>
 #include <thread>
 
+#include "cyber/base/macros.h"
+
 namespace apollo {
 namespace cyber {
 namespace base {
@@ -87,6 +96,73 @@ class BusySpinWaitStrategy : public WaitStrategy {
   bool EmptyWait() override { return true; }
 };
 
+// Escalates from busy-spin through yield to a futex park as consecutive
+// empty polls accumulate, and de-escalates as soon as a notify lands. A
+// hot consumer keeps spin-level latency while an idle one gives up its
+// core. Consumer-side counters are unsynchronized, so one instance
+// serves a single consumer thread.
+class AdaptiveWaitStrategy : public WaitStrategy {
+ public:
+  AdaptiveWaitStrategy() {}
+  AdaptiveWaitStrategy(uint32_t spin_cycles, uint32_t yield_cycles)
+      : spin_cycles_(spin_cycles), yield_cycles_(yield_cycles) {}
+
+  void NotifyOne() override {
+    seq_.fetch_add(1, std::memory_order_seq_cst);
+    if (parked_.load(std::memory_order_seq_cst) != 0) {
+      syscall(SYS_futex, reinterpret_cast<uint32_t*>(&seq_), FUTEX_WAKE, 1,
+              nullptr, nullptr, 0);
+    }
+  }
+
+  void BreakAllWait() override {
+    break_all_.store(true, std::memory_order_release);
+    seq_.fetch_add(1, std::memory_order_seq_cst);
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&seq_), FUTEX_WAKE,
+            INT_MAX, nullptr, nullptr, 0);
+  }
+
+  bool EmptyWait() override {
+    if (break_all_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    auto seq = seq_.load(std::memory_order_acquire);
+    if (seq != last_seq_) {
+      last_seq_ = seq;
+      empty_count_ = 0;
+    }
+    if (empty_count_ < spin_cycles_) {
+      ++empty_count_;
+      cpu_relax();
+    } else if (empty_count_ < spin_cycles_ + yield_cycles_) {
+      ++empty_count_;
+      std::this_thread::yield();
+    } else {
+      struct timespec timeout;
+      timeout.tv_sec = 0;
+      timeout.tv_nsec = kParkTimeoutNs;
+      parked_.store(1, std::memory_order_seq_cst);
+      // the kernel re-checks seq_ against the snapshot, so a notify
+      // racing with the park returns immediately instead of being lost
+      syscall(SYS_futex, reinterpret_cast<uint32_t*>(&seq_), FUTEX_WAIT, seq,
+              &timeout, nullptr, 0);
+      parked_.store(0, std::memory_order_relaxed);
+    }
+    return !break_all_.load(std::memory_order_acquire);
+  }
+
+ private:
+  static constexpr int64_t kParkTimeoutNs = 10 * 1000 * 1000;
+
+  uint32_t spin_cycles_ = 1000;
+  uint32_t yield_cycles_ = 100;
+  uint32_t empty_count_ = 0;
+  uint32_t last_seq_ = 0;
+  std::atomic<uint32_t> seq_ = {0};
+  std::atomic<uint32_t> parked_ = {0};
+  std::atomic<bool> break_all_ = {false};
+};
+
 class TimeoutBlockWaitStrategy : public WaitStrategy {
  public:
   TimeoutBlockWaitStrategy() {}
@@ -0,0 +1,192 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Shared main() for the cyber benchmark binaries, in the spirit of
+ *        gtest's main library.
+ *
+ * Besides the regular google-benchmark flags, two extra flags are handled:
+ *
+ *   --latency_budget=<file>
+ *       Each non-comment line is "<benchmark name> <max ns per iteration>".
+ *       When any listed benchmark misses its budget (or did not run), the
+ *       process exits non-zero, so CI can gate infra changes on it.
+ *
+ *   --json_report=<path>
+ *       Writes the measured latencies and the budget verdicts as JSON for
+ *       archiving and trend dashboards.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+namespace {
+
+struct Result {
+  double ns_per_iteration = 0.0;
+  int64_t iterations = 0;
+};
+
+// Console output plus a side table of ns-per-iteration for the budget
+// check and the JSON report.
+class RecordingReporter : public ::benchmark::ConsoleReporter {
+ public:
+  void ReportRuns(const std::vector<Run> &reports) override {
+    ::benchmark::ConsoleReporter::ReportRuns(reports);
+    for (const auto &run : reports) {
+      if (run.iterations > 0) {
+        Result result;
+        result.iterations = run.iterations;
+        result.ns_per_iteration = run.real_accumulated_time * 1e9 /
+                                  static_cast<double>(run.iterations);
+        results_[run.benchmark_name] = result;
+      }
+    }
+  }
+
+  const std::map<std::string, Result> &results() const { return results_; }
+
+ private:
+  std::map<std::string, Result> results_;
+};
+
+bool LoadBudgets(const std::string &path,
+                 std::map<std::string, double> *const budgets) {
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    std::fprintf(stderr, "cannot open latency budget file %s\n", path.c_str());
+    return false;
+  }
+  std::string name;
+  double max_ns = 0.0;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    if (iss >> name >> max_ns) {
+      (*budgets)[name] = max_ns;
+    }
+  }
+  return true;
+}
+
+int CheckBudgets(const std::map<std::string, double> &budgets,
+                 const std::map<std::string, Result> &results) {
+  int num_violations = 0;
+  for (const auto &budget : budgets) {
+    const auto it = results.find(budget.first);
+    if (it == results.end()) {
+      std::fprintf(stderr, "latency budget: benchmark %s did not run\n",
+                   budget.first.c_str());
+      ++num_violations;
+    } else if (it->second.ns_per_iteration > budget.second) {
+      std::fprintf(stderr, "latency budget: %s took %.1f ns/iter, budget %.1f\n",
+                   budget.first.c_str(), it->second.ns_per_iteration,
+                   budget.second);
+      ++num_violations;
+    }
+  }
+  return num_violations;
+}
+
+bool WriteJsonReport(const std::string &path,
+                     const std::map<std::string, double> &budgets,
+                     const std::map<std::string, Result> &results,
+                     const int num_violations) {
+  std::FILE *file = std::fopen(path.c_str(), "w");
+  if (file == nullptr) {
+    std::fprintf(stderr, "cannot open json report file %s\n", path.c_str());
+    return false;
+  }
+  std::fprintf(file, "{\n  \"benchmarks\": [\n");
+  size_t index = 0;
+  for (const auto &result : results) {
+    std::fprintf(file,
+                 "    {\"name\": \"%s\", \"iterations\": %ld, "
+                 "\"ns_per_iteration\": %.3f",
+                 result.first.c_str(),
+                 static_cast<long>(result.second.iterations),  // NOLINT
+                 result.second.ns_per_iteration);
+    const auto budget = budgets.find(result.first);
+    if (budget != budgets.end()) {
+      std::fprintf(file, ", \"budget_ns\": %.3f, \"within_budget\": %s",
+                   budget->second,
+                   result.second.ns_per_iteration <= budget->second ? "true"
+                                                                    : "false");
+    }
+    ++index;
+    std::fprintf(file, "}%s\n", index < results.size() ? "," : "");
+  }
+  std::fprintf(file, "  ],\n  \"num_violations\": %d\n}\n", num_violations);
+  std::fclose(file);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::string budget_path;
+  std::string report_path;
+  int num_args = 1;
+  for (int i = 1; i < argc; ++i) {
+    constexpr char kBudgetFlag[] = "--latency_budget=";
+    constexpr char kReportFlag[] = "--json_report=";
+    if (std::strncmp(argv[i], kBudgetFlag, sizeof(kBudgetFlag) - 1) == 0) {
+      budget_path = argv[i] + sizeof(kBudgetFlag) - 1;
+    } else if (std::strncmp(argv[i], kReportFlag, sizeof(kReportFlag) - 1) ==
+               0) {
+      report_path = argv[i] + sizeof(kReportFlag) - 1;
+    } else {
+      argv[num_args++] = argv[i];
+    }
+  }
+  argc = num_args;
+
+  std::map<std::string, double> budgets;
+  if (!budget_path.empty() && !LoadBudgets(budget_path, &budgets)) {
+    return 1;
+  }
+
+  ::benchmark::Initialize(&argc, argv);
+  RecordingReporter reporter;
+  ::benchmark::RunSpecifiedBenchmarks(&reporter);
+
+  const int num_violations = CheckBudgets(budgets, reporter.results());
+  if (!report_path.empty() &&
+      !WriteJsonReport(report_path, budgets, reporter.results(),
+                       num_violations)) {
+    return 1;
+  }
+  if (num_violations > 0) {
+    return 1;
+  }
+  if (!budgets.empty()) {
+    std::printf("latency budget: all %zu benchmarks within budget\n",
+                budgets.size());
+  }
+  return 0;
+}
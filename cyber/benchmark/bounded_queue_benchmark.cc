@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Micro benchmarks for base::BoundedQueue, the queue under every
+ *        scheduler processor and data visitor.
+ */
+
+#include <cstdint>
+#include <mutex>
+
+#include "benchmark/benchmark.h"
+
+#include "cyber/base/bounded_queue.h"
+#include "cyber/base/wait_strategy.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+namespace {
+
+// Uncontended enqueue/dequeue pair: the floor every other number sits on.
+void BM_BoundedQueueSingleThread(benchmark::State &state) {
+  BoundedQueue<uint64_t> queue;
+  queue.Init(1024);
+  uint64_t value = 0;
+  while (state.KeepRunning()) {
+    queue.Enqueue(value);
+    queue.Dequeue(&value);
+  }
+}
+BENCHMARK(BM_BoundedQueueSingleThread);
+
+// Blocking variants, to price the wait strategy on top of the CAS loop.
+void BM_BoundedQueueSingleThreadBlockWait(benchmark::State &state) {
+  BoundedQueue<uint64_t> queue;
+  queue.Init(1024, new BlockWaitStrategy());
+  uint64_t value = 0;
+  while (state.KeepRunning()) {
+    queue.WaitEnqueue(value);
+    queue.WaitDequeue(&value);
+  }
+}
+BENCHMARK(BM_BoundedQueueSingleThreadBlockWait);
+
+// Contention ladder: every thread enqueues one element and then dequeues
+// one, so occupancy stays bounded while all threads hammer the same head
+// and tail words. A pending dequeue always has a matching completed
+// enqueue, so the retry loops cannot hang at the end of the run.
+BoundedQueue<uint64_t> contended_queue;
+std::once_flag contended_queue_once;
+
+void BM_BoundedQueueContended(benchmark::State &state) {
+  std::call_once(contended_queue_once, []() { contended_queue.Init(1024); });
+  uint64_t value = 0;
+  while (state.KeepRunning()) {
+    while (!contended_queue.Enqueue(value)) {
+    }
+    while (!contended_queue.Dequeue(&value)) {
+    }
+  }
+}
+BENCHMARK(BM_BoundedQueueContended)->ThreadRange(1, 8);
+
+}  // namespace
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
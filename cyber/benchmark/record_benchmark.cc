@@ -0,0 +1,130 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Throughput benchmarks for record writing and reading with a
+ *        synthetic channel mix: nine control-sized messages per
+ *        sensor-sized one, approximating a vehicle recording.
+ */
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "cyber/message/raw_message.h"
+#include "cyber/record/record_message.h"
+#include "cyber/record/record_reader.h"
+#include "cyber/record/record_writer.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+namespace {
+
+constexpr char kSmallChannel[] = "/bench/control";
+constexpr char kLargeChannel[] = "/bench/pointcloud";
+constexpr char kMessageType[] = "apollo.cyber.message.RawMessage";
+constexpr int kSmallMessageSize = 1024;
+constexpr int kLargeMessageSize = 1 << 20;
+constexpr uint64_t kMessageIntervalNs = 10ULL * 1000 * 1000;
+
+std::string TempRecordPath(const std::string &suffix) {
+  return "/tmp/cyber_benchmark_" + std::to_string(getpid()) + "_" + suffix +
+         ".record";
+}
+
+void BM_RecordWriteMixedChannels(benchmark::State &state) {
+  const std::string path = TempRecordPath("write");
+  RecordWriter writer;
+  writer.Open(path);
+  writer.WriteChannel(kSmallChannel, kMessageType, "");
+  writer.WriteChannel(kLargeChannel, kMessageType, "");
+  const auto small = std::make_shared<message::RawMessage>(
+      std::string(kSmallMessageSize, 'c'));
+  const auto large = std::make_shared<message::RawMessage>(
+      std::string(kLargeMessageSize, 'p'));
+  uint64_t time = 0;
+  uint64_t count = 0;
+  int64_t bytes = 0;
+  while (state.KeepRunning()) {
+    time += kMessageIntervalNs;
+    if (++count % 10 == 0) {
+      writer.WriteMessage(kLargeChannel, large, time);
+      bytes += kLargeMessageSize;
+    } else {
+      writer.WriteMessage(kSmallChannel, small, time);
+      bytes += kSmallMessageSize;
+    }
+  }
+  writer.Close();
+  std::remove(path.c_str());
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_RecordWriteMixedChannels);
+
+// The read benchmark replays a fixed file written once per process; when
+// the reader runs dry mid-measurement it reopens the file, which costs a
+// header parse and stays in the noise over thousands of messages.
+std::once_flag read_file_once;
+
+void BM_RecordReadMixedChannels(benchmark::State &state) {
+  const std::string path = TempRecordPath("read");
+  std::call_once(read_file_once, [&path]() {
+    RecordWriter writer;
+    writer.Open(path);
+    writer.WriteChannel(kSmallChannel, kMessageType, "");
+    writer.WriteChannel(kLargeChannel, kMessageType, "");
+    const auto small = std::make_shared<message::RawMessage>(
+        std::string(kSmallMessageSize, 'c'));
+    const auto large = std::make_shared<message::RawMessage>(
+        std::string(kLargeMessageSize, 'p'));
+    uint64_t time = 0;
+    for (int i = 1; i <= 1000; ++i) {
+      time += kMessageIntervalNs;
+      if (i % 10 == 0) {
+        writer.WriteMessage(kLargeChannel, large, time);
+      } else {
+        writer.WriteMessage(kSmallChannel, small, time);
+      }
+    }
+    writer.Close();
+  });
+
+  auto reader = std::make_shared<RecordReader>(path);
+  RecordMessage message;
+  int64_t bytes = 0;
+  while (state.KeepRunning()) {
+    if (!reader->ReadMessage(&message)) {
+      reader = std::make_shared<RecordReader>(path);
+      continue;
+    }
+    bytes += static_cast<int64_t>(message.content.size());
+  }
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_RecordReadMixedChannels);
+
+}  // namespace
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
@@ -18,12 +18,14 @@
 #define CYBER_BLOCKER_BLOCKER_H_
 
 #include <stddef.h>
+#include <chrono>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace apollo {
@@ -77,6 +79,8 @@ class Blocker : public BlockerBase {
 
   void Publish(const MessageType& msg);
   void Publish(const MessagePtr& msg);
+  // publish with an explicit (simulation) timestamp for the history index
+  void Publish(const MessagePtr& msg, uint64_t timestamp_ns);
 
   void ClearObserved() override;
   void ClearPublished() override;
@@ -92,6 +96,15 @@ class Blocker : public BlockerBase {
   const MessagePtr GetOldestObservedPtr() const;
   const MessagePtr GetLatestPublishedPtr() const;
 
+  // indexed history mode: every published message is also recorded in a
+  // timestamp-indexed ring, so simulation components can jump the observed
+  // view to an arbitrary time point in O(log n) instead of republishing
+  // from the start
+  void EnableHistory(size_t capacity);
+  bool ObserveAt(uint64_t timestamp_ns);
+  const MessagePtr GetHistoryAt(uint64_t timestamp_ns) const;
+  size_t history_size() const;
+
   Iterator ObservedBegin() const;
   Iterator ObservedEnd() const;
 
@@ -101,12 +114,27 @@ class Blocker : public BlockerBase {
 
  private:
   void Reset() override;
-  void Enqueue(const MessagePtr& msg);
+  void Enqueue(const MessagePtr& msg, uint64_t timestamp_ns);
   void Notify(const MessagePtr& msg);
+  // index of the newest history entry at or before timestamp_ns,
+  // history_size_ if there is none; msg_mutex_ must be held
+  size_t HistoryLowerBound(uint64_t timestamp_ns) const;
+  static uint64_t NowNs() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+  }
 
   BlockerAttr attr_;
   MessageQueue observed_msg_queue_;
   MessageQueue published_msg_queue_;
+  // timestamp-indexed ring, oldest at history_begin_; timestamps are kept
+  // monotone so positions admit a binary search
+  std::vector<std::pair<uint64_t, MessagePtr>> history_;
+  size_t history_capacity_ = 0;
+  size_t history_begin_ = 0;
+  size_t history_size_ = 0;
   mutable std::mutex msg_mutex_;
 
   CallbackMap published_callbacks_;
@@ -132,7 +160,12 @@ void Blocker<T>::Publish(const MessageType& msg) {
 
 template <typename T>
 void Blocker<T>::Publish(const MessagePtr& msg) {
-  Enqueue(msg);
+  Publish(msg, NowNs());
+}
+
+template <typename T>
+void Blocker<T>::Publish(const MessagePtr& msg, uint64_t timestamp_ns) {
+  Enqueue(msg, timestamp_ns);
   Notify(msg);
 }
 
@@ -142,6 +175,8 @@ void Blocker<T>::Reset() {
     std::lock_guard<std::mutex> lock(msg_mutex_);
     observed_msg_queue_.clear();
     published_msg_queue_.clear();
+    history_begin_ = 0;
+    history_size_ = 0;
   }
   {
     std::lock_guard<std::mutex> lock(cb_mutex_);
@@ -232,6 +267,63 @@ auto Blocker<T>::GetLatestPublishedPtr() const -> const MessagePtr {
   return published_msg_queue_.front();
 }
 
+template <typename T>
+void Blocker<T>::EnableHistory(size_t capacity) {
+  std::lock_guard<std::mutex> lock(msg_mutex_);
+  history_.assign(capacity, std::make_pair(0, nullptr));
+  history_capacity_ = capacity;
+  history_begin_ = 0;
+  history_size_ = 0;
+}
+
+template <typename T>
+size_t Blocker<T>::HistoryLowerBound(uint64_t timestamp_ns) const {
+  if (history_size_ == 0 || history_[history_begin_].first > timestamp_ns) {
+    return history_size_;
+  }
+  size_t lo = 0;
+  size_t hi = history_size_ - 1;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo + 1) / 2;
+    if (history_[(history_begin_ + mid) % history_capacity_].first <=
+        timestamp_ns) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return lo;
+}
+
+template <typename T>
+bool Blocker<T>::ObserveAt(uint64_t timestamp_ns) {
+  std::lock_guard<std::mutex> lock(msg_mutex_);
+  auto pos = HistoryLowerBound(timestamp_ns);
+  if (pos == history_size_) {
+    return false;
+  }
+  observed_msg_queue_.clear();
+  observed_msg_queue_.push_front(
+      history_[(history_begin_ + pos) % history_capacity_].second);
+  return true;
+}
+
+template <typename T>
+auto Blocker<T>::GetHistoryAt(uint64_t timestamp_ns) const -> const MessagePtr {
+  std::lock_guard<std::mutex> lock(msg_mutex_);
+  auto pos = HistoryLowerBound(timestamp_ns);
+  if (pos == history_size_) {
+    return nullptr;
+  }
+  return history_[(history_begin_ + pos) % history_capacity_].second;
+}
+
+template <typename T>
+size_t Blocker<T>::history_size() const {
+  std::lock_guard<std::mutex> lock(msg_mutex_);
+  return history_size_;
+}
+
 template <typename T>
 auto Blocker<T>::ObservedBegin() const -> Iterator {
   return observed_msg_queue_.begin();
@@ -262,7 +354,7 @@ const std::string& Blocker<T>::channel_name() const {
 }
 
 template <typename T>
-void Blocker<T>::Enqueue(const MessagePtr& msg) {
+void Blocker<T>::Enqueue(const MessagePtr& msg, uint64_t timestamp_ns) {
   if (attr_.capacity == 0) {
     return;
   }
@@ -271,6 +363,26 @@ void Blocker<T>::Enqueue(const MessagePtr& msg) {
   while (published_msg_queue_.size() > attr_.capacity) {
     published_msg_queue_.pop_back();
   }
+  if (history_capacity_ > 0) {
+    if (history_size_ > 0) {
+      // keep timestamps monotone so HistoryLowerBound stays valid even if
+      // a replayed source hands us slightly out-of-order stamps
+      auto last =
+          history_[(history_begin_ + history_size_ - 1) % history_capacity_]
+              .first;
+      if (timestamp_ns < last) {
+        timestamp_ns = last;
+      }
+    }
+    if (history_size_ == history_capacity_) {
+      history_[history_begin_] = std::make_pair(timestamp_ns, msg);
+      history_begin_ = (history_begin_ + 1) % history_capacity_;
+    } else {
+      history_[(history_begin_ + history_size_) % history_capacity_] =
+          std::make_pair(timestamp_ns, msg);
+      ++history_size_;
+    }
+  }
 }
 
 template <typename T>
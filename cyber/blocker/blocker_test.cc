@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <string>
 
 #include "cyber/proto/unit_test.pb.h"
 
@@ -76,6 +77,32 @@ TEST(BlockerTest, publish) {
   EXPECT_TRUE(blocker.IsObservedEmpty());
 }
 
+
+TEST(BlockerTest, history) {
+  BlockerAttr attr(10, "channel");
+  Blocker<UnitTest> blocker(attr);
+  blocker.EnableHistory(4);
+  EXPECT_FALSE(blocker.ObserveAt(100));
+
+  for (int i = 1; i <= 6; i++) {
+    auto msg = std::make_shared<UnitTest>();
+    msg->set_case_name("history_" + std::to_string(i));
+    blocker.Publish(msg, static_cast<uint64_t>(i) * 100);
+  }
+  // ring capacity is 4, so stamps 100 and 200 have been evicted
+  EXPECT_EQ(blocker.history_size(), 4);
+  EXPECT_FALSE(blocker.ObserveAt(100));
+  EXPECT_EQ(blocker.GetHistoryAt(250), nullptr);
+
+  ASSERT_NE(blocker.GetHistoryAt(300), nullptr);
+  EXPECT_EQ(blocker.GetHistoryAt(300)->case_name(), "history_3");
+  EXPECT_EQ(blocker.GetHistoryAt(450)->case_name(), "history_4");
+  EXPECT_EQ(blocker.GetHistoryAt(10000)->case_name(), "history_6");
+
+  EXPECT_TRUE(blocker.ObserveAt(500));
+  EXPECT_EQ(blocker.GetLatestObserved().case_name(), "history_5");
+}
+
 TEST(BlockerTest, subscribe) {
   BlockerAttr attr(10, "channel");
   Blocker<UnitTest> blocker(attr);
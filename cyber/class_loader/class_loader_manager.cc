@@ -15,20 +15,25 @@
  *****************************************************************************/
 #include "cyber/class_loader/class_loader_manager.h"
 
+#include <fstream>
+#include <unordered_set>
+
 namespace apollo {
 namespace cyber {
 namespace class_loader {
 
 ClassLoaderManager::ClassLoaderManager() {}
 
-ClassLoaderManager::~ClassLoaderManager() {}
+ClassLoaderManager::~ClassLoaderManager() { WaitForPreload(); }
 
 ClassLoader* ClassLoaderManager::GetClassLoaderByLibPath(
     const std::string& library_path) {
+  std::lock_guard<std::mutex> lck(libpath_loader_map_mutex_);
   return (libpath_loader_map_[library_path]);
 }
 
 std::vector<ClassLoader*> ClassLoaderManager::GetAllValidClassLoaders() {
+  std::lock_guard<std::mutex> lck(libpath_loader_map_mutex_);
   std::vector<ClassLoader*> class_loaders;
   for (auto& lib_class_loader : libpath_loader_map_) {
     class_loaders.emplace_back(lib_class_loader.second);
@@ -54,14 +59,88 @@ bool ClassLoaderManager::IsLibraryValid(const std::string& library_name) {
 }
 
 bool ClassLoaderManager::LoadLibrary(const std::string& library_path) {
-  std::lock_guard<std::mutex> lck(libpath_loader_map_mutex_);
-  if (!IsLibraryValid(library_path)) {
-    libpath_loader_map_[library_path] =
-        new class_loader::ClassLoader(library_path);
+  {
+    std::unique_lock<std::mutex> lck(libpath_loader_map_mutex_);
+    loading_cond_.wait(
+        lck, [&]() { return loading_paths_.count(library_path) == 0; });
+    if (IsLibraryValid(library_path)) {
+      return true;
+    }
+    loading_paths_.insert(library_path);
   }
+
+  // dlopen outside the map mutex: a relocation-heavy load must not stall
+  // CreateClassObj and validity queries on other libraries
+  ClassLoader* loader = new class_loader::ClassLoader(library_path);
+
+  std::lock_guard<std::mutex> lck(libpath_loader_map_mutex_);
+  libpath_loader_map_[library_path] = loader;
+  loading_paths_.erase(library_path);
+  loading_cond_.notify_all();
   return IsLibraryValid(library_path);
 }
 
+void ClassLoaderManager::PreloadLibraries(
+    const std::vector<std::string>& library_paths) {
+  WaitForPreload();
+  preload_thread_ = std::thread([this, library_paths]() {
+    for (const auto& library_path : library_paths) {
+      if (!LoadLibrary(library_path)) {
+        AWARN << "preload library failed: " << library_path;
+      }
+    }
+  });
+}
+
+bool ClassLoaderManager::PreloadFromCache(const std::string& cache_file) {
+  std::ifstream in(cache_file);
+  if (!in.is_open()) {
+    ADEBUG << "no class loader cache at: " << cache_file;
+    return false;
+  }
+
+  std::vector<std::string> library_paths;
+  std::unordered_set<std::string> seen;
+  std::string line;
+  while (std::getline(in, line)) {
+    auto pos = line.find('\t');
+    auto library_path = line.substr(0, pos);
+    if (!library_path.empty() && seen.insert(library_path).second) {
+      library_paths.emplace_back(library_path);
+    }
+  }
+  if (library_paths.empty()) {
+    return false;
+  }
+  PreloadLibraries(library_paths);
+  return true;
+}
+
+bool ClassLoaderManager::DumpFactoryCache(const std::string& cache_file) {
+  std::ofstream of(cache_file, std::ios::trunc);
+  if (!of.is_open()) {
+    AERROR << "open class loader cache failed: " << cache_file;
+    return false;
+  }
+
+  std::lock_guard<std::recursive_mutex> lck(
+      utility::GetClassFactoryMapMapMutex());
+  for (auto& baseclass_map : utility::GetClassFactoryMapMap()) {
+    for (auto& class_factory : baseclass_map.second) {
+      of << class_factory.second->GetRelativeLibraryPath() << '\t'
+         << class_factory.second->GetBaseClassName() << '\t'
+         << class_factory.second->GetClassName() << '\n';
+    }
+  }
+  return true;
+}
+
+void ClassLoaderManager::WaitForPreload() {
+  if (preload_thread_.joinable()) {
+    preload_thread_.join();
+  }
+}
+
 int ClassLoaderManager::UnloadLibrary(const std::string& library_path) {
   int num_remain_unload = 0;
   if (IsLibraryValid(library_path)) {
@@ -17,11 +17,14 @@
 #ifndef CYBER_CLASS_LOADER_CLASS_LOADER_MANAGER_H_
 #define CYBER_CLASS_LOADER_CLASS_LOADER_MANAGER_H_
 
+#include <condition_variable>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "cyber/class_loader/class_loader.h"
@@ -36,6 +39,16 @@ class ClassLoaderManager {
   virtual ~ClassLoaderManager();
 
   bool LoadLibrary(const std::string& library_path);
+
+  // load the given libraries on a background thread so mainboard's critical
+  // path can overlap component setup with relocation-heavy dlopens
+  void PreloadLibraries(const std::vector<std::string>& library_paths);
+  // preload the libraries recorded by DumpFactoryCache on a previous run
+  bool PreloadFromCache(const std::string& cache_file);
+  // persist library->class factory bookkeeping for PreloadFromCache
+  bool DumpFactoryCache(const std::string& cache_file);
+  void WaitForPreload();
+
   void UnloadAllLibrary();
   bool IsLibraryValid(const std::string& library_path);
   template <typename Base>
@@ -57,6 +70,11 @@ class ClassLoaderManager {
  private:
   std::mutex libpath_loader_map_mutex_;
   std::map<std::string, ClassLoader*> libpath_loader_map_;
+  // paths whose dlopen is in flight; LoadLibrary releases the map mutex
+  // while the library loads so other callers do not stall behind it
+  std::unordered_set<std::string> loading_paths_;
+  std::condition_variable loading_cond_;
+  std::thread preload_thread_;
 };
 
 template <typename Base>
@@ -20,14 +20,72 @@
 #include <errno.h>
 #include <glob.h>
 #include <stddef.h>
+#include <sys/mman.h>
 #include <unistd.h>
+#include <climits>
 #include <fstream>
 #include <string>
 
+#include "google/protobuf/wire_format_lite.h"
+
 namespace apollo {
 namespace cyber {
 namespace common {
 
+namespace {
+
+// Maps file_name read-only. On success the caller owns the descriptor and
+// the mapping. An empty file yields a null mapping with *size == 0.
+bool MapFileReadOnly(const std::string &file_name, int *fd, const char **data,
+                     size_t *size) {
+  *fd = open(file_name.c_str(), O_RDONLY);
+  if (*fd < 0) {
+    AERROR << "Failed to open file " << file_name << " in binary mode.";
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(*fd, &file_stat) != 0) {
+    AERROR << "Failed to stat file " << file_name;
+    close(*fd);
+    *fd = -1;
+    return false;
+  }
+  if (file_stat.st_size > INT_MAX) {
+    // CodedInputStream limits apply; fall back to the streaming parsers.
+    AERROR << "File " << file_name << " is too large to map for parsing.";
+    close(*fd);
+    *fd = -1;
+    return false;
+  }
+  *size = static_cast<size_t>(file_stat.st_size);
+  if (*size == 0) {
+    *data = nullptr;
+    return true;
+  }
+  void *mapping = mmap(nullptr, *size, PROT_READ, MAP_PRIVATE, *fd, 0);
+  if (mapping == MAP_FAILED) {
+    AERROR << "Failed to mmap file " << file_name;
+    close(*fd);
+    *fd = -1;
+    return false;
+  }
+  // The parsers below walk the file front to back exactly once.
+  madvise(mapping, *size, MADV_SEQUENTIAL);
+  *data = static_cast<const char *>(mapping);
+  return true;
+}
+
+void UnmapFile(const int fd, const char *data, const size_t size) {
+  if (data != nullptr) {
+    munmap(const_cast<char *>(data), size);
+  }
+  if (fd >= 0) {
+    close(fd);
+  }
+}
+
+}  // namespace
+
 bool SetProtoToASCIIFile(const google::protobuf::Message &message,
                          int file_descriptor) {
   using google::protobuf::TextFormat;
@@ -110,6 +168,100 @@ bool GetProtoFromFile(const std::string &file_name,
          GetProtoFromBinaryFile(file_name, message);
 }
 
+bool GetProtoFromBinaryFileZeroCopy(const std::string &file_name,
+                                    google::protobuf::Message *message) {
+  int fd = -1;
+  const char *data = nullptr;
+  size_t size = 0;
+  if (!MapFileReadOnly(file_name, &fd, &data, &size)) {
+    return false;
+  }
+  google::protobuf::io::ArrayInputStream raw_stream(data,
+                                                    static_cast<int>(size));
+  google::protobuf::io::CodedInputStream coded_stream(&raw_stream);
+  // The default 64 MB limit is far below base map sizes.
+  coded_stream.SetTotalBytesLimit(INT_MAX, 536870912);
+  const bool success = message->ParseFromCodedStream(&coded_stream) &&
+                       coded_stream.ConsumedEntireMessage();
+  if (!success) {
+    AERROR << "Failed to parse file " << file_name << " as binary proto.";
+  }
+  UnmapFile(fd, data, size);
+  return success;
+}
+
+bool GetProtoFromFileZeroCopy(const std::string &file_name,
+                              google::protobuf::Message *message) {
+  // Try the binary parser first if it's much likely a binary proto.
+  static const std::string kBinExt = ".bin";
+  if (std::equal(kBinExt.rbegin(), kBinExt.rend(), file_name.rbegin())) {
+    return GetProtoFromBinaryFileZeroCopy(file_name, message) ||
+           GetProtoFromASCIIFile(file_name, message);
+  }
+
+  return GetProtoFromASCIIFile(file_name, message) ||
+         GetProtoFromBinaryFileZeroCopy(file_name, message);
+}
+
+ProtoFieldStreamer::ProtoFieldStreamer(const std::string &file_name) {
+  if (MapFileReadOnly(file_name, &fd_, &data_, &size_)) {
+    Reset();
+  }
+}
+
+ProtoFieldStreamer::~ProtoFieldStreamer() {
+  coded_stream_.reset();
+  raw_stream_.reset();
+  UnmapFile(fd_, data_, size_);
+}
+
+void ProtoFieldStreamer::Reset() {
+  coded_stream_.reset();
+  raw_stream_.reset(new google::protobuf::io::ArrayInputStream(
+      data_, static_cast<int>(size_)));
+  coded_stream_.reset(
+      new google::protobuf::io::CodedInputStream(raw_stream_.get()));
+  coded_stream_->SetTotalBytesLimit(INT_MAX, 536870912);
+}
+
+bool ProtoFieldStreamer::ReadNext(const int field_number,
+                                  google::protobuf::Message *message) {
+  using google::protobuf::internal::WireFormatLite;
+  if (coded_stream_ == nullptr) {
+    return false;
+  }
+  for (;;) {
+    const uint32_t tag = coded_stream_->ReadTag();
+    if (tag == 0) {
+      // End of file.
+      return false;
+    }
+    if (WireFormatLite::GetTagFieldNumber(tag) == field_number &&
+        WireFormatLite::GetTagWireType(tag) ==
+            WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+      uint32_t length = 0;
+      if (!coded_stream_->ReadVarint32(&length)) {
+        AERROR << "Failed to read the length of field " << field_number;
+        return false;
+      }
+      const auto limit = coded_stream_->PushLimit(length);
+      message->Clear();
+      const bool success =
+          message->MergePartialFromCodedStream(coded_stream_.get()) &&
+          coded_stream_->ConsumedEntireMessage();
+      coded_stream_->PopLimit(limit);
+      if (!success) {
+        AERROR << "Failed to parse an element of field " << field_number;
+      }
+      return success;
+    }
+    if (!WireFormatLite::SkipField(coded_stream_.get(), tag)) {
+      AERROR << "Failed to skip field with tag " << tag;
+      return false;
+    }
+  }
+}
+
 bool GetContent(const std::string &file_name, std::string *content) {
   std::ifstream fin(file_name);
   if (!fin) {
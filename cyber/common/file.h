@@ -29,10 +29,12 @@
 #include <unistd.h>
 #include <cstdio>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "cyber/common/log.h"
+#include "google/protobuf/io/coded_stream.h"
 #include "google/protobuf/io/zero_copy_stream_impl.h"
 #include "google/protobuf/text_format.h"
 
@@ -99,6 +101,74 @@ bool GetProtoFromBinaryFile(const std::string &file_name,
 bool GetProtoFromFile(const std::string &file_name,
                       google::protobuf::Message *message);
 
+/**
+ * @brief Parses a binary protobuf file through a read-only memory mapping,
+ *        avoiding the stream read copies of GetProtoFromBinaryFile. Intended
+ *        for large files such as base maps; files beyond 2 GB are rejected.
+ * @param file_name The name of the file to parse.
+ * @param message The proto to carry the parsed content.
+ * @return If the action is successful.
+ */
+bool GetProtoFromBinaryFileZeroCopy(const std::string &file_name,
+                                    google::protobuf::Message *message);
+
+/**
+ * @brief GetProtoFromFile with the binary branch going through the mmap
+ *        zero-copy parser. Format detection is the same: ".bin" files try
+ *        binary first, everything else tries text format first.
+ * @param file_name The name of the file to parse.
+ * @param message The proto to carry the parsed content.
+ * @return If the action is successful.
+ */
+bool GetProtoFromFileZeroCopy(const std::string &file_name,
+                              google::protobuf::Message *message);
+
+/**
+ * @class ProtoFieldStreamer
+ * @brief Streams the top-level fields of a memory-mapped binary proto file
+ *        one element at a time, without materializing the containing
+ *        message. Useful to iterate a large repeated field - e.g. the lane
+ *        elements of a serialized map - while keeping only one element
+ *        resident.
+ *
+ *        ProtoFieldStreamer streamer("base_map.bin");
+ *        apollo::hdmap::Lane lane;
+ *        while (streamer.ReadNext(kLaneFieldNumber, &lane)) { ... }
+ */
+class ProtoFieldStreamer {
+ public:
+  explicit ProtoFieldStreamer(const std::string &file_name);
+  ~ProtoFieldStreamer();
+
+  /**
+   * @brief Whether the file was opened and mapped successfully.
+   */
+  bool IsOpen() const { return data_ != nullptr; }
+
+  /**
+   * @brief Parse the next element of the given top-level field into
+   *        *message, skipping over other fields. The field must be
+   *        length-delimited, i.e. a message or string field.
+   * @param field_number The proto field number to extract.
+   * @param message The proto to carry the next element.
+   * @return Whether an element was parsed; false at end of file or on a
+   *         malformed file.
+   */
+  bool ReadNext(const int field_number, google::protobuf::Message *message);
+
+  /**
+   * @brief Restart streaming from the beginning of the file.
+   */
+  void Reset();
+
+ private:
+  int fd_ = -1;
+  const char *data_ = nullptr;
+  size_t size_ = 0;
+  std::unique_ptr<google::protobuf::io::ArrayInputStream> raw_stream_;
+  std::unique_ptr<google::protobuf::io::CodedInputStream> coded_stream_;
+};
+
 /**
  * @brief Get file content as string.
  * @param file_name The name of the file to read content.
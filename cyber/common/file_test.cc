@@ -51,6 +51,78 @@ TEST(FileTest, proto_set_get_test) {
   remove("message.ascii");
 }
 
+TEST(FileTest, proto_zero_copy_test) {
+  apollo::cyber::proto::UnitTest message;
+  message.set_class_name("FileTest");
+  message.set_case_name("proto_zero_copy_test");
+  apollo::cyber::proto::UnitTest read_message;
+  EXPECT_TRUE(SetProtoToBinaryFile(message, "message.bin"));
+  EXPECT_TRUE(SetProtoToASCIIFile(message, "message.ascii"));
+
+  EXPECT_FALSE(
+      GetProtoFromBinaryFileZeroCopy("not_exists_dir/msg.bin", &read_message));
+  EXPECT_TRUE(GetProtoFromBinaryFileZeroCopy("message.bin", &read_message));
+  EXPECT_EQ("proto_zero_copy_test", read_message.case_name());
+
+  read_message.Clear();
+  EXPECT_TRUE(GetProtoFromFileZeroCopy("message.bin", &read_message));
+  EXPECT_EQ("FileTest", read_message.class_name());
+  read_message.Clear();
+  EXPECT_TRUE(GetProtoFromFileZeroCopy("message.ascii", &read_message));
+  EXPECT_EQ("FileTest", read_message.class_name());
+  EXPECT_FALSE(GetProtoFromFileZeroCopy("not_exists_dir/msg", &read_message));
+
+  remove("message.bin");
+  remove("message.ascii");
+}
+
+TEST(FileTest, proto_field_streamer_test) {
+  // unit_test.proto has no repeated message field, so build a container with
+  // three length-delimited elements under field number 3 by hand.
+  apollo::cyber::proto::UnitTest element;
+  std::string file_content;
+  {
+    google::protobuf::io::StringOutputStream raw_output(&file_content);
+    google::protobuf::io::CodedOutputStream coded_output(&raw_output);
+    // An unrelated scalar field the streamer must skip: field 1, varint 7.
+    coded_output.WriteVarint32((1 << 3) | 0);
+    coded_output.WriteVarint32(7);
+    for (int i = 0; i < 3; ++i) {
+      element.set_class_name("FileTest");
+      element.set_case_name("element_" + std::to_string(i));
+      coded_output.WriteVarint32((3 << 3) | 2);
+      coded_output.WriteVarint32(
+          static_cast<google::protobuf::uint32>(element.ByteSizeLong()));
+      element.SerializeToCodedStream(&coded_output);
+    }
+  }
+  {
+    std::ofstream file("streamer.bin", std::ios::out | std::ios::binary);
+    file << file_content;
+  }
+
+  ProtoFieldStreamer missing("not_exists_dir/streamer.bin");
+  EXPECT_FALSE(missing.IsOpen());
+  EXPECT_FALSE(missing.ReadNext(3, &element));
+
+  ProtoFieldStreamer streamer("streamer.bin");
+  EXPECT_TRUE(streamer.IsOpen());
+  int count = 0;
+  while (streamer.ReadNext(3, &element)) {
+    EXPECT_EQ("FileTest", element.class_name());
+    EXPECT_EQ("element_" + std::to_string(count), element.case_name());
+    ++count;
+  }
+  EXPECT_EQ(3, count);
+
+  // Reset() rewinds to the first element.
+  streamer.Reset();
+  EXPECT_TRUE(streamer.ReadNext(3, &element));
+  EXPECT_EQ("element_0", element.case_name());
+
+  remove("streamer.bin");
+}
+
 TEST(FileTest, file_utils_test) {
   apollo::cyber::proto::UnitTest message;
   message.set_class_name("FileTest");
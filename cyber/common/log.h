@@ -27,6 +27,10 @@
 #include "glog/logging.h"
 #include "glog/raw_logging.h"
 
+#ifdef CYBER_BINARY_LOG
+#include "cyber/logger/binary_log.h"
+#endif
+
 #define LEFT_BRACKET "["
 #define RIGHT_BRACKET "] "
 
@@ -34,8 +38,25 @@
 #define MODULE_NAME apollo::cyber::Binary::GetName().c_str()
 #endif
 
+#ifdef CYBER_BINARY_LOG
+// Structured binary mode: the call site is interned once into a static id
+// and each statement only captures raw argument values; rendering happens
+// offline via cyber_binlog. FATAL (and the CHECK/EVERY variants) stay on
+// glog so abort and rate-limit semantics are unchanged. -1 marks ADEBUG.
+#define ALOG_BINARY_STREAM(module, glog_severity)                         \
+  [](const char* binlog_module) {                                         \
+    static const uint32_t binlog_site_id =                                \
+        ::apollo::cyber::logger::BinaryLogSink::Instance()->RegisterSite( \
+            __FILE__, __LINE__, glog_severity);                           \
+    return ::apollo::cyber::logger::BinaryLogMessage(binlog_site_id,      \
+                                                     binlog_module);      \
+  }(module)
+
+#define ADEBUG_MODULE(module) ALOG_BINARY_STREAM(module, -1)
+#else
 #define ADEBUG_MODULE(module) \
   VLOG(4) << LEFT_BRACKET << MODULE_NAME << RIGHT_BRACKET << "[DEBUG] "
+#endif
 #define ADEBUG ADEBUG_MODULE(MODULE_NAME)
 #define AINFO ALOG_MODULE(MODULE_NAME, INFO)
 #define AWARN ALOG_MODULE(MODULE_NAME, WARN)
@@ -51,6 +72,16 @@
   ALOG_MODULE_STREAM(log_severity)(module)
 #endif
 
+#ifdef CYBER_BINARY_LOG
+#define ALOG_MODULE_STREAM_INFO(module) \
+  ALOG_BINARY_STREAM(module, google::INFO)
+
+#define ALOG_MODULE_STREAM_WARN(module) \
+  ALOG_BINARY_STREAM(module, google::WARNING)
+
+#define ALOG_MODULE_STREAM_ERROR(module) \
+  ALOG_BINARY_STREAM(module, google::ERROR)
+#else
 #define ALOG_MODULE_STREAM_INFO(module)                         \
   google::LogMessage(__FILE__, __LINE__, google::INFO).stream() \
       << LEFT_BRACKET << module << RIGHT_BRACKET
@@ -62,6 +93,7 @@
 #define ALOG_MODULE_STREAM_ERROR(module)                         \
   google::LogMessage(__FILE__, __LINE__, google::ERROR).stream() \
       << LEFT_BRACKET << module << RIGHT_BRACKET
+#endif
 
 #define ALOG_MODULE_STREAM_FATAL(module)                         \
   google::LogMessage(__FILE__, __LINE__, google::FATAL).stream() \
@@ -70,9 +102,16 @@
 #define AINFO_IF(cond) ALOG_IF(INFO, cond, MODULE_NAME)
 #define AWARN_IF(cond) ALOG_IF(WARN, cond, MODULE_NAME)
 #define AERROR_IF(cond) ALOG_IF(ERROR, cond, MODULE_NAME)
+#ifdef CYBER_BINARY_LOG
+#define ALOG_IF(severity, cond, module)            \
+  !(cond) ? (void)0                                \
+          : ::apollo::cyber::logger::BinaryLogVoidify() & \
+                ALOG_MODULE(module, severity)
+#else
 #define ALOG_IF(severity, cond, module) \
   !(cond) ? (void)0                     \
           : google::LogMessageVoidify() & ALOG_MODULE(module, severity)
+#endif
 
 #define ACHECK(cond) CHECK(cond) << LEFT_BRACKET << MODULE_NAME << RIGHT_BRACKET
 
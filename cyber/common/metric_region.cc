@@ -0,0 +1,44 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/common/metric_region.h"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace common {
+
+MetricRegion* AttachMetricRegion() {
+  // freshly created segments are zero-filled, so every slot starts free
+  int shmid =
+      shmget(METRIC_REGION_SHM_KEY, sizeof(MetricRegion), 0644 | IPC_CREAT);
+  if (shmid == -1) {
+    AERROR << "create shm failed for metric region, error: " << strerror(errno);
+    return nullptr;
+  }
+  void* addr = shmat(shmid, nullptr, 0);
+  if (addr == reinterpret_cast<void*>(-1)) {
+    AERROR << "attach shm failed for metric region, error: "
+           << strerror(errno);
+    return nullptr;
+  }
+  return reinterpret_cast<MetricRegion*>(addr);
+}
+
+}  // namespace common
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_COMMON_METRIC_REGION_H_
+#define CYBER_COMMON_METRIC_REGION_H_
+
+#include <sys/shm.h>
+#include <atomic>
+#include <cstdint>
+
+namespace apollo {
+namespace cyber {
+namespace common {
+
+// key of the host-wide metric region, shared by every cyber process
+constexpr key_t METRIC_REGION_SHM_KEY = 0x43594D54;
+
+constexpr int METRIC_REGION_SLOT_NUM = 64;
+constexpr int METRIC_PROCESS_NAME_LEN = 64;
+
+/**
+ * @brief one process's live metrics inside the shared metric region.
+ *
+ * A slot is claimed by compare-and-swapping pid from 0 and released by
+ * storing 0 back, so readers treat pid == 0 as a free slot. All fields
+ * are plain atomics: readers map the region and load them directly, with
+ * no syscall or lock on either side.
+ */
+struct MetricSlot {
+  std::atomic<int32_t> pid;
+  char process_name[METRIC_PROCESS_NAME_LEN];
+  // time of the last heartbeat, in nanoseconds
+  std::atomic<uint64_t> heartbeat_ns;
+  // duration of the latest processing cycle, in nanoseconds
+  std::atomic<uint64_t> cycle_time_ns;
+  // deepest pending queue observed since the last reader reset
+  std::atomic<uint64_t> max_queue_depth;
+};
+
+struct MetricRegion {
+  MetricSlot slots[METRIC_REGION_SLOT_NUM];
+};
+
+/**
+ * @brief attach the host-wide metric region, creating it on first use.
+ * @return the mapped region, or nullptr on failure.
+ */
+MetricRegion* AttachMetricRegion();
+
+}  // namespace common
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_COMMON_METRIC_REGION_H_
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/common/process_metrics.h"
+
+#include <unistd.h>
+#include <cstring>
+#include <string>
+
+#include "cyber/common/global_data.h"
+#include "cyber/common/log.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace common {
+
+ProcessMetrics::ProcessMetrics() {
+  region_ = AttachMetricRegion();
+  if (region_ == nullptr) {
+    return;
+  }
+  const int32_t pid = static_cast<int32_t>(getpid());
+  for (auto& slot : region_->slots) {
+    int32_t expected = 0;
+    if (slot.pid.compare_exchange_strong(expected, pid,
+                                         std::memory_order_acq_rel)) {
+      const std::string& name = GlobalData::Instance()->ProcessGroup();
+      std::strncpy(slot.process_name, name.c_str(),
+                   METRIC_PROCESS_NAME_LEN - 1);
+      slot.process_name[METRIC_PROCESS_NAME_LEN - 1] = '\0';
+      slot.heartbeat_ns.store(Time::Now().ToNanosecond(),
+                              std::memory_order_relaxed);
+      slot.cycle_time_ns.store(0, std::memory_order_relaxed);
+      slot.max_queue_depth.store(0, std::memory_order_relaxed);
+      slot_ = &slot;
+      return;
+    }
+  }
+  AWARN << "no free slot in metric region, process metrics disabled";
+}
+
+ProcessMetrics::~ProcessMetrics() {
+  if (slot_ != nullptr) {
+    slot_->pid.store(0, std::memory_order_release);
+    slot_ = nullptr;
+  }
+  if (region_ != nullptr) {
+    shmdt(region_);
+    region_ = nullptr;
+  }
+}
+
+void ProcessMetrics::Heartbeat() {
+  if (slot_ == nullptr) {
+    return;
+  }
+  slot_->heartbeat_ns.store(Time::Now().ToNanosecond(),
+                            std::memory_order_relaxed);
+}
+
+void ProcessMetrics::SetCycleTime(uint64_t cycle_time_ns) {
+  if (slot_ == nullptr) {
+    return;
+  }
+  slot_->cycle_time_ns.store(cycle_time_ns, std::memory_order_relaxed);
+}
+
+void ProcessMetrics::ReportQueueDepth(uint64_t depth) {
+  if (slot_ == nullptr) {
+    return;
+  }
+  // keep the maximum until the monitor resets it
+  uint64_t current = slot_->max_queue_depth.load(std::memory_order_relaxed);
+  while (depth > current && !slot_->max_queue_depth.compare_exchange_weak(
+                                current, depth, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace common
+}  // namespace cyber
+}  // namespace apollo
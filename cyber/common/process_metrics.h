@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_COMMON_PROCESS_METRICS_H_
+#define CYBER_COMMON_PROCESS_METRICS_H_
+
+#include "cyber/common/macros.h"
+#include "cyber/common/metric_region.h"
+
+namespace apollo {
+namespace cyber {
+namespace common {
+
+/**
+ * @brief this process's writer into the shared metric region.
+ *
+ * Claims one slot on first use and publishes heartbeats, cycle times and
+ * queue depths with plain atomic stores, so instrumented hot paths pay a
+ * few nanoseconds instead of a syscall. Every method degrades to a no-op
+ * when the region could not be attached or no slot was free.
+ */
+class ProcessMetrics {
+ public:
+  ~ProcessMetrics();
+
+  /**
+   * @brief mark this process alive at the current time.
+   */
+  void Heartbeat();
+
+  /**
+   * @brief publish the duration of the latest processing cycle.
+   * @param cycle_time_ns cycle duration in nanoseconds.
+   */
+  void SetCycleTime(uint64_t cycle_time_ns);
+
+  /**
+   * @brief publish a pending-queue depth; the slot keeps the maximum
+   * until a reader resets it.
+   * @param depth number of pending messages.
+   */
+  void ReportQueueDepth(uint64_t depth);
+
+ private:
+  MetricRegion* region_ = nullptr;
+  MetricSlot* slot_ = nullptr;
+
+  DECLARE_SINGLETON(ProcessMetrics)
+};
+
+}  // namespace common
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_COMMON_PROCESS_METRICS_H_
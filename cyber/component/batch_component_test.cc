@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/component/batch_component.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "cyber/init.h"
+#include "cyber/message/raw_message.h"
+
+namespace apollo {
+namespace cyber {
+
+using apollo::cyber::message::RawMessage;
+using apollo::cyber::proto::ComponentConfig;
+
+static bool batch_ret_proc = true;
+static bool batch_ret_init = true;
+static size_t last_batch_size = 0;
+
+template <typename M0>
+class BatchComponent_A : public BatchComponent<M0> {
+ public:
+  BatchComponent_A() {}
+  bool Init() { return batch_ret_init; }
+
+ private:
+  bool Proc(const std::vector<std::shared_ptr<M0>> &msgs) {
+    last_batch_size = msgs.size();
+    return batch_ret_proc;
+  }
+};
+
+TEST(BatchComponent, init) {
+  batch_ret_proc = true;
+  batch_ret_init = true;
+  apollo::cyber::proto::ComponentConfig compcfg;
+
+  compcfg.set_name("batch_chassis");
+  apollo::cyber::proto::ReaderOption *read_opt = compcfg.add_readers();
+  read_opt->set_channel("/chassis/channel");
+  read_opt->set_batch_size(10);
+  read_opt->set_batch_window_ms(20);
+  auto com = std::make_shared<BatchComponent_A<RawMessage>>();
+  EXPECT_TRUE(com->Initialize(compcfg));
+
+  std::vector<std::shared_ptr<RawMessage>> batch;
+  for (int i = 0; i < 10; ++i) {
+    batch.emplace_back(std::make_shared<RawMessage>());
+  }
+  EXPECT_TRUE(com->Process(batch));
+  EXPECT_EQ(last_batch_size, 10u);
+}
+
+TEST(BatchComponentFail, init) {
+  batch_ret_proc = false;
+  batch_ret_init = false;
+  apollo::cyber::proto::ComponentConfig compcfg;
+
+  compcfg.set_name("batch_chassis_f");
+  apollo::cyber::proto::ReaderOption *read_opt = compcfg.add_readers();
+  read_opt->set_channel("/chassis/channel");
+  auto com = std::make_shared<BatchComponent_A<RawMessage>>();
+  EXPECT_FALSE(com->Initialize(compcfg));
+
+  std::vector<std::shared_ptr<RawMessage>> batch;
+  batch.emplace_back(std::make_shared<RawMessage>());
+  EXPECT_FALSE(com->Process(batch));
+}
+
+}  // namespace cyber
+}  // namespace apollo
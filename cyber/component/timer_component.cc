@@ -15,6 +15,8 @@
  *****************************************************************************/
 
 #include "cyber/component/timer_component.h"
+#include "cyber/common/process_metrics.h"
+#include "cyber/time/time.h"
 #include "cyber/timer/timer.h"
 
 namespace apollo {
@@ -47,7 +49,13 @@ bool TimerComponent::Initialize(const TimerComponentConfig& config) {
   auto func = [self]() {
     auto ptr = self.lock();
     if (ptr) {
+      const uint64_t start = Time::Now().ToNanosecond();
       ptr->Proc();
+      const uint64_t end = Time::Now().ToNanosecond();
+      // publish liveness and cycle time into the shared metric region
+      auto* metrics = common::ProcessMetrics::Instance();
+      metrics->Heartbeat();
+      metrics->SetCycleTime(end - start);
     }
   };
   timer_.reset(new Timer(config.interval(), func, false));
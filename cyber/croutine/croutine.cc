@@ -54,6 +54,9 @@ CRoutine::CRoutine(const std::function<void()> &func) : func_(func) {
       routine_num = global_conf.scheduler_conf().routine_num();
     }
     context_pool.reset(new base::CCObjectPool<RoutineContext>(routine_num));
+    // pooled contexts need their constructors run so each one maps its
+    // guard-paged stack; the mappings are reused across routine lifetimes
+    context_pool->ConstructAll();
   });
 
   context_ = context_pool->GetObject();
@@ -82,6 +85,7 @@ RoutineState CRoutine::Resume() {
   }
 
   current_routine_ = this;
+  run_start_ = std::chrono::steady_clock::now();
   PerfEventCache::Instance()->AddSchedEvent(
       SchedPerf::SWAP_IN, id_, processor_id_, static_cast<int>(state_));
   SwapContext(GetMainStack(), GetStack());
@@ -45,6 +45,7 @@ class CRoutine {
   // static interfaces
   static void Yield();
   static void Yield(const RoutineState &state);
+  static void CheckPoint();
   static void SetMainContext(const std::shared_ptr<RoutineContext> &context);
   static CRoutine *GetCurrentRoutine();
   static char **GetMainStack();
@@ -94,6 +95,13 @@ class CRoutine {
 
   const std::string &group_name() { return group_name_; }
 
+  // per-cycle execution budget used by CheckPoint(); 0 disables it
+  uint32_t deadline_us() const { return deadline_us_; }
+  void set_deadline_us(uint32_t deadline_us) { deadline_us_ = deadline_us; }
+
+  bool sheddable() const { return sheddable_; }
+  void set_sheddable(bool sheddable) { sheddable_ = sheddable; }
+
  private:
   CRoutine(CRoutine &) = delete;
   CRoutine &operator=(CRoutine &) = delete;
@@ -116,6 +124,10 @@ class CRoutine {
   uint32_t priority_ = 0;
   uint64_t id_ = 0;
 
+  uint32_t deadline_us_ = 0;
+  bool sheddable_ = false;
+  std::chrono::steady_clock::time_point run_start_;
+
   std::string group_name_;
 
   static thread_local CRoutine *current_routine_;
@@ -132,6 +144,21 @@ inline void CRoutine::Yield() {
   SwapContext(GetCurrentRoutine()->GetStack(), GetMainStack());
 }
 
+// Cooperative preemption checkpoint: cheap enough to sprinkle through
+// long-running routine bodies, it yields back to the scheduler once the
+// current cycle has run past the routine's configured budget so a
+// higher-priority routine pinned behind it is not starved.
+inline void CRoutine::CheckPoint() {
+  auto routine = GetCurrentRoutine();
+  if (routine == nullptr || routine->deadline_us_ == 0) {
+    return;
+  }
+  auto elapsed = std::chrono::steady_clock::now() - routine->run_start_;
+  if (elapsed > std::chrono::microseconds(routine->deadline_us_)) {
+    Yield(RoutineState::READY);
+  }
+}
+
 inline CRoutine *CRoutine::GetCurrentRoutine() { return current_routine_; }
 
 inline char **CRoutine::GetMainStack() { return &main_stack_; }
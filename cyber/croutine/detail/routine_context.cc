@@ -16,10 +16,40 @@
 
 #include "cyber/croutine/detail/routine_context.h"
 
+#include <sys/mman.h>
+#include <unistd.h>
+
 namespace apollo {
 namespace cyber {
 namespace croutine {
 
+RoutineContext::RoutineContext(size_t size) : stack_size(size) {
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  void* addr = mmap(nullptr, stack_size + page_size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+  if (addr == MAP_FAILED) {
+    AERROR << "mmap routine stack failed, size: " << stack_size;
+    stack = static_cast<char*>(std::malloc(stack_size));
+    return;
+  }
+  // guard page at the low end; the stack grows downwards into it
+  if (mprotect(addr, page_size, PROT_NONE) != 0) {
+    AWARN << "mprotect stack guard page failed.";
+  }
+  guard_ = static_cast<char*>(addr);
+  stack = static_cast<char*>(addr) + page_size;
+}
+
+RoutineContext::~RoutineContext() {
+  if (guard_ != nullptr) {
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    munmap(guard_, stack_size + page_size);
+  } else if (stack != nullptr) {
+    std::free(stack);
+  }
+  stack = nullptr;
+}
+
 //  The stack layout looks as follows:
 //
 //              +------------------+
@@ -38,9 +68,9 @@ namespace croutine {
 // ctx->sp  =>  |        RBP       |
 //              +------------------+
 void MakeContext(const func &f1, const void *arg, RoutineContext *ctx) {
-  ctx->sp = ctx->stack + STACK_SIZE - 2 * sizeof(void *) - REGISTERS_SIZE;
+  ctx->sp = ctx->stack + ctx->stack_size - 2 * sizeof(void *) - REGISTERS_SIZE;
   std::memset(ctx->sp, 0, REGISTERS_SIZE);
-  char *sp = ctx->stack + STACK_SIZE - 2 * sizeof(void *);
+  char *sp = ctx->stack + ctx->stack_size - 2 * sizeof(void *);
   *reinterpret_cast<void **>(sp) = reinterpret_cast<void *>(f1);
   sp -= sizeof(void *);
   *reinterpret_cast<void **>(sp) = const_cast<void *>(arg);
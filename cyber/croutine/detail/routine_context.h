@@ -35,9 +35,23 @@ constexpr size_t STACK_SIZE = 2 * 1024 * 1024;
 constexpr size_t REGISTERS_SIZE = 56;
 
 typedef void (*func)(void*);
+
+// The stack is an anonymous mapping with a PROT_NONE guard page at its
+// low end, so pages are committed lazily as a routine actually touches
+// them and an overflow faults instead of corrupting a neighbor stack.
+// Contexts are pooled and reused across routine lifetimes; the mapping
+// survives with the context.
 struct RoutineContext {
-  char stack[STACK_SIZE];
+  explicit RoutineContext(size_t size = STACK_SIZE);
+  ~RoutineContext();
+
+  char* stack = nullptr;
+  size_t stack_size = 0;
   char* sp = nullptr;
+
+ private:
+  // start of the mapping (the guard page) when mmap succeeded
+  char* guard_ = nullptr;
 };
 
 void MakeContext(const func& f1, const void* arg, RoutineContext* ctx);
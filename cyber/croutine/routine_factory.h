@@ -17,8 +17,10 @@
 #ifndef CYBER_CROUTINE_ROUTINE_FACTORY_H_
 #define CYBER_CROUTINE_ROUTINE_FACTORY_H_
 
+#include <chrono>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
@@ -69,9 +71,62 @@ RoutineFactory CreateRoutineFactory(
   return factory;
 }
 
-template <typename M0, typename M1, typename F>
+// Micro-batched variant: f takes a vector of messages and runs once per
+// batch instead of once per message. A batch is delivered when batch_size
+// messages are pending, or when the oldest buffered message has waited
+// longer than window_ns (checked on each wakeup, so a partial batch
+// flushes at the next data arrival or scheduler visit after the window
+// expires). window_ns of 0 flushes whatever is pending on every wakeup.
+template <typename M0, typename F>
+RoutineFactory CreateBatchRoutineFactory(
+    F&& f, const std::shared_ptr<data::DataVisitor<M0>>& dv,
+    uint32_t batch_size, uint64_t window_ns) {
+  RoutineFactory factory;
+  factory.SetDataVisitor(dv);
+  factory.create_routine = [=]() {
+    return [=]() {
+      std::vector<std::shared_ptr<M0>> batch;
+      batch.reserve(batch_size);
+      uint64_t window_start_ns = 0;
+      for (;;) {
+        CRoutine::GetCurrentRoutine()->set_state(RoutineState::DATA_WAIT);
+        if (dv->TryFetchBatch(batch_size - static_cast<uint32_t>(batch.size()),
+                              &batch) > 0 &&
+            window_start_ns == 0) {
+          window_start_ns = static_cast<uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now().time_since_epoch())
+                  .count());
+        }
+        if (!batch.empty()) {
+          auto now_ns = static_cast<uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now().time_since_epoch())
+                  .count());
+          if (batch.size() >= batch_size || window_ns == 0 ||
+              now_ns - window_start_ns >= window_ns) {
+            f(batch);
+            batch.clear();
+            window_start_ns = 0;
+            CRoutine::Yield(RoutineState::READY);
+            continue;
+          }
+        }
+        CRoutine::Yield();
+      }
+    };
+  };
+  return factory;
+}
+
+// The visitor's fusion policy is part of its type (see DataVisitor's
+// FusionT parameter), so the multi-message factories deduce it here.
+template <typename M0, typename M1, template <typename...> class FusionT,
+          typename F>
 RoutineFactory CreateRoutineFactory(
-    F&& f, const std::shared_ptr<data::DataVisitor<M0, M1>>& dv) {
+    F&& f,
+    const std::shared_ptr<
+        data::DataVisitor<M0, M1, NullType, NullType, FusionT>>& dv) {
   RoutineFactory factory;
   factory.SetDataVisitor(dv);
   factory.create_routine = [=]() {
@@ -92,9 +147,12 @@ RoutineFactory CreateRoutineFactory(
   return factory;
 }
 
-template <typename M0, typename M1, typename M2, typename F>
+template <typename M0, typename M1, typename M2,
+          template <typename...> class FusionT, typename F>
 RoutineFactory CreateRoutineFactory(
-    F&& f, const std::shared_ptr<data::DataVisitor<M0, M1, M2>>& dv) {
+    F&& f,
+    const std::shared_ptr<
+        data::DataVisitor<M0, M1, M2, NullType, FusionT>>& dv) {
   RoutineFactory factory;
   factory.SetDataVisitor(dv);
   factory.create_routine = [=]() {
@@ -116,9 +174,11 @@ RoutineFactory CreateRoutineFactory(
   return factory;
 }
 
-template <typename M0, typename M1, typename M2, typename M3, typename F>
+template <typename M0, typename M1, typename M2, typename M3,
+          template <typename...> class FusionT, typename F>
 RoutineFactory CreateRoutineFactory(
-    F&& f, const std::shared_ptr<data::DataVisitor<M0, M1, M2, M3>>& dv) {
+    F&& f,
+    const std::shared_ptr<data::DataVisitor<M0, M1, M2, M3, FusionT>>& dv) {
   RoutineFactory factory;
   factory.SetDataVisitor(dv);
   factory.create_routine = [=]() {
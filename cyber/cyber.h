@@ -22,6 +22,7 @@
 #include <utility>
 
 #include "cyber/common/log.h"
+#include "cyber/component/batch_component.h"
 #include "cyber/component/component.h"
 #include "cyber/init.h"
 #include "cyber/node/node.h"
@@ -17,6 +17,9 @@
 #ifndef CYBER_DATA_CACHE_BUFFER_H_
 #define CYBER_DATA_CACHE_BUFFER_H_
 
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -33,38 +36,111 @@ class CacheBuffer {
   explicit CacheBuffer(uint32_t size) {
     capacity_ = size + 1;
     buffer_.resize(capacity_);
+    fill_time_.resize(capacity_, 0);
+    version_.reset(new std::atomic<uint64_t>[capacity_]);
+    for (uint64_t i = 0; i < capacity_; ++i) {
+      version_[i].store(0, std::memory_order_relaxed);
+    }
   }
 
   CacheBuffer(const CacheBuffer& rhs) {
     std::lock_guard<std::mutex> lg(rhs.mutex_);
-    head_ = rhs.head_;
-    tail_ = rhs.tail_;
+    head_ = rhs.head_.load(std::memory_order_relaxed);
+    tail_ = rhs.tail_.load(std::memory_order_relaxed);
     buffer_ = rhs.buffer_;
+    fill_time_ = rhs.fill_time_;
     capacity_ = rhs.capacity_;
+    version_.reset(new std::atomic<uint64_t>[capacity_]);
+    for (uint64_t i = 0; i < capacity_; ++i) {
+      version_[i].store(rhs.version_[i].load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+    }
   }
 
   T& operator[](const uint64_t& pos) { return buffer_[GetIndex(pos)]; }
   const T& at(const uint64_t& pos) const { return buffer_[GetIndex(pos)]; }
 
-  uint64_t Head() const { return head_ + 1; }
-  uint64_t Tail() const { return tail_; }
-  uint64_t Size() const { return tail_ - head_; }
+  uint64_t Head() const {
+    return head_.load(std::memory_order_acquire) + 1;
+  }
+  uint64_t Tail() const { return tail_.load(std::memory_order_acquire); }
+  uint64_t Size() const { return Tail() - Head() + 1; }
 
-  const T& Front() const { return buffer_[GetIndex(head_ + 1)]; }
-  const T& Back() const { return buffer_[GetIndex(tail_)]; }
+  const T& Front() const { return buffer_[GetIndex(Head())]; }
+  const T& Back() const { return buffer_[GetIndex(Tail())]; }
 
-  bool Empty() const { return tail_ == 0; }
-  bool Full() const { return capacity_ - 1 == tail_ - head_; }
+  bool Empty() const { return Tail() == 0; }
+  bool Full() const { return capacity_ - 1 == Tail() - Head() + 1; }
 
   void Fill(const T& value) {
-    if (Full()) {
-      buffer_[GetIndex(head_)] = value;
-      ++head_;
-      ++tail_;
-    } else {
-      buffer_[GetIndex(tail_ + 1)] = value;
-      ++tail_;
+    auto now = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+    auto head = head_.load(std::memory_order_relaxed);
+    auto tail = tail_.load(std::memory_order_relaxed);
+    bool full = capacity_ - 1 == tail - head;
+    auto index = GetIndex(full ? head : tail + 1);
+    // odd version marks the slot as being written; lock-free readers that
+    // observe it retry instead of handing out a torn copy
+    version_[index].fetch_add(1, std::memory_order_acq_rel);
+    if (full) {
+      // evict the slot before overwriting so ReadAt treats it as gone
+      head_.store(head + 1, std::memory_order_release);
+    }
+    StoreSlot(&buffer_[index], value);
+    fill_time_[index] = now;
+    version_[index].fetch_add(1, std::memory_order_release);
+    tail_.store(tail + 1, std::memory_order_release);
+  }
+
+  // seqlock read of the element at pos without taking the mutex; fails if
+  // pos has been evicted or not yet filled
+  bool ReadAt(const uint64_t& pos, T* value) const {
+    if (pos < Head() || pos > Tail()) {
+      return false;
+    }
+    auto index = GetIndex(pos);
+    for (;;) {
+      auto v1 = version_[index].load(std::memory_order_acquire);
+      if (v1 & 1) {
+        continue;
+      }
+      LoadSlot(&buffer_[index], value);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (v1 == version_[index].load(std::memory_order_relaxed)) {
+        break;
+      }
     }
+    // the slot may have been recycled for a newer pos while copying
+    return pos >= Head();
+  }
+
+  // copies every element filled after *cursor and advances the cursor to
+  // the tail; readers track their own cursor so they never block the writer
+  bool ReadLatestBatch(uint64_t* cursor, std::vector<T>* vec) const {
+    auto tail = Tail();
+    if (tail == 0 || *cursor >= tail) {
+      return false;
+    }
+    auto begin = *cursor + 1;
+    auto head = Head();
+    if (begin < head) {
+      begin = head;
+    }
+    for (auto pos = begin; pos <= tail; ++pos) {
+      T value;
+      if (ReadAt(pos, &value)) {
+        vec->emplace_back(std::move(value));
+      }
+    }
+    *cursor = tail;
+    return !vec->empty();
+  }
+
+  // steady-clock time (ns) at which the element at pos was filled
+  uint64_t FillTimeAt(const uint64_t& pos) const {
+    return fill_time_[GetIndex(pos)];
   }
 
   std::mutex& Mutex() { return mutex_; }
@@ -73,10 +149,39 @@ class CacheBuffer {
   CacheBuffer& operator=(const CacheBuffer& other) = delete;
   uint64_t GetIndex(const uint64_t& pos) const { return pos % capacity_; }
 
-  uint64_t head_ = 0;
-  uint64_t tail_ = 0;
+  // Slot handoff between Fill and the lock-free ReadAt. The seqlock only
+  // tolerates torn copies, which is enough for trivially copyable slots but
+  // not for std::shared_ptr: a plain copy-assignment racing the writer's
+  // assignment can bump the refcount of a control block the writer just
+  // released, and the version re-check cannot undo that use-after-free. The
+  // shared_ptr overloads hand the slot over through the atomic free
+  // functions so the control-block pointer and refcount move as one.
+  template <typename U>
+  static void StoreSlot(U* slot, const U& value) {
+    *slot = value;
+  }
+  template <typename U>
+  static void StoreSlot(std::shared_ptr<U>* slot,
+                        const std::shared_ptr<U>& value) {
+    std::atomic_store_explicit(slot, value, std::memory_order_release);
+  }
+  template <typename U>
+  static void LoadSlot(const U* slot, U* value) {
+    *value = *slot;
+  }
+  template <typename U>
+  static void LoadSlot(const std::shared_ptr<U>* slot,
+                       std::shared_ptr<U>* value) {
+    *value = std::atomic_load_explicit(slot, std::memory_order_acquire);
+  }
+
+  std::atomic<uint64_t> head_ = {0};
+  std::atomic<uint64_t> tail_ = {0};
   uint64_t capacity_ = 0;
   std::vector<T> buffer_;
+  std::vector<uint64_t> fill_time_;
+  // per-slot seqlock versions: odd while the writer is inside the slot
+  std::unique_ptr<std::atomic<uint64_t>[]> version_;
   mutable std::mutex mutex_;
 };
 
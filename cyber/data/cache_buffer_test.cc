@@ -17,9 +17,11 @@
 #include "cyber/data/cache_buffer.h"
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <utility>
+#include <vector>
 
 namespace apollo {
 namespace cyber {
@@ -52,6 +54,61 @@ TEST(CacheBufferTest, cache_buffer_test) {
   EXPECT_TRUE(buffer1.Full());
 }
 
+
+TEST(CacheBufferTest, read_latest_batch) {
+  CacheBuffer<int> buffer(8);
+  uint64_t cursor = 0;
+  std::vector<int> batch;
+  EXPECT_FALSE(buffer.ReadLatestBatch(&cursor, &batch));
+
+  for (int i = 0; i < 4; i++) {
+    buffer.Fill(std::move(i));
+  }
+  EXPECT_TRUE(buffer.ReadLatestBatch(&cursor, &batch));
+  EXPECT_EQ(4, batch.size());
+  EXPECT_EQ(0, batch.front());
+  EXPECT_EQ(3, batch.back());
+  EXPECT_EQ(buffer.Tail(), cursor);
+  EXPECT_FALSE(buffer.ReadLatestBatch(&cursor, &batch));
+
+  // overflow the ring; only the surviving elements are returned
+  for (int i = 4; i < 20; i++) {
+    buffer.Fill(std::move(i));
+  }
+  batch.clear();
+  EXPECT_TRUE(buffer.ReadLatestBatch(&cursor, &batch));
+  EXPECT_EQ(buffer.Size(), batch.size());
+  EXPECT_EQ(19, batch.back());
+
+  int value = 0;
+  EXPECT_TRUE(buffer.ReadAt(buffer.Tail(), &value));
+  EXPECT_EQ(19, value);
+  EXPECT_FALSE(buffer.ReadAt(1, &value));
+  EXPECT_FALSE(buffer.ReadAt(buffer.Tail() + 1, &value));
+}
+
+TEST(CacheBufferTest, concurrent_reader) {
+  CacheBuffer<int> buffer(16);
+  std::atomic<bool> stop(false);
+  std::thread reader([&]() {
+    uint64_t cursor = 0;
+    while (!stop.load()) {
+      std::vector<int> batch;
+      if (buffer.ReadLatestBatch(&cursor, &batch)) {
+        // batches are copied in fill order and never torn
+        for (std::size_t i = 1; i < batch.size(); i++) {
+          EXPECT_LT(batch[i - 1], batch[i]);
+        }
+      }
+    }
+  });
+  for (int i = 0; i < 100000; i++) {
+    buffer.Fill(std::move(i));
+  }
+  stop.store(true);
+  reader.join();
+}
+
 }  // namespace data
 }  // namespace cyber
 }  // namespace apollo
@@ -18,6 +18,7 @@
 #define CYBER_DATA_CHANNEL_BUFFER_H_
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -37,8 +38,11 @@ template <typename T>
 class ChannelBuffer {
  public:
   using BufferType = CacheBuffer<std::shared_ptr<T>>;
-  ChannelBuffer(uint64_t channel_id, BufferType* buffer)
-      : channel_id_(channel_id), buffer_(buffer) {}
+  ChannelBuffer(uint64_t channel_id, BufferType* buffer,
+                uint64_t latency_budget_ns = 0)
+      : channel_id_(channel_id),
+        buffer_(buffer),
+        latency_budget_ns_(latency_budget_ns) {}
 
   bool Fetch(uint64_t* index, std::shared_ptr<T>& m);  // NOLINT
 
@@ -46,12 +50,26 @@ class ChannelBuffer {
 
   bool FetchMulti(uint64_t fetch_size, std::vector<std::shared_ptr<T>>* vec);
 
+  // lock-free variant of FetchMulti: copies every message filled after
+  // *index and advances the per-reader cursor, never blocking the writer
+  bool ReadLatestBatch(uint64_t* index, std::vector<std::shared_ptr<T>>* vec);
+
+  // steady-clock fill time (ns) of the element at index, 0 if evicted
+  uint64_t FillTime(uint64_t index);
+
+  // fetch the element whose fill time is closest to stamp_ns; fails when
+  // the buffer is empty or the closest candidate is further than max_skew_ns
+  bool FetchClosest(uint64_t stamp_ns, uint64_t max_skew_ns,
+                    std::shared_ptr<T>& m);  // NOLINT
+
   uint64_t channel_id() const { return channel_id_; }
   std::shared_ptr<BufferType> Buffer() const { return buffer_; }
 
  private:
   uint64_t channel_id_;
   std::shared_ptr<BufferType> buffer_;
+  // see QosProfile.latency_budget_ms; 0 keeps every sample
+  uint64_t latency_budget_ns_ = 0;
 };
 
 template <typename T>
@@ -73,6 +91,21 @@ bool ChannelBuffer<T>::Fetch(uint64_t* index,
           << *index << "] current_index[" << buffer_->Tail() << "] ";
     *index = buffer_->Tail();
   }
+
+  if (latency_budget_ns_ > 0 && *index != buffer_->Tail()) {
+    // the reader is behind; if the next queued sample has already
+    // out-lived the latency budget, only the newest one still matters
+    auto now = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+    if (now - buffer_->FillTimeAt(*index) > latency_budget_ns_) {
+      ADEBUG << "channel[" << GlobalData::GetChannelById(channel_id_) << "] "
+             << "latency budget exceeded, skip from index[" << *index
+             << "] to newest[" << buffer_->Tail() << "]";
+      *index = buffer_->Tail();
+    }
+  }
   m = buffer_->at(*index);
   return true;
 }
@@ -88,6 +121,65 @@ bool ChannelBuffer<T>::Latest(std::shared_ptr<T>& m) {  // NOLINT
   return true;
 }
 
+template <typename T>
+bool ChannelBuffer<T>::ReadLatestBatch(uint64_t* index,
+                                       std::vector<std::shared_ptr<T>>* vec) {
+  return buffer_->ReadLatestBatch(index, vec);
+}
+
+template <typename T>
+uint64_t ChannelBuffer<T>::FillTime(uint64_t index) {
+  std::lock_guard<std::mutex> lock(buffer_->Mutex());
+  if (buffer_->Empty() || index < buffer_->Head() ||
+      index > buffer_->Tail()) {
+    return 0;
+  }
+  return buffer_->FillTimeAt(index);
+}
+
+template <typename T>
+bool ChannelBuffer<T>::FetchClosest(uint64_t stamp_ns, uint64_t max_skew_ns,
+                                    std::shared_ptr<T>& m) {  // NOLINT
+  std::lock_guard<std::mutex> lock(buffer_->Mutex());
+  if (buffer_->Empty()) {
+    return false;
+  }
+
+  // fill times are taken from a steady clock under the buffer mutex, so
+  // they grow monotonically with the index and admit a binary search
+  auto lo = buffer_->Head();
+  auto hi = buffer_->Tail();
+  while (lo < hi) {
+    auto mid = lo + (hi - lo) / 2;
+    if (buffer_->FillTimeAt(mid) < stamp_ns) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  auto best = lo;
+  auto best_skew = buffer_->FillTimeAt(lo) > stamp_ns
+                       ? buffer_->FillTimeAt(lo) - stamp_ns
+                       : stamp_ns - buffer_->FillTimeAt(lo);
+  if (lo > buffer_->Head()) {
+    auto prev_skew = stamp_ns - buffer_->FillTimeAt(lo - 1);
+    if (prev_skew < best_skew) {
+      best = lo - 1;
+      best_skew = prev_skew;
+    }
+  }
+
+  if (best_skew > max_skew_ns) {
+    ADEBUG << "channel[" << GlobalData::GetChannelById(channel_id_) << "] "
+           << "no sample within skew bound, closest[" << best_skew
+           << "ns] bound[" << max_skew_ns << "ns]";
+    return false;
+  }
+  m = buffer_->at(best);
+  return true;
+}
+
 template <typename T>
 bool ChannelBuffer<T>::FetchMulti(uint64_t fetch_size,
                                   std::vector<std::shared_ptr<T>>* vec) {
@@ -23,11 +23,12 @@
 #include <vector>
 
 #include "cyber/common/log.h"
+#include "cyber/common/process_metrics.h"
 #include "cyber/data/channel_buffer.h"
 #include "cyber/data/data_dispatcher.h"
 #include "cyber/data/data_visitor_base.h"
 #include "cyber/data/fusion/all_latest.h"
-#include "cyber/data/fusion/data_fusion.h"
+#include "cyber/data/fusion/time_aligned.h"
 
 namespace apollo {
 namespace cyber {
@@ -36,15 +37,25 @@ namespace data {
 struct VisitorConfig {
   VisitorConfig(uint64_t id, uint32_t size)
       : channel_id(id), queue_size(size) {}
+  VisitorConfig(uint64_t id, uint32_t size, uint32_t budget_ms)
+      : channel_id(id), queue_size(size), latency_budget_ms(budget_ms) {}
   uint64_t channel_id;
   uint32_t queue_size;
+  // see QosProfile.latency_budget_ms; 0 keeps every sample
+  uint32_t latency_budget_ms = 0;
 };
 
 template <typename T>
 using BufferType = CacheBuffer<std::shared_ptr<T>>;
 
+// The fusion policy is a template parameter resolved where the visitor is
+// instantiated (the component signature is known statically in
+// Component::Initialize), so TryFetch runs without virtual dispatch. The
+// default policy is fusion::AllLatest; naming fusion::TimeAligned instead
+// selects the constructor taking the skew bound.
 template <typename M0, typename M1 = NullType, typename M2 = NullType,
-          typename M3 = NullType>
+          typename M3 = NullType,
+          template <typename...> class FusionT = fusion::AllLatest>
 class DataVisitor : public DataVisitorBase {
  public:
   explicit DataVisitor(const std::vector<VisitorConfig>& configs)
@@ -55,26 +66,40 @@ class DataVisitor : public DataVisitorBase {
         buffer_m2_(configs[2].channel_id,
                    new BufferType<M2>(configs[2].queue_size)),
         buffer_m3_(configs[3].channel_id,
-                   new BufferType<M3>(configs[3].queue_size)) {
+                   new BufferType<M3>(configs[3].queue_size)),
+        data_fusion_(buffer_m0_, buffer_m1_, buffer_m2_, buffer_m3_) {
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
     DataDispatcher<M3>::Instance()->AddBuffer(buffer_m3_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
-    data_fusion_ = new fusion::AllLatest<M0, M1, M2, M3>(
-        buffer_m0_, buffer_m1_, buffer_m2_, buffer_m3_);
   }
 
-  ~DataVisitor() {
-    if (data_fusion_) {
-      delete data_fusion_;
-      data_fusion_ = nullptr;
-    }
+  // time-aligned fusion: tuples are emitted only when every channel has a
+  // sample within max_align_skew_ns of the primary message; only
+  // instantiable with FusionT = fusion::TimeAligned
+  DataVisitor(const std::vector<VisitorConfig>& configs,
+              uint64_t max_align_skew_ns)
+      : buffer_m0_(configs[0].channel_id,
+                   new BufferType<M0>(configs[0].queue_size)),
+        buffer_m1_(configs[1].channel_id,
+                   new BufferType<M1>(configs[1].queue_size)),
+        buffer_m2_(configs[2].channel_id,
+                   new BufferType<M2>(configs[2].queue_size)),
+        buffer_m3_(configs[3].channel_id,
+                   new BufferType<M3>(configs[3].queue_size)),
+        data_fusion_(buffer_m0_, buffer_m1_, buffer_m2_, buffer_m3_,
+                     max_align_skew_ns) {
+    DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
+    DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
+    DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
+    DataDispatcher<M3>::Instance()->AddBuffer(buffer_m3_);
+    data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
   }
 
   bool TryFetch(std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1,    // NOLINT
                 std::shared_ptr<M2>& m2, std::shared_ptr<M3>& m3) {  // NOLINT
-    if (data_fusion_->Fusion(&next_msg_index_, m0, m1, m2, m3)) {
+    if (data_fusion_.Fusion(&next_msg_index_, m0, m1, m2, m3)) {
       next_msg_index_++;
       return true;
     }
@@ -82,15 +107,16 @@ class DataVisitor : public DataVisitorBase {
   }
 
  private:
-  fusion::DataFusion<M0, M1, M2, M3>* data_fusion_ = nullptr;
   ChannelBuffer<M0> buffer_m0_;
   ChannelBuffer<M1> buffer_m1_;
   ChannelBuffer<M2> buffer_m2_;
   ChannelBuffer<M3> buffer_m3_;
+  FusionT<M0, M1, M2, M3> data_fusion_;
 };
 
-template <typename M0, typename M1, typename M2>
-class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
+template <typename M0, typename M1, typename M2,
+          template <typename...> class FusionT>
+class DataVisitor<M0, M1, M2, NullType, FusionT> : public DataVisitorBase {
  public:
   explicit DataVisitor(const std::vector<VisitorConfig>& configs)
       : buffer_m0_(configs[0].channel_id,
@@ -98,25 +124,32 @@ class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
         buffer_m1_(configs[1].channel_id,
                    new BufferType<M1>(configs[1].queue_size)),
         buffer_m2_(configs[2].channel_id,
-                   new BufferType<M2>(configs[2].queue_size)) {
+                   new BufferType<M2>(configs[2].queue_size)),
+        data_fusion_(buffer_m0_, buffer_m1_, buffer_m2_) {
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
-    data_fusion_ =
-        new fusion::AllLatest<M0, M1, M2>(buffer_m0_, buffer_m1_, buffer_m2_);
   }
 
-  ~DataVisitor() {
-    if (data_fusion_) {
-      delete data_fusion_;
-      data_fusion_ = nullptr;
-    }
+  DataVisitor(const std::vector<VisitorConfig>& configs,
+              uint64_t max_align_skew_ns)
+      : buffer_m0_(configs[0].channel_id,
+                   new BufferType<M0>(configs[0].queue_size)),
+        buffer_m1_(configs[1].channel_id,
+                   new BufferType<M1>(configs[1].queue_size)),
+        buffer_m2_(configs[2].channel_id,
+                   new BufferType<M2>(configs[2].queue_size)),
+        data_fusion_(buffer_m0_, buffer_m1_, buffer_m2_, max_align_skew_ns) {
+    DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
+    DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
+    DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
+    data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
   }
 
   bool TryFetch(std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1,  // NOLINT
                 std::shared_ptr<M2>& m2) {                         // NOLINT
-    if (data_fusion_->Fusion(&next_msg_index_, m0, m1, m2)) {
+    if (data_fusion_.Fusion(&next_msg_index_, m0, m1, m2)) {
       next_msg_index_++;
       return true;
     }
@@ -124,35 +157,41 @@ class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
   }
 
  private:
-  fusion::DataFusion<M0, M1, M2>* data_fusion_ = nullptr;
   ChannelBuffer<M0> buffer_m0_;
   ChannelBuffer<M1> buffer_m1_;
   ChannelBuffer<M2> buffer_m2_;
+  FusionT<M0, M1, M2> data_fusion_;
 };
 
-template <typename M0, typename M1>
-class DataVisitor<M0, M1, NullType, NullType> : public DataVisitorBase {
+template <typename M0, typename M1, template <typename...> class FusionT>
+class DataVisitor<M0, M1, NullType, NullType, FusionT>
+    : public DataVisitorBase {
  public:
   explicit DataVisitor(const std::vector<VisitorConfig>& configs)
       : buffer_m0_(configs[0].channel_id,
                    new BufferType<M0>(configs[0].queue_size)),
         buffer_m1_(configs[1].channel_id,
-                   new BufferType<M1>(configs[1].queue_size)) {
+                   new BufferType<M1>(configs[1].queue_size)),
+        data_fusion_(buffer_m0_, buffer_m1_) {
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
-    data_fusion_ = new fusion::AllLatest<M0, M1>(buffer_m0_, buffer_m1_);
   }
 
-  ~DataVisitor() {
-    if (data_fusion_) {
-      delete data_fusion_;
-      data_fusion_ = nullptr;
-    }
+  DataVisitor(const std::vector<VisitorConfig>& configs,
+              uint64_t max_align_skew_ns)
+      : buffer_m0_(configs[0].channel_id,
+                   new BufferType<M0>(configs[0].queue_size)),
+        buffer_m1_(configs[1].channel_id,
+                   new BufferType<M1>(configs[1].queue_size)),
+        data_fusion_(buffer_m0_, buffer_m1_, max_align_skew_ns) {
+    DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
+    DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
+    data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
   }
 
   bool TryFetch(std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1) {  // NOLINT
-    if (data_fusion_->Fusion(&next_msg_index_, m0, m1)) {
+    if (data_fusion_.Fusion(&next_msg_index_, m0, m1)) {
       next_msg_index_++;
       return true;
     }
@@ -160,22 +199,26 @@ class DataVisitor<M0, M1, NullType, NullType> : public DataVisitorBase {
   }
 
  private:
-  fusion::DataFusion<M0, M1>* data_fusion_ = nullptr;
   ChannelBuffer<M0> buffer_m0_;
   ChannelBuffer<M1> buffer_m1_;
+  FusionT<M0, M1> data_fusion_;
 };
 
-template <typename M0>
-class DataVisitor<M0, NullType, NullType, NullType> : public DataVisitorBase {
+template <typename M0, template <typename...> class FusionT>
+class DataVisitor<M0, NullType, NullType, NullType, FusionT>
+    : public DataVisitorBase {
  public:
   explicit DataVisitor(const VisitorConfig& configs)
-      : buffer_(configs.channel_id, new BufferType<M0>(configs.queue_size)) {
+      : buffer_(configs.channel_id, new BufferType<M0>(configs.queue_size),
+                configs.latency_budget_ms * 1000000ULL) {
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_);
     data_notifier_->AddNotifier(buffer_.channel_id(), notifier_);
   }
 
-  DataVisitor(uint64_t channel_id, uint32_t queue_size)
-      : buffer_(channel_id, new BufferType<M0>(queue_size)) {
+  DataVisitor(uint64_t channel_id, uint32_t queue_size,
+              uint32_t latency_budget_ms = 0)
+      : buffer_(channel_id, new BufferType<M0>(queue_size),
+                latency_budget_ms * 1000000ULL) {
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_);
     data_notifier_->AddNotifier(buffer_.channel_id(), notifier_);
   }
@@ -183,11 +226,30 @@ class DataVisitor<M0, NullType, NullType, NullType> : public DataVisitorBase {
   bool TryFetch(std::shared_ptr<M0>& m0) {  // NOLINT
     if (buffer_.Fetch(&next_msg_index_, m0)) {
       next_msg_index_++;
+      // report the backlog still pending behind this reader so the
+      // monitor can see queue buildup before messages get dropped
+      const uint64_t tail = buffer_.Buffer()->Tail();
+      common::ProcessMetrics::Instance()->ReportQueueDepth(
+          tail >= next_msg_index_ ? tail - next_msg_index_ + 1 : 0);
       return true;
     }
     return false;
   }
 
+  // Append up to max_count pending messages to vec, advancing the reader
+  // cursor. Returns the number appended; used by the micro-batched
+  // component path.
+  uint32_t TryFetchBatch(uint32_t max_count,
+                         std::vector<std::shared_ptr<M0>>* vec) {
+    uint32_t count = 0;
+    std::shared_ptr<M0> m0;
+    while (count < max_count && TryFetch(m0)) {
+      vec->emplace_back(std::move(m0));
+      ++count;
+    }
+    return count;
+  }
+
  private:
   ChannelBuffer<M0> buffer_;
 };
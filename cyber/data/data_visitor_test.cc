@@ -87,6 +87,22 @@ TEST(DataVisitorTest, two_channel) {
   EXPECT_FALSE(dv->TryFetch(msg0, msg1));
 }
 
+TEST(DataVisitorTest, two_channel_time_aligned) {
+  // the fusion policy is part of the visitor type; a generous skew bound
+  // keeps messages dispatched back-to-back within range
+  auto dv = std::make_shared<DataVisitor<RawMessage, RawMessage, NullType,
+                                         NullType, fusion::TimeAligned>>(
+      InitConfigs(2), 1000000000ULL);
+
+  DispatchMessage(channel0, 1);
+  std::shared_ptr<RawMessage> msg0;
+  std::shared_ptr<RawMessage> msg1;
+  EXPECT_FALSE(dv->TryFetch(msg0, msg1));
+  DispatchMessage(channel1, 1);
+  EXPECT_TRUE(dv->TryFetch(msg0, msg1));
+  EXPECT_FALSE(dv->TryFetch(msg0, msg1));
+}
+
 TEST(DataVisitorTest, three_channel) {
   auto dv = std::make_shared<DataVisitor<RawMessage, RawMessage, RawMessage>>(
       InitConfigs(3));
@@ -26,16 +26,18 @@
 
 #include "cyber/common/types.h"
 #include "cyber/data/channel_buffer.h"
-#include "cyber/data/fusion/data_fusion.h"
 
 namespace apollo {
 namespace cyber {
 namespace data {
 namespace fusion {
 
+// Fusion policies are selected at compile time by DataVisitor's FusionT
+// template parameter; Fusion() is called directly on the concrete policy,
+// so there is no virtual interface to implement.
 template <typename M0, typename M1 = NullType, typename M2 = NullType,
           typename M3 = NullType>
-class AllLatest : public DataFusion<M0, M1, M2, M3> {
+class AllLatest {
  public:
   AllLatest(const ChannelBuffer<M0>& buffer_0,
             const ChannelBuffer<M1>& buffer_1,
@@ -45,8 +47,9 @@ class AllLatest : public DataFusion<M0, M1, M2, M3> {
         buffer_m1_(buffer_1),
         buffer_m2_(buffer_2),
         buffer_m3_(buffer_3) {}
-  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1,
-              std::shared_ptr<M2>& m2, std::shared_ptr<M3>& m3) override {
+  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0,    // NOLINT
+              std::shared_ptr<M1>& m1, std::shared_ptr<M2>& m2,  // NOLINT
+              std::shared_ptr<M3>& m3) {                         // NOLINT
     return buffer_m0_.Fetch(index, m0) && buffer_m1_.Latest(m1) &&
            buffer_m2_.Latest(m2) && buffer_m3_.Latest(m3);
   }
@@ -59,15 +62,15 @@ class AllLatest : public DataFusion<M0, M1, M2, M3> {
 };
 
 template <typename M0, typename M1, typename M2>
-class AllLatest<M0, M1, M2, NullType> : public DataFusion<M0, M1, M2> {
+class AllLatest<M0, M1, M2, NullType> {
  public:
   AllLatest(const ChannelBuffer<M0>& buffer_0,
             const ChannelBuffer<M1>& buffer_1,
             const ChannelBuffer<M2>& buffer_2)
       : buffer_m0_(buffer_0), buffer_m1_(buffer_1), buffer_m2_(buffer_2) {}
 
-  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1,
-              std::shared_ptr<M2>& m2) override {
+  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0,         // NOLINT
+              std::shared_ptr<M1>& m1, std::shared_ptr<M2>& m2) {  // NOLINT
     return buffer_m0_.Fetch(index, m0) && buffer_m1_.Latest(m1) &&
            buffer_m2_.Latest(m2);
   }
@@ -79,14 +82,14 @@ class AllLatest<M0, M1, M2, NullType> : public DataFusion<M0, M1, M2> {
 };
 
 template <typename M0, typename M1>
-class AllLatest<M0, M1, NullType, NullType> : public DataFusion<M0, M1> {
+class AllLatest<M0, M1, NullType, NullType> {
  public:
   AllLatest(const ChannelBuffer<M0>& buffer_0,
             const ChannelBuffer<M1>& buffer_1)
       : buffer_m0_(buffer_0), buffer_m1_(buffer_1) {}
 
-  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0,
-              std::shared_ptr<M1>& m1) override {
+  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0,  // NOLINT
+              std::shared_ptr<M1>& m1) {                 // NOLINT
     return buffer_m0_.Fetch(index, m0) && buffer_m1_.Latest(m1);
   }
 
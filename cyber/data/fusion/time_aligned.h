@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_DATA_FUSION_TIME_ALIGNED_H_
+#define CYBER_DATA_FUSION_TIME_ALIGNED_H_
+
+#include <memory>
+
+#include "cyber/common/types.h"
+#include "cyber/data/channel_buffer.h"
+
+namespace apollo {
+namespace cyber {
+namespace data {
+namespace fusion {
+
+// Unlike AllLatest, which pairs every new primary-channel message with
+// whatever happens to sit at the tail of the secondary channels, this policy
+// binary-searches each secondary channel history for the sample whose arrival
+// time is closest to the primary message and only emits a tuple when every
+// channel has a sample within max_skew_ns.
+template <typename M0, typename M1 = NullType, typename M2 = NullType,
+          typename M3 = NullType>
+class TimeAligned {
+ public:
+  TimeAligned(const ChannelBuffer<M0>& buffer_0,
+              const ChannelBuffer<M1>& buffer_1,
+              const ChannelBuffer<M2>& buffer_2,
+              const ChannelBuffer<M3>& buffer_3, uint64_t max_skew_ns)
+      : buffer_m0_(buffer_0),
+        buffer_m1_(buffer_1),
+        buffer_m2_(buffer_2),
+        buffer_m3_(buffer_3),
+        max_skew_ns_(max_skew_ns) {}
+
+  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0,         // NOLINT
+              std::shared_ptr<M1>& m1, std::shared_ptr<M2>& m2,  // NOLINT
+              std::shared_ptr<M3>& m3) {                         // NOLINT
+    if (!buffer_m0_.Fetch(index, m0)) {
+      return false;
+    }
+    auto stamp_ns = buffer_m0_.FillTime(*index);
+    return buffer_m1_.FetchClosest(stamp_ns, max_skew_ns_, m1) &&
+           buffer_m2_.FetchClosest(stamp_ns, max_skew_ns_, m2) &&
+           buffer_m3_.FetchClosest(stamp_ns, max_skew_ns_, m3);
+  }
+
+ private:
+  ChannelBuffer<M0> buffer_m0_;
+  ChannelBuffer<M1> buffer_m1_;
+  ChannelBuffer<M2> buffer_m2_;
+  ChannelBuffer<M3> buffer_m3_;
+  uint64_t max_skew_ns_;
+};
+
+template <typename M0, typename M1, typename M2>
+class TimeAligned<M0, M1, M2, NullType> {
+ public:
+  TimeAligned(const ChannelBuffer<M0>& buffer_0,
+              const ChannelBuffer<M1>& buffer_1,
+              const ChannelBuffer<M2>& buffer_2, uint64_t max_skew_ns)
+      : buffer_m0_(buffer_0),
+        buffer_m1_(buffer_1),
+        buffer_m2_(buffer_2),
+        max_skew_ns_(max_skew_ns) {}
+
+  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0,            // NOLINT
+              std::shared_ptr<M1>& m1, std::shared_ptr<M2>& m2) {  // NOLINT
+    if (!buffer_m0_.Fetch(index, m0)) {
+      return false;
+    }
+    auto stamp_ns = buffer_m0_.FillTime(*index);
+    return buffer_m1_.FetchClosest(stamp_ns, max_skew_ns_, m1) &&
+           buffer_m2_.FetchClosest(stamp_ns, max_skew_ns_, m2);
+  }
+
+ private:
+  ChannelBuffer<M0> buffer_m0_;
+  ChannelBuffer<M1> buffer_m1_;
+  ChannelBuffer<M2> buffer_m2_;
+  uint64_t max_skew_ns_;
+};
+
+template <typename M0, typename M1>
+class TimeAligned<M0, M1, NullType, NullType> {
+ public:
+  TimeAligned(const ChannelBuffer<M0>& buffer_0,
+              const ChannelBuffer<M1>& buffer_1, uint64_t max_skew_ns)
+      : buffer_m0_(buffer_0), buffer_m1_(buffer_1), max_skew_ns_(max_skew_ns) {}
+
+  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0,  // NOLINT
+              std::shared_ptr<M1>& m1) {                 // NOLINT
+    if (!buffer_m0_.Fetch(index, m0)) {
+      return false;
+    }
+    auto stamp_ns = buffer_m0_.FillTime(*index);
+    return buffer_m1_.FetchClosest(stamp_ns, max_skew_ns_, m1);
+  }
+
+ private:
+  ChannelBuffer<M0> buffer_m0_;
+  ChannelBuffer<M1> buffer_m1_;
+  uint64_t max_skew_ns_;
+};
+
+}  // namespace fusion
+}  // namespace data
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_DATA_FUSION_TIME_ALIGNED_H_
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/data/fusion/time_aligned.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "cyber/common/util.h"
+
+namespace apollo {
+namespace cyber {
+namespace data {
+namespace fusion {
+
+auto channel0 = common::Hash("/channel0");
+auto channel1 = common::Hash("/channel1");
+
+TEST(TimeAlignedTest, two_channels) {
+  auto cache0 = new CacheBuffer<std::shared_ptr<int>>(10);
+  auto cache1 = new CacheBuffer<std::shared_ptr<int>>(10);
+  ChannelBuffer<int> buffer0(channel0, cache0);
+  ChannelBuffer<int> buffer1(channel1, cache1);
+  // generous one-second bound: samples filled back to back always align
+  TimeAligned<int, int> fusion(buffer0, buffer1, 1000000000ULL);
+
+  std::shared_ptr<int> m0;
+  std::shared_ptr<int> m1;
+  uint64_t index = 0;
+  EXPECT_FALSE(fusion.Fusion(&index, m0, m1));
+
+  buffer1.Buffer()->Fill(std::make_shared<int>(10));
+  buffer0.Buffer()->Fill(std::make_shared<int>(1));
+  buffer1.Buffer()->Fill(std::make_shared<int>(11));
+  EXPECT_TRUE(fusion.Fusion(&index, m0, m1));
+  EXPECT_EQ(1, *m0);
+  index++;
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  buffer0.Buffer()->Fill(std::make_shared<int>(2));
+  buffer1.Buffer()->Fill(std::make_shared<int>(12));
+  EXPECT_TRUE(fusion.Fusion(&index, m0, m1));
+  EXPECT_EQ(2, *m0);
+  // the closest m1 sample is the one filled right after m0, not the first
+  EXPECT_EQ(12, *m1);
+}
+
+TEST(TimeAlignedTest, skew_bound) {
+  auto cache0 = new CacheBuffer<std::shared_ptr<int>>(10);
+  auto cache1 = new CacheBuffer<std::shared_ptr<int>>(10);
+  ChannelBuffer<int> buffer0(channel0, cache0);
+  ChannelBuffer<int> buffer1(channel1, cache1);
+  // 1ms bound; the secondary sample is filled 5ms before the primary
+  TimeAligned<int, int> fusion(buffer0, buffer1, 1000000ULL);
+
+  buffer1.Buffer()->Fill(std::make_shared<int>(10));
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  buffer0.Buffer()->Fill(std::make_shared<int>(1));
+
+  std::shared_ptr<int> m0;
+  std::shared_ptr<int> m1;
+  uint64_t index = 0;
+  EXPECT_FALSE(fusion.Fusion(&index, m0, m1));
+
+  // a fresh secondary sample brings the tuple back inside the bound
+  buffer1.Buffer()->Fill(std::make_shared<int>(11));
+  EXPECT_TRUE(fusion.Fusion(&index, m0, m1));
+  EXPECT_EQ(1, *m0);
+  EXPECT_EQ(11, *m1);
+}
+
+}  // namespace fusion
+}  // namespace data
+}  // namespace cyber
+}  // namespace apollo
@@ -37,6 +37,7 @@ enum class SchedPerf {
   NOTIFY_IN = 3,
   NEXT_RT = 4,
   RT_CREATE = 5,
+  TIMER_JITTER = 6,
 };
 
 class EventBase {
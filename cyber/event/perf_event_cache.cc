@@ -22,6 +22,7 @@
 #include "cyber/common/environment.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
+#include "cyber/event/sched_trace.h"
 #include "cyber/state.h"
 #include "cyber/time/time.h"
 
@@ -72,6 +73,9 @@ PerfEventCache::~PerfEventCache() {
 void PerfEventCache::AddSchedEvent(const SchedPerf event_id,
                                    const uint64_t cr_id, const int proc_id,
                                    const int cr_state) {
+  // the binary ring is always on; the text dump below stays opt-in
+  SchedTrace::Instance()->Append(event_id, cr_id, proc_id, cr_state);
+
   if (likely(!enable_sched_perf_)) {
     return;
   }
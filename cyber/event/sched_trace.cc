@@ -0,0 +1,111 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/event/sched_trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+constexpr uint32_t SchedTrace::kRingSize;
+constexpr uint32_t SchedTrace::kHistogramBuckets;
+constexpr char SchedTrace::kMagic[8];
+
+SchedTrace::SchedTrace() { std::memset(ring_, 0, sizeof(ring_)); }
+
+SchedTrace::Histogram* SchedTrace::HistogramOf(uint64_t cr_id) {
+  Histogram* histogram = nullptr;
+  if (!histograms_.Get(cr_id, &histogram)) {
+    histograms_.Set(cr_id);
+    histograms_.Get(cr_id, &histogram);
+  }
+  return histogram;
+}
+
+void SchedTrace::Append(SchedPerf event, uint64_t cr_id, int proc_id,
+                        int cr_state) {
+  uint64_t idx = cursor_.fetch_add(1, std::memory_order_relaxed);
+  Record& record = ring_[idx & (kRingSize - 1)];
+  record.tsc = ReadTsc();
+  record.cr_id = cr_id;
+  record.event = static_cast<uint16_t>(event);
+  record.proc_id = static_cast<int16_t>(proc_id);
+  record.cr_state = cr_state;
+
+  if (event == SchedPerf::SWAP_IN) {
+    HistogramOf(cr_id)->last_swap_in.store(record.tsc,
+                                           std::memory_order_relaxed);
+  } else if (event == SchedPerf::SWAP_OUT) {
+    Histogram* histogram = HistogramOf(cr_id);
+    uint64_t in = histogram->last_swap_in.load(std::memory_order_relaxed);
+    if (in != 0 && record.tsc > in) {
+      uint64_t delta = record.tsc - in;
+      uint32_t bucket = 63 - static_cast<uint32_t>(__builtin_clzll(delta | 1));
+      if (bucket >= kHistogramBuckets) {
+        bucket = kHistogramBuckets - 1;
+      }
+      histogram->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+bool SchedTrace::DumpToFile(const std::string& file_name) {
+  std::ofstream of(file_name, std::ios::binary | std::ios::trunc);
+  if (!of.is_open()) {
+    AERROR << "Open sched trace dump file [" << file_name << "] failed.";
+    return false;
+  }
+
+  uint64_t cursor = cursor_.load(std::memory_order_acquire);
+  uint64_t count = std::min<uint64_t>(cursor, kRingSize);
+
+  DumpHeader header;
+  std::memcpy(header.magic, kMagic, sizeof(header.magic));
+  header.version = 1;
+  header.record_size = sizeof(Record);
+  header.count = count;
+  of.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  for (uint64_t i = cursor - count; i < cursor; ++i) {
+    of.write(reinterpret_cast<const char*>(&ring_[i & (kRingSize - 1)]),
+             sizeof(Record));
+  }
+  of.close();
+  AINFO << "Dumped " << count << " sched trace records to " << file_name;
+  return true;
+}
+
+bool SchedTrace::GetHistogram(uint64_t cr_id, std::vector<uint64_t>* buckets) {
+  Histogram* histogram = nullptr;
+  if (!histograms_.Get(cr_id, &histogram)) {
+    return false;
+  }
+  buckets->resize(kHistogramBuckets);
+  for (uint32_t i = 0; i < kHistogramBuckets; ++i) {
+    (*buckets)[i] = histogram->buckets[i].load(std::memory_order_relaxed);
+  }
+  return true;
+}
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
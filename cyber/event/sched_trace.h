@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_EVENT_SCHED_TRACE_H_
+#define CYBER_EVENT_SCHED_TRACE_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "cyber/base/atomic_hash_map.h"
+#include "cyber/common/macros.h"
+#include "cyber/event/perf_event.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+// Always-on binary ring of croutine scheduling transitions. Unlike the
+// text dump behind cyber_sched_perf, appending costs one rdtsc, one
+// relaxed fetch-add and a few stores, so it stays enabled in production
+// and the last ~64k transitions can be dumped after a stall instead of
+// reproducing it with logging on. Per-croutine run-length histograms
+// (log2 buckets of TSC ticks between SWAP_IN and SWAP_OUT) are kept
+// alongside and are queryable at runtime.
+class SchedTrace {
+ public:
+  struct Record {
+    uint64_t tsc;
+    uint64_t cr_id;
+    uint16_t event;  // SchedPerf value
+    int16_t proc_id;
+    int32_t cr_state;
+  };
+
+  struct DumpHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t count;
+  };
+
+  static constexpr uint32_t kRingSize = 1 << 16;  // must be a power of two
+  static constexpr uint32_t kHistogramBuckets = 48;
+  static constexpr char kMagic[8] = {'C', 'Y', 'B', 'S', 'C', 'H', 'D', '1'};
+
+  ~SchedTrace() = default;
+
+  void Append(SchedPerf event, uint64_t cr_id, int proc_id, int cr_state);
+
+  // writes header plus the buffered records oldest-first; records being
+  // overwritten concurrently may come out torn, which a post-mortem
+  // reader tolerates
+  bool DumpToFile(const std::string& file_name);
+
+  // run-length distribution of one croutine, log2(tsc ticks) per bucket
+  bool GetHistogram(uint64_t cr_id, std::vector<uint64_t>* buckets);
+
+ private:
+  struct Histogram {
+    std::atomic<uint64_t> last_swap_in = {0};
+    std::atomic<uint64_t> buckets[kHistogramBuckets] = {};
+  };
+
+  static uint64_t ReadTsc() {
+#if defined(__x86_64__)
+    uint32_t lo = 0;
+    uint32_t hi = 0;
+    asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+#else
+    return static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+  }
+
+  Histogram* HistogramOf(uint64_t cr_id);
+
+  Record ring_[kRingSize];
+  alignas(64) std::atomic<uint64_t> cursor_ = {0};
+  base::AtomicHashMap<uint64_t, Histogram, 1024> histograms_;
+
+  DECLARE_SINGLETON(SchedTrace)
+};
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_EVENT_SCHED_TRACE_H_
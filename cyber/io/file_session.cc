@@ -0,0 +1,197 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/io/file_session.h"
+
+#include <string.h>
+#include <sys/eventfd.h>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include "cyber/common/log.h"
+#include "cyber/croutine/croutine.h"
+#include "cyber/io/poll_handler.h"
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+namespace {
+
+constexpr uint32_t kFileUringEntries = 32;
+
+// Completion slot for one in-flight operation. Slots are owned by this
+// registry (keyed by their address as cqe user_data) so a timed-out
+// caller can return while the kernel finishes the operation; the slot
+// is released when the completion is reaped.
+struct OpSlot {
+  std::atomic<bool> done = {false};
+  int32_t res = 0;
+};
+
+std::mutex pending_mutex;
+std::unordered_map<uint64_t, std::shared_ptr<OpSlot>> pending_ops;
+
+std::shared_ptr<OpSlot> TrackOp() {
+  auto slot = std::make_shared<OpSlot>();
+  std::lock_guard<std::mutex> lock(pending_mutex);
+  pending_ops[reinterpret_cast<uint64_t>(slot.get())] = slot;
+  return slot;
+}
+
+void CompleteOp(uint64_t user_data, int32_t res) {
+  std::lock_guard<std::mutex> lock(pending_mutex);
+  auto search = pending_ops.find(user_data);
+  if (search != pending_ops.end()) {
+    search->second->res = res;
+    search->second->done.store(true);
+    pending_ops.erase(search);
+  }
+}
+
+}  // namespace
+
+FileSession::FileSession() {}
+
+FileSession::FileSession(int fd) : fd_(fd) {}
+
+FileSession::~FileSession() {
+  if (event_fd_ >= 0) {
+    close(event_fd_);
+    event_fd_ = -1;
+  }
+}
+
+int FileSession::Open(const char* pathname, int flags, mode_t mode) {
+  fd_ = open(pathname, flags, mode);
+  if (fd_ < 0) {
+    return fd_;
+  }
+
+  if (uring_ == nullptr) {
+    uring_.reset(new UringContext());
+    if (uring_->Init(kFileUringEntries)) {
+      event_fd_ = eventfd(0, EFD_NONBLOCK);
+      if (event_fd_ < 0 || !uring_->RegisterEventfd(event_fd_)) {
+        AWARN << "eventfd setup failed, file session falls back to "
+                 "synchronous IO";
+        uring_.reset();
+      }
+    } else {
+      uring_.reset();
+    }
+  }
+  return fd_;
+}
+
+int FileSession::Close() {
+  if (fd_ < 0) {
+    return -1;
+  }
+  int res = close(fd_);
+  fd_ = -1;
+  return res;
+}
+
+ssize_t FileSession::Read(void* buf, size_t count, uint64_t offset,
+                          int timeout_ms) {
+  struct iovec iov = {buf, count};
+  return DoIO(true, &iov, 1, offset, timeout_ms);
+}
+
+ssize_t FileSession::Write(const void* buf, size_t count, uint64_t offset,
+                           int timeout_ms) {
+  struct iovec iov = {const_cast<void*>(buf), count};
+  return DoIO(false, &iov, 1, offset, timeout_ms);
+}
+
+ssize_t FileSession::Readv(const struct iovec* iov, int iovcnt,
+                           uint64_t offset, int timeout_ms) {
+  return DoIO(true, iov, iovcnt, offset, timeout_ms);
+}
+
+ssize_t FileSession::Writev(const struct iovec* iov, int iovcnt,
+                            uint64_t offset, int timeout_ms) {
+  return DoIO(false, iov, iovcnt, offset, timeout_ms);
+}
+
+ssize_t FileSession::DoIO(bool is_read, const struct iovec* iov, int iovcnt,
+                          uint64_t offset, int timeout_ms) {
+  if (fd_ < 0) {
+    errno = EBADF;
+    return -1;
+  }
+
+  if (uring_ == nullptr || event_fd_ < 0 ||
+      croutine::CRoutine::GetCurrentRoutine() == nullptr) {
+    return FallbackIO(is_read, iov, iovcnt, offset);
+  }
+
+  auto slot = TrackOp();
+  auto user_data = reinterpret_cast<uint64_t>(slot.get());
+  bool prepared =
+      is_read ? uring_->PrepReadv(fd_, iov, static_cast<uint32_t>(iovcnt),
+                                  offset, user_data)
+              : uring_->PrepWritev(fd_, iov, static_cast<uint32_t>(iovcnt),
+                                   offset, user_data);
+  if (!prepared || uring_->Submit() < 0) {
+    CompleteOp(user_data, 0);
+    return FallbackIO(is_read, iov, iovcnt, offset);
+  }
+
+  while (!slot->done.load()) {
+    PollHandler handler(event_fd_);
+    if (!handler.Block(timeout_ms, true)) {
+      ReapCompletions();
+      if (slot->done.load()) {
+        break;
+      }
+      // The operation stays tracked and finishes in the background.
+      errno = ETIMEDOUT;
+      return -1;
+    }
+    ReapCompletions();
+  }
+
+  if (slot->res < 0) {
+    errno = -slot->res;
+    return -1;
+  }
+  return slot->res;
+}
+
+ssize_t FileSession::FallbackIO(bool is_read, const struct iovec* iov,
+                                int iovcnt, uint64_t offset) {
+  return is_read ? preadv(fd_, iov, iovcnt, static_cast<off_t>(offset))
+                 : pwritev(fd_, iov, iovcnt, static_cast<off_t>(offset));
+}
+
+void FileSession::ReapCompletions() {
+  uint64_t event_count = 0;
+  while (read(event_fd_, &event_count, sizeof(event_count)) > 0) {
+  }
+
+  std::vector<UringCompletion> completions;
+  uring_->Reap(&completions);
+  for (auto& completion : completions) {
+    CompleteOp(completion.user_data, completion.res);
+  }
+}
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
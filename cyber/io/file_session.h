@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_IO_FILE_SESSION_H_
+#define CYBER_IO_FILE_SESSION_H_
+
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <memory>
+
+#include "cyber/io/uring_context.h"
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+// Croutine-friendly positional file IO, the file counterpart of Session.
+// When io_uring is available each Read/Write submits the operation to a
+// per-session ring and yields the croutine until the completion raises
+// the session's eventfd (watched through the regular Poller), so the
+// processor thread keeps running other croutines while the kernel does
+// the IO. Readv/Writev submit one entry for a whole scatter list, giving
+// record readers and writers batched submission. Without io_uring, or
+// when called outside a croutine, the calls degrade to plain
+// preadv/pwritev.
+//
+// Like Session, a FileSession serves one croutine at a time.
+class FileSession {
+ public:
+  using FileSessionPtr = std::shared_ptr<FileSession>;
+
+  FileSession();
+  explicit FileSession(int fd);
+  virtual ~FileSession();
+
+  int Open(const char* pathname, int flags, mode_t mode = 0644);
+  int Close();
+
+  // timeout_ms < 0, wait until the operation completes
+  // timeout_ms > 0, give up (leaving the operation to finish in the
+  //                 background) when the time is up
+  ssize_t Read(void* buf, size_t count, uint64_t offset, int timeout_ms = -1);
+  ssize_t Write(const void* buf, size_t count, uint64_t offset,
+                int timeout_ms = -1);
+  ssize_t Readv(const struct iovec* iov, int iovcnt, uint64_t offset,
+                int timeout_ms = -1);
+  ssize_t Writev(const struct iovec* iov, int iovcnt, uint64_t offset,
+                 int timeout_ms = -1);
+
+  int fd() const { return fd_; }
+  void set_fd(int fd) { fd_ = fd; }
+
+ private:
+  ssize_t DoIO(bool is_read, const struct iovec* iov, int iovcnt,
+               uint64_t offset, int timeout_ms);
+  ssize_t FallbackIO(bool is_read, const struct iovec* iov, int iovcnt,
+                     uint64_t offset);
+  void ReapCompletions();
+
+  int fd_ = -1;
+  int event_fd_ = -1;
+  std::unique_ptr<UringContext> uring_;
+};
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_IO_FILE_SESSION_H_
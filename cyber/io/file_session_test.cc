@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/io/file_session.h"
+
+#include <gtest/gtest.h>
+#include <string.h>
+#include <string>
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+TEST(FileSessionTest, write_then_read) {
+  std::string path = "/tmp/cyber_file_session_test";
+  FileSession session;
+  ASSERT_GE(session.Open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644), 0);
+
+  const char payload[] = "file_session payload";
+  EXPECT_EQ(session.Write(payload, sizeof(payload), 0),
+            static_cast<ssize_t>(sizeof(payload)));
+
+  char buf[64] = {0};
+  EXPECT_EQ(session.Read(buf, sizeof(payload), 0),
+            static_cast<ssize_t>(sizeof(payload)));
+  EXPECT_STREQ(buf, payload);
+
+  EXPECT_EQ(session.Close(), 0);
+  remove(path.c_str());
+}
+
+TEST(FileSessionTest, vectored_io) {
+  std::string path = "/tmp/cyber_file_session_test_v";
+  FileSession session;
+  ASSERT_GE(session.Open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644), 0);
+
+  char part1[] = "head";
+  char part2[] = "tail";
+  struct iovec iov[2] = {{part1, 4}, {part2, 4}};
+  EXPECT_EQ(session.Writev(iov, 2, 0), 8);
+
+  char buf[16] = {0};
+  EXPECT_EQ(session.Read(buf, 8, 0), 8);
+  EXPECT_EQ(memcmp(buf, "headtail", 8), 0);
+
+  EXPECT_EQ(session.Close(), 0);
+  remove(path.c_str());
+}
+
+TEST(FileSessionTest, invalid_fd) {
+  FileSession session;
+  char buf[8];
+  EXPECT_EQ(session.Read(buf, sizeof(buf), 0), -1);
+  EXPECT_EQ(errno, EBADF);
+}
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
@@ -22,6 +22,7 @@
 #include <sys/epoll.h>
 #include <unistd.h>
 
+#include "cyber/common/environment.h"
 #include "cyber/common/log.h"
 #include "cyber/scheduler/scheduler_factory.h"
 #include "cyber/time/time.h"
@@ -110,10 +111,24 @@ bool Poller::Unregister(const PollRequest& req) {
 }
 
 bool Poller::Init() {
-  epoll_fd_ = epoll_create(kPollSize);
-  if (epoll_fd_ < 0) {
-    AERROR << "epoll create failed, " << strerror(errno);
-    return false;
+  auto io_uring_env = common::GetEnv("cyber_io_uring");
+  if (io_uring_env != "" && std::stoi(io_uring_env)) {
+    uring_.reset(new UringContext());
+    if (uring_->Init(kUringEntries)) {
+      use_uring_ = true;
+      AINFO << "poller uses the io_uring backend";
+    } else {
+      uring_.reset();
+      AWARN << "io_uring unavailable, poller falls back to epoll";
+    }
+  }
+
+  if (!use_uring_) {
+    epoll_fd_ = epoll_create(kPollSize);
+    if (epoll_fd_ < 0) {
+      AERROR << "epoll create failed, " << strerror(errno);
+      return false;
+    }
   }
 
   // create pipe, and set nonblock
@@ -165,6 +180,12 @@ void Poller::Clear() {
     epoll_fd_ = -1;
   }
 
+  if (uring_ != nullptr) {
+    uring_->Shutdown();
+    uring_.reset();
+    use_uring_ = false;
+  }
+
   if (pipe_fd_[0] >= 0) {
     close(pipe_fd_[0]);
     pipe_fd_[0] = -1;
@@ -224,6 +245,93 @@ void Poller::Poll(int timeout_ms) {
     }
   }
 
+  DispatchResponses(responses);
+
+  if (ready_num < 0) {
+    if (errno != EINTR) {
+      AERROR << "epoll wait failed, " << strerror(errno);
+    }
+  }
+}
+
+void Poller::PollUring(int timeout_ms) {
+  std::vector<UringCompletion> completions;
+  auto before_time_ns = Time::Now().ToNanosecond();
+  int ready_num = uring_->SubmitAndWait(timeout_ms, &completions);
+  auto after_time_ns = Time::Now().ToNanosecond();
+  int interval_ms =
+      static_cast<int>((after_time_ns - before_time_ns) / 1000000);
+  if (interval_ms == 0) {
+    interval_ms = 1;
+  }
+
+  std::unordered_map<int, PollResponse> responses;
+  {
+    ReadLockGuard<AtomicRWLock> lck(poll_data_lock_);
+    for (auto& item : requests_) {
+      auto& request = item.second;
+      if (ctrl_params_.count(request->fd) != 0) {
+        continue;
+      }
+
+      if (request->timeout_ms > 0) {
+        request->timeout_ms -= interval_ms;
+        if (request->timeout_ms < 0) {
+          request->timeout_ms = 0;
+        }
+      }
+
+      if (request->timeout_ms == 0) {
+        responses[item.first] = PollResponse();
+        request->timeout_ms = -1;
+      }
+    }
+  }
+
+  if (ready_num > 0) {
+    for (auto& completion : completions) {
+      int fd = static_cast<int>(completion.user_data);
+      if (completion.res < 0) {
+        if (completion.res != -ECANCELED) {
+          AERROR << "io_uring poll failed on fd[" << fd << "], "
+                 << strerror(-completion.res);
+        }
+        continue;
+      }
+      responses[fd] = PollResponse(static_cast<uint32_t>(completion.res));
+    }
+  }
+
+  DispatchResponses(responses);
+
+  // io_uring poll entries are one-shot; re-arm every fd that is still
+  // registered and was added as level-style (no EPOLLONESHOT).
+  bool need_submit = false;
+  {
+    ReadLockGuard<AtomicRWLock> lck(poll_data_lock_);
+    for (auto& completion : completions) {
+      if (completion.res < 0) {
+        continue;
+      }
+      int fd = static_cast<int>(completion.user_data);
+      auto search = requests_.find(fd);
+      if (search != requests_.end() &&
+          (search->second->events & EPOLLONESHOT) == 0 &&
+          ctrl_params_.count(fd) == 0) {
+        uring_->PrepPollAdd(
+            fd, search->second->events & ~(EPOLLET | EPOLLONESHOT),
+            static_cast<uint64_t>(fd));
+        need_submit = true;
+      }
+    }
+  }
+  if (need_submit) {
+    uring_->Submit();
+  }
+}
+
+void Poller::DispatchResponses(
+    const std::unordered_map<int, PollResponse>& responses) {
   for (auto& item : responses) {
     int fd = item.first;
     auto& response = item.second;
@@ -235,12 +343,6 @@ void Poller::Poll(int timeout_ms) {
       search->second->callback(response);
     }
   }
-
-  if (ready_num < 0) {
-    if (errno != EINTR) {
-      AERROR << "epoll wait failed, " << strerror(errno);
-    }
-  }
 }
 
 void Poller::ThreadFunc() {
@@ -250,11 +352,49 @@ void Poller::ThreadFunc() {
   pthread_sigmask(SIG_BLOCK, &signal_set, NULL);
 
   while (!is_shutdown_.load()) {
-    HandleChanges();
+    if (use_uring_) {
+      HandleChangesUring();
+    } else {
+      HandleChanges();
+    }
     int timeout_ms = GetTimeoutMs();
     ADEBUG << "this poll timeout ms: " << timeout_ms;
-    Poll(timeout_ms);
+    if (use_uring_) {
+      PollUring(timeout_ms);
+    } else {
+      Poll(timeout_ms);
+    }
+  }
+}
+
+void Poller::HandleChangesUring() {
+  CtrlParamMap local_params;
+  {
+    ReadLockGuard<AtomicRWLock> lck(poll_data_lock_);
+    if (ctrl_params_.empty()) {
+      return;
+    }
+    local_params.swap(ctrl_params_);
+  }
+
+  for (auto& pair : local_params) {
+    auto& item = pair.second;
+    ADEBUG << "uring poll ctl, op[" << item.operation << "] fd[" << item.fd
+           << "] events[" << item.event.events << "]";
+    if (item.operation == EPOLL_CTL_DEL) {
+      uring_->PrepPollRemove(static_cast<uint64_t>(item.fd));
+    } else {
+      // ADD and MOD both reduce to (re)arming a one-shot poll; a stale
+      // previous arm is cancelled first so MOD cannot double-fire.
+      if (item.operation == EPOLL_CTL_MOD) {
+        uring_->PrepPollRemove(static_cast<uint64_t>(item.fd));
+      }
+      uring_->PrepPollAdd(item.fd,
+                          item.event.events & ~(EPOLLET | EPOLLONESHOT),
+                          static_cast<uint64_t>(item.fd));
+    }
   }
+  uring_->Submit();
 }
 
 void Poller::HandleChanges() {
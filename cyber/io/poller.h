@@ -28,6 +28,7 @@
 #include "cyber/base/atomic_rw_lock.h"
 #include "cyber/common/macros.h"
 #include "cyber/io/poll_data.h"
+#include "cyber/io/uring_context.h"
 
 namespace apollo {
 namespace cyber {
@@ -50,12 +51,19 @@ class Poller {
   bool Init();
   void Clear();
   void Poll(int timeout_ms);
+  void PollUring(int timeout_ms);
   void ThreadFunc();
   void HandleChanges();
+  void HandleChangesUring();
+  void DispatchResponses(
+      const std::unordered_map<int, PollResponse>& responses);
   int GetTimeoutMs();
   void Notify();
 
   int epoll_fd_ = -1;
+  // opt-in io_uring backend (cyber_io_uring env); epoll is the fallback
+  std::unique_ptr<UringContext> uring_;
+  bool use_uring_ = false;
   std::thread thread_;
   std::atomic<bool> is_shutdown_ = {true};
 
@@ -68,6 +76,7 @@ class Poller {
 
   const int kPollSize = 32;
   const int kPollTimeoutMs = 100;
+  const uint32_t kUringEntries = 128;
 
   DECLARE_SINGLETON(Poller)
 };
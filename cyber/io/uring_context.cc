@@ -0,0 +1,339 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/io/uring_context.h"
+
+#include <string.h>
+
+#include "cyber/common/log.h"
+
+#ifdef CYBER_HAS_IO_URING
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+namespace {
+
+int io_uring_setup(unsigned entries, struct io_uring_params* p) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+}
+
+int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+                   unsigned flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+              nullptr, 0));
+}
+
+int io_uring_register(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+inline unsigned LoadAcquire(const unsigned* p) {
+  return std::atomic_load_explicit(
+      reinterpret_cast<const std::atomic<unsigned>*>(p),
+      std::memory_order_acquire);
+}
+
+inline void StoreRelease(unsigned* p, unsigned v) {
+  std::atomic_store_explicit(reinterpret_cast<std::atomic<unsigned>*>(p), v,
+                             std::memory_order_release);
+}
+
+}  // namespace
+
+UringContext::~UringContext() { Shutdown(); }
+
+bool UringContext::Init(uint32_t entries) {
+  memset(&params_, 0, sizeof(params_));
+  ring_fd_ = io_uring_setup(entries, &params_);
+  if (ring_fd_ < 0) {
+    ADEBUG << "io_uring setup failed, " << strerror(errno);
+    return false;
+  }
+
+  sq_ring_size_ =
+      params_.sq_off.array + params_.sq_entries * sizeof(unsigned);
+  cq_ring_size_ =
+      params_.cq_off.cqes + params_.cq_entries * sizeof(struct io_uring_cqe);
+  bool single_mmap = (params_.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (single_mmap && cq_ring_size_ > sq_ring_size_) {
+    sq_ring_size_ = cq_ring_size_;
+  }
+
+  sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+  if (sq_ring_ == MAP_FAILED) {
+    sq_ring_ = nullptr;
+    Shutdown();
+    return false;
+  }
+  if (single_mmap) {
+    cq_ring_ = sq_ring_;
+    cq_ring_size_ = sq_ring_size_;
+  } else {
+    cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == MAP_FAILED) {
+      cq_ring_ = nullptr;
+      Shutdown();
+      return false;
+    }
+  }
+
+  sqes_size_ = params_.sq_entries * sizeof(struct io_uring_sqe);
+  sqes_ = reinterpret_cast<struct io_uring_sqe*>(
+      mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES));
+  if (sqes_ == MAP_FAILED) {
+    sqes_ = nullptr;
+    Shutdown();
+    return false;
+  }
+
+  auto* sq = reinterpret_cast<char*>(sq_ring_);
+  sq_head_ = reinterpret_cast<unsigned*>(sq + params_.sq_off.head);
+  sq_tail_ = reinterpret_cast<unsigned*>(sq + params_.sq_off.tail);
+  sq_mask_ = reinterpret_cast<unsigned*>(sq + params_.sq_off.ring_mask);
+  sq_array_ = reinterpret_cast<unsigned*>(sq + params_.sq_off.array);
+
+  auto* cq = reinterpret_cast<char*>(cq_ring_);
+  cq_head_ = reinterpret_cast<unsigned*>(cq + params_.cq_off.head);
+  cq_tail_ = reinterpret_cast<unsigned*>(cq + params_.cq_off.tail);
+  cq_mask_ = reinterpret_cast<unsigned*>(cq + params_.cq_off.ring_mask);
+  cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params_.cq_off.cqes);
+
+  return true;
+}
+
+void UringContext::Shutdown() {
+  if (sqes_ != nullptr) {
+    munmap(sqes_, sqes_size_);
+    sqes_ = nullptr;
+  }
+  if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+    munmap(cq_ring_, cq_ring_size_);
+  }
+  cq_ring_ = nullptr;
+  if (sq_ring_ != nullptr) {
+    munmap(sq_ring_, sq_ring_size_);
+    sq_ring_ = nullptr;
+  }
+  if (ring_fd_ >= 0) {
+    close(ring_fd_);
+    ring_fd_ = -1;
+  }
+}
+
+struct io_uring_sqe* UringContext::GetSqe() {
+  unsigned head = LoadAcquire(sq_head_);
+  unsigned tail = *sq_tail_ + to_submit_;
+  if (tail - head >= params_.sq_entries) {
+    // Ring is full; flush what we have to make room.
+    if (SubmitLocked() < 0) {
+      return nullptr;
+    }
+    head = LoadAcquire(sq_head_);
+    if (tail - head >= params_.sq_entries) {
+      return nullptr;
+    }
+  }
+  unsigned index = tail & *sq_mask_;
+  struct io_uring_sqe* sqe = &sqes_[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sq_array_[index] = index;
+  ++to_submit_;
+  return sqe;
+}
+
+bool UringContext::PrepPollAdd(int fd, uint32_t poll_events,
+                               uint64_t user_data) {
+  std::lock_guard<std::mutex> lock(sq_mutex_);
+  struct io_uring_sqe* sqe = GetSqe();
+  if (sqe == nullptr) {
+    return false;
+  }
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->poll_events = static_cast<uint16_t>(poll_events);
+  sqe->user_data = user_data;
+  return true;
+}
+
+bool UringContext::PrepPollRemove(uint64_t user_data) {
+  std::lock_guard<std::mutex> lock(sq_mutex_);
+  struct io_uring_sqe* sqe = GetSqe();
+  if (sqe == nullptr) {
+    return false;
+  }
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = user_data;
+  sqe->user_data = kTimeoutUserData;
+  return true;
+}
+
+bool UringContext::PrepReadv(int fd, const struct iovec* iov, uint32_t iovcnt,
+                             uint64_t offset, uint64_t user_data) {
+  std::lock_guard<std::mutex> lock(sq_mutex_);
+  struct io_uring_sqe* sqe = GetSqe();
+  if (sqe == nullptr) {
+    return false;
+  }
+  sqe->opcode = IORING_OP_READV;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(iov);
+  sqe->len = iovcnt;
+  sqe->off = offset;
+  sqe->user_data = user_data;
+  return true;
+}
+
+bool UringContext::PrepWritev(int fd, const struct iovec* iov, uint32_t iovcnt,
+                              uint64_t offset, uint64_t user_data) {
+  std::lock_guard<std::mutex> lock(sq_mutex_);
+  struct io_uring_sqe* sqe = GetSqe();
+  if (sqe == nullptr) {
+    return false;
+  }
+  sqe->opcode = IORING_OP_WRITEV;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(iov);
+  sqe->len = iovcnt;
+  sqe->off = offset;
+  sqe->user_data = user_data;
+  return true;
+}
+
+bool UringContext::RegisterEventfd(int event_fd) {
+  return io_uring_register(ring_fd_, IORING_REGISTER_EVENTFD, &event_fd, 1) ==
+         0;
+}
+
+int UringContext::SubmitLocked() {
+  // Publish the new tail; GetSqe already filled the entries.
+  unsigned to_submit = to_submit_;
+  if (to_submit == 0) {
+    return 0;
+  }
+  StoreRelease(sq_tail_, *sq_tail_ + to_submit);
+  to_submit_ = 0;
+  int ret = io_uring_enter(ring_fd_, to_submit, 0, 0);
+  if (ret < 0) {
+    AERROR << "io_uring submit failed, " << strerror(errno);
+  }
+  return ret;
+}
+
+int UringContext::Submit() {
+  std::lock_guard<std::mutex> lock(sq_mutex_);
+  return SubmitLocked();
+}
+
+int UringContext::SubmitAndWait(int timeout_ms,
+                                std::vector<UringCompletion>* completions) {
+  unsigned to_submit = 0;
+  {
+    std::lock_guard<std::mutex> lock(sq_mutex_);
+    if (timeout_ms >= 0) {
+      timeout_ts_.tv_sec = timeout_ms / 1000;
+      timeout_ts_.tv_nsec = (timeout_ms % 1000) * 1000000LL;
+      struct io_uring_sqe* sqe = GetSqe();
+      if (sqe != nullptr) {
+        sqe->opcode = IORING_OP_TIMEOUT;
+        sqe->fd = -1;
+        sqe->addr = reinterpret_cast<uint64_t>(&timeout_ts_);
+        sqe->len = 1;
+        sqe->user_data = kTimeoutUserData;
+      }
+    }
+    to_submit = to_submit_;
+    if (to_submit > 0) {
+      StoreRelease(sq_tail_, *sq_tail_ + to_submit);
+      to_submit_ = 0;
+    }
+  }
+
+  int ret = io_uring_enter(ring_fd_, to_submit, 1, IORING_ENTER_GETEVENTS);
+  if (ret < 0 && errno != EINTR) {
+    AERROR << "io_uring enter failed, " << strerror(errno);
+    return -1;
+  }
+  return Reap(completions);
+}
+
+int UringContext::Reap(std::vector<UringCompletion>* completions) {
+  std::lock_guard<std::mutex> lock(cq_mutex_);
+  int count = 0;
+  unsigned head = *cq_head_;
+  unsigned tail = LoadAcquire(cq_tail_);
+  while (head != tail) {
+    const struct io_uring_cqe* cqe = &cqes_[head & *cq_mask_];
+    if (cqe->user_data != kTimeoutUserData) {
+      completions->push_back({cqe->user_data, cqe->res});
+      ++count;
+    }
+    ++head;
+  }
+  StoreRelease(cq_head_, head);
+  return count;
+}
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+#else  // !CYBER_HAS_IO_URING
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+UringContext::~UringContext() {}
+bool UringContext::Init(uint32_t entries) {
+  (void)entries;
+  return false;
+}
+void UringContext::Shutdown() {}
+bool UringContext::PrepPollAdd(int, uint32_t, uint64_t) { return false; }
+bool UringContext::PrepPollRemove(uint64_t) { return false; }
+bool UringContext::PrepReadv(int, const struct iovec*, uint32_t, uint64_t,
+                             uint64_t) {
+  return false;
+}
+bool UringContext::PrepWritev(int, const struct iovec*, uint32_t, uint64_t,
+                              uint64_t) {
+  return false;
+}
+bool UringContext::RegisterEventfd(int) { return false; }
+int UringContext::Submit() { return -1; }
+int UringContext::SubmitAndWait(int, std::vector<UringCompletion>*) {
+  return -1;
+}
+int UringContext::Reap(std::vector<UringCompletion>*) { return 0; }
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_HAS_IO_URING
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_IO_URING_CONTEXT_H_
+#define CYBER_IO_URING_CONTEXT_H_
+
+#include <stdint.h>
+#include <sys/uio.h>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define CYBER_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+#endif
+#endif
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+struct UringCompletion {
+  uint64_t user_data;
+  int32_t res;
+};
+
+// Thin raw-syscall wrapper around one io_uring instance (no liburing
+// dependency). Callers prepare submission entries under an internal
+// mutex and flush them in one io_uring_enter call, so a croutine can
+// batch several operations into a single syscall. On kernels or
+// toolchains without io_uring support, Init() fails and callers fall
+// back to their epoll/pread paths.
+class UringContext {
+ public:
+  UringContext() {}
+  ~UringContext();
+
+  bool Init(uint32_t entries);
+  void Shutdown();
+  bool IsValid() const { return ring_fd_ >= 0; }
+
+  // One-shot poll, completion res carries the ready events.
+  bool PrepPollAdd(int fd, uint32_t poll_events, uint64_t user_data);
+  bool PrepPollRemove(uint64_t user_data);
+  bool PrepReadv(int fd, const struct iovec* iov, uint32_t iovcnt,
+                 uint64_t offset, uint64_t user_data);
+  bool PrepWritev(int fd, const struct iovec* iov, uint32_t iovcnt,
+                  uint64_t offset, uint64_t user_data);
+
+  // Completions raise the eventfd, so the fd can be watched by the
+  // regular Poller.
+  bool RegisterEventfd(int event_fd);
+
+  // Flush prepared entries to the kernel without waiting.
+  int Submit();
+
+  // Flush prepared entries and wait up to timeout_ms (< 0: forever) for
+  // at least one completion; returns the number reaped into completions.
+  int SubmitAndWait(int timeout_ms, std::vector<UringCompletion>* completions);
+
+  // Drain available completions without blocking.
+  int Reap(std::vector<UringCompletion>* completions);
+
+ private:
+  int ring_fd_ = -1;
+
+#ifdef CYBER_HAS_IO_URING
+  // user_data of the internal timeout entry, never surfaced to callers.
+  static constexpr uint64_t kTimeoutUserData = ~0ULL;
+
+  struct io_uring_sqe* GetSqe();  // sq_mutex_ must be held
+  int SubmitLocked();             // sq_mutex_ must be held
+
+  struct io_uring_params params_;
+  void* sq_ring_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  void* cq_ring_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  struct io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+
+  unsigned* sq_head_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_mask_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned* cq_mask_ = nullptr;
+  struct io_uring_cqe* cqes_ = nullptr;
+
+  std::mutex sq_mutex_;
+  unsigned to_submit_ = 0;
+  std::mutex cq_mutex_;
+  struct __kernel_timespec timeout_ts_;
+#endif
+};
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_IO_URING_CONTEXT_H_
@@ -31,6 +31,32 @@ namespace logger {
 
 static std::unordered_map<std::string, LogFileObject*> moduleLoggerMap;
 
+namespace {
+
+// INFO-and-below line budget per module; WARNING and above always pass.
+const double kModuleLogRatePerSec = 2048.0;
+const double kModuleLogBurst = 4096.0;
+
+// Extracts the module tag without touching the message; the flusher
+// still strips it with FindModuleName before writing to file.
+void PeekModuleName(const char* message, int message_len,
+                    std::string* module_name) {
+  const char* lpos =
+      static_cast<const char*>(memchr(message, '[', message_len));
+  if (lpos != nullptr) {
+    const char* rpos = static_cast<const char*>(
+        memchr(lpos, ']', message_len - (lpos - message)));
+    if (rpos != nullptr) {
+      module_name->assign(lpos + 1, rpos - lpos - 1);
+    }
+  }
+  if (module_name->empty()) {
+    *module_name = common::GlobalData::Instance()->ProcessGroup();
+  }
+}
+
+}  // namespace
+
 AsyncLogger::AsyncLogger(google::base::Logger* wrapped, int max_buffer_bytes)
     : max_buffer_bytes_(max_buffer_bytes),
       wrapped_(wrapped),
@@ -65,7 +91,9 @@ void AsyncLogger::Stop() {
   }
   thread_.join();
   CHECK(active_buf_->messages.empty());
+  CHECK(active_buf_->urgent_messages.empty());
   CHECK(flushing_buf_->messages.empty());
+  CHECK(flushing_buf_->urgent_messages.empty());
   // std::cout << "Async Logger Stop!" << std::endl;
 }
 
@@ -73,8 +101,26 @@ void AsyncLogger::Write(bool force_flush, time_t timestamp, const char* message,
                         int message_len) {
   // drop message when acitve buffer full
   if (unlikely(BufferFull(*active_buf_))) {
+    drop_count_.fetch_add(1);
     return;
   }
+  int32_t level = -1;
+  switch (message[0]) {
+    case 'F':
+      level = 3;
+      break;
+    case 'E':
+      level = 2;
+      break;
+    case 'W':
+      level = 1;
+      break;
+    case 'I':
+      level = 0;
+      break;
+    default:
+      break;
+  }
   {
     std::unique_lock<std::mutex> lock(mutex_);
     if (state_ != RUNNING) {
@@ -82,33 +128,52 @@ void AsyncLogger::Write(bool force_flush, time_t timestamp, const char* message,
       return;
     }
 
-    switch (message[0]) {
-      case 'F': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 3),
-                         force_flush);
-        break;
-      }
-      case 'E': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 2),
-                         force_flush);
-        break;
-      }
-      case 'W': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 1),
-                         force_flush);
-        break;
+    if (level <= 0) {
+      // one module's log storm must not starve the others: INFO and
+      // below draw from that module's token bucket, dropped lines are
+      // accounted and summarized once the module is under budget again
+      std::string module_name;
+      PeekModuleName(message, message_len, &module_name);
+      TokenBucket& bucket = module_buckets_[module_name];
+      if (bucket.last_ts == 0) {
+        bucket.tokens = kModuleLogBurst;
+      } else if (timestamp > bucket.last_ts) {
+        bucket.tokens =
+            std::min(kModuleLogBurst,
+                     bucket.tokens + kModuleLogRatePerSec *
+                                         static_cast<double>(timestamp -
+                                                             bucket.last_ts));
       }
-      case 'I': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 0),
-                         force_flush);
-        break;
+      bucket.last_ts = timestamp;
+      if (bucket.tokens < 1.0) {
+        ++bucket.dropped;
+        drop_count_.fetch_add(1);
+        return;
       }
-      default: {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), -1),
-                         force_flush);
+      bucket.tokens -= 1.0;
+      if (bucket.dropped > 0) {
+        std::string note = "W rate limiter of module [" + module_name +
+                           "] dropped " + std::to_string(bucket.dropped) +
+                           " lines\n";
+        active_buf_->add(Msg(timestamp, std::move(note), 1), true);
+        bucket.dropped = 0;
       }
     }
+
+    active_buf_->add(Msg(timestamp, std::string(message, message_len), level),
+                     force_flush);
     wake_flusher_cv_.notify_one();
+
+    if (level == 3) {
+      // crash path: glog aborts right after a FATAL write returns, so
+      // push the message through the flusher before letting it
+      active_buf_->flush = true;
+      uint64_t orig_flush_count = flush_count_;
+      while (flush_count_ < (orig_flush_count + 2) && state_ == RUNNING) {
+        wake_flusher_cv_.notify_one();
+        flush_complete_cv_.wait(lock);
+      }
+    }
   }
 }
 
@@ -144,9 +209,9 @@ void AsyncLogger::RunThread() {
     active_buf_.swap(flushing_buf_);
     lock.unlock();
 
-    for (auto& msg : flushing_buf_->messages) {
+    auto write_msg = [](Msg* msg) {
       std::string module_name;
-      FindModuleName(&msg.message, &module_name);
+      FindModuleName(&msg->message, &module_name);
 
       LogFileObject* fileobject = nullptr;
       if (moduleLoggerMap.find(module_name) != moduleLoggerMap.end()) {
@@ -157,10 +222,18 @@ void AsyncLogger::RunThread() {
         moduleLoggerMap[module_name] = fileobject;
       }
       if (fileobject) {
-        const bool should_flush = msg.level > 0;
-        fileobject->Write(should_flush, msg.ts, msg.message.data(),
-                          static_cast<int>(msg.message.size()));
+        const bool should_flush = msg->level > 0;
+        fileobject->Write(should_flush, msg->ts, msg->message.data(),
+                          static_cast<int>(msg->message.size()));
       }
+    };
+    // the urgent queue goes first so WARNING and above reach disk even
+    // when the info queue is deep
+    for (auto& msg : flushing_buf_->urgent_messages) {
+      write_msg(&msg);
+    }
+    for (auto& msg : flushing_buf_->messages) {
+      write_msg(&msg);
     }
 
     if (flushing_buf_->flush) {
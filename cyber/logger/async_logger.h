@@ -26,6 +26,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -104,6 +105,9 @@ class AsyncLogger : public google::base::Logger {
 
   const std::thread* LogThread() const { return &thread_; }
 
+  // Total lines dropped so far, by full buffers or module rate limits.
+  uint64_t DroppedCount() const { return drop_count_.load(); }
+
  private:
   // A buffered message.
   //
@@ -120,11 +124,14 @@ class AsyncLogger : public google::base::Logger {
         : ts(ts), message(std::move(message)), level(level) {}
   };
 
-  // A buffer of messages waiting to be flushed.
+  // A buffer of messages waiting to be flushed, queued per severity:
+  // WARNING and above are written ahead of the info queue so a storm of
+  // low-severity lines cannot delay them.
   struct Buffer {
+    std::vector<Msg> urgent_messages;
     std::vector<Msg> messages;
 
-    // Estimate of the size of 'messages'.
+    // Estimate of the size of the queued messages.
     std::atomic<int> size = {0};
 
     // Whether this buffer needs an explicit flush of the
@@ -134,6 +141,7 @@ class AsyncLogger : public google::base::Logger {
     Buffer() {}
 
     inline void clear() {
+      urgent_messages.clear();
       messages.clear();
       size = 0;
       flush = false;
@@ -142,18 +150,31 @@ class AsyncLogger : public google::base::Logger {
     inline void add(Msg&& msg, bool force_flush) {
       size +=
           static_cast<int>(sizeof(msg)) + static_cast<int>(msg.message.size());
-      messages.emplace_back(std::move(msg));
+      if (msg.level >= 1) {
+        urgent_messages.emplace_back(std::move(msg));
+      } else {
+        messages.emplace_back(std::move(msg));
+      }
       flush |= force_flush;
     }
 
     inline bool needs_flush_or_write() const {
-      return flush || !messages.empty();
+      return flush || !urgent_messages.empty() || !messages.empty();
     }
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Buffer);
   };
 
+  // Per-module budget for INFO-and-below lines. WARNING and above never
+  // consume tokens, so evidence of an incident is not rate limited away.
+  struct TokenBucket {
+    double tokens = 0.0;
+    time_t last_ts = 0;
+    // lines dropped since the last summary line was emitted
+    uint64_t dropped = 0;
+  };
+
   bool BufferFull(const Buffer& buf) const;
   void RunThread();
 
@@ -167,9 +188,12 @@ class AsyncLogger : public google::base::Logger {
   // 64 bits should be enough to never worry about overflow.
   uint64_t flush_count_ = 0;
 
-  // Count of how many times the writer thread has dropped the log messages.
+  // Count of how many log messages have been dropped.
   // 64 bits should be enough to never worry about overflow.
-  uint64_t drop_count_ = 0;
+  std::atomic<uint64_t> drop_count_ = {0};
+
+  // One token bucket per module, protected by 'mutex_'.
+  std::unordered_map<std::string, TokenBucket> module_buckets_;
 
   // Protects buffers as well as 'state_'.
   std::mutex mutex_;
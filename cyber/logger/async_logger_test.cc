@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/logger/async_logger.h"
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+TEST(AsyncLoggerTest, write_and_flush) {
+  AsyncLogger logger(google::base::GetLogger(google::INFO), 0);
+  logger.Start();
+
+  time_t timep;
+  time(&timep);
+  std::string message = "I0000 00:00:00.000000 0 file.cc:1] "
+                        "[AsyncLoggerTest] hello\n";
+  logger.Write(false, timep, message.c_str(),
+               static_cast<int>(message.size()));
+  logger.Flush();
+  EXPECT_EQ(logger.DroppedCount(), 0);
+  logger.Stop();
+}
+
+TEST(AsyncLoggerTest, rate_limit_storm) {
+  AsyncLogger logger(google::base::GetLogger(google::INFO), 0);
+  logger.Start();
+
+  time_t timep;
+  time(&timep);
+  // a single module hammering INFO within one second runs out of tokens
+  std::string message = "I0000 00:00:00.000000 0 file.cc:1] "
+                        "[AsyncLoggerStorm] spam\n";
+  for (int i = 0; i < 10000; ++i) {
+    logger.Write(false, timep, message.c_str(),
+                 static_cast<int>(message.size()));
+  }
+  EXPECT_GT(logger.DroppedCount(), 0);
+
+  // WARNING and above never consume tokens
+  uint64_t dropped = logger.DroppedCount();
+  std::string warning = "W0000 00:00:00.000000 0 file.cc:1] "
+                        "[AsyncLoggerStorm] still here\n";
+  logger.Write(true, timep, warning.c_str(),
+               static_cast<int>(warning.size()));
+  EXPECT_EQ(logger.DroppedCount(), dropped);
+
+  logger.Flush();
+  logger.Stop();
+}
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,230 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/logger/binary_log.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <utility>
+
+#include "cyber/binary.h"
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+namespace {
+
+constexpr auto kFlushInterval = std::chrono::milliseconds(10);
+
+uint64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+BinaryLogSink::BinaryLogSink() {
+  const char* path = std::getenv("CYBER_BINARY_LOG_FILE");
+  std::string file_name =
+      path != nullptr ? path : Binary::GetName() + ".binlog";
+  file_ = std::fopen(file_name.c_str(), "wb");
+  if (file_ == nullptr) {
+    // Without a destination every record is counted as dropped; the text
+    // pipeline is untouched so FATAL and friends still reach glog.
+    return;
+  }
+  running_.store(true);
+  flusher_ = std::thread(&BinaryLogSink::RunFlusher, this);
+}
+
+BinaryLogSink::~BinaryLogSink() { Shutdown(); }
+
+void BinaryLogSink::Shutdown() {
+  bool expected = true;
+  if (!running_.compare_exchange_strong(expected, false)) {
+    return;
+  }
+  shutdown_cv_.notify_all();
+  if (flusher_.joinable()) {
+    flusher_.join();
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& ring : rings_) {
+    DrainRing(ring.get());
+  }
+  if (file_ != nullptr) {
+    std::fclose(file_);
+    file_ = nullptr;
+  }
+}
+
+uint32_t BinaryLogSink::RegisterSite(const char* file, int line,
+                                     int severity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint32_t id = static_cast<uint32_t>(site_files_.size());
+  site_files_.emplace_back(file);
+  if (file_ != nullptr) {
+    // Site records go straight to the file: they are rare (once per call
+    // site per process) and the renderer needs them before any message
+    // that references them.
+    uint8_t kind = static_cast<uint8_t>(BinLogRecord::kSite);
+    uint16_t file_len = static_cast<uint16_t>(site_files_.back().size());
+    std::fwrite(&kind, sizeof(kind), 1, file_);
+    std::fwrite(&id, sizeof(id), 1, file_);
+    std::fwrite(&severity, sizeof(int32_t), 1, file_);
+    std::fwrite(&line, sizeof(int32_t), 1, file_);
+    std::fwrite(&file_len, sizeof(file_len), 1, file_);
+    std::fwrite(site_files_.back().data(), 1, file_len, file_);
+  }
+  return id;
+}
+
+BinaryLogSink::ThreadRing* BinaryLogSink::CurrentRing() {
+  static thread_local std::shared_ptr<ThreadRing> ring = [this]() {
+    auto r = std::make_shared<ThreadRing>();
+    std::lock_guard<std::mutex> lock(mutex_);
+    rings_.push_back(r);
+    return r;
+  }();
+  return ring.get();
+}
+
+void BinaryLogSink::Append(const char* data, size_t len) {
+  if (!running_.load(std::memory_order_relaxed)) {
+    drop_count_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  ThreadRing* ring = CurrentRing();
+  uint64_t head = ring->head.load(std::memory_order_relaxed);
+  uint64_t tail = ring->tail.load(std::memory_order_acquire);
+  // Records are length-prefixed inside the ring so the flusher can walk it.
+  size_t need = sizeof(uint32_t) + len;
+  if (head - tail + need > ThreadRing::kCapacity) {
+    drop_count_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  uint32_t rec_len = static_cast<uint32_t>(len);
+  auto copy_in = [ring](uint64_t at, const void* src, size_t n) {
+    size_t pos = at % ThreadRing::kCapacity;
+    size_t first = std::min(n, ThreadRing::kCapacity - pos);
+    std::memcpy(ring->data.get() + pos, src, first);
+    std::memcpy(ring->data.get(), static_cast<const char*>(src) + first,
+                n - first);
+  };
+  copy_in(head, &rec_len, sizeof(rec_len));
+  copy_in(head + sizeof(rec_len), data, len);
+  ring->head.store(head + need, std::memory_order_release);
+}
+
+void BinaryLogSink::RunFlusher() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (running_.load()) {
+    shutdown_cv_.wait_for(lock, kFlushInterval);
+    for (auto& ring : rings_) {
+      DrainRing(ring.get());
+    }
+    std::fflush(file_);
+  }
+}
+
+void BinaryLogSink::DrainRing(ThreadRing* ring) {
+  uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+  uint64_t head = ring->head.load(std::memory_order_acquire);
+  char scratch[2048];
+  while (tail < head) {
+    auto copy_out = [ring](uint64_t at, void* dst, size_t n) {
+      size_t pos = at % ThreadRing::kCapacity;
+      size_t first = std::min(n, ThreadRing::kCapacity - pos);
+      std::memcpy(dst, ring->data.get() + pos, first);
+      std::memcpy(static_cast<char*>(dst) + first, ring->data.get(),
+                  n - first);
+    };
+    uint32_t rec_len = 0;
+    copy_out(tail, &rec_len, sizeof(rec_len));
+    copy_out(tail + sizeof(rec_len), scratch,
+             std::min<size_t>(rec_len, sizeof(scratch)));
+    WriteOut(scratch, std::min<size_t>(rec_len, sizeof(scratch)));
+    tail += sizeof(rec_len) + rec_len;
+    ring->tail.store(tail, std::memory_order_release);
+  }
+}
+
+void BinaryLogSink::WriteOut(const char* data, size_t len) {
+  if (file_ != nullptr && len > 0) {
+    std::fwrite(data, 1, len, file_);
+  }
+}
+
+BinaryLogMessage::BinaryLogMessage(uint32_t site_id, const char* module) {
+  uint8_t kind = static_cast<uint8_t>(BinLogRecord::kMessage);
+  uint64_t ts = NowNs();
+  uint32_t tid = static_cast<uint32_t>(syscall(SYS_gettid));
+  PutRaw(&kind, sizeof(kind));
+  PutRaw(&site_id, sizeof(site_id));
+  PutRaw(&ts, sizeof(ts));
+  PutRaw(&tid, sizeof(tid));
+  uint16_t module_len =
+      module == nullptr ? 0 : static_cast<uint16_t>(std::strlen(module));
+  PutRaw(&module_len, sizeof(module_len));
+  PutRaw(module, module_len);
+}
+
+BinaryLogMessage::~BinaryLogMessage() {
+  if (committed_) {
+    return;
+  }
+  // PutRaw always leaves room for this final byte, so the record is
+  // well-formed even when arguments were clipped.
+  BinLogTag end = BinLogTag::kEnd;
+  std::memcpy(buf_ + len_, &end, sizeof(end));
+  ++len_;
+  BinaryLogSink::Instance()->Append(buf_, len_);
+}
+
+void BinaryLogMessage::PutRaw(const void* src, size_t n) {
+  if (len_ + n > kMaxRecord - 1) {
+    truncated_ = true;
+    return;
+  }
+  std::memcpy(buf_ + len_, src, n);
+  len_ += n;
+}
+
+void BinaryLogMessage::PutString(const char* data, size_t n) {
+  n = std::min<size_t>(n, UINT16_MAX);
+  if (len_ + sizeof(uint8_t) + sizeof(uint16_t) > kMaxRecord - 1) {
+    truncated_ = true;
+    return;
+  }
+  if (len_ + sizeof(uint8_t) + sizeof(uint16_t) + n > kMaxRecord - 1) {
+    // Keep the record parseable: clip the string to what still fits.
+    n = kMaxRecord - 1 - len_ - sizeof(uint8_t) - sizeof(uint16_t);
+    truncated_ = true;
+  }
+  PutTag(BinLogTag::kString);
+  uint16_t str_len = static_cast<uint16_t>(n);
+  PutRaw(&str_len, sizeof(str_len));
+  PutRaw(data, n);
+}
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,223 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_LOGGER_BINARY_LOG_H_
+#define CYBER_LOGGER_BINARY_LOG_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "cyber/common/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+// Structured binary logging for hot paths.
+//
+// The regular glog pipeline formats the whole text line on the calling
+// thread before AsyncLogger ever sees it; for a driver callback that is
+// tens of microseconds per message. In binary mode the call site instead
+// registers itself once (file, line, severity become a small interned id)
+// and each log statement only copies the raw argument values into a
+// per-thread ring buffer. A flusher thread drains the rings to a .binlog
+// file, and `cyber_binlog` under cyber/tools renders the file to the usual
+// text form offline.
+//
+// The mode is a compile-time opt-in (-DCYBER_BINARY_LOG); the streaming
+// macros in cyber/common/log.h keep their shape, so call sites do not
+// change. Records that overflow a ring are dropped and counted rather
+// than blocking the producer. FATAL stays on glog so the abort semantics
+// and the final flush are unchanged.
+
+// Argument tags, one per streamed value. kEnd closes a record.
+enum class BinLogTag : uint8_t {
+  kEnd = 0,
+  kBool = 1,
+  kInt64 = 2,
+  kUint64 = 3,
+  kDouble = 4,
+  kChar = 5,
+  kString = 6,  // u16 length + bytes, also used for the ostream fallback
+};
+
+// Record kinds in the .binlog stream.
+enum class BinLogRecord : uint8_t {
+  kSite = 'S',     // u32 id, i32 severity, i32 line, string file
+  kMessage = 'M',  // u32 site id, u64 ns timestamp, u32 tid, string module,
+                   // tagged args until kEnd
+};
+
+class BinaryLogSink {
+ public:
+  ~BinaryLogSink();
+
+  // Intern a call site; called once per site from a function-local static.
+  // Severity uses the glog numeric levels, -1 for ADEBUG.
+  uint32_t RegisterSite(const char* file, int line, int severity);
+
+  // Copy one finished message record into the calling thread's ring.
+  void Append(const char* data, size_t len);
+
+  void Shutdown();
+
+  uint64_t DropCount() const { return drop_count_.load(); }
+
+ private:
+  // Single-producer byte ring; the owning thread writes, the flusher reads.
+  struct ThreadRing {
+    static constexpr size_t kCapacity = 256 * 1024;
+    std::unique_ptr<char[]> data;
+    std::atomic<uint64_t> head = {0};  // next write offset
+    std::atomic<uint64_t> tail = {0};  // next read offset
+
+    ThreadRing() : data(new char[kCapacity]) {}
+    size_t Unread() const { return head.load() - tail.load(); }
+  };
+
+  ThreadRing* CurrentRing();
+  void RunFlusher();
+  void DrainRing(ThreadRing* ring);
+  void WriteOut(const char* data, size_t len);
+
+  std::FILE* file_ = nullptr;
+
+  // Site table, appended under mutex_; ids are indices.
+  std::vector<std::string> site_files_;
+
+  std::mutex mutex_;
+  std::condition_variable shutdown_cv_;
+  std::vector<std::shared_ptr<ThreadRing>> rings_;
+  std::thread flusher_;
+  std::atomic<bool> running_ = {false};
+  std::atomic<uint64_t> drop_count_ = {0};
+
+  DECLARE_SINGLETON(BinaryLogSink)
+};
+
+// One in-flight log statement. Streams encode into a stack buffer and the
+// destructor commits the record to the sink. Arithmetic values and strings
+// are captured raw; anything else falls back to ostream formatting so
+// existing call sites keep compiling.
+class BinaryLogMessage {
+ public:
+  BinaryLogMessage(uint32_t site_id, const char* module);
+  ~BinaryLogMessage();
+
+  BinaryLogMessage(BinaryLogMessage&& other)
+      : len_(other.len_), truncated_(other.truncated_) {
+    std::memcpy(buf_, other.buf_, other.len_);
+    other.committed_ = true;
+  }
+
+  BinaryLogMessage& operator<<(bool v) {
+    PutTag(BinLogTag::kBool);
+    PutRaw(&v, sizeof(v));
+    return *this;
+  }
+  BinaryLogMessage& operator<<(char v) {
+    PutTag(BinLogTag::kChar);
+    PutRaw(&v, sizeof(v));
+    return *this;
+  }
+  BinaryLogMessage& operator<<(float v) {
+    return *this << static_cast<double>(v);
+  }
+  BinaryLogMessage& operator<<(double v) {
+    PutTag(BinLogTag::kDouble);
+    PutRaw(&v, sizeof(v));
+    return *this;
+  }
+  BinaryLogMessage& operator<<(const char* v) {
+    PutString(v, v == nullptr ? 0 : std::strlen(v));
+    return *this;
+  }
+  BinaryLogMessage& operator<<(const std::string& v) {
+    PutString(v.data(), v.size());
+    return *this;
+  }
+
+  template <typename T,
+            typename std::enable_if<std::is_integral<T>::value &&
+                                        std::is_signed<T>::value,
+                                    int>::type = 0>
+  BinaryLogMessage& operator<<(T v) {
+    int64_t widened = v;
+    PutTag(BinLogTag::kInt64);
+    PutRaw(&widened, sizeof(widened));
+    return *this;
+  }
+
+  template <typename T,
+            typename std::enable_if<std::is_integral<T>::value &&
+                                        std::is_unsigned<T>::value,
+                                    int>::type = 0>
+  BinaryLogMessage& operator<<(T v) {
+    uint64_t widened = v;
+    PutTag(BinLogTag::kUint64);
+    PutRaw(&widened, sizeof(widened));
+    return *this;
+  }
+
+  template <typename T,
+            typename std::enable_if<!std::is_integral<T>::value &&
+                                        !std::is_convertible<T, std::string>::
+                                            value &&
+                                        !std::is_floating_point<T>::value,
+                                    int>::type = 0>
+  BinaryLogMessage& operator<<(const T& v) {
+    std::ostringstream os;
+    os << v;
+    const std::string& s = os.str();
+    PutString(s.data(), s.size());
+    return *this;
+  }
+
+ private:
+  static constexpr size_t kMaxRecord = 1024;
+
+  void PutTag(BinLogTag tag) { PutRaw(&tag, sizeof(tag)); }
+  void PutRaw(const void* src, size_t n);
+  void PutString(const char* data, size_t n);
+
+  char buf_[kMaxRecord];
+  size_t len_ = 0;
+  bool truncated_ = false;
+  bool committed_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(BinaryLogMessage)
+};
+
+// Counterpart of google::LogMessageVoidify for the conditional macros.
+struct BinaryLogVoidify {
+  void operator&(const BinaryLogMessage&) {}
+};
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_LOGGER_BINARY_LOG_H_
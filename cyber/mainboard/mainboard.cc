@@ -16,15 +16,21 @@
 
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
+#include "cyber/cyber.h"
 #include "cyber/init.h"
 #include "cyber/mainboard/module_argument.h"
 #include "cyber/mainboard/module_controller.h"
+#include "cyber/proto/scheduler_conf.pb.h"
+#include "cyber/scheduler/scheduler_factory.h"
 #include "cyber/state.h"
 
 #include "gflags/gflags.h"
 
+using apollo::cyber::common::GlobalData;
 using apollo::cyber::mainboard::ModuleArgument;
 using apollo::cyber::mainboard::ModuleController;
+using apollo::cyber::proto::SchedulerReloadRequest;
+using apollo::cyber::proto::SchedulerReloadResponse;
 
 int main(int argc, char** argv) {
   google::SetUsageMessage("we use this program to load dag and run user apps.");
@@ -44,6 +50,32 @@ int main(int argc, char** argv) {
     return -1;
   }
 
+  // scheduler admin service: lets bench tooling re-apply the scheduler
+  // conf of this process group at runtime instead of restarting the stack
+  auto sched_admin_node = apollo::cyber::CreateNode(
+      GlobalData::Instance()->ProcessGroup() + "_sched_admin");
+  std::shared_ptr<
+      apollo::cyber::Service<SchedulerReloadRequest, SchedulerReloadResponse>>
+      sched_reload_service;
+  if (sched_admin_node != nullptr) {
+    sched_reload_service =
+        sched_admin_node
+            ->CreateService<SchedulerReloadRequest, SchedulerReloadResponse>(
+                GlobalData::Instance()->ProcessGroup() +
+                    "/scheduler/reload_conf",
+                [](const std::shared_ptr<SchedulerReloadRequest>& request,
+                   std::shared_ptr<SchedulerReloadResponse>& response) {
+                  bool success = false;
+                  if (request->has_scheduler_conf()) {
+                    success = apollo::cyber::scheduler::ReloadConf(
+                        request->scheduler_conf());
+                  } else {
+                    success = apollo::cyber::scheduler::ReloadConfFromFile();
+                  }
+                  response->set_success(success);
+                });
+  }
+
   apollo::cyber::WaitForShutdown();
   controller.Clear();
   AINFO << "exit mainboard.";
@@ -16,8 +16,15 @@
 
 #include "cyber/mainboard/module_controller.h"
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
+#include "cyber/base/thread_pool.h"
 #include "cyber/common/environment.h"
 #include "cyber/common/file.h"
 #include "cyber/component/component_base.h"
@@ -26,6 +33,120 @@ namespace apollo {
 namespace cyber {
 namespace mainboard {
 
+namespace {
+
+// one created-but-uninitialized component waiting for Initialize
+struct PendingInit {
+  std::string name;
+  std::vector<std::string> depends;
+  std::function<bool()> init;
+};
+
+bool RunInit(PendingInit* task) {
+  const auto start = std::chrono::steady_clock::now();
+  const bool ok = task->init();
+  const auto elapsed_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count();
+  if (ok) {
+    AINFO << "Component [" << task->name << "] initialized in " << elapsed_ms
+          << " ms";
+  } else {
+    AERROR << "Component [" << task->name << "] failed to initialize after "
+           << elapsed_ms << " ms";
+  }
+  return ok;
+}
+
+// Initialize the pending components. Without declared dependencies the
+// legacy strictly-sequential dag file order is kept; once any component
+// declares init_depends, independent components of each topological wave
+// run concurrently on a thread pool.
+bool InitComponents(std::vector<PendingInit>* pending) {
+  bool has_depends = false;
+  for (auto& task : *pending) {
+    has_depends = has_depends || !task.depends.empty();
+  }
+  if (!has_depends) {
+    for (auto& task : *pending) {
+      if (!RunInit(&task)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const size_t task_num = pending->size();
+  std::unordered_map<std::string, size_t> name_index;
+  for (size_t i = 0; i < task_num; ++i) {
+    if (!name_index.emplace((*pending)[i].name, i).second) {
+      AWARN << "Duplicate component name [" << (*pending)[i].name
+            << "], init dependencies resolve to the first one";
+    }
+  }
+
+  std::vector<std::vector<size_t>> dependents(task_num);
+  std::vector<size_t> indegree(task_num, 0);
+  for (size_t i = 0; i < task_num; ++i) {
+    for (auto& dep : (*pending)[i].depends) {
+      auto itr = name_index.find(dep);
+      if (itr == name_index.end()) {
+        AWARN << "Component [" << (*pending)[i].name
+              << "] depends on unknown component [" << dep << "], ignored";
+        continue;
+      }
+      dependents[itr->second].push_back(i);
+      ++indegree[i];
+    }
+  }
+
+  base::ThreadPool pool(
+      std::min(task_num,
+               std::max<size_t>(std::thread::hardware_concurrency(), 2)));
+  std::vector<bool> done(task_num, false);
+  size_t remaining = task_num;
+  while (remaining > 0) {
+    std::vector<size_t> wave;
+    for (size_t i = 0; i < task_num; ++i) {
+      if (!done[i] && indegree[i] == 0) {
+        wave.push_back(i);
+      }
+    }
+    if (wave.empty()) {
+      for (size_t i = 0; i < task_num; ++i) {
+        if (!done[i]) {
+          AERROR << "Component [" << (*pending)[i].name
+                 << "] is part of an init dependency cycle";
+        }
+      }
+      return false;
+    }
+    std::vector<std::future<bool>> results;
+    results.reserve(wave.size());
+    for (auto i : wave) {
+      results.emplace_back(pool.Enqueue(RunInit, &(*pending)[i]));
+    }
+    bool wave_ok = true;
+    for (auto& result : results) {
+      wave_ok = result.get() && wave_ok;
+    }
+    if (!wave_ok) {
+      return false;
+    }
+    for (auto i : wave) {
+      done[i] = true;
+      --remaining;
+      for (auto d : dependents[i]) {
+        --indegree[d];
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 void ModuleController::Clear() {
   for (auto& component : component_list_) {
     component->Shutdown();
@@ -39,6 +160,13 @@ bool ModuleController::LoadAll() {
   const std::string current_path = common::GetCurrentPath();
   const std::string dag_root_path = common::GetAbsolutePath(work_root, "dag");
 
+  // opt-in: start dlopening the libraries recorded by the previous run
+  // before the dag confs are even parsed
+  const std::string loader_cache = common::GetEnv("cyber_class_loader_cache");
+  if (loader_cache != "") {
+    class_loader_manager_.PreloadFromCache(loader_cache);
+  }
+
   for (auto& dag_conf : args_.GetDAGConfList()) {
     std::string module_path = "";
     if (dag_conf == common::GetFileName(dag_conf)) {
@@ -60,12 +188,36 @@ bool ModuleController::LoadAll() {
       return false;
     }
   }
+  if (loader_cache != "") {
+    class_loader_manager_.DumpFactoryCache(loader_cache);
+  }
   return true;
 }
 
 bool ModuleController::LoadModule(const DagConfig& dag_config) {
   const std::string work_root = common::WorkRoot();
 
+  // warm the libraries of later modules while earlier components initialize
+  std::vector<std::string> preload_paths;
+  for (auto& module_config : dag_config.module_config()) {
+    std::string load_path;
+    if (module_config.module_library().front() == '/') {
+      load_path = module_config.module_library();
+    } else {
+      load_path =
+          common::GetAbsolutePath(work_root, module_config.module_library());
+    }
+    if (common::PathExists(load_path)) {
+      preload_paths.emplace_back(load_path);
+    }
+  }
+  if (preload_paths.size() > 1) {
+    class_loader_manager_.PreloadLibraries(preload_paths);
+  }
+
+  // phase 1: load libraries and create every component object serially,
+  // phase 2: run the collected Initialize calls through InitComponents
+  std::vector<PendingInit> pending;
   for (auto module_config : dag_config.module_config()) {
     std::string load_path;
     if (module_config.module_library().front() == '/') {
@@ -86,9 +238,18 @@ bool ModuleController::LoadModule(const DagConfig& dag_config) {
       const std::string& class_name = component.class_name();
       std::shared_ptr<ComponentBase> base =
           class_loader_manager_.CreateClassObj<ComponentBase>(class_name);
-      if (base == nullptr || !base->Initialize(component.config())) {
+      if (base == nullptr) {
         return false;
       }
+      PendingInit task;
+      task.name =
+          component.config().name().empty() ? class_name
+                                            : component.config().name();
+      task.depends.assign(component.init_depends().begin(),
+                          component.init_depends().end());
+      auto config = component.config();
+      task.init = [base, config]() { return base->Initialize(config); };
+      pending.emplace_back(std::move(task));
       component_list_.emplace_back(std::move(base));
     }
 
@@ -96,13 +257,22 @@ bool ModuleController::LoadModule(const DagConfig& dag_config) {
       const std::string& class_name = component.class_name();
       std::shared_ptr<ComponentBase> base =
           class_loader_manager_.CreateClassObj<ComponentBase>(class_name);
-      if (base == nullptr || !base->Initialize(component.config())) {
+      if (base == nullptr) {
         return false;
       }
+      PendingInit task;
+      task.name =
+          component.config().name().empty() ? class_name
+                                            : component.config().name();
+      task.depends.assign(component.init_depends().begin(),
+                          component.init_depends().end());
+      auto config = component.config();
+      task.init = [base, config]() { return base->Initialize(config); };
+      pending.emplace_back(std::move(task));
       component_list_.emplace_back(std::move(base));
     }
   }
-  return true;
+  return InitComponents(&pending);
 }
 
 bool ModuleController::LoadModule(const std::string& path) {
@@ -26,6 +26,7 @@
 #include "cyber/message/protobuf_traits.h"
 #include "cyber/message/py_message_traits.h"
 #include "cyber/message/raw_message_traits.h"
+#include "cyber/message/raw_message_view_traits.h"
 
 namespace apollo {
 namespace cyber {
@@ -0,0 +1,129 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_MESSAGE_RAW_MESSAGE_VIEW_H_
+#define CYBER_MESSAGE_RAW_MESSAGE_VIEW_H_
+
+#include <string.h>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "cyber/message/protobuf_factory.h"
+#include "cyber/message/raw_message.h"
+
+namespace apollo {
+namespace cyber {
+namespace message {
+
+// A refcounted slice over an existing payload, wire compatible with
+// RawMessage. Pass-through components (record split, channel mirror)
+// receive a RawMessage, wrap it in a RawMessageView and hand that to a
+// Writer<RawMessageView> on the outgoing channel: the view pins the
+// original buffer instead of copying it, and the transmitters serialize
+// straight from the slice into their own block (for shm, the shared
+// memory block), so the payload is never duplicated in user code.
+//
+// TypeName() deliberately reports RawMessage's type so readers on the
+// other end of the channel are regular RawMessage readers.
+struct RawMessageView {
+  RawMessageView() : data(nullptr), size(0), timestamp(0) {}
+
+  // Share a whole RawMessage, typically straight out of a reader
+  // callback. The RawMessage stays alive as long as the view does.
+  explicit RawMessageView(const std::shared_ptr<const RawMessage> &msg)
+      : holder(msg, msg->message.data()),
+        data(msg->message.data()),
+        size(msg->message.size()),
+        timestamp(msg->timestamp) {}
+
+  // Share a sub-range of a RawMessage, e.g. one record chunk.
+  RawMessageView(const std::shared_ptr<const RawMessage> &msg, size_t offset,
+                 size_t length)
+      : holder(msg, msg->message.data() + offset),
+        data(msg->message.data() + offset),
+        size(length),
+        timestamp(msg->timestamp) {
+    assert(offset + length <= msg->message.size());
+  }
+
+  // Share an arbitrary refcounted buffer, e.g. a block read by the
+  // record file reader.
+  RawMessageView(std::shared_ptr<const void> buffer, const char *buf_data,
+                 size_t buf_size, uint64_t ts = 0)
+      : holder(std::move(buffer), buf_data),
+        data(buf_data),
+        size(buf_size),
+        timestamp(ts) {}
+
+  static void GetDescriptorString(const std::string &type,
+                                  std::string *desc_str) {
+    ProtobufFactory::Instance()->GetDescriptorString(type, desc_str);
+  }
+
+  bool SerializeToArray(void *dst, int dst_size) const {
+    if (dst == nullptr || dst_size < ByteSize()) {
+      return false;
+    }
+
+    memcpy(dst, data, size);
+    return true;
+  }
+
+  bool SerializeToString(std::string *str) const {
+    if (str == nullptr) {
+      return false;
+    }
+    str->assign(data, size);
+    return true;
+  }
+
+  // Parsing has no buffer to borrow from, so it materializes its own
+  // copy; a view that went through a parse behaves like a RawMessage.
+  bool ParseFromArray(const void *src, int src_size) {
+    if (src == nullptr || src_size <= 0) {
+      return false;
+    }
+
+    auto owned = std::make_shared<std::string>(
+        reinterpret_cast<const char *>(src), src_size);
+    holder = std::shared_ptr<const char>(owned, owned->data());
+    data = owned->data();
+    size = owned->size();
+    return true;
+  }
+
+  bool ParseFromString(const std::string &str) {
+    return ParseFromArray(str.data(), static_cast<int>(str.size()));
+  }
+
+  int ByteSize() const { return static_cast<int>(size); }
+
+  static std::string TypeName() { return RawMessage::TypeName(); }
+
+  // Keeps the underlying buffer alive; aliased to the slice start.
+  std::shared_ptr<const char> holder;
+  const char *data;
+  size_t size;
+  uint64_t timestamp;
+};
+
+}  // namespace message
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_MESSAGE_RAW_MESSAGE_VIEW_H_
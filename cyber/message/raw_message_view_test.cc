@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/message/raw_message_view.h"
+
+#include <gtest/gtest.h>
+#include <string.h>
+#include <memory>
+#include <string>
+
+namespace apollo {
+namespace cyber {
+namespace message {
+
+TEST(RawMessageViewTest, shares_buffer_without_copy) {
+  auto msg = std::make_shared<const RawMessage>("pass_through_payload");
+  RawMessageView view(msg);
+
+  EXPECT_EQ(view.data, msg->message.data());
+  EXPECT_EQ(view.ByteSize(), msg->ByteSize());
+  EXPECT_EQ(view.TypeName(), RawMessage::TypeName());
+}
+
+TEST(RawMessageViewTest, keeps_buffer_alive) {
+  RawMessageView view;
+  {
+    auto msg = std::make_shared<const RawMessage>("outlives_the_message");
+    view = RawMessageView(msg);
+  }
+  std::string str;
+  EXPECT_TRUE(view.SerializeToString(&str));
+  EXPECT_EQ(str, "outlives_the_message");
+}
+
+TEST(RawMessageViewTest, slice) {
+  auto msg = std::make_shared<const RawMessage>("head|body|tail");
+  RawMessageView view(msg, 5, 4);
+
+  std::string str;
+  EXPECT_TRUE(view.SerializeToString(&str));
+  EXPECT_EQ(str, "body");
+}
+
+TEST(RawMessageViewTest, serialize_to_array) {
+  auto msg = std::make_shared<const RawMessage>("serialize_to_array");
+  RawMessageView view(msg);
+
+  EXPECT_FALSE(view.SerializeToArray(nullptr, 128));
+  char buf[64] = {0};
+  EXPECT_FALSE(view.SerializeToArray(buf, -1));
+  EXPECT_TRUE(view.SerializeToArray(buf, 64));
+  EXPECT_EQ(memcmp(buf, msg->message.data(), msg->ByteSize()), 0);
+}
+
+TEST(RawMessageViewTest, parse_materializes_copy) {
+  RawMessageView view;
+  EXPECT_FALSE(view.ParseFromArray(nullptr, 1));
+
+  std::string src("parse_from_string");
+  EXPECT_TRUE(view.ParseFromString(src));
+  src.assign(src.size(), 'x');
+
+  std::string str;
+  EXPECT_TRUE(view.SerializeToString(&str));
+  EXPECT_EQ(str, "parse_from_string");
+}
+
+}  // namespace message
+}  // namespace cyber
+}  // namespace apollo
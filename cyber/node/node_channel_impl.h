@@ -47,11 +47,17 @@ struct ReaderConfig {
   ReaderConfig(const ReaderConfig& other)
       : channel_name(other.channel_name),
         qos_profile(other.qos_profile),
-        pending_queue_size(other.pending_queue_size) {}
+        pending_queue_size(other.pending_queue_size),
+        inline_executor(other.inline_executor),
+        inline_budget_us(other.inline_budget_us) {}
 
   std::string channel_name;
   proto::QosProfile qos_profile;
   uint32_t pending_queue_size;
+  // run the callback directly on the dispatcher thread instead of
+  // waking a croutine; only for callbacks the author declares wait-free
+  bool inline_executor = false;
+  uint64_t inline_budget_us = DEFAULT_INLINE_BUDGET_US;
 };
 
 class NodeChannelImpl {
@@ -108,7 +114,9 @@ class NodeChannelImpl {
   template <typename MessageT>
   auto CreateReader(const proto::RoleAttributes& role_attr,
                     const CallbackFunc<MessageT>& reader_func,
-                    uint32_t pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE)
+                    uint32_t pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE,
+                    bool inline_executor = false,
+                    uint64_t inline_budget_us = DEFAULT_INLINE_BUDGET_US)
       -> std::shared_ptr<Reader<MessageT>>;
 
   template <typename MessageT>
@@ -170,14 +178,17 @@ auto NodeChannelImpl::CreateReader(const ReaderConfig& config,
   proto::RoleAttributes role_attr;
   role_attr.set_channel_name(config.channel_name);
   role_attr.mutable_qos_profile()->CopyFrom(config.qos_profile);
-  return this->template CreateReader<MessageT>(role_attr, reader_func,
-                                               config.pending_queue_size);
+  return this->template CreateReader<MessageT>(
+      role_attr, reader_func, config.pending_queue_size,
+      config.inline_executor, config.inline_budget_us);
 }
 
 template <typename MessageT>
 auto NodeChannelImpl::CreateReader(const proto::RoleAttributes& role_attr,
                                    const CallbackFunc<MessageT>& reader_func,
-                                   uint32_t pending_queue_size)
+                                   uint32_t pending_queue_size,
+                                   bool inline_executor,
+                                   uint64_t inline_budget_us)
     -> std::shared_ptr<Reader<MessageT>> {
   if (!role_attr.has_channel_name() || role_attr.channel_name().empty()) {
     AERROR << "Can't create a reader with empty channel name!";
@@ -192,8 +203,9 @@ auto NodeChannelImpl::CreateReader(const proto::RoleAttributes& role_attr,
     reader_ptr =
         std::make_shared<blocker::IntraReader<MessageT>>(new_attr, reader_func);
   } else {
-    reader_ptr = std::make_shared<Reader<MessageT>>(new_attr, reader_func,
-                                                    pending_queue_size);
+    reader_ptr = std::make_shared<Reader<MessageT>>(
+        new_attr, reader_func, pending_queue_size, inline_executor,
+        inline_budget_us);
   }
 
   RETURN_VAL_IF_NULL(reader_ptr, nullptr);
@@ -18,6 +18,7 @@
 #define CYBER_NODE_READER_H_
 
 #include <algorithm>
+#include <atomic>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -47,6 +48,9 @@ using proto::RoleType;
 
 const uint32_t DEFAULT_PENDING_QUEUE_SIZE = 1;
 
+// budget for a callback running inline on the dispatcher thread
+const uint64_t DEFAULT_INLINE_BUDGET_US = 100;
+
 template <typename MessageT>
 class Reader : public ReaderBase {
  public:
@@ -59,7 +63,9 @@ class Reader : public ReaderBase {
 
   explicit Reader(const proto::RoleAttributes& role_attr,
                   const CallbackFunc<MessageT>& reader_func = nullptr,
-                  uint32_t pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE);
+                  uint32_t pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE,
+                  bool inline_executor = false,
+                  uint64_t inline_budget_us = DEFAULT_INLINE_BUDGET_US);
   virtual ~Reader();
 
   bool Init() override;
@@ -92,10 +98,20 @@ class Reader : public ReaderBase {
   void LeaveTheTopology();
   void OnChannelChange(const proto::ChangeMsg& change_msg);
 
+  // runs the callback directly on the dispatcher thread, guarded by the
+  // inline budget
+  void InlineDeliver(const std::shared_ptr<MessageT>& msg);
+
   CallbackFunc<MessageT> reader_func_;
   ReceiverPtr receiver_ = nullptr;
   std::string croutine_name_;
 
+  // only set for callbacks the author declared wait-free; such readers
+  // skip the DataVisitor and croutine wakeup entirely
+  bool inline_executor_ = false;
+  uint64_t inline_budget_us_ = DEFAULT_INLINE_BUDGET_US;
+  std::atomic<uint64_t> inline_over_budget_num_ = {0};
+
   BlockerPtr blocker_ = nullptr;
 
   ChangeConnection change_conn_;
@@ -105,10 +121,13 @@ class Reader : public ReaderBase {
 template <typename MessageT>
 Reader<MessageT>::Reader(const proto::RoleAttributes& role_attr,
                          const CallbackFunc<MessageT>& reader_func,
-                         uint32_t pending_queue_size)
+                         uint32_t pending_queue_size, bool inline_executor,
+                         uint64_t inline_budget_us)
     : ReaderBase(role_attr),
       pending_queue_size_(pending_queue_size),
-      reader_func_(reader_func) {
+      reader_func_(reader_func),
+      inline_executor_(inline_executor),
+      inline_budget_us_(inline_budget_us) {
   blocker_.reset(new blocker::Blocker<MessageT>(blocker::BlockerAttr(
       role_attr.qos_profile().depth(), role_attr.channel_name())));
 }
@@ -135,6 +154,25 @@ bool Reader<MessageT>::Init() {
   if (init_.exchange(true)) {
     return true;
   }
+  if (inline_executor_) {
+    // the callback was declared wait-free, so it runs directly on the
+    // dispatcher thread: no DataVisitor, no croutine wakeup. A dedicated
+    // receiver is used because the shared one dispatches into the data
+    // cache for the croutine readers of this channel.
+    receiver_ = transport::Transport::Instance()->CreateReceiver<MessageT>(
+        role_attr_, [this](const std::shared_ptr<MessageT>& msg,
+                           const transport::MessageInfo& msg_info,
+                           const proto::RoleAttributes& reader_attr) {
+          (void)msg_info;
+          (void)reader_attr;
+          this->InlineDeliver(msg);
+        });
+    this->role_attr_.set_id(receiver_->id().HashValue());
+    channel_manager_ =
+        service_discovery::TopologyManager::Instance()->channel_manager();
+    JoinTheTopology();
+    return true;
+  }
   std::function<void(const std::shared_ptr<MessageT>&)> func;
   if (reader_func_ != nullptr) {
     func = [this](const std::shared_ptr<MessageT>& msg) {
@@ -147,7 +185,8 @@ bool Reader<MessageT>::Init() {
   auto sched = scheduler::Instance();
   croutine_name_ = role_attr_.node_name() + "_" + role_attr_.channel_name();
   auto dv = std::make_shared<data::DataVisitor<MessageT>>(
-      role_attr_.channel_id(), pending_queue_size_);
+      role_attr_.channel_id(), pending_queue_size_,
+      role_attr_.qos_profile().latency_budget_ms());
   // Using factory to wrap templates.
   croutine::RoutineFactory factory =
       croutine::CreateRoutineFactory<MessageT>(std::move(func), dv);
@@ -166,6 +205,26 @@ bool Reader<MessageT>::Init() {
   return true;
 }
 
+template <typename MessageT>
+void Reader<MessageT>::InlineDeliver(const std::shared_ptr<MessageT>& msg) {
+  const auto start = Time::Now();
+  Enqueue(msg);
+  if (reader_func_ != nullptr) {
+    reader_func_(msg);
+  }
+  const uint64_t elapsed_us = (Time::Now() - start).ToNanosecond() / 1000;
+  if (elapsed_us > inline_budget_us_) {
+    const uint64_t num = inline_over_budget_num_.fetch_add(1) + 1;
+    // the dispatcher thread serves every channel, so a slow callback
+    // here stalls other readers; surface it, but not per message
+    if (num == 1 || num % 1000 == 0) {
+      AWARN << "inline callback of channel " << role_attr_.channel_name()
+            << " took " << elapsed_us << "us, budget " << inline_budget_us_
+            << "us, over-budget count: " << num;
+    }
+  }
+}
+
 template <typename MessageT>
 void Reader<MessageT>::Shutdown() {
   if (!init_.exchange(false)) {
@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/common/log.h"
 #include "cyber/node/writer_base.h"
 #include "cyber/proto/topology_change.pb.h"
@@ -30,6 +31,9 @@
 namespace apollo {
 namespace cyber {
 
+// messages handed out by Writer::AcquireMessage per channel
+const uint32_t DEFAULT_WRITER_POOL_SIZE = 16;
+
 template <typename MessageT>
 class Writer : public WriterBase {
  public:
@@ -46,6 +50,16 @@ class Writer : public WriterBase {
   virtual bool Write(const MessageT& msg);
   virtual bool Write(const std::shared_ptr<MessageT>& msg_ptr);
 
+  /**
+   * @brief acquire a message backed by the writer's object pool. The
+   * message returns to the pool once the transports and every reader
+   * holding it have released their references, so a steady-state
+   * publish path that fills and writes pooled messages allocates
+   * nothing. The message keeps the contents of its previous use: set
+   * every field (or Clear() a proto) before writing it.
+   */
+  virtual std::shared_ptr<MessageT> AcquireMessage();
+
   bool HasReader() override;
   void GetReaders(std::vector<proto::RoleAttributes>* readers) override;
 
@@ -56,6 +70,9 @@ class Writer : public WriterBase {
 
   TransmitterPtr transmitter_;
 
+  // created on the first AcquireMessage call
+  std::shared_ptr<base::CCObjectPool<MessageT>> msg_pool_;
+
   ChangeConnection change_conn_;
   service_discovery::ChannelManagerPtr channel_manager_;
 };
@@ -118,6 +135,27 @@ bool Writer<MessageT>::Write(const std::shared_ptr<MessageT>& msg_ptr) {
   return transmitter_->Transmit(msg_ptr);
 }
 
+template <typename MessageT>
+std::shared_ptr<MessageT> Writer<MessageT>::AcquireMessage() {
+  {
+    std::lock_guard<std::mutex> g(lock_);
+    if (msg_pool_ == nullptr) {
+      msg_pool_ = std::make_shared<base::CCObjectPool<MessageT>>(
+          DEFAULT_WRITER_POOL_SIZE);
+      msg_pool_->ConstructAll();
+    }
+  }
+  auto msg = msg_pool_->GetObject();
+  if (msg == nullptr) {
+    // every pooled message is still referenced downstream; fall back to
+    // the heap rather than blocking the publish path
+    AWARN << "message pool of channel " << role_attr_.channel_name()
+          << " is exhausted, allocating from the heap.";
+    msg = std::make_shared<MessageT>();
+  }
+  return msg;
+}
+
 template <typename MessageT>
 void Writer<MessageT>::JoinTheTopology() {
   // add listener
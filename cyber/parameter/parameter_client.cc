@@ -32,10 +32,60 @@ ParameterClient::ParameterClient(const std::shared_ptr<Node>& node,
 
   list_parameters_client_ = node_->CreateClient<NodeName, Params>(
       FixParameterServiceName(service_node_name, LIST_PARAMETERS_SERVICE_NAME));
+
+  param_event_reader_ = node_->CreateReader<ParamEvent>(
+      FixParameterServiceName(service_node_name, PARAMETER_EVENTS_CHANNEL_NAME),
+      [this](const std::shared_ptr<ParamEvent>& event) {
+        OnParamEvent(event);
+      });
+}
+
+void ParameterClient::OnParamEvent(const std::shared_ptr<ParamEvent>& event) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (!cache_valid_ || event->version() <= cache_version_) {
+    return;
+  }
+  if (event->version() == cache_version_ + 1) {
+    param_cache_[event->param().name()] = event->param();
+    cache_version_ = event->version();
+  } else {
+    // Missed at least one change; resync lazily on the next read.
+    cache_valid_ = false;
+  }
+}
+
+bool ParameterClient::SyncCache() {
+  auto request = std::make_shared<NodeName>();
+  request->set_value(node_->Name());
+  auto response = list_parameters_client_->SendRequest(request);
+  if (response == nullptr) {
+    return false;
+  }
+  param_cache_.clear();
+  for (auto& param : response->param()) {
+    param_cache_[param.name()] = param;
+  }
+  cache_version_ = response->version();
+  cache_valid_ = true;
+  return true;
 }
 
 bool ParameterClient::GetParameter(const std::string& param_name,
                                    Parameter* parameter) {
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    if (!cache_valid_) {
+      SyncCache();
+    }
+    if (cache_valid_) {
+      auto ite = param_cache_.find(param_name);
+      if (ite != param_cache_.end()) {
+        parameter->FromProtoParam(ite->second);
+        return true;
+      }
+    }
+  }
+  // Cache miss or unsynced cache: keep the original service semantics.
   auto request = std::make_shared<ParamName>();
   request->set_value(param_name);
   auto response = get_parameter_client_->SendRequest(request);
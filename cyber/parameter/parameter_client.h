@@ -18,9 +18,12 @@
 #define CYBER_PARAMETER_PARAMETER_CLIENT_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "cyber/node/reader.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/client.h"
@@ -37,6 +40,7 @@ class ParameterClient {
   using ParamName = apollo::cyber::proto::ParamName;
   using BoolResult = apollo::cyber::proto::BoolResult;
   using Params = apollo::cyber::proto::Params;
+  using ParamEvent = apollo::cyber::proto::ParamEvent;
   using GetParameterClient = Client<ParamName, Param>;
   using SetParameterClient = Client<Param, BoolResult>;
   using ListParametersClient = Client<NodeName, Params>;
@@ -52,6 +56,10 @@ class ParameterClient {
   /**
    * @brief Get the Parameter object
    *
+   * Reads are served from a local cache kept fresh by the server's
+   * parameter_events channel; in the steady state no service round-trip
+   * is made. A cache miss or a stale cache falls back to the service.
+   *
    * @param param_name
    * @param parameter the pointer to store
    * @return true
@@ -80,10 +88,24 @@ class ParameterClient {
   bool ListParameters(std::vector<Parameter>* parameters);
 
  private:
+  // Apply one change published by the server to the cache.
+  void OnParamEvent(const std::shared_ptr<ParamEvent>& event);
+  // Rebuild the cache from a full snapshot. cache_mutex_ must be held.
+  // Returns false if the list service call failed.
+  bool SyncCache();
+
   std::shared_ptr<Node> node_;
   std::shared_ptr<GetParameterClient> get_parameter_client_;
   std::shared_ptr<SetParameterClient> set_parameter_client_;
   std::shared_ptr<ListParametersClient> list_parameters_client_;
+  std::shared_ptr<Reader<ParamEvent>> param_event_reader_;
+
+  std::mutex cache_mutex_;
+  std::unordered_map<std::string, Param> param_cache_;
+  // Server version the cache reflects; invalidated when an event gap
+  // shows that changes were missed.
+  uint64_t cache_version_ = 0;
+  bool cache_valid_ = false;
 };
 
 }  // namespace cyber
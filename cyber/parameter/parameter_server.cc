@@ -24,6 +24,9 @@ namespace cyber {
 ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
     : node_(node) {
   auto name = node_->Name();
+  param_event_writer_ = node_->CreateWriter<ParamEvent>(
+      FixParameterServiceName(name, PARAMETER_EVENTS_CHANNEL_NAME));
+
   get_parameter_service_ = node_->CreateService<ParamName, Param>(
       FixParameterServiceName(name, GET_PARAMETER_SERVICE_NAME),
       [this](const std::shared_ptr<ParamName>& request,
@@ -42,6 +45,7 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
              std::shared_ptr<BoolResult>& response) {
         std::lock_guard<std::mutex> lock(param_map_mutex_);
         param_map_[request->name()] = *request;
+        EmitParamEvent(*request);
         response->set_value(true);
       });
 
@@ -54,12 +58,25 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
           auto param = response->add_param();
           param->CopyFrom(item.second);
         }
+        response->set_version(version_);
       });
 }
 
+void ParameterServer::EmitParamEvent(const Param& param) {
+  ++version_;
+  if (param_event_writer_ == nullptr) {
+    return;
+  }
+  auto event = std::make_shared<ParamEvent>();
+  event->mutable_param()->CopyFrom(param);
+  event->set_version(version_);
+  param_event_writer_->Write(event);
+}
+
 void ParameterServer::SetParameter(const Parameter& parameter) {
   std::lock_guard<std::mutex> lock(param_map_mutex_);
   param_map_[parameter.Name()] = parameter.ToProtoParam();
+  EmitParamEvent(param_map_[parameter.Name()]);
 }
 
 bool ParameterServer::GetParameter(const std::string& parameter_name,
@@ -22,6 +22,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "cyber/node/writer.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/service.h"
@@ -38,6 +39,7 @@ class ParameterServer {
   using ParamName = apollo::cyber::proto::ParamName;
   using BoolResult = apollo::cyber::proto::BoolResult;
   using Params = apollo::cyber::proto::Params;
+  using ParamEvent = apollo::cyber::proto::ParamEvent;
   /**
    * @brief Construct a new ParameterServer object
    *
@@ -74,9 +76,17 @@ class ParameterServer {
   std::shared_ptr<Service<ParamName, Param>> get_parameter_service_;
   std::shared_ptr<Service<Param, BoolResult>> set_parameter_service_;
   std::shared_ptr<Service<NodeName, Params>> list_parameters_service_;
+  std::shared_ptr<Writer<ParamEvent>> param_event_writer_;
+
+  // Publish one change on the parameter_events channel.
+  // param_map_mutex_ must be held.
+  void EmitParamEvent(const Param& param);
 
   std::mutex param_map_mutex_;
   std::unordered_map<std::string, Param> param_map_;
+  // Bumped on every set; lets clients keep a versioned local cache and
+  // detect missed events.
+  uint64_t version_ = 0;
 };
 
 }  // namespace cyber
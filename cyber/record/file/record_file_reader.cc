@@ -129,6 +129,30 @@ bool RecordFileReader::ReadSection(Section* section) {
   return true;
 }
 
+bool RecordFileReader::ReadSectionRaw(int64_t size, std::string* data) {
+  if (size < 0 || size > INT_MAX) {
+    AERROR << "Size value is out of range, size: " << size;
+    return false;
+  }
+  data->resize(static_cast<size_t>(size));
+  int64_t offset = 0;
+  while (offset < size) {
+    const ssize_t count =
+        read(fd_, &(*data)[offset], static_cast<size_t>(size - offset));
+    if (count < 0) {
+      AERROR << "Read fd failed, fd_: " << fd_ << ", errno: " << errno;
+      return false;
+    }
+    if (count == 0) {
+      end_of_file_ = true;
+      AERROR << "Reach file end prematurely, file: " << path_;
+      return false;
+    }
+    offset += count;
+  }
+  return true;
+}
+
 bool RecordFileReader::SkipSection(int64_t size) {
   int64_t pos = CurrentPosition();
   if (size > INT64_MAX - pos) {
@@ -49,6 +49,9 @@ class RecordFileReader : public RecordFileBase {
   bool Reset();
   bool ReadSection(Section* section);
   bool SkipSection(int64_t size);
+  // Reads the raw bytes of a section body without parsing them, so the
+  // caller can hand decoding to another thread.
+  bool ReadSectionRaw(int64_t size, std::string* data);
   template <typename T>
   bool ReadSection(int64_t size, T* message);
   bool ReadIndex();
@@ -144,6 +144,7 @@ TEST(RecordFileTest, TestOneMessageFile) {
   ASSERT_EQ(ckh2.end_time(), 1e9);
   ASSERT_EQ(ckh2.raw_size(), 10);
   ASSERT_EQ(ckh2.message_number(), 1);
+  ASSERT_TRUE(ckh2.has_crc32());
 
   // read chunk body section
   ASSERT_TRUE(rfr->ReadSection(&sec));
@@ -210,6 +211,31 @@ TEST(RecordFileTest, TestOneChunkFile) {
   ASSERT_EQ(1e9, rfw->GetHeader().begin_time());
   ASSERT_EQ(3e9, rfw->GetHeader().end_time());
   ASSERT_EQ(3, rfw->GetHeader().message_number());
+  delete rfw;
+
+  // the index carries per-channel stamp ranges and the chunk crc lane
+  RecordFileReader* rfr = new RecordFileReader();
+  ASSERT_TRUE(rfr->Open(TEST_FILE));
+  ASSERT_TRUE(rfr->ReadIndex());
+  Index index = rfr->GetIndex();
+  for (int i = 0; i < index.indexes_size(); ++i) {
+    SingleIndex* single_index = index.mutable_indexes(i);
+    if (single_index->type() == SectionType::SECTION_CHANNEL) {
+      ChannelCache* cache = single_index->mutable_channel_cache();
+      if (cache->name() == CHAN_1) {
+        ASSERT_EQ(2, cache->message_number());
+        ASSERT_EQ(1e9, cache->begin_time());
+        ASSERT_EQ(3e9, cache->end_time());
+      } else if (cache->name() == CHAN_2) {
+        ASSERT_EQ(1, cache->message_number());
+        ASSERT_EQ(2e9, cache->begin_time());
+        ASSERT_EQ(2e9, cache->end_time());
+      }
+    } else if (single_index->type() == SectionType::SECTION_CHUNK_HEADER) {
+      ASSERT_TRUE(single_index->chunk_header_cache().has_crc32());
+    }
+  }
+  delete rfr;
 }
 
 }  // namespace record
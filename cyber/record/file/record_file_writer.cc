@@ -18,7 +18,10 @@
 
 #include <fcntl.h>
 
+#include <algorithm>
+
 #include "cyber/common/file.h"
+#include "cyber/record/file/crc32.h"
 #include "cyber/time/time.h"
 
 namespace apollo {
@@ -43,7 +46,7 @@ bool RecordFileWriter::Open(const std::string& path) {
     return false;
   }
   chunk_active_.reset(new Chunk());
-  chunk_flush_.reset(new Chunk());
+  flush_queue_.clear();
   is_writing_ = true;
   flush_thread_ = std::make_shared<std::thread>([this]() { this->Flush(); });
   if (flush_thread_ == nullptr) {
@@ -55,20 +58,19 @@ bool RecordFileWriter::Open(const std::string& path) {
 
 void RecordFileWriter::Close() {
   if (is_writing_) {
-    // wait for the flush operation that may exist now
-    while (!chunk_flush_->empty()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
-
-    // last swap
+    // enqueue the last partially filled chunk
     {
       std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-      chunk_flush_.swap(chunk_active_);
+      if (!chunk_active_->empty()) {
+        flush_queue_.emplace_back(std::move(chunk_active_));
+        chunk_active_.reset(new Chunk());
+        flush_backlog_.store(flush_queue_.size());
+      }
       flush_cv_.notify_one();
     }
 
-    // wait for the last flush opertation
-    while (!chunk_flush_->empty()) {
+    // wait until the flush thread has drained the queue
+    while (flush_backlog_.load() > 0) {
       std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 
@@ -117,6 +119,11 @@ bool RecordFileWriter::WriteIndex() {
         channel_cache->set_message_number(
             channel_message_number_map_[channel_cache->name()]);
       }
+      auto range = channel_time_range_map_.find(channel_cache->name());
+      if (range != channel_time_range_map_.end()) {
+        channel_cache->set_begin_time(range->second.first);
+        channel_cache->set_end_time(range->second.second);
+      }
     }
   }
   header_.set_index_position(CurrentPosition());
@@ -149,7 +156,16 @@ bool RecordFileWriter::WriteChannel(const Channel& channel) {
 bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
                                   const ChunkBody& chunk_body) {
   std::lock_guard<std::mutex> lock(mutex_);
-  if (!WriteSection<ChunkHeader>(chunk_header)) {
+  // serialize the body once so its checksum covers the exact on-disk bytes
+  std::string body_str;
+  if (!chunk_body.SerializeToString(&body_str)) {
+    AERROR << "Serialize chunk body fail";
+    return false;
+  }
+  const uint32_t body_crc32 = Crc32(body_str.data(), body_str.size());
+  ChunkHeader chunk_header_with_crc = chunk_header;
+  chunk_header_with_crc.set_crc32(body_crc32);
+  if (!WriteSection<ChunkHeader>(chunk_header_with_crc)) {
     AERROR << "Write chunk header fail";
     return false;
   }
@@ -161,8 +177,9 @@ bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
   chunk_header_cache->set_end_time(chunk_header.end_time());
   chunk_header_cache->set_message_number(chunk_header.message_number());
   chunk_header_cache->set_raw_size(chunk_header.raw_size());
+  chunk_header_cache->set_crc32(body_crc32);
   single_index->set_allocated_chunk_header_cache(chunk_header_cache);
-  if (!WriteSection<ChunkBody>(chunk_body)) {
+  if (!WriteSectionRaw(SectionType::SECTION_CHUNK_BODY, body_str)) {
     AERROR << "Write chunk body fail";
     return false;
   }
@@ -191,6 +208,15 @@ bool RecordFileWriter::WriteMessage(const SingleMessage& message) {
     channel_message_number_map_.insert(
         std::make_pair(message.channel_name(), 1));
   }
+  auto range = channel_time_range_map_.find(message.channel_name());
+  if (range != channel_time_range_map_.end()) {
+    range->second.first = std::min(range->second.first, message.time());
+    range->second.second = std::max(range->second.second, message.time());
+  } else {
+    channel_time_range_map_.insert(
+        std::make_pair(message.channel_name(),
+                       std::make_pair(message.time(), message.time())));
+  }
   bool need_flush = false;
   if (header_.chunk_interval() > 0 &&
       message.time() - chunk_active_->header_.begin_time() >
@@ -206,31 +232,79 @@ bool RecordFileWriter::WriteMessage(const SingleMessage& message) {
   }
   {
     std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    chunk_flush_.swap(chunk_active_);
+    if (flush_queue_.size() >= kFlushQueueCapacity) {
+      // the disk cannot keep up; drop the oldest chunk rather than stall
+      // the publishing path, and account for it
+      flush_queue_.pop_front();
+      dropped_chunk_num_.fetch_add(1);
+      AWARN << "Flush queue is full, drop the oldest chunk, file: " << path_
+            << ", dropped: " << dropped_chunk_num_.load();
+    }
+    flush_queue_.emplace_back(std::move(chunk_active_));
+    chunk_active_.reset(new Chunk());
+    flush_backlog_.store(flush_queue_.size());
     flush_cv_.notify_one();
   }
   return true;
 }
 
 void RecordFileWriter::Flush() {
-  while (is_writing_) {
-    std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    flush_cv_.wait(flush_lock,
-                   [this] { return !chunk_flush_->empty() || !is_writing_; });
-    if (!is_writing_) {
-      break;
-    }
-    if (chunk_flush_->empty()) {
-      continue;
+  while (true) {
+    std::unique_ptr<Chunk> chunk = nullptr;
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      flush_cv_.wait(flush_lock,
+                     [this] { return !flush_queue_.empty() || !is_writing_; });
+      if (flush_queue_.empty()) {
+        if (!is_writing_) {
+          break;
+        }
+        continue;
+      }
+      chunk = std::move(flush_queue_.front());
+      flush_queue_.pop_front();
     }
-    if (!WriteChunk(chunk_flush_->header_, chunk_flush_->body_)) {
+    // the disk write happens outside flush_mutex_, so WriteMessage never
+    // waits on I/O when it hands over the next full chunk
+    if (!WriteChunk(chunk->header_, chunk->body_)) {
       AERROR << "Write chunk fail.";
     }
-    chunk_flush_->clear();
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      flush_backlog_.store(flush_queue_.size());
+    }
   }
   return;
 }
 
+bool RecordFileWriter::WriteSectionRaw(SectionType type,
+                                       const std::string& data) {
+  Section section = {type, static_cast<int64_t>(data.size())};
+  ssize_t count = write(fd_, &section, sizeof(section));
+  if (count < 0) {
+    AERROR << "Write fd failed, fd: " << fd_ << ", errno: " << errno;
+    return false;
+  }
+  if (count != sizeof(section)) {
+    AERROR << "Write fd failed, fd: " << fd_
+           << ", expect count: " << sizeof(section)
+           << ", actual count: " << count;
+    return false;
+  }
+  count = write(fd_, data.data(), data.size());
+  if (count < 0) {
+    AERROR << "Write fd failed, fd: " << fd_ << ", errno: " << errno;
+    return false;
+  }
+  if (count != static_cast<ssize_t>(data.size())) {
+    AERROR << "Write fd failed, fd: " << fd_
+           << ", expect count: " << data.size() << ", actual count: " << count;
+    return false;
+  }
+  header_.set_size(CurrentPosition());
+  return true;
+}
+
 uint64_t RecordFileWriter::GetMessageNumber(
     const std::string& channel_name) const {
   auto search = channel_message_number_map_.find(channel_name);
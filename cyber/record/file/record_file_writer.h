@@ -20,7 +20,9 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/text_format.h>
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -87,19 +89,36 @@ class RecordFileWriter : public RecordFileBase {
   bool WriteMessage(const SingleMessage& message);
   uint64_t GetMessageNumber(const std::string& channel_name) const;
 
+  // number of full chunks waiting for the flush thread
+  uint64_t FlushBacklog() const { return flush_backlog_.load(); }
+  // number of chunks discarded because the flush queue was full
+  uint64_t DroppedChunkNumber() const { return dropped_chunk_num_.load(); }
+
  private:
   bool WriteChunk(const ChunkHeader& chunk_header, const ChunkBody& chunk_body);
   template <typename T>
   bool WriteSection(const T& message);
+  bool WriteSectionRaw(SectionType type, const std::string& data);
   bool WriteIndex();
   void Flush();
+
+  // bound of the flush queue; beyond it the oldest chunk is dropped so a
+  // disk hiccup stalls neither the publisher nor WriteMessage
+  static const size_t kFlushQueueCapacity = 16;
+
   bool is_writing_ = false;
   std::unique_ptr<Chunk> chunk_active_ = nullptr;
-  std::unique_ptr<Chunk> chunk_flush_ = nullptr;
+  std::deque<std::unique_ptr<Chunk>> flush_queue_;
   std::shared_ptr<std::thread> flush_thread_ = nullptr;
   std::mutex flush_mutex_;
   std::condition_variable flush_cv_;
+  std::atomic<uint64_t> flush_backlog_ = {0};
+  std::atomic<uint64_t> dropped_chunk_num_ = {0};
   std::unordered_map<std::string, uint64_t> channel_message_number_map_;
+  // per-channel min/max message stamps, written into the channel caches of
+  // the index section at close
+  std::unordered_map<std::string, std::pair<uint64_t, uint64_t>>
+      channel_time_range_map_;
 };
 
 template <typename T>
@@ -36,7 +36,10 @@ class HeaderBuilder {
 
  private:
   static const uint32_t MAJOR_VERSION_ = 1;
-  static const uint32_t MINOR_VERSION_ = 0;
+  // minor version 1 adds the integrity lanes: per-chunk crc32 in the chunk
+  // headers and index, and per-channel min/max stamps in the channel
+  // caches; the new fields are optional, so 1.0 readers still parse them
+  static const uint32_t MINOR_VERSION_ = 1;
   static const CompressType COMPRESS_TYPE_ = CompressType::COMPRESS_NONE;
   static const uint64_t CHUNK_INTERVAL_ = 20 * 1000 * 1000 * 1000ULL;    // 20s
   static const uint64_t SEGMENT_INTERVAL_ = 60 * 1000 * 1000 * 1000ULL;  // 60s
@@ -16,6 +16,7 @@
 
 #include "cyber/record/record_reader.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace apollo {
@@ -38,6 +39,19 @@ RecordReader::RecordReader(const std::string& file) {
     index_ = file_reader_->GetIndex();
     for (int i = 0; i < index_.indexes_size(); ++i) {
       auto single_idx = index_.mutable_indexes(i);
+      if (single_idx->type() == SectionType::SECTION_CHUNK_HEADER) {
+        if (!single_idx->has_chunk_header_cache()) {
+          continue;
+        }
+        // the recorded position is right after the chunk header section,
+        // i.e. at the start of the matching chunk body section
+        ChunkIndexEntry entry;
+        entry.begin_time = single_idx->chunk_header_cache().begin_time();
+        entry.end_time = single_idx->chunk_header_cache().end_time();
+        entry.position = static_cast<int64_t>(single_idx->position());
+        chunk_index_.push_back(entry);
+        continue;
+      }
       if (single_idx->type() != SectionType::SECTION_CHANNEL) {
         continue;
       }
@@ -54,12 +68,38 @@ RecordReader::RecordReader(const std::string& file) {
 }
 
 void RecordReader::Reset() {
+  if (next_chunk_.valid()) {
+    next_chunk_.wait();
+    next_chunk_ = std::future<std::shared_ptr<proto::ChunkBody>>();
+  }
   file_reader_->Reset();
   reach_end_ = false;
+  indexed_seek_done_ = false;
   message_index_ = 0;
   chunk_ = ChunkBody();
 }
 
+bool RecordReader::SeekToTime(uint64_t begin_time) {
+  if (chunk_index_.empty()) {
+    return false;
+  }
+  // first chunk whose span may contain begin_time; entries are in file
+  // order, which is time order for the writer
+  auto it = std::lower_bound(
+      chunk_index_.begin(), chunk_index_.end(), begin_time,
+      [](const ChunkIndexEntry& entry, uint64_t time) {
+        return entry.end_time < time;
+      });
+  if (it == chunk_index_.end()) {
+    return false;
+  }
+  if (!file_reader_->SetPosition(it->position)) {
+    AERROR << "Seek to chunk failed, position: " << it->position;
+    return false;
+  }
+  return true;
+}
+
 std::set<std::string> RecordReader::GetChannelList() const {
   std::set<std::string> channel_list;
   for (auto& item : channel_info_) {
@@ -78,6 +118,15 @@ bool RecordReader::ReadMessage(RecordMessage* message, uint64_t begin_time,
     return false;
   }
 
+  if (!indexed_seek_done_) {
+    indexed_seek_done_ = true;
+    if (begin_time > header_.begin_time()) {
+      // jump straight to the first chunk that can contain begin_time
+      // instead of scanning every chunk from the front
+      SeekToTime(begin_time);
+    }
+  }
+
   while (message_index_ < chunk_.messages_size()) {
     const auto& next_message = chunk_.messages(message_index_);
     uint64_t time = next_message.time();
@@ -106,6 +155,47 @@ bool RecordReader::ReadMessage(RecordMessage* message, uint64_t begin_time,
 }
 
 bool RecordReader::ReadNextChunk(uint64_t begin_time, uint64_t end_time) {
+  std::shared_ptr<ChunkBody> chunk;
+  if (lookahead_enabled_ && next_chunk_.valid()) {
+    chunk = next_chunk_.get();
+    if (chunk == nullptr) {
+      return false;
+    }
+  } else {
+    std::string raw;
+    if (!ReadNextChunkRaw(begin_time, end_time, &raw)) {
+      return false;
+    }
+    chunk = std::make_shared<ChunkBody>();
+    if (!chunk->ParseFromString(raw)) {
+      AERROR << "Failed to parse chunk body section.";
+      return false;
+    }
+  }
+  chunk_ = std::move(*chunk);
+  if (lookahead_enabled_) {
+    // Stage the upcoming chunk: its raw bytes are read now, while the
+    // file cursor is right behind the current chunk, and parsed in the
+    // background while the current chunk is being consumed.
+    auto next_raw = std::make_shared<std::string>();
+    if (ReadNextChunkRaw(begin_time, end_time, next_raw.get())) {
+      next_chunk_ = std::async(
+          std::launch::async,
+          [next_raw]() -> std::shared_ptr<ChunkBody> {
+            auto parsed = std::make_shared<ChunkBody>();
+            if (!parsed->ParseFromString(*next_raw)) {
+              AERROR << "Failed to parse chunk body section.";
+              return nullptr;
+            }
+            return parsed;
+          });
+    }
+  }
+  return true;
+}
+
+bool RecordReader::ReadNextChunkRaw(uint64_t begin_time, uint64_t end_time,
+                                    std::string* raw) {
   bool skip_next_chunk_body = false;
   while (!reach_end_) {
     Section section;
@@ -149,7 +239,7 @@ bool RecordReader::ReadNextChunk(uint64_t begin_time, uint64_t end_time) {
           skip_next_chunk_body = false;
           break;
         }
-        if (!file_reader_->ReadSection<ChunkBody>(section.size, &chunk_)) {
+        if (!file_reader_->ReadSectionRaw(section.size, raw)) {
           AERROR << "Failed to read chunk body section.";
           return false;
         }
@@ -17,10 +17,12 @@
 #ifndef CYBER_RECORD_RECORD_READER_H_
 #define CYBER_RECORD_RECORD_READER_H_
 
+#include <future>
 #include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "cyber/proto/record.pb.h"
 #include "cyber/record/file/record_file_reader.h"
@@ -45,6 +47,11 @@ class RecordReader : public RecordBase {
                    uint64_t end_time = UINT64_MAX);
   void Reset();
 
+  // Pre-decompresses the chunk after the current one on a background
+  // thread while the current chunk is being consumed. Only safe when
+  // every ReadMessage call uses the same time range, as the player does.
+  void EnableChunkLookahead() { lookahead_enabled_ = true; }
+
   uint64_t GetMessageNumber(const std::string& channel_name) const override;
 
   const std::string& GetMessageType(
@@ -59,10 +66,26 @@ class RecordReader : public RecordBase {
   const ChannelInfoMap& channel_info() const { return channel_info_; }
 
  private:
+  // position of one chunk in the file together with its time span, built
+  // once from the index section so seeks need not scan from the front
+  struct ChunkIndexEntry {
+    uint64_t begin_time = 0;
+    uint64_t end_time = 0;
+    int64_t position = 0;
+  };
+
   bool ReadNextChunk(uint64_t begin_time, uint64_t end_time);
+  bool ReadNextChunkRaw(uint64_t begin_time, uint64_t end_time,
+                        std::string* raw);
+  bool SeekToTime(uint64_t begin_time);
 
   bool is_valid_ = false;
   bool reach_end_ = false;
+  bool indexed_seek_done_ = false;
+  bool lookahead_enabled_ = false;
+  // Chunk body staged by the lookahead, parsed on a background thread.
+  std::future<std::shared_ptr<proto::ChunkBody>> next_chunk_;
+  std::vector<ChunkIndexEntry> chunk_index_;
   proto::ChunkBody chunk_;
   proto::Index index_;
   int message_index_ = 0;
@@ -18,6 +18,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <utility>
 
 #include "cyber/common/log.h"
 
@@ -37,6 +38,12 @@ RecordWriter::~RecordWriter() { Close(); }
 bool RecordWriter::Open(const std::string& file) {
   file_ = file;
   file_index_ = 0;
+  if (channel_partitioned_) {
+    // per-channel files are created lazily when each channel is declared
+    path_ = file_;
+    is_opened_ = true;
+    return is_opened_;
+  }
   sstream_.str(std::string());
   sstream_.clear();
   sstream_ << "." << std::setw(5) << std::setfill('0') << file_index_++;
@@ -57,11 +64,39 @@ bool RecordWriter::Open(const std::string& file) {
 
 void RecordWriter::Close() {
   if (is_opened_) {
-    file_writer_->Close();
+    if (file_writer_ != nullptr) {
+      file_writer_->Close();
+    }
+    for (auto& item : channel_file_writer_map_) {
+      item.second->Close();
+    }
+    channel_file_writer_map_.clear();
     is_opened_ = false;
   }
 }
 
+std::string RecordWriter::ChannelFileSuffix(const std::string& channel_name) {
+  std::string suffix = channel_name;
+  for (auto& c : suffix) {
+    if (c == '/') {
+      c = '_';
+    }
+  }
+  if (!suffix.empty() && suffix.front() == '_') {
+    suffix.erase(suffix.begin());
+  }
+  return suffix;
+}
+
+bool RecordWriter::SetChannelPartitioned(bool partitioned) {
+  if (is_opened_) {
+    AWARN << "Please call this interface before opening file.";
+    return false;
+  }
+  channel_partitioned_ = partitioned;
+  return true;
+}
+
 bool RecordWriter::SplitOutfile() {
   file_writer_.reset(new RecordFileWriter());
   if (file_index_ > 99999) {
@@ -106,7 +141,19 @@ bool RecordWriter::WriteChannel(const std::string& channel_name,
     channel.set_name(channel_name);
     channel.set_message_type(message_type);
     channel.set_proto_desc(proto_desc);
-    if (!file_writer_->WriteChannel(channel)) {
+    if (channel_partitioned_) {
+      FileWriterPtr writer(new RecordFileWriter());
+      std::string channel_path = file_ + "." + ChannelFileSuffix(channel_name);
+      if (!writer->Open(channel_path)) {
+        AERROR << "Failed to open channel record file: " << channel_path;
+        return false;
+      }
+      if (!writer->WriteHeader(header_) || !writer->WriteChannel(channel)) {
+        AERROR << "Write channel is failed, file: " << channel_path;
+        return false;
+      }
+      channel_file_writer_map_[channel_name] = std::move(writer);
+    } else if (!file_writer_->WriteChannel(channel)) {
       AERROR << "Write channel is failed.";
       return false;
     }
@@ -120,6 +167,18 @@ bool RecordWriter::WriteChannel(const std::string& channel_name,
 bool RecordWriter::WriteMessage(const SingleMessage& message) {
   std::lock_guard<std::mutex> lg(mutex_);
   OnNewMessage(message.channel_name());
+  if (channel_partitioned_) {
+    auto search = channel_file_writer_map_.find(message.channel_name());
+    if (search == channel_file_writer_map_.end()) {
+      AERROR << "Channel is not declared, channel: " << message.channel_name();
+      return false;
+    }
+    if (!search->second->WriteMessage(message)) {
+      AERROR << "Write message is failed.";
+      return false;
+    }
+    return true;
+  }
   if (!file_writer_->WriteMessage(message)) {
     AERROR << "Write message is failed.";
     return false;
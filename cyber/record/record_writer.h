@@ -64,6 +64,13 @@ class RecordWriter : public RecordBase {
 
   bool SetIntervalOfFileSegmentation(uint64_t time_sec);
 
+  // Write every channel into its own record file named
+  // "<file>.<channel>" (with '/' replaced by '_'), so a reader that wants
+  // one channel opens one file and decompresses only that channel's
+  // chunks. Must be called before Open; file segmentation does not apply
+  // to partitioned output.
+  bool SetChannelPartitioned(bool partitioned);
+
   uint64_t GetMessageNumber(const std::string& channel_name) const override;
 
   const std::string& GetMessageType(
@@ -73,8 +80,11 @@ class RecordWriter : public RecordBase {
       const std::string& channel_name) const override;
 
  private:
+  using ChannelFileWriterMap = std::unordered_map<std::string, FileWriterPtr>;
+
   bool WriteMessage(const proto::SingleMessage& single_msg);
   bool SplitOutfile();
+  static std::string ChannelFileSuffix(const std::string& channel_name);
   bool IsNewChannel(const std::string& channel_name);
   void OnNewChannel(const std::string& channel_name,
                     const std::string& message_type,
@@ -90,6 +100,8 @@ class RecordWriter : public RecordBase {
   MessageProtoDescMap channel_proto_desc_map_;
   FileWriterPtr file_writer_ = nullptr;
   FileWriterPtr file_writer_backup_ = nullptr;
+  bool channel_partitioned_ = false;
+  ChannelFileWriterMap channel_file_writer_map_;
   std::mutex mutex_;
   std::stringstream sstream_;
 };
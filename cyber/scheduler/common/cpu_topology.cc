@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/scheduler/common/cpu_topology.h"
+
+#include <sstream>
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+namespace {
+
+// parses the kernel cpulist format, e.g. "0-3,8-11\n"
+bool ParseCpuList(const std::string& str, std::vector<int>* cpus) {
+  std::stringstream ss(str);
+  std::string item;
+  while (getline(ss, item, ',')) {
+    auto dash = item.find('-');
+    try {
+      if (dash == std::string::npos) {
+        cpus->push_back(std::stoi(item));
+      } else {
+        int begin = std::stoi(item.substr(0, dash));
+        int end = std::stoi(item.substr(dash + 1));
+        for (int i = begin; i <= end; i++) {
+          cpus->push_back(i);
+        }
+      }
+    } catch (const std::exception& e) {
+      AERROR << "Parsing cpulist [" << str << "] failed: " << e.what();
+      return false;
+    }
+  }
+  return !cpus->empty();
+}
+
+bool ReadCpuListFile(const std::string& path, std::vector<int>* cpus) {
+  std::string content;
+  if (!common::GetContent(path, &content)) {
+    return false;
+  }
+  return ParseCpuList(content, cpus);
+}
+
+}  // namespace
+
+bool ResolveTopologyCpuset(const std::string& spec, std::vector<int>* cpus) {
+  auto pos = spec.find(':');
+  if (pos == std::string::npos) {
+    AERROR << "Invalid topology spec [" << spec
+           << "], expect numa:<node> or llc:<cpu>.";
+    return false;
+  }
+  auto kind = spec.substr(0, pos);
+  int id = 0;
+  try {
+    id = std::stoi(spec.substr(pos + 1));
+  } catch (const std::exception& e) {
+    AERROR << "Invalid topology spec [" << spec << "]: " << e.what();
+    return false;
+  }
+
+  std::vector<int> resolved;
+  if (kind == "numa") {
+    auto path = "/sys/devices/system/node/node" + std::to_string(id) +
+                "/cpulist";
+    if (!ReadCpuListFile(path, &resolved)) {
+      AERROR << "Resolving " << spec << " via " << path << " failed.";
+      return false;
+    }
+  } else if (kind == "llc") {
+    // index3 is the LLC on multi-level machines; fall back to index2
+    // where no L3 exists
+    auto base =
+        "/sys/devices/system/cpu/cpu" + std::to_string(id) + "/cache/index";
+    if (!ReadCpuListFile(base + "3/shared_cpu_list", &resolved) &&
+        !ReadCpuListFile(base + "2/shared_cpu_list", &resolved)) {
+      AERROR << "Resolving " << spec << " from cache topology failed.";
+      return false;
+    }
+  } else {
+    AERROR << "Unknown topology kind [" << kind << "] in spec [" << spec
+           << "].";
+    return false;
+  }
+
+  *cpus = resolved;
+  return true;
+}
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
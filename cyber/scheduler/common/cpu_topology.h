@@ -0,0 +1,39 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_SCHEDULER_COMMON_CPU_TOPOLOGY_H_
+#define CYBER_SCHEDULER_COMMON_CPU_TOPOLOGY_H_
+
+#include <string>
+#include <vector>
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+// Resolves a topology spec into a concrete cpu list from sysfs, so one
+// scheduler conf works across machines with different core layouts:
+//   "numa:<node>"  all cpus of that NUMA node
+//   "llc:<cpu>"    all cpus sharing the last-level cache with <cpu>
+// Returns false and leaves cpus untouched when the spec cannot be
+// parsed or the sysfs entries are missing.
+bool ResolveTopologyCpuset(const std::string& spec, std::vector<int>* cpus);
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SCHEDULER_COMMON_CPU_TOPOLOGY_H_
@@ -39,9 +39,19 @@ std::shared_ptr<CRoutine> ChoreographyContext::NextRoutine() {
     return nullptr;
   }
 
+  // the processor counts as behind when it has not drained its queue
+  // for a while; sheddable routines then have their cycle skipped so
+  // the critical ones keep bounded latency under overload
+  auto now = std::chrono::steady_clock::now();
+  bool behind = now - last_drained_ > kShedBehindThreshold;
+
   ReadLockGuard<AtomicRWLock> lock(rq_lk_);
   for (auto it = cr_queue_.begin(); it != cr_queue_.end();) {
     auto cr = it->second;
+    if (unlikely(behind && cr->sheddable())) {
+      ++it;
+      continue;
+    }
     if (!cr->Acquire()) {
       continue;
     }
@@ -57,6 +67,7 @@ std::shared_ptr<CRoutine> ChoreographyContext::NextRoutine() {
   }
 
   notified_.clear();
+  last_drained_ = now;
   return nullptr;
 }
 
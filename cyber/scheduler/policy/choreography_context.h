@@ -17,6 +17,7 @@
 #ifndef CYBER_SCHEDULER_POLICY_CHOREOGRAPHY_CONTEXT_H_
 #define CYBER_SCHEDULER_POLICY_CHOREOGRAPHY_CONTEXT_H_
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
@@ -45,9 +46,17 @@ class ChoreographyContext : public ProcessorContext {
   void Wait() override;
 
  private:
+  // how long the queue may stay undrained before sheddable routines
+  // start having cycles skipped
+  static constexpr auto kShedBehindThreshold = std::chrono::milliseconds(5);
+
   std::mutex mtx_wq_;
   std::condition_variable cv_wq_;
 
+  // last time NextRoutine found the queue drained
+  std::chrono::steady_clock::time_point last_drained_ =
+      std::chrono::steady_clock::now();
+
   AtomicRWLock rq_lk_;
   std::multimap<uint32_t, std::shared_ptr<CRoutine>, std::greater<uint32_t>>
       cr_queue_;
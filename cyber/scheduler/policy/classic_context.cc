@@ -37,6 +37,8 @@ GRP_WQ_MUTEX ClassicContext::mtx_wq_;
 GRP_WQ_CV ClassicContext::cv_wq_;
 RQ_LOCK_GROUP ClassicContext::rq_locks_;
 CR_GROUP ClassicContext::cr_group_;
+GRP_PROC_NUM ClassicContext::proc_num_;
+std::mutex ClassicContext::grp_registry_mtx_;
 
 ClassicContext::ClassicContext() { InitGroup(DEFAULT_GROUP_NAME); }
 
@@ -49,6 +51,11 @@ void ClassicContext::InitGroup(const std::string& group_name) {
   lq_ = &rq_locks_[group_name];
   mtx_wrapper_ = &mtx_wq_[group_name];
   cw_ = &cv_wq_[group_name];
+  {
+    std::lock_guard<std::mutex> lg(grp_registry_mtx_);
+    grp_proc_num_ = &proc_num_[group_name];
+    ordinal_ = (*grp_proc_num_)++;
+  }
 }
 
 std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
@@ -58,7 +65,18 @@ std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
 
   for (int i = MAX_PRIO - 1; i >= 0; --i) {
     ReadLockGuard<AtomicRWLock> lk(lq_->at(i));
-    for (auto& cr : multi_pri_rq_->at(i)) {
+    auto& queue = multi_pri_rq_->at(i);
+    auto size = queue.size();
+    if (size == 0) {
+      continue;
+    }
+    // start from this processor's own partition of the queue, so sibling
+    // processors first try disjoint croutines and only walk into each
+    // other's share (work stealing) when their own is empty or busy
+    auto total = *grp_proc_num_;
+    std::size_t start = (total > 1) ? ordinal_ * size / total : 0;
+    for (std::size_t k = 0; k < size; ++k) {
+      auto& cr = queue[(start + k) % size];
       if (!cr->Acquire()) {
         continue;
       }
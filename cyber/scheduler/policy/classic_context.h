@@ -47,6 +47,7 @@ using RQ_LOCK_GROUP = std::unordered_map<std::string, LOCK_QUEUE>;
 
 using GRP_WQ_MUTEX = std::unordered_map<std::string, MutexWrapper>;
 using GRP_WQ_CV = std::unordered_map<std::string, CvWrapper>;
+using GRP_PROC_NUM = std::unordered_map<std::string, uint32_t>;
 
 class ClassicContext : public ProcessorContext {
  public:
@@ -75,6 +76,14 @@ class ClassicContext : public ProcessorContext {
   LOCK_QUEUE *lq_ = nullptr;
   MutexWrapper *mtx_wrapper_ = nullptr;
   CvWrapper *cw_ = nullptr;
+
+  // ordinal of this context among the processors of its group; used to
+  // give every processor its own scan partition of the shared run queues
+  uint32_t ordinal_ = 0;
+  GRP_PROC_NUM::mapped_type *grp_proc_num_ = nullptr;
+
+  static GRP_PROC_NUM proc_num_;
+  static std::mutex grp_registry_mtx_;
 };
 
 }  // namespace scheduler
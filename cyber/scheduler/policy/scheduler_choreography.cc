@@ -22,6 +22,7 @@
 
 #include "cyber/common/environment.h"
 #include "cyber/common/file.h"
+#include "cyber/scheduler/common/cpu_topology.h"
 #include "cyber/scheduler/policy/choreography_context.h"
 #include "cyber/scheduler/policy/classic_context.h"
 #include "cyber/scheduler/processor.h"
@@ -59,12 +60,25 @@ SchedulerChoreography::SchedulerChoreography() {
     choreography_processor_prio_ =
         choreography_conf.choreography_processor_prio();
     ParseCpuset(choreography_conf.choreography_cpuset(), &choreography_cpuset_);
+    if (choreography_cpuset_.empty() &&
+        choreography_conf.has_choreography_topology_cpuset() &&
+        ResolveTopologyCpuset(choreography_conf.choreography_topology_cpuset(),
+                              &choreography_cpuset_) &&
+        choreography_affinity_.empty()) {
+      choreography_affinity_ = "range";
+    }
 
     task_pool_size_ = choreography_conf.pool_processor_num();
     pool_affinity_ = choreography_conf.pool_affinity();
     pool_processor_policy_ = choreography_conf.pool_processor_policy();
     pool_processor_prio_ = choreography_conf.pool_processor_prio();
     ParseCpuset(choreography_conf.pool_cpuset(), &pool_cpuset_);
+    if (pool_cpuset_.empty() && choreography_conf.has_pool_topology_cpuset() &&
+        ResolveTopologyCpuset(choreography_conf.pool_topology_cpuset(),
+                              &pool_cpuset_) &&
+        pool_affinity_.empty()) {
+      pool_affinity_ = "range";
+    }
 
     for (const auto& task : choreography_conf.tasks()) {
       cr_confs_[task.name()] = task;
@@ -129,6 +143,8 @@ bool SchedulerChoreography::DispatchTask(const std::shared_ptr<CRoutine>& cr) {
   if (cr_confs_.find(cr->name()) != cr_confs_.end()) {
     ChoreographyTask taskconf = cr_confs_[cr->name()];
     cr->set_priority(taskconf.prio());
+    cr->set_deadline_us(taskconf.deadline_us());
+    cr->set_sheddable(taskconf.sheddable());
 
     if (taskconf.has_processor()) {
       cr->set_processor_id(taskconf.processor());
@@ -23,6 +23,7 @@
 #include "cyber/common/environment.h"
 #include "cyber/common/file.h"
 #include "cyber/event/perf_event_cache.h"
+#include "cyber/scheduler/common/cpu_topology.h"
 #include "cyber/scheduler/policy/classic_context.h"
 #include "cyber/scheduler/processor.h"
 
@@ -83,11 +84,16 @@ void SchedulerClassic::CreateProcessor() {
       task_pool_size_ = proc_num;
     }
 
-    auto& affinity = group.affinity();
+    auto affinity = group.affinity();
     auto& processor_policy = group.processor_policy();
     auto processor_prio = group.processor_prio();
     std::vector<int> cpuset;
     ParseCpuset(group.cpuset(), &cpuset);
+    if (cpuset.empty() && group.has_topology_cpuset() &&
+        ResolveTopologyCpuset(group.topology_cpuset(), &cpuset) &&
+        affinity.empty()) {
+      affinity = "range";
+    }
 
     for (uint32_t i = 0; i < proc_num; i++) {
       auto ctx = std::make_shared<ClassicContext>(group_name);
@@ -97,6 +103,8 @@ void SchedulerClassic::CreateProcessor() {
       proc->BindContext(ctx);
       proc->SetAffinity(cpuset, affinity, i);
       proc->SetSchedPolicy(processor_policy, processor_prio);
+      proc->SetWaitProfile(group.processor_spin_cycles(),
+                           group.processor_yield_cycles());
       processors_.emplace_back(proc);
     }
   }
@@ -232,6 +240,148 @@ bool SchedulerClassic::RemoveCRoutine(uint64_t crid) {
   return false;
 }
 
+bool SchedulerClassic::ApplyConf(const proto::SchedulerConf& conf) {
+  if (unlikely(stop_)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lg(apply_conf_mtx_);
+
+  if (conf.has_policy() && conf.policy().compare("classic") != 0) {
+    AWARN << "switching the scheduler policy at runtime is not supported, "
+          << "requested policy: " << conf.policy();
+    return false;
+  }
+  if (!conf.has_classic_conf()) {
+    AWARN << "scheduler conf carries no classic_conf, nothing to apply";
+    return false;
+  }
+  const auto& new_conf = conf.classic_conf();
+
+  // validate everything up front so a bad conf changes nothing: groups
+  // must match the running processors one-to-one, since processors cannot
+  // be created or destroyed while croutines run on them
+  std::unordered_map<std::string, const apollo::cyber::proto::SchedGroup*>
+      old_groups;
+  for (auto& group : classic_conf_.groups()) {
+    old_groups[group.name()] = &group;
+  }
+  if (static_cast<int>(old_groups.size()) != new_conf.groups_size()) {
+    AWARN << "group count changed, conf not applied";
+    return false;
+  }
+  for (auto& group : new_conf.groups()) {
+    auto itr = old_groups.find(group.name());
+    if (itr == old_groups.end()) {
+      AWARN << "unknown group [" << group.name() << "], conf not applied";
+      return false;
+    }
+    if (group.processor_num() != itr->second->processor_num()) {
+      AWARN << "processor_num of group [" << group.name()
+            << "] changed, conf not applied";
+      return false;
+    }
+    for (auto& task : group.tasks()) {
+      if (task.prio() >= MAX_PRIO) {
+        AWARN << "prio of task [" << task.name() << "] is greater than "
+              << "MAX_PRIO[" << MAX_PRIO << "], conf not applied";
+        return false;
+      }
+    }
+  }
+
+  // rebind processor attributes; pthread affinity and sched params take
+  // effect on the running threads immediately
+  size_t proc_index = 0;
+  for (auto& old_group : classic_conf_.groups()) {
+    const apollo::cyber::proto::SchedGroup* group = nullptr;
+    for (auto& new_group : new_conf.groups()) {
+      if (new_group.name() == old_group.name()) {
+        group = &new_group;
+        break;
+      }
+    }
+    for (uint32_t i = 0; i < old_group.processor_num(); i++, proc_index++) {
+      std::vector<int> cpuset;
+      ParseCpuset(group->cpuset(), &cpuset);
+      processors_[proc_index]->SetAffinity(cpuset, group->affinity(), i);
+      processors_[proc_index]->SetSchedPolicy(group->processor_policy(),
+                                              group->processor_prio());
+      processors_[proc_index]->SetWaitProfile(group->processor_spin_cycles(),
+                                              group->processor_yield_cycles());
+    }
+  }
+
+  // swap in the new task confs, then migrate live croutines whose
+  // placement changed; each one moves run queues here and resumes on its
+  // new group/priority after its current slice yields
+  cr_confs_.clear();
+  for (auto& group : new_conf.groups()) {
+    auto& group_name = group.name();
+    for (auto task : group.tasks()) {
+      task.set_group_name(group_name);
+      cr_confs_[task.name()] = task;
+    }
+  }
+  for (auto& task : cr_confs_) {
+    MigrateCRoutine(GlobalData::GenerateHashId(task.first),
+                    task.second.group_name(), task.second.prio());
+  }
+  classic_conf_ = new_conf;
+  return true;
+}
+
+bool SchedulerClassic::MigrateCRoutine(uint64_t crid,
+                                       const std::string& group_name,
+                                       uint32_t prio) {
+  MutexWrapper* wrapper = nullptr;
+  if (!id_map_mutex_.Get(crid, &wrapper)) {
+    {
+      std::lock_guard<std::mutex> wl_lg(cr_wl_mtx_);
+      if (!id_map_mutex_.Get(crid, &wrapper)) {
+        wrapper = new MutexWrapper();
+        id_map_mutex_.Set(crid, wrapper);
+      }
+    }
+  }
+  std::lock_guard<std::mutex> lg(wrapper->Mutex());
+
+  std::shared_ptr<CRoutine> cr = nullptr;
+  {
+    ReadLockGuard<AtomicRWLock> lk(id_cr_lock_);
+    auto itr = id_cr_.find(crid);
+    if (itr == id_cr_.end()) {
+      return false;
+    }
+    cr = itr->second;
+  }
+  auto old_prio = cr->priority();
+  auto old_group = cr->group_name();
+  if (old_group == group_name && old_prio == static_cast<int>(prio)) {
+    return true;
+  }
+
+  {
+    WriteLockGuard<AtomicRWLock> lk(
+        ClassicContext::rq_locks_[old_group].at(old_prio));
+    auto& rq = ClassicContext::cr_group_[old_group].at(old_prio);
+    for (auto it = rq.begin(); it != rq.end(); ++it) {
+      if ((*it)->id() == crid) {
+        rq.erase(it);
+        break;
+      }
+    }
+  }
+  cr->set_priority(prio);
+  cr->set_group_name(group_name);
+  {
+    WriteLockGuard<AtomicRWLock> lk(
+        ClassicContext::rq_locks_[group_name].at(prio));
+    ClassicContext::cr_group_[group_name].at(prio).emplace_back(cr);
+  }
+  ClassicContext::Notify(group_name);
+  return true;
+}
+
 }  // namespace scheduler
 }  // namespace cyber
 }  // namespace apollo
@@ -39,6 +39,7 @@ class SchedulerClassic : public Scheduler {
   bool RemoveCRoutine(uint64_t crid) override;
   bool RemoveTask(const std::string& name) override;
   bool DispatchTask(const std::shared_ptr<CRoutine>&) override;
+  bool ApplyConf(const proto::SchedulerConf& conf) override;
 
  private:
   friend Scheduler* Instance();
@@ -46,10 +47,15 @@ class SchedulerClassic : public Scheduler {
 
   void CreateProcessor();
   bool NotifyProcessor(uint64_t crid) override;
+  bool MigrateCRoutine(uint64_t crid, const std::string& group_name,
+                       uint32_t prio);
 
   std::unordered_map<std::string, ClassicTask> cr_confs_;
 
   ClassicConf classic_conf_;
+  // serializes ApplyConf against itself; croutine-level races are handled
+  // by the per-id mutexes and run queue locks
+  std::mutex apply_conf_mtx_;
 };
 
 }  // namespace scheduler
@@ -76,16 +76,31 @@ void Processor::SetSchedPolicy(std::string spolicy, int sched_priority) {
   }
 }
 
+void Processor::SetWaitProfile(uint32_t spin_cycles, uint32_t yield_cycles) {
+  spin_cycles_ = spin_cycles;
+  yield_cycles_ = yield_cycles;
+}
+
 void Processor::Run() {
   tid_.store(static_cast<int>(syscall(SYS_gettid)));
   AINFO << "processor_tid: " << tid_;
 
+  uint32_t empty_count = 0;
   while (likely(running_.load())) {
     if (likely(context_ != nullptr)) {
       auto croutine = context_->NextRoutine();
       if (croutine) {
+        empty_count = 0;
         croutine->Resume();
         croutine->Release();
+      } else if (empty_count < spin_cycles_) {
+        // spin a while before parking: on pinned cores a routine usually
+        // becomes ready again well inside a cv wakeup latency
+        ++empty_count;
+        cpu_relax();
+      } else if (empty_count < spin_cycles_ + yield_cycles_) {
+        ++empty_count;
+        std::this_thread::yield();
       } else {
         context_->Wait();
       }
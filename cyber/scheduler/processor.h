@@ -46,6 +46,7 @@ class Processor {
   void BindContext(const std::shared_ptr<ProcessorContext>& context);
   void SetAffinity(const std::vector<int>&, const std::string&, int);
   void SetSchedPolicy(std::string spolicy, int sched_priority);
+  void SetWaitProfile(uint32_t spin_cycles, uint32_t yield_cycles);
 
  private:
   std::shared_ptr<ProcessorContext> context_;
@@ -57,6 +58,11 @@ class Processor {
 
   std::atomic<pid_t> tid_{-1};
   std::atomic<bool> running_{false};
+
+  // consecutive empty polls spent spinning / yielding before the run
+  // loop parks in context_->Wait(); tuned per group from scheduler conf
+  uint32_t spin_cycles_ = 0;
+  uint32_t yield_cycles_ = 0;
 };
 
 }  // namespace scheduler
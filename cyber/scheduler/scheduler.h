@@ -35,6 +35,7 @@
 #include "cyber/croutine/croutine.h"
 #include "cyber/croutine/routine_factory.h"
 #include "cyber/proto/choreography_conf.pb.h"
+#include "cyber/proto/scheduler_conf.pb.h"
 #include "cyber/scheduler/common/mutex_wrapper.h"
 
 namespace apollo {
@@ -76,6 +77,14 @@ class Scheduler {
     inner_thr_confs_ = confs;
   }
 
+  // Re-apply a scheduler conf to the running scheduler: rebind processor
+  // attributes and migrate croutines whose placement changed. Policies
+  // that support hot reload override this; the default rejects it.
+  virtual bool ApplyConf(const proto::SchedulerConf& conf) {
+    AWARN << "scheduler policy does not support conf hot reload";
+    return false;
+  }
+
  protected:
   Scheduler() : stop_(false) {}
   void ParseCpuset(const std::string&, std::vector<int>*);
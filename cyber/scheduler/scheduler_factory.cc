@@ -88,6 +88,27 @@ void CleanUp() {
   }
 }
 
+bool ReloadConf(const apollo::cyber::proto::SchedulerConf& conf) {
+  Scheduler* obj = instance.load(std::memory_order_acquire);
+  if (obj == nullptr) {
+    AWARN << "scheduler not running, conf not applied";
+    return false;
+  }
+  return obj->ApplyConf(conf);
+}
+
+bool ReloadConfFromFile() {
+  std::string conf("conf/");
+  conf.append(GlobalData::Instance()->ProcessGroup()).append(".conf");
+  auto cfg_file = GetAbsolutePath(WorkRoot(), conf);
+  apollo::cyber::proto::CyberConfig cfg;
+  if (!PathExists(cfg_file) || !GetProtoFromFile(cfg_file, &cfg)) {
+    AWARN << "read scheduler conf failed, file: " << cfg_file;
+    return false;
+  }
+  return ReloadConf(cfg.scheduler_conf());
+}
+
 }  // namespace scheduler
 }  // namespace cyber
 }  // namespace apollo
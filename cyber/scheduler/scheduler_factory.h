@@ -32,6 +32,11 @@ namespace scheduler {
 Scheduler* Instance();
 void CleanUp();
 
+// Apply a scheduler conf to the running scheduler without a restart.
+bool ReloadConf(const apollo::cyber::proto::SchedulerConf& conf);
+// Re-read the process-group conf file from disk and apply it.
+bool ReloadConfFromFile();
+
 }  // namespace scheduler
 }  // namespace cyber
 }  // namespace apollo
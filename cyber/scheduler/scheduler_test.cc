@@ -52,6 +52,21 @@ TEST(SchedulerTest, create_task) {
   EXPECT_FALSE(sched->RemoveTask("driver"));
 }
 
+TEST(SchedulerTest, apply_conf) {
+  auto sched = Instance();
+  cyber::Init("scheduler_test");
+  // switching the policy class at runtime is rejected
+  proto::SchedulerConf conf;
+  conf.set_policy("choreography");
+  EXPECT_FALSE(sched->ApplyConf(conf));
+  // a conf without a classic_conf carries nothing to apply
+  conf.set_policy("classic");
+  EXPECT_FALSE(sched->ApplyConf(conf));
+  // a group set that does not match the running processors is rejected
+  conf.mutable_classic_conf()->add_groups()->set_name("no_such_grp");
+  EXPECT_FALSE(sched->ApplyConf(conf));
+}
+
 TEST(SchedulerTest, notify_task) {
   auto sched = Instance();
   cyber::Init("scheduler_test");
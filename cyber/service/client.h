@@ -58,12 +58,14 @@ class Client : public ClientBase {
 
   bool Init();
 
+  // the timeout accepts any chrono duration, so callers on the
+  // interactive path can pass millisecond-scale deadlines
   SharedResponse SendRequest(
       SharedRequest request,
-      const std::chrono::seconds& timeout_s = std::chrono::seconds(5));
+      const std::chrono::nanoseconds& timeout = std::chrono::seconds(5));
   SharedResponse SendRequest(
       const Request& request,
-      const std::chrono::seconds& timeout_s = std::chrono::seconds(5));
+      const std::chrono::nanoseconds& timeout = std::chrono::seconds(5));
 
   SharedFuture AsyncSendRequest(SharedRequest request);
   SharedFuture AsyncSendRequest(const Request& request);
@@ -80,8 +82,11 @@ class Client : public ClientBase {
   }
 
  private:
+  SharedFuture AsyncSendRequest(SharedRequest request, CallbackType&& cb,
+                                uint64_t* sequence_number);
   void HandleResponse(const std::shared_ptr<Response>& response,
                       const transport::MessageInfo& request_info);
+  void RemovePendingRequest(uint64_t sequence_number);
   bool IsInit(void) const { return response_receiver_ != nullptr; }
 
   std::string node_name_;
@@ -116,9 +121,18 @@ bool Client<Request, Response>::Init() {
   role.set_channel_id(channel_id);
   role.mutable_qos_profile()->CopyFrom(
       transport::QosProfileConf::QOS_PROFILE_SERVICES_DEFAULT);
+  // same-host deployments can route RPC through shm, waking the service
+  // via the shm notifier instead of crossing the network stack
+  auto mode = proto::OptionalMode::RTPS;
+  const auto& g_conf = common::GlobalData::Instance()->Config();
+  if (g_conf.has_transport_conf() &&
+      g_conf.transport_conf().has_communication_mode() &&
+      g_conf.transport_conf().communication_mode().service_call() ==
+          proto::OptionalMode::SHM) {
+    mode = proto::OptionalMode::SHM;
+  }
   auto transport = transport::Transport::Instance();
-  request_transmitter_ =
-      transport->CreateTransmitter<Request>(role, proto::OptionalMode::RTPS);
+  request_transmitter_ = transport->CreateTransmitter<Request>(role, mode);
   if (request_transmitter_ == nullptr) {
     AERROR << "Create request pub failed.";
     return false;
@@ -141,7 +155,7 @@ bool Client<Request, Response>::Init() {
         (void)reader_attr;
         response_callback_(request, message_info);
       },
-      proto::OptionalMode::RTPS);
+      mode);
   if (response_receiver_ == nullptr) {
     AERROR << "Create response sub failed.";
     request_transmitter_.reset();
@@ -152,32 +166,36 @@ bool Client<Request, Response>::Init() {
 
 template <typename Request, typename Response>
 typename Client<Request, Response>::SharedResponse
-Client<Request, Response>::SendRequest(SharedRequest request,
-                                       const std::chrono::seconds& timeout_s) {
+Client<Request, Response>::SendRequest(
+    SharedRequest request, const std::chrono::nanoseconds& timeout) {
   if (!IsInit()) {
     return nullptr;
   }
-  auto future = AsyncSendRequest(request);
+  uint64_t sequence_number = 0;
+  auto future =
+      AsyncSendRequest(request, [](SharedFuture) {}, &sequence_number);
   if (!future.valid()) {
     return nullptr;
   }
-  auto status = future.wait_for(timeout_s);
+  auto status = future.wait_for(timeout);
   if (status == std::future_status::ready) {
     return future.get();
-  } else {
-    return nullptr;
   }
+  // the deadline passed: drop the bookkeeping so a late response does
+  // not keep the promise alive forever
+  RemovePendingRequest(sequence_number);
+  return nullptr;
 }
 
 template <typename Request, typename Response>
 typename Client<Request, Response>::SharedResponse
-Client<Request, Response>::SendRequest(const Request& request,
-                                       const std::chrono::seconds& timeout_s) {
+Client<Request, Response>::SendRequest(
+    const Request& request, const std::chrono::nanoseconds& timeout) {
   if (!IsInit()) {
     return nullptr;
   }
   auto request_ptr = std::make_shared<const Request>(request);
-  return SendRequest(request_ptr, timeout_s);
+  return SendRequest(request_ptr, timeout);
 }
 
 template <typename Request, typename Response>
@@ -197,6 +215,14 @@ template <typename Request, typename Response>
 typename Client<Request, Response>::SharedFuture
 Client<Request, Response>::AsyncSendRequest(SharedRequest request,
                                             CallbackType&& cb) {
+  return AsyncSendRequest(request, std::forward<CallbackType>(cb), nullptr);
+}
+
+template <typename Request, typename Response>
+typename Client<Request, Response>::SharedFuture
+Client<Request, Response>::AsyncSendRequest(SharedRequest request,
+                                            CallbackType&& cb,
+                                            uint64_t* sequence_number) {
   if (IsInit()) {
     std::lock_guard<std::mutex> lock(pending_requests_mutex_);
     sequence_number_++;
@@ -206,12 +232,22 @@ Client<Request, Response>::AsyncSendRequest(SharedRequest request,
     SharedFuture f(call_promise->get_future());
     pending_requests_[info.seq_num()] =
         std::make_tuple(call_promise, std::forward<CallbackType>(cb), f);
+    if (sequence_number != nullptr) {
+      *sequence_number = info.seq_num();
+    }
     return f;
   } else {
     return std::shared_future<std::shared_ptr<Response>>();
   }
 }
 
+template <typename Request, typename Response>
+void Client<Request, Response>::RemovePendingRequest(
+    uint64_t sequence_number) {
+  std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+  pending_requests_.erase(sequence_number);
+}
+
 template <typename Request, typename Response>
 bool Client<Request, Response>::ServiceIsReady() const {
   return true;
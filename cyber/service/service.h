@@ -136,9 +136,18 @@ bool Service<Request, Response>::Init() {
   role.set_channel_id(channel_id);
   role.mutable_qos_profile()->CopyFrom(
       transport::QosProfileConf::QOS_PROFILE_SERVICES_DEFAULT);
+  // mirror the client side: same-host deployments can route RPC through
+  // shm and its notifier instead of the network stack
+  auto mode = proto::OptionalMode::RTPS;
+  const auto& g_conf = common::GlobalData::Instance()->Config();
+  if (g_conf.has_transport_conf() &&
+      g_conf.transport_conf().has_communication_mode() &&
+      g_conf.transport_conf().communication_mode().service_call() ==
+          proto::OptionalMode::SHM) {
+    mode = proto::OptionalMode::SHM;
+  }
   auto transport = transport::Transport::Instance();
-  response_transmitter_ =
-      transport->CreateTransmitter<Response>(role, proto::OptionalMode::RTPS);
+  response_transmitter_ = transport->CreateTransmitter<Response>(role, mode);
   if (response_transmitter_ == nullptr) {
     AERROR << " Create response pub failed.";
     return false;
@@ -163,7 +172,7 @@ bool Service<Request, Response>::Init() {
         };
         Enqueue(std::move(task));
       },
-      proto::OptionalMode::RTPS);
+      mode);
   inited_ = true;
   thread_ = std::thread(&Service<Request, Response>::Process, this);
   if (request_receiver_ == nullptr) {
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/service_discovery/container/interest_filter.h"
+
+#include <cstring>
+
+#include "cyber/common/util.h"
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+namespace {
+
+// double hashing: bit_i = h1 + i * h2 (mod kNumBits)
+inline uint64_t SecondHash(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return h | 1;
+}
+
+}  // namespace
+
+InterestFilter::InterestFilter() : inserted_(0) {
+  std::memset(bits_, 0, sizeof(bits_));
+}
+
+void InterestFilter::Insert(const std::string& channel_name) {
+  uint64_t h1 = common::Hash(channel_name);
+  uint64_t h2 = SecondHash(h1);
+  for (uint32_t i = 0; i < kNumHashes; ++i) {
+    uint64_t bit = (h1 + i * h2) % kNumBits;
+    bits_[bit / 64] |= 1ULL << (bit % 64);
+  }
+  ++inserted_;
+}
+
+bool InterestFilter::MightContain(const std::string& channel_name) const {
+  uint64_t h1 = common::Hash(channel_name);
+  uint64_t h2 = SecondHash(h1);
+  for (uint32_t i = 0; i < kNumHashes; ++i) {
+    uint64_t bit = (h1 + i * h2) % kNumBits;
+    if ((bits_[bit / 64] & (1ULL << (bit % 64))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void InterestFilter::Clear() {
+  std::memset(bits_, 0, sizeof(bits_));
+  inserted_ = 0;
+}
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
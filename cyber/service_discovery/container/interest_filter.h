@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_SERVICE_DISCOVERY_CONTAINER_INTEREST_FILTER_H_
+#define CYBER_SERVICE_DISCOVERY_CONTAINER_INTEREST_FILTER_H_
+
+#include <cstdint>
+#include <string>
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+/**
+ * @brief A small bloom filter over channel names, used to decide whether a
+ * topology change listener cares about a channel without storing or comparing
+ * the names themselves. False positives only cost a redundant callback; there
+ * are no false negatives.
+ */
+class InterestFilter {
+ public:
+  InterestFilter();
+
+  void Insert(const std::string& channel_name);
+  bool MightContain(const std::string& channel_name) const;
+
+  // an empty filter expresses no interest set, which listeners treat as
+  // interested in everything
+  bool Empty() const { return inserted_ == 0; }
+  void Clear();
+
+ private:
+  static const uint32_t kNumBits = 2048;
+  static const uint32_t kNumHashes = 3;
+
+  uint64_t bits_[kNumBits / 64];
+  uint32_t inserted_;
+};
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SERVICE_DISCOVERY_CONTAINER_INTEREST_FILTER_H_
@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/service_discovery/container/interest_filter.h"
+
+#include <gtest/gtest.h>
+#include <string>
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+TEST(InterestFilterTest, insert_and_query) {
+  InterestFilter filter;
+  EXPECT_TRUE(filter.Empty());
+
+  filter.Insert("/apollo/sensor/lidar");
+  filter.Insert("/apollo/localization/pose");
+  EXPECT_FALSE(filter.Empty());
+
+  // no false negatives for inserted names
+  EXPECT_TRUE(filter.MightContain("/apollo/sensor/lidar"));
+  EXPECT_TRUE(filter.MightContain("/apollo/localization/pose"));
+
+  // false positives must be rare with a handful of entries
+  int hits = 0;
+  for (int i = 0; i < 1000; i++) {
+    if (filter.MightContain("/channel_" + std::to_string(i))) {
+      hits++;
+    }
+  }
+  EXPECT_LT(hits, 10);
+
+  filter.Clear();
+  EXPECT_TRUE(filter.Empty());
+  EXPECT_FALSE(filter.MightContain("/apollo/sensor/lidar"));
+}
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
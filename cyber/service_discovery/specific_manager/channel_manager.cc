@@ -215,7 +215,12 @@ bool ChannelManager::Check(const RoleAttributes& attr) {
 
 void ChannelManager::Dispose(const ChangeMsg& msg) {
   if (msg.operate_type() == OperateType::OPT_JOIN) {
-    DisposeJoin(msg);
+    // a rebroadcast join of a role we already track carries no new state;
+    // swallowing it keeps listeners from re-walking their graph on every
+    // participant rediscovery
+    if (!DisposeJoin(msg)) {
+      return;
+    }
   } else {
     DisposeLeave(msg);
   }
@@ -252,7 +257,17 @@ void ChannelManager::OnTopoModuleLeave(const std::string& host_name,
   }
 }
 
-void ChannelManager::DisposeJoin(const ChangeMsg& msg) {
+bool ChannelManager::DisposeJoin(const ChangeMsg& msg) {
+  if (msg.role_type() == RoleType::ROLE_WRITER) {
+    if (channel_writers_.Search(msg.role_attr())) {
+      return false;
+    }
+  } else {
+    if (channel_readers_.Search(msg.role_attr())) {
+      return false;
+    }
+  }
+
   ScanMessageType(msg);
 
   Vertice v(msg.role_attr().node_name());
@@ -275,6 +290,7 @@ void ChannelManager::DisposeJoin(const ChangeMsg& msg) {
     e.set_dst(v);
   }
   node_graph_.Insert(e);
+  return true;
 }
 
 void ChannelManager::DisposeLeave(const ChangeMsg& msg) {
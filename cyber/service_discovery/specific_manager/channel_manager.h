@@ -77,7 +77,9 @@ class ChannelManager : public Manager {
   void Dispose(const ChangeMsg& msg) override;
   void OnTopoModuleLeave(const std::string& host_name, int process_id) override;
 
-  void DisposeJoin(const ChangeMsg& msg);
+  // returns false when the role is already tracked, i.e. the message is a
+  // rebroadcast rather than a topology delta
+  bool DisposeJoin(const ChangeMsg& msg);
   void DisposeLeave(const ChangeMsg& msg);
 
   void ScanMessageType(const ChangeMsg& msg);
@@ -129,6 +129,16 @@ Manager::ChangeConnection Manager::AddChangeListener(const ChangeFunc& func) {
   return signal_.Connect(func);
 }
 
+Manager::ChangeConnection Manager::AddChangeListener(
+    const ChangeFunc& func, const InterestFilter& filter) {
+  return signal_.Connect([func, filter](const ChangeMsg& msg) {
+    if (filter.Empty() || !msg.role_attr().has_channel_name() ||
+        filter.MightContain(msg.role_attr().channel_name())) {
+      func(msg);
+    }
+  });
+}
+
 void Manager::RemoveChangeListener(const ChangeConnection& conn) {
   auto local_conn = conn;
   local_conn.Disconnect();
@@ -32,6 +32,7 @@
 #include "cyber/base/signal.h"
 #include "cyber/proto/topology_change.pb.h"
 #include "cyber/service_discovery/communication/subscriber_listener.h"
+#include "cyber/service_discovery/container/interest_filter.h"
 
 namespace apollo {
 namespace cyber {
@@ -65,6 +66,10 @@ class Manager {
   bool Leave(const RoleAttributes& attr, RoleType role);
 
   ChangeConnection AddChangeListener(const ChangeFunc& func);
+  // only deliver changes whose channel name hits the interest filter;
+  // changes without a channel name and empty filters always pass
+  ChangeConnection AddChangeListener(const ChangeFunc& func,
+                                     const InterestFilter& filter);
   void RemoveChangeListener(const ChangeConnection& conn);
 
   virtual void OnTopoModuleLeave(const std::string& host_name,
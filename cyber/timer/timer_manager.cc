@@ -16,6 +16,11 @@
 
 #include "cyber/timer/timer_manager.h"
 
+#include <pthread.h>
+#include <sched.h>
+
+#include <cstring>
+
 #include "cyber/common/log.h"
 #include "cyber/scheduler/scheduler_factory.h"
 #include "cyber/time/duration.h"
@@ -24,6 +29,12 @@
 namespace apollo {
 namespace cyber {
 
+namespace {
+// default real-time priority for the tick thread; modest on purpose so a
+// misbehaving timer handler cannot starve the scheduler workers
+constexpr int kTickThreadPriority = 10;
+}  // namespace
+
 TimerManager::TimerManager()
     : timing_wheel_(Duration(0.01)),
       time_gran_(Duration(0.01)),
@@ -41,6 +52,16 @@ void TimerManager::Start() {
     ADEBUG << "TimerManager->Start() ok";
     running_ = true;
     scheduler_thread_ = std::thread([this]() { this->ThreadFuncImpl(); });
+    // tick on SCHED_FIFO by default so timer jitter does not track system
+    // load; an inner_thread conf entry for "timer" can still override this
+    struct sched_param sp;
+    std::memset(&sp, 0, sizeof(sp));
+    sp.sched_priority = kTickThreadPriority;
+    if (pthread_setschedparam(scheduler_thread_.native_handle(), SCHED_FIFO,
+                              &sp) != 0) {
+      AWARN << "Set SCHED_FIFO for timer tick thread failed, "
+            << "timer jitter may increase under load.";
+    }
     scheduler::Instance()->SetInnerThreadAttr("timer", &scheduler_thread_);
   }
 }
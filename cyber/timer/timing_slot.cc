@@ -40,6 +40,7 @@ void TimingSlot::EnumTaskList(
           HandlePackage hp;
           hp.handle = task->handler_;
           hp.id = task->Id();
+          hp.deadline = task->deadline_;
           if (!hander_queue->Enqueue(hp)) {
             AERROR << "hander queue is full";
           }
@@ -40,6 +40,8 @@ class TimerTask;
 
 struct HandlePackage {
   uint64_t id;
+  // nominal fire time relative to the wheel start, for jitter accounting
+  uint64_t deadline = 0;
   CallHandler handle;
 };
 
@@ -20,6 +20,7 @@
 
 #include "cyber/base/for_each.h"
 #include "cyber/common/log.h"
+#include "cyber/event/perf_event_cache.h"
 #include "cyber/task/task.h"
 #include "cyber/time/time.h"
 #include "cyber/timer/timer_task.h"
@@ -108,11 +109,28 @@ void TimingWheel::Step() {
 
   FillRepeatSlot();
 
-  while (!handler_queue_.Empty()) {
+  if (!handler_queue_.Empty()) {
+    // dispatch all co-due handlers as one task: they serialize on the
+    // shared handler mutex anyway, and a single Async keeps the tick
+    // thread from paying per-handler dispatch cost
+    auto batch = std::make_shared<std::vector<HandlePackage>>();
     HandlePackage hp;
-    if (handler_queue_.Dequeue(&hp)) {
-      cyber::Async(hp.handle);
+    while (handler_queue_.Dequeue(&hp)) {
+      batch->emplace_back(std::move(hp));
     }
+    auto wheel_start = start_time_;
+    cyber::Async([batch, wheel_start]() {
+      for (auto& pkg : *batch) {
+        auto fire_time = Time::Now().ToNanosecond();
+        auto jitter_us = (static_cast<int64_t>(fire_time - wheel_start) -
+                          static_cast<int64_t>(pkg.deadline)) /
+                         1000;
+        event::PerfEventCache::Instance()->AddSchedEvent(
+            event::SchedPerf::TIMER_JITTER, pkg.id, -1,
+            static_cast<int>(jitter_us));
+        pkg.handle();
+      }
+    });
   }
 }
 
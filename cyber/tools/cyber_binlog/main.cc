@@ -0,0 +1,198 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Renders a .binlog file produced by the CYBER_BINARY_LOG mode of
+// cyber/common/log.h into glog-style text lines on stdout. Rendering
+// offline keeps the formatting cost entirely off the logging process.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/logger/binary_log.h"
+
+namespace {
+
+using apollo::cyber::logger::BinLogRecord;
+using apollo::cyber::logger::BinLogTag;
+
+struct Site {
+  int32_t severity;
+  int32_t line;
+  std::string file;
+};
+
+bool ReadRaw(std::FILE* fp, void* dst, size_t n) {
+  return std::fread(dst, 1, n, fp) == n;
+}
+
+bool ReadString(std::FILE* fp, std::string* out) {
+  uint16_t len = 0;
+  if (!ReadRaw(fp, &len, sizeof(len))) {
+    return false;
+  }
+  out->resize(len);
+  return len == 0 || ReadRaw(fp, &(*out)[0], len);
+}
+
+char SeverityLetter(int32_t severity) {
+  switch (severity) {
+    case -1:
+      return 'D';
+    case 0:
+      return 'I';
+    case 1:
+      return 'W';
+    case 2:
+      return 'E';
+    default:
+      return 'F';
+  }
+}
+
+std::string BaseName(const std::string& path) {
+  auto pos = path.find_last_of('/');
+  return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+bool RenderMessage(std::FILE* fp,
+                   const std::unordered_map<uint32_t, Site>& sites) {
+  uint32_t site_id = 0;
+  uint64_t ts_ns = 0;
+  uint32_t tid = 0;
+  std::string module;
+  if (!ReadRaw(fp, &site_id, sizeof(site_id)) ||
+      !ReadRaw(fp, &ts_ns, sizeof(ts_ns)) || !ReadRaw(fp, &tid, sizeof(tid)) ||
+      !ReadString(fp, &module)) {
+    return false;
+  }
+
+  auto it = sites.find(site_id);
+  if (it == sites.end()) {
+    std::cerr << "unknown site id " << site_id << std::endl;
+    return false;
+  }
+  const Site& site = it->second;
+
+  time_t seconds = static_cast<time_t>(ts_ns / 1000000000ULL);
+  uint32_t micros = static_cast<uint32_t>(ts_ns % 1000000000ULL / 1000);
+  struct tm tm_time;
+  localtime_r(&seconds, &tm_time);
+  char header[96];
+  snprintf(header, sizeof(header), "%c%02d%02d %02d:%02d:%02d.%06u %5u %s:%d]",
+           SeverityLetter(site.severity), tm_time.tm_mon + 1, tm_time.tm_mday,
+           tm_time.tm_hour, tm_time.tm_min, tm_time.tm_sec, micros, tid,
+           BaseName(site.file).c_str(), site.line);
+  std::cout << header << " [" << module << "] ";
+
+  while (true) {
+    uint8_t tag = 0;
+    if (!ReadRaw(fp, &tag, sizeof(tag))) {
+      return false;
+    }
+    switch (static_cast<BinLogTag>(tag)) {
+      case BinLogTag::kEnd:
+        std::cout << "\n";
+        return true;
+      case BinLogTag::kBool: {
+        bool v;
+        if (!ReadRaw(fp, &v, sizeof(v))) return false;
+        std::cout << (v ? "true" : "false");
+        break;
+      }
+      case BinLogTag::kChar: {
+        char v;
+        if (!ReadRaw(fp, &v, sizeof(v))) return false;
+        std::cout << v;
+        break;
+      }
+      case BinLogTag::kInt64: {
+        int64_t v;
+        if (!ReadRaw(fp, &v, sizeof(v))) return false;
+        std::cout << v;
+        break;
+      }
+      case BinLogTag::kUint64: {
+        uint64_t v;
+        if (!ReadRaw(fp, &v, sizeof(v))) return false;
+        std::cout << v;
+        break;
+      }
+      case BinLogTag::kDouble: {
+        double v;
+        if (!ReadRaw(fp, &v, sizeof(v))) return false;
+        std::cout << v;
+        break;
+      }
+      case BinLogTag::kString: {
+        std::string v;
+        if (!ReadString(fp, &v)) return false;
+        std::cout << v;
+        break;
+      }
+      default:
+        std::cerr << "corrupt record: unknown tag " << int(tag) << std::endl;
+        return false;
+    }
+  }
+}
+
+int Render(const char* path) {
+  std::FILE* fp = std::fopen(path, "rb");
+  if (fp == nullptr) {
+    std::cerr << "cannot open " << path << std::endl;
+    return 1;
+  }
+  std::unordered_map<uint32_t, Site> sites;
+  uint8_t kind = 0;
+  while (ReadRaw(fp, &kind, sizeof(kind))) {
+    if (static_cast<BinLogRecord>(kind) == BinLogRecord::kSite) {
+      uint32_t id = 0;
+      Site site;
+      if (!ReadRaw(fp, &id, sizeof(id)) ||
+          !ReadRaw(fp, &site.severity, sizeof(site.severity)) ||
+          !ReadRaw(fp, &site.line, sizeof(site.line)) ||
+          !ReadString(fp, &site.file)) {
+        break;
+      }
+      sites[id] = site;
+    } else if (static_cast<BinLogRecord>(kind) == BinLogRecord::kMessage) {
+      if (!RenderMessage(fp, sites)) {
+        break;
+      }
+    } else {
+      std::cerr << "corrupt record: unknown kind " << int(kind) << std::endl;
+      break;
+    }
+  }
+  std::fclose(fp);
+  return 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    std::cerr << "Usage: cyber_binlog <file.binlog>" << std::endl;
+    return 1;
+  }
+  return Render(argv[1]);
+}
@@ -23,10 +23,14 @@
 #include <string>
 #include <vector>
 
+#include "cyber/common/global_data.h"
+
 namespace {
 constexpr int ReaderWriterOffset = 4;
 }  // namespace
 
+uint32_t GeneralChannelMessage::sampling_interval_ = 1;
+
 const char* GeneralChannelMessage::errCode2Str(
     GeneralChannelMessage::ErrorCode errCode) {
   const char* ret;
@@ -125,6 +129,12 @@ GeneralChannelMessage* GeneralChannelMessage::OpenChannel(
     channel_node_.reset();
     return castErrorCode2Ptr(ErrorCode::CreateReaderFailed);
   }
+
+  // The segment attaches lazily, so this stays cheap for channels that do
+  // not go through shared memory.
+  stats_segment_ = std::make_shared<apollo::cyber::transport::Segment>(
+      apollo::cyber::common::GlobalData::RegisterChannel(channelName),
+      apollo::cyber::transport::READ_ONLY);
   return this;
 }
 
@@ -233,9 +243,45 @@ void GeneralChannelMessage::RenderDebugString(const Screen* s, int key,
              << frame_ratio();
       s->AddStr(outStr.str().c_str());
 
+      s->AddStr(0, lineNo++, "ReceivedMessages: ");
+      outStr.str("");
+      outStr << received_count_.load();
+      s->AddStr(outStr.str().c_str());
+
+      s->AddStr(0, lineNo++, "ReceivedBytes: ");
+      outStr.str("");
+      outStr << received_bytes_.load() << " Bytes";
+      s->AddStr(outStr.str().c_str());
+
+      if (stats_segment_ != nullptr) {
+        uint32_t wrote_num = stats_segment_->GetWroteNum();
+        if (wrote_num > 0) {
+          if (!wrote_num_base_set_) {
+            wrote_num_base_ = wrote_num;
+            received_count_base_ = received_count_.load();
+            wrote_num_base_set_ = true;
+          }
+          s->AddStr(0, lineNo++, "ShmWroteNum: ");
+          outStr.str("");
+          outStr << wrote_num;
+          s->AddStr(outStr.str().c_str());
+
+          // messages the transport wrote while this view was open but the
+          // reader never delivered; only meaningful for shm channels
+          uint64_t wrote_delta = wrote_num - wrote_num_base_;
+          uint64_t recv_delta = received_count_.load() - received_count_base_;
+          s->AddStr(0, lineNo++, "ShmDropEstimate: ");
+          outStr.str("");
+          outStr << (wrote_delta > recv_delta ? wrote_delta - recv_delta : 0);
+          s->AddStr(outStr.str().c_str());
+        }
+      }
+
       decltype(channel_message_) channelMsg = CopyMsgPtr();
 
-      if (channelMsg->message.size()) {
+      if (channelMsg == nullptr) {
+        s->AddStr(0, lineNo++, "Payload sampling is off, stats only");
+      } else if (channelMsg->message.size()) {
         s->AddStr(0, lineNo++, "RawMessage Size: ");
         outStr.str("");
         outStr << channelMsg->message.size() << " Bytes";
@@ -20,6 +20,7 @@
 #include <atomic>
 
 #include "cyber/message/raw_message.h"
+#include "cyber/transport/shm/segment.h"
 #include "general_message_base.h"
 
 class CyberTopologyMessage;
@@ -39,6 +40,15 @@ class GeneralChannelMessage : public GeneralMessageBase {
   static const char* errCode2Str(ErrorCode errCode);
   static bool isErrorCode(void* ptr);
 
+  // 1-in-N payload sampling shared by every channel view: 1 retains every
+  // payload (the historical behavior), a larger N retains every Nth one
+  // and 0 retains none, so the monitor only counts messages and never
+  // touches their contents.
+  static void set_sampling_interval(uint32_t interval) {
+    sampling_interval_ = interval;
+  }
+  static uint32_t sampling_interval(void) { return sampling_interval_; }
+
   static ErrorCode castPtr2ErrorCode(void* ptr) {
     assert(isErrorCode(ptr));
     return static_cast<ErrorCode>(reinterpret_cast<intptr_t>(ptr));
@@ -95,6 +105,10 @@ class GeneralChannelMessage : public GeneralMessageBase {
     if (channel_node_ != nullptr) {
       channel_node_.reset();
     }
+
+    if (stats_segment_ != nullptr) {
+      stats_segment_.reset();
+    }
   }
 
  private:
@@ -143,6 +157,11 @@ class GeneralChannelMessage : public GeneralMessageBase {
     set_has_message_come(true);
     msg_time_ = apollo::cyber::Time::MonoTime();
     ++frame_counter_;
+    uint64_t msg_seq = received_count_.fetch_add(1);
+    received_bytes_.fetch_add(rawMsg->message.size());
+    if (sampling_interval_ == 0 || msg_seq % sampling_interval_ != 0) {
+      return;
+    }
     std::lock_guard<std::mutex> _g(inner_lock_);
     channel_message_.reset();
     channel_message_ = rawMsg;
@@ -185,6 +204,18 @@ class GeneralChannelMessage : public GeneralMessageBase {
       channel_reader_;
   mutable std::mutex inner_lock_;
 
+  std::atomic<uint64_t> received_count_ = {0};
+  std::atomic<uint64_t> received_bytes_ = {0};
+
+  // Read-only view of the channel's shm segment, used to sample the
+  // transport-level write counter without touching any block.
+  std::shared_ptr<apollo::cyber::transport::Segment> stats_segment_;
+  uint32_t wrote_num_base_ = 0;
+  uint64_t received_count_base_ = 0;
+  bool wrote_num_base_set_ = false;
+
+  static uint32_t sampling_interval_;
+
   google::protobuf::Message* raw_msg_class_;
 
   friend class CyberTopologyMessage;
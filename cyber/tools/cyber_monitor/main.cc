@@ -22,6 +22,7 @@
 #include "cyber/service_discovery/topology_manager.h"
 
 #include <signal.h>
+#include <cstdlib>
 #include <iostream>
 
 namespace {
@@ -33,6 +34,8 @@ void printHelp(const char *cmdName) {
             << cmdName << "  [option]\nOption:\n"
             << "   -h print help info\n"
             << "   -c specify one channel\n"
+            << "   -s sample one payload out of every N messages, 0 keeps\n"
+            << "      none so channels are only counted, default 1\n"
             << "Interactive Command:\n"
             << Screen::InteractiveCmdStr << std::endl;
 }
@@ -45,8 +48,9 @@ enum COMMAND {
 };
 
 COMMAND parseOption(int argc, char *const argv[], std::string &commandVal) {
-  if (argc > 4) return TOO_MANY_PARAMETER;
+  if (argc > 6) return TOO_MANY_PARAMETER;
   int index = 1;
+  COMMAND com = NO_OPTION;
   while (true) {
     const char *opt = argv[index];
     if (opt == nullptr) break;
@@ -54,14 +58,22 @@ COMMAND parseOption(int argc, char *const argv[], std::string &commandVal) {
     if (strcmp(opt, "-c") == 0) {
       if (argv[index + 1]) {
         commandVal = argv[index + 1];
-        return CHANNEL;
+        com = CHANNEL;
+        ++index;
+      }
+    }
+    if (strcmp(opt, "-s") == 0) {
+      if (argv[index + 1]) {
+        GeneralChannelMessage::set_sampling_interval(
+            static_cast<uint32_t>(strtoul(argv[index + 1], nullptr, 10)));
+        ++index;
       }
     }
 
     ++index;
   }
 
-  return NO_OPTION;
+  return com;
 }
 
 }  // namespace
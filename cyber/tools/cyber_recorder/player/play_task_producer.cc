@@ -102,6 +102,10 @@ bool PlayTaskProducer::ReadRecordInfo() {
       std::cout << "file: " << file << " is not complete." << std::endl;
       continue;
     }
+    // The play range is fixed for the whole run, so the reader may parse
+    // each upcoming chunk on a background thread while the current one is
+    // being published.
+    record_reader->EnableChunkLookahead();
 
     record_readers_.emplace_back(record_reader);
 
@@ -261,7 +265,10 @@ void PlayTaskProducer::ThreadFunc() {
           continue;
         }
 
-        auto raw_msg = std::make_shared<message::RawMessage>(itr->content);
+        // Move the payload instead of copying it; the iterator refills
+        // its message instance on the next increment anyway.
+        auto raw_msg = std::make_shared<message::RawMessage>();
+        raw_msg->message = std::move(itr->content);
         auto task = std::make_shared<PlayTask>(
             raw_msg, search->second, itr->time, itr->time + plus_time_ns);
         task_buffer_->Push(task);
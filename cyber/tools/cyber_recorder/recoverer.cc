@@ -16,7 +16,11 @@
 
 #include "cyber/tools/cyber_recorder/recoverer.h"
 
+#include <thread>
+
 #include "cyber/base/for_each.h"
+#include "cyber/base/thread_pool.h"
+#include "cyber/record/file/crc32.h"
 #include "cyber/record/header_builder.h"
 
 namespace apollo {
@@ -67,8 +71,19 @@ bool Recoverer::Proc() {
     }
   }
 
+  // Chunk bodies are decoded on a worker pool while this thread keeps
+  // reading; results are consumed in submission order so the output keeps
+  // the input ordering.
+  const size_t thread_num =
+      std::max<size_t>(std::thread::hardware_concurrency(), 2);
+  base::ThreadPool pool(thread_num);
+  std::deque<std::future<std::shared_ptr<ChunkBody>>> pending;
+
   // read through record file
   reader_.Reset();
+  // checksum announced by the preceding chunk header, when present
+  bool has_expected_crc32 = false;
+  uint32_t expected_crc32 = 0;
   while (!reader_.EndOfFile()) {
     Section section;
     if (!reader_.ReadSection(&section)) {
@@ -94,20 +109,41 @@ bool Recoverer::Proc() {
       }
       case SectionType::SECTION_CHUNK_HEADER: {
         ChunkHeader chdr;
+        has_expected_crc32 = false;
         if (!reader_.ReadSection<ChunkHeader>(section.size, &chdr)) {
           AINFO << "one chunk header section broken, skip it.";
+          break;
+        }
+        if (chdr.has_crc32()) {
+          has_expected_crc32 = true;
+          expected_crc32 = chdr.crc32();
         }
         break;
       }
       case SectionType::SECTION_CHUNK_BODY: {
-        ChunkBody cbd;
-        if (!reader_.ReadSection<ChunkBody>(section.size, &cbd)) {
+        auto raw = std::make_shared<std::string>();
+        if (!reader_.ReadSectionRaw(section.size, raw.get())) {
           AINFO << "one chunk body section broken, skip it";
+          has_expected_crc32 = false;
           break;
         }
-        for (int idx = 0; idx < cbd.messages_size(); ++idx) {
-          if (!writer_.WriteMessage(cbd.messages(idx))) {
-            AERROR << "add new message failed.";
+        // a mismatching checksum catches corruption before the protobuf
+        // parse, without it a truncated body may still parse partially
+        if (has_expected_crc32 &&
+            Crc32(raw->data(), raw->size()) != expected_crc32) {
+          AINFO << "one chunk body fails the crc check, skip it.";
+          has_expected_crc32 = false;
+          break;
+        }
+        has_expected_crc32 = false;
+        pending.emplace_back(pool.Enqueue(&Recoverer::DecodeChunk, this, raw));
+        if (!pending.back().valid()) {
+          AERROR << "enqueue chunk decode task fail.";
+          return false;
+        }
+        // Bound the number of raw chunks held in memory.
+        while (pending.size() > thread_num * 2) {
+          if (!WriteOldestChunk(&pending)) {
             return false;
           }
         }
@@ -120,10 +156,43 @@ bool Recoverer::Proc() {
       }
     }  // end for switch
   }    // end for while
+
+  while (!pending.empty()) {
+    if (!WriteOldestChunk(&pending)) {
+      return false;
+    }
+  }
+
   AINFO << "recover record file done.";
   return true;
 }  // end for Proc()
 
+std::shared_ptr<ChunkBody> Recoverer::DecodeChunk(
+    const std::shared_ptr<std::string>& raw) {
+  auto cbd = std::make_shared<ChunkBody>();
+  if (!cbd->ParseFromString(*raw)) {
+    return nullptr;
+  }
+  return cbd;
+}
+
+bool Recoverer::WriteOldestChunk(
+    std::deque<std::future<std::shared_ptr<ChunkBody>>>* pending) {
+  auto cbd = pending->front().get();
+  pending->pop_front();
+  if (cbd == nullptr) {
+    AINFO << "one chunk body section broken, skip it";
+    return true;
+  }
+  for (int idx = 0; idx < cbd->messages_size(); ++idx) {
+    if (!writer_.WriteMessage(cbd->messages(idx))) {
+      AERROR << "add new message failed.";
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
@@ -18,6 +18,8 @@
 #define CYBER_TOOLS_CYBER_RECORDER_RECOVERER_H_
 
 #include <algorithm>
+#include <deque>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -43,6 +45,16 @@ class Recoverer {
   bool Proc();
 
  private:
+  // Runs on a worker thread: parses a raw chunk body, returning nullptr
+  // when the chunk is broken.
+  std::shared_ptr<ChunkBody> DecodeChunk(
+      const std::shared_ptr<std::string>& raw);
+  // Writes the messages of the oldest in-flight chunk; broken chunks are
+  // skipped. Chunks are consumed in submission order to keep the output
+  // ordering.
+  bool WriteOldestChunk(
+      std::deque<std::future<std::shared_ptr<ChunkBody>>>* pending);
+
   RecordFileReader reader_;
   RecordFileWriter writer_;
   std::string input_file_;
@@ -16,6 +16,10 @@
 
 #include "cyber/tools/cyber_recorder/spliter.h"
 
+#include <thread>
+
+#include "cyber/base/thread_pool.h"
+
 namespace apollo {
 namespace cyber {
 namespace record {
@@ -74,6 +78,14 @@ bool Spliter::Proc() {
     return false;
   }
 
+  // Chunk bodies are decoded and filtered on a worker pool while this
+  // thread keeps reading; results are consumed in submission order so the
+  // output keeps the input ordering.
+  const size_t thread_num =
+      std::max<size_t>(std::thread::hardware_concurrency(), 2);
+  base::ThreadPool pool(thread_num);
+  std::deque<std::future<std::shared_ptr<ChunkBody>>> pending;
+
   // read through record file
   bool skip_next_chunk_body(false);
   reader_.Reset();
@@ -120,29 +132,20 @@ bool Spliter::Proc() {
           skip_next_chunk_body = false;
           break;
         }
-        ChunkBody cbd;
-        if (!reader_.ReadSection<ChunkBody>(section.size, &cbd)) {
+        auto raw = std::make_shared<std::string>();
+        if (!reader_.ReadSectionRaw(section.size, raw.get())) {
           AERROR << "read chunk body section fail.";
           return false;
         }
-        for (int idx = 0; idx < cbd.messages_size(); ++idx) {
-          if (!white_channels_.empty() &&
-              std::find(white_channels_.begin(), white_channels_.end(),
-                        cbd.messages(idx).channel_name()) ==
-                  white_channels_.end()) {
-            continue;
-          }
-          if (std::find(black_channels_.begin(), black_channels_.end(),
-                        cbd.messages(idx).channel_name()) !=
-              black_channels_.end()) {
-            continue;
-          }
-          if (cbd.messages(idx).time() < begin_time_ ||
-              cbd.messages(idx).time() > end_time_) {
-            continue;
-          }
-          if (!writer_.WriteMessage(cbd.messages(idx))) {
-            AERROR << "add new message failed.";
+        pending.emplace_back(
+            pool.Enqueue(&Spliter::DecodeAndFilterChunk, this, raw));
+        if (!pending.back().valid()) {
+          AERROR << "enqueue chunk decode task fail.";
+          return false;
+        }
+        // Bound the number of raw chunks held in memory.
+        while (pending.size() > thread_num * 2) {
+          if (!WriteOldestChunk(&pending)) {
             return false;
           }
         }
@@ -155,10 +158,60 @@ bool Spliter::Proc() {
       }
     }  // end for switch
   }    // end for while
+
+  while (!pending.empty()) {
+    if (!WriteOldestChunk(&pending)) {
+      return false;
+    }
+  }
+
   AINFO << "split record file done.";
   return true;
 }  // end for Proc()
 
+std::shared_ptr<ChunkBody> Spliter::DecodeAndFilterChunk(
+    const std::shared_ptr<std::string>& raw) {
+  ChunkBody cbd;
+  if (!cbd.ParseFromString(*raw)) {
+    AERROR << "parse chunk body section fail.";
+    return nullptr;
+  }
+  auto filtered = std::make_shared<ChunkBody>();
+  for (int idx = 0; idx < cbd.messages_size(); ++idx) {
+    if (!white_channels_.empty() &&
+        std::find(white_channels_.begin(), white_channels_.end(),
+                  cbd.messages(idx).channel_name()) == white_channels_.end()) {
+      continue;
+    }
+    if (std::find(black_channels_.begin(), black_channels_.end(),
+                  cbd.messages(idx).channel_name()) != black_channels_.end()) {
+      continue;
+    }
+    if (cbd.messages(idx).time() < begin_time_ ||
+        cbd.messages(idx).time() > end_time_) {
+      continue;
+    }
+    *filtered->add_messages() = cbd.messages(idx);
+  }
+  return filtered;
+}
+
+bool Spliter::WriteOldestChunk(
+    std::deque<std::future<std::shared_ptr<ChunkBody>>>* pending) {
+  auto cbd = pending->front().get();
+  pending->pop_front();
+  if (cbd == nullptr) {
+    return false;
+  }
+  for (int idx = 0; idx < cbd->messages_size(); ++idx) {
+    if (!writer_.WriteMessage(cbd->messages(idx))) {
+      AERROR << "add new message failed.";
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
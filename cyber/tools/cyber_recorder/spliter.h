@@ -18,6 +18,8 @@
 #define CYBER_TOOLS_CYBER_RECORDER_SPLITER_H_
 
 #include <algorithm>
+#include <deque>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -47,6 +49,16 @@ class Spliter {
   bool Proc();
 
  private:
+  // Runs on a worker thread: parses a raw chunk body and drops the
+  // messages that do not pass the channel and time filters. Returns
+  // nullptr when the chunk is broken.
+  std::shared_ptr<ChunkBody> DecodeAndFilterChunk(
+      const std::shared_ptr<std::string>& raw);
+  // Writes the filtered messages of the oldest in-flight chunk; chunks
+  // are consumed in submission order to keep the output ordering.
+  bool WriteOldestChunk(
+      std::deque<std::future<std::shared_ptr<ChunkBody>>>* pending);
+
   RecordFileReader reader_;
   RecordFileWriter writer_;
   std::string input_file_;
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "cyber/event/sched_trace.h"
+
+using apollo::cyber::event::SchedTrace;
+
+namespace {
+
+const char* EventName(uint16_t event) {
+  switch (event) {
+    case 1:
+      return "SWAP_IN";
+    case 2:
+      return "SWAP_OUT";
+    case 3:
+      return "NOTIFY_IN";
+    case 4:
+      return "NEXT_RT";
+    case 5:
+      return "RT_CREATE";
+    case 6:
+      return "TIMER_JITTER";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+void DisplayUsage() {
+  std::cout << "usage: cyber_trace <sched_trace_dump_file>\n"
+            << "  decodes a binary scheduling trace written by\n"
+            << "  SchedTrace::DumpToFile into tab-separated text:\n"
+            << "  tsc  event  croutine_id  processor  state" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    DisplayUsage();
+    return -1;
+  }
+
+  std::ifstream in(argv[1], std::ios::binary);
+  if (!in.is_open()) {
+    std::cerr << "Open trace file [" << argv[1] << "] failed." << std::endl;
+    return -1;
+  }
+
+  SchedTrace::DumpHeader header;
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!in.good() ||
+      std::memcmp(header.magic, SchedTrace::kMagic, sizeof(header.magic)) !=
+          0) {
+    std::cerr << "File [" << argv[1] << "] is not a sched trace dump."
+              << std::endl;
+    return -1;
+  }
+  if (header.record_size != sizeof(SchedTrace::Record)) {
+    std::cerr << "Record size mismatch (file: " << header.record_size
+              << ", tool: " << sizeof(SchedTrace::Record)
+              << "), rebuild the tool against this tree." << std::endl;
+    return -1;
+  }
+
+  std::cout << "tsc\tevent\tcroutine_id\tprocessor\tstate" << std::endl;
+  SchedTrace::Record record;
+  for (uint64_t i = 0; i < header.count; ++i) {
+    in.read(reinterpret_cast<char*>(&record), sizeof(record));
+    if (!in.good()) {
+      std::cerr << "Truncated dump, stopped after " << i << " of "
+                << header.count << " records." << std::endl;
+      break;
+    }
+    std::cout << record.tsc << "\t" << EventName(record.event) << "\t"
+              << record.cr_id << "\t" << record.proc_id << "\t"
+              << record.cr_state << std::endl;
+  }
+  return 0;
+}
@@ -26,7 +26,9 @@ namespace transport {
 
 using common::GlobalData;
 
-ShmDispatcher::ShmDispatcher() : host_id_(0) { Init(); }
+ShmDispatcher::ShmDispatcher() : host_id_(0), zero_copy_read_(false) {
+  Init();
+}
 
 ShmDispatcher::~ShmDispatcher() { Shutdown(); }
 
@@ -60,9 +62,19 @@ void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index) {
   ADEBUG << "Reading sharedmem message: "
          << GlobalData::GetChannelById(channel_id)
          << " from block: " << block_index;
-  auto rb = std::make_shared<ReadableBlock>();
+  auto segment = segments_[channel_id];
+  // The read lock is held until the last reference to the block is dropped,
+  // so zero-copy listeners may keep parsing from the mapped region after
+  // this function returns.
+  auto rb = std::shared_ptr<ReadableBlock>(new ReadableBlock(),
+                                           [segment](ReadableBlock* block) {
+                                             if (block->block != nullptr) {
+                                               segment->ReleaseReadBlock(*block);
+                                             }
+                                             delete block;
+                                           });
   rb->index = block_index;
-  if (!segments_[channel_id]->AcquireBlockToRead(rb.get())) {
+  if (!segment->AcquireBlockToRead(rb.get())) {
     AWARN << "fail to acquire block, channel: "
           << GlobalData::GetChannelById(channel_id)
           << " index: " << block_index;
@@ -79,7 +91,6 @@ void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index) {
     AERROR << "error msg info of channel:"
            << GlobalData::GetChannelById(channel_id);
   }
-  segments_[channel_id]->ReleaseReadBlock(*rb);
 }
 
 void ShmDispatcher::OnMessage(uint64_t channel_id,
@@ -146,6 +157,11 @@ void ShmDispatcher::ThreadFunc() {
 
 bool ShmDispatcher::Init() {
   host_id_ = common::Hash(GlobalData::Instance()->HostIp());
+  auto& g_conf = GlobalData::Instance()->Config();
+  if (g_conf.has_transport_conf() && g_conf.transport_conf().has_shm_conf() &&
+      g_conf.transport_conf().shm_conf().has_zero_copy_read()) {
+    zero_copy_read_ = g_conf.transport_conf().shm_conf().zero_copy_read();
+  }
   notifier_ = NotifierFactory::CreateNotifier();
   thread_ = std::thread(&ShmDispatcher::ThreadFunc, this);
   scheduler::Instance()->SetInnerThreadAttr("shm_disp", &thread_);
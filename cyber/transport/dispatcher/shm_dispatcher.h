@@ -23,6 +23,8 @@
 #include <thread>
 #include <unordered_map>
 
+#include "google/protobuf/arena.h"
+
 #include "cyber/base/atomic_rw_lock.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
@@ -68,7 +70,41 @@ class ShmDispatcher : public Dispatcher {
   void ThreadFunc();
   bool Init();
 
+  // Deserializes from the mapped block into an arena-backed message. The
+  // returned message shares ownership of the pinned block, so the block's
+  // read lock is released only after the last listener drops the message.
+  template <typename MessageT,
+            typename std::enable_if<
+                std::is_base_of<google::protobuf::Message, MessageT>::value,
+                int>::type = 0>
+  static std::shared_ptr<MessageT> ParseFromBlock(
+      const std::shared_ptr<ReadableBlock>& rb) {
+    auto arena = std::make_shared<google::protobuf::Arena>();
+    MessageT* msg = google::protobuf::Arena::CreateMessage<MessageT>(
+        arena.get());
+    if (!msg->ParseFromArray(rb->buf,
+                             static_cast<int>(rb->block->msg_size()))) {
+      return nullptr;
+    }
+    return std::shared_ptr<MessageT>(msg, [arena, rb](MessageT*) {});
+  }
+
+  template <typename MessageT,
+            typename std::enable_if<
+                !std::is_base_of<google::protobuf::Message, MessageT>::value,
+                int>::type = 0>
+  static std::shared_ptr<MessageT> ParseFromBlock(
+      const std::shared_ptr<ReadableBlock>& rb) {
+    auto msg = std::make_shared<MessageT>();
+    if (!message::ParseFromArray(
+            rb->buf, static_cast<int>(rb->block->msg_size()), msg.get())) {
+      return nullptr;
+    }
+    return msg;
+  }
+
   uint64_t host_id_;
+  bool zero_copy_read_;
   SegmentContainer segments_;
   std::unordered_map<uint64_t, uint32_t> previous_indexes_;
   AtomicRWLock segments_lock_;
@@ -82,8 +118,16 @@ template <typename MessageT>
 void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const MessageListener<MessageT>& listener) {
   // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
+  bool zero_copy = zero_copy_read_;
+  auto listener_adapter = [listener, zero_copy](
+                              const std::shared_ptr<ReadableBlock>& rb,
+                              const MessageInfo& msg_info) {
+    if (zero_copy) {
+      auto msg = ParseFromBlock<MessageT>(rb);
+      RETURN_IF_NULL(msg);
+      listener(msg, msg_info);
+      return;
+    }
     auto msg = std::make_shared<MessageT>();
     RETURN_IF(!message::ParseFromArray(
         rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
@@ -99,8 +143,16 @@ void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const RoleAttributes& opposite_attr,
                                 const MessageListener<MessageT>& listener) {
   // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
+  bool zero_copy = zero_copy_read_;
+  auto listener_adapter = [listener, zero_copy](
+                              const std::shared_ptr<ReadableBlock>& rb,
+                              const MessageInfo& msg_info) {
+    if (zero_copy) {
+      auto msg = ParseFromBlock<MessageT>(rb);
+      RETURN_IF_NULL(msg);
+      listener(msg, msg_info);
+      return;
+    }
     auto msg = std::make_shared<MessageT>();
     RETURN_IF(!message::ParseFromArray(
         rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
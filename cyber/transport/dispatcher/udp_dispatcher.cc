@@ -0,0 +1,65 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/dispatcher/udp_dispatcher.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+UdpDispatcher::UdpDispatcher() {}
+
+UdpDispatcher::~UdpDispatcher() { Shutdown(); }
+
+void UdpDispatcher::Shutdown() {
+  if (is_shutdown_.exchange(true)) {
+    return;
+  }
+
+  auto bridge = UdpBridge::Instance(false);
+  if (bridge != nullptr) {
+    bridge->Shutdown();
+  }
+}
+
+void UdpDispatcher::AddSubscriber(const RoleAttributes& self_attr) {
+  // the bridge socket machinery starts on the first subscription
+  auto bridge = UdpBridge::Instance();
+  RETURN_IF_NULL(bridge);
+  bridge->SetMessageCallback(
+      std::bind(&UdpDispatcher::OnMessage, this, std::placeholders::_1,
+                std::placeholders::_2, std::placeholders::_3));
+  bridge->AddChannel(self_attr.channel_id());
+}
+
+void UdpDispatcher::OnMessage(uint64_t channel_id,
+                              const std::shared_ptr<std::string>& msg_str,
+                              const MessageInfo& msg_info) {
+  if (is_shutdown_.load()) {
+    return;
+  }
+
+  ListenerHandlerBasePtr* handler_base = nullptr;
+  if (msg_listeners_.Get(channel_id, &handler_base)) {
+    auto handler =
+        std::dynamic_pointer_cast<ListenerHandler<std::string>>(*handler_base);
+    handler->Run(msg_str, msg_info);
+  }
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
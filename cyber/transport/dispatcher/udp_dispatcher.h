@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_DISPATCHER_UDP_DISPATCHER_H_
+#define CYBER_TRANSPORT_DISPATCHER_UDP_DISPATCHER_H_
+
+#include <memory>
+#include <string>
+
+#include "cyber/common/log.h"
+#include "cyber/common/macros.h"
+#include "cyber/message/message_traits.h"
+#include "cyber/transport/dispatcher/dispatcher.h"
+#include "cyber/transport/udp/udp_bridge.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+class UdpDispatcher;
+using UdpDispatcherPtr = UdpDispatcher*;
+
+class UdpDispatcher : public Dispatcher {
+ public:
+  virtual ~UdpDispatcher();
+
+  void Shutdown() override;
+
+  template <typename MessageT>
+  void AddListener(const RoleAttributes& self_attr,
+                   const MessageListener<MessageT>& listener);
+
+  template <typename MessageT>
+  void AddListener(const RoleAttributes& self_attr,
+                   const RoleAttributes& opposite_attr,
+                   const MessageListener<MessageT>& listener);
+
+ private:
+  void OnMessage(uint64_t channel_id,
+                 const std::shared_ptr<std::string>& msg_str,
+                 const MessageInfo& msg_info);
+  void AddSubscriber(const RoleAttributes& self_attr);
+
+  DECLARE_SINGLETON(UdpDispatcher)
+};
+
+template <typename MessageT>
+void UdpDispatcher::AddListener(const RoleAttributes& self_attr,
+                                const MessageListener<MessageT>& listener) {
+  auto listener_adapter = [listener](
+                              const std::shared_ptr<std::string>& msg_str,
+                              const MessageInfo& msg_info) {
+    auto msg = std::make_shared<MessageT>();
+    RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
+    listener(msg, msg_info);
+  };
+
+  Dispatcher::AddListener<std::string>(self_attr, listener_adapter);
+  AddSubscriber(self_attr);
+}
+
+template <typename MessageT>
+void UdpDispatcher::AddListener(const RoleAttributes& self_attr,
+                                const RoleAttributes& opposite_attr,
+                                const MessageListener<MessageT>& listener) {
+  auto listener_adapter = [listener](
+                              const std::shared_ptr<std::string>& msg_str,
+                              const MessageInfo& msg_info) {
+    auto msg = std::make_shared<MessageT>();
+    RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
+    listener(msg, msg_info);
+  };
+
+  Dispatcher::AddListener<std::string>(self_attr, opposite_attr,
+                                       listener_adapter);
+  AddSubscriber(self_attr);
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_DISPATCHER_UDP_DISPATCHER_H_
@@ -0,0 +1,182 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_MESSAGE_BUFFER_CHAIN_H_
+#define CYBER_TRANSPORT_MESSAGE_BUFFER_CHAIN_H_
+
+#include <google/protobuf/io/zero_copy_stream.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cyber/base/concurrent_object_pool.h"
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// Fixed-size fragment drawn from a shared pool. Large messages serialize
+// into a chain of these instead of one contiguous multi-megabyte buffer.
+struct BufferFragment {
+  static const std::size_t kSize = 64 * 1024;
+  uint8_t data[kSize];
+};
+
+using BufferFragmentPool = base::CCObjectPool<BufferFragment>;
+using BufferFragmentPoolPtr = std::shared_ptr<BufferFragmentPool>;
+
+// A ZeroCopyOutputStream that serializes into pooled fixed-size
+// fragments. Fragments are returned to the pool when the chain goes away,
+// so steady-state publishing does no heap allocation proportional to
+// message size.
+class BufferChainOutputStream
+    : public google::protobuf::io::ZeroCopyOutputStream {
+ public:
+  explicit BufferChainOutputStream(const BufferFragmentPoolPtr& pool)
+      : pool_(pool) {}
+  virtual ~BufferChainOutputStream() {}
+
+  bool Next(void** data, int* size) override {
+    auto fragment = pool_->GetObject();
+    if (fragment == nullptr) {
+      // pool exhausted, fall back to heap so the publish still succeeds
+      fragment = std::make_shared<BufferFragment>();
+    }
+    fragments_.push_back(fragment);
+    *data = fragment->data;
+    *size = static_cast<int>(BufferFragment::kSize);
+    last_returned_size_ = BufferFragment::kSize;
+    byte_count_ += static_cast<int64_t>(BufferFragment::kSize);
+    return true;
+  }
+
+  void BackUp(int count) override {
+    byte_count_ -= count;
+    last_returned_size_ -= static_cast<std::size_t>(count);
+  }
+
+  int64_t ByteCount() const override { return byte_count_; }
+
+  // size of the serialized payload spread over the chain
+  std::size_t Size() const { return static_cast<std::size_t>(byte_count_); }
+
+  const std::vector<std::shared_ptr<BufferFragment>>& fragments() const {
+    return fragments_;
+  }
+
+  // bytes used in the trailing fragment (all others are fully used)
+  std::size_t LastFragmentSize() const { return last_returned_size_; }
+
+  // gather the chain into a contiguous destination, e.g. an underlay
+  // message payload that a wire transport requires to be contiguous
+  void CopyTo(std::string* output) const {
+    output->clear();
+    output->reserve(Size());
+    for (std::size_t i = 0; i < fragments_.size(); ++i) {
+      std::size_t len = (i + 1 == fragments_.size()) ? last_returned_size_
+                                                     : BufferFragment::kSize;
+      output->append(reinterpret_cast<const char*>(fragments_[i]->data), len);
+    }
+  }
+
+ private:
+  BufferFragmentPoolPtr pool_;
+  std::vector<std::shared_ptr<BufferFragment>> fragments_;
+  std::size_t last_returned_size_ = 0;
+  int64_t byte_count_ = 0;
+};
+
+// A ZeroCopyInputStream over a fragment chain, so a receiver can parse a
+// reassembled message without first gluing the fragments together.
+class BufferChainInputStream
+    : public google::protobuf::io::ZeroCopyInputStream {
+ public:
+  BufferChainInputStream(
+      const std::vector<std::shared_ptr<BufferFragment>>& fragments,
+      std::size_t total_size)
+      : fragments_(fragments), total_size_(total_size) {}
+  virtual ~BufferChainInputStream() {}
+
+  bool Next(const void** data, int* size) override {
+    if (position_ >= total_size_ || fragment_index_ >= fragments_.size()) {
+      return false;
+    }
+    std::size_t remain_in_fragment = BufferFragment::kSize - fragment_offset_;
+    std::size_t remain_total = total_size_ - position_;
+    std::size_t len = std::min(remain_in_fragment, remain_total);
+    *data = fragments_[fragment_index_]->data + fragment_offset_;
+    *size = static_cast<int>(len);
+    position_ += len;
+    fragment_offset_ += len;
+    if (fragment_offset_ == BufferFragment::kSize) {
+      ++fragment_index_;
+      fragment_offset_ = 0;
+    }
+    last_returned_size_ = len;
+    return true;
+  }
+
+  void BackUp(int count) override {
+    auto n = static_cast<std::size_t>(count);
+    position_ -= n;
+    if (fragment_offset_ >= n) {
+      fragment_offset_ -= n;
+    } else {
+      --fragment_index_;
+      fragment_offset_ = BufferFragment::kSize - (n - fragment_offset_);
+    }
+    last_returned_size_ -= n;
+  }
+
+  bool Skip(int count) override {
+    auto n = static_cast<std::size_t>(count);
+    if (position_ + n > total_size_) {
+      return false;
+    }
+    while (n > 0) {
+      std::size_t remain_in_fragment = BufferFragment::kSize - fragment_offset_;
+      std::size_t len = std::min(remain_in_fragment, n);
+      position_ += len;
+      fragment_offset_ += len;
+      if (fragment_offset_ == BufferFragment::kSize) {
+        ++fragment_index_;
+        fragment_offset_ = 0;
+      }
+      n -= len;
+    }
+    return true;
+  }
+
+  int64_t ByteCount() const override {
+    return static_cast<int64_t>(position_);
+  }
+
+ private:
+  std::vector<std::shared_ptr<BufferFragment>> fragments_;
+  std::size_t total_size_ = 0;
+  std::size_t position_ = 0;
+  std::size_t fragment_index_ = 0;
+  std::size_t fragment_offset_ = 0;
+  std::size_t last_returned_size_ = 0;
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_MESSAGE_BUFFER_CHAIN_H_
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/message/buffer_chain.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "cyber/proto/unit_test.pb.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+TEST(BufferChainTest, round_trip_small_message) {
+  auto pool = std::make_shared<BufferFragmentPool>(4);
+  proto::UnitTest message;
+  message.set_class_name("BufferChainTest");
+  message.set_case_name("round_trip_small_message");
+
+  BufferChainOutputStream output(pool);
+  EXPECT_TRUE(message.SerializeToZeroCopyStream(&output));
+  EXPECT_EQ(static_cast<std::size_t>(message.ByteSize()), output.Size());
+  EXPECT_EQ(1, output.fragments().size());
+
+  BufferChainInputStream input(output.fragments(), output.Size());
+  proto::UnitTest parsed;
+  EXPECT_TRUE(parsed.ParseFromZeroCopyStream(&input));
+  EXPECT_EQ(message.class_name(), parsed.class_name());
+  EXPECT_EQ(message.case_name(), parsed.case_name());
+}
+
+TEST(BufferChainTest, round_trip_multi_fragment_message) {
+  auto pool = std::make_shared<BufferFragmentPool>(8);
+  proto::UnitTest message;
+  message.set_class_name("BufferChainTest");
+  // payload larger than one fragment so the chain must grow
+  message.set_case_name(std::string(3 * BufferFragment::kSize, 'x'));
+
+  BufferChainOutputStream output(pool);
+  EXPECT_TRUE(message.SerializeToZeroCopyStream(&output));
+  EXPECT_EQ(static_cast<std::size_t>(message.ByteSize()), output.Size());
+  EXPECT_GT(output.fragments().size(), 1);
+
+  BufferChainInputStream input(output.fragments(), output.Size());
+  proto::UnitTest parsed;
+  EXPECT_TRUE(parsed.ParseFromZeroCopyStream(&input));
+  EXPECT_EQ(message.case_name(), parsed.case_name());
+}
+
+TEST(BufferChainTest, copy_to_contiguous_buffer) {
+  auto pool = std::make_shared<BufferFragmentPool>(8);
+  proto::UnitTest message;
+  message.set_case_name(std::string(2 * BufferFragment::kSize + 17, 'y'));
+
+  BufferChainOutputStream output(pool);
+  EXPECT_TRUE(message.SerializeToZeroCopyStream(&output));
+
+  std::string contiguous;
+  output.CopyTo(&contiguous);
+  EXPECT_EQ(output.Size(), contiguous.size());
+
+  proto::UnitTest parsed;
+  EXPECT_TRUE(parsed.ParseFromString(contiguous));
+  EXPECT_EQ(message.case_name(), parsed.case_name());
+}
+
+TEST(BufferChainTest, pool_exhaustion_falls_back_to_heap) {
+  auto pool = std::make_shared<BufferFragmentPool>(1);
+  proto::UnitTest message;
+  message.set_case_name(std::string(3 * BufferFragment::kSize, 'z'));
+
+  BufferChainOutputStream output(pool);
+  EXPECT_TRUE(message.SerializeToZeroCopyStream(&output));
+
+  BufferChainInputStream input(output.fragments(), output.Size());
+  proto::UnitTest parsed;
+  EXPECT_TRUE(parsed.ParseFromZeroCopyStream(&input));
+  EXPECT_EQ(message.case_name(), parsed.case_name());
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
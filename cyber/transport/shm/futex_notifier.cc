@@ -0,0 +1,262 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/shm/futex_notifier.h"
+
+#include <linux/futex.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <chrono>
+#include <ctime>
+#include <thread>
+
+#include "cyber/common/log.h"
+#include "cyber/common/util.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+using common::Hash;
+
+FutexNotifier::FutexNotifier() {
+  key_ = static_cast<key_t>(Hash("/apollo/cyber/transport/shm/futex_notifier"));
+  ADEBUG << "futex notifier key: " << key_;
+  shm_size_ = sizeof(Indicator);
+
+  if (!Init()) {
+    AERROR << "fail to init futex notifier.";
+    is_shutdown_.store(true);
+    return;
+  }
+  next_seq_ = indicator_->next_seq.load();
+  ADEBUG << "next_seq: " << next_seq_;
+}
+
+FutexNotifier::~FutexNotifier() { Shutdown(); }
+
+void FutexNotifier::Shutdown() {
+  if (is_shutdown_.exchange(true)) {
+    return;
+  }
+
+  // wake up any listener parked on the futex so it can observe shutdown
+  if (indicator_ != nullptr) {
+    indicator_->futex_seq.fetch_add(1);
+    Wake();
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  Reset();
+}
+
+bool FutexNotifier::Notify(const ReadableInfo& info) {
+  if (is_shutdown_.load()) {
+    ADEBUG << "notifier is shutdown.";
+    return false;
+  }
+
+  uint64_t seq = indicator_->next_seq.fetch_add(1);
+  uint64_t idx = seq % kFutexBufLength;
+  indicator_->infos[idx] = info;
+  indicator_->seqs[idx] = seq;
+
+  indicator_->futex_seq.fetch_add(1, std::memory_order_release);
+  Wake();
+  return true;
+}
+
+bool FutexNotifier::Listen(int timeout_ms, ReadableInfo* info) {
+  if (info == nullptr) {
+    AERROR << "info nullptr.";
+    return false;
+  }
+
+  if (is_shutdown_.load()) {
+    ADEBUG << "notifier is shutdown.";
+    return false;
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(timeout_ms);
+  while (!is_shutdown_.load()) {
+    // drain the ring first, so a burst costs one wakeup and no extra
+    // syscalls until all pending entries have been consumed
+    uint64_t seq = indicator_->next_seq.load();
+    if (seq != next_seq_) {
+      auto idx = next_seq_ % kFutexBufLength;
+      uint64_t slot_seq = indicator_->seqs[idx];
+      if (slot_seq == next_seq_) {
+        *info = indicator_->infos[idx];
+        ++next_seq_;
+        return true;
+      }
+      if (slot_seq > next_seq_) {
+        // the writer has lapped us: the slot already holds a newer entry
+        // and the seq we are waiting for can never appear again. Jump to
+        // the oldest entry that may still be in the ring; the entries in
+        // between are lost. Reloading next_seq after seeing the newer slot
+        // guarantees the jump lands strictly past our stale cursor.
+        uint64_t oldest = indicator_->next_seq.load() - kFutexBufLength;
+        AWARN << "listener lapped by writer, dropped " << oldest - next_seq_
+              << " entries, seq jumps from " << next_seq_ << " to " << oldest;
+        next_seq_ = oldest;
+        continue;
+      }
+      // the writer claimed the slot but has not finished filling it;
+      // skipping ahead here would drop the entry, so fall through and wait
+    }
+
+    uint32_t old_futex_seq =
+        indicator_->futex_seq.load(std::memory_order_acquire);
+    auto remain = std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadline - std::chrono::steady_clock::now());
+    if (remain.count() <= 0) {
+      return false;
+    }
+    // re-check after reading the futex word to close the notify window
+    if (indicator_->next_seq.load() != next_seq_) {
+      continue;
+    }
+    if (!Wait(old_futex_seq, static_cast<int>(remain.count()))) {
+      return false;
+    }
+  }
+  return false;
+}
+
+void FutexNotifier::Wake() {
+  syscall(SYS_futex, &indicator_->futex_seq, FUTEX_WAKE, INT32_MAX, nullptr,
+          nullptr, 0);
+}
+
+bool FutexNotifier::Wait(uint32_t old_futex_seq, int timeout_ms) {
+  struct timespec timeout;
+  timeout.tv_sec = timeout_ms / 1000;
+  timeout.tv_nsec = (timeout_ms % 1000) * 1000 * 1000;
+  int ret = static_cast<int>(syscall(SYS_futex, &indicator_->futex_seq,
+                                     FUTEX_WAIT, old_futex_seq, &timeout,
+                                     nullptr, 0));
+  if (ret == -1 && errno == ETIMEDOUT) {
+    return false;
+  }
+  // EAGAIN means the word already changed; both cases mean "look again"
+  return true;
+}
+
+bool FutexNotifier::Init() { return OpenOrCreate(); }
+
+bool FutexNotifier::OpenOrCreate() {
+  // create managed_shm_
+  int retry = 0;
+  int shmid = 0;
+  while (retry < 2) {
+    shmid = shmget(key_, shm_size_, 0644 | IPC_CREAT | IPC_EXCL);
+    if (shmid != -1) {
+      break;
+    }
+
+    if (EINVAL == errno) {
+      AINFO << "need larger space, recreate.";
+      Reset();
+      Remove();
+      ++retry;
+    } else if (EEXIST == errno) {
+      ADEBUG << "shm already exist, open only.";
+      return OpenOnly();
+    } else {
+      break;
+    }
+  }
+
+  if (shmid == -1) {
+    AERROR << "create shm failed, error code: " << strerror(errno);
+    return false;
+  }
+
+  // attach managed_shm_
+  managed_shm_ = shmat(shmid, nullptr, 0);
+  if (managed_shm_ == reinterpret_cast<void*>(-1)) {
+    AERROR << "attach shm failed.";
+    shmctl(shmid, IPC_RMID, 0);
+    return false;
+  }
+
+  // create indicator_
+  indicator_ = new (managed_shm_) Indicator();
+  if (indicator_ == nullptr) {
+    AERROR << "create indicator failed.";
+    shmdt(managed_shm_);
+    managed_shm_ = nullptr;
+    shmctl(shmid, IPC_RMID, 0);
+    return false;
+  }
+
+  ADEBUG << "open or create true.";
+  return true;
+}
+
+bool FutexNotifier::OpenOnly() {
+  // get managed_shm_
+  int shmid = shmget(key_, 0, 0644);
+  if (shmid == -1) {
+    AERROR << "get shm failed.";
+    return false;
+  }
+
+  // attach managed_shm_
+  managed_shm_ = shmat(shmid, nullptr, 0);
+  if (managed_shm_ == reinterpret_cast<void*>(-1)) {
+    AERROR << "attach shm failed.";
+    return false;
+  }
+
+  // get indicator_
+  indicator_ = reinterpret_cast<Indicator*>(managed_shm_);
+  if (indicator_ == nullptr) {
+    AERROR << "get indicator failed.";
+    shmdt(managed_shm_);
+    managed_shm_ = nullptr;
+    return false;
+  }
+
+  ADEBUG << "open true.";
+  return true;
+}
+
+bool FutexNotifier::Remove() {
+  int shmid = shmget(key_, 0, 0644);
+  if (shmid == -1 || shmctl(shmid, IPC_RMID, 0) == -1) {
+    AERROR << "remove shm failed, error code: " << strerror(errno);
+    return false;
+  }
+  ADEBUG << "remove success.";
+
+  return true;
+}
+
+void FutexNotifier::Reset() {
+  indicator_ = nullptr;
+  if (managed_shm_ != nullptr) {
+    shmdt(managed_shm_);
+    managed_shm_ = nullptr;
+  }
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
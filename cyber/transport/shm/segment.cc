@@ -16,26 +16,49 @@
 
 #include "cyber/transport/shm/segment.h"
 
+#include <sys/syscall.h>
+#include <unistd.h>
 #include <algorithm>
 
+#include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/common/util.h"
 #include "cyber/transport/shm/shm_conf.h"
 
+#ifndef SHM_HUGETLB
+#define SHM_HUGETLB 04000
+#endif
+
+#ifndef MPOL_BIND
+#define MPOL_BIND 2
+#endif
+
 namespace apollo {
 namespace cyber {
 namespace transport {
 
+namespace {
+const uint64_t kHugePageSize = 2 * 1024 * 1024;
+}  // namespace
+
 Segment::Segment(uint64_t channel_id, const ReadWriteMode& mode)
     : init_(false),
       mode_(mode),
       conf_(),
+      use_huge_pages_(false),
+      numa_node_(-1),
       state_(nullptr),
       blocks_(nullptr),
       managed_shm_(nullptr),
       block_buf_lock_(),
       block_buf_addrs_() {
   id_ = static_cast<key_t>(channel_id);
+  auto& g_conf = common::GlobalData::Instance()->Config();
+  if (g_conf.has_transport_conf() && g_conf.transport_conf().has_shm_conf()) {
+    auto& shm_conf = g_conf.transport_conf().shm_conf();
+    use_huge_pages_ = shm_conf.use_huge_pages();
+    numa_node_ = shm_conf.numa_node();
+  }
 }
 
 Segment::~Segment() { Destroy(); }
@@ -54,7 +77,10 @@ bool Segment::AcquireBlockToWrite(std::size_t msg_size,
   }
 
   if (msg_size > conf_.ceiling_msg_size()) {
-    conf_.Update(msg_size);
+    // Grow with headroom so a steadily growing message (e.g. the first
+    // full-resolution image after startup) triggers a single recreate
+    // instead of one stop-the-world remap per size step.
+    conf_.Update(msg_size + (msg_size >> 1));
     result = Recreate();
   }
 
@@ -117,6 +143,13 @@ void Segment::ReleaseReadBlock(const ReadableBlock& readable_block) {
   blocks_[index].ReleaseReadLock();
 }
 
+uint32_t Segment::GetWroteNum() {
+  if (!init_ && !Init()) {
+    return 0;
+  }
+  return state_->wrote_num();
+}
+
 bool Segment::Init() {
   if (mode_ == READ_ONLY) {
     return OpenOnly();
@@ -132,8 +165,23 @@ bool Segment::OpenOrCreate() {
 
   // create managed_shm_
   int retry = 0;
-  int shmid = 0;
-  while (retry < 2) {
+  int shmid = -1;
+  if (use_huge_pages_) {
+    // the kernel requires hugetlb segments to be a whole number of pages
+    uint64_t huge_size =
+        (conf_.managed_shm_size() + kHugePageSize - 1) / kHugePageSize *
+        kHugePageSize;
+    shmid = shmget(id_, huge_size, 0644 | IPC_CREAT | IPC_EXCL | SHM_HUGETLB);
+    if (shmid == -1) {
+      if (EEXIST == errno) {
+        ADEBUG << "shm already exist, open only.";
+        return OpenOnly();
+      }
+      AWARN << "create huge page shm failed: " << strerror(errno)
+            << ", fall back to normal pages.";
+    }
+  }
+  while (shmid == -1 && retry < 2) {
     shmid = shmget(id_, conf_.managed_shm_size(), 0644 | IPC_CREAT | IPC_EXCL);
     if (shmid != -1) {
       break;
@@ -165,6 +213,8 @@ bool Segment::OpenOrCreate() {
     return false;
   }
 
+  BindNumaNode(managed_shm_, conf_.managed_shm_size());
+
   // create field state_
   state_ = new (managed_shm_) State(conf_.ceiling_msg_size());
   if (state_ == nullptr) {
@@ -360,21 +410,28 @@ bool Segment::Recreate() {
   return OpenOrCreate();
 }
 
-uint32_t Segment::GetNextWritableBlockIndex() {
-  uint32_t try_idx = state_->wrote_num();
+void Segment::BindNumaNode(void* addr, size_t size) {
+  if (numa_node_ < 0) {
+    return;
+  }
+  unsigned long node_mask = 1UL << numa_node_;  // NOLINT
+  if (syscall(SYS_mbind, addr, size, MPOL_BIND, &node_mask,
+              sizeof(node_mask) * 8, 0) != 0) {
+    AWARN << "bind shm to numa node " << numa_node_
+          << " failed: " << strerror(errno);
+  }
+}
 
-  auto max_mod_num = conf_.block_num() - 1;
+uint32_t Segment::GetNextWritableBlockIndex() {
+  const auto block_num = conf_.block_num();
   while (1) {
-    if (try_idx >= conf_.block_num()) {
-      try_idx &= max_mod_num;
-    }
-
+    // Each writer claims its own ticket first, so concurrent writers on
+    // sibling channels probe disjoint blocks instead of all loading the
+    // same sequence and colliding on one slot.
+    uint32_t try_idx = state_->FetchAddWroteNum() % block_num;
     if (blocks_[try_idx].TryLockForWrite()) {
-      state_->IncreaseWroteNum();
       return try_idx;
     }
-
-    ++try_idx;
   }
 }
 
@@ -61,6 +61,12 @@ class Segment final {
   bool AcquireBlockToRead(ReadableBlock* readable_block);
   void ReleaseReadBlock(const ReadableBlock& readable_block);
 
+  // Transport-level count of messages written to this segment since it was
+  // created. Attaches to the shared memory on first use and returns 0 while
+  // no writer has created the segment yet, so observers can sample channel
+  // traffic without locking or reading any block.
+  uint32_t GetWroteNum();
+
  private:
   bool Init();
   bool OpenOrCreate();
@@ -72,11 +78,14 @@ class Segment final {
   bool Recreate();
 
   uint32_t GetNextWritableBlockIndex();
+  void BindNumaNode(void* addr, size_t size);
 
   bool init_;
   key_t id_;
   ReadWriteMode mode_;
   ShmConf conf_;
+  bool use_huge_pages_;
+  int numa_node_;
 
   State* state_;
   Block* blocks_;
@@ -34,6 +34,11 @@ class State {
   void IncreaseWroteNum() { wrote_num_.fetch_add(1); }
   void ResetWroteNum() { wrote_num_.store(0); }
 
+  // Claims a distinct write ticket for the calling writer. Concurrent
+  // writers get consecutive tickets through a single fetch-add, so they
+  // start probing from different blocks instead of racing for one slot.
+  uint32_t FetchAddWroteNum() { return wrote_num_.fetch_add(1); }
+
   void DecreaseReferenceCounts() {
     uint32_t current_reference_count = reference_count_.load();
     do {
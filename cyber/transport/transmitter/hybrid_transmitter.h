@@ -28,6 +28,7 @@
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/common/types.h"
+#include "cyber/message/message_traits.h"
 #include "cyber/proto/role_attributes.pb.h"
 #include "cyber/proto/transport_conf.pb.h"
 #include "cyber/task/task.h"
@@ -165,8 +166,30 @@ bool HybridTransmitter<M>::Transmit(const MessagePtr& msg,
                                     const MessageInfo& msg_info) {
   std::lock_guard<std::mutex> lock(mutex_);
   history_->Add(msg, msg_info);
+
+  // when several underlying transports need the serialized bytes (e.g.
+  // shm for local readers and rtps for a remote host), serialize once and
+  // hand the same buffer to each of them
+  int serializing_num = 0;
+  for (auto& item : transmitters_) {
+    if (item.second->AcceptsSerialized()) {
+      ++serializing_num;
+    }
+  }
+  std::shared_ptr<std::string> serialized = nullptr;
+  if (serializing_num > 1) {
+    serialized = std::make_shared<std::string>();
+    if (!message::SerializeToString(*msg, serialized.get())) {
+      serialized = nullptr;
+    }
+  }
+
   for (auto& item : transmitters_) {
-    item.second->Transmit(msg, msg_info);
+    if (serialized != nullptr && item.second->AcceptsSerialized()) {
+      item.second->TransmitSerialized(serialized, msg_info);
+    } else {
+      item.second->Transmit(msg, msg_info);
+    }
   }
   return true;
 }
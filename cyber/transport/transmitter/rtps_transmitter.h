@@ -48,8 +48,13 @@ class RtpsTransmitter : public Transmitter<M> {
 
   bool Transmit(const MessagePtr& msg, const MessageInfo& msg_info) override;
 
+  bool AcceptsSerialized() const override { return true; }
+  bool TransmitSerialized(const std::shared_ptr<std::string>& data,
+                          const MessageInfo& msg_info) override;
+
  private:
   bool Transmit(const M& msg, const MessageInfo& msg_info);
+  bool Write(UnderlayMessage* m, const MessageInfo& msg_info);
 
   ParticipantPtr participant_;
   eprosima::fastrtps::Publisher* publisher_;
@@ -105,7 +110,26 @@ bool RtpsTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
 
   UnderlayMessage m;
   RETURN_VAL_IF(!message::SerializeToString(msg, &m.data()), false);
+  return Write(&m, msg_info);
+}
+
+template <typename M>
+bool RtpsTransmitter<M>::TransmitSerialized(
+    const std::shared_ptr<std::string>& data, const MessageInfo& msg_info) {
+  if (!this->enabled_) {
+    ADEBUG << "not enable.";
+    return false;
+  }
+  RETURN_VAL_IF_NULL(data, false);
+
+  UnderlayMessage m;
+  m.data() = *data;
+  return Write(&m, msg_info);
+}
 
+template <typename M>
+bool RtpsTransmitter<M>::Write(UnderlayMessage* m,
+                               const MessageInfo& msg_info) {
   eprosima::fastrtps::rtps::WriteParams wparams;
 
   char* ptr =
@@ -122,7 +146,7 @@ bool RtpsTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
   if (participant_->is_shutdown()) {
     return false;
   }
-  return publisher_->write(reinterpret_cast<void*>(&m), wparams);
+  return publisher_->write(reinterpret_cast<void*>(m), wparams);
 }
 
 }  // namespace transport
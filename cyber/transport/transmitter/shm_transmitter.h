@@ -48,8 +48,14 @@ class ShmTransmitter : public Transmitter<M> {
 
   bool Transmit(const MessagePtr& msg, const MessageInfo& msg_info) override;
 
+  bool AcceptsSerialized() const override { return true; }
+  bool TransmitSerialized(const std::shared_ptr<std::string>& data,
+                          const MessageInfo& msg_info) override;
+
  private:
   bool Transmit(const M& msg, const MessageInfo& msg_info);
+  bool FinishBlock(const WritableBlock& wb, std::size_t msg_size,
+                   const MessageInfo& msg_info);
 
   SegmentPtr segment_;
   uint64_t channel_id_;
@@ -117,6 +123,34 @@ bool ShmTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
     segment_->ReleaseWrittenBlock(wb);
     return false;
   }
+  return FinishBlock(wb, msg_size, msg_info);
+}
+
+template <typename M>
+bool ShmTransmitter<M>::TransmitSerialized(
+    const std::shared_ptr<std::string>& data, const MessageInfo& msg_info) {
+  if (!this->enabled_) {
+    ADEBUG << "not enable.";
+    return false;
+  }
+  RETURN_VAL_IF_NULL(data, false);
+
+  WritableBlock wb;
+  std::size_t msg_size = data->size();
+  if (!segment_->AcquireBlockToWrite(msg_size, &wb)) {
+    AERROR << "acquire block failed.";
+    return false;
+  }
+
+  ADEBUG << "block index: " << wb.index;
+  std::memcpy(wb.buf, data->data(), msg_size);
+  return FinishBlock(wb, msg_size, msg_info);
+}
+
+template <typename M>
+bool ShmTransmitter<M>::FinishBlock(const WritableBlock& wb,
+                                    std::size_t msg_size,
+                                    const MessageInfo& msg_info) {
   wb.block->set_msg_size(msg_size);
 
   char* msg_info_addr = reinterpret_cast<char*>(wb.buf) + msg_size;
@@ -49,6 +49,15 @@ class Transmitter : public Endpoint {
   virtual bool Transmit(const MessagePtr& msg);
   virtual bool Transmit(const MessagePtr& msg, const MessageInfo& msg_info) = 0;
 
+  // Transmitters that serialize the message themselves can take a
+  // pre-serialized buffer instead, so HybridTransmitter serializes a
+  // message once when several underlying transports need the bytes.
+  virtual bool AcceptsSerialized() const { return false; }
+  virtual bool TransmitSerialized(const std::shared_ptr<std::string>& data,
+                                  const MessageInfo& msg_info) {
+    return false;
+  }
+
   uint64_t NextSeqNum() { return ++seq_num_; }
 
   uint64_t seq_num() const { return seq_num_; }
@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_TRANSMITTER_UDP_TRANSMITTER_H_
+#define CYBER_TRANSPORT_TRANSMITTER_UDP_TRANSMITTER_H_
+
+#include <memory>
+#include <string>
+
+#include "cyber/common/log.h"
+#include "cyber/message/message_traits.h"
+#include "cyber/transport/transmitter/transmitter.h"
+#include "cyber/transport/udp/udp_bridge.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+template <typename M>
+class UdpTransmitter : public Transmitter<M> {
+ public:
+  using MessagePtr = std::shared_ptr<M>;
+
+  explicit UdpTransmitter(const RoleAttributes& attr);
+  virtual ~UdpTransmitter();
+
+  void Enable() override;
+  void Disable() override;
+
+  bool Transmit(const MessagePtr& msg, const MessageInfo& msg_info) override;
+
+  bool AcceptsSerialized() const override { return true; }
+  bool TransmitSerialized(const std::shared_ptr<std::string>& data,
+                          const MessageInfo& msg_info) override;
+
+ private:
+  uint64_t channel_id_;
+};
+
+template <typename M>
+UdpTransmitter<M>::UdpTransmitter(const RoleAttributes& attr)
+    : Transmitter<M>(attr), channel_id_(attr.channel_id()) {}
+
+template <typename M>
+UdpTransmitter<M>::~UdpTransmitter() {
+  Disable();
+}
+
+template <typename M>
+void UdpTransmitter<M>::Enable() {
+  if (this->enabled_) {
+    return;
+  }
+  // the bridge socket machinery starts on first use
+  RETURN_IF_NULL(UdpBridge::Instance());
+  this->enabled_ = true;
+}
+
+template <typename M>
+void UdpTransmitter<M>::Disable() {
+  if (this->enabled_) {
+    this->enabled_ = false;
+  }
+}
+
+template <typename M>
+bool UdpTransmitter<M>::Transmit(const MessagePtr& msg,
+                                 const MessageInfo& msg_info) {
+  if (!this->enabled_) {
+    ADEBUG << "not enable.";
+    return false;
+  }
+
+  std::string data;
+  RETURN_VAL_IF(!message::SerializeToString(*msg, &data), false);
+  return UdpBridge::Instance()->Send(channel_id_, data, msg_info);
+}
+
+template <typename M>
+bool UdpTransmitter<M>::TransmitSerialized(
+    const std::shared_ptr<std::string>& data, const MessageInfo& msg_info) {
+  if (!this->enabled_) {
+    ADEBUG << "not enable.";
+    return false;
+  }
+  RETURN_VAL_IF_NULL(data, false);
+
+  return UdpBridge::Instance()->Send(channel_id_, *data, msg_info);
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_TRANSMITTER_UDP_TRANSMITTER_H_
@@ -28,13 +28,15 @@ Transport::Transport()
       notifier_(nullptr),
       intra_dispatcher_(nullptr),
       shm_dispatcher_(nullptr),
-      rtps_dispatcher_(nullptr) {
+      rtps_dispatcher_(nullptr),
+      udp_dispatcher_(nullptr) {
   CreateParticipant();
   notifier_ = NotifierFactory::CreateNotifier();
   intra_dispatcher_ = IntraDispatcher::Instance();
   shm_dispatcher_ = ShmDispatcher::Instance();
   rtps_dispatcher_ = RtpsDispatcher::Instance();
   rtps_dispatcher_->set_participant(participant_);
+  udp_dispatcher_ = UdpDispatcher::Instance();
 }
 
 Transport::~Transport() { Shutdown(); }
@@ -47,6 +49,7 @@ void Transport::Shutdown() {
   intra_dispatcher_->Shutdown();
   shm_dispatcher_->Shutdown();
   rtps_dispatcher_->Shutdown();
+  udp_dispatcher_->Shutdown();
   notifier_->Shutdown();
 
   if (participant_ != nullptr) {
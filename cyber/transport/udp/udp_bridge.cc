@@ -0,0 +1,379 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/udp/udp_bridge.h"
+
+#include <arpa/inet.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "cyber/common/global_data.h"
+#include "cyber/common/log.h"
+#include "cyber/common/util.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+using common::GlobalData;
+
+namespace {
+
+const uint32_t kFrameMagic = 0x55424446;  // "UBDF"
+const int kRecvTimeoutMs = 100;
+const int kRcvBufBytes = 4 * 1024 * 1024;
+// incomplete messages kept per channel before the oldest is dropped
+const std::size_t kMaxPendingPerChannel = 8;
+
+// copy [offset, offset + len) of the logical payload data|trailer
+// without materializing the concatenation
+void CopyPayload(const std::string& data, const std::string& trailer,
+                 std::size_t offset, std::size_t len, char* dst) {
+  if (offset < data.size()) {
+    std::size_t from_data = std::min(len, data.size() - offset);
+    memcpy(dst, data.data() + offset, from_data);
+    dst += from_data;
+    offset += from_data;
+    len -= from_data;
+  }
+  if (len > 0) {
+    memcpy(dst, trailer.data() + (offset - data.size()), len);
+  }
+}
+
+}  // namespace
+
+UdpBridge::UdpBridge()
+    : is_shutdown_(false),
+      send_fd_(-1),
+      recv_fd_(-1),
+      mtu_(0),
+      batch_size_(0),
+      host_id_(0),
+      next_seq_(0) {
+  if (!Init()) {
+    Shutdown();
+  }
+}
+
+UdpBridge::~UdpBridge() { Shutdown(); }
+
+void UdpBridge::Shutdown() {
+  if (is_shutdown_.exchange(true)) {
+    return;
+  }
+
+  if (recv_thread_.joinable()) {
+    recv_thread_.join();
+  }
+  if (send_fd_ != -1) {
+    close(send_fd_);
+    send_fd_ = -1;
+  }
+  if (recv_fd_ != -1) {
+    close(recv_fd_);
+    recv_fd_ = -1;
+  }
+}
+
+bool UdpBridge::Init() {
+  proto::UdpBridgeConf conf;
+  auto& g_conf = GlobalData::Instance()->Config();
+  if (g_conf.has_transport_conf() &&
+      g_conf.transport_conf().has_udp_bridge_conf()) {
+    conf = g_conf.transport_conf().udp_bridge_conf();
+  }
+  mtu_ = conf.mtu();
+  batch_size_ = conf.batch_size();
+  if (mtu_ <= sizeof(UdpFrameHeader) || batch_size_ == 0) {
+    AERROR << "invalid udp bridge conf, mtu: " << mtu_
+           << ", batch_size: " << batch_size_;
+    return false;
+  }
+  host_id_ = common::Hash(GlobalData::Instance()->HostIp());
+
+  ADEBUG << "udp bridge group: " << conf.group_ip() << ":" << conf.port();
+
+  send_fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+  if (send_fd_ == -1) {
+    AERROR << "fail to create send fd, " << strerror(errno);
+    return false;
+  }
+
+  memset(&group_addr_, 0, sizeof(group_addr_));
+  group_addr_.sin_family = AF_INET;
+  group_addr_.sin_addr.s_addr = inet_addr(conf.group_ip().c_str());
+  group_addr_.sin_port = htons(static_cast<uint16_t>(conf.port()));
+
+  // same-host traffic rides shm/intra, keep our frames off the loopback
+  int loop = 0;
+  if (setsockopt(send_fd_, IPPROTO_IP, IP_MULTICAST_LOOP, &loop,
+                 sizeof(loop)) < 0) {
+    AERROR << "fail to setsockopt IP_MULTICAST_LOOP, " << strerror(errno);
+    return false;
+  }
+
+  recv_fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+  if (recv_fd_ == -1) {
+    AERROR << "fail to create recv fd, " << strerror(errno);
+    return false;
+  }
+
+  int yes = 1;
+  if (setsockopt(recv_fd_, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes)) < 0) {
+    AERROR << "fail to setsockopt SO_REUSEADDR, " << strerror(errno);
+    return false;
+  }
+
+  int rcvbuf = kRcvBufBytes;
+  if (setsockopt(recv_fd_, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)) <
+      0) {
+    AWARN << "fail to setsockopt SO_RCVBUF, " << strerror(errno);
+  }
+
+  struct timeval timeout;
+  timeout.tv_sec = 0;
+  timeout.tv_usec = kRecvTimeoutMs * 1000;
+  if (setsockopt(recv_fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+                 sizeof(timeout)) < 0) {
+    AERROR << "fail to setsockopt SO_RCVTIMEO, " << strerror(errno);
+    return false;
+  }
+
+  struct sockaddr_in listen_addr;
+  memset(&listen_addr, 0, sizeof(listen_addr));
+  listen_addr.sin_family = AF_INET;
+  listen_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  listen_addr.sin_port = group_addr_.sin_port;
+  if (bind(recv_fd_, (struct sockaddr*)&listen_addr, sizeof(listen_addr)) <
+      0) {
+    AERROR << "fail to bind addr, " << strerror(errno);
+    return false;
+  }
+
+  struct ip_mreq mreq;
+  mreq.imr_multiaddr.s_addr = group_addr_.sin_addr.s_addr;
+  mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+  if (setsockopt(recv_fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq,
+                 sizeof(mreq)) < 0) {
+    AERROR << "fail to setsockopt IP_ADD_MEMBERSHIP, " << strerror(errno);
+    return false;
+  }
+
+  send_frames_.resize(batch_size_);
+  for (auto& frame : send_frames_) {
+    frame.resize(mtu_);
+  }
+
+  recv_thread_ = std::thread(&UdpBridge::ThreadFunc, this);
+  return true;
+}
+
+bool UdpBridge::Send(uint64_t channel_id, const std::string& data,
+                     const MessageInfo& msg_info) {
+  if (is_shutdown_.load()) {
+    return false;
+  }
+
+  std::string trailer;
+  if (!msg_info.SerializeTo(&trailer)) {
+    AERROR << "serialize message info failed.";
+    return false;
+  }
+
+  const std::size_t msg_size = data.size() + trailer.size();
+  const std::size_t cap = mtu_ - sizeof(UdpFrameHeader);
+  const std::size_t frag_count = (msg_size + cap - 1) / cap;
+  if (frag_count == 0 || frag_count > UINT16_MAX) {
+    AERROR << "message does not fit the bridge framing, size: " << msg_size;
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(send_mutex_);
+  const uint64_t seq = next_seq_.fetch_add(1);
+  std::vector<struct mmsghdr> msgs(batch_size_);
+  std::vector<struct iovec> iovs(batch_size_);
+  std::size_t frag_index = 0;
+  while (frag_index < frag_count) {
+    unsigned int batch = 0;
+    for (; batch < batch_size_ && frag_index < frag_count;
+         ++batch, ++frag_index) {
+      const std::size_t offset = frag_index * cap;
+      const std::size_t frag_size = std::min(cap, msg_size - offset);
+      char* frame = send_frames_[batch].data();
+      UdpFrameHeader* header = reinterpret_cast<UdpFrameHeader*>(frame);
+      header->magic = kFrameMagic;
+      header->msg_size = static_cast<uint32_t>(msg_size);
+      header->channel_id = channel_id;
+      header->host_id = host_id_;
+      header->seq = seq;
+      header->frag_index = static_cast<uint16_t>(frag_index);
+      header->frag_count = static_cast<uint16_t>(frag_count);
+      header->frag_size = static_cast<uint32_t>(frag_size);
+      CopyPayload(data, trailer, offset, frag_size,
+                  frame + sizeof(UdpFrameHeader));
+
+      memset(&msgs[batch], 0, sizeof(msgs[batch]));
+      iovs[batch].iov_base = frame;
+      iovs[batch].iov_len = sizeof(UdpFrameHeader) + frag_size;
+      msgs[batch].msg_hdr.msg_iov = &iovs[batch];
+      msgs[batch].msg_hdr.msg_iovlen = 1;
+      msgs[batch].msg_hdr.msg_name = &group_addr_;
+      msgs[batch].msg_hdr.msg_namelen = sizeof(group_addr_);
+    }
+
+    unsigned int sent = 0;
+    while (sent < batch) {
+      int num = sendmmsg(send_fd_, msgs.data() + sent, batch - sent, 0);
+      if (num < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        AERROR << "fail to sendmmsg, " << strerror(errno);
+        return false;
+      }
+      sent += num;
+    }
+  }
+  return true;
+}
+
+void UdpBridge::AddChannel(uint64_t channel_id) {
+  std::lock_guard<std::mutex> lock(channels_mutex_);
+  channels_.insert(channel_id);
+}
+
+void UdpBridge::SetMessageCallback(const MessageCallback& callback) {
+  std::lock_guard<std::mutex> lock(msg_callback_mutex_);
+  msg_callback_ = callback;
+}
+
+void UdpBridge::ThreadFunc() {
+  std::vector<std::vector<char>> bufs(batch_size_);
+  std::vector<struct mmsghdr> msgs(batch_size_);
+  std::vector<struct iovec> iovs(batch_size_);
+  for (unsigned int i = 0; i < batch_size_; ++i) {
+    bufs[i].resize(mtu_);
+    memset(&msgs[i], 0, sizeof(msgs[i]));
+    iovs[i].iov_base = bufs[i].data();
+    iovs[i].iov_len = mtu_;
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  while (!is_shutdown_.load()) {
+    int num = recvmmsg(recv_fd_, msgs.data(), batch_size_, MSG_WAITFORONE,
+                       nullptr);
+    if (num < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        AERROR << "fail to recvmmsg, " << strerror(errno);
+      }
+      continue;
+    }
+    for (int i = 0; i < num; ++i) {
+      ProcessFrame(bufs[i].data(), msgs[i].msg_len);
+    }
+  }
+}
+
+void UdpBridge::ProcessFrame(const char* buf, std::size_t len) {
+  if (len < sizeof(UdpFrameHeader)) {
+    return;
+  }
+  UdpFrameHeader header;
+  memcpy(&header, buf, sizeof(header));
+  if (header.magic != kFrameMagic || header.host_id == host_id_) {
+    return;
+  }
+  const std::size_t cap = mtu_ - sizeof(UdpFrameHeader);
+  if (header.frag_count == 0 || header.frag_index >= header.frag_count ||
+      header.frag_size != len - sizeof(UdpFrameHeader) ||
+      header.frag_index * cap + header.frag_size > header.msg_size ||
+      header.msg_size < MessageInfo::kSize) {
+    ADEBUG << "malformed frame dropped, channel id: " << header.channel_id;
+    return;
+  }
+
+  std::string complete;
+  {
+    std::lock_guard<std::mutex> lock(channels_mutex_);
+    if (channels_.count(header.channel_id) == 0) {
+      return;
+    }
+    const uint64_t seq = header.seq;
+    auto& pending = reassembly_[header.channel_id];
+    auto itr = pending.find(seq);
+    if (itr == pending.end()) {
+      if (pending.size() >= kMaxPendingPerChannel) {
+        auto oldest = std::min_element(
+            pending.begin(), pending.end(),
+            [](const std::pair<const uint64_t, Reassembly>& lhs,
+               const std::pair<const uint64_t, Reassembly>& rhs) {
+              return lhs.first < rhs.first;
+            });
+        AWARN << "incomplete message dropped, channel id: "
+              << header.channel_id << ", seq: " << oldest->first;
+        pending.erase(oldest);
+      }
+      itr = pending.emplace(seq, Reassembly()).first;
+      itr->second.frag_count = header.frag_count;
+      itr->second.data.resize(header.msg_size);
+      itr->second.arrived.assign(header.frag_count, false);
+    }
+    auto& entry = itr->second;
+    if (entry.frag_count != header.frag_count ||
+        entry.data.size() != header.msg_size ||
+        entry.arrived[header.frag_index]) {
+      return;
+    }
+    memcpy(&entry.data[header.frag_index * cap], buf + sizeof(UdpFrameHeader),
+           header.frag_size);
+    entry.arrived[header.frag_index] = true;
+    if (++entry.received < entry.frag_count) {
+      return;
+    }
+    complete = std::move(entry.data);
+    pending.erase(itr);
+  }
+
+  MessageInfo msg_info;
+  if (!msg_info.DeserializeFrom(
+          complete.data() + complete.size() - MessageInfo::kSize,
+          MessageInfo::kSize)) {
+    AERROR << "deserialize message info failed.";
+    return;
+  }
+  auto msg_str = std::make_shared<std::string>(std::move(complete));
+  msg_str->resize(msg_str->size() - MessageInfo::kSize);
+
+  MessageCallback callback;
+  {
+    std::lock_guard<std::mutex> lock(msg_callback_mutex_);
+    callback = msg_callback_;
+  }
+  if (callback != nullptr) {
+    callback(header.channel_id, msg_str, msg_info);
+  }
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
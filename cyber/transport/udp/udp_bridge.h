@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_UDP_UDP_BRIDGE_H_
+#define CYBER_TRANSPORT_UDP_UDP_BRIDGE_H_
+
+#include <netinet/in.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "cyber/common/macros.h"
+#include "cyber/transport/message/message_info.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// on-wire fragment header; both hosts of a bridge run the same
+// architecture, fields are in host byte order
+struct UdpFrameHeader {
+  uint32_t magic;
+  uint32_t msg_size;     // full payload size, MessageInfo trailer included
+  uint64_t channel_id;
+  uint64_t host_id;      // sender host hash, used to drop looped-back frames
+  uint64_t seq;          // per-bridge message sequence, keys reassembly
+  uint16_t frag_index;
+  uint16_t frag_count;
+  uint32_t frag_size;
+} __attribute__((packed));
+
+/**
+ * @brief Host-to-host UDP multicast bridge shared by all udp
+ * transmitters and the udp dispatcher of this process.
+ *
+ * Messages are segmented into mtu-sized fragments over preallocated
+ * frame buffers and flushed in sendmmsg batches; the receive thread
+ * drains the socket with recvmmsg, reassembles subscribed channels and
+ * hands complete messages to the registered callback. The framing is
+ * backend-neutral: a kernel-bypass datapath only has to move the same
+ * frames.
+ */
+class UdpBridge {
+ public:
+  using MessageCallback =
+      std::function<void(uint64_t channel_id,
+                         const std::shared_ptr<std::string>& msg_str,
+                         const MessageInfo& msg_info)>;
+
+  virtual ~UdpBridge();
+
+  void Shutdown();
+
+  // segment data plus its MessageInfo trailer and multicast it
+  bool Send(uint64_t channel_id, const std::string& data,
+            const MessageInfo& msg_info);
+
+  // subscribe the receive side to a channel
+  void AddChannel(uint64_t channel_id);
+  void SetMessageCallback(const MessageCallback& callback);
+
+ private:
+  struct Reassembly {
+    uint16_t frag_count = 0;
+    uint16_t received = 0;
+    std::string data;
+    std::vector<bool> arrived;
+  };
+
+  bool Init();
+  void ThreadFunc();
+  void ProcessFrame(const char* buf, std::size_t len);
+
+  std::atomic<bool> is_shutdown_;
+  int send_fd_;
+  int recv_fd_;
+  struct sockaddr_in group_addr_;
+  uint32_t mtu_;
+  uint32_t batch_size_;
+  uint64_t host_id_;
+
+  std::mutex send_mutex_;
+  std::vector<std::vector<char>> send_frames_;  // batch_size_ x mtu_
+  std::atomic<uint64_t> next_seq_;
+
+  std::thread recv_thread_;
+  std::mutex channels_mutex_;
+  std::unordered_set<uint64_t> channels_;
+  // key: channel_id, then seq of the message under reassembly
+  std::unordered_map<uint64_t, std::unordered_map<uint64_t, Reassembly>>
+      reassembly_;
+  MessageCallback msg_callback_;
+  std::mutex msg_callback_mutex_;
+
+  DECLARE_SINGLETON(UdpBridge)
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_UDP_UDP_BRIDGE_H_
@@ -29,6 +29,8 @@ DEFINE_string(localization_topic, "/apollo/localization/pose",
               "localization topic name");
 DEFINE_string(planning_trajectory_topic, "/apollo/planning",
               "planning trajectory topic name");
+DEFINE_string(planning_trajectory_delta_topic, "/apollo/planning/delta",
+              "planning trajectory delta topic name");
 DEFINE_string(planning_pad_topic, "/apollo/planning/pad",
               "planning pad topic name");
 DEFINE_string(monitor_topic, "/apollo/monitor", "Monitor");
@@ -26,6 +26,7 @@ DECLARE_string(chassis_topic);
 DECLARE_string(chassis_detail_topic);
 DECLARE_string(localization_topic);
 DECLARE_string(planning_trajectory_topic);
+DECLARE_string(planning_trajectory_delta_topic);
 DECLARE_string(planning_pad_topic);
 DECLARE_string(monitor_topic);
 DECLARE_string(pad_topic);
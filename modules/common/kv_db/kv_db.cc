@@ -17,11 +17,12 @@
 
 #include <sqlite3.h>
 
+#include <mutex>
+#include <unordered_map>
+
 #include "gflags/gflags.h"
 
 #include "cyber/common/log.h"
-#include "modules/common/util/string_util.h"
-#include "modules/common/util/util.h"
 
 DEFINE_string(kv_db_path, "/apollo/data/kv_db.sqlite",
               "Path to Key-value DB file.");
@@ -29,19 +30,67 @@ DEFINE_string(kv_db_path, "/apollo/data/kv_db.sqlite",
 namespace apollo {
 namespace common {
 namespace {
-using apollo::common::util::StrCat;
 
-// Self-maintained sqlite instance.
+// Self-maintained sqlite instance. The connection is opened once and kept for
+// the process lifetime: per-operation open/close used to pay table creation
+// and an fsync on every Put, which blocked monitor and HMI for milliseconds.
+// WAL mode moves syncs out of the commit path, prepared statements skip
+// re-parsing the SQL, and a write-through cache answers repeated reads
+// without touching sqlite at all.
 class SqliteWraper {
  public:
-  static int Callback(void *data, int argc, char **argv, char **col_name) {
-    if (data != nullptr) {
-      std::string *data_str = static_cast<std::string *>(data);
-      *data_str = argc > 0 ? argv[0] : "";
+  static SqliteWraper &Instance() {
+    static SqliteWraper instance;
+    return instance;
+  }
+
+  bool Put(const std::string &key, const std::string &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!Step(put_stmt_, key, &value)) {
+      return false;
+    }
+    cache_[key] = value;
+    return true;
+  }
+
+  bool Delete(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!Step(delete_stmt_, key, nullptr)) {
+      return false;
+    }
+    cache_.erase(key);
+    return true;
+  }
+
+  bool Get(const std::string &key, std::string *value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto cached = cache_.find(key);
+    if (cached != cache_.end()) {
+      *value = cached->second;
+      return true;
+    }
+    if (db_ == nullptr) {
+      AERROR << "DB is not open properly.";
+      return false;
+    }
+    sqlite3_reset(get_stmt_);
+    sqlite3_bind_text(get_stmt_, 1, key.c_str(), static_cast<int>(key.size()),
+                      SQLITE_TRANSIENT);
+    const int ret = sqlite3_step(get_stmt_);
+    if (ret == SQLITE_ROW) {
+      const char *text =
+          reinterpret_cast<const char *>(sqlite3_column_text(get_stmt_, 0));
+      *value = text != nullptr ? text : "";
+      cache_[key] = *value;
+      return true;
     }
-    return 0;
+    if (ret != SQLITE_DONE) {
+      AERROR << "Failed to query key " << key << ": " << sqlite3_errmsg(db_);
+    }
+    return false;
   }
 
+ private:
   SqliteWraper() {
     // Open DB.
     if (sqlite3_open(FLAGS_kv_db_path.c_str(), &db_) != 0) {
@@ -50,35 +99,76 @@ class SqliteWraper {
       return;
     }
 
-    // Create table if it doesn't exist.
-    static const char *kCreateTableSql =
+    // WAL commits without syncing the main database file; synchronous=NORMAL
+    // only syncs the log on checkpoints, which is durable enough for the
+    // system parameters stored here.
+    static const char *kSetupSql =
+        "PRAGMA journal_mode=WAL;"
+        "PRAGMA synchronous=NORMAL;"
+        "PRAGMA busy_timeout=3000;"
         "CREATE TABLE IF NOT EXISTS key_value "
         "(key VARCHAR(128) PRIMARY KEY NOT NULL, value TEXT);";
-    if (!SQL(kCreateTableSql)) {
+    char *error = nullptr;
+    if (sqlite3_exec(db_, kSetupSql, nullptr, nullptr, &error) != SQLITE_OK) {
+      AERROR << "Failed to set up Key-Value database: " << error;
+      sqlite3_free(error);
+      Release();
+      return;
+    }
+
+    if (!Prepare("INSERT OR REPLACE INTO key_value (key, value) "
+                 "VALUES (?1, ?2);",
+                 &put_stmt_) ||
+        !Prepare("DELETE FROM key_value WHERE key=?1;", &delete_stmt_) ||
+        !Prepare("SELECT value FROM key_value WHERE key=?1;", &get_stmt_)) {
       Release();
     }
   }
 
   ~SqliteWraper() { Release(); }
 
-  bool SQL(const std::string &sql, std::string *value = nullptr) {
-    AINFO << "Executing SQL: " << sql;
+  bool Prepare(const char *sql, sqlite3_stmt **stmt) {
+    if (sqlite3_prepare_v2(db_, sql, -1, stmt, nullptr) != SQLITE_OK) {
+      AERROR << "Failed to prepare statement: " << sqlite3_errmsg(db_);
+      return false;
+    }
+    return true;
+  }
+
+  // Run a write statement bound to key (and value when non-null) to the end.
+  bool Step(sqlite3_stmt *stmt, const std::string &key,
+            const std::string *value) {
     if (db_ == nullptr) {
       AERROR << "DB is not open properly.";
       return false;
     }
-
-    char *error = nullptr;
-    if (sqlite3_exec(db_, sql.c_str(), Callback, value, &error) != SQLITE_OK) {
-      AERROR << "Failed to execute SQL: " << error;
-      sqlite3_free(error);
+    sqlite3_reset(stmt);
+    sqlite3_bind_text(stmt, 1, key.c_str(), static_cast<int>(key.size()),
+                      SQLITE_TRANSIENT);
+    if (value != nullptr) {
+      sqlite3_bind_text(stmt, 2, value->c_str(),
+                        static_cast<int>(value->size()), SQLITE_TRANSIENT);
+    }
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      AERROR << "Failed to execute statement: " << sqlite3_errmsg(db_);
       return false;
     }
     return true;
   }
 
- private:
   void Release() {
+    if (put_stmt_ != nullptr) {
+      sqlite3_finalize(put_stmt_);
+      put_stmt_ = nullptr;
+    }
+    if (delete_stmt_ != nullptr) {
+      sqlite3_finalize(delete_stmt_);
+      delete_stmt_ = nullptr;
+    }
+    if (get_stmt_ != nullptr) {
+      sqlite3_finalize(get_stmt_);
+      get_stmt_ = nullptr;
+    }
     if (db_ != nullptr) {
       sqlite3_close(db_);
       db_ = nullptr;
@@ -86,38 +176,34 @@ class SqliteWraper {
   }
 
   sqlite3 *db_ = nullptr;
+  sqlite3_stmt *put_stmt_ = nullptr;
+  sqlite3_stmt *delete_stmt_ = nullptr;
+  sqlite3_stmt *get_stmt_ = nullptr;
+  std::mutex mutex_;
+  // Write-through cache of rows this process has seen.
+  std::unordered_map<std::string, std::string> cache_;
 };
 
 }  // namespace
 
 bool KVDB::Put(const std::string &key, const std::string &value) {
-  SqliteWraper sqlite;
-  return sqlite.SQL(
-      StrCat("INSERT OR REPLACE INTO key_value (key, value) "
-             "VALUES ('",
-             key, "', '", value, "');"));
+  return SqliteWraper::Instance().Put(key, value);
 }
 
 bool KVDB::Delete(const std::string &key) {
-  SqliteWraper sqlite;
-  return sqlite.SQL(StrCat("DELETE FROM key_value WHERE key='", key, "';"));
+  return SqliteWraper::Instance().Delete(key);
 }
 
 bool KVDB::Has(const std::string &key) {
-  SqliteWraper sqlite;
   std::string value;
-  const bool ret = sqlite.SQL(
-      StrCat("SELECT value FROM key_value WHERE key='", key, "';"), &value);
   // Take empty field as non-exist.
-  return ret && !value.empty();
+  return SqliteWraper::Instance().Get(key, &value) && !value.empty();
 }
 
 std::string KVDB::Get(const std::string &key,
                       const std::string &default_value) {
-  SqliteWraper sqlite;
   std::string value;
-  const bool ret = sqlite.SQL(
-      StrCat("SELECT value FROM key_value WHERE key='", key, "';"), &value);
+  const bool ret = SqliteWraper::Instance().Get(key, &value);
   return (ret && !value.empty()) ? value : default_value;
 }
 
@@ -0,0 +1,201 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/latency_recorder/latency_recorder.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+
+#include "gflags/gflags.h"
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+#include "cyber/time/time.h"
+
+DEFINE_string(latency_trace_dir, "/dev/shm",
+              "Directory holding the per-process latency trace rings.");
+DEFINE_int32(latency_trace_capacity, 16384,
+             "Number of hop records each process ring can hold.");
+
+namespace apollo {
+namespace common {
+namespace {
+
+constexpr char kRingFilePrefix[] = "apollo.latency.";
+
+std::string RingFilePath() {
+  return FLAGS_latency_trace_dir + "/" + kRingFilePrefix +
+         std::to_string(getpid());
+}
+
+}  // namespace
+
+constexpr uint64_t LatencyRecorder::kRingMagic;
+
+LatencyRecorder::LatencyRecorder() {
+  const size_t capacity = static_cast<size_t>(FLAGS_latency_trace_capacity);
+  mapped_size_ = sizeof(RingHeader) + capacity * sizeof(LatencyHopRecord);
+
+  const std::string path = RingFilePath();
+  fd_ = open(path.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP);
+  if (fd_ < 0) {
+    AERROR << "Failed to open latency trace ring " << path;
+    return;
+  }
+  if (ftruncate(fd_, static_cast<off_t>(mapped_size_)) != 0) {
+    AERROR << "Failed to size latency trace ring " << path;
+    close(fd_);
+    fd_ = -1;
+    return;
+  }
+  void *mapping = mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE,
+                       MAP_SHARED, fd_, 0);
+  if (mapping == MAP_FAILED) {
+    AERROR << "Failed to mmap latency trace ring " << path;
+    close(fd_);
+    fd_ = -1;
+    return;
+  }
+
+  ring_ = static_cast<RingHeader *>(mapping);
+  records_ = reinterpret_cast<LatencyHopRecord *>(
+      static_cast<char *>(mapping) + sizeof(RingHeader));
+  ring_->magic = kRingMagic;
+  ring_->capacity = capacity;
+  ring_->next.store(0, std::memory_order_relaxed);
+}
+
+LatencyRecorder::~LatencyRecorder() {
+  if (ring_ != nullptr) {
+    munmap(ring_, mapped_size_);
+    ring_ = nullptr;
+  }
+  if (fd_ >= 0) {
+    close(fd_);
+    fd_ = -1;
+  }
+}
+
+uint64_t LatencyRecorder::MintTraceId() {
+  static std::atomic<uint64_t> counter = {0};
+  const uint64_t id =
+      (cyber::Time::Now().ToNanosecond() << 16) ^
+      (static_cast<uint64_t>(getpid()) << 8) ^
+      counter.fetch_add(1, std::memory_order_relaxed);
+  // 0 marks untraced headers.
+  return id != 0 ? id : 1;
+}
+
+void LatencyRecorder::RecordHop(const uint64_t trace_id,
+                                const std::string &module_name) {
+  if (trace_id == 0 || ring_ == nullptr) {
+    return;
+  }
+  const uint64_t slot = ring_->next.fetch_add(1, std::memory_order_relaxed) %
+                        ring_->capacity;
+  LatencyHopRecord &record = records_[slot];
+  // Publish the timestamp last: the reader drops records whose timestamp is
+  // zero, so a concurrently overwritten slot is skipped, not misread.
+  record.timestamp_ns = 0;
+  record.trace_id = trace_id;
+  std::strncpy(record.module_name, module_name.c_str(),
+               sizeof(record.module_name) - 1);
+  record.module_name[sizeof(record.module_name) - 1] = '\0';
+  record.timestamp_ns = cyber::Time::Now().ToNanosecond();
+}
+
+void LatencyRecorder::PropagateTrace(const Header &input,
+                                     const std::string &module_name,
+                                     Header *output) {
+  uint64_t trace_id = input.trace_id();
+  if (trace_id == 0) {
+    trace_id = MintTraceId();
+  }
+  if (output != nullptr) {
+    output->set_trace_id(trace_id);
+  }
+  RecordHop(trace_id, module_name);
+}
+
+LatencyTraceReader::LatencyTraceReader(const std::string &trace_dir)
+    : trace_dir_(trace_dir) {}
+
+std::map<uint64_t, std::vector<LatencyHopRecord>>
+LatencyTraceReader::CollectTraces() const {
+  std::map<uint64_t, std::vector<LatencyHopRecord>> traces;
+  for (const std::string &name :
+       cyber::common::ListSubPaths(trace_dir_, DT_REG)) {
+    if (name.compare(0, std::strlen(kRingFilePrefix), kRingFilePrefix) != 0) {
+      continue;
+    }
+    const std::string path = trace_dir_ + "/" + name;
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      AWARN << "Failed to open latency trace ring " << path;
+      continue;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 ||
+        static_cast<size_t>(file_stat.st_size) <
+            sizeof(LatencyRecorder::RingHeader)) {
+      close(fd);
+      continue;
+    }
+    const size_t size = static_cast<size_t>(file_stat.st_size);
+    void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+      AWARN << "Failed to mmap latency trace ring " << path;
+      continue;
+    }
+
+    const auto *ring = static_cast<const LatencyRecorder::RingHeader *>(mapping);
+    const auto *records = reinterpret_cast<const LatencyHopRecord *>(
+        static_cast<const char *>(mapping) +
+        sizeof(LatencyRecorder::RingHeader));
+    const size_t record_capacity =
+        (size - sizeof(LatencyRecorder::RingHeader)) /
+        sizeof(LatencyHopRecord);
+    if (ring->magic == LatencyRecorder::kRingMagic) {
+      const size_t count =
+          std::min<size_t>(std::min<uint64_t>(ring->capacity,
+                                              ring->next.load(
+                                                  std::memory_order_relaxed)),
+                           record_capacity);
+      for (size_t i = 0; i < count; ++i) {
+        if (records[i].trace_id != 0 && records[i].timestamp_ns != 0) {
+          traces[records[i].trace_id].push_back(records[i]);
+        }
+      }
+    }
+    munmap(mapping, size);
+  }
+
+  for (auto &trace : traces) {
+    std::sort(trace.second.begin(), trace.second.end(),
+              [](const LatencyHopRecord &a, const LatencyHopRecord &b) {
+                return a.timestamp_ns < b.timestamp_ns;
+              });
+  }
+  return traces;
+}
+
+}  // namespace common
+}  // namespace apollo
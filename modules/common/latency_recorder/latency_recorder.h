@@ -0,0 +1,132 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Per-frame latency lineage tracing across processes.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "cyber/common/macros.h"
+#include "modules/common/proto/header.pb.h"
+
+/**
+ * @namespace apollo::common
+ * @brief apollo::common
+ */
+namespace apollo {
+namespace common {
+
+/**
+ * @brief One hop of a traced frame: a module saw the frame identified by
+ *        trace_id at timestamp_ns. The layout is fixed-size and trivially
+ *        copyable because records live in a shared-memory ring.
+ */
+struct LatencyHopRecord {
+  uint64_t trace_id = 0;
+  uint64_t timestamp_ns = 0;
+  char module_name[24] = {0};
+};
+
+/**
+ * @class LatencyRecorder
+ *
+ * @brief Records message lineage hops into a per-process shared-memory ring.
+ *
+ * A frame gets a trace_id in its Header at the origin module; every module
+ * that consumes or republishes it calls RecordHop() (or PropagateTrace(),
+ * which also copies the id into the outgoing header). Hops are appended
+ * lock-free to a ring mapped under FLAGS_latency_trace_dir, one file per
+ * process, so recording never blocks on other processes. The latency_trace
+ * tool merges the rings of all processes and reconstructs per-frame
+ * waterfalls, which is what the aggregate per-module statistics cannot do
+ * for a single late frame.
+ */
+class LatencyRecorder {
+ public:
+  /**
+   * @brief Create a non-zero trace id for a new frame.
+   */
+  static uint64_t MintTraceId();
+
+  /**
+   * @brief Append a hop for trace_id stamped with the current time.
+   *        A zero trace_id (untraced message) is ignored.
+   */
+  void RecordHop(const uint64_t trace_id, const std::string &module_name);
+
+  /**
+   * @brief Carry the trace context of an input header into an output header
+   *        and record the hop. Mints a fresh id when the input is untraced,
+   *        so tracing starts at the first instrumented module.
+   */
+  void PropagateTrace(const Header &input, const std::string &module_name,
+                      Header *output);
+
+  /**
+   * @brief Whether the shared-memory ring was mapped successfully.
+   */
+  bool IsReady() const { return ring_ != nullptr; }
+
+ private:
+  // Layout of the mapped file: RingHeader followed by capacity records.
+  struct RingHeader {
+    uint64_t magic = 0;
+    uint64_t capacity = 0;
+    std::atomic<uint64_t> next{0};
+  };
+
+  ~LatencyRecorder();
+
+  RingHeader *ring_ = nullptr;
+  LatencyHopRecord *records_ = nullptr;
+  size_t mapped_size_ = 0;
+  int fd_ = -1;
+
+  friend class LatencyTraceReader;
+  static constexpr uint64_t kRingMagic = 0x6170741c74726163ULL;
+
+  DECLARE_SINGLETON(LatencyRecorder)
+};
+
+/**
+ * @class LatencyTraceReader
+ * @brief Merges the per-process rings under a trace directory into
+ *        per-frame hop lists, ordered by timestamp.
+ */
+class LatencyTraceReader {
+ public:
+  explicit LatencyTraceReader(const std::string &trace_dir);
+
+  /**
+   * @brief Collect all hops of all processes, grouped by trace id. Hops of
+   *        each trace are sorted by timestamp.
+   */
+  std::map<uint64_t, std::vector<LatencyHopRecord>> CollectTraces() const;
+
+ private:
+  std::string trace_dir_;
+};
+
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/latency_recorder/latency_recorder.h"
+
+#include <string>
+
+#include "gflags/gflags.h"
+#include "gtest/gtest.h"
+
+DECLARE_string(latency_trace_dir);
+
+namespace apollo {
+namespace common {
+
+TEST(LatencyRecorderTest, MintTraceId) {
+  const uint64_t id0 = LatencyRecorder::MintTraceId();
+  const uint64_t id1 = LatencyRecorder::MintTraceId();
+  EXPECT_NE(0, id0);
+  EXPECT_NE(0, id1);
+  EXPECT_NE(id0, id1);
+}
+
+TEST(LatencyRecorderTest, RecordAndCollect) {
+  // The recorder maps its ring on first use; keep it in the test's cwd.
+  FLAGS_latency_trace_dir = ".";
+  auto *recorder = LatencyRecorder::Instance();
+  ASSERT_TRUE(recorder->IsReady());
+
+  const uint64_t trace_id = LatencyRecorder::MintTraceId();
+  recorder->RecordHop(trace_id, "velodyne");
+  recorder->RecordHop(trace_id, "perception");
+
+  Header input;
+  input.set_trace_id(trace_id);
+  Header output;
+  recorder->PropagateTrace(input, "planning", &output);
+  EXPECT_EQ(trace_id, output.trace_id());
+
+  // An untraced input gets a fresh id minted.
+  Header untraced;
+  Header traced;
+  recorder->PropagateTrace(untraced, "control", &traced);
+  EXPECT_NE(0, traced.trace_id());
+  EXPECT_NE(trace_id, traced.trace_id());
+
+  const LatencyTraceReader reader(FLAGS_latency_trace_dir);
+  const auto traces = reader.CollectTraces();
+  ASSERT_NE(traces.end(), traces.find(trace_id));
+
+  const auto &hops = traces.at(trace_id);
+  ASSERT_EQ(3, hops.size());
+  EXPECT_EQ("velodyne", std::string(hops[0].module_name));
+  EXPECT_EQ("perception", std::string(hops[1].module_name));
+  EXPECT_EQ("planning", std::string(hops[2].module_name));
+  EXPECT_LE(hops[0].timestamp_ns, hops[1].timestamp_ns);
+  EXPECT_LE(hops[1].timestamp_ns, hops[2].timestamp_ns);
+
+  ASSERT_NE(traces.end(), traces.find(traced.trace_id()));
+  EXPECT_EQ(1, traces.at(traced.trace_id()).size());
+}
+
+}  // namespace common
+}  // namespace apollo
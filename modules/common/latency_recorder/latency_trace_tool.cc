@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Merges the per-process latency trace rings into per-frame
+ *        waterfalls. Run it on the machine under test, e.g.:
+ *
+ *          latency_trace_tool --latency_trace_min_ms=100
+ *
+ *        prints every traced frame whose end-to-end span exceeded 100 ms,
+ *        one line per hop with the offset from the first hop.
+ */
+
+#include <cstdio>
+
+#include "gflags/gflags.h"
+
+#include "modules/common/latency_recorder/latency_recorder.h"
+
+DECLARE_string(latency_trace_dir);
+DEFINE_double(latency_trace_min_ms, 0.0,
+              "Only print frames whose end-to-end span is at least this.");
+
+int main(int argc, char **argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+
+  const apollo::common::LatencyTraceReader reader(FLAGS_latency_trace_dir);
+  const auto traces = reader.CollectTraces();
+
+  size_t printed = 0;
+  for (const auto &trace : traces) {
+    const auto &hops = trace.second;
+    const uint64_t start_ns = hops.front().timestamp_ns;
+    const double span_ms =
+        static_cast<double>(hops.back().timestamp_ns - start_ns) * 1e-6;
+    if (span_ms < FLAGS_latency_trace_min_ms) {
+      continue;
+    }
+    std::printf("trace %016lx: %zu hops, %.3f ms\n",
+                static_cast<unsigned long>(trace.first),  // NOLINT
+                hops.size(), span_ms);
+    for (const auto &hop : hops) {
+      std::printf("  +%10.3f ms  %s\n",
+                  static_cast<double>(hop.timestamp_ns - start_ns) * 1e-6,
+                  hop.module_name);
+    }
+    ++printed;
+  }
+  std::printf("%zu of %zu traces shown from %s\n", printed, traces.size(),
+              FLAGS_latency_trace_dir.c_str());
+  return 0;
+}
@@ -55,20 +55,30 @@ struct AABoxKDTreeParams {
 /**
  * @class AABoxKDTree2dNode
  * @brief The class of KD-tree node of axis-aligned bounding box.
+ *        Nodes live in one contiguous vector owned by AABoxKDTree2d and
+ *        refer to their children by index, so traversal walks a flat
+ *        array instead of chasing per-node heap allocations.
  */
 template <class ObjectType>
 class AABoxKDTree2dNode {
  public:
   using ObjectPtr = const ObjectType *;
+
   /**
-   * @brief Constructor which takes a vector of objects,
-   *        parameters and depth of the node.
+   * @brief Constructor which takes a vector of objects, parameters and
+   *        depth of the node. If the node is an internal one, the objects
+   *        falling entirely to one side of the partition are handed back
+   *        through the output vectors for the tree to build the sub-nodes.
    * @param objects Objects to build the KD-tree node.
    * @param params Parameters to build the KD-tree.
    * @param depth Depth of the KD-tree node.
+   * @param left_subnode_objects Output objects of the left sub-node.
+   * @param right_subnode_objects Output objects of the right sub-node.
    */
   AABoxKDTree2dNode(const std::vector<ObjectPtr> &objects,
-                    const AABoxKDTreeParams &params, int depth)
+                    const AABoxKDTreeParams &params, int depth,
+                    std::vector<ObjectPtr> *const left_subnode_objects,
+                    std::vector<ObjectPtr> *const right_subnode_objects)
       : depth_(depth) {
     CHECK(!objects.empty());
 
@@ -76,51 +86,12 @@ class AABoxKDTree2dNode {
     ComputePartition();
 
     if (SplitToSubNodes(objects, params)) {
-      std::vector<ObjectPtr> left_subnode_objects;
-      std::vector<ObjectPtr> right_subnode_objects;
-      PartitionObjects(objects, &left_subnode_objects, &right_subnode_objects);
-
-      // Split to sub-nodes.
-      if (!left_subnode_objects.empty()) {
-        left_subnode_.reset(new AABoxKDTree2dNode<ObjectType>(
-            left_subnode_objects, params, depth + 1));
-      }
-      if (!right_subnode_objects.empty()) {
-        right_subnode_.reset(new AABoxKDTree2dNode<ObjectType>(
-            right_subnode_objects, params, depth + 1));
-      }
+      PartitionObjects(objects, left_subnode_objects, right_subnode_objects);
     } else {
       InitObjects(objects);
     }
   }
 
-  /**
-   * @brief Get the nearest object to a target point by the KD-tree
-   *        rooted at this node.
-   * @param point The target point. Search it's nearest object.
-   * @return The nearest object to the target point.
-   */
-  ObjectPtr GetNearestObject(const Vec2d &point) const {
-    ObjectPtr nearest_object = nullptr;
-    double min_distance_sqr = std::numeric_limits<double>::infinity();
-    GetNearestObjectInternal(point, &min_distance_sqr, &nearest_object);
-    return nearest_object;
-  }
-
-  /**
-   * @brief Get objects within a distance to a point by the KD-tree
-   *        rooted at this node.
-   * @param point The center point of the range to search objects.
-   * @param distance The radius of the range to search objects.
-   * @return All objects within the specified distance to the specified point.
-   */
-  std::vector<ObjectPtr> GetObjects(const Vec2d &point,
-                                    const double distance) const {
-    std::vector<ObjectPtr> result_objects;
-    GetObjectsInternal(point, distance, Square(distance), &result_objects);
-    return result_objects;
-  }
-
   /**
    * @brief Get the axis-aligned bounding box of the objects.
    * @return The axis-aligned bounding box of the objects.
@@ -129,53 +100,6 @@ class AABoxKDTree2dNode {
     return AABox2d({min_x_, min_y_}, {max_x_, max_y_});
   }
 
- private:
-  void InitObjects(const std::vector<ObjectPtr> &objects) {
-    num_objects_ = static_cast<int>(objects.size());
-    objects_sorted_by_min_ = objects;
-    objects_sorted_by_max_ = objects;
-    std::sort(objects_sorted_by_min_.begin(), objects_sorted_by_min_.end(),
-              [&](ObjectPtr obj1, ObjectPtr obj2) {
-                return partition_ == PARTITION_X
-                           ? obj1->aabox().min_x() < obj2->aabox().min_x()
-                           : obj1->aabox().min_y() < obj2->aabox().min_y();
-              });
-    std::sort(objects_sorted_by_max_.begin(), objects_sorted_by_max_.end(),
-              [&](ObjectPtr obj1, ObjectPtr obj2) {
-                return partition_ == PARTITION_X
-                           ? obj1->aabox().max_x() > obj2->aabox().max_x()
-                           : obj1->aabox().max_y() > obj2->aabox().max_y();
-              });
-    objects_sorted_by_min_bound_.reserve(num_objects_);
-    for (ObjectPtr object : objects_sorted_by_min_) {
-      objects_sorted_by_min_bound_.push_back(partition_ == PARTITION_X
-                                                 ? object->aabox().min_x()
-                                                 : object->aabox().min_y());
-    }
-    objects_sorted_by_max_bound_.reserve(num_objects_);
-    for (ObjectPtr object : objects_sorted_by_max_) {
-      objects_sorted_by_max_bound_.push_back(partition_ == PARTITION_X
-                                                 ? object->aabox().max_x()
-                                                 : object->aabox().max_y());
-    }
-  }
-
-  bool SplitToSubNodes(const std::vector<ObjectPtr> &objects,
-                       const AABoxKDTreeParams &params) {
-    if (params.max_depth >= 0 && depth_ >= params.max_depth) {
-      return false;
-    }
-    if (static_cast<int>(objects.size()) <= std::max(1, params.max_leaf_size)) {
-      return false;
-    }
-    if (params.max_leaf_dimension >= 0.0 &&
-        std::max(max_x_ - min_x_, max_y_ - min_y_) <=
-            params.max_leaf_dimension) {
-      return false;
-    }
-    return true;
-  }
-
   double LowerDistanceSquareToPoint(const Vec2d &point) const {
     double dx = 0.0;
     if (point.x() < min_x_) {
@@ -200,28 +124,20 @@ class AABoxKDTree2dNode {
     return dx * dx + dy * dy;
   }
 
-  void GetAllObjects(std::vector<ObjectPtr> *const result_objects) const {
+  bool SearchLeftFirst(const Vec2d &point) const {
+    const double pvalue = (partition_ == PARTITION_X ? point.x() : point.y());
+    return pvalue < partition_position_;
+  }
+
+  void AppendAllObjects(std::vector<ObjectPtr> *const result_objects) const {
     result_objects->insert(result_objects->end(),
                            objects_sorted_by_min_.begin(),
                            objects_sorted_by_min_.end());
-    if (left_subnode_ != nullptr) {
-      left_subnode_->GetAllObjects(result_objects);
-    }
-    if (right_subnode_ != nullptr) {
-      right_subnode_->GetAllObjects(result_objects);
-    }
   }
 
-  void GetObjectsInternal(const Vec2d &point, const double distance,
-                          const double distance_sqr,
-                          std::vector<ObjectPtr> *const result_objects) const {
-    if (LowerDistanceSquareToPoint(point) > distance_sqr) {
-      return;
-    }
-    if (UpperDistanceSquareToPoint(point) <= distance_sqr) {
-      GetAllObjects(result_objects);
-      return;
-    }
+  void AppendObjectsInRange(
+      const Vec2d &point, const double distance, const double distance_sqr,
+      std::vector<ObjectPtr> *const result_objects) const {
     const double pvalue = (partition_ == PARTITION_X ? point.x() : point.y());
     if (pvalue < partition_position_) {
       const double limit = pvalue + distance;
@@ -246,40 +162,13 @@ class AABoxKDTree2dNode {
         }
       }
     }
-    if (left_subnode_ != nullptr) {
-      left_subnode_->GetObjectsInternal(point, distance, distance_sqr,
-                                        result_objects);
-    }
-    if (right_subnode_ != nullptr) {
-      right_subnode_->GetObjectsInternal(point, distance, distance_sqr,
-                                         result_objects);
-    }
   }
 
-  void GetNearestObjectInternal(const Vec2d &point,
-                                double *const min_distance_sqr,
-                                ObjectPtr *const nearest_object) const {
-    if (LowerDistanceSquareToPoint(point) >= *min_distance_sqr - kMathEpsilon) {
-      return;
-    }
+  void UpdateNearestObject(const Vec2d &point,
+                           double *const min_distance_sqr,
+                           ObjectPtr *const nearest_object) const {
     const double pvalue = (partition_ == PARTITION_X ? point.x() : point.y());
-    const bool search_left_first = (pvalue < partition_position_);
-    if (search_left_first) {
-      if (left_subnode_ != nullptr) {
-        left_subnode_->GetNearestObjectInternal(point, min_distance_sqr,
-                                                nearest_object);
-      }
-    } else {
-      if (right_subnode_ != nullptr) {
-        right_subnode_->GetNearestObjectInternal(point, min_distance_sqr,
-                                                 nearest_object);
-      }
-    }
-    if (*min_distance_sqr <= kMathEpsilon) {
-      return;
-    }
-
-    if (search_left_first) {
+    if (pvalue < partition_position_) {
       for (int i = 0; i < num_objects_; ++i) {
         const double bound = objects_sorted_by_min_bound_[i];
         if (bound > pvalue && Square(bound - pvalue) > *min_distance_sqr) {
@@ -306,22 +195,60 @@ class AABoxKDTree2dNode {
         }
       }
     }
-    if (*min_distance_sqr <= kMathEpsilon) {
-      return;
+  }
+
+  int left_index() const { return left_index_; }
+  int right_index() const { return right_index_; }
+  void set_left_index(const int index) { left_index_ = index; }
+  void set_right_index(const int index) { right_index_ = index; }
+
+ private:
+  void InitObjects(const std::vector<ObjectPtr> &objects) {
+    num_objects_ = static_cast<int>(objects.size());
+    objects_sorted_by_min_ = objects;
+    objects_sorted_by_max_ = objects;
+    std::sort(objects_sorted_by_min_.begin(), objects_sorted_by_min_.end(),
+              [&](ObjectPtr obj1, ObjectPtr obj2) {
+                return partition_ == PARTITION_X
+                           ? obj1->aabox().min_x() < obj2->aabox().min_x()
+                           : obj1->aabox().min_y() < obj2->aabox().min_y();
+              });
+    std::sort(objects_sorted_by_max_.begin(), objects_sorted_by_max_.end(),
+              [&](ObjectPtr obj1, ObjectPtr obj2) {
+                return partition_ == PARTITION_X
+                           ? obj1->aabox().max_x() > obj2->aabox().max_x()
+                           : obj1->aabox().max_y() > obj2->aabox().max_y();
+              });
+    objects_sorted_by_min_bound_.reserve(num_objects_);
+    for (ObjectPtr object : objects_sorted_by_min_) {
+      objects_sorted_by_min_bound_.push_back(partition_ == PARTITION_X
+                                                 ? object->aabox().min_x()
+                                                 : object->aabox().min_y());
     }
-    if (search_left_first) {
-      if (right_subnode_ != nullptr) {
-        right_subnode_->GetNearestObjectInternal(point, min_distance_sqr,
-                                                 nearest_object);
-      }
-    } else {
-      if (left_subnode_ != nullptr) {
-        left_subnode_->GetNearestObjectInternal(point, min_distance_sqr,
-                                                nearest_object);
-      }
+    objects_sorted_by_max_bound_.reserve(num_objects_);
+    for (ObjectPtr object : objects_sorted_by_max_) {
+      objects_sorted_by_max_bound_.push_back(partition_ == PARTITION_X
+                                                 ? object->aabox().max_x()
+                                                 : object->aabox().max_y());
     }
   }
 
+  bool SplitToSubNodes(const std::vector<ObjectPtr> &objects,
+                       const AABoxKDTreeParams &params) {
+    if (params.max_depth >= 0 && depth_ >= params.max_depth) {
+      return false;
+    }
+    if (static_cast<int>(objects.size()) <= std::max(1, params.max_leaf_size)) {
+      return false;
+    }
+    if (params.max_leaf_dimension >= 0.0 &&
+        std::max(max_x_ - min_x_, max_y_ - min_y_) <=
+            params.max_leaf_dimension) {
+      return false;
+    }
+    return true;
+  }
+
   void ComputeBoundary(const std::vector<ObjectPtr> &objects) {
     min_x_ = std::numeric_limits<double>::infinity();
     min_y_ = std::numeric_limits<double>::infinity();
@@ -403,8 +330,8 @@ class AABoxKDTree2dNode {
   Partition partition_ = PARTITION_X;
   double partition_position_ = 0.0;
 
-  std::unique_ptr<AABoxKDTree2dNode<ObjectType>> left_subnode_ = nullptr;
-  std::unique_ptr<AABoxKDTree2dNode<ObjectType>> right_subnode_ = nullptr;
+  int left_index_ = -1;
+  int right_index_ = -1;
 };
 
 /**
@@ -415,6 +342,7 @@ template <class ObjectType>
 class AABoxKDTree2d {
  public:
   using ObjectPtr = const ObjectType *;
+  using Node = AABoxKDTree2dNode<ObjectType>;
 
   /**
    * @brief Contructor which takes a vector of objects and parameters.
@@ -427,7 +355,7 @@ class AABoxKDTree2d {
       for (const auto &object : objects) {
         object_ptrs.push_back(&object);
       }
-      root_.reset(new AABoxKDTree2dNode<ObjectType>(object_ptrs, params, 0));
+      BuildNode(object_ptrs, params, 0);
     }
   }
 
@@ -437,7 +365,12 @@ class AABoxKDTree2d {
    * @return The nearest object to the target point.
    */
   ObjectPtr GetNearestObject(const Vec2d &point) const {
-    return root_ == nullptr ? nullptr : root_->GetNearestObject(point);
+    ObjectPtr nearest_object = nullptr;
+    if (!nodes_.empty()) {
+      double min_distance_sqr = std::numeric_limits<double>::infinity();
+      GetNearestObjectInternal(0, point, &min_distance_sqr, &nearest_object);
+    }
+    return nearest_object;
   }
 
   /**
@@ -448,10 +381,36 @@ class AABoxKDTree2d {
    */
   std::vector<ObjectPtr> GetObjects(const Vec2d &point,
                                     const double distance) const {
-    if (root_ == nullptr) {
-      return {};
+    std::vector<ObjectPtr> result_objects;
+    if (!nodes_.empty()) {
+      std::vector<int> node_stack;
+      GetObjectsWithStack(point, distance, Square(distance), &node_stack,
+                          &result_objects);
     }
-    return root_->GetObjects(point, distance);
+    return result_objects;
+  }
+
+  /**
+   * @brief Get objects within a distance to each of a batch of points,
+   *        reusing the traversal stack across the queries.
+   * @param points The center points of the ranges to search objects.
+   * @param distance The radius of the ranges to search objects.
+   * @return For every point, all objects within the specified distance to it.
+   */
+  std::vector<std::vector<ObjectPtr>> GetObjectsBatch(
+      const std::vector<Vec2d> &points, const double distance) const {
+    std::vector<std::vector<ObjectPtr>> results(points.size());
+    if (nodes_.empty()) {
+      return results;
+    }
+    const double distance_sqr = Square(distance);
+    std::vector<int> node_stack;
+    node_stack.reserve(nodes_.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      GetObjectsWithStack(points[i], distance, distance_sqr, &node_stack,
+                          &results[i]);
+    }
+    return results;
   }
 
   /**
@@ -459,11 +418,109 @@ class AABoxKDTree2d {
    * @return The axis-aligned bounding box of the objects.
    */
   AABox2d GetBoundingBox() const {
-    return root_ == nullptr ? AABox2d() : root_->GetBoundingBox();
+    return nodes_.empty() ? AABox2d() : nodes_[0].GetBoundingBox();
   }
 
  private:
-  std::unique_ptr<AABoxKDTree2dNode<ObjectType>> root_ = nullptr;
+  int BuildNode(const std::vector<ObjectPtr> &objects,
+                const AABoxKDTreeParams &params, const int depth) {
+    std::vector<ObjectPtr> left_subnode_objects;
+    std::vector<ObjectPtr> right_subnode_objects;
+    const int index = static_cast<int>(nodes_.size());
+    nodes_.emplace_back(objects, params, depth, &left_subnode_objects,
+                        &right_subnode_objects);
+    // Build the sub-nodes after the node is in place; the vector may
+    // reallocate while they are built, so re-index instead of keeping a
+    // reference.
+    if (!left_subnode_objects.empty()) {
+      const int left_index = BuildNode(left_subnode_objects, params, depth + 1);
+      nodes_[index].set_left_index(left_index);
+    }
+    if (!right_subnode_objects.empty()) {
+      const int right_index =
+          BuildNode(right_subnode_objects, params, depth + 1);
+      nodes_[index].set_right_index(right_index);
+    }
+    return index;
+  }
+
+  void GetAllObjectsInternal(const int node_index,
+                             std::vector<ObjectPtr> *const result_objects)
+      const {
+    const Node &node = nodes_[node_index];
+    node.AppendAllObjects(result_objects);
+    if (node.left_index() >= 0) {
+      GetAllObjectsInternal(node.left_index(), result_objects);
+    }
+    if (node.right_index() >= 0) {
+      GetAllObjectsInternal(node.right_index(), result_objects);
+    }
+  }
+
+  void GetObjectsWithStack(const Vec2d &point, const double distance,
+                           const double distance_sqr,
+                           std::vector<int> *const node_stack,
+                           std::vector<ObjectPtr> *const result_objects)
+      const {
+    node_stack->clear();
+    node_stack->push_back(0);
+    while (!node_stack->empty()) {
+      const Node &node = nodes_[node_stack->back()];
+      node_stack->pop_back();
+      if (node.LowerDistanceSquareToPoint(point) > distance_sqr) {
+        continue;
+      }
+      if (node.UpperDistanceSquareToPoint(point) <= distance_sqr) {
+        node.AppendAllObjects(result_objects);
+        if (node.left_index() >= 0) {
+          GetAllObjectsInternal(node.left_index(), result_objects);
+        }
+        if (node.right_index() >= 0) {
+          GetAllObjectsInternal(node.right_index(), result_objects);
+        }
+        continue;
+      }
+      node.AppendObjectsInRange(point, distance, distance_sqr, result_objects);
+      if (node.left_index() >= 0) {
+        node_stack->push_back(node.left_index());
+      }
+      if (node.right_index() >= 0) {
+        node_stack->push_back(node.right_index());
+      }
+    }
+  }
+
+  void GetNearestObjectInternal(const int node_index, const Vec2d &point,
+                                double *const min_distance_sqr,
+                                ObjectPtr *const nearest_object) const {
+    const Node &node = nodes_[node_index];
+    if (node.LowerDistanceSquareToPoint(point) >=
+        *min_distance_sqr - kMathEpsilon) {
+      return;
+    }
+    const bool search_left_first = node.SearchLeftFirst(point);
+    const int first_index =
+        search_left_first ? node.left_index() : node.right_index();
+    const int second_index =
+        search_left_first ? node.right_index() : node.left_index();
+    if (first_index >= 0) {
+      GetNearestObjectInternal(first_index, point, min_distance_sqr,
+                               nearest_object);
+    }
+    if (*min_distance_sqr <= kMathEpsilon) {
+      return;
+    }
+    node.UpdateNearestObject(point, min_distance_sqr, nearest_object);
+    if (*min_distance_sqr <= kMathEpsilon) {
+      return;
+    }
+    if (second_index >= 0) {
+      GetNearestObjectInternal(second_index, point, min_distance_sqr,
+                               nearest_object);
+    }
+  }
+
+  std::vector<Node> nodes_;
 };
 
 }  // namespace math
@@ -118,6 +118,42 @@ TEST(AABoxKDTree2dNode, OverallTests) {
   }
 }
 
+TEST(AABoxKDTree2dNode, GetObjectsBatch) {
+  const double kSize = 100;
+  std::vector<Object> objects;
+  for (int i = 0; i < 50; ++i) {
+    const double cx = RandomDouble(-kSize, kSize);
+    const double cy = RandomDouble(-kSize, kSize);
+    const double dx = RandomDouble(-kSize / 10.0, kSize / 10.0);
+    const double dy = RandomDouble(-kSize / 10.0, kSize / 10.0);
+    objects.emplace_back(cx - dx, cy - dy, cx + dx, cy + dy, i);
+  }
+  AABoxKDTreeParams params;
+  params.max_leaf_size = 4;
+  const AABoxKDTree2d<Object> kdtree(objects, params);
+
+  std::vector<Vec2d> points;
+  for (int i = 0; i < 100; ++i) {
+    points.emplace_back(RandomDouble(-kSize * 1.5, kSize * 1.5),
+                        RandomDouble(-kSize * 1.5, kSize * 1.5));
+  }
+  const double distance = kSize / 2.0;
+  const auto batch_results = kdtree.GetObjectsBatch(points, distance);
+  ASSERT_EQ(batch_results.size(), points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto single_result = kdtree.GetObjects(points[i], distance);
+    std::set<int> batch_ids;
+    for (const Object *object : batch_results[i]) {
+      batch_ids.insert(object->id());
+    }
+    std::set<int> single_ids;
+    for (const Object *object : single_result) {
+      single_ids.insert(object->id());
+    }
+    EXPECT_EQ(batch_ids, single_ids);
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
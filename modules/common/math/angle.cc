@@ -22,28 +22,35 @@ namespace apollo {
 namespace common {
 namespace math {
 
-float sin(Angle16 a) {
-  int16_t idx = a.raw();
+namespace {
 
+// Folds a full-circle Angle16 raw value into the quarter-wave table.
+template <typename T, int N>
+T SinFromTable(const SinTable<T, N> &table, int16_t idx) {
   if (idx < -Angle16::RAW_PI_2) {
     idx = static_cast<int16_t>(idx + Angle16::RAW_PI);
-    return -SIN_TABLE[idx % SIN_TABLE_SIZE];
+    return -table[idx % N];
   }
   if (idx < 0) {
-    return -SIN_TABLE[(-idx) % SIN_TABLE_SIZE];
+    return -table[(-idx) % N];
   }
   if (idx < Angle16::RAW_PI_2) {
-    return SIN_TABLE[idx % SIN_TABLE_SIZE];
+    return table[idx % N];
   }
   idx = static_cast<int16_t>(Angle16::RAW_PI - idx);
-  return SIN_TABLE[idx % SIN_TABLE_SIZE];
+  return table[idx % N];
 }
 
-float cos(Angle16 a) {
-  Angle16 b(static_cast<int16_t>(Angle16::RAW_PI_2 - a.raw()));
-  return sin(b);
+int16_t CosRaw(Angle16 a) {
+  return static_cast<int16_t>(Angle16::RAW_PI_2 - a.raw());
 }
 
+}  // namespace
+
+float sin(Angle16 a) { return SinFromTable(SIN_TABLE, a.raw()); }
+
+float cos(Angle16 a) { return SinFromTable(SIN_TABLE, CosRaw(a)); }
+
 float tan(Angle16 a) { return sin(a) / cos(a); }
 
 float sin(Angle8 a) {
@@ -61,6 +68,38 @@ float tan(Angle8 a) {
   return tan(b);
 }
 
+double SinDouble(Angle16 a) { return SinFromTable(SIN_TABLE_DOUBLE, a.raw()); }
+
+double CosDouble(Angle16 a) {
+  return SinFromTable(SIN_TABLE_DOUBLE, CosRaw(a));
+}
+
+double TanDouble(Angle16 a) { return SinDouble(a) / CosDouble(a); }
+
+void SinBatch(const Angle16 *angles, size_t size, float *sines) {
+  for (size_t i = 0; i < size; ++i) {
+    sines[i] = SinFromTable(SIN_TABLE, angles[i].raw());
+  }
+}
+
+void SinBatch(const Angle16 *angles, size_t size, double *sines) {
+  for (size_t i = 0; i < size; ++i) {
+    sines[i] = SinFromTable(SIN_TABLE_DOUBLE, angles[i].raw());
+  }
+}
+
+void CosBatch(const Angle16 *angles, size_t size, float *cosines) {
+  for (size_t i = 0; i < size; ++i) {
+    cosines[i] = SinFromTable(SIN_TABLE, CosRaw(angles[i]));
+  }
+}
+
+void CosBatch(const Angle16 *angles, size_t size, double *cosines) {
+  for (size_t i = 0; i < size; ++i) {
+    cosines[i] = SinFromTable(SIN_TABLE_DOUBLE, CosRaw(angles[i]));
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 
@@ -276,6 +277,31 @@ float sin(Angle8 a);
 float cos(Angle8 a);
 float tan(Angle8 a);
 
+// Double-precision lookups for callers that consume the result as double;
+// they read a double table directly instead of converting the float result.
+double SinDouble(Angle16 a);
+double CosDouble(Angle16 a);
+double TanDouble(Angle16 a);
+
+/**
+ * @brief Computes sin for an array of angles, amortizing the per-call
+ *        overhead of the scalar lookup in per-point loops.
+ * @param angles The input angles.
+ * @param size The number of angles.
+ * @param sines Output array with room for size entries.
+ */
+void SinBatch(const Angle16 *angles, size_t size, float *sines);
+void SinBatch(const Angle16 *angles, size_t size, double *sines);
+
+/**
+ * @brief Computes cos for an array of angles.
+ * @param angles The input angles.
+ * @param size The number of angles.
+ * @param cosines Output array with room for size entries.
+ */
+void CosBatch(const Angle16 *angles, size_t size, float *cosines);
+void CosBatch(const Angle16 *angles, size_t size, double *cosines);
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
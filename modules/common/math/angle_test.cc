@@ -17,6 +17,7 @@
 #include "modules/common/math/angle.h"
 
 #include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "modules/common/math/sin_table.h"
@@ -28,6 +29,41 @@ namespace math {
 TEST(Angle, SIN_TABLE) {
   EXPECT_FLOAT_EQ(0.0f, SIN_TABLE[0]);
   EXPECT_FLOAT_EQ(1.0f, SIN_TABLE[16384]);
+  for (int i = 0; i < SIN_TABLE_SIZE; i += 123) {
+    const double angle = M_PI_2 * i / (SIN_TABLE_SIZE - 1);
+    EXPECT_FLOAT_EQ(static_cast<float>(std::sin(angle)), SIN_TABLE[i]);
+    EXPECT_NEAR(std::sin(angle), SIN_TABLE_DOUBLE[i], 1e-15);
+  }
+}
+
+TEST(Angle, DoublePrecision) {
+  for (int deg = -180; deg < 180; deg += 7) {
+    const auto a = Angle16::from_deg(deg);
+    EXPECT_NEAR(std::sin(a.to_rad()), SinDouble(a), 1e-4);
+    EXPECT_NEAR(std::cos(a.to_rad()), CosDouble(a), 1e-4);
+    EXPECT_DOUBLE_EQ(SinDouble(a) / CosDouble(a), TanDouble(a));
+  }
+}
+
+TEST(Angle, BatchTrigonometry) {
+  std::vector<Angle16> angles;
+  for (int deg = -180; deg < 180; ++deg) {
+    angles.push_back(Angle16::from_deg(deg));
+  }
+  std::vector<float> sines_f(angles.size());
+  std::vector<float> cosines_f(angles.size());
+  std::vector<double> sines_d(angles.size());
+  std::vector<double> cosines_d(angles.size());
+  SinBatch(angles.data(), angles.size(), sines_f.data());
+  CosBatch(angles.data(), angles.size(), cosines_f.data());
+  SinBatch(angles.data(), angles.size(), sines_d.data());
+  CosBatch(angles.data(), angles.size(), cosines_d.data());
+  for (size_t i = 0; i < angles.size(); ++i) {
+    EXPECT_FLOAT_EQ(sin(angles[i]), sines_f[i]);
+    EXPECT_FLOAT_EQ(cos(angles[i]), cosines_f[i]);
+    EXPECT_DOUBLE_EQ(SinDouble(angles[i]), sines_d[i]);
+    EXPECT_DOUBLE_EQ(CosDouble(angles[i]), cosines_d[i]);
+  }
 }
 
 TEST(Angle, Angle8) {
@@ -20,6 +20,12 @@
 #include <cmath>
 #include <utility>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "cyber/common/log.h"
 #include "modules/common/util/string_util.h"
 
@@ -164,6 +170,72 @@ double Box2d::DistanceTo(const Vec2d &point) const {
   return hypot(dx, dy);
 }
 
+void Box2d::DistanceToBatch(const Points2dSoA &points,
+                            double *distances) const {
+  // Branchless form of DistanceTo(point): clamp the box-frame overhangs
+  // at zero, then the three scalar cases collapse into one hypot.
+  const size_t n = points.size();
+  const double cx = center_.x();
+  const double cy = center_.y();
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256d v_cx = _mm256_set1_pd(cx);
+  const __m256d v_cy = _mm256_set1_pd(cy);
+  const __m256d v_cos = _mm256_set1_pd(cos_heading_);
+  const __m256d v_sin = _mm256_set1_pd(sin_heading_);
+  const __m256d v_half_length = _mm256_set1_pd(half_length_);
+  const __m256d v_half_width = _mm256_set1_pd(half_width_);
+  const __m256d v_zero = _mm256_setzero_pd();
+  const __m256d v_abs_mask = _mm256_set1_pd(-0.0);
+  for (; i + 4 <= n; i += 4) {
+    const __m256d x0 = _mm256_sub_pd(_mm256_loadu_pd(&points.x[i]), v_cx);
+    const __m256d y0 = _mm256_sub_pd(_mm256_loadu_pd(&points.y[i]), v_cy);
+    const __m256d fwd = _mm256_andnot_pd(
+        v_abs_mask,
+        _mm256_add_pd(_mm256_mul_pd(x0, v_cos), _mm256_mul_pd(y0, v_sin)));
+    const __m256d lat = _mm256_andnot_pd(
+        v_abs_mask,
+        _mm256_sub_pd(_mm256_mul_pd(x0, v_sin), _mm256_mul_pd(y0, v_cos)));
+    const __m256d dx =
+        _mm256_max_pd(_mm256_sub_pd(fwd, v_half_length), v_zero);
+    const __m256d dy = _mm256_max_pd(_mm256_sub_pd(lat, v_half_width), v_zero);
+    const __m256d dist_sqr =
+        _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+    _mm256_storeu_pd(&distances[i], _mm256_sqrt_pd(dist_sqr));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const float64x2_t v_cx = vdupq_n_f64(cx);
+  const float64x2_t v_cy = vdupq_n_f64(cy);
+  const float64x2_t v_cos = vdupq_n_f64(cos_heading_);
+  const float64x2_t v_sin = vdupq_n_f64(sin_heading_);
+  const float64x2_t v_half_length = vdupq_n_f64(half_length_);
+  const float64x2_t v_half_width = vdupq_n_f64(half_width_);
+  const float64x2_t v_zero = vdupq_n_f64(0.0);
+  for (; i + 2 <= n; i += 2) {
+    const float64x2_t x0 = vsubq_f64(vld1q_f64(&points.x[i]), v_cx);
+    const float64x2_t y0 = vsubq_f64(vld1q_f64(&points.y[i]), v_cy);
+    const float64x2_t fwd =
+        vabsq_f64(vaddq_f64(vmulq_f64(x0, v_cos), vmulq_f64(y0, v_sin)));
+    const float64x2_t lat =
+        vabsq_f64(vsubq_f64(vmulq_f64(x0, v_sin), vmulq_f64(y0, v_cos)));
+    const float64x2_t dx = vmaxq_f64(vsubq_f64(fwd, v_half_length), v_zero);
+    const float64x2_t dy = vmaxq_f64(vsubq_f64(lat, v_half_width), v_zero);
+    const float64x2_t dist_sqr =
+        vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy));
+    vst1q_f64(&distances[i], vsqrtq_f64(dist_sqr));
+  }
+#endif
+  for (; i < n; ++i) {
+    const double x0 = points.x[i] - cx;
+    const double y0 = points.y[i] - cy;
+    const double dx = std::max(
+        std::abs(x0 * cos_heading_ + y0 * sin_heading_) - half_length_, 0.0);
+    const double dy = std::max(
+        std::abs(x0 * sin_heading_ - y0 * cos_heading_) - half_width_, 0.0);
+    distances[i] = std::sqrt(dx * dx + dy * dy);
+  }
+}
+
 bool Box2d::HasOverlap(const LineSegment2d &line_segment) const {
   if (line_segment.length() <= kMathEpsilon) {
     return IsPointIn(line_segment.start());
@@ -28,6 +28,7 @@
 
 #include "modules/common/math/aabox2d.h"
 #include "modules/common/math/line_segment2d.h"
+#include "modules/common/math/points2d_soa.h"
 #include "modules/common/math/vec2d.h"
 
 /**
@@ -191,6 +192,15 @@ class Box2d {
    */
   double DistanceTo(const Vec2d &point) const;
 
+  /**
+   * @brief Determines the distance between the box and a batch of points
+   *        in structure-of-arrays layout. Equivalent to calling DistanceTo
+   *        for every point, but vectorized (AVX2 / NEON when available).
+   * @param points The points whose distances to the box we wish to compute
+   * @param distances Output array with room for points.size() entries
+   */
+  void DistanceToBatch(const Points2dSoA &points, double *distances) const;
+
   /**
    * @brief Determines the distance between the box and a given line segment
    * @param line_segment The line segment whose distance to the box we compute
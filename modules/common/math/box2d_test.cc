@@ -270,6 +270,28 @@ TEST(Box2dTest, TestByRandom) {
   }
 }
 
+TEST(Box2dTest, DistanceToBatch) {
+  for (int iter = 0; iter < 100; ++iter) {
+    const double x = RandomDouble(-10, 10);
+    const double y = RandomDouble(-10, 10);
+    const double heading = RandomDouble(0, M_PI * 2.0);
+    const double length = RandomDouble(1, 5);
+    const double width = RandomDouble(1, 5);
+    const Box2d box({x, y}, heading, length, width);
+
+    std::vector<Vec2d> points;
+    for (int i = 0; i < 37; ++i) {
+      points.emplace_back(RandomDouble(-20, 20), RandomDouble(-20, 20));
+    }
+    const Points2dSoA soa_points(points);
+    std::vector<double> distances(points.size(), 0.0);
+    box.DistanceToBatch(soa_points, distances.data());
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_NEAR(distances[i], box.DistanceTo(points[i]), 1e-9);
+    }
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
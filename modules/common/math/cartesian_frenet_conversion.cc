@@ -16,7 +16,15 @@
 
 #include "modules/common/math/cartesian_frenet_conversion.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 #include "cyber/common/log.h"
 #include "modules/common/math/math_utils.h"
@@ -185,6 +193,143 @@ double CartesianFrenetConverter::CalculateSecondOrderLateralDerivative(
   return res;
 }
 
+FrenetFrame::FrenetFrame(const std::vector<ReferencePoint>& points) {
+  CHECK_GE(points.size(), 2);
+  const size_t n = points.size();
+  s_.reserve(n);
+  x_.reserve(n);
+  y_.reserve(n);
+  theta_.reserve(n);
+  cos_theta_.reserve(n);
+  sin_theta_.reserve(n);
+  kappa_.reserve(n);
+  dkappa_.reserve(n);
+  for (const auto& point : points) {
+    if (!s_.empty()) {
+      CHECK_GT(point.s, s_.back());
+    }
+    s_.push_back(point.s);
+    x_.push_back(point.x);
+    y_.push_back(point.y);
+    theta_.push_back(point.theta);
+    cos_theta_.push_back(std::cos(point.theta));
+    sin_theta_.push_back(std::sin(point.theta));
+    kappa_.push_back(point.kappa);
+    dkappa_.push_back(point.dkappa);
+  }
+}
+
+int FrenetFrame::MatchIndex(const Vec2d& point,
+                            std::vector<double>* const distance_sqr) const {
+  const int n = static_cast<int>(s_.size());
+  distance_sqr->resize(n);
+  const double px = point.x();
+  const double py = point.y();
+  double* out = distance_sqr->data();
+  int i = 0;
+#if defined(__AVX2__)
+  const __m256d v_px = _mm256_set1_pd(px);
+  const __m256d v_py = _mm256_set1_pd(py);
+  for (; i + 4 <= n; i += 4) {
+    const __m256d dx = _mm256_sub_pd(v_px, _mm256_loadu_pd(&x_[i]));
+    const __m256d dy = _mm256_sub_pd(v_py, _mm256_loadu_pd(&y_[i]));
+    _mm256_storeu_pd(&out[i],
+                     _mm256_add_pd(_mm256_mul_pd(dx, dx),
+                                   _mm256_mul_pd(dy, dy)));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const float64x2_t v_px = vdupq_n_f64(px);
+  const float64x2_t v_py = vdupq_n_f64(py);
+  for (; i + 2 <= n; i += 2) {
+    const float64x2_t dx = vsubq_f64(v_px, vld1q_f64(&x_[i]));
+    const float64x2_t dy = vsubq_f64(v_py, vld1q_f64(&y_[i]));
+    vst1q_f64(&out[i], vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy)));
+  }
+#endif
+  for (; i < n; ++i) {
+    const double dx = px - x_[i];
+    const double dy = py - y_[i];
+    out[i] = dx * dx + dy * dy;
+  }
+  int best = 0;
+  double best_sqr = out[0];
+  for (i = 1; i < n; ++i) {
+    if (out[i] < best_sqr) {
+      best_sqr = out[i];
+      best = i;
+    }
+  }
+  return best;
+}
+
+int FrenetFrame::LocateIndex(const double s) const {
+  const auto upper = std::upper_bound(s_.begin(), s_.end(), s);
+  const int index = static_cast<int>(upper - s_.begin()) - 1;
+  return std::min(std::max(index, 0), static_cast<int>(s_.size()) - 2);
+}
+
+Vec2d FrenetFrame::ToCartesianAt(const int index, const double s,
+                                 const double d) const {
+  const double ratio = (s - s_[index]) / (s_[index + 1] - s_[index]);
+  const double rx = x_[index] + ratio * (x_[index + 1] - x_[index]);
+  const double ry = y_[index] + ratio * (y_[index + 1] - y_[index]);
+  const double rtheta =
+      theta_[index] +
+      ratio * NormalizeAngle(theta_[index + 1] - theta_[index]);
+  return Vec2d(rx - d * std::sin(rtheta), ry + d * std::cos(rtheta));
+}
+
+void FrenetFrame::ToFrenet(const Vec2d& point, double* const ptr_s,
+                           double* const ptr_d) const {
+  std::vector<double> distance_sqr;
+  const int index = MatchIndex(point, &distance_sqr);
+  const double dx = point.x() - x_[index];
+  const double dy = point.y() - y_[index];
+  *ptr_s = s_[index] + dx * cos_theta_[index] + dy * sin_theta_[index];
+  *ptr_d = dy * cos_theta_[index] - dx * sin_theta_[index];
+}
+
+Vec2d FrenetFrame::ToCartesian(const double s, const double d) const {
+  return ToCartesianAt(LocateIndex(s), s, d);
+}
+
+void FrenetFrame::ToFrenetBatch(const std::vector<Vec2d>& points,
+                                std::vector<double>* const ptr_s,
+                                std::vector<double>* const ptr_d) const {
+  ptr_s->resize(points.size());
+  ptr_d->resize(points.size());
+  std::vector<double> distance_sqr;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const int index = MatchIndex(points[i], &distance_sqr);
+    const double dx = points[i].x() - x_[index];
+    const double dy = points[i].y() - y_[index];
+    (*ptr_s)[i] = s_[index] + dx * cos_theta_[index] + dy * sin_theta_[index];
+    (*ptr_d)[i] = dy * cos_theta_[index] - dx * sin_theta_[index];
+  }
+}
+
+void FrenetFrame::ToCartesianBatch(const std::vector<double>& s,
+                                   const std::vector<double>& d,
+                                   std::vector<Vec2d>* const points) const {
+  CHECK_EQ(s.size(), d.size());
+  points->resize(s.size());
+  int index = 0;
+  double last_s = -std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i < s.size(); ++i) {
+    if (s[i] < last_s) {
+      index = LocateIndex(s[i]);
+    } else {
+      while (index + 2 < static_cast<int>(s_.size()) &&
+             s_[index + 1] <= s[i]) {
+        ++index;
+      }
+    }
+    last_s = s[i];
+    (*points)[i] = ToCartesianAt(index, s[i], d[i]);
+  }
+  return;
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include "modules/common/math/vec2d.h"
 
@@ -100,6 +101,88 @@ class CartesianFrenetConverter {
       const double kappa, const double dkappa_ref, const double l);
 };
 
+/**
+ * @class FrenetFrame
+ * @brief A reference line sampled once into structure-of-arrays caches
+ *        (position, heading with its cosine/sine, curvature, arc length),
+ *        so converting many trajectory points against the same reference
+ *        line does not re-derive the per-point frame each call.
+ */
+class FrenetFrame {
+ public:
+  struct ReferencePoint {
+    double s = 0.0;
+    double x = 0.0;
+    double y = 0.0;
+    double theta = 0.0;
+    double kappa = 0.0;
+    double dkappa = 0.0;
+  };
+
+  /**
+   * @param points Reference-line samples ordered by increasing s.
+   */
+  explicit FrenetFrame(const std::vector<ReferencePoint>& points);
+
+  /**
+   * @brief Convert a Cartesian point to Frenet coordinates against the
+   *        cached reference line. The point is matched to the nearest
+   *        sample and its s refined by projection onto that sample's
+   *        tangent.
+   */
+  void ToFrenet(const Vec2d& point, double* const ptr_s,
+                double* const ptr_d) const;
+
+  /**
+   * @brief Convert a Frenet point to a Cartesian point, interpolating the
+   *        cached samples at s.
+   */
+  Vec2d ToCartesian(const double s, const double d) const;
+
+  /**
+   * @brief Convert a batch of Cartesian points, reusing the per-query
+   *        distance scratch buffer across the batch.
+   * @param points The points to convert.
+   * @param ptr_s Output longitudinal coordinates, resized to points.size().
+   * @param ptr_d Output lateral coordinates, resized to points.size().
+   */
+  void ToFrenetBatch(const std::vector<Vec2d>& points,
+                     std::vector<double>* const ptr_s,
+                     std::vector<double>* const ptr_d) const;
+
+  /**
+   * @brief Convert a batch of Frenet points. When s is non-decreasing (the
+   *        common trajectory case) the reference index advances instead of
+   *        being searched per point.
+   * @param s The longitudinal coordinates.
+   * @param d The lateral coordinates.
+   * @param points Output Cartesian points, resized to s.size().
+   */
+  void ToCartesianBatch(const std::vector<double>& s,
+                        const std::vector<double>& d,
+                        std::vector<Vec2d>* const points) const;
+
+  size_t size() const { return s_.size(); }
+
+ private:
+  // Index of the sample nearest to the point; distances are computed into
+  // the provided scratch buffer.
+  int MatchIndex(const Vec2d& point,
+                 std::vector<double>* const distance_sqr) const;
+  // Index of the last sample with s_[index] <= s (clamped to a segment).
+  int LocateIndex(const double s) const;
+  Vec2d ToCartesianAt(const int index, const double s, const double d) const;
+
+  std::vector<double> s_;
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> theta_;
+  std::vector<double> cos_theta_;
+  std::vector<double> sin_theta_;
+  std::vector<double> kappa_;
+  std::vector<double> dkappa_;
+};
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
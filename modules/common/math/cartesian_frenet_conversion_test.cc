@@ -18,6 +18,7 @@
 
 #include <array>
 #include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -65,6 +66,55 @@ TEST(TestCartesianFrenetConversion, cartesian_to_frenet_test) {
   EXPECT_NEAR(a, a_out, 1.0e-6);
 }
 
+TEST(TestCartesianFrenetConversion, frenet_frame_round_trip) {
+  // Reference line: a circular arc of radius 100, densely sampled.
+  const double kRadius = 100.0;
+  const double kStep = 0.5;
+  std::vector<FrenetFrame::ReferencePoint> ref_points;
+  for (int i = 0; i <= 400; ++i) {
+    FrenetFrame::ReferencePoint point;
+    point.s = i * kStep;
+    const double angle = point.s / kRadius;
+    point.x = kRadius * std::sin(angle);
+    point.y = kRadius * (1.0 - std::cos(angle));
+    point.theta = angle;
+    point.kappa = 1.0 / kRadius;
+    ref_points.push_back(point);
+  }
+  const FrenetFrame frame(ref_points);
+  EXPECT_EQ(frame.size(), ref_points.size());
+
+  std::vector<double> s_in;
+  std::vector<double> d_in;
+  for (int i = 0; i < 100; ++i) {
+    s_in.push_back(1.0 + i * 1.9);
+    d_in.push_back(-3.0 + 0.06 * i);
+  }
+  std::vector<Vec2d> points;
+  frame.ToCartesianBatch(s_in, d_in, &points);
+  ASSERT_EQ(points.size(), s_in.size());
+
+  std::vector<double> s_out;
+  std::vector<double> d_out;
+  frame.ToFrenetBatch(points, &s_out, &d_out);
+  for (size_t i = 0; i < s_in.size(); ++i) {
+    EXPECT_NEAR(s_in[i], s_out[i], 1e-2);
+    EXPECT_NEAR(d_in[i], d_out[i], 1e-2);
+  }
+
+  // The point-wise conversions must match the batch ones.
+  for (size_t i = 0; i < s_in.size(); i += 13) {
+    const Vec2d point = frame.ToCartesian(s_in[i], d_in[i]);
+    EXPECT_NEAR(point.x(), points[i].x(), 1e-12);
+    EXPECT_NEAR(point.y(), points[i].y(), 1e-12);
+    double s = 0.0;
+    double d = 0.0;
+    frame.ToFrenet(points[i], &s, &d);
+    EXPECT_NEAR(s, s_out[i], 1e-12);
+    EXPECT_NEAR(d, d_out[i], 1e-12);
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -0,0 +1,112 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Microbenchmark comparing the scalar point-distance queries of
+ *        LineSegment2d and Box2d against their batch (SIMD) kernels.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "modules/common/math/box2d.h"
+#include "modules/common/math/line_segment2d.h"
+#include "modules/common/math/points2d_soa.h"
+#include "modules/common/math/vec2d.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+namespace {
+
+constexpr int kNumPoints = 4096;
+constexpr int kNumRounds = 1000;
+
+double NowSeconds() {
+  return std::chrono::duration<double>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void Report(const char *name, double seconds, double checksum) {
+  const double ns_per_point =
+      seconds * 1e9 / (static_cast<double>(kNumPoints) * kNumRounds);
+  std::printf("%-24s %8.2f ns/point (checksum %.6f)\n", name, ns_per_point,
+              checksum);
+}
+
+}  // namespace
+
+void RunBenchmark() {
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> dis(-50.0, 50.0);
+  std::vector<Vec2d> points;
+  points.reserve(kNumPoints);
+  for (int i = 0; i < kNumPoints; ++i) {
+    points.emplace_back(dis(gen), dis(gen));
+  }
+  const Points2dSoA soa_points(points);
+  std::vector<double> distances(kNumPoints, 0.0);
+
+  const LineSegment2d segment({-10.0, -5.0}, {20.0, 15.0});
+  const Box2d box({3.0, -2.0}, 0.7, 8.0, 3.0);
+
+  double checksum = 0.0;
+  double start = NowSeconds();
+  for (int round = 0; round < kNumRounds; ++round) {
+    for (int i = 0; i < kNumPoints; ++i) {
+      checksum += segment.DistanceTo(points[i]);
+    }
+  }
+  Report("segment scalar", NowSeconds() - start, checksum);
+
+  checksum = 0.0;
+  start = NowSeconds();
+  for (int round = 0; round < kNumRounds; ++round) {
+    segment.DistanceToBatch(soa_points, distances.data());
+    checksum += distances[round % kNumPoints];
+  }
+  Report("segment batch", NowSeconds() - start, checksum);
+
+  checksum = 0.0;
+  start = NowSeconds();
+  for (int round = 0; round < kNumRounds; ++round) {
+    for (int i = 0; i < kNumPoints; ++i) {
+      checksum += box.DistanceTo(points[i]);
+    }
+  }
+  Report("box scalar", NowSeconds() - start, checksum);
+
+  checksum = 0.0;
+  start = NowSeconds();
+  for (int round = 0; round < kNumRounds; ++round) {
+    box.DistanceToBatch(soa_points, distances.data());
+    checksum += distances[round % kNumPoints];
+  }
+  Report("box batch", NowSeconds() - start, checksum);
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
+
+int main(int argc, char *argv[]) {
+  apollo::common::math::RunBenchmark();
+  return 0;
+}
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <cmath>
+#include <cstddef>
 #include <sstream>
 #include <string>
 
@@ -189,6 +191,19 @@ class KalmanFilter {
    */
   void Correct(const Eigen::Matrix<T, ZN, 1> &z);
 
+  /**
+   * @brief Runs the predict step over an array of filters sharing one
+   *        control input, as multi-target trackers do once per frame.
+   *        Hoists the per-call checks out of the loop.
+   *
+   * @param filters Pointers to the filters to predict
+   * @param size Number of filters
+   * @param u Control input (by default, zero)
+   */
+  static void PredictBatch(
+      KalmanFilter *const *filters, size_t size,
+      const Eigen::Matrix<T, UN, 1> &u = Eigen::Matrix<T, UN, 1>::Zero());
+
   /**
    * @brief Gets mean of our current state belief distribution
    *
@@ -247,35 +262,78 @@ class KalmanFilter {
   // Kalman gain; marked as member to prevent memory re-allocation.
   Eigen::Matrix<T, XN, ZN> K_;
 
+  // Runs the predict step without the initialization check; shared by
+  // Predict and PredictBatch. All temporaries are fixed-size and
+  // explicitly materialized with noalias, so no expression falls back to
+  // an aliasing-safe heap temporary.
+  void PredictInternal(const Eigen::Matrix<T, UN, 1> &u);
+
   // true iff SetStateEstimate has been called.
   bool is_initialized_ = false;
 };
 
+template <typename T, unsigned int XN, unsigned int ZN, unsigned int UN>
+inline void KalmanFilter<T, XN, ZN, UN>::PredictInternal(
+    const Eigen::Matrix<T, UN, 1> &u) {
+  Eigen::Matrix<T, XN, 1> x_prior;
+  x_prior.noalias() = F_ * x_;
+  x_prior.noalias() += B_ * u;
+  x_ = x_prior;
+
+  Eigen::Matrix<T, XN, XN> FP;
+  FP.noalias() = F_ * P_;
+  P_.noalias() = FP * F_.transpose();
+  P_ += Q_;
+}
+
 template <typename T, unsigned int XN, unsigned int ZN, unsigned int UN>
 inline void KalmanFilter<T, XN, ZN, UN>::Predict(
     const Eigen::Matrix<T, UN, 1> &u) {
   CHECK(is_initialized_);
 
-  x_ = F_ * x_ + B_ * u;
+  PredictInternal(u);
+}
 
-  P_ = F_ * P_ * F_.transpose() + Q_;
+template <typename T, unsigned int XN, unsigned int ZN, unsigned int UN>
+inline void KalmanFilter<T, XN, ZN, UN>::PredictBatch(
+    KalmanFilter *const *filters, size_t size,
+    const Eigen::Matrix<T, UN, 1> &u) {
+  for (size_t i = 0; i < size; ++i) {
+    CHECK(filters[i] != nullptr && filters[i]->is_initialized_);
+  }
+  for (size_t i = 0; i < size; ++i) {
+    filters[i]->PredictInternal(u);
+  }
 }
 
 template <typename T, unsigned int XN, unsigned int ZN, unsigned int UN>
 inline void KalmanFilter<T, XN, ZN, UN>::Correct(
     const Eigen::Matrix<T, ZN, 1> &z) {
   CHECK(is_initialized_);
-  y_ = z - H_ * x_;
-
-  S_ = static_cast<Eigen::Matrix<T, ZN, ZN>>(H_ * P_ * H_.transpose() + R_);
-
-  K_ = static_cast<Eigen::Matrix<T, XN, ZN>>(P_ * H_.transpose() *
-                                             PseudoInverse<T, ZN>(S_));
+  y_ = z;
+  y_.noalias() -= H_ * x_;
+
+  Eigen::Matrix<T, XN, ZN> PHt;
+  PHt.noalias() = P_ * H_.transpose();
+
+  S_ = R_;
+  S_.noalias() += H_ * PHt;
+
+  // The fixed-size inverse is evaluated on the stack; the SVD-based
+  // pseudo-inverse is kept as the fallback for a (near-)singular
+  // innovation covariance.
+  constexpr double kDeterminantEpsilon = 1.0e-12;
+  if (std::abs(static_cast<double>(S_.determinant())) > kDeterminantEpsilon) {
+    K_.noalias() = PHt * S_.inverse();
+  } else {
+    K_.noalias() = PHt * PseudoInverse<T, ZN>(S_);
+  }
 
-  x_ = x_ + K_ * y_;
+  x_.noalias() += K_ * y_;
 
-  P_ = static_cast<Eigen::Matrix<T, XN, XN>>(
-      (Eigen::Matrix<T, XN, XN>::Identity() - K_ * H_) * P_);
+  Eigen::Matrix<T, ZN, XN> HP;
+  HP.noalias() = H_ * P_;
+  P_.noalias() -= K_ * HP;
 }
 
 template <typename T, unsigned int XN, unsigned int ZN, unsigned int UN>
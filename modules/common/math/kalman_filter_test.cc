@@ -101,6 +101,21 @@ TEST_F(KalmanFilterTest, SyntheticTrackingTest) {
   EXPECT_NEAR(0.08826, state_cov(1, 1), 0.001);
 }
 
+TEST_F(KalmanFilterTest, PredictBatchTest) {
+  KalmanFilter<double, 2, 1, 1> reference = kf_;
+  KalmanFilter<double, 2, 1, 1> other = kf_;
+  Eigen::Matrix<double, 1, 1> u;
+  u(0, 0) = 0.5;
+  reference.Predict(u);
+
+  KalmanFilter<double, 2, 1, 1>* filters[2] = {&kf_, &other};
+  KalmanFilter<double, 2, 1, 1>::PredictBatch(filters, 2, u);
+  for (const auto* filter : filters) {
+    EXPECT_EQ(reference.GetStateEstimate(), filter->GetStateEstimate());
+    EXPECT_EQ(reference.GetStateCovariance(), filter->GetStateCovariance());
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
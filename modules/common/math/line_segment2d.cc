@@ -20,6 +20,12 @@
 #include <cmath>
 #include <utility>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "cyber/common/log.h"
 #include "modules/common/util/string_util.h"
 
@@ -132,6 +138,66 @@ double LineSegment2d::DistanceSquareTo(const Vec2d &point,
   return Square(x0 * unit_direction_.y() - y0 * unit_direction_.x());
 }
 
+void LineSegment2d::DistanceToBatch(const Points2dSoA &points,
+                                    double *distances) const {
+  // Branchless form of DistanceTo: clamp the projection onto the segment
+  // and measure to the clamped foot point. A degenerate segment has a
+  // zero unit direction, so the projection clamps to zero and the result
+  // is the distance to start_, matching the scalar path.
+  const size_t n = points.size();
+  const double sx = start_.x();
+  const double sy = start_.y();
+  const double ux = unit_direction_.x();
+  const double uy = unit_direction_.y();
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256d v_sx = _mm256_set1_pd(sx);
+  const __m256d v_sy = _mm256_set1_pd(sy);
+  const __m256d v_ux = _mm256_set1_pd(ux);
+  const __m256d v_uy = _mm256_set1_pd(uy);
+  const __m256d v_zero = _mm256_setzero_pd();
+  const __m256d v_length = _mm256_set1_pd(length_);
+  for (; i + 4 <= n; i += 4) {
+    const __m256d x0 = _mm256_sub_pd(_mm256_loadu_pd(&points.x[i]), v_sx);
+    const __m256d y0 = _mm256_sub_pd(_mm256_loadu_pd(&points.y[i]), v_sy);
+    __m256d proj =
+        _mm256_add_pd(_mm256_mul_pd(x0, v_ux), _mm256_mul_pd(y0, v_uy));
+    proj = _mm256_min_pd(_mm256_max_pd(proj, v_zero), v_length);
+    const __m256d dx = _mm256_sub_pd(x0, _mm256_mul_pd(proj, v_ux));
+    const __m256d dy = _mm256_sub_pd(y0, _mm256_mul_pd(proj, v_uy));
+    const __m256d dist_sqr =
+        _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+    _mm256_storeu_pd(&distances[i], _mm256_sqrt_pd(dist_sqr));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const float64x2_t v_sx = vdupq_n_f64(sx);
+  const float64x2_t v_sy = vdupq_n_f64(sy);
+  const float64x2_t v_ux = vdupq_n_f64(ux);
+  const float64x2_t v_uy = vdupq_n_f64(uy);
+  const float64x2_t v_zero = vdupq_n_f64(0.0);
+  const float64x2_t v_length = vdupq_n_f64(length_);
+  for (; i + 2 <= n; i += 2) {
+    const float64x2_t x0 = vsubq_f64(vld1q_f64(&points.x[i]), v_sx);
+    const float64x2_t y0 = vsubq_f64(vld1q_f64(&points.y[i]), v_sy);
+    float64x2_t proj = vaddq_f64(vmulq_f64(x0, v_ux), vmulq_f64(y0, v_uy));
+    proj = vminq_f64(vmaxq_f64(proj, v_zero), v_length);
+    const float64x2_t dx = vsubq_f64(x0, vmulq_f64(proj, v_ux));
+    const float64x2_t dy = vsubq_f64(y0, vmulq_f64(proj, v_uy));
+    const float64x2_t dist_sqr =
+        vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy));
+    vst1q_f64(&distances[i], vsqrtq_f64(dist_sqr));
+  }
+#endif
+  for (; i < n; ++i) {
+    const double x0 = points.x[i] - sx;
+    const double y0 = points.y[i] - sy;
+    const double proj = std::min(std::max(x0 * ux + y0 * uy, 0.0), length_);
+    const double dx = x0 - proj * ux;
+    const double dy = y0 - proj * uy;
+    distances[i] = std::sqrt(dx * dx + dy * dy);
+  }
+}
+
 bool LineSegment2d::IsPointIn(const Vec2d &point) const {
   if (length_ <= kMathEpsilon) {
     return std::abs(point.x() - start_.x()) <= kMathEpsilon &&
@@ -17,6 +17,7 @@
 #include "modules/common/math/line_segment2d.h"
 
 #include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -116,6 +117,29 @@ TEST(LineSegment2dTest, IsPointIn) {
   EXPECT_FALSE(ls.IsPointIn({6, 6}));
 }
 
+TEST(LineSegment2dTest, DistanceToBatch) {
+  const LineSegment2d ls({1, 2}, {5, 4});
+  const LineSegment2d degenerate_ls({3, 3}, {3, 3});
+  std::vector<Vec2d> points;
+  for (double x = -2.0; x <= 8.0; x += 0.37) {
+    for (double y = -2.0; y <= 8.0; y += 0.41) {
+      points.emplace_back(x, y);
+    }
+  }
+  const Points2dSoA soa_points(points);
+  std::vector<double> distances(points.size(), 0.0);
+
+  ls.DistanceToBatch(soa_points, distances.data());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(distances[i], ls.DistanceTo(points[i]), 1e-9);
+  }
+
+  degenerate_ls.DistanceToBatch(soa_points, distances.data());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(distances[i], degenerate_ls.DistanceTo(points[i]), 1e-9);
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -0,0 +1,293 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Benchmark suite for the hot common/math kernels, with an optional
+ *        regression-guard mode.
+ *
+ * Run without arguments for plain measurements. Pass
+ *   --check_thresholds=<file>
+ * where each line of <file> is "<benchmark name> <max ns per iteration>"
+ * to turn the run into a release gate: the process exits non-zero when a
+ * listed benchmark is slower than its threshold.
+ *
+ * The inputs model the shapes the planning stack actually produces: a
+ * vehicle-sized obstacle polygon, a 500-point reference line, and the MPC
+ * problem dimensions of MPCController.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/common/math/aaboxkdtree2d.h"
+#include "modules/common/math/box2d.h"
+#include "modules/common/math/cartesian_frenet_conversion.h"
+#include "modules/common/math/line_segment2d.h"
+#include "modules/common/math/mpc_solver.h"
+#include "modules/common/math/polygon2d.h"
+#include "modules/common/math/vec2d.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+namespace {
+
+// A reference-line segment with an axis-aligned box, as AABoxKDTree2d
+// expects its objects.
+class BenchSegment {
+ public:
+  explicit BenchSegment(const LineSegment2d &segment)
+      : segment_(segment), aabox_(segment.start(), segment.end()) {}
+  const AABox2d &aabox() const { return aabox_; }
+  double DistanceTo(const Vec2d &point) const {
+    return segment_.DistanceTo(point);
+  }
+  double DistanceSquareTo(const Vec2d &point) const {
+    return segment_.DistanceSquareTo(point);
+  }
+
+ private:
+  LineSegment2d segment_;
+  AABox2d aabox_;
+};
+
+std::vector<Vec2d> MakeReferenceLine(const int num_points) {
+  std::vector<Vec2d> points;
+  points.reserve(num_points);
+  double x = 0.0;
+  double y = 0.0;
+  double theta = 0.0;
+  for (int i = 0; i < num_points; ++i) {
+    points.emplace_back(x, y);
+    theta += 0.01 * std::sin(0.005 * i);
+    x += 0.5 * std::cos(theta);
+    y += 0.5 * std::sin(theta);
+  }
+  return points;
+}
+
+std::vector<Vec2d> MakeQueryPoints(const int num_points) {
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> dis(-40.0, 40.0);
+  std::vector<Vec2d> points;
+  points.reserve(num_points);
+  for (int i = 0; i < num_points; ++i) {
+    points.emplace_back(dis(gen), dis(gen));
+  }
+  return points;
+}
+
+void BM_Polygon2dDistanceTo(benchmark::State &state) {
+  // A perception obstacle polygon: a vehicle box with clipped corners.
+  const Polygon2d polygon({{4.5, 1.0},
+                           {4.8, 0.6},
+                           {4.8, -0.6},
+                           {4.5, -1.0},
+                           {-0.8, -1.0},
+                           {-1.1, -0.6},
+                           {-1.1, 0.6},
+                           {-0.8, 1.0}});
+  const auto queries = MakeQueryPoints(1024);
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(polygon.DistanceTo(queries[i]));
+    i = (i + 1) % queries.size();
+  }
+}
+BENCHMARK(BM_Polygon2dDistanceTo);
+
+void BM_AABoxKDTree2dGetNearestObject(benchmark::State &state) {
+  const auto reference_line = MakeReferenceLine(500);
+  std::vector<BenchSegment> segments;
+  segments.reserve(reference_line.size() - 1);
+  for (size_t i = 0; i + 1 < reference_line.size(); ++i) {
+    segments.emplace_back(
+        LineSegment2d(reference_line[i], reference_line[i + 1]));
+  }
+  AABoxKDTreeParams params;
+  params.max_leaf_size = 16;
+  const AABoxKDTree2d<BenchSegment> kdtree(segments, params);
+  const auto queries = MakeQueryPoints(1024);
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(kdtree.GetNearestObject(queries[i]));
+    i = (i + 1) % queries.size();
+  }
+}
+BENCHMARK(BM_AABoxKDTree2dGetNearestObject);
+
+void BM_CartesianToFrenet(benchmark::State &state) {
+  // One conversion of a vehicle state against a reference point, as the
+  // lattice planner issues per obstacle trajectory point.
+  std::array<double, 3> s_conditions;
+  std::array<double, 3> d_conditions;
+  while (state.KeepRunning()) {
+    CartesianFrenetConverter::cartesian_to_frenet(
+        10.0, 0.0, 0.0, M_PI / 4.0, 0.1, 0.01, -1.0, 1.0, 2.0, 0.0, M_PI / 3.0,
+        0.11, &s_conditions, &d_conditions);
+    benchmark::DoNotOptimize(s_conditions);
+    benchmark::DoNotOptimize(d_conditions);
+  }
+}
+BENCHMARK(BM_CartesianToFrenet);
+
+void BM_SolveLinearMPC(benchmark::State &state) {
+  // The MPCController problem shape: 6 states, 2 controls, horizon 10.
+  const int states = 6;
+  const int controls = 2;
+  const int horizon = 10;
+  Eigen::MatrixXd a = Eigen::MatrixXd::Identity(states, states);
+  a(0, 1) = 0.01;
+  a(2, 3) = 0.01;
+  a(4, 5) = 0.01;
+  Eigen::MatrixXd b = Eigen::MatrixXd::Zero(states, controls);
+  b(1, 0) = 0.05;
+  b(5, 1) = 0.05;
+  const Eigen::MatrixXd c = Eigen::MatrixXd::Zero(states, 1);
+  const Eigen::MatrixXd q = Eigen::MatrixXd::Identity(states, states);
+  const Eigen::MatrixXd r = Eigen::MatrixXd::Identity(controls, controls);
+  Eigen::MatrixXd lower_bound(controls, 1);
+  lower_bound << -0.6, -4.0;
+  Eigen::MatrixXd upper_bound(controls, 1);
+  upper_bound << 0.6, 2.0;
+  Eigen::MatrixXd initial_state = Eigen::MatrixXd::Zero(states, 1);
+  initial_state(0, 0) = 0.5;
+  initial_state(2, 0) = 0.1;
+  const std::vector<Eigen::MatrixXd> reference(
+      horizon, Eigen::MatrixXd::Zero(states, 1));
+  std::vector<Eigen::MatrixXd> control(horizon,
+                                       Eigen::MatrixXd::Zero(controls, 1));
+  std::vector<Eigen::MatrixXd> control_gain(
+      horizon, Eigen::MatrixXd::Zero(controls, states));
+  std::vector<Eigen::MatrixXd> addition_gain(
+      horizon, Eigen::MatrixXd::Zero(controls, 1));
+  LinearMpcSolver solver(horizon, 0.01, 100);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        solver.Solve(a, b, c, q, r, lower_bound, upper_bound, initial_state,
+                     reference, &control, &control_gain, &addition_gain));
+  }
+}
+BENCHMARK(BM_SolveLinearMPC);
+
+// Collects ns-per-iteration per benchmark on top of the normal console
+// output, for the threshold check.
+class ThresholdReporter : public ::benchmark::ConsoleReporter {
+ public:
+  void ReportRuns(const std::vector<Run> &reports) override {
+    ::benchmark::ConsoleReporter::ReportRuns(reports);
+    for (const auto &run : reports) {
+      if (run.iterations > 0) {
+        ns_per_iteration_[run.benchmark_name] =
+            run.real_accumulated_time * 1e9 /
+            static_cast<double>(run.iterations);
+      }
+    }
+  }
+
+  // Returns the number of benchmarks slower than their threshold.
+  int CheckThresholds(const std::map<std::string, double> &thresholds) const {
+    int num_violations = 0;
+    for (const auto &threshold : thresholds) {
+      const auto it = ns_per_iteration_.find(threshold.first);
+      if (it == ns_per_iteration_.end()) {
+        std::fprintf(stderr, "threshold check: benchmark %s did not run\n",
+                     threshold.first.c_str());
+        ++num_violations;
+      } else if (it->second > threshold.second) {
+        std::fprintf(stderr,
+                     "threshold check: %s took %.1f ns/iter, limit %.1f\n",
+                     threshold.first.c_str(), it->second, threshold.second);
+        ++num_violations;
+      }
+    }
+    return num_violations;
+  }
+
+ private:
+  std::map<std::string, double> ns_per_iteration_;
+};
+
+bool LoadThresholds(const std::string &path,
+                    std::map<std::string, double> *const thresholds) {
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    std::fprintf(stderr, "cannot open threshold file %s\n", path.c_str());
+    return false;
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string name;
+    double max_ns = 0.0;
+    if (iss >> name >> max_ns) {
+      (*thresholds)[name] = max_ns;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
+
+int main(int argc, char **argv) {
+  std::string threshold_path;
+  int num_args = 1;
+  for (int i = 1; i < argc; ++i) {
+    constexpr char kThresholdFlag[] = "--check_thresholds=";
+    if (std::strncmp(argv[i], kThresholdFlag, sizeof(kThresholdFlag) - 1) ==
+        0) {
+      threshold_path = argv[i] + sizeof(kThresholdFlag) - 1;
+    } else {
+      argv[num_args++] = argv[i];
+    }
+  }
+  argc = num_args;
+
+  std::map<std::string, double> thresholds;
+  if (!threshold_path.empty() &&
+      !apollo::common::math::LoadThresholds(threshold_path, &thresholds)) {
+    return 1;
+  }
+
+  ::benchmark::Initialize(&argc, argv);
+  apollo::common::math::ThresholdReporter reporter;
+  ::benchmark::RunSpecifiedBenchmarks(&reporter);
+  if (!thresholds.empty()) {
+    const int num_violations = reporter.CheckThresholds(thresholds);
+    if (num_violations > 0) {
+      return 1;
+    }
+    std::printf("threshold check: all %zu benchmarks within limits\n",
+                thresholds.size());
+  }
+  return 0;
+}
@@ -158,6 +158,71 @@ void DenseToCSCMatrix(const Eigen::Matrix<T, M, N> &dense_matrix,
   indptr->emplace_back(data_count);
 }
 
+/**
+ * @brief Converts a block-diagonal dense matrix with aligned square blocks
+ * of size block_size into the CSC sparse format. Only the entries inside the
+ * diagonal blocks are visited, so the cost is linear in the matrix dimension
+ * instead of quadratic; entries outside the blocks must be zero.
+ */
+template <typename T, int M, int N, typename D>
+void BlockDiagonalToCSCMatrix(const Eigen::Matrix<T, M, N> &dense_matrix,
+                              const int block_size, std::vector<T> *data,
+                              std::vector<D> *indices, std::vector<D> *indptr) {
+  constexpr double epsilon = 1e-9;
+  CHECK_GT(block_size, 0);
+  CHECK_EQ(dense_matrix.rows(), dense_matrix.cols());
+  CHECK_EQ(dense_matrix.rows() % block_size, 0);
+  int data_count = 0;
+  for (int c = 0; c < dense_matrix.cols(); ++c) {
+    indptr->emplace_back(data_count);
+    const int block_start = c - c % block_size;
+    for (int r = block_start; r < block_start + block_size; ++r) {
+      if (std::fabs(dense_matrix(r, c)) < epsilon) {
+        continue;
+      }
+      data->emplace_back(dense_matrix(r, c));
+      ++data_count;
+      indices->emplace_back(r);
+    }
+  }
+  indptr->emplace_back(data_count);
+}
+
+/**
+ * @brief Converts two vertically stacked dense matrices [upper; lower] into
+ * one CSC sparse matrix without materializing the stacked dense matrix.
+ */
+template <typename T, typename D>
+void StackedDenseToCSCMatrix(
+    const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &upper,
+    const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> &lower,
+    std::vector<T> *data, std::vector<D> *indices, std::vector<D> *indptr) {
+  constexpr double epsilon = 1e-9;
+  CHECK_EQ(upper.cols(), lower.cols());
+  const int upper_rows = static_cast<int>(upper.rows());
+  int data_count = 0;
+  for (int c = 0; c < upper.cols(); ++c) {
+    indptr->emplace_back(data_count);
+    for (int r = 0; r < upper.rows(); ++r) {
+      if (std::fabs(upper(r, c)) < epsilon) {
+        continue;
+      }
+      data->emplace_back(upper(r, c));
+      ++data_count;
+      indices->emplace_back(r);
+    }
+    for (int r = 0; r < lower.rows(); ++r) {
+      if (std::fabs(lower(r, c)) < epsilon) {
+        continue;
+      }
+      data->emplace_back(lower(r, c));
+      ++data_count;
+      indices->emplace_back(upper_rows + r);
+    }
+  }
+  indptr->emplace_back(data_count);
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
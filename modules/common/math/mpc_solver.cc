@@ -15,11 +15,12 @@
 #include "modules/common/math/mpc_solver.h"
 
 #include <algorithm>
-#include <memory>
+
+#include <qpOASES.hpp>
+
+#include "Eigen/LU"
 
 #include "cyber/common/log.h"
-#include "modules/common/math/qp_solver/active_set_qp_solver.h"
-#include "modules/common/math/qp_solver/qp_solver.h"
 
 namespace apollo {
 namespace common {
@@ -38,157 +39,221 @@ bool SolveLinearMPC(const Matrix &matrix_a, const Matrix &matrix_b,
                     const int max_iter, std::vector<Matrix> *control,
                     std::vector<Matrix> *control_gain,
                     std::vector<Matrix> *addition_gain) {
+  LinearMpcSolver solver(static_cast<int>(reference.size()), eps, max_iter);
+  return solver.Solve(matrix_a, matrix_b, matrix_c, matrix_q, matrix_r,
+                      matrix_lower, matrix_upper, matrix_initial_state,
+                      reference, control, control_gain, addition_gain);
+}
+
+LinearMpcSolver::LinearMpcSolver(const int horizon, const double eps,
+                                 const int max_iter)
+    : horizon_(horizon), eps_(eps), max_iter_(max_iter) {}
+
+LinearMpcSolver::~LinearMpcSolver() = default;
+
+void LinearMpcSolver::BuildStructure(const int states, const int controls) {
+  states_ = states;
+  controls_ = controls;
+
+  matrix_a_power_.assign(horizon_, Matrix::Zero(states, states));
+  matrix_k_ = Matrix::Zero(states * horizon_, controls * horizon_);
+  matrix_m_ = Matrix::Zero(states * horizon_, 1);
+  matrix_t_ = Matrix::Zero(states * horizon_, 1);
+  matrix_qq_ = Matrix::Zero(states * horizon_, states * horizon_);
+  matrix_rr_ = Matrix::Zero(controls * horizon_, controls * horizon_);
+  matrix_cc_ = Matrix::Zero(states * horizon_, 1);
+  matrix_aa_ = Matrix::Zero(states * horizon_, states);
+  matrix_m1_ = Matrix::Zero(controls * horizon_, controls * horizon_);
+  matrix_m2_ = Matrix::Zero(controls * horizon_, 1);
+
+  const int num_param = controls * horizon_;
+  hessian_.assign(num_param * num_param, 0.0);
+  gradient_.assign(num_param, 0.0);
+  lower_bound_.assign(num_param, 0.0);
+  upper_bound_.assign(num_param, 0.0);
+  solution_.assign(num_param, 0.0);
+
+  // The control bounds are plain variable bounds, so the QP carries no
+  // constraint matrix at all; SQProblem (rather than QProblem) is used so
+  // that hot starts stay valid when the cost matrices change.
+  qp_problem_.reset(new qpOASES::SQProblem(num_param, 0));
+  qpOASES::Options options;
+  options.terminationTolerance = eps_;
+  qp_problem_->setOptions(options);
+  qp_problem_->setPrintLevel(qpOASES::PL_NONE);
+  qp_initialized_ = false;
+}
+
+bool LinearMpcSolver::Solve(const Matrix &matrix_a, const Matrix &matrix_b,
+                            const Matrix &matrix_c, const Matrix &matrix_q,
+                            const Matrix &matrix_r, const Matrix &matrix_lower,
+                            const Matrix &matrix_upper,
+                            const Matrix &matrix_initial_state,
+                            const std::vector<Matrix> &reference,
+                            std::vector<Matrix> *control,
+                            std::vector<Matrix> *control_gain,
+                            std::vector<Matrix> *addition_gain) {
   if (matrix_a.rows() != matrix_a.cols() ||
       matrix_b.rows() != matrix_a.rows() ||
       matrix_lower.rows() != matrix_upper.rows()) {
     AERROR << "One or more matrices have incompatible dimensions. Aborting.";
     return false;
   }
+  if (static_cast<int>(reference.size()) != horizon_) {
+    AERROR << "Reference length " << reference.size()
+           << " does not match the configured horizon " << horizon_
+           << ". Aborting.";
+    return false;
+  }
 
-  size_t horizon = static_cast<size_t>(reference.size());
+  const int states = static_cast<int>(matrix_a.rows());
+  const int controls = static_cast<int>(matrix_b.cols());
+  if (states != states_ || controls != controls_) {
+    BuildStructure(states, controls);
+  }
 
   // Update augment reference matrix_t
-  Matrix matrix_t = Matrix::Zero(matrix_b.rows() * horizon, 1);
-  for (size_t j = 0; j < horizon; ++j) {
-    matrix_t.block(j * reference[0].size(), 0, reference[0].size(), 1) =
-        reference[j];
+  for (int j = 0; j < horizon_; ++j) {
+    matrix_t_.block(j * states, 0, states, 1) = reference[j];
   }
 
-  // Update augment control matrix_v
-  Matrix matrix_v = Matrix::Zero((*control)[0].rows() * horizon, 1);
-  for (size_t j = 0; j < horizon; ++j) {
-    matrix_v.block(j * (*control)[0].rows(), 0, (*control)[0].rows(), 1) =
-        (*control)[j];
+  matrix_a_power_[0] = matrix_a;
+  for (size_t i = 1; i < matrix_a_power_.size(); ++i) {
+    matrix_a_power_[i].noalias() = matrix_a * matrix_a_power_[i - 1];
   }
 
-  std::vector<Matrix> matrix_a_power(horizon);
-  matrix_a_power[0] = matrix_a;
-  for (size_t i = 1; i < matrix_a_power.size(); ++i) {
-    matrix_a_power[i] = matrix_a * matrix_a_power[i - 1];
+  matrix_k_.block(0, 0, states, controls) = matrix_b;
+  for (int r = 1; r < horizon_; ++r) {
+    for (int c = 0; c < r; ++c) {
+      matrix_k_.block(r * states, c * controls, states, controls).noalias() =
+          matrix_a_power_[r - c - 1] * matrix_b;
+    }
+    matrix_k_.block(r * states, r * controls, states, controls) = matrix_b;
   }
 
-  Matrix matrix_k =
-      Matrix::Zero(matrix_b.rows() * horizon, matrix_b.cols() * horizon);
-  matrix_k.block(0, 0, matrix_b.rows(), matrix_b.cols()) = matrix_b;
-  for (size_t r = 1; r < horizon; ++r) {
-    for (size_t c = 0; c < r; ++c) {
-      matrix_k.block(r * matrix_b.rows(), c * matrix_b.cols(), matrix_b.rows(),
-                     matrix_b.cols()) = matrix_a_power[r - c - 1] * matrix_b;
-    }
-    matrix_k.block(r * matrix_b.rows(), r * matrix_b.cols(), matrix_b.rows(),
-                   matrix_b.cols()) = matrix_b;
-  }
-  // Initialize matrix_k, matrix_m, matrix_t and matrix_v, matrix_qq, matrix_rr,
-  // vector of matrix A power
-  Matrix matrix_m = Matrix::Zero(matrix_b.rows() * horizon, 1);
-  Matrix matrix_qq = Matrix::Zero(matrix_k.rows(), matrix_k.rows());
-  Matrix matrix_rr = Matrix::Zero(matrix_k.cols(), matrix_k.cols());
-  Matrix matrix_ll = Matrix::Zero(horizon * matrix_lower.rows(), 1);
-  Matrix matrix_uu = Matrix::Zero(horizon * matrix_upper.rows(), 1);
-  Matrix matrix_cc = Matrix::Zero(horizon * matrix_c.rows(), 1);
-  Matrix matrix_aa = Matrix::Zero(horizon * matrix_a.rows(), matrix_a.cols());
-  matrix_aa.block(0, 0, matrix_a.rows(), matrix_a.cols()) = matrix_a;
-
-  for (size_t i = 1; i < horizon; ++i) {
-    matrix_aa.block(i * matrix_a.rows(), 0, matrix_a.rows(), matrix_a.cols()) =
-        matrix_a * matrix_aa.block((i - 1) * matrix_a.rows(), 0,
-                                   matrix_a.rows(), matrix_a.cols());
+  matrix_aa_.block(0, 0, states, states) = matrix_a;
+  for (int i = 1; i < horizon_; ++i) {
+    matrix_aa_.block(i * states, 0, states, states).noalias() =
+        matrix_a * matrix_aa_.block((i - 1) * states, 0, states, states);
   }
 
   // Compute matrix_m
-  matrix_m.block(0, 0, matrix_a.rows(), 1) = matrix_a * matrix_initial_state;
-  for (size_t i = 1; i < horizon; ++i) {
-    matrix_m.block(i * matrix_a.rows(), 0, matrix_a.rows(), 1) =
-        matrix_a *
-        matrix_m.block((i - 1) * matrix_a.rows(), 0, matrix_a.rows(), 1);
-  }
-
-  // Compute matrix_ll, matrix_uu, matrix_qq, matrix_rr
-  for (size_t i = 0; i < horizon; ++i) {
-    matrix_ll.block(i * (*control)[0].rows(), 0, (*control)[0].rows(), 1) =
-        matrix_lower;
-    matrix_uu.block(i * (*control)[0].rows(), 0, (*control)[0].rows(), 1) =
-        matrix_upper;
-    matrix_qq.block(i * matrix_q.rows(), i * matrix_q.rows(), matrix_q.rows(),
-                    matrix_q.rows()) = matrix_q;
-    matrix_rr.block(i * matrix_r.rows(), i * matrix_r.rows(), matrix_r.cols(),
-                    matrix_r.cols()) = matrix_r;
-  }
-
-  matrix_cc.block(0, 0, matrix_c.rows(), 1) = matrix_c;
-  for (size_t i = 1; i < horizon; ++i) {
-    matrix_cc.block(i * matrix_c.rows(), 0, matrix_c.rows(), 1) =
-        matrix_cc.block((i - 1) * matrix_c.rows(), 0, matrix_c.rows(), 1) +
-        matrix_aa.block((i - 1) * matrix_a.rows(), 0, matrix_a.rows(),
-                        matrix_a.cols()) *
-            matrix_c;
+  matrix_m_.block(0, 0, states, 1).noalias() = matrix_a * matrix_initial_state;
+  for (int i = 1; i < horizon_; ++i) {
+    matrix_m_.block(i * states, 0, states, 1).noalias() =
+        matrix_a * matrix_m_.block((i - 1) * states, 0, states, 1);
+  }
+
+  // Compute matrix_qq, matrix_rr
+  for (int i = 0; i < horizon_; ++i) {
+    matrix_qq_.block(i * states, i * states, states, states) = matrix_q;
+    matrix_rr_.block(i * controls, i * controls, controls, controls) = matrix_r;
+  }
+
+  matrix_cc_.block(0, 0, states, 1) = matrix_c;
+  for (int i = 1; i < horizon_; ++i) {
+    matrix_cc_.block(i * states, 0, states, 1) =
+        matrix_cc_.block((i - 1) * states, 0, states, 1) +
+        matrix_aa_.block((i - 1) * states, 0, states, states) * matrix_c;
   }
 
   // Update matrix_m1, matrix_m2, convert MPC problem to QP problem
-  const Matrix matrix_m1 = static_cast<Matrix>(
-      matrix_k.transpose() * matrix_qq * matrix_k + matrix_rr);
-  const Matrix matrix_m2 = static_cast<Matrix>(
-      matrix_k.transpose() * matrix_qq * (matrix_m + matrix_cc - matrix_t));
+  matrix_m1_.noalias() =
+      matrix_k_.transpose() * matrix_qq_ * matrix_k_ + matrix_rr_;
+  matrix_m2_.noalias() = matrix_k_.transpose() * matrix_qq_ *
+                         (matrix_m_ + matrix_cc_ - matrix_t_);
   // Update matrix_m0, matrix_ctrl_gain, matrix_add_gain, obtain the analytical
   // control gain matrix, corresponding to the unconstraint QP problem
   const Matrix matrix_m0 = static_cast<Matrix>(
-      -1 * matrix_m1.inverse() * matrix_k.transpose() * matrix_qq);
-  const Matrix matrix_ctrl_gain = static_cast<Matrix>(matrix_m0 * matrix_aa);
-  const Matrix matrix_add_gain = static_cast<Matrix>(matrix_m0 * matrix_cc);
+      -1 * matrix_m1_.inverse() * matrix_k_.transpose() * matrix_qq_);
+  const Matrix matrix_ctrl_gain = static_cast<Matrix>(matrix_m0 * matrix_aa_);
+  const Matrix matrix_add_gain = static_cast<Matrix>(matrix_m0 * matrix_cc_);
 
   // Format in qp_solver
   /**
-   * *           min_x  : q(x) = 0.5 * x^T * Q * x  + x^T c
-   * *           with respect to:  A * x = b (equality constraint)
-   * *                             C * x >= d (inequality constraint)
+   * *           min_v  : q(v) = 0.5 * v^T * M1 * v  + v^T M2
+   * *           with respect to:  ll <= v <= uu (variable bounds)
    * **/
+  const int num_param = controls * horizon_;
+  int index = 0;
+  for (int r = 0; r < num_param; ++r) {
+    gradient_[r] = matrix_m2_(r, 0);
+    for (int c = 0; c < num_param; ++c) {
+      hessian_[index++] = matrix_m1_(r, c);
+    }
+  }
+  for (int i = 0; i < horizon_; ++i) {
+    for (int j = 0; j < controls; ++j) {
+      lower_bound_[i * controls + j] = matrix_lower(j, 0);
+      upper_bound_[i * controls + j] = matrix_upper(j, 0);
+    }
+  }
 
-  // TODO(QiL) : change qp solver to box constraint or substitute QPOASES
-  // Method 1: QPOASES
-  Matrix matrix_inequality_constrain_ll =
-      Matrix::Identity(matrix_ll.rows(), matrix_ll.rows());
-  Matrix matrix_inequality_constrain_uu =
-      Matrix::Identity(matrix_uu.rows(), matrix_uu.rows());
-  Matrix matrix_inequality_constrain =
-      Matrix::Zero(matrix_ll.rows() + matrix_uu.rows(), matrix_ll.rows());
-  matrix_inequality_constrain << matrix_inequality_constrain_ll,
-      -matrix_inequality_constrain_uu;
-  Matrix matrix_inequality_boundary =
-      Matrix::Zero(matrix_ll.rows() + matrix_uu.rows(), matrix_ll.cols());
-  matrix_inequality_boundary << matrix_ll, -matrix_uu;
-  Matrix matrix_equality_constrain =
-      Matrix::Zero(matrix_ll.rows() + matrix_uu.rows(), matrix_ll.rows());
-  Matrix matrix_equality_boundary =
-      Matrix::Zero(matrix_ll.rows() + matrix_uu.rows(), matrix_ll.cols());
-
-  std::unique_ptr<QpSolver> qp_solver(new ActiveSetQpSolver(
-      matrix_m1, matrix_m2, matrix_inequality_constrain,
-      matrix_inequality_boundary, matrix_equality_constrain,
-      matrix_equality_boundary));
-  auto result = qp_solver->Solve();
-  if (!result) {
-    AERROR << "Linear MPC solver failed";
+  int num_iter = std::max(max_iter_, num_param);
+  double cputime = time_limit_sec_;
+  double *cputime_ptr = time_limit_sec_ > 0.0 ? &cputime : nullptr;
+  last_solve_degraded_ = false;
+  qpOASES::returnValue ret;
+  if (!qp_initialized_) {
+    ret = qp_problem_->init(hessian_.data(), gradient_.data(), nullptr,
+                            lower_bound_.data(), upper_bound_.data(), nullptr,
+                            nullptr, num_iter, cputime_ptr);
+  } else {
+    ret = qp_problem_->hotstart(hessian_.data(), gradient_.data(), nullptr,
+                                lower_bound_.data(), upper_bound_.data(),
+                                nullptr, nullptr, num_iter, cputime_ptr);
+    if (ret != qpOASES::SUCCESSFUL_RETURN &&
+        ret != qpOASES::RET_MAX_NWSR_REACHED) {
+      // Do not cold start after a budget overrun; that would double the
+      // latency the budget is meant to bound.
+      ADEBUG << "Linear MPC hot start failed, falling back to cold start";
+      qp_problem_->reset();
+      num_iter = std::max(max_iter_, num_param);
+      cputime = time_limit_sec_;
+      ret = qp_problem_->init(hessian_.data(), gradient_.data(), nullptr,
+                              lower_bound_.data(), upper_bound_.data(), nullptr,
+                              nullptr, num_iter, cputime_ptr);
+    }
+  }
+  if (ret == qpOASES::RET_MAX_NWSR_REACHED &&
+      qp_problem_->getPrimalSolution(solution_.data()) ==
+          qpOASES::SUCCESSFUL_RETURN) {
+    // The time or iteration budget ran out. The active-set iterate is still
+    // primal feasible, so an approximate command beats a late one: hand the
+    // best iterate back and report the solve as degraded.
+    last_solve_degraded_ = true;
+  } else if (ret != qpOASES::SUCCESSFUL_RETURN) {
+    if (ret == qpOASES::RET_MAX_NWSR_REACHED) {
+      AERROR << "Linear MPC solver failed due to reached max iteration";
+    } else {
+      AERROR << "Linear MPC solver failed due to infeasibility or other "
+                "internal reasons";
+    }
+    qp_initialized_ = false;
     return false;
+  } else {
+    qp_problem_->getPrimalSolution(solution_.data());
   }
-  matrix_v = qp_solver->params();
+  qp_initialized_ = true;
 
-  for (size_t i = 0; i < horizon; ++i) {
-    (*control)[i] =
-        matrix_v.block(i * (*control)[0].rows(), 0, (*control)[0].rows(), 1);
+  for (int i = 0; i < horizon_; ++i) {
+    for (int j = 0; j < controls; ++j) {
+      (*control)[i](j, 0) = solution_[i * controls + j];
+    }
   }
 
-  for (size_t i = 0; i < horizon; ++i) {
+  for (int i = 0; i < horizon_; ++i) {
     (*control_gain)[i] = matrix_ctrl_gain.block(i * (*control_gain)[0].rows(),
                                                 0, (*control_gain)[0].rows(),
                                                 (*control_gain)[0].cols());
   }
 
-  for (size_t i = 0; i < horizon; ++i) {
+  for (int i = 0; i < horizon_; ++i) {
     (*addition_gain)[i] = matrix_add_gain.block(
         i * (*addition_gain)[0].rows(), 0, (*addition_gain)[0].rows(), 1);
   }
 
-  return true;
+  return last_solve_degraded_ || qp_problem_->isSolved() == qpOASES::BT_TRUE;
 }
 
 }  // namespace math
@@ -20,10 +20,15 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "Eigen/Core"
 
+namespace qpOASES {
+class SQProblem;
+}  // namespace qpOASES
+
 /**
  * @namespace apollo::common::math
  * @brief apollo::common::math
@@ -57,6 +62,97 @@ bool SolveLinearMPC(
     std::vector<Eigen::MatrixXd> *control_gain,
     std::vector<Eigen::MatrixXd> *addition_gain);
 
+/**
+ * @class LinearMpcSolver
+ * @brief Stateful linear MPC solver intended to persist across control
+ *        cycles. The condensed QP matrices are allocated once per
+ *        horizon/dimension configuration, the control bounds enter the
+ *        active-set solver as variable bounds instead of a stacked
+ *        identity constraint matrix, and each solve is warm started from
+ *        the previous cycle's active set and solution.
+ */
+class LinearMpcSolver {
+ public:
+  /**
+   * @param horizon The prediction horizon (number of control steps)
+   * @param eps The termination tolerance of the QP solver
+   * @param max_iter The maximum number of active-set iterations per solve
+   */
+  LinearMpcSolver(const int horizon, const double eps, const int max_iter);
+  ~LinearMpcSolver();
+
+  /**
+   * @brief Solve one MPC cycle; parameters match SolveLinearMPC. The first
+   *        call initializes the QP; later calls with the same dimensions
+   *        hot start it, even when the cost matrices change.
+   * @return Whether the QP converged
+   */
+  bool Solve(const Eigen::MatrixXd &matrix_a, const Eigen::MatrixXd &matrix_b,
+             const Eigen::MatrixXd &matrix_c, const Eigen::MatrixXd &matrix_q,
+             const Eigen::MatrixXd &matrix_r,
+             const Eigen::MatrixXd &matrix_lower,
+             const Eigen::MatrixXd &matrix_upper,
+             const Eigen::MatrixXd &matrix_initial_state,
+             const std::vector<Eigen::MatrixXd> &reference,
+             std::vector<Eigen::MatrixXd> *control,
+             std::vector<Eigen::MatrixXd> *control_gain,
+             std::vector<Eigen::MatrixXd> *addition_gain);
+
+  /**
+   * @brief Set a time budget for each solve, in seconds. When the budget
+   *        runs out the solver keeps the best feasible iterate instead of
+   *        dropping the cycle. 0 disables the budget.
+   */
+  void set_time_limit(const double time_limit_sec) {
+    time_limit_sec_ = time_limit_sec;
+  }
+
+  /**
+   * @brief Whether the last successful solve hit its time or iteration
+   *        limit and returned the best feasible iterate rather than the
+   *        optimum
+   */
+  bool last_solve_degraded() const { return last_solve_degraded_; }
+
+ private:
+  // (Re)allocates the condensed matrices and the QP for the given state and
+  // control dimensions; discards any carried warm start.
+  void BuildStructure(const int states, const int controls);
+
+  const int horizon_ = 0;
+  const double eps_ = 0.0;
+  const int max_iter_ = 0;
+
+  // Per-solve time budget in seconds; 0 means unlimited.
+  double time_limit_sec_ = 0.0;
+  bool last_solve_degraded_ = false;
+
+  int states_ = 0;
+  int controls_ = 0;
+  bool qp_initialized_ = false;
+
+  // Condensed formulation, allocated once per configuration.
+  std::vector<Eigen::MatrixXd> matrix_a_power_;
+  Eigen::MatrixXd matrix_k_;
+  Eigen::MatrixXd matrix_m_;
+  Eigen::MatrixXd matrix_t_;
+  Eigen::MatrixXd matrix_qq_;
+  Eigen::MatrixXd matrix_rr_;
+  Eigen::MatrixXd matrix_cc_;
+  Eigen::MatrixXd matrix_aa_;
+  Eigen::MatrixXd matrix_m1_;
+  Eigen::MatrixXd matrix_m2_;
+
+  // Row-major buffers handed to qpOASES; kept alive across hot starts.
+  std::vector<double> hessian_;
+  std::vector<double> gradient_;
+  std::vector<double> lower_bound_;
+  std::vector<double> upper_bound_;
+  std::vector<double> solution_;
+
+  std::unique_ptr<::qpOASES::SQProblem> qp_problem_;
+};
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
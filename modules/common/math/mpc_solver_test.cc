@@ -166,6 +166,76 @@ TEST(MPCSolverTest, MPC) {
     EXPECT_NEAR(0.0, control2[0](0), 1e-7);
   }
 }
+
+TEST(MPCSolverTest, WarmStartedSolver) {
+  const int states = 4;
+  const int controls = 1;
+  const int horizon = 10;
+  const double eps = 0.01;
+  const int max_iter = 100;
+
+  Eigen::MatrixXd A(states, states);
+  A << 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1;
+
+  Eigen::MatrixXd B(states, controls);
+  B << 0, 0, 1, 0;
+
+  Eigen::MatrixXd C(states, 1);
+  C << 0, 0, 0, 0.1;
+
+  Eigen::MatrixXd Q(states, states);
+  Q << 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0;
+
+  Eigen::MatrixXd R(controls, controls);
+  R << 1;
+
+  Eigen::MatrixXd lower_bound(controls, 1);
+  lower_bound << -5;
+
+  Eigen::MatrixXd upper_bound(controls, 1);
+  upper_bound << 5;
+
+  Eigen::MatrixXd initial_state(states, 1);
+  initial_state << 30, 30, 0, 0;
+
+  std::vector<Eigen::MatrixXd> reference(horizon,
+                                         Eigen::MatrixXd::Zero(states, 1));
+
+  std::vector<Eigen::MatrixXd> control(horizon,
+                                       Eigen::MatrixXd::Zero(controls, 1));
+  std::vector<Eigen::MatrixXd> control_gain(
+      horizon, Eigen::MatrixXd::Zero(controls, states));
+  std::vector<Eigen::MatrixXd> addition_gain(
+      horizon, Eigen::MatrixXd::Zero(controls, 1));
+
+  // One solver reused across cycles; the first solve cold starts the QP and
+  // the following ones hot start it.
+  LinearMpcSolver solver(horizon, eps, max_iter);
+  for (int i = 0; i < horizon; ++i) {
+    EXPECT_TRUE(solver.Solve(A, B, C, Q, R, lower_bound, upper_bound,
+                             initial_state, reference, &control, &control_gain,
+                             &addition_gain));
+    EXPECT_FLOAT_EQ(lower_bound(0), control[0](0));
+  }
+
+  // Changing the cost and bounds between cycles must not invalidate the
+  // carried state.
+  Eigen::MatrixXd lower_bound2(controls, 1);
+  lower_bound2 << -10;
+
+  Eigen::MatrixXd upper_bound2(controls, 1);
+  upper_bound2 << 10;
+
+  std::vector<Eigen::MatrixXd> reference2(horizon, initial_state);
+  Eigen::MatrixXd matrix_r2(controls, controls);
+  matrix_r2 << 2;
+  for (int i = 0; i < horizon; ++i) {
+    EXPECT_TRUE(solver.Solve(A, B, C, Q, matrix_r2, lower_bound2, upper_bound2,
+                             initial_state, reference2, &control, &control_gain,
+                             &addition_gain));
+    EXPECT_NEAR(0.0, control[0](0), 1e-7);
+  }
+}
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -101,6 +101,112 @@ PathPoint PathMatcher::MatchToPath(const std::vector<PathPoint>& reference_line,
   return InterpolateUsingLinearApproximation(*(it_lower - 1), *it_lower, s);
 }
 
+IndexedPathMatcher::IndexedPathMatcher(
+    const std::vector<PathPoint>& reference_line)
+    : path_points_(reference_line) {
+  CHECK_GT(path_points_.size(), 0);
+  segments_.reserve(path_points_.size());
+  for (std::size_t i = 0; i + 1 < path_points_.size(); ++i) {
+    segments_.emplace_back(
+        LineSegment2d(Vec2d(path_points_[i].x(), path_points_[i].y()),
+                      Vec2d(path_points_[i + 1].x(), path_points_[i + 1].y())),
+        i);
+  }
+  if (!segments_.empty()) {
+    AABoxKDTreeParams params;
+    params.max_leaf_size = 16;
+    kdtree_.reset(new AABoxKDTree2d<IndexedSegment>(segments_, params));
+  }
+}
+
+PathPoint IndexedPathMatcher::MatchToPath(const double x,
+                                          const double y) const {
+  int index_hint = -1;
+  return MatchToPath(x, y, &index_hint);
+}
+
+PathPoint IndexedPathMatcher::MatchToPath(const double x, const double y,
+                                          int* const index_hint) const {
+  if (segments_.empty()) {
+    return path_points_.front();
+  }
+  return ProjectToSegment(MatchSegment(x, y, index_hint), x, y);
+}
+
+std::pair<double, double> IndexedPathMatcher::GetPathFrenetCoordinate(
+    const double x, const double y) const {
+  int index_hint = -1;
+  return GetPathFrenetCoordinate(x, y, &index_hint);
+}
+
+std::pair<double, double> IndexedPathMatcher::GetPathFrenetCoordinate(
+    const double x, const double y, int* const index_hint) const {
+  auto matched_path_point = MatchToPath(x, y, index_hint);
+  double rtheta = matched_path_point.theta();
+  double delta_x = x - matched_path_point.x();
+  double delta_y = y - matched_path_point.y();
+  double side = std::cos(rtheta) * delta_y - std::sin(rtheta) * delta_x;
+  return std::make_pair(matched_path_point.s(),
+                        std::copysign(std::hypot(delta_x, delta_y), side));
+}
+
+PathPoint IndexedPathMatcher::MatchToPath(const double s) const {
+  return PathMatcher::MatchToPath(path_points_, s);
+}
+
+int IndexedPathMatcher::MatchSegment(const double x, const double y,
+                                     int* const index_hint) const {
+  // A hinted query walks at most this many segments away from the hint;
+  // walks that want to go further indicate a stale hint, for which the
+  // local descent could stop in a local minimum, so the query falls back
+  // to the KD-tree.
+  static constexpr int kMaxHintWalkSteps = 10;
+
+  const Vec2d point(x, y);
+  const int num_segments = static_cast<int>(segments_.size());
+  int index = *index_hint;
+  if (index >= 0 && index < num_segments) {
+    // Walk towards the query from the hinted segment while the distance
+    // keeps improving; constant time for spatially coherent query streams.
+    const int hint = index;
+    double distance_min = segments_[index].DistanceSquareTo(point);
+    while (index + 1 < num_segments && index - hint < kMaxHintWalkSteps) {
+      const double distance = segments_[index + 1].DistanceSquareTo(point);
+      if (distance >= distance_min) {
+        break;
+      }
+      distance_min = distance;
+      ++index;
+    }
+    while (index > 0 && hint - index < kMaxHintWalkSteps) {
+      const double distance = segments_[index - 1].DistanceSquareTo(point);
+      if (distance >= distance_min) {
+        break;
+      }
+      distance_min = distance;
+      --index;
+    }
+    if (std::abs(index - hint) >= kMaxHintWalkSteps) {
+      index = -1;
+    }
+  } else {
+    index = -1;
+  }
+  if (index < 0) {
+    const IndexedSegment* nearest_segment = kdtree_->GetNearestObject(point);
+    index = static_cast<int>(nearest_segment->index());
+  }
+  *index_hint = index;
+  return index;
+}
+
+PathPoint IndexedPathMatcher::ProjectToSegment(const int index, const double x,
+                                               const double y) const {
+  const PathPoint& p0 = path_points_[index];
+  const PathPoint& p1 = path_points_[index + 1];
+  return PathMatcher::FindProjectionPoint(p0, p1, x, y);
+}
+
 PathPoint PathMatcher::FindProjectionPoint(const PathPoint& p0,
                                            const PathPoint& p1, const double x,
                                            const double y) {
@@ -20,9 +20,12 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "modules/common/math/aaboxkdtree2d.h"
+#include "modules/common/math/line_segment2d.h"
 #include "modules/common/proto/pnc_point.pb.h"
 
 namespace apollo {
@@ -44,10 +47,98 @@ class PathMatcher {
                                const double s);
 
  private:
+  friend class IndexedPathMatcher;
+
   static PathPoint FindProjectionPoint(const PathPoint& p0, const PathPoint& p1,
                                        const double x, const double y);
 };
 
+/**
+ * @class IndexedPathMatcher
+ * @brief Reference-line matcher with a prebuilt KD-tree over the path
+ *        segments, so that a match query costs O(log n) instead of the
+ *        linear scan in PathMatcher::MatchToPath. Callers that issue
+ *        spatially coherent queries (e.g. the corners of one obstacle
+ *        box, or the samples of one predicted trajectory) can pass an
+ *        index hint which is refined by a local walk instead of a fresh
+ *        tree descent.
+ *
+ *        Build it once per reference line and reuse it for all obstacles
+ *        of the frame.
+ */
+class IndexedPathMatcher {
+ public:
+  explicit IndexedPathMatcher(const std::vector<PathPoint>& reference_line);
+
+  /**
+   * @brief Matches (x, y) to the nearest segment of the reference line and
+   *        projects onto it; equivalent to PathMatcher::MatchToPath.
+   */
+  PathPoint MatchToPath(const double x, const double y) const;
+
+  /**
+   * @brief Same as above, with a query hint. *index_hint < 0 requests a
+   *        cold (tree) query; on return it holds the matched segment index
+   *        to seed the next query. The hint must come from a query of a
+   *        nearby point: a hinted query walks locally from the hinted
+   *        segment and only falls back to the tree when the walk travels
+   *        suspiciously far.
+   */
+  PathPoint MatchToPath(const double x, const double y,
+                        int* const index_hint) const;
+
+  /**
+   * @brief Frenet coordinates (s, d) of (x, y) w.r.t. the reference line.
+   */
+  std::pair<double, double> GetPathFrenetCoordinate(const double x,
+                                                    const double y) const;
+
+  std::pair<double, double> GetPathFrenetCoordinate(
+      const double x, const double y, int* const index_hint) const;
+
+  /**
+   * @brief Interpolates the reference line at arc length s.
+   */
+  PathPoint MatchToPath(const double s) const;
+
+  size_t size() const { return path_points_.size(); }
+
+ private:
+  // A reference-line segment together with the index of its start point;
+  // satisfies the object interface of AABoxKDTree2d.
+  class IndexedSegment {
+   public:
+    IndexedSegment(const LineSegment2d& segment, const size_t index)
+        : segment_(segment),
+          aabox_(segment.start(), segment.end()),
+          index_(index) {}
+    const AABox2d& aabox() const { return aabox_; }
+    double DistanceTo(const Vec2d& point) const {
+      return segment_.DistanceTo(point);
+    }
+    double DistanceSquareTo(const Vec2d& point) const {
+      return segment_.DistanceSquareTo(point);
+    }
+    size_t index() const { return index_; }
+
+   private:
+    LineSegment2d segment_;
+    AABox2d aabox_;
+    size_t index_;
+  };
+
+  // Index of the segment nearest to (x, y); starts from *index_hint when it
+  // is valid and falls back to the KD-tree otherwise.
+  int MatchSegment(const double x, const double y,
+                   int* const index_hint) const;
+  PathPoint ProjectToSegment(const int index, const double x,
+                             const double y) const;
+
+  std::vector<PathPoint> path_points_;
+  std::vector<IndexedSegment> segments_;
+  std::unique_ptr<AABoxKDTree2d<IndexedSegment>> kdtree_;
+};
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
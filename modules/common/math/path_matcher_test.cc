@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/math/path_matcher.h"
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+namespace {
+
+std::vector<PathPoint> MakeCurvedReferenceLine() {
+  std::vector<PathPoint> reference_line;
+  double s = 0.0;
+  double x = 0.0;
+  double y = 0.0;
+  double theta = 0.0;
+  for (int i = 0; i < 500; ++i) {
+    PathPoint point;
+    point.set_x(x);
+    point.set_y(y);
+    point.set_s(s);
+    point.set_theta(theta);
+    reference_line.push_back(point);
+
+    const double kappa = 0.02 * std::sin(0.01 * s);
+    theta += kappa * 0.5;
+    x += 0.5 * std::cos(theta);
+    y += 0.5 * std::sin(theta);
+    s += 0.5;
+  }
+  return reference_line;
+}
+
+}  // namespace
+
+TEST(IndexedPathMatcherTest, MatchesLinearScan) {
+  const auto reference_line = MakeCurvedReferenceLine();
+  const IndexedPathMatcher matcher(reference_line);
+  EXPECT_EQ(reference_line.size(), matcher.size());
+
+  for (size_t i = 5; i + 5 < reference_line.size(); i += 7) {
+    const double x = reference_line[i].x() + 0.37;
+    const double y = reference_line[i].y() - 1.21;
+    const auto expected =
+        PathMatcher::GetPathFrenetCoordinate(reference_line, x, y);
+    const auto actual = matcher.GetPathFrenetCoordinate(x, y);
+    EXPECT_NEAR(expected.first, actual.first, 0.05);
+    EXPECT_NEAR(expected.second, actual.second, 0.05);
+  }
+}
+
+TEST(IndexedPathMatcherTest, HintedSequentialQueries) {
+  const auto reference_line = MakeCurvedReferenceLine();
+  const IndexedPathMatcher matcher(reference_line);
+
+  int index_hint = -1;
+  for (size_t i = 0; i + 1 < reference_line.size(); ++i) {
+    const double x = reference_line[i].x() + 1.5;
+    const double y = reference_line[i].y() - 0.5;
+    const auto cold = matcher.GetPathFrenetCoordinate(x, y);
+    const auto hinted = matcher.GetPathFrenetCoordinate(x, y, &index_hint);
+    EXPECT_NEAR(cold.first, hinted.first, 0.05);
+    EXPECT_NEAR(cold.second, hinted.second, 0.05);
+  }
+}
+
+TEST(IndexedPathMatcherTest, MatchToPathByS) {
+  const auto reference_line = MakeCurvedReferenceLine();
+  const IndexedPathMatcher matcher(reference_line);
+
+  for (double s = 0.0; s < 240.0; s += 11.3) {
+    const auto expected = PathMatcher::MatchToPath(reference_line, s);
+    const auto actual = matcher.MatchToPath(s);
+    EXPECT_DOUBLE_EQ(expected.x(), actual.x());
+    EXPECT_DOUBLE_EQ(expected.y(), actual.y());
+    EXPECT_DOUBLE_EQ(expected.s(), actual.s());
+  }
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,70 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Define the Points2dSoA struct.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "modules/common/math/vec2d.h"
+
+/**
+ * @namespace apollo::common::math
+ * @brief apollo::common::math
+ */
+namespace apollo {
+namespace common {
+namespace math {
+
+/**
+ * @struct Points2dSoA
+ * @brief A set of 2-D points in structure-of-arrays layout, so the batch
+ *        geometry kernels (LineSegment2d::DistanceToBatch,
+ *        Box2d::DistanceToBatch) can load contiguous x and y lanes.
+ */
+struct Points2dSoA {
+  std::vector<double> x;
+  std::vector<double> y;
+
+  Points2dSoA() = default;
+
+  /**
+   * @brief Construct from an array-of-structures point list.
+   * @param points The points to convert.
+   */
+  explicit Points2dSoA(const std::vector<Vec2d> &points) {
+    x.reserve(points.size());
+    y.reserve(points.size());
+    for (const auto &point : points) {
+      x.push_back(point.x());
+      y.push_back(point.y());
+    }
+  }
+
+  /**
+   * @brief Get the number of points.
+   * @return The number of points.
+   */
+  size_t size() const { return x.size(); }
+};
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -21,6 +21,12 @@
 #include <limits>
 #include <utility>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "cyber/common/log.h"
 #include "modules/common/math/math_utils.h"
 #include "modules/common/util/string_util.h"
@@ -43,11 +49,7 @@ double Polygon2d::DistanceTo(const Vec2d &point) const {
   if (IsPointIn(point)) {
     return 0.0;
   }
-  double distance = std::numeric_limits<double>::infinity();
-  for (int i = 0; i < num_points_; ++i) {
-    distance = std::min(distance, line_segments_[i].DistanceTo(point));
-  }
-  return distance;
+  return std::sqrt(MinDistanceSquareToEdges(point));
 }
 
 double Polygon2d::DistanceSquareTo(const Vec2d &point) const {
@@ -55,12 +57,7 @@ double Polygon2d::DistanceSquareTo(const Vec2d &point) const {
   if (IsPointIn(point)) {
     return 0.0;
   }
-  double distance_sqr = std::numeric_limits<double>::infinity();
-  for (int i = 0; i < num_points_; ++i) {
-    distance_sqr =
-        std::min(distance_sqr, line_segments_[i].DistanceSquareTo(point));
-  }
-  return distance_sqr;
+  return MinDistanceSquareToEdges(point);
 }
 
 double Polygon2d::DistanceTo(const LineSegment2d &line_segment) const {
@@ -109,11 +106,118 @@ double Polygon2d::DistanceTo(const Polygon2d &polygon) const {
 }
 
 double Polygon2d::DistanceToBoundary(const Vec2d &point) const {
-  double distance = std::numeric_limits<double>::infinity();
+  return std::sqrt(MinDistanceSquareToEdges(point));
+}
+
+double Polygon2d::MinDistanceSquareToEdges(const Vec2d &point) const {
+  // Branchless per-edge point-to-segment distance over the SoA edge
+  // caches: clamp the projection onto the edge and measure to the foot
+  // point, keeping a running minimum.
+  const int n = num_points_;
+  const double px = point.x();
+  const double py = point.y();
+  double min_sqr = std::numeric_limits<double>::infinity();
+  int i = 0;
+#if defined(__AVX2__)
+  const __m256d v_px = _mm256_set1_pd(px);
+  const __m256d v_py = _mm256_set1_pd(py);
+  const __m256d v_zero = _mm256_setzero_pd();
+  __m256d v_min = _mm256_set1_pd(min_sqr);
+  for (; i + 4 <= n; i += 4) {
+    const __m256d x0 = _mm256_sub_pd(v_px, _mm256_loadu_pd(&edge_start_x_[i]));
+    const __m256d y0 = _mm256_sub_pd(v_py, _mm256_loadu_pd(&edge_start_y_[i]));
+    const __m256d ux = _mm256_loadu_pd(&edge_unit_x_[i]);
+    const __m256d uy = _mm256_loadu_pd(&edge_unit_y_[i]);
+    __m256d proj =
+        _mm256_add_pd(_mm256_mul_pd(x0, ux), _mm256_mul_pd(y0, uy));
+    proj = _mm256_min_pd(_mm256_max_pd(proj, v_zero),
+                         _mm256_loadu_pd(&edge_length_[i]));
+    const __m256d dx = _mm256_sub_pd(x0, _mm256_mul_pd(proj, ux));
+    const __m256d dy = _mm256_sub_pd(y0, _mm256_mul_pd(proj, uy));
+    v_min = _mm256_min_pd(
+        v_min, _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)));
+  }
+  double lanes[4];
+  _mm256_storeu_pd(lanes, v_min);
+  min_sqr = std::min(std::min(lanes[0], lanes[1]),
+                     std::min(lanes[2], lanes[3]));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const float64x2_t v_px = vdupq_n_f64(px);
+  const float64x2_t v_py = vdupq_n_f64(py);
+  const float64x2_t v_zero = vdupq_n_f64(0.0);
+  float64x2_t v_min = vdupq_n_f64(min_sqr);
+  for (; i + 2 <= n; i += 2) {
+    const float64x2_t x0 = vsubq_f64(v_px, vld1q_f64(&edge_start_x_[i]));
+    const float64x2_t y0 = vsubq_f64(v_py, vld1q_f64(&edge_start_y_[i]));
+    const float64x2_t ux = vld1q_f64(&edge_unit_x_[i]);
+    const float64x2_t uy = vld1q_f64(&edge_unit_y_[i]);
+    float64x2_t proj = vaddq_f64(vmulq_f64(x0, ux), vmulq_f64(y0, uy));
+    proj = vminq_f64(vmaxq_f64(proj, v_zero), vld1q_f64(&edge_length_[i]));
+    const float64x2_t dx = vsubq_f64(x0, vmulq_f64(proj, ux));
+    const float64x2_t dy = vsubq_f64(y0, vmulq_f64(proj, uy));
+    v_min = vminq_f64(v_min,
+                      vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy)));
+  }
+  min_sqr = std::min(vgetq_lane_f64(v_min, 0), vgetq_lane_f64(v_min, 1));
+#endif
+  for (; i < n; ++i) {
+    const double x0 = px - edge_start_x_[i];
+    const double y0 = py - edge_start_y_[i];
+    const double proj =
+        std::min(std::max(x0 * edge_unit_x_[i] + y0 * edge_unit_y_[i], 0.0),
+                 edge_length_[i]);
+    const double dx = x0 - proj * edge_unit_x_[i];
+    const double dy = y0 - proj * edge_unit_y_[i];
+    min_sqr = std::min(min_sqr, dx * dx + dy * dy);
+  }
+  return min_sqr;
+}
+
+bool Polygon2d::HasSeparatingEdge(const Polygon2d &polygon) const {
   for (int i = 0; i < num_points_; ++i) {
-    distance = std::min(distance, line_segments_[i].DistanceTo(point));
+    const double nx = normal_x_[i];
+    const double ny = normal_y_[i];
+    const int n = polygon.num_points_;
+    double min_proj = std::numeric_limits<double>::infinity();
+    int j = 0;
+#if defined(__AVX2__)
+    const __m256d v_nx = _mm256_set1_pd(nx);
+    const __m256d v_ny = _mm256_set1_pd(ny);
+    __m256d v_min = _mm256_set1_pd(min_proj);
+    for (; j + 4 <= n; j += 4) {
+      const __m256d proj = _mm256_add_pd(
+          _mm256_mul_pd(v_nx, _mm256_loadu_pd(&polygon.vertices_x_[j])),
+          _mm256_mul_pd(v_ny, _mm256_loadu_pd(&polygon.vertices_y_[j])));
+      v_min = _mm256_min_pd(v_min, proj);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, v_min);
+    min_proj = std::min(std::min(lanes[0], lanes[1]),
+                        std::min(lanes[2], lanes[3]));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const float64x2_t v_nx = vdupq_n_f64(nx);
+    const float64x2_t v_ny = vdupq_n_f64(ny);
+    float64x2_t v_min = vdupq_n_f64(min_proj);
+    for (; j + 2 <= n; j += 2) {
+      const float64x2_t proj = vaddq_f64(
+          vmulq_f64(v_nx, vld1q_f64(&polygon.vertices_x_[j])),
+          vmulq_f64(v_ny, vld1q_f64(&polygon.vertices_y_[j])));
+      v_min = vminq_f64(v_min, proj);
+    }
+    min_proj = std::min(vgetq_lane_f64(v_min, 0), vgetq_lane_f64(v_min, 1));
+#endif
+    for (; j < n; ++j) {
+      min_proj = std::min(
+          min_proj,
+          nx * polygon.vertices_x_[j] + ny * polygon.vertices_y_[j]);
+    }
+    // The projection gap along any axis is a lower bound of the distance
+    // between the polygons, so this reject is exact.
+    if (min_proj > normal_offset_[i] + kMathEpsilon) {
+      return true;
+    }
   }
-  return distance;
+  return false;
 }
 
 bool Polygon2d::IsPointOnBoundary(const Vec2d &point) const {
@@ -148,6 +252,9 @@ bool Polygon2d::HasOverlap(const Polygon2d &polygon) const {
       polygon.max_y() < min_y() || polygon.min_y() > max_y()) {
     return false;
   }
+  if (HasSeparatingEdge(polygon) || polygon.HasSeparatingEdge(*this)) {
+    return false;
+  }
   return DistanceTo(polygon) <= kMathEpsilon;
 }
 
@@ -235,6 +342,40 @@ void Polygon2d::BuildFromPoints() {
     min_y_ = std::min(min_y_, point.y());
     max_y_ = std::max(max_y_, point.y());
   }
+
+  // Fill the SoA caches for the vectorized kernels.
+  vertices_x_.resize(num_points_);
+  vertices_y_.resize(num_points_);
+  edge_start_x_.resize(num_points_);
+  edge_start_y_.resize(num_points_);
+  edge_unit_x_.resize(num_points_);
+  edge_unit_y_.resize(num_points_);
+  edge_length_.resize(num_points_);
+  normal_x_.resize(num_points_);
+  normal_y_.resize(num_points_);
+  normal_offset_.resize(num_points_);
+  for (int i = 0; i < num_points_; ++i) {
+    vertices_x_[i] = points_[i].x();
+    vertices_y_[i] = points_[i].y();
+    const auto &segment = line_segments_[i];
+    edge_start_x_[i] = segment.start().x();
+    edge_start_y_[i] = segment.start().y();
+    edge_unit_x_[i] = segment.unit_direction().x();
+    edge_unit_y_[i] = segment.unit_direction().y();
+    edge_length_[i] = segment.length();
+    // Points are ccw here, so the outward normal is to the right of the
+    // edge direction.
+    normal_x_[i] = segment.unit_direction().y();
+    normal_y_[i] = -segment.unit_direction().x();
+  }
+  for (int i = 0; i < num_points_; ++i) {
+    double max_proj = -std::numeric_limits<double>::infinity();
+    for (int j = 0; j < num_points_; ++j) {
+      max_proj = std::max(max_proj, normal_x_[i] * vertices_x_[j] +
+                                        normal_y_[i] * vertices_y_[j]);
+    }
+    normal_offset_[i] = max_proj;
+  }
 }
 
 bool Polygon2d::ComputeConvexHull(const std::vector<Vec2d> &points,
@@ -325,6 +325,25 @@ class Polygon2d {
   static bool ClipConvexHull(const LineSegment2d &line_segment,
                              std::vector<Vec2d> *const points);
 
+  /**
+   * @brief Compute the squared distance from the boundary to a point with
+   *        a vectorized scan over the cached edge arrays.
+   * @param point The point to compute the squared distance to.
+   * @return The squared distance from the boundary to the point.
+   */
+  double MinDistanceSquareToEdges(const Vec2d &point) const;
+
+  /**
+   * @brief Check whether one of this polygon's edge normals is a separating
+   *        axis against another polygon, scanning the other polygon's
+   *        vertices with a vectorized loop. Finding one proves the polygons
+   *        are more than kMathEpsilon apart; not finding one proves nothing,
+   *        so callers must fall back to the exact test.
+   * @param polygon The polygon to test against.
+   * @return Whether a separating edge normal was found.
+   */
+  bool HasSeparatingEdge(const Polygon2d &polygon) const;
+
   std::vector<Vec2d> points_;
   int num_points_ = 0;
   std::vector<LineSegment2d> line_segments_;
@@ -334,6 +353,22 @@ class Polygon2d {
   double max_x_ = 0.0;
   double min_y_ = 0.0;
   double max_y_ = 0.0;
+
+  // Structure-of-arrays caches filled by BuildFromPoints() for the
+  // vectorized distance and separating-axis kernels.
+  std::vector<double> vertices_x_;
+  std::vector<double> vertices_y_;
+  std::vector<double> edge_start_x_;
+  std::vector<double> edge_start_y_;
+  std::vector<double> edge_unit_x_;
+  std::vector<double> edge_unit_y_;
+  std::vector<double> edge_length_;
+  // Outward edge normals; normal_offset_ is the maximal projection of this
+  // polygon's own vertices onto the normal, so another polygon whose minimal
+  // projection exceeds it is separated from this one.
+  std::vector<double> normal_x_;
+  std::vector<double> normal_y_;
+  std::vector<double> normal_offset_;
 };
 
 }  // namespace math
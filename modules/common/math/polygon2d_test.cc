@@ -697,6 +697,37 @@ TEST(Polygon2dTest, Expand) {
   }
 }
 
+TEST(Polygon2dTest, OverlapSeparatingAxisFastPath) {
+  // HasOverlap must agree with the distance-based definition regardless of
+  // whether the separating-axis fast path rejects the pair.
+  for (int iter = 0; iter < 1000; ++iter) {
+    const Box2d box1({RandomDouble(-10, 10), RandomDouble(-10, 10)},
+                     RandomDouble(0, M_PI * 2.0), RandomDouble(1, 5),
+                     RandomDouble(1, 5));
+    const Box2d box2({RandomDouble(-10, 10), RandomDouble(-10, 10)},
+                     RandomDouble(0, M_PI * 2.0), RandomDouble(1, 5),
+                     RandomDouble(1, 5));
+    const Polygon2d poly1(box1);
+    const Polygon2d poly2(box2);
+    const double distance = poly1.DistanceTo(poly2);
+    if (distance > kMathEpsilon * 2.0) {
+      EXPECT_FALSE(poly1.HasOverlap(poly2));
+    } else if (distance < kMathEpsilon / 2.0) {
+      EXPECT_TRUE(poly1.HasOverlap(poly2));
+    }
+  }
+
+  // Non-convex polygons only use the fast path as a reject, so the result
+  // must still match the exact computation.
+  const Polygon2d l_shape({{0, 0}, {3, 0}, {3, 1}, {1, 1}, {1, 3}, {0, 3}});
+  EXPECT_FALSE(l_shape.HasOverlap(Polygon2d(Box2d::CreateAABox({2, 2},
+                                                               {3, 3}))));
+  EXPECT_TRUE(l_shape.HasOverlap(Polygon2d(Box2d::CreateAABox({0.5, 0.5},
+                                                              {2, 2}))));
+  EXPECT_TRUE(l_shape.HasOverlap(Polygon2d(Box2d::CreateAABox({-1, -1},
+                                                              {4, 4}))));
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <cmath>
+
 /**
  * @namespace apollo::common::math
  * @brief apollo::common::math
@@ -29,9 +31,52 @@ namespace apollo {
 namespace common {
 namespace math {
 
+/**
+ * @brief Compute sin(x) in a constexpr context via its Taylor series.
+ *        Accurate to double precision on [0, pi/2], which is all the
+ *        quarter-wave tables below need.
+ * @param x The angle in radians, expected in [0, pi/2].
+ * @return sin(x)
+ */
+constexpr double ConstexprSin(const double x) {
+  double term = x;
+  double sum = x;
+  for (int k = 1; k <= 12; ++k) {
+    term *= -x * x / static_cast<double>((2 * k) * (2 * k + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+/**
+ * @class SinTable
+ * @brief Quarter-wave sine table over [0, pi/2], generated at compile
+ *        time. Entry type and entry count (i.e. precision) are template
+ *        parameters, so callers can instantiate denser or double-precision
+ *        tables without a generated source file.
+ * @param T Entry type, float or double.
+ * @param N Number of entries; entry i holds sin(i / (N - 1) * pi / 2).
+ */
+template <typename T, int N>
+struct SinTable {
+  constexpr SinTable() : table() {
+    for (int i = 0; i < N; ++i) {
+      table[i] =
+          static_cast<T>(ConstexprSin(M_PI_2 * i / static_cast<double>(N - 1)));
+    }
+  }
+
+  constexpr T operator[](const int index) const { return table[index]; }
+
+  T table[N];
+};
+
 //! Used by Angle class to speed-up computation of trigonometric functions.
 #define SIN_TABLE_SIZE 16385
-extern const float SIN_TABLE[SIN_TABLE_SIZE];
+extern const SinTable<float, SIN_TABLE_SIZE> SIN_TABLE;
+//! Double-precision table for callers that would otherwise pay a
+//! float-to-double conversion on every lookup.
+extern const SinTable<double, SIN_TABLE_SIZE> SIN_TABLE_DOUBLE;
 
 }  // namespace math
 }  // namespace common
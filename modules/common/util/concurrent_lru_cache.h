@@ -0,0 +1,323 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cyber/base/atomic_rw_lock.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+/**
+ * @brief A non-owning character range, standing in for std::string_view until
+ *        the toolchain moves past C++14. Carries just enough to look up
+ *        string-keyed cache entries without constructing a std::string.
+ */
+class CharRange {
+ public:
+  CharRange(const char* data, const size_t size) : data_(data), size_(size) {}
+  // NOLINTNEXTLINE(runtime/explicit): intentionally implicit, view semantics
+  CharRange(const std::string& str) : data_(str.data()), size_(str.size()) {}
+  // NOLINTNEXTLINE(runtime/explicit): intentionally implicit, view semantics
+  CharRange(const char* c_str) : data_(c_str), size_(std::strlen(c_str)) {}
+
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+  friend bool operator==(const std::string& str, const CharRange& range) {
+    return str.size() == range.size_ &&
+           std::memcmp(str.data(), range.data_, range.size_) == 0;
+  }
+  friend bool operator==(const CharRange& range, const std::string& str) {
+    return str == range;
+  }
+
+ private:
+  const char* data_;
+  size_t size_;
+};
+
+/**
+ * @brief FNV-1a over bytes. Hashes a std::string and a CharRange covering the
+ *        same characters identically, which is what makes heterogeneous
+ *        lookups through ConcurrentLRUCache::GetCopyByView() work.
+ */
+struct CharRangeHash {
+  size_t operator()(const CharRange& range) const {
+    size_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < range.size(); ++i) {
+      hash ^= static_cast<unsigned char>(range.data()[i]);
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+  size_t operator()(const std::string& str) const {
+    return (*this)(CharRange(str));
+  }
+};
+
+/**
+ * @class ConcurrentLRUCache
+ * @brief A sharded, internally synchronized LRU cache.
+ *
+ * Keys are distributed over independently locked shards, so writers only
+ * contend within a shard. A cache hit takes the shard's read lock and records
+ * recency by storing a global access tick into the entry - no list splice, so
+ * concurrent readers of hot keys never write shared list nodes. Eviction runs
+ * under the shard's write lock and removes the entry with the smallest tick;
+ * the scan is linear in the shard size, which stays small because capacity is
+ * split across shards.
+ *
+ * The bucket count is fixed at construction (capacity never changes), and a
+ * Hash functor accepting more than one key representation enables lookups
+ * without key construction, e.g.:
+ *
+ *   ConcurrentLRUCache<std::string, Value, CharRangeHash> cache(64);
+ *   cache.GetCopyByView(CharRange(ptr, len), &value);
+ *
+ * Unlike LRUCache, values are returned by copy: a reference into a shard
+ * would not stay valid once the lock is released. Cache shared_ptr values
+ * when copies are too expensive.
+ */
+template <class K, class V, class Hash = std::hash<K>>
+class ConcurrentLRUCache {
+ public:
+  explicit ConcurrentLRUCache(const size_t capacity,
+                              const size_t num_shards = kDefaultNumShards)
+      : shard_count_(NextPowerOfTwo(num_shards)),
+        shard_capacity_((capacity + shard_count_ - 1) / shard_count_),
+        shards_(new Shard[shard_count_]) {
+    const size_t bucket_count = NextPowerOfTwo(shard_capacity_ * 2);
+    for (size_t i = 0; i < shard_count_; ++i) {
+      shards_[i].buckets.resize(bucket_count);
+    }
+  }
+
+  /**
+   * @brief Insert or overwrite the value of a key, evicting the least
+   *        recently used entry of the shard when it is full.
+   */
+  template <typename VV>
+  void Put(const K& key, VV&& value) {
+    const size_t hash = Hash()(key);
+    Shard& shard = ShardFor(hash);
+    cyber::base::WriteLockGuard<cyber::base::AtomicRWLock> guard(shard.lock);
+    Entry* entry = shard.Find(BucketIndex(hash), key);
+    if (entry != nullptr) {
+      entry->value = std::forward<VV>(value);
+      entry->tick.store(NextTick(), std::memory_order_relaxed);
+      return;
+    }
+    if (shard.entries.size() >= shard_capacity_) {
+      shard.EvictOldest(this);
+    }
+    shard.entries.emplace_back(key, std::forward<VV>(value));
+    Entry* inserted = &shard.entries.back();
+    inserted->tick.store(NextTick(), std::memory_order_relaxed);
+    shard.buckets[BucketIndex(hash)].push_back(inserted);
+    shard.size.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Copy the value of a key and mark it recently used. Hits only take
+   *        the shard's read lock.
+   * @return Whether the key was found.
+   */
+  bool GetCopy(const K& key, V* const value) {
+    return LookupByView(Hash()(key), key, value, false);
+  }
+
+  /**
+   * @brief GetCopy without refreshing recency.
+   */
+  bool GetCopySilently(const K& key, V* const value) {
+    return LookupByView(Hash()(key), key, value, true);
+  }
+
+  /**
+   * @brief Heterogeneous GetCopy: KeyView must hash through this cache's
+   *        Hash functor exactly like the K it stands for and be comparable
+   *        to K with operator==. With CharRangeHash, a CharRange looks up a
+   *        std::string key without constructing one.
+   */
+  template <class KeyView>
+  bool GetCopyByView(const KeyView& key_view, V* const value) {
+    return LookupByView(Hash()(key_view), key_view, value, false);
+  }
+
+  bool Contains(const K& key) {
+    const size_t hash = Hash()(key);
+    Shard& shard = ShardFor(hash);
+    cyber::base::ReadLockGuard<cyber::base::AtomicRWLock> guard(shard.lock);
+    return shard.Find(BucketIndex(hash), key) != nullptr;
+  }
+
+  /**
+   * @brief Remove a key.
+   * @return Whether the key was present.
+   */
+  bool Remove(const K& key) {
+    const size_t hash = Hash()(key);
+    Shard& shard = ShardFor(hash);
+    cyber::base::WriteLockGuard<cyber::base::AtomicRWLock> guard(shard.lock);
+    return shard.Erase(BucketIndex(hash), key);
+  }
+
+  void Clear() {
+    for (size_t i = 0; i < shard_count_; ++i) {
+      cyber::base::WriteLockGuard<cyber::base::AtomicRWLock> guard(
+          shards_[i].lock);
+      for (auto& bucket : shards_[i].buckets) {
+        bucket.clear();
+      }
+      shards_[i].entries.clear();
+      shards_[i].size.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  size_t size() const {
+    size_t total = 0;
+    for (size_t i = 0; i < shard_count_; ++i) {
+      total += shards_[i].size.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  size_t capacity() const { return shard_capacity_ * shard_count_; }
+
+  size_t shard_count() const { return shard_count_; }
+
+ private:
+  static constexpr size_t kDefaultNumShards = 8;
+
+  struct Entry {
+    template <typename VV>
+    Entry(const K& key, VV&& value)
+        : key(key), value(std::forward<VV>(value)) {}
+
+    K key;
+    V value;
+    std::atomic<uint64_t> tick{0};
+  };
+
+  struct Shard {
+    cyber::base::AtomicRWLock lock;
+    // Entry storage; std::list keeps pointers in buckets stable.
+    std::list<Entry> entries;
+    // Fixed-size chained hash index over entries.
+    std::vector<std::vector<Entry*>> buckets;
+    std::atomic<size_t> size{0};
+
+    template <class KeyView>
+    Entry* Find(const size_t bucket_index, const KeyView& key_view) {
+      for (Entry* entry : buckets[bucket_index]) {
+        if (entry->key == key_view) {
+          return entry;
+        }
+      }
+      return nullptr;
+    }
+
+    void EvictOldest(ConcurrentLRUCache* const cache) {
+      auto oldest = entries.begin();
+      for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (it->tick.load(std::memory_order_relaxed) <
+            oldest->tick.load(std::memory_order_relaxed)) {
+          oldest = it;
+        }
+      }
+      if (oldest != entries.end()) {
+        Erase(cache->BucketIndex(Hash()(oldest->key)), oldest->key);
+      }
+    }
+
+    bool Erase(const size_t bucket_index, const K& key) {
+      auto& bucket = buckets[bucket_index];
+      for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+        if ((*it)->key == key) {
+          Entry* entry = *it;
+          bucket.erase(it);
+          for (auto list_it = entries.begin(); list_it != entries.end();
+               ++list_it) {
+            if (&*list_it == entry) {
+              entries.erase(list_it);
+              break;
+            }
+          }
+          size.fetch_sub(1, std::memory_order_relaxed);
+          return true;
+        }
+      }
+      return false;
+    }
+  };
+
+  template <class KeyView>
+  bool LookupByView(const size_t hash, const KeyView& key_view, V* const value,
+                    const bool silent) {
+    Shard& shard = ShardFor(hash);
+    cyber::base::ReadLockGuard<cyber::base::AtomicRWLock> guard(shard.lock);
+    Entry* entry = shard.Find(BucketIndex(hash), key_view);
+    if (entry == nullptr) {
+      return false;
+    }
+    if (!silent) {
+      // Recency is a per-entry tick instead of a list splice, so hits stay
+      // read-only on the shard structure.
+      entry->tick.store(NextTick(), std::memory_order_relaxed);
+    }
+    *value = entry->value;
+    return true;
+  }
+
+  Shard& ShardFor(const size_t hash) {
+    return shards_[hash & (shard_count_ - 1)];
+  }
+
+  size_t BucketIndex(const size_t hash) const {
+    // Shard selection consumes the low bits; index buckets with higher ones.
+    const size_t bucket_count = shards_[0].buckets.size();
+    return (hash / shard_count_) & (bucket_count - 1);
+  }
+
+  uint64_t NextTick() { return tick_.fetch_add(1, std::memory_order_relaxed); }
+
+  static size_t NextPowerOfTwo(const size_t value) {
+    size_t result = 1;
+    while (result < value) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  const size_t shard_count_;
+  const size_t shard_capacity_;
+  std::unique_ptr<Shard[]> shards_;
+  std::atomic<uint64_t> tick_{1};
+};
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
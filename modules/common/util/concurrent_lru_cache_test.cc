@@ -0,0 +1,116 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/util/concurrent_lru_cache.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+TEST(ConcurrentLRUCache, PutGetEvict) {
+  // A single shard makes eviction order deterministic.
+  ConcurrentLRUCache<int, int> cache(4, 1);
+  EXPECT_EQ(cache.capacity(), 4U);
+  EXPECT_EQ(cache.shard_count(), 1U);
+
+  for (int i = 0; i < 4; ++i) {
+    cache.Put(i, i * 10);
+  }
+  EXPECT_EQ(cache.size(), 4U);
+
+  // Touch key 0 so key 1 becomes the oldest.
+  int value = -1;
+  EXPECT_TRUE(cache.GetCopy(0, &value));
+  EXPECT_EQ(value, 0);
+
+  cache.Put(4, 40);
+  EXPECT_EQ(cache.size(), 4U);
+  EXPECT_FALSE(cache.Contains(1));
+  EXPECT_TRUE(cache.Contains(0));
+  EXPECT_TRUE(cache.Contains(2));
+  EXPECT_TRUE(cache.Contains(3));
+  EXPECT_TRUE(cache.GetCopy(4, &value));
+  EXPECT_EQ(value, 40);
+
+  // A silent get must not refresh recency: key 2 stays the oldest.
+  EXPECT_TRUE(cache.GetCopySilently(2, &value));
+  cache.Put(5, 50);
+  EXPECT_FALSE(cache.Contains(2));
+}
+
+TEST(ConcurrentLRUCache, UpdateAndRemove) {
+  ConcurrentLRUCache<int, std::string> cache(4, 1);
+  cache.Put(1, std::string("one"));
+  cache.Put(1, std::string("uno"));
+  EXPECT_EQ(cache.size(), 1U);
+
+  std::string value;
+  EXPECT_TRUE(cache.GetCopy(1, &value));
+  EXPECT_EQ(value, "uno");
+
+  EXPECT_TRUE(cache.Remove(1));
+  EXPECT_FALSE(cache.Remove(1));
+  EXPECT_EQ(cache.size(), 0U);
+  EXPECT_FALSE(cache.GetCopy(1, &value));
+}
+
+TEST(ConcurrentLRUCache, HeterogeneousLookup) {
+  ConcurrentLRUCache<std::string, int, CharRangeHash> cache(8, 1);
+  cache.Put("route_segment_12", 12);
+  cache.Put("route_segment_34", 34);
+
+  // Look up with a view into a larger buffer, no std::string constructed.
+  const char buffer[] = "route_segment_12:route_segment_34";
+  int value = -1;
+  EXPECT_TRUE(cache.GetCopyByView(CharRange(buffer, 16), &value));
+  EXPECT_EQ(value, 12);
+  EXPECT_TRUE(cache.GetCopyByView(CharRange(buffer + 17, 16), &value));
+  EXPECT_EQ(value, 34);
+  EXPECT_FALSE(cache.GetCopyByView(CharRange(buffer, 15), &value));
+}
+
+TEST(ConcurrentLRUCache, ConcurrentAccess) {
+  ConcurrentLRUCache<int, int> cache(64);
+  constexpr int kNumThreads = 4;
+  constexpr int kOpsPerThread = 10000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&cache, t]() {
+      int value = 0;
+      for (int i = 0; i < kOpsPerThread; ++i) {
+        const int key = (t * kOpsPerThread + i) % 128;
+        cache.Put(key, key * 2);
+        if (cache.GetCopy(key, &value)) {
+          EXPECT_EQ(value, key * 2);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(cache.size(), cache.capacity());
+}
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
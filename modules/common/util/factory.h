@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <memory>
 #include <utility>
@@ -123,6 +124,112 @@ class Factory {
   MapContainer producers_;
 };
 
+/**
+ * @class DenseEnumFactory
+ * @brief Factory keyed by a proto enum, backed by a dense creator table.
+ *
+ * For identifiers that are small dense enums - e.g. TaskConfig::TaskType -
+ * the map container of Factory pays hashing and node allocation on every
+ * lookup, which shows up as allocation bursts at scenario-switch time.
+ * Here a lookup is a bounds check and an array index; the table size is the
+ * enum's ARRAYSIZE constant, fixed at compile time. Registration keeps the
+ * Factory API so call sites only change the member's type. String-keyed
+ * products without a compile-time enum (plugins) should stay on Factory.
+ *
+ * @param EnumType The proto enum identifying the registered classes
+ * @param AbstractProduct The interface implemented by the registered classes
+ * @param ProductCreator Function returning a pointer to an instance of
+ * the registered class
+ * @param TableSize Number of enum values, typically the ARRAYSIZE constant
+ * generated with the proto enum
+ */
+template <typename EnumType, class AbstractProduct,
+          class ProductCreator = AbstractProduct *(*)(),
+          int TableSize = 0>
+class DenseEnumFactory {
+ public:
+  /**
+   * @brief Registers the class given by the creator function, linking it to
+   * id. Registration must happen prior to calling CreateObject.
+   * @param id Enum value of the class being registered
+   * @param creator Function returning a pointer to an instance of
+   * the registered class
+   * @return True iff the slot for id was still available
+   */
+  bool Register(const EnumType id, ProductCreator creator) {
+    const int index = static_cast<int>(id);
+    if (index < 0 || index >= TableSize) {
+      AERROR << "Identifier " << index << " is outside the creator table.";
+      return false;
+    }
+    if (producers_[index] != nullptr) {
+      return false;
+    }
+    producers_[index] = creator;
+    return true;
+  }
+
+  bool Contains(const EnumType id) const {
+    const int index = static_cast<int>(id);
+    return index >= 0 && index < TableSize && producers_[index] != nullptr;
+  }
+
+  /**
+   * @brief Unregisters the class with the given enum value
+   */
+  bool Unregister(const EnumType id) {
+    const int index = static_cast<int>(id);
+    if (index < 0 || index >= TableSize || producers_[index] == nullptr) {
+      return false;
+    }
+    producers_[index] = nullptr;
+    return true;
+  }
+
+  void Clear() { producers_.fill(nullptr); }
+
+  bool Empty() const {
+    for (const ProductCreator &creator : producers_) {
+      if (creator != nullptr) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Creates and transfers membership of an object of type matching
+   * id. Need to register id before CreateObject is called. May return
+   * nullptr silently.
+   */
+  template <typename... Args>
+  std::unique_ptr<AbstractProduct> CreateObjectOrNull(const EnumType id,
+                                                      Args &&... args) {
+    const int index = static_cast<int>(id);
+    if (index >= 0 && index < TableSize && producers_[index] != nullptr) {
+      return std::unique_ptr<AbstractProduct>(
+          (producers_[index])(std::forward<Args>(args)...));
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Creates and transfers membership of an object of type matching
+   * id. Need to register id before CreateObject is called.
+   */
+  template <typename... Args>
+  std::unique_ptr<AbstractProduct> CreateObject(const EnumType id,
+                                                Args &&... args) {
+    auto result = CreateObjectOrNull(id, std::forward<Args>(args)...);
+    AERROR_IF(!result) << "Factory could not create Object of type : "
+                       << static_cast<int>(id);
+    return result;
+  }
+
+ private:
+  std::array<ProductCreator, TableSize> producers_ = {};
+};
+
 }  // namespace util
 }  // namespace common
 }  // namespace apollo
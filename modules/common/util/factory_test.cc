@@ -92,6 +92,46 @@ TEST(FactoryTest, TwoArgConstructor) {
   EXPECT_EQ(10, ptr->Value());
 }
 
+enum class ProductType { BASE = 0, DERIVED = 1 };
+
+TEST(DenseEnumFactoryTest, Register) {
+  DenseEnumFactory<ProductType, Base, Base* (*)(), 2> factory;
+  EXPECT_TRUE(factory.Empty());
+  EXPECT_TRUE(factory.Register(ProductType::DERIVED,
+                               []() -> Base* { return new Derived(); }));
+  EXPECT_FALSE(factory.Register(ProductType::DERIVED,
+                                []() -> Base* { return new Derived(); }));
+  EXPECT_TRUE(factory.Contains(ProductType::DERIVED));
+  EXPECT_FALSE(factory.Contains(ProductType::BASE));
+
+  auto derived_ptr = factory.CreateObject(ProductType::DERIVED);
+  EXPECT_NE(nullptr, derived_ptr);
+  EXPECT_EQ("derived", derived_ptr->Name());
+  auto non_exist_ptr = factory.CreateObjectOrNull(ProductType::BASE);
+  EXPECT_EQ(nullptr, non_exist_ptr);
+
+  // Out-of-table values must be rejected, not indexed.
+  EXPECT_FALSE(factory.Register(static_cast<ProductType>(7),
+                                []() -> Base* { return new Derived(); }));
+  EXPECT_EQ(nullptr, factory.CreateObjectOrNull(static_cast<ProductType>(7)));
+
+  EXPECT_TRUE(factory.Unregister(ProductType::DERIVED));
+  EXPECT_FALSE(factory.Unregister(ProductType::DERIVED));
+  EXPECT_TRUE(factory.Empty());
+}
+
+TEST(DenseEnumFactoryTest, OneArgConstructor) {
+  DenseEnumFactory<ProductType, ArgConstructor,
+                   ArgConstructor* (*)(const std::string&), 2>
+      factory;
+  EXPECT_TRUE(factory.Register(ProductType::BASE, [](const std::string& arg) {
+    return new ArgConstructor(arg);
+  }));
+  auto ptr = factory.CreateObject(ProductType::BASE, "name_1");
+  EXPECT_NE(nullptr, ptr);
+  EXPECT_EQ("name_1", ptr->Name());
+}
+
 }  // namespace util
 }  // namespace common
 }  // namespace apollo
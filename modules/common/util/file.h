@@ -37,6 +37,7 @@ using apollo::cyber::common::DirectoryExists;
 using apollo::cyber::common::EnsureDirectory;
 using apollo::cyber::common::GetProtoFromASCIIFile;
 using apollo::cyber::common::GetProtoFromFile;
+using apollo::cyber::common::GetProtoFromFileZeroCopy;
 using apollo::cyber::common::PathExists;
 using apollo::cyber::common::SetProtoToASCIIFile;
 
@@ -22,7 +22,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "cyber/common/file.h"
 #include "google/protobuf/message.h"
@@ -89,6 +91,87 @@ bool DumpMessage(const std::shared_ptr<T>& msg,
       *msg, util::StrCat(dump_path, "/", sequence_num, ".pb.txt"));
 }
 
+/**
+ * @class MessagePool
+ * @brief Recycles output protobufs across component cycles instead of
+ *        heap-allocating a fresh message per Proc() call.
+ *
+ * Acquire() hands out a shared_ptr whose deleter returns the message to the
+ * pool, so a message written through cyber::Writer comes back automatically
+ * once the transport drops its last reference. Returned messages are
+ * Clear()ed on release, which happens on the transport's thread and - since
+ * protobuf retains the capacity of repeated fields and strings across
+ * Clear() - leaves the next cycle filling pre-sized storage:
+ *
+ *   MessagePool<ADCTrajectory> pool;       // member, outlives the writer
+ *   auto trajectory = pool.AcquireFilled(Name());
+ *   ...fill trajectory...
+ *   writer_->Write(trajectory);
+ *
+ * The pool must outlive every message it handed out.
+ */
+template <typename T, typename std::enable_if<
+                          std::is_base_of<Message, T>::value, int>::type = 0>
+class MessagePool {
+ public:
+  explicit MessagePool(const size_t capacity = kDefaultCapacity)
+      : capacity_(capacity) {}
+
+  /**
+   * @brief Get a cleared message, recycled when possible.
+   */
+  std::shared_ptr<T> Acquire() {
+    T* message = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!free_messages_.empty()) {
+        message = free_messages_.back().release();
+        free_messages_.pop_back();
+      }
+    }
+    if (message == nullptr) {
+      message = new T();
+    }
+    return std::shared_ptr<T>(message, [this](T* msg) { Release(msg); });
+  }
+
+  /**
+   * @brief Acquire() with the header stamped through FillHeader().
+   */
+  std::shared_ptr<T> AcquireFilled(const std::string& module_name) {
+    auto message = Acquire();
+    FillHeader(module_name, message.get());
+    return message;
+  }
+
+  /**
+   * @brief The number of idle messages currently held by the pool.
+   */
+  size_t IdleCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return free_messages_.size();
+  }
+
+ private:
+  void Release(T* message) {
+    // Clearing here keeps the work off the component's critical path and
+    // preserves the message's allocated storage for the next cycle.
+    message->Clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_messages_.size() < capacity_) {
+      free_messages_.emplace_back(message);
+    } else {
+      delete message;
+    }
+  }
+
+  static constexpr size_t kDefaultCapacity = 8;
+
+  const size_t capacity_;
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<T>> free_messages_;
+};
+
 inline size_t MessageFingerprint(const google::protobuf::Message& message) {
   static std::hash<std::string> hash_fn;
   std::string proto_bytes;
@@ -53,6 +53,35 @@ TEST(MessageUtilTest, MessageFingerprint) {
   EXPECT_EQ(fp0, MessageFingerprint(msg));
 }
 
+TEST(MessageUtilTest, MessagePool) {
+  MessagePool<test::SimpleMessage> pool(2);
+  EXPECT_EQ(0, pool.IdleCount());
+
+  test::SimpleMessage* first_address = nullptr;
+  {
+    auto message = pool.AcquireFilled("test");
+    EXPECT_EQ("test", message->header().module_name());
+    message->set_integer(42);
+    first_address = message.get();
+  }
+  EXPECT_EQ(1, pool.IdleCount());
+
+  // The recycled message comes back cleared, with the same storage.
+  auto message = pool.Acquire();
+  EXPECT_EQ(first_address, message.get());
+  EXPECT_FALSE(message->has_header());
+  EXPECT_EQ(0, message->integer());
+  EXPECT_EQ(0, pool.IdleCount());
+
+  // Releases beyond the pool capacity free the message instead.
+  auto second = pool.Acquire();
+  auto third = pool.Acquire();
+  message.reset();
+  second.reset();
+  third.reset();
+  EXPECT_EQ(2, pool.IdleCount());
+}
+
 // TEST(MessageUtilTest, get_desy_sec) {
 //   auto simple_msg = std::make_shared<test::SimpleMessage>();
 //   FillHeader("test", simple_msg.get());
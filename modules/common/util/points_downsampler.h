@@ -21,8 +21,11 @@
 #pragma once
 
 #include <cmath>
+#include <utility>
 #include <vector>
 
+#include "Eigen/Dense"
+
 #include "cyber/common/log.h"
 #include "modules/common/math/vec2d.h"
 
@@ -163,6 +166,122 @@ std::vector<size_t> DownsampleByDistance(const Points &points,
   return sampled_indices;
 }
 
+/**
+ * @brief Simplify a polyline held in contiguous coordinate arrays so that no
+ *        discarded point deviates laterally from the simplified polyline by
+ *        more than max_lateral_error. Douglas-Peucker, but with an explicit
+ *        segment stack, and the per-segment deviation scan is a single Eigen
+ *        array expression over the coordinate slices so it vectorizes.
+ *        Unlike DownsampleByAngle, the output comes with an error guarantee,
+ *        which is what map rendering needs to pick a tolerance in meters.
+ * @param x X coordinates of the points on the path.
+ * @param y Y coordinates of the points on the path.
+ * @param max_lateral_error Maximum allowed lateral deviation in meters.
+ * @param sampled_indices Indices of all kept points, in increasing order.
+ *        Cleared first, so the vector can be reused across polylines.
+ */
+inline void DownsampleWithErrorBound(const Eigen::ArrayXd &x,
+                                     const Eigen::ArrayXd &y,
+                                     const double max_lateral_error,
+                                     std::vector<size_t> *sampled_indices) {
+  CHECK_NOTNULL(sampled_indices);
+  sampled_indices->clear();
+  if (x.size() != y.size()) {
+    AERROR << "Coordinate arrays differ in size: " << x.size() << " vs. "
+           << y.size();
+    return;
+  }
+  if (max_lateral_error < 0.0) {
+    AERROR << "Input error bound is negative.";
+    return;
+  }
+  const size_t num_points = static_cast<size_t>(x.size());
+  if (num_points <= 2) {
+    for (size_t i = 0; i < num_points; ++i) {
+      sampled_indices->push_back(i);
+    }
+    return;
+  }
+
+  std::vector<bool> is_kept(num_points, false);
+  is_kept.front() = is_kept.back() = true;
+
+  std::vector<std::pair<size_t, size_t>> segments;
+  segments.emplace_back(0, num_points - 1);
+  while (!segments.empty()) {
+    const size_t start = segments.back().first;
+    const size_t end = segments.back().second;
+    segments.pop_back();
+    if (end - start < 2) {
+      continue;
+    }
+
+    const auto inner_x = x.segment(start + 1, end - start - 1);
+    const auto inner_y = y.segment(start + 1, end - start - 1);
+    const double dx = x[end] - x[start];
+    const double dy = y[end] - y[start];
+    const double length = std::hypot(dx, dy);
+
+    size_t farthest = 0;
+    double deviation = 0.0;
+    if (length < 1e-10) {
+      // Closed or degenerate segment: bound the distance to the endpoint.
+      Eigen::ArrayXd::Index offset = 0;
+      deviation =
+          ((inner_x - x[start]).square() + (inner_y - y[start]).square())
+              .maxCoeff(&offset);
+      deviation = std::sqrt(deviation);
+      farthest = start + 1 + static_cast<size_t>(offset);
+    } else {
+      // |cross product| / |segment| is the lateral distance to the chord.
+      Eigen::ArrayXd::Index offset = 0;
+      deviation = ((inner_x - x[start]) * dy - (inner_y - y[start]) * dx)
+                      .abs()
+                      .maxCoeff(&offset) /
+                  length;
+      farthest = start + 1 + static_cast<size_t>(offset);
+    }
+
+    if (deviation > max_lateral_error) {
+      is_kept[farthest] = true;
+      segments.emplace_back(start, farthest);
+      segments.emplace_back(farthest, end);
+    }
+  }
+
+  for (size_t i = 0; i < num_points; ++i) {
+    if (is_kept[i]) {
+      sampled_indices->push_back(i);
+    }
+  }
+
+  ADEBUG << "Point Vector is downsampled from " << num_points << " to "
+         << sampled_indices->size();
+}
+
+/**
+ * @brief DownsampleWithErrorBound over any point container with x()/y()
+ *        accessors. Coordinates are gathered once into contiguous arrays so
+ *        the deviation scans run vectorized.
+ * @param points Points on the path.
+ * @param max_lateral_error Maximum allowed lateral deviation in meters.
+ * @return Indices of all kept points, or empty when fail.
+ */
+template <typename Points>
+std::vector<size_t> DownsampleWithErrorBound(const Points &points,
+                                             const double max_lateral_error) {
+  const size_t num_points = points.size();
+  Eigen::ArrayXd x(num_points);
+  Eigen::ArrayXd y(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    x[i] = points[i].x();
+    y[i] = points[i].y();
+  }
+  std::vector<size_t> sampled_indices;
+  DownsampleWithErrorBound(x, y, max_lateral_error, &sampled_indices);
+  return sampled_indices;
+}
+
 }  // namespace util
 }  // namespace common
 }  // namespace apollo
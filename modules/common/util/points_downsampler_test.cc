@@ -83,6 +83,72 @@ TEST(DownSamplerTest, DownsampleByDistanceSteepTurn) {
   EXPECT_EQ(4, sampled_indices[4]);
 }
 
+TEST(DownSamplerTest, DownsampleWithErrorBoundStraightLine) {
+  std::vector<Vec2d> points;
+  for (int i = 0; i <= 10; ++i) {
+    points.emplace_back(i, 0.001 * i);
+  }
+
+  std::vector<size_t> sampled_indices =
+      DownsampleWithErrorBound(points, 0.05);
+  EXPECT_EQ(2, sampled_indices.size());
+  EXPECT_EQ(0, sampled_indices[0]);
+  EXPECT_EQ(10, sampled_indices[1]);
+}
+
+TEST(DownSamplerTest, DownsampleWithErrorBoundKeepsCorner) {
+  std::vector<Vec2d> points;
+  points.emplace_back(0, 0);
+  points.emplace_back(1, 0);
+  points.emplace_back(2, 0);
+  points.emplace_back(2, 1);
+  points.emplace_back(2, 2);
+
+  std::vector<size_t> sampled_indices =
+      DownsampleWithErrorBound(points, 0.05);
+  EXPECT_EQ(3, sampled_indices.size());
+  EXPECT_EQ(0, sampled_indices[0]);
+  EXPECT_EQ(2, sampled_indices[1]);
+  EXPECT_EQ(4, sampled_indices[2]);
+}
+
+TEST(DownSamplerTest, DownsampleWithErrorBoundRespectsBound) {
+  std::vector<Vec2d> points;
+  for (int i = 0; i <= 100; ++i) {
+    const double x = 0.1 * i;
+    points.emplace_back(x, std::sin(x));
+  }
+
+  constexpr double kMaxError = 0.02;
+  Eigen::ArrayXd x(points.size());
+  Eigen::ArrayXd y(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    x[i] = points[i].x();
+    y[i] = points[i].y();
+  }
+  std::vector<size_t> sampled_indices;
+  DownsampleWithErrorBound(x, y, kMaxError, &sampled_indices);
+
+  ASSERT_GE(sampled_indices.size(), 2);
+  EXPECT_LT(sampled_indices.size(), points.size());
+  EXPECT_EQ(0, sampled_indices.front());
+  EXPECT_EQ(points.size() - 1, sampled_indices.back());
+
+  // Every discarded point must be within the bound of its simplified segment.
+  for (size_t seg = 0; seg + 1 < sampled_indices.size(); ++seg) {
+    const size_t start = sampled_indices[seg];
+    const size_t end = sampled_indices[seg + 1];
+    const Vec2d a(points[start].x(), points[start].y());
+    const Vec2d b(points[end].x(), points[end].y());
+    for (size_t i = start + 1; i < end; ++i) {
+      const Vec2d p(points[i].x(), points[i].y());
+      const double cross = (b - a).CrossProd(p - a);
+      const double deviation = std::fabs(cross) / (b - a).Length();
+      EXPECT_LE(deviation, kMaxError);
+    }
+  }
+}
+
 }  // namespace util
 }  // namespace common
 }  // namespace apollo
@@ -75,6 +75,8 @@ Status VehicleStateProvider::Update(
 
   vehicle_state_.set_driving_mode(chassis.driving_mode());
 
+  PublishSnapshot();
+
   return Status::OK();
 }
 
@@ -194,6 +196,7 @@ const localization::Pose &VehicleStateProvider::original_pose() const {
 
 void VehicleStateProvider::set_linear_velocity(const double linear_velocity) {
   vehicle_state_.set_linear_velocity(linear_velocity);
+  PublishSnapshot();
 }
 
 const VehicleState &VehicleStateProvider::vehicle_state() const {
@@ -201,34 +204,179 @@ const VehicleState &VehicleStateProvider::vehicle_state() const {
 }
 
 math::Vec2d VehicleStateProvider::EstimateFuturePosition(const double t) const {
+  return PredictPosition(MakeSnapshot(vehicle_state_), t);
+}
+
+math::Vec2d VehicleStateProvider::PredictPosition(const StateSnapshot &snapshot,
+                                                  const double t) {
   Eigen::Vector3d vec_distance(0.0, 0.0, 0.0);
-  double v = vehicle_state_.linear_velocity();
+  const double v = snapshot.linear_velocity;
   // Predict distance travel vector
-  if (std::fabs(vehicle_state_.angular_velocity()) < 0.0001) {
+  if (std::fabs(snapshot.angular_velocity) < 0.0001) {
     vec_distance[0] = 0.0;
     vec_distance[1] = v * t;
   } else {
-    vec_distance[0] = -v / vehicle_state_.angular_velocity() *
-                      (1.0 - std::cos(vehicle_state_.angular_velocity() * t));
-    vec_distance[1] = std::sin(vehicle_state_.angular_velocity() * t) * v /
-                      vehicle_state_.angular_velocity();
+    vec_distance[0] = -v / snapshot.angular_velocity *
+                      (1.0 - std::cos(snapshot.angular_velocity * t));
+    vec_distance[1] =
+        std::sin(snapshot.angular_velocity * t) * v / snapshot.angular_velocity;
   }
 
   // If we have rotation information, take it into consideration.
-  if (vehicle_state_.pose().has_orientation()) {
-    const auto &orientation = vehicle_state_.pose().orientation();
-    Eigen::Quaternion<double> quaternion(orientation.qw(), orientation.qx(),
-                                         orientation.qy(), orientation.qz());
-    Eigen::Vector3d pos_vec(vehicle_state_.x(), vehicle_state_.y(),
-                            vehicle_state_.z());
+  if (snapshot.has_orientation) {
+    Eigen::Quaternion<double> quaternion(snapshot.qw, snapshot.qx, snapshot.qy,
+                                         snapshot.qz);
+    Eigen::Vector3d pos_vec(snapshot.x, snapshot.y, snapshot.z);
     auto future_pos_3d = quaternion.toRotationMatrix() * vec_distance + pos_vec;
     return math::Vec2d(future_pos_3d[0], future_pos_3d[1]);
   }
 
   // If no valid rotation information provided from localization,
   // return the estimated future position without rotation.
-  return math::Vec2d(vec_distance[0] + vehicle_state_.x(),
-                     vec_distance[1] + vehicle_state_.y());
+  return math::Vec2d(vec_distance[0] + snapshot.x,
+                     vec_distance[1] + snapshot.y);
+}
+
+VehicleStateProvider::StateSnapshot VehicleStateProvider::MakeSnapshot(
+    const VehicleState &state) {
+  StateSnapshot snapshot;
+  snapshot.timestamp = state.timestamp();
+  snapshot.x = state.x();
+  snapshot.y = state.y();
+  snapshot.z = state.z();
+  snapshot.roll = state.roll();
+  snapshot.pitch = state.pitch();
+  snapshot.yaw = state.yaw();
+  snapshot.heading = state.heading();
+  snapshot.kappa = state.kappa();
+  snapshot.linear_velocity = state.linear_velocity();
+  snapshot.angular_velocity = state.angular_velocity();
+  snapshot.linear_acceleration = state.linear_acceleration();
+  if (state.pose().has_orientation()) {
+    const auto &orientation = state.pose().orientation();
+    snapshot.qw = orientation.qw();
+    snapshot.qx = orientation.qx();
+    snapshot.qy = orientation.qy();
+    snapshot.qz = orientation.qz();
+    snapshot.has_orientation = true;
+  }
+  snapshot.gear = static_cast<int32_t>(state.gear());
+  return snapshot;
+}
+
+void VehicleStateProvider::PublishSnapshot() {
+  const StateSnapshot snapshot = MakeSnapshot(vehicle_state_);
+  // Odd version marks the write section; readers retry instead of copying a
+  // torn snapshot. The double buffer keeps the previous snapshot readable
+  // while this one is written.
+  const uint64_t version = version_.fetch_add(1, std::memory_order_acq_rel);
+  buffers_[((version >> 1) + 1) & 1] = snapshot;
+  history_[history_count_ % kHistorySize] = snapshot;
+  ++history_count_;
+  version_.fetch_add(1, std::memory_order_release);
+}
+
+bool VehicleStateProvider::ReadSnapshot(StateSnapshot *snapshot) const {
+  for (;;) {
+    const uint64_t v1 = version_.load(std::memory_order_acquire);
+    if (v1 == 0) {
+      return false;
+    }
+    if (v1 & 1) {
+      continue;
+    }
+    *snapshot = buffers_[(v1 >> 1) & 1];
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (v1 == version_.load(std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+}
+
+bool VehicleStateProvider::GetStateSnapshot(VehicleState *state) const {
+  StateSnapshot snapshot;
+  if (!ReadSnapshot(&snapshot)) {
+    return false;
+  }
+  state->Clear();
+  state->set_timestamp(snapshot.timestamp);
+  state->set_x(snapshot.x);
+  state->set_y(snapshot.y);
+  state->set_z(snapshot.z);
+  state->set_roll(snapshot.roll);
+  state->set_pitch(snapshot.pitch);
+  state->set_yaw(snapshot.yaw);
+  state->set_heading(snapshot.heading);
+  state->set_kappa(snapshot.kappa);
+  state->set_linear_velocity(snapshot.linear_velocity);
+  state->set_angular_velocity(snapshot.angular_velocity);
+  state->set_linear_acceleration(snapshot.linear_acceleration);
+  if (snapshot.has_orientation) {
+    auto *orientation = state->mutable_pose()->mutable_orientation();
+    orientation->set_qw(snapshot.qw);
+    orientation->set_qx(snapshot.qx);
+    orientation->set_qy(snapshot.qy);
+    orientation->set_qz(snapshot.qz);
+  }
+  state->set_gear(static_cast<canbus::Chassis::GearPosition>(snapshot.gear));
+  return true;
+}
+
+math::Vec2d VehicleStateProvider::EstimatePositionAt(
+    const double timestamp) const {
+  enum class Mode { PREDICT, CLAMP, INTERPOLATE };
+  Mode mode = Mode::PREDICT;
+  StateSnapshot earlier;
+  StateSnapshot later;
+  for (;;) {
+    const uint64_t v1 = version_.load(std::memory_order_acquire);
+    if (v1 == 0) {
+      // Nothing published yet; fall back to the writer-side state.
+      return PredictPosition(MakeSnapshot(vehicle_state_),
+                             timestamp - vehicle_state_.timestamp());
+    }
+    if (v1 & 1) {
+      continue;
+    }
+    const uint64_t count = history_count_;
+    const uint64_t oldest = count > kHistorySize ? count - kHistorySize : 0;
+    uint64_t pos = count - 1;
+    while (pos > oldest && history_[pos % kHistorySize].timestamp > timestamp) {
+      --pos;
+    }
+    earlier = history_[pos % kHistorySize];
+    if (timestamp >= history_[(count - 1) % kHistorySize].timestamp) {
+      earlier = history_[(count - 1) % kHistorySize];
+      mode = Mode::PREDICT;
+    } else if (timestamp <= earlier.timestamp) {
+      mode = Mode::CLAMP;
+    } else {
+      later = history_[(pos + 1) % kHistorySize];
+      mode = Mode::INTERPOLATE;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (v1 == version_.load(std::memory_order_relaxed)) {
+      break;
+    }
+  }
+
+  switch (mode) {
+    case Mode::PREDICT:
+      return PredictPosition(earlier, timestamp - earlier.timestamp);
+    case Mode::CLAMP:
+      return math::Vec2d(earlier.x, earlier.y);
+    case Mode::INTERPOLATE:
+    default: {
+      const double span = later.timestamp - earlier.timestamp;
+      constexpr double kMinTimeSpan = 1e-9;
+      if (span < kMinTimeSpan) {
+        return math::Vec2d(later.x, later.y);
+      }
+      const double ratio = (timestamp - earlier.timestamp) / span;
+      return math::Vec2d(earlier.x + ratio * (later.x - earlier.x),
+                         earlier.y + ratio * (later.y - earlier.y));
+    }
+  }
 }
 
 math::Vec2d VehicleStateProvider::ComputeCOMPosition(
@@ -20,6 +20,8 @@
  */
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -178,13 +180,82 @@ class VehicleStateProvider {
 
   const VehicleState& vehicle_state() const;
 
+  /**
+   * @brief Copy a tear-free snapshot of the scalar vehicle state. Unlike the
+   *        plain accessors, which read the state being written by Update(),
+   *        this is safe to call from another thread.
+   * @param state The output state. The scalar fields and the pose
+   *        orientation are filled.
+   * @return Whether a state has been published yet.
+   */
+  bool GetStateSnapshot(VehicleState* state) const;
+
+  /**
+   * @brief Estimate the vehicle position at an absolute timestamp.
+   *        Timestamps covered by the kept history are interpolated between
+   *        the recorded states; timestamps beyond the newest state are
+   *        forward predicted with the EstimateFuturePosition() motion model.
+   *        Safe to call concurrently with Update().
+   * @param timestamp The absolute time to query, in seconds.
+   * @return The estimated position.
+   */
+  math::Vec2d EstimatePositionAt(const double timestamp) const;
+
  private:
   bool ConstructExceptLinearVelocity(
       const localization::LocalizationEstimate& localization);
 
+  // A trivially-copyable extract of VehicleState that can be published
+  // through the seqlock below.
+  struct StateSnapshot {
+    double timestamp = 0.0;
+    double x = 0.0;
+    double y = 0.0;
+    double z = 0.0;
+    double roll = 0.0;
+    double pitch = 0.0;
+    double yaw = 0.0;
+    double heading = 0.0;
+    double kappa = 0.0;
+    double linear_velocity = 0.0;
+    double angular_velocity = 0.0;
+    double linear_acceleration = 0.0;
+    double qw = 1.0;
+    double qx = 0.0;
+    double qy = 0.0;
+    double qz = 0.0;
+    bool has_orientation = false;
+    int32_t gear = 0;
+  };
+
+  static StateSnapshot MakeSnapshot(const VehicleState& state);
+
+  // The EstimateFuturePosition() motion model, applied to a snapshot t
+  // seconds ahead of its own timestamp.
+  static math::Vec2d PredictPosition(const StateSnapshot& snapshot,
+                                     const double t);
+
+  // Publishes vehicle_state_ into the double buffer and the history ring.
+  // Only called on the writer thread (Update / set_linear_velocity).
+  void PublishSnapshot();
+
+  // Seqlock read of the newest published snapshot.
+  bool ReadSnapshot(StateSnapshot* snapshot) const;
+
   common::VehicleState vehicle_state_;
   localization::LocalizationEstimate original_localization_;
 
+  static constexpr size_t kHistorySize = 64;
+
+  // version_ is odd while PublishSnapshot() is writing; readers retry
+  // instead of copying a torn snapshot. buffers_[(version_ >> 1) & 1] holds
+  // the newest completed snapshot; history_ is a ring ordered by publish
+  // count.
+  std::atomic<uint64_t> version_{0};
+  StateSnapshot buffers_[2];
+  StateSnapshot history_[kHistorySize];
+  uint64_t history_count_ = 0;
+
   DECLARE_SINGLETON(VehicleStateProvider)
 };
 
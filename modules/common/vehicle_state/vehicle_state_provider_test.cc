@@ -78,6 +78,37 @@ TEST_F(VehicleStateProviderTest, EstimateFuturePosition) {
   EXPECT_NEAR(future_position.y(), 90.393, 1e-3);
 }
 
+TEST_F(VehicleStateProviderTest, SnapshotAndHistory) {
+  auto vehicle_state_provider = VehicleStateProvider::Instance();
+  vehicle_state_provider->Update(localization_, chassis_);
+
+  VehicleState snapshot;
+  EXPECT_TRUE(vehicle_state_provider->GetStateSnapshot(&snapshot));
+  EXPECT_DOUBLE_EQ(snapshot.x(), vehicle_state_provider->x());
+  EXPECT_DOUBLE_EQ(snapshot.y(), vehicle_state_provider->y());
+  EXPECT_DOUBLE_EQ(snapshot.heading(), vehicle_state_provider->heading());
+  EXPECT_DOUBLE_EQ(snapshot.linear_velocity(),
+                   vehicle_state_provider->linear_velocity());
+
+  // Beyond the newest state, EstimatePositionAt applies the same motion
+  // model as EstimateFuturePosition.
+  const double now = vehicle_state_provider->timestamp();
+  const auto predicted = vehicle_state_provider->EstimatePositionAt(now + 1.0);
+  const auto expected = vehicle_state_provider->EstimateFuturePosition(1.0);
+  EXPECT_NEAR(predicted.x(), expected.x(), 1e-9);
+  EXPECT_NEAR(predicted.y(), expected.y(), 1e-9);
+
+  // After a second update, times in between are interpolated from the
+  // history ring.
+  auto shifted = localization_;
+  shifted.mutable_header()->set_timestamp_sec(now + 0.1);
+  shifted.mutable_pose()->mutable_position()->set_x(snapshot.x() + 1.0);
+  vehicle_state_provider->Update(shifted, chassis_);
+  const auto middle = vehicle_state_provider->EstimatePositionAt(now + 0.05);
+  EXPECT_NEAR(middle.x(), snapshot.x() + 0.5, 1e-9);
+  EXPECT_NEAR(middle.y(), snapshot.y(), 1e-9);
+}
+
 }  // namespace vehicle_state_provider
 }  // namespace common
 }  // namespace apollo
@@ -34,6 +34,16 @@ DEFINE_double(steer_angle_rate, 100.0,
               "Steer angle change rate in percentage.");
 DEFINE_bool(enable_gain_scheduler, false,
             "Enable gain scheduler for higher vehicle speed");
+DEFINE_bool(enable_lqr_gain_table, false,
+            "Solve the lateral LQR gains over the speed envelope at init and "
+            "interpolate them at runtime instead of iterating the solver "
+            "every control cycle");
+DEFINE_double(lqr_gain_table_max_speed, 35.0,
+              "Upper speed bound of the precomputed lateral LQR gain table, "
+              "in m/s");
+DEFINE_double(lqr_gain_table_speed_step, 0.2,
+              "Speed grid resolution of the precomputed lateral LQR gain "
+              "table, in m/s");
 DEFINE_bool(set_steer_limit, false, "Set steer limit");
 
 DEFINE_bool(enable_slope_offset, false, "Enable slope offset compensation");
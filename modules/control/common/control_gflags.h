@@ -36,6 +36,9 @@ DECLARE_double(max_acceleration_when_stopped);
 
 DECLARE_double(steer_angle_rate);
 DECLARE_bool(enable_gain_scheduler);
+DECLARE_bool(enable_lqr_gain_table);
+DECLARE_double(lqr_gain_table_max_speed);
+DECLARE_double(lqr_gain_table_speed_step);
 DECLARE_bool(set_steer_limit);
 DECLARE_bool(enable_slope_offset);
 
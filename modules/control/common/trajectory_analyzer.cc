@@ -49,6 +49,14 @@ PathPoint TrajectoryPointToPathPoint(const TrajectoryPoint &point) {
   }
 }
 
+// Number of points the cursor walk may step backward, to absorb localization
+// jitter around the previous match.
+constexpr size_t kQueryBackwardIndexWindow = 5;
+
+// Number of consecutive distance increases tolerated before the forward walk
+// accepts the bracketed minimum.
+constexpr size_t kQueryForwardRisingLimit = 5;
+
 }  // namespace
 
 TrajectoryAnalyzer::TrajectoryAnalyzer(
@@ -67,16 +75,7 @@ PathPoint TrajectoryAnalyzer::QueryMatchedPathPoint(const double x,
                                                     const double y) const {
   CHECK_GT(trajectory_points_.size(), 0);
 
-  double d_min = PointDistanceSquare(trajectory_points_.front(), x, y);
-  size_t index_min = 0;
-
-  for (size_t i = 1; i < trajectory_points_.size(); ++i) {
-    double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
-    if (d_temp < d_min) {
-      d_min = d_temp;
-      index_min = i;
-    }
-  }
+  size_t index_min = QueryNearestIndexByPosition(x, y);
 
   size_t index_start = index_min == 0 ? index_min : index_min - 1;
   size_t index_end =
@@ -179,17 +178,50 @@ TrajectoryPoint TrajectoryAnalyzer::QueryNearestPointByPosition(
     const double x, const double y) const {
   CHECK_GT(trajectory_points_.size(), 0);
 
-  double d_min = PointDistanceSquare(trajectory_points_.front(), x, y);
-  size_t index_min = 0;
+  return trajectory_points_[QueryNearestIndexByPosition(x, y)];
+}
 
-  for (size_t i = 1; i < trajectory_points_.size(); ++i) {
-    double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
+size_t TrajectoryAnalyzer::QueryNearestIndexByPosition(const double x,
+                                                       const double y) const {
+  const size_t num_points = trajectory_points_.size();
+  if (query_cursor_ >= num_points) {
+    query_cursor_ = 0;
+  }
+  const size_t start = query_cursor_ > kQueryBackwardIndexWindow
+                           ? query_cursor_ - kQueryBackwardIndexWindow
+                           : 0;
+  size_t index_min = start;
+  double d_min = PointDistanceSquare(trajectory_points_[start], x, y);
+  size_t num_rising = 0;
+  for (size_t i = start + 1; i < num_points; ++i) {
+    const double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
     if (d_temp < d_min) {
       d_min = d_temp;
       index_min = i;
+      num_rising = 0;
+    } else if (++num_rising > kQueryForwardRisingLimit) {
+      break;
+    }
+  }
+  // The forward walk only brackets a minimum when the query is at or ahead
+  // of the cursor. A best match stuck on the window's backward edge means
+  // the query moved against the cursor (e.g. the vehicle query following a
+  // cycle's preview queries); walk backward until the distance rises again.
+  if (index_min == start && start > 0) {
+    num_rising = 0;
+    for (size_t i = start; i-- > 0;) {
+      const double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
+      if (d_temp < d_min) {
+        d_min = d_temp;
+        index_min = i;
+        num_rising = 0;
+      } else if (++num_rising > kQueryForwardRisingLimit) {
+        break;
+      }
     }
   }
-  return trajectory_points_[index_min];
+  query_cursor_ = index_min;
+  return index_min;
 }
 
 const std::vector<TrajectoryPoint> &TrajectoryAnalyzer::trajectory_points()
@@ -83,7 +83,10 @@ class TrajectoryAnalyzer {
 
   /**
    * @brief query a point of trajectery that its position is closest
-   * to the given position.
+   * to the given position. The query keeps a monotone cursor on the
+   * trajectory: since the match point only moves forward between control
+   * cycles, the scan restarts from the last match instead of the first
+   * point, with amortized O(1) cost per cycle.
    * @param x value of x-coordination in the given position
    * @param y value of y-coordination in the given position
    * @return a point of trajectory
@@ -130,8 +133,19 @@ class TrajectoryAnalyzer {
                                          const common::TrajectoryPoint &p1,
                                          const double x, const double y) const;
 
+  /**
+   * @brief find the index of the trajectory point closest to the given
+   * position, walking forward from the cursor of the previous query and
+   * falling back to a full scan when the walk does not bracket a minimum
+   */
+  size_t QueryNearestIndexByPosition(const double x, const double y) const;
+
   std::vector<common::TrajectoryPoint> trajectory_points_;
 
+  // index of the last position-query match; the match point only moves
+  // forward along the trajectory as the vehicle advances
+  mutable size_t query_cursor_ = 0;
+
   double header_time_ = 0.0;
   unsigned int seq_num_ = 0;
 };
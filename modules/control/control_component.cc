@@ -21,6 +21,7 @@
 #include "modules/common/time/time.h"
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
 #include "modules/control/common/control_gflags.h"
+#include "modules/planning/common/trajectory/trajectory_delta.h"
 
 namespace apollo {
 namespace control {
@@ -32,9 +33,16 @@ using apollo::common::VehicleStateProvider;
 using apollo::common::time::Clock;
 using apollo::localization::LocalizationEstimate;
 using apollo::planning::ADCTrajectory;
+using apollo::planning::ADCTrajectoryDelta;
 
 ControlComponent::ControlComponent()
-    : monitor_logger_buffer_(common::monitor::MonitorMessageItem::CONTROL) {}
+    : monitor_logger_buffer_(common::monitor::MonitorMessageItem::CONTROL) {
+  // start from empty snapshots so the input checks see default messages
+  // until the first inputs arrive
+  latest_localization_ = std::make_shared<LocalizationEstimate>();
+  latest_chassis_ = std::make_shared<Chassis>();
+  latest_trajectory_ = std::make_shared<ADCTrajectory>();
+}
 
 bool ControlComponent::Init() {
   // init_time_ = Clock::NowInSeconds();
@@ -71,6 +79,16 @@ bool ControlComponent::Init() {
       node_->CreateReader<ADCTrajectory>(planning_reader_config, nullptr);
   CHECK(trajectory_reader_ != nullptr);
 
+  cyber::ReaderConfig planning_delta_reader_config;
+  planning_delta_reader_config.channel_name =
+      FLAGS_planning_trajectory_delta_topic;
+  planning_delta_reader_config.pending_queue_size =
+      FLAGS_planning_pending_queue_size;
+
+  trajectory_delta_reader_ = node_->CreateReader<ADCTrajectoryDelta>(
+      planning_delta_reader_config, nullptr);
+  CHECK(trajectory_delta_reader_ != nullptr);
+
   cyber::ReaderConfig localization_reader_config;
   localization_reader_config.channel_name = FLAGS_localization_topic;
   localization_reader_config.pending_queue_size =
@@ -124,22 +142,48 @@ void ControlComponent::OnPad(const std::shared_ptr<PadMessage> &pad) {
 
 void ControlComponent::OnChassis(const std::shared_ptr<Chassis> &chassis) {
   ADEBUG << "Received chassis data: run chassis callback.";
-  std::lock_guard<std::mutex> lock(mutex_);
-  latest_chassis_.CopyFrom(*chassis);
+  std::atomic_store(&latest_chassis_,
+                    std::shared_ptr<const Chassis>(chassis));
 }
 
 void ControlComponent::OnPlanning(
     const std::shared_ptr<ADCTrajectory> &trajectory) {
   ADEBUG << "Received chassis data: run trajectory callback.";
-  std::lock_guard<std::mutex> lock(mutex_);
-  latest_trajectory_.CopyFrom(*trajectory);
+  // A full publication that is older than what we hold (e.g. a trajectory
+  // already rebuilt from a newer delta) must not roll the snapshot back.
+  const auto current = std::atomic_load(&latest_trajectory_);
+  if (current != nullptr && current->header().timestamp_sec() >=
+                                trajectory->header().timestamp_sec()) {
+    return;
+  }
+  std::atomic_store(&latest_trajectory_,
+                    std::shared_ptr<const ADCTrajectory>(trajectory));
+}
+
+void ControlComponent::OnPlanningDelta(
+    const std::shared_ptr<ADCTrajectoryDelta> &delta) {
+  const auto base = std::atomic_load(&latest_trajectory_);
+  if (base == nullptr || delta->header().timestamp_sec() <=
+                             base->header().timestamp_sec()) {
+    return;
+  }
+  auto rebuilt = std::make_shared<ADCTrajectory>();
+  if (!planning::TrajectoryDelta::Decode(*base, *delta, rebuilt.get())) {
+    // We missed the cycle this delta is based on; keep the last trajectory
+    // until planning publishes the next full one.
+    AWARN << "Failed to apply trajectory delta with sequence "
+          << delta->header().sequence_num();
+    return;
+  }
+  std::atomic_store(&latest_trajectory_,
+                    std::shared_ptr<const ADCTrajectory>(rebuilt));
 }
 
 void ControlComponent::OnLocalization(
     const std::shared_ptr<LocalizationEstimate> &localization) {
   ADEBUG << "Received control data: run localization message callback.";
-  std::lock_guard<std::mutex> lock(mutex_);
-  latest_localization_.CopyFrom(*localization);
+  std::atomic_store(&latest_localization_,
+                    std::shared_ptr<const LocalizationEstimate>(localization));
 }
 
 void ControlComponent::OnMonitor(
@@ -154,11 +198,18 @@ void ControlComponent::OnMonitor(
 
 Status ControlComponent::ProduceControlCommand(
     ControlCommand *control_command) {
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    local_view_.chassis = latest_chassis_;
-    local_view_.trajectory = latest_trajectory_;
-    local_view_.localization = latest_localization_;
+  // snapshot the latest inputs with pointer swaps; the trajectory alone
+  // is deep-copied, and only when planning has published a new message,
+  // because CheckInput clamps small speeds in place
+  local_view_.chassis = std::atomic_load(&latest_chassis_);
+  local_view_.localization = std::atomic_load(&latest_localization_);
+  const auto trajectory = std::atomic_load(&latest_trajectory_);
+  if (trajectory != copied_trajectory_) {
+    if (local_view_.trajectory == nullptr) {
+      local_view_.trajectory = std::make_shared<ADCTrajectory>();
+    }
+    local_view_.trajectory->CopyFrom(*trajectory);
+    copied_trajectory_ = trajectory;
   }
 
   Status status = CheckInput(&local_view_);
@@ -179,7 +230,7 @@ Status ControlComponent::ProduceControlCommand(
       AERROR << "Input messages timeout";
       // estop_ = true;
       status = status_ts;
-      if (local_view_.chassis.driving_mode() !=
+      if (local_view_.chassis->driving_mode() !=
           apollo::canbus::Chassis::COMPLETE_AUTO_DRIVE) {
         control_command->mutable_engage_advice()->set_advice(
             apollo::common::EngageAdvice::DISALLOW_ENGAGE);
@@ -194,38 +245,38 @@ Status ControlComponent::ProduceControlCommand(
 
   // check estop
   estop_ = control_conf_.enable_persistent_estop()
-               ? estop_ || local_view_.trajectory.estop().is_estop()
-               : local_view_.trajectory.estop().is_estop();
+               ? estop_ || local_view_.trajectory->estop().is_estop()
+               : local_view_.trajectory->estop().is_estop();
 
-  if (local_view_.trajectory.estop().is_estop()) {
+  if (local_view_.trajectory->estop().is_estop()) {
     estop_ = true;
     estop_reason_ = "estop from planning : ";
-    estop_reason_ += local_view_.trajectory.estop().reason();
+    estop_reason_ += local_view_.trajectory->estop().reason();
   }
 
-  if (local_view_.trajectory.trajectory_point_size() == 0) {
+  if (local_view_.trajectory->trajectory_point_size() == 0) {
     AWARN_EVERY(100) << "planning has no trajectory point. ";
     estop_ = true;
     estop_reason_ = "estop for empty planning trajectory, planning headers: " +
-                    local_view_.trajectory.header().ShortDebugString();
+                    local_view_.trajectory->header().ShortDebugString();
   }
 
   if (!estop_) {
-    if (local_view_.chassis.driving_mode() == Chassis::COMPLETE_MANUAL) {
+    if (local_view_.chassis->driving_mode() == Chassis::COMPLETE_MANUAL) {
       controller_agent_.Reset();
       AINFO_EVERY(100) << "Reset Controllers in Manual Mode";
     }
 
     auto debug = control_command->mutable_debug()->mutable_input_debug();
     debug->mutable_localization_header()->CopyFrom(
-        local_view_.localization.header());
-    debug->mutable_canbus_header()->CopyFrom(local_view_.chassis.header());
+        local_view_.localization->header());
+    debug->mutable_canbus_header()->CopyFrom(local_view_.chassis->header());
     debug->mutable_trajectory_header()->CopyFrom(
-        local_view_.trajectory.header());
+        local_view_.trajectory->header());
 
-    if (local_view_.trajectory.is_replan()) {
+    if (local_view_.trajectory->is_replan()) {
       latest_replan_trajectory_header_.CopyFrom(
-          local_view_.trajectory.header());
+          local_view_.trajectory->header());
     }
 
     if (latest_replan_trajectory_header_.has_sequence_num()) {
@@ -234,16 +285,16 @@ Status ControlComponent::ProduceControlCommand(
     }
 
     Status status_compute = controller_agent_.ComputeControlCommand(
-        &local_view_.localization, &local_view_.chassis,
-        &local_view_.trajectory, control_command);
+        local_view_.localization.get(), local_view_.chassis.get(),
+        local_view_.trajectory.get(), control_command);
 
     if (!status_compute.ok()) {
       AERROR << "Control main function failed"
              << " with localization: "
-             << local_view_.localization.ShortDebugString()
-             << " with chassis: " << local_view_.chassis.ShortDebugString()
+             << local_view_.localization->ShortDebugString()
+             << " with chassis: " << local_view_.chassis->ShortDebugString()
              << " with trajectory: "
-             << local_view_.trajectory.ShortDebugString()
+             << local_view_.trajectory->ShortDebugString()
              << " with cmd: " << control_command->ShortDebugString()
              << " status:" << status_compute.error_message();
       estop_ = true;
@@ -261,9 +312,9 @@ Status ControlComponent::ProduceControlCommand(
     control_command->set_gear_location(Chassis::GEAR_DRIVE);
   }
   // check signal
-  if (local_view_.trajectory.decision().has_vehicle_signal()) {
+  if (local_view_.trajectory->decision().has_vehicle_signal()) {
     control_command->mutable_signal()->CopyFrom(
-        local_view_.trajectory.decision().vehicle_signal());
+        local_view_.trajectory->decision().vehicle_signal());
   }
   return status;
 }
@@ -288,6 +339,13 @@ bool ControlComponent::Proc() {
   }
   OnPlanning(trajectory_msg);
 
+  trajectory_delta_reader_->Observe();
+  const auto &trajectory_delta_msg =
+      trajectory_delta_reader_->GetLatestObserved();
+  if (trajectory_delta_msg != nullptr) {
+    OnPlanningDelta(trajectory_delta_msg);
+  }
+
   localization_reader_->Observe();
   const auto &localization_msg = localization_reader_->GetLatestObserved();
   if (localization_msg == nullptr) {
@@ -336,11 +394,11 @@ bool ControlComponent::Proc() {
 
   // set header
   control_command.mutable_header()->set_lidar_timestamp(
-      local_view_.trajectory.header().lidar_timestamp());
+      local_view_.trajectory->header().lidar_timestamp());
   control_command.mutable_header()->set_camera_timestamp(
-      local_view_.trajectory.header().camera_timestamp());
+      local_view_.trajectory->header().camera_timestamp());
   control_command.mutable_header()->set_radar_timestamp(
-      local_view_.trajectory.header().radar_timestamp());
+      local_view_.trajectory->header().radar_timestamp());
 
   common::util::FillHeader(node_->Name(), &control_command);
 
@@ -357,19 +415,19 @@ bool ControlComponent::Proc() {
 
 Status ControlComponent::CheckInput(LocalView *local_view) {
   ADEBUG << "Received localization:"
-         << local_view->localization.ShortDebugString();
-  ADEBUG << "Received chassis:" << local_view->chassis.ShortDebugString();
+         << local_view->localization->ShortDebugString();
+  ADEBUG << "Received chassis:" << local_view->chassis->ShortDebugString();
 
-  if (!local_view->trajectory.estop().is_estop() &&
-      local_view->trajectory.trajectory_point_size() == 0) {
+  if (!local_view->trajectory->estop().is_estop() &&
+      local_view->trajectory->trajectory_point_size() == 0) {
     AWARN_EVERY(100) << "planning has no trajectory point. ";
     std::string msg("planning has no trajectory point. planning_seq_num:");
-    msg += std::to_string(local_view->trajectory.header().sequence_num());
+    msg += std::to_string(local_view->trajectory->header().sequence_num());
     return Status(ErrorCode::CONTROL_COMPUTE_ERROR, msg);
   }
 
   for (auto &trajectory_point :
-       *local_view->trajectory.mutable_trajectory_point()) {
+       *local_view->trajectory->mutable_trajectory_point()) {
     if (std::abs(trajectory_point.v()) <
         control_conf_.minimum_speed_resolution()) {
       trajectory_point.set_v(0.0);
@@ -377,8 +435,8 @@ Status ControlComponent::CheckInput(LocalView *local_view) {
     }
   }
 
-  VehicleStateProvider::Instance()->Update(local_view->localization,
-                                           local_view->chassis);
+  VehicleStateProvider::Instance()->Update(*local_view->localization,
+                                           *local_view->chassis);
 
   return Status::OK();
 }
@@ -391,7 +449,7 @@ Status ControlComponent::CheckTimestamp(const LocalView &local_view) {
   }
   double current_timestamp = Clock::NowInSeconds();
   double localization_diff =
-      current_timestamp - local_view.localization.header().timestamp_sec();
+      current_timestamp - local_view.localization->header().timestamp_sec();
   if (localization_diff > (control_conf_.max_localization_miss_num() *
                            control_conf_.localization_period())) {
     AERROR << "Localization msg lost for " << std::setprecision(6)
@@ -401,7 +459,7 @@ Status ControlComponent::CheckTimestamp(const LocalView &local_view) {
   }
 
   double chassis_diff =
-      current_timestamp - local_view.chassis.header().timestamp_sec();
+      current_timestamp - local_view.chassis->header().timestamp_sec();
   if (chassis_diff >
       (control_conf_.max_chassis_miss_num() * control_conf_.chassis_period())) {
     AERROR << "Chassis msg lost for " << std::setprecision(6) << chassis_diff
@@ -411,7 +469,7 @@ Status ControlComponent::CheckTimestamp(const LocalView &local_view) {
   }
 
   double trajectory_diff =
-      current_timestamp - local_view.trajectory.header().timestamp_sec();
+      current_timestamp - local_view.trajectory->header().timestamp_sec();
   if (trajectory_diff > (control_conf_.max_planning_miss_num() *
                          control_conf_.trajectory_period())) {
     AERROR << "Trajectory msg lost for " << std::setprecision(6)
@@ -29,6 +29,7 @@
 #include "modules/control/proto/pad_msg.pb.h"
 #include "modules/localization/proto/localization.pb.h"
 #include "modules/planning/proto/planning.pb.h"
+#include "modules/planning/proto/trajectory_delta.pb.h"
 
 #include "modules/common/util/util.h"
 #include "modules/control/controller/controller_agent.h"
@@ -58,9 +59,9 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
   bool Proc() override;
 
   struct LocalView {
-    canbus::Chassis chassis;
-    planning::ADCTrajectory trajectory;
-    localization::LocalizationEstimate localization;
+    std::shared_ptr<const canbus::Chassis> chassis;
+    std::shared_ptr<planning::ADCTrajectory> trajectory;
+    std::shared_ptr<const localization::LocalizationEstimate> localization;
   };
 
  private:
@@ -72,6 +73,11 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
   void OnPlanning(
       const std::shared_ptr<apollo::planning::ADCTrajectory> &trajectory);
 
+  // Upon receiving a differential trajectory; rebuilds the full trajectory
+  // against the latest one and stores it like OnPlanning does
+  void OnPlanningDelta(
+      const std::shared_ptr<apollo::planning::ADCTrajectoryDelta> &delta);
+
   void OnLocalization(
       const std::shared_ptr<apollo::localization::LocalizationEstimate>
           &localization);
@@ -89,9 +95,15 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
  private:
   double init_time_ = 0.0;
 
-  localization::LocalizationEstimate latest_localization_;
-  canbus::Chassis latest_chassis_;
-  planning::ADCTrajectory latest_trajectory_;
+  // latest input snapshots, published by the message callbacks with
+  // atomic pointer swaps so the control cycle never contends with them
+  std::shared_ptr<const localization::LocalizationEstimate>
+      latest_localization_;
+  std::shared_ptr<const canbus::Chassis> latest_chassis_;
+  std::shared_ptr<const planning::ADCTrajectory> latest_trajectory_;
+  // source message the mutable trajectory in local_view_ was copied from;
+  // the copy is refreshed only when planning publishes a new trajectory
+  std::shared_ptr<const planning::ADCTrajectory> copied_trajectory_;
   PadMessage pad_msg_;
   common::Header latest_replan_trajectory_header_;
 
@@ -108,13 +120,13 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
 
   ControlConf control_conf_;
 
-  std::mutex mutex_;
-
   std::shared_ptr<Reader<apollo::canbus::Chassis>> chassis_reader_;
   std::shared_ptr<Reader<apollo::control::PadMessage>> pad_msg_reader_;
   std::shared_ptr<Reader<apollo::localization::LocalizationEstimate>>
       localization_reader_;
   std::shared_ptr<Reader<apollo::planning::ADCTrajectory>> trajectory_reader_;
+  std::shared_ptr<Reader<apollo::planning::ADCTrajectoryDelta>>
+      trajectory_delta_reader_;
   std::shared_ptr<Writer<apollo::control::ControlCommand>> control_cmd_writer_;
   common::monitor::MonitorLogBuffer monitor_logger_buffer_;
 
@@ -241,6 +241,10 @@ Status LatController::Init(const ControlConf *control_conf) {
     leadlag_controller_.Init(lat_controller_conf.reverse_leadlag_conf(), ts_);
   }
 
+  if (FLAGS_enable_lqr_gain_table) {
+    BuildLqrGainTable();
+  }
+
   return Status::OK();
 }
 
@@ -285,10 +289,9 @@ Status LatController::ComputeControlCommand(
     ControlCommand *cmd) {
   auto vehicle_state = VehicleStateProvider::Instance();
 
-  auto target_tracking_trajectory = *planning_published_trajectory;
-
   if (FLAGS_use_navigation_mode &&
       FLAGS_enable_navigation_mode_position_update) {
+    auto target_tracking_trajectory = *planning_published_trajectory;
     auto time_stamp_diff =
         planning_published_trajectory->header().timestamp_sec() -
         current_trajectory_timestamp_;
@@ -350,11 +353,17 @@ Status LatController::ComputeControlCommand(
             p.mutable_path_point()->set_theta(theta_new);
           });
     }
+    trajectory_analyzer_ =
+        std::move(TrajectoryAnalyzer(&target_tracking_trajectory));
+  } else if (trajectory_analyzer_.trajectory_points().empty() ||
+             trajectory_analyzer_.seq_num() !=
+                 planning_published_trajectory->header().sequence_num()) {
+    // Reuse the analyzer, and its forward query cursor, across the control
+    // cycles that track one planning trajectory.
+    trajectory_analyzer_ =
+        std::move(TrajectoryAnalyzer(planning_published_trajectory));
   }
 
-  trajectory_analyzer_ =
-      std::move(TrajectoryAnalyzer(&target_tracking_trajectory));
-
   UpdateDrivingOrientation();
 
   SimpleLateralDebug *debug = cmd->mutable_debug()->mutable_simple_lat_debug();
@@ -385,21 +394,34 @@ Status LatController::ComputeControlCommand(
     }
   }
 
+  // Look the gain up in the precomputed table when the operating point is
+  // covered; the table is solved for forward driving only, so reverse gear
+  // and speeds outside the envelope fall back to the online solver
+  bool gain_from_table = false;
+  if (FLAGS_enable_lqr_gain_table &&
+      VehicleStateProvider::Instance()->gear() !=
+          canbus::Chassis::GEAR_REVERSE) {
+    gain_from_table =
+        InterpolateGainFromTable(vehicle_state->linear_velocity(), &matrix_k_);
+  }
+
   // Add gain scheduler for higher speed steering
-  if (FLAGS_enable_gain_scheduler) {
-    matrix_q_updated_(0, 0) =
-        matrix_q_(0, 0) *
-        lat_err_interpolation_->Interpolate(vehicle_state->linear_velocity());
-    matrix_q_updated_(2, 2) =
-        matrix_q_(2, 2) * heading_err_interpolation_->Interpolate(
-                              vehicle_state->linear_velocity());
-    common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q_updated_,
-                                  matrix_r_, lqr_eps_, lqr_max_iteration_,
-                                  &matrix_k_);
-  } else {
-    common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q_,
-                                  matrix_r_, lqr_eps_, lqr_max_iteration_,
-                                  &matrix_k_);
+  if (!gain_from_table) {
+    if (FLAGS_enable_gain_scheduler) {
+      matrix_q_updated_(0, 0) =
+          matrix_q_(0, 0) *
+          lat_err_interpolation_->Interpolate(vehicle_state->linear_velocity());
+      matrix_q_updated_(2, 2) =
+          matrix_q_(2, 2) * heading_err_interpolation_->Interpolate(
+                                vehicle_state->linear_velocity());
+      common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_,
+                                    matrix_q_updated_, matrix_r_, lqr_eps_,
+                                    lqr_max_iteration_, &matrix_k_);
+    } else {
+      common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q_,
+                                    matrix_r_, lqr_eps_, lqr_max_iteration_,
+                                    &matrix_k_);
+    }
   }
 
   // feedback = - K * state
@@ -538,6 +560,10 @@ void LatController::UpdateState(SimpleLateralDebug *debug) {
 void LatController::UpdateMatrix() {
   const double v = std::max(VehicleStateProvider::Instance()->linear_velocity(),
                             minimum_speed_protection_);
+  UpdateMatrixWithSpeed(v);
+}
+
+void LatController::UpdateMatrixWithSpeed(const double v) {
   matrix_a_(1, 1) = matrix_a_coeff_(1, 1) / v;
   matrix_a_(1, 3) = matrix_a_coeff_(1, 3) / v;
   matrix_a_(3, 1) = matrix_a_coeff_(3, 1) / v;
@@ -547,6 +573,67 @@ void LatController::UpdateMatrix() {
                (matrix_i + ts_ * 0.5 * matrix_a_);
 }
 
+void LatController::BuildLqrGainTable() {
+  lqr_gain_table_speed_min_ = minimum_speed_protection_;
+  lqr_gain_table_speed_max_ = FLAGS_lqr_gain_table_max_speed;
+  lqr_gain_table_speed_step_ = FLAGS_lqr_gain_table_speed_step;
+  if (lqr_gain_table_speed_step_ <= 0.0 ||
+      lqr_gain_table_speed_max_ <= lqr_gain_table_speed_min_) {
+    AERROR << "Invalid LQR gain table envelope, fall back to online solving";
+    lqr_gain_table_.clear();
+    return;
+  }
+  const int table_size =
+      static_cast<int>((lqr_gain_table_speed_max_ - lqr_gain_table_speed_min_) /
+                       lqr_gain_table_speed_step_) +
+      2;
+  lqr_gain_table_.clear();
+  lqr_gain_table_.reserve(table_size);
+  for (int i = 0; i < table_size; ++i) {
+    const double v =
+        lqr_gain_table_speed_min_ + i * lqr_gain_table_speed_step_;
+    UpdateMatrixWithSpeed(v);
+    UpdateMatrixCompound();
+    Matrix matrix_k = Matrix::Zero(1, matrix_q_.rows());
+    if (FLAGS_enable_gain_scheduler) {
+      matrix_q_updated_(0, 0) =
+          matrix_q_(0, 0) * lat_err_interpolation_->Interpolate(v);
+      matrix_q_updated_(2, 2) =
+          matrix_q_(2, 2) * heading_err_interpolation_->Interpolate(v);
+      common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_,
+                                    matrix_q_updated_, matrix_r_, lqr_eps_,
+                                    lqr_max_iteration_, &matrix_k);
+    } else {
+      common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q_,
+                                    matrix_r_, lqr_eps_, lqr_max_iteration_,
+                                    &matrix_k);
+    }
+    lqr_gain_table_.push_back(matrix_k);
+  }
+  AINFO << "LQR gain table solved at " << lqr_gain_table_.size()
+        << " speed grid points over [" << lqr_gain_table_speed_min_ << ", "
+        << lqr_gain_table_speed_max_ << "] m/s";
+}
+
+bool LatController::InterpolateGainFromTable(const double v,
+                                             Eigen::MatrixXd *matrix_k) const {
+  if (lqr_gain_table_.empty() || v < lqr_gain_table_speed_min_ ||
+      v > lqr_gain_table_speed_max_) {
+    return false;
+  }
+  const double ratio = (v - lqr_gain_table_speed_min_) /
+                       lqr_gain_table_speed_step_;
+  const int index = static_cast<int>(ratio);
+  if (index + 1 >= static_cast<int>(lqr_gain_table_.size())) {
+    *matrix_k = lqr_gain_table_.back();
+    return true;
+  }
+  const double weight = ratio - index;
+  *matrix_k = (1.0 - weight) * lqr_gain_table_[index] +
+              weight * lqr_gain_table_[index + 1];
+  return true;
+}
+
 void LatController::UpdateMatrixCompound() {
   // Initialize preview matrix
   matrix_adc_.block(0, 0, basic_state_size_, basic_state_size_) = matrix_ad_;
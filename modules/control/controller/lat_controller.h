@@ -24,6 +24,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Eigen/Core"
 
@@ -109,8 +110,20 @@ class LatController : public Controller {
 
   void UpdateMatrix();
 
+  // update the model matrices at a given operating speed
+  void UpdateMatrixWithSpeed(const double v);
+
   void UpdateMatrixCompound();
 
+  // solve the LQR gains over the speed envelope once at init, so the
+  // control cycle can look them up instead of iterating the solver
+  void BuildLqrGainTable();
+
+  // interpolate the precomputed gain at speed v; returns false when the
+  // operating point is outside the table
+  bool InterpolateGainFromTable(const double v, Eigen::MatrixXd *matrix_k)
+      const;
+
   double ComputeFeedForward(double ref_curvature) const;
 
   void ComputeLateralErrors(const double x, const double y, const double theta,
@@ -196,6 +209,13 @@ class LatController : public Controller {
   // parameters for lqr solver; threshold for computation
   double lqr_eps_ = 0.0;
 
+  // gain table solved at init across the forward speed envelope; reverse
+  // gear and speeds outside the envelope fall back to the online solver
+  std::vector<Eigen::MatrixXd> lqr_gain_table_;
+  double lqr_gain_table_speed_min_ = 0.0;
+  double lqr_gain_table_speed_max_ = 0.0;
+  double lqr_gain_table_speed_step_ = 0.0;
+
   common::DigitalFilter digital_filter_;
 
   std::unique_ptr<Interpolation1D> lat_err_interpolation_;
@@ -106,6 +106,16 @@ bool MPCController::LoadControlConf(const ControlConf *control_conf) {
 
   mpc_eps_ = control_conf->mpc_controller_conf().eps();
   mpc_max_iteration_ = control_conf->mpc_controller_conf().max_iteration();
+  mpc_solver_time_budget_ =
+      control_conf->mpc_controller_conf().solver_time_budget_sec();
+  mpc_solver_overrun_threshold_ =
+      control_conf->mpc_controller_conf().solver_overrun_threshold();
+  mpc_min_horizon_ = std::min(
+      horizon_, control_conf->mpc_controller_conf().solver_min_horizon());
+  mpc_active_horizon_ = horizon_;
+  mpc_solver_.reset(new common::math::LinearMpcSolver(
+      mpc_active_horizon_, mpc_eps_, mpc_max_iteration_));
+  mpc_solver_->set_time_limit(mpc_solver_time_budget_);
   throttle_lowerbound_ =
       std::max(vehicle_param_.throttle_deadzone(),
                control_conf->mpc_controller_conf().throttle_minimum_action());
@@ -288,8 +298,14 @@ Status MPCController::ComputeControlCommand(
     const canbus::Chassis *chassis,
     const planning::ADCTrajectory *planning_published_trajectory,
     ControlCommand *cmd) {
-  trajectory_analyzer_ =
-      std::move(TrajectoryAnalyzer(planning_published_trajectory));
+  if (trajectory_analyzer_.trajectory_points().empty() ||
+      trajectory_analyzer_.seq_num() !=
+          planning_published_trajectory->header().sequence_num()) {
+    // Reuse the analyzer, and its forward query cursor, across the control
+    // cycles that track one planning trajectory.
+    trajectory_analyzer_ =
+        std::move(TrajectoryAnalyzer(planning_published_trajectory));
+  }
 
   SimpleMPCDebug *debug = cmd->mutable_debug()->mutable_simple_mpc_debug();
   debug->Clear();
@@ -336,16 +352,16 @@ Status MPCController::ComputeControlCommand(
   debug->add_matrix_r_updated(matrix_r_updated_(1, 1));
 
   Matrix control_matrix = Matrix::Zero(controls_, 1);
-  std::vector<Matrix> control(horizon_, control_matrix);
+  std::vector<Matrix> control(mpc_active_horizon_, control_matrix);
 
   Matrix control_gain_matrix = Matrix::Zero(controls_, basic_state_size_);
-  std::vector<Matrix> control_gain(horizon_, control_gain_matrix);
+  std::vector<Matrix> control_gain(mpc_active_horizon_, control_gain_matrix);
 
   Matrix addition_gain_matrix = Matrix::Zero(controls_, 1);
-  std::vector<Matrix> addition_gain(horizon_, addition_gain_matrix);
+  std::vector<Matrix> addition_gain(mpc_active_horizon_, addition_gain_matrix);
 
   Matrix reference_state = Matrix::Zero(basic_state_size_, 1);
-  std::vector<Matrix> reference(horizon_, reference_state);
+  std::vector<Matrix> reference(mpc_active_horizon_, reference_state);
 
   Matrix lower_bound(controls_, 1);
   lower_bound << -wheel_single_direction_max_degree_, max_deceleration_;
@@ -361,11 +377,10 @@ Status MPCController::ComputeControlCommand(
   double control_gain_truncation_ratio = 0.0;
   double unconstraint_control = 0.0;
   const double v = VehicleStateProvider::Instance()->linear_velocity();
-  if (!common::math::SolveLinearMPC(matrix_ad_, matrix_bd_, matrix_cd_,
-                                    matrix_q_updated_, matrix_r_updated_,
-                                    lower_bound, upper_bound, matrix_state_,
-                                    reference, mpc_eps_, mpc_max_iteration_,
-                                    &control, &control_gain, &addition_gain)) {
+  if (!mpc_solver_->Solve(matrix_ad_, matrix_bd_, matrix_cd_,
+                          matrix_q_updated_, matrix_r_updated_, lower_bound,
+                          upper_bound, matrix_state_, reference, &control,
+                          &control_gain, &addition_gain)) {
     AERROR << "MPC solver failed";
   } else {
     ADEBUG << "MPC problem solved! ";
@@ -403,6 +418,16 @@ Status MPCController::ComputeControlCommand(
   ADEBUG << "MPC core algorithm: calculation time is: "
          << (mpc_end_timestamp - mpc_start_timestamp) * 1000 << " ms.";
 
+  const bool solver_degraded = mpc_solver_->last_solve_degraded();
+  const bool overran =
+      solver_degraded ||
+      (mpc_solver_time_budget_ > 0.0 &&
+       mpc_end_timestamp - mpc_start_timestamp > mpc_solver_time_budget_);
+  debug->set_mpc_solver_degraded(solver_degraded);
+  debug->set_mpc_active_horizon(mpc_active_horizon_);
+  UpdateSolverHorizon(overran);
+  debug->set_mpc_solver_overrun_count(mpc_overrun_count_);
+
   // TODO(QiL): evaluate whether need to add spline smoothing after the result
   double steer_angle = steer_angle_feedback +
                        steer_angle_feedforwardterm_updated_ +
@@ -536,6 +561,36 @@ void MPCController::UpdateState(SimpleMPCDebug *debug) {
   matrix_state_(5, 0) = debug->speed_error();
 }
 
+void MPCController::UpdateSolverHorizon(const bool overran) {
+  if (overran) {
+    ++mpc_overrun_count_;
+    mpc_consecutive_in_budget_solves_ = 0;
+    if (++mpc_consecutive_overruns_ >= mpc_solver_overrun_threshold_ &&
+        mpc_active_horizon_ > mpc_min_horizon_) {
+      mpc_active_horizon_ = std::max(mpc_min_horizon_, mpc_active_horizon_ / 2);
+      AWARN << "MPC solver overran its budget " << mpc_consecutive_overruns_
+            << " cycles in a row; shortening horizon to "
+            << mpc_active_horizon_;
+      mpc_solver_.reset(new common::math::LinearMpcSolver(
+          mpc_active_horizon_, mpc_eps_, mpc_max_iteration_));
+      mpc_solver_->set_time_limit(mpc_solver_time_budget_);
+      mpc_consecutive_overruns_ = 0;
+    }
+    return;
+  }
+  mpc_consecutive_overruns_ = 0;
+  if (mpc_active_horizon_ < horizon_ &&
+      ++mpc_consecutive_in_budget_solves_ >= mpc_solver_overrun_threshold_) {
+    mpc_active_horizon_ = std::min(horizon_, mpc_active_horizon_ * 2);
+    AINFO << "MPC solver back in budget; restoring horizon to "
+          << mpc_active_horizon_;
+    mpc_solver_.reset(new common::math::LinearMpcSolver(
+        mpc_active_horizon_, mpc_eps_, mpc_max_iteration_));
+    mpc_solver_->set_time_limit(mpc_solver_time_budget_);
+    mpc_consecutive_in_budget_solves_ = 0;
+  }
+}
+
 void MPCController::UpdateMatrix(SimpleMPCDebug *debug) {
   const double v = std::max(VehicleStateProvider::Instance()->linear_velocity(),
                             minimum_speed_protection_);
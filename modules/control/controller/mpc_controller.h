@@ -32,6 +32,7 @@
 #include "modules/common/filters/digital_filter.h"
 #include "modules/common/filters/digital_filter_coefficients.h"
 #include "modules/common/filters/mean_filter.h"
+#include "modules/common/math/mpc_solver.h"
 #include "modules/control/common/interpolation_1d.h"
 #include "modules/control/common/interpolation_2d.h"
 #include "modules/control/common/trajectory_analyzer.h"
@@ -106,6 +107,8 @@ class MPCController : public Controller {
 
   void FeedforwardUpdate(SimpleMPCDebug *debug);
 
+  void UpdateSolverHorizon(const bool overran);
+
   void ComputeLateralErrors(const double x, const double y, const double theta,
                             const double linear_v, const double angular_v,
                             const double linear_a,
@@ -229,6 +232,23 @@ class MPCController : public Controller {
   int mpc_max_iteration_ = 0;
   // parameters for mpc solver; threshold for computation
   double mpc_eps_ = 0.0;
+  // time budget for one MPC solve, in seconds; 0 disables the budget
+  double mpc_solver_time_budget_ = 0.0;
+  // consecutive overruns tolerated before the horizon is shortened, and
+  // in-budget solves required before it is restored
+  int mpc_solver_overrun_threshold_ = 5;
+  // smallest horizon the controller may degrade to under repeated overruns
+  int mpc_min_horizon_ = 5;
+  // horizon currently used by the solver; shortened under repeated budget
+  // overruns and restored once the solver is back in budget
+  int mpc_active_horizon_ = 10;
+  int mpc_consecutive_overruns_ = 0;
+  int mpc_consecutive_in_budget_solves_ = 0;
+  // total budget overruns since the controller started, for debug output
+  uint32_t mpc_overrun_count_ = 0;
+  // warm-started mpc solver; kept across control cycles so each solve can
+  // hot start from the previous cycle's active set
+  std::unique_ptr<common::math::LinearMpcSolver> mpc_solver_;
 
   common::DigitalFilter digital_filter_;
 
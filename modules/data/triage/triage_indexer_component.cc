@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/data/triage/triage_indexer_component.h"
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+#include "cyber/time/time.h"
+#include "modules/common/adapters/adapter_gflags.h"
+#include "modules/common/util/string_util.h"
+
+namespace apollo {
+namespace data {
+
+using apollo::canbus::Chassis;
+using apollo::common::util::StrCat;
+using apollo::planning::ADCTrajectory;
+
+namespace {
+
+bool IsAutoMode(Chassis::DrivingMode mode) {
+  return mode == Chassis::COMPLETE_AUTO_DRIVE ||
+         mode == Chassis::AUTO_STEER_ONLY || mode == Chassis::AUTO_SPEED_ONLY;
+}
+
+}  // namespace
+
+bool TriageIndexerComponent::Init() {
+  if (!GetProtoConfig(&triage_conf_)) {
+    AERROR << "Unable to load triage conf file: " << ConfigFilePath();
+    return false;
+  }
+
+  const double start_time = cyber::Time::Now().ToSecond();
+  index_.set_start_time_sec(start_time);
+  index_file_path_ =
+      StrCat(triage_conf_.index_output_dir(), "/triage_index_",
+             static_cast<uint64_t>(start_time), ".pb.txt");
+  AINFO << "Triage index will be written to " << index_file_path_;
+
+  chassis_reader_ = node_->CreateReader<Chassis>(
+      FLAGS_chassis_topic, [this](const std::shared_ptr<Chassis>& chassis) {
+        OnChassis(chassis);
+      });
+
+  planning_reader_ = node_->CreateReader<ADCTrajectory>(
+      FLAGS_planning_trajectory_topic,
+      [this](const std::shared_ptr<ADCTrajectory>& trajectory) {
+        OnPlanning(trajectory);
+      });
+
+  return true;
+}
+
+void TriageIndexerComponent::OnChassis(
+    const std::shared_ptr<Chassis>& chassis) {
+  const double timestamp_sec = chassis->header().timestamp_sec();
+
+  const Chassis::DrivingMode mode = chassis->driving_mode();
+  if (IsAutoMode(last_driving_mode_) && !IsAutoMode(mode)) {
+    AddEvent(TriageEvent::DISENGAGEMENT, timestamp_sec, FLAGS_chassis_topic,
+             StrCat("driving mode ",
+                    Chassis::DrivingMode_Name(last_driving_mode_), " -> ",
+                    Chassis::DrivingMode_Name(mode)));
+  }
+  last_driving_mode_ = mode;
+
+  const bool hard_brake =
+      chassis->has_brake_percentage() &&
+      chassis->brake_percentage() >= triage_conf_.hard_brake_percentage();
+  if (hard_brake && !last_hard_brake_) {
+    AddEvent(TriageEvent::HARD_BRAKE, timestamp_sec, FLAGS_chassis_topic,
+             StrCat("brake percentage ", chassis->brake_percentage()));
+  }
+  last_hard_brake_ = hard_brake;
+}
+
+void TriageIndexerComponent::OnPlanning(
+    const std::shared_ptr<ADCTrajectory>& trajectory) {
+  const double timestamp_sec = trajectory->header().timestamp_sec();
+
+  const bool estop =
+      trajectory->has_estop() && trajectory->estop().is_estop();
+  if (estop && !last_estop_) {
+    AddEvent(TriageEvent::ESTOP, timestamp_sec,
+             FLAGS_planning_trajectory_topic, trajectory->estop().reason());
+  }
+  last_estop_ = estop;
+
+  if (trajectory->is_replan()) {
+    AddEvent(TriageEvent::REPLAN, timestamp_sec,
+             FLAGS_planning_trajectory_topic,
+             trajectory->replan_reason());
+  }
+}
+
+void TriageIndexerComponent::AddEvent(TriageEvent::Type type,
+                                      double timestamp_sec,
+                                      const std::string& channel,
+                                      const std::string& description) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = last_event_time_.find(type);
+  if (it != last_event_time_.end() &&
+      timestamp_sec - it->second < triage_conf_.event_debounce_sec()) {
+    return;
+  }
+  last_event_time_[type] = timestamp_sec;
+
+  auto* event = index_.add_event();
+  event->set_type(type);
+  event->set_timestamp_sec(timestamp_sec);
+  event->set_channel(channel);
+  event->set_description(description);
+  index_dirty_ = true;
+  AINFO << "Triage event " << TriageEvent::Type_Name(type) << " at "
+        << timestamp_sec << ": " << description;
+}
+
+bool TriageIndexerComponent::Proc() {
+  TriageIndex snapshot;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!index_dirty_) {
+      return true;
+    }
+    snapshot.CopyFrom(index_);
+    index_dirty_ = false;
+  }
+  if (!cyber::common::SetProtoToASCIIFile(snapshot, index_file_path_)) {
+    AERROR << "Failed to write triage index to " << index_file_path_;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace data
+}  // namespace apollo
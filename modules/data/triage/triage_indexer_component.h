@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "cyber/component/timer_component.h"
+#include "cyber/cyber.h"
+
+#include "modules/canbus/proto/chassis.pb.h"
+#include "modules/data/proto/triage_conf.pb.h"
+#include "modules/data/proto/triage_index.pb.h"
+#include "modules/planning/proto/planning.pb.h"
+
+/**
+ * @namespace apollo::data
+ * @brief apollo::data
+ */
+namespace apollo {
+namespace data {
+
+/**
+ * @class TriageIndexerComponent
+ * @brief Watches the chassis and planning channels while a record is
+ * being written and keeps a compact index of events of interest (hard
+ * brakes, disengagements, estops, replans) next to the records, so the
+ * offline pipeline can seek straight to them instead of scanning full
+ * records.
+ */
+class TriageIndexerComponent : public apollo::cyber::TimerComponent {
+ public:
+  bool Init() override;
+  bool Proc() override;
+
+ private:
+  void OnChassis(const std::shared_ptr<apollo::canbus::Chassis>& chassis);
+  void OnPlanning(
+      const std::shared_ptr<apollo::planning::ADCTrajectory>& trajectory);
+
+  // appends one event, dropping it when the previous event of the same
+  // type is closer than the debounce window
+  void AddEvent(TriageEvent::Type type, double timestamp_sec,
+                const std::string& channel, const std::string& description);
+
+  TriageConf triage_conf_;
+
+  std::shared_ptr<apollo::cyber::Reader<apollo::canbus::Chassis>>
+      chassis_reader_;
+  std::shared_ptr<apollo::cyber::Reader<apollo::planning::ADCTrajectory>>
+      planning_reader_;
+
+  // edge detection state, only touched from the reader callbacks
+  apollo::canbus::Chassis::DrivingMode last_driving_mode_ =
+      apollo::canbus::Chassis::COMPLETE_MANUAL;
+  bool last_hard_brake_ = false;
+  bool last_estop_ = false;
+
+  std::mutex mutex_;
+  TriageIndex index_;
+  std::map<int, double> last_event_time_;
+  bool index_dirty_ = false;
+  std::string index_file_path_;
+};
+
+CYBER_REGISTER_COMPONENT(TriageIndexerComponent)
+
+}  // namespace data
+}  // namespace apollo
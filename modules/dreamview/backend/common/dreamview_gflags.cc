@@ -58,6 +58,11 @@ DEFINE_double(sim_map_radius, 200.0,
               "The radius within which Dreamview will find all the map "
               "elements around the car.");
 
+DEFINE_int32(sim_world_keyframe_interval, 10,
+             "Number of consecutive update cycles without any new message "
+             "that may be skipped before a full keyframe update of the "
+             "simulation world is forced.");
+
 DEFINE_bool(enable_update_size_check, true,
             "True to check if the update byte number is less than threshold");
 
@@ -76,6 +81,19 @@ DEFINE_double(voxel_filter_size, 0.3, "VoxelGrid pointcloud filter leaf size");
 DEFINE_double(voxel_filter_height, 0.2,
               "VoxelGrid pointcloud filter leaf height");
 
+DEFINE_bool(sim_control_fixed_step_mode, false,
+            "Drive SimControl with a deterministic fixed time step instead "
+            "of wall-clock timers. The caller steps the simulation through "
+            "RunOnce(), each call advancing the mock clock by "
+            "sim_control_fixed_step_sec.");
+
+DEFINE_double(sim_control_fixed_step_sec, 0.01,
+              "Simulated time added per SimControl step in fixed-step mode.");
+
+DEFINE_bool(enable_hash_voxel_filter, false,
+            "Use the single-pass hash grid filter instead of pcl::VoxelGrid "
+            "when downsampling point clouds for the frontend.");
+
 DEFINE_double(system_status_lifetime_seconds, 30,
               "Lifetime of a valid SystemStatus message. It's more like a "
               "replay message if the timestamp is old, where we should ignore "
@@ -38,6 +38,8 @@ DECLARE_string(ssl_certificate);
 
 DECLARE_double(sim_map_radius);
 
+DECLARE_int32(sim_world_keyframe_interval);
+
 DECLARE_int32(dreamview_worker_num);
 
 DECLARE_bool(enable_update_size_check);
@@ -52,6 +54,12 @@ DECLARE_double(voxel_filter_size);
 
 DECLARE_double(voxel_filter_height);
 
+DECLARE_bool(sim_control_fixed_step_mode);
+
+DECLARE_double(sim_control_fixed_step_sec);
+
+DECLARE_bool(enable_hash_voxel_filter);
+
 DECLARE_double(system_status_lifetime_seconds);
 
 DECLARE_string(lidar_height_yaml);
@@ -21,6 +21,7 @@
 #include <utility>
 
 #include "modules/common/util/json_util.h"
+#include "modules/common/util/points_downsampler.h"
 #include "modules/common/util/string_util.h"
 #include "modules/map/hdmap/hdmap_util.h"
 
@@ -79,6 +80,29 @@ void ExtractRoadAndLaneIds(const std::vector<LaneInfoConstPtr> &lanes,
   std::sort(road_ids->begin(), road_ids->end());
 }
 
+// Thins out line segment points whose accumulated heading change stays
+// below angle_threshold (radian).
+void DownsampleCurve(apollo::hdmap::Curve *curve,
+                     const double angle_threshold) {
+  for (auto &segment : *curve->mutable_segment()) {
+    if (!segment.has_line_segment()) {
+      continue;
+    }
+    auto *line_segment = segment.mutable_line_segment();
+    const auto sampled_indices = apollo::common::util::DownsampleByAngle(
+        line_segment->point(), angle_threshold);
+    if (sampled_indices.size() >=
+        static_cast<size_t>(line_segment->point_size())) {
+      continue;
+    }
+    RepeatedPtrField<PointENU> sampled_points;
+    for (const size_t index : sampled_indices) {
+      *sampled_points.Add() = line_segment->point(static_cast<int>(index));
+    }
+    line_segment->mutable_point()->Swap(&sampled_points);
+  }
+}
+
 }  // namespace
 
 const char MapService::kMetaFileName[] = "/metaInfo.json";
@@ -224,7 +248,8 @@ void MapService::CollectMapElementIds(const PointENU &point, double radius,
   ExtractIds(yield_signs, ids->mutable_yield());
 }
 
-Map MapService::RetrieveMapElements(const MapElementIds &ids) const {
+Map MapService::RetrieveMapElements(
+    const MapElementIds &ids, const double simplify_angle_threshold) const {
   boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
 
   Map result;
@@ -242,6 +267,14 @@ Map MapService::RetrieveMapElements(const MapElementIds &ids) const {
       lane.clear_right_sample();
       lane.clear_left_road_sample();
       lane.clear_right_road_sample();
+      if (simplify_angle_threshold > 0.0) {
+        DownsampleCurve(lane.mutable_central_curve(),
+                        simplify_angle_threshold);
+        DownsampleCurve(lane.mutable_left_boundary()->mutable_curve(),
+                        simplify_angle_threshold);
+        DownsampleCurve(lane.mutable_right_boundary()->mutable_curve(),
+                        simplify_angle_threshold);
+      }
       *result.add_lane() = lane;
     }
   }
@@ -298,7 +331,17 @@ Map MapService::RetrieveMapElements(const MapElementIds &ids) const {
     map_id.set_id(id);
     auto element = SimMap()->GetRoadById(map_id);
     if (element) {
-      *result.add_road() = element->road();
+      auto *road = result.add_road();
+      *road = element->road();
+      if (simplify_angle_threshold > 0.0) {
+        for (auto &section : *road->mutable_section()) {
+          for (auto &edge : *section.mutable_boundary()
+                                 ->mutable_outer_polygon()
+                                 ->mutable_edge()) {
+            DownsampleCurve(edge.mutable_curve(), simplify_angle_threshold);
+          }
+        }
+      }
     }
   }
 
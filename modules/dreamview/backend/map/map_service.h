@@ -52,8 +52,11 @@ class MapService {
 
   // The returned value is of a hdmap::Map proto. This
   // makes it easy to convert to a JSON object and to send to the
-  // javascript clients.
-  hdmap::Map RetrieveMapElements(const MapElementIds &ids) const;
+  // javascript clients. When simplify_angle_threshold is positive, lane
+  // and road boundary curves are downsampled by accumulated heading
+  // change, shipping lighter geometry for zoomed-out views.
+  hdmap::Map RetrieveMapElements(const MapElementIds &ids,
+                                 double simplify_angle_threshold = -1.0) const;
 
   bool GetPoseWithRegardToLane(const double x, const double y, double *theta,
                                double *s) const;
@@ -16,6 +16,9 @@
 
 #include "modules/dreamview/backend/point_cloud/point_cloud_updater.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <unordered_set>
 #include <utility>
 
 #include "cyber/common/file.h"
@@ -34,6 +37,75 @@ namespace dreamview {
 using apollo::localization::LocalizationEstimate;
 using Json = nlohmann::json;
 
+namespace {
+
+// Single-pass voxel downsample: keeps the first point falling into each
+// voxel. Unlike pcl::VoxelGrid it neither sorts nor computes centroids,
+// which makes it several times cheaper on dense lidar clouds.
+pcl::PointCloud<pcl::PointXYZ>::Ptr HashVoxelFilter(
+    const pcl::PointCloud<pcl::PointXYZ>::Ptr &cloud) {
+  const float leaf_xy = static_cast<float>(FLAGS_voxel_filter_size);
+  const float leaf_z = static_cast<float>(FLAGS_voxel_filter_height);
+  pcl::PointCloud<pcl::PointXYZ>::Ptr filtered(
+      new pcl::PointCloud<pcl::PointXYZ>);
+  filtered->points.reserve(cloud->points.size() / 4);
+  std::unordered_set<uint64_t> occupied;
+  occupied.reserve(cloud->points.size());
+  for (const auto &pt : cloud->points) {
+    if (std::isnan(pt.x) || std::isnan(pt.y) || std::isnan(pt.z)) {
+      continue;
+    }
+    const auto ix = static_cast<int64_t>(std::floor(pt.x / leaf_xy));
+    const auto iy = static_cast<int64_t>(std::floor(pt.y / leaf_xy));
+    const auto iz = static_cast<int64_t>(std::floor(pt.z / leaf_z));
+    const uint64_t key = (static_cast<uint64_t>(ix & 0x1FFFFF) << 42) |
+                         (static_cast<uint64_t>(iy & 0x1FFFFF) << 21) |
+                         static_cast<uint64_t>(iz & 0x1FFFFF);
+    if (occupied.insert(key).second) {
+      filtered->points.push_back(pt);
+    }
+  }
+  filtered->width = static_cast<uint32_t>(filtered->points.size());
+  filtered->height = 1;
+  filtered->is_dense = true;
+  return filtered;
+}
+
+// Builds the quantized variant of the cloud: int16-range offsets from the
+// cloud center, with origin and scale carried in the message so the client
+// can recover meters.
+void QuantizePointCloud(const apollo::dreamview::PointCloud &point_cloud_pb,
+                        apollo::dreamview::PointCloud *quantized_pb) {
+  const int num_size = point_cloud_pb.num_size();
+  if (num_size == 0) {
+    return;
+  }
+  float min_v[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+  float max_v[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+  for (int i = 0; i < num_size; ++i) {
+    const float v = point_cloud_pb.num(i);
+    min_v[i % 3] = std::min(min_v[i % 3], v);
+    max_v[i % 3] = std::max(max_v[i % 3], v);
+  }
+  const float extent = std::max(
+      {max_v[0] - min_v[0], max_v[1] - min_v[1], max_v[2] - min_v[2]});
+  const float scale = std::max(extent / 2.0f / 32767.0f, 1e-3f);
+  const float origin[3] = {(min_v[0] + max_v[0]) / 2.0f,
+                           (min_v[1] + max_v[1]) / 2.0f,
+                           (min_v[2] + max_v[2]) / 2.0f};
+  quantized_pb->set_quantized(true);
+  quantized_pb->set_origin_x(origin[0]);
+  quantized_pb->set_origin_y(origin[1]);
+  quantized_pb->set_origin_z(origin[2]);
+  quantized_pb->set_scale(scale);
+  for (int i = 0; i < num_size; ++i) {
+    quantized_pb->add_qnum(static_cast<int32_t>(
+        std::round((point_cloud_pb.num(i) - origin[i % 3]) / scale)));
+  }
+}
+
+}  // namespace
+
 float PointCloudUpdater::lidar_height_ = kDefaultLidarHeight;
 boost::shared_mutex PointCloudUpdater::mutex_;
 
@@ -84,15 +156,25 @@ void PointCloudUpdater::RegisterMessageHandlers() {
       "RequestPointCloud",
       [this](const Json &json, WebSocketHandler::Connection *conn) {
         std::string to_send;
+        // Clients may negotiate the quantized int16 wire format per
+        // request; everyone else keeps getting float32 triplets.
+        bool quantized = false;
+        const auto quantized_iter = json.find("quantized");
+        if (quantized_iter != json.end() && quantized_iter->is_boolean()) {
+          quantized = *quantized_iter;
+        }
         // If there is no point_cloud data for more than 2 seconds, reset.
         if (point_cloud_str_ != "" &&
             std::fabs(last_localization_time_ - last_point_cloud_time_) > 2.0) {
           boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
           point_cloud_str_ = "";
+          quantized_point_cloud_str_ = "";
         }
         {
           boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
-          to_send = point_cloud_str_;
+          to_send = quantized && !quantized_point_cloud_str_.empty()
+                        ? quantized_point_cloud_str_
+                        : point_cloud_str_;
         }
         websocket_->SendBinaryData(conn, to_send, true);
       });
@@ -176,14 +258,18 @@ void PointCloudUpdater::UpdatePointCloud(
 
 void PointCloudUpdater::FilterPointCloud(
     pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr) {
-  pcl::VoxelGrid<pcl::PointXYZ> voxel_grid;
-  voxel_grid.setInputCloud(pcl_ptr);
-  voxel_grid.setLeafSize(static_cast<float>(FLAGS_voxel_filter_size),
-                         static_cast<float>(FLAGS_voxel_filter_size),
-                         static_cast<float>(FLAGS_voxel_filter_height));
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_filtered_ptr(
-      new pcl::PointCloud<pcl::PointXYZ>);
-  voxel_grid.filter(*pcl_filtered_ptr);
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_filtered_ptr;
+  if (FLAGS_enable_hash_voxel_filter) {
+    pcl_filtered_ptr = HashVoxelFilter(pcl_ptr);
+  } else {
+    pcl::VoxelGrid<pcl::PointXYZ> voxel_grid;
+    voxel_grid.setInputCloud(pcl_ptr);
+    voxel_grid.setLeafSize(static_cast<float>(FLAGS_voxel_filter_size),
+                           static_cast<float>(FLAGS_voxel_filter_size),
+                           static_cast<float>(FLAGS_voxel_filter_height));
+    pcl_filtered_ptr.reset(new pcl::PointCloud<pcl::PointXYZ>);
+    voxel_grid.filter(*pcl_filtered_ptr);
+  }
   AINFO << "filtered point cloud data size: " << pcl_filtered_ptr->size();
 
   float z_offset;
@@ -200,9 +286,12 @@ void PointCloudUpdater::FilterPointCloud(
       point_cloud_pb.add_num(pt.z + z_offset);
     }
   }
+  apollo::dreamview::PointCloud quantized_pb;
+  QuantizePointCloud(point_cloud_pb, &quantized_pb);
   {
     boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
     point_cloud_pb.SerializeToString(&point_cloud_str_);
+    quantized_pb.SerializeToString(&quantized_point_cloud_str_);
     future_ready_ = true;
   }
 }
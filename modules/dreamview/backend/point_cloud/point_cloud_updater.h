@@ -95,6 +95,10 @@ class PointCloudUpdater {
   // The PointCloud to be pushed to frontend.
   std::string point_cloud_str_;
 
+  // Quantized int16 variant of the same cloud, for clients that asked for
+  // it in their RequestPointCloud message.
+  std::string quantized_point_cloud_str_;
+
   std::future<void> async_future_;
   std::atomic<bool> future_ready_;
 
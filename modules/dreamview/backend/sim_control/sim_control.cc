@@ -257,8 +257,20 @@ void SimControl::Start() {
          next_point_.has_a() ? next_point_.a() : 0.0);
 
     InternalReset();
-    sim_control_timer_->Start();
-    sim_prediction_timer_->Start();
+    if (FLAGS_sim_control_fixed_step_mode) {
+      // Fixed-step mode: the scenario harness drives the simulation by
+      // calling RunOnce() in a loop, so no wall-clock timer is started
+      // and every step advances the mock clock by the same amount.
+      if (Clock::mode() != Clock::MOCK) {
+        const double seed_time = Clock::NowInSeconds();
+        Clock::SetMode(Clock::MOCK);
+        Clock::SetNowInSeconds(seed_time);
+      }
+      next_dummy_prediction_time_ = Clock::NowInSeconds();
+    } else {
+      sim_control_timer_->Start();
+      sim_prediction_timer_->Start();
+    }
     enabled_ = true;
   }
 }
@@ -267,8 +279,10 @@ void SimControl::Stop() {
   std::lock_guard<std::mutex> lock(mutex_);
 
   if (enabled_) {
-    sim_control_timer_->Stop();
-    sim_prediction_timer_->Stop();
+    if (!FLAGS_sim_control_fixed_step_mode) {
+      sim_control_timer_->Stop();
+      sim_prediction_timer_->Stop();
+    }
     enabled_ = false;
   }
 }
@@ -300,17 +314,36 @@ void SimControl::Freeze() {
 }
 
 void SimControl::RunOnce() {
-  std::lock_guard<std::mutex> lock(mutex_);
+  bool publish_dummy_prediction = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
 
-  TrajectoryPoint trajectory_point;
-  Chassis::GearPosition gear_position;
-  if (!PerfectControlModel(&trajectory_point, &gear_position)) {
-    AERROR << "Failed to calculate next point with perfect control model";
-    return;
-  }
+    if (FLAGS_sim_control_fixed_step_mode) {
+      // Deterministic timebase: each step advances the mock clock by a
+      // fixed amount, independent of wall time. The dummy prediction is
+      // re-published at its usual period, measured in simulated time.
+      Clock::SetNowInSeconds(Clock::NowInSeconds() +
+                             FLAGS_sim_control_fixed_step_sec);
+      if (Clock::NowInSeconds() >= next_dummy_prediction_time_) {
+        next_dummy_prediction_time_ =
+            Clock::NowInSeconds() + kSimPredictionIntervalMs / 1000.0;
+        publish_dummy_prediction = true;
+      }
+    }
+
+    TrajectoryPoint trajectory_point;
+    Chassis::GearPosition gear_position;
+    if (!PerfectControlModel(&trajectory_point, &gear_position)) {
+      AERROR << "Failed to calculate next point with perfect control model";
+      return;
+    }
 
-  PublishChassis(trajectory_point.v(), gear_position);
-  PublishLocalization(trajectory_point);
+    PublishChassis(trajectory_point.v(), gear_position);
+    PublishLocalization(trajectory_point);
+  }
+  if (publish_dummy_prediction) {
+    PublishDummyPrediction();
+  }
 }
 
 bool SimControl::PerfectControlModel(TrajectoryPoint* point,
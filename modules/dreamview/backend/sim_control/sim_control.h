@@ -182,6 +182,10 @@ class SimControl : SimControlInterface {
   apollo::common::TrajectoryPoint prev_point_;
   apollo::common::TrajectoryPoint next_point_;
 
+  // Next simulated time at which the dummy prediction is re-published in
+  // fixed-step mode.
+  double next_dummy_prediction_time_ = 0.0;
+
   common::PathPoint adc_position_;
 
   // Linearize reader/timer callbacks and external operations.
@@ -34,6 +34,7 @@
 #include "modules/dreamview/backend/common/dreamview_gflags.h"
 #include "modules/dreamview/backend/util/trajectory_point_collector.h"
 #include "modules/dreamview/proto/simulation_world.pb.h"
+#include "modules/planning/common/trajectory/trajectory_delta.h"
 
 namespace apollo {
 namespace dreamview {
@@ -62,6 +63,7 @@ using apollo::perception::PerceptionObstacle;
 using apollo::perception::PerceptionObstacles;
 using apollo::perception::TrafficLightDetection;
 using apollo::planning::ADCTrajectory;
+using apollo::planning::ADCTrajectoryDelta;
 using apollo::planning::DecisionResult;
 using apollo::planning::StopReasonCode;
 using apollo::planning_internal::PlanningData;
@@ -260,6 +262,8 @@ void SimulationWorldService::InitReaders() {
       node_->CreateReader<PredictionObstacles>(FLAGS_prediction_topic);
   planning_reader_ =
       node_->CreateReader<ADCTrajectory>(FLAGS_planning_trajectory_topic);
+  planning_delta_reader_ = node_->CreateReader<ADCTrajectoryDelta>(
+      FLAGS_planning_trajectory_delta_topic);
   control_command_reader_ =
       node_->CreateReader<ControlCommand>(FLAGS_control_command_topic);
   navigation_reader_ =
@@ -319,36 +323,76 @@ void SimulationWorldService::Update() {
     *world_.mutable_auto_driving_car() = car;
 
     route_paths_.clear();
+    processed_msgs_.clear();
+    world_dirty_ = true;
 
     to_clear_ = false;
   }
 
   node_->Observe();
 
+  bool monitor_dirty;
+  {
+    std::unique_lock<std::mutex> lock(monitor_msgs_mutex_);
+    monitor_dirty = !monitor_msgs_.empty();
+  }
+  const bool object_sections_dirty =
+      ReaderHasNewMessage(perception_obstacle_reader_.get()) ||
+      ReaderHasNewMessage(perception_traffic_light_reader_.get()) ||
+      ReaderHasNewMessage(prediction_obstacle_reader_.get()) ||
+      ReaderHasNewMessage(planning_reader_.get()) ||
+      ReaderHasNewMessage(planning_delta_reader_.get()) ||
+      ReaderHasNewMessage(control_command_reader_.get()) ||
+      ReaderHasNewMessage(navigation_reader_.get()) ||
+      ReaderHasNewMessage(relative_map_reader_.get());
+  const bool any_dirty = monitor_dirty || object_sections_dirty ||
+                         ReaderHasNewMessage(routing_response_reader_.get()) ||
+                         ReaderHasNewMessage(chassis_reader_.get()) ||
+                         ReaderHasNewMessage(gps_reader_.get()) ||
+                         ReaderHasNewMessage(localization_reader_.get());
+
+  // Skip cycles where nothing changed, but force a full keyframe update
+  // periodically so delays, latencies and the timestamp keep moving while
+  // all channels are idle.
+  const bool keyframe = !any_dirty;
+  if (keyframe && unchanged_cycles_ < FLAGS_sim_world_keyframe_interval) {
+    ++unchanged_cycles_;
+    return;
+  }
+  unchanged_cycles_ = 0;
+  world_dirty_ = true;
+
   UpdateMonitorMessages();
 
-  UpdateWithLatestObserved(routing_response_reader_.get(), false);
-  UpdateWithLatestObserved(chassis_reader_.get());
-  UpdateWithLatestObserved(gps_reader_.get());
-  UpdateWithLatestObserved(localization_reader_.get());
+  UpdateIfChanged(routing_response_reader_.get(), false);
+  UpdateIfChanged(chassis_reader_.get());
+  UpdateIfChanged(gps_reader_.get());
+  UpdateIfChanged(localization_reader_.get());
 
   // Clear objects received from last frame and populate with the new objects.
+  // The whole block is rebuilt or skipped as one unit: once the old objects
+  // are cleared, every contributing channel has to be folded in again, even
+  // the ones without a new message.
   // TODO(siyangy, unacao): For now we are assembling the simulation_world with
   // latest received perception, prediction and planning message. However, they
   // may not always be perfectly aligned and belong to the same frame.
-  obj_map_.clear();
-  world_.clear_object();
-  UpdateWithLatestObserved(perception_obstacle_reader_.get());
-  UpdateWithLatestObserved(perception_traffic_light_reader_.get(), false);
-  UpdateWithLatestObserved(prediction_obstacle_reader_.get());
-  UpdateWithLatestObserved(planning_reader_.get());
-  UpdateWithLatestObserved(control_command_reader_.get());
-  UpdateWithLatestObserved(navigation_reader_.get(), FLAGS_use_navigation_mode);
-  UpdateWithLatestObserved(relative_map_reader_.get(),
-                           FLAGS_use_navigation_mode);
-
-  for (const auto &kv : obj_map_) {
-    *world_.add_object() = kv.second;
+  if (object_sections_dirty || keyframe) {
+    obj_map_.clear();
+    world_.clear_object();
+    UpdateWithLatestObserved(perception_obstacle_reader_.get());
+    UpdateWithLatestObserved(perception_traffic_light_reader_.get(), false);
+    UpdateWithLatestObserved(prediction_obstacle_reader_.get());
+    UpdateWithLatestObserved(planning_reader_.get());
+    UpdateWithTrajectoryDelta();
+    UpdateWithLatestObserved(control_command_reader_.get());
+    UpdateWithLatestObserved(navigation_reader_.get(),
+                             FLAGS_use_navigation_mode);
+    UpdateWithLatestObserved(relative_map_reader_.get(),
+                             FLAGS_use_navigation_mode);
+
+    for (const auto &kv : obj_map_) {
+      *world_.add_object() = kv.second;
+    }
   }
 
   UpdateDelays();
@@ -384,12 +428,25 @@ void SimulationWorldService::UpdateLatencies() {
 void SimulationWorldService::GetWireFormatString(
     double radius, std::string *sim_world,
     std::string *sim_world_with_planning_data) {
+  // Reuse the cached serialization while the world and the requested map
+  // radius are unchanged.
+  if (!world_dirty_ && radius == cached_wire_radius_) {
+    *sim_world = cached_sim_world_;
+    *sim_world_with_planning_data = cached_sim_world_with_planning_data_;
+    return;
+  }
+
   PopulateMapInfo(radius);
 
   world_.SerializeToString(sim_world_with_planning_data);
 
   world_.clear_planning_data();
   world_.SerializeToString(sim_world);
+
+  cached_sim_world_ = *sim_world;
+  cached_sim_world_with_planning_data_ = *sim_world_with_planning_data;
+  cached_wire_radius_ = radius;
+  world_dirty_ = false;
 }
 
 Json SimulationWorldService::GetUpdateAsJson(double radius) const {
@@ -952,6 +1009,40 @@ void SimulationWorldService::UpdateSimulationWorld(
   (*world_.mutable_latency())["planning"] = latency;
 }
 
+void SimulationWorldService::UpdateWithTrajectoryDelta() {
+  if (planning_delta_reader_->Empty()) {
+    return;
+  }
+  const auto delta = planning_delta_reader_->GetLatestObserved();
+  processed_msgs_[planning_delta_reader_->GetChannelName()] = delta.get();
+
+  // Track the newest full trajectory as the decode base; it may itself have
+  // been rebuilt from an earlier delta.
+  if (!planning_reader_->Empty()) {
+    const auto full = planning_reader_->GetLatestObserved();
+    if (latest_full_trajectory_ == nullptr ||
+        full->header().timestamp_sec() >
+            latest_full_trajectory_->header().timestamp_sec()) {
+      latest_full_trajectory_ = full;
+    }
+  }
+  if (latest_full_trajectory_ == nullptr ||
+      delta->header().timestamp_sec() <=
+          latest_full_trajectory_->header().timestamp_sec()) {
+    return;
+  }
+
+  auto rebuilt = std::make_shared<ADCTrajectory>();
+  if (!apollo::planning::TrajectoryDelta::Decode(*latest_full_trajectory_,
+                                                 *delta, rebuilt.get())) {
+    AWARN_EVERY(100) << "Failed to apply planning trajectory delta; keeping "
+                        "the last full trajectory.";
+    return;
+  }
+  latest_full_trajectory_ = rebuilt;
+  UpdateSimulationWorld(*rebuilt);
+}
+
 void SimulationWorldService::CreatePredictionTrajectory(
     const PredictionObstacle &obstacle, Object *world_object) {
   for (const auto &traj : obstacle.trajectory()) {
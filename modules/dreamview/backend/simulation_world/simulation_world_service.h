@@ -45,6 +45,7 @@
 #include "modules/localization/proto/localization.pb.h"
 #include "modules/perception/proto/traffic_light_detection.pb.h"
 #include "modules/planning/proto/planning.pb.h"
+#include "modules/planning/proto/trajectory_delta.pb.h"
 #include "modules/planning/proto/planning_internal.pb.h"
 #include "modules/prediction/proto/prediction_obstacle.pb.h"
 
@@ -229,6 +230,34 @@ class SimulationWorldService {
 
     const std::shared_ptr<MessageT> msg = reader->GetLatestObserved();
     UpdateSimulationWorld(*msg);
+    processed_msgs_[reader->GetChannelName()] = msg.get();
+  }
+
+  /**
+   * @brief Whether the reader holds a message that has not been folded
+   * into the simulation world yet.
+   */
+  template <typename MessageT>
+  bool ReaderHasNewMessage(cyber::Reader<MessageT> *reader) {
+    if (reader->Empty()) {
+      return false;
+    }
+    const auto iter = processed_msgs_.find(reader->GetChannelName());
+    return iter == processed_msgs_.end() ||
+           iter->second != reader->GetLatestObserved().get();
+  }
+
+  /**
+   * @brief Update the world from the reader only when it holds a new
+   * message; empty readers still go through UpdateWithLatestObserved for
+   * its periodic logging.
+   */
+  template <typename MessageT>
+  void UpdateIfChanged(cyber::Reader<MessageT> *reader, bool logging = true) {
+    if (!reader->Empty() && !ReaderHasNewMessage(reader)) {
+      return;
+    }
+    UpdateWithLatestObserved(reader, logging);
   }
 
   /**
@@ -276,6 +305,12 @@ class SimulationWorldService {
    * it is the max of (current_time - last_received_time) and
    * (last_received_time - second_to_last_received_time)
    */
+  /**
+   * @brief Apply the latest differential trajectory on top of the latest
+   * full one when planning publishes deltas between full publications.
+   */
+  void UpdateWithTrajectoryDelta();
+
   void UpdateDelays();
 
   /**
@@ -316,6 +351,20 @@ class SimulationWorldService {
   // The map holding obstacle string id to the actual object
   std::unordered_map<std::string, Object> obj_map_;
 
+  // Raw pointer of the last message folded into the world, per channel;
+  // used to dirty-check sections before rebuilding them.
+  std::unordered_map<std::string, const void *> processed_msgs_;
+
+  // Whether world_ changed since it was last serialized, and how many
+  // consecutive unchanged cycles have been skipped.
+  bool world_dirty_ = true;
+  int unchanged_cycles_ = 0;
+
+  // Serialized keyframe reused while the world is unchanged.
+  double cached_wire_radius_ = -1.0;
+  std::string cached_sim_world_;
+  std::string cached_sim_world_with_planning_data_;
+
   // A temporary cache for all the monitor messages coming in.
   std::mutex monitor_msgs_mutex_;
   std::list<std::shared_ptr<common::monitor::MonitorMessage>> monitor_msgs_;
@@ -350,6 +399,11 @@ class SimulationWorldService {
       prediction_obstacle_reader_;
   std::shared_ptr<cyber::Reader<apollo::planning::ADCTrajectory>>
       planning_reader_;
+  std::shared_ptr<cyber::Reader<apollo::planning::ADCTrajectoryDelta>>
+      planning_delta_reader_;
+  // the newest full trajectory, either received or rebuilt from a delta;
+  // serves as the base for decoding the next delta
+  std::shared_ptr<apollo::planning::ADCTrajectory> latest_full_trajectory_;
   std::shared_ptr<cyber::Reader<apollo::control::ControlCommand>>
       control_command_reader_;
   std::shared_ptr<cyber::Reader<apollo::relative_map::NavigationInfo>>
@@ -16,6 +16,8 @@
 
 #include "modules/dreamview/backend/simulation_world/simulation_world_updater.h"
 
+#include <unordered_set>
+
 #include "cyber/common/file.h"
 #include "google/protobuf/util/json_util.h"
 #include "modules/common/util/json_util.h"
@@ -37,6 +39,45 @@ using Json = nlohmann::json;
 using google::protobuf::util::JsonStringToMessage;
 using google::protobuf::util::MessageToJsonString;
 
+namespace {
+
+void SubtractIdField(
+    const google::protobuf::RepeatedPtrField<std::string> &cached,
+    google::protobuf::RepeatedPtrField<std::string> *wanted) {
+  if (cached.empty() || wanted->empty()) {
+    return;
+  }
+  const std::unordered_set<std::string> cached_set(cached.begin(),
+                                                   cached.end());
+  google::protobuf::RepeatedPtrField<std::string> remaining;
+  for (const auto &id : *wanted) {
+    if (cached_set.count(id) == 0) {
+      *remaining.Add() = id;
+    }
+  }
+  wanted->Swap(&remaining);
+}
+
+// Removes the ids the client reported as cached, so their geometry is not
+// re-sent. Map elements are immutable within a run, which makes the id
+// itself a sufficient cache validator.
+void SubtractCachedIds(const MapElementIds &cached, MapElementIds *ids) {
+  SubtractIdField(cached.lane(), ids->mutable_lane());
+  SubtractIdField(cached.crosswalk(), ids->mutable_crosswalk());
+  SubtractIdField(cached.junction(), ids->mutable_junction());
+  SubtractIdField(cached.signal(), ids->mutable_signal());
+  SubtractIdField(cached.stop_sign(), ids->mutable_stop_sign());
+  SubtractIdField(cached.yield(), ids->mutable_yield());
+  SubtractIdField(cached.overlap(), ids->mutable_overlap());
+  SubtractIdField(cached.road(), ids->mutable_road());
+  SubtractIdField(cached.clear_area(), ids->mutable_clear_area());
+  SubtractIdField(cached.parking_space(), ids->mutable_parking_space());
+  SubtractIdField(cached.speed_bump(), ids->mutable_speed_bump());
+  SubtractIdField(cached.pnc_junction(), ids->mutable_pnc_junction());
+}
+
+}  // namespace
+
 SimulationWorldUpdater::SimulationWorldUpdater(
     WebSocketHandler *websocket, WebSocketHandler *map_ws,
     SimControl *sim_control, const MapService *map_service,
@@ -67,7 +108,20 @@ void SimulationWorldUpdater::RegisterMessageHandlers() {
         if (iter != json.end()) {
           MapElementIds map_element_ids;
           if (JsonStringToMessage(iter->dump(), &map_element_ids).ok()) {
-            auto retrieved = map_service_->RetrieveMapElements(map_element_ids);
+            auto cached_iter = json.find("cached");
+            if (cached_iter != json.end()) {
+              MapElementIds cached_ids;
+              if (JsonStringToMessage(cached_iter->dump(), &cached_ids).ok()) {
+                SubtractCachedIds(cached_ids, &map_element_ids);
+              }
+            }
+            double simplify_angle_threshold = -1.0;
+            auto simplify_iter = json.find("simplifyAngleThreshold");
+            if (simplify_iter != json.end() && simplify_iter->is_number()) {
+              simplify_angle_threshold = *simplify_iter;
+            }
+            auto retrieved = map_service_->RetrieveMapElements(
+                map_element_ids, simplify_angle_threshold);
 
             std::string retrieved_map_string;
             retrieved.SerializeToString(&retrieved_map_string);
@@ -50,31 +50,26 @@ bool CameraComponent::Init() {
     return false;
   }
   raw_image_->is_new = 0;
-  // free memory in this struct desturctor
-  raw_image_->image =
-      reinterpret_cast<char*>(calloc(raw_image_->image_size, sizeof(char)));
-  if (raw_image_->image == nullptr) {
-    AERROR << "system calloc memory error, size:" << raw_image_->image_size;
-    return false;
-  }
-
-  for (int i = 0; i < buffer_size_; ++i) {
-    auto pb_image = std::make_shared<Image>();
-    pb_image->mutable_header()->set_frame_id(camera_config_->frame_id());
-    pb_image->set_width(raw_image_->width);
-    pb_image->set_height(raw_image_->height);
-    pb_image->mutable_data()->reserve(raw_image_->image_size);
-
-    if (camera_config_->output_type() == YUYV) {
-      pb_image->set_encoding("yuyv");
-      pb_image->set_step(2 * raw_image_->width);
-    } else if (camera_config_->output_type() == RGB) {
-      pb_image->set_encoding("rgb8");
-      pb_image->set_step(3 * raw_image_->width);
-    }
-
-    pb_image_buffer_.push_back(pb_image);
-  }
+  // the capture path fills the message buffers of the pool directly, so
+  // no intermediate staging buffer is allocated; the borrowed pointer is
+  // released in the destructor before the pool goes away
+  raw_image_->image = nullptr;
+
+  image_ring_.reset(new apollo::drivers::CaptureRing<Image>(
+      buffer_size_, [this](const std::shared_ptr<Image>& pb_image) {
+        pb_image->mutable_header()->set_frame_id(camera_config_->frame_id());
+        pb_image->set_width(raw_image_->width);
+        pb_image->set_height(raw_image_->height);
+        pb_image->mutable_data()->resize(raw_image_->image_size);
+
+        if (camera_config_->output_type() == YUYV) {
+          pb_image->set_encoding("yuyv");
+          pb_image->set_step(2 * raw_image_->width);
+        } else if (camera_config_->output_type() == RGB) {
+          pb_image->set_encoding("rgb8");
+          pb_image->set_step(3 * raw_image_->width);
+        }
+      }));
 
   writer_ = node_->CreateWriter<Image>(camera_config_->channel_name());
   async_result_ = cyber::Async(&CameraComponent::run, this);
@@ -90,20 +85,29 @@ void CameraComponent::run() {
       continue;
     }
 
+    auto pb_image = image_ring_->Acquire();
+    uint64_t overrun_num = image_ring_->overrun_num();
+    if (overrun_num != last_overrun_num_) {
+      AWARN << "image ring overrun, downstream is holding frames, total "
+            << overrun_num;
+      last_overrun_num_ = overrun_num;
+    }
+    if (pb_image->data().size() !=
+        static_cast<size_t>(raw_image_->image_size)) {
+      pb_image->mutable_data()->resize(raw_image_->image_size);
+    }
+    // capture straight into the message buffer, saving a full-frame copy
+    raw_image_->image = &(*pb_image->mutable_data())[0];
+
     if (!camera_device_->poll(raw_image_)) {
       AERROR << "camera device poll failed";
       continue;
     }
 
     cyber::Time image_time(raw_image_->tv_sec, 1000 * raw_image_->tv_usec);
-    if (index_ >= buffer_size_) {
-      index_ = 0;
-    }
-    auto pb_image = pb_image_buffer_.at(index_++);
     pb_image->mutable_header()->set_timestamp_sec(
         cyber::Time::Now().ToSecond());
     pb_image->set_measurement_time(image_time.ToSecond());
-    pb_image->set_data(raw_image_->image, raw_image_->image_size);
     writer_->Write(pb_image);
 
     cyber::SleepFor(std::chrono::microseconds(spin_rate_));
@@ -115,6 +119,10 @@ CameraComponent::~CameraComponent() {
     running_.exchange(false);
     async_result_.wait();
   }
+  if (raw_image_ != nullptr) {
+    // the buffer belongs to the message pool, not to the raw image
+    raw_image_->image = nullptr;
+  }
 }
 
 }  // namespace camera
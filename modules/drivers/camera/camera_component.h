@@ -19,10 +19,10 @@
 #include <atomic>
 #include <future>
 #include <memory>
-#include <vector>
 
 #include "cyber/cyber.h"
 #include "modules/drivers/camera/proto/config.pb.h"
+#include "modules/drivers/common/capture_ring.h"
 #include "modules/drivers/proto/sensor_image.pb.h"
 
 #include "modules/drivers/camera/usb_cam.h"
@@ -49,11 +49,11 @@ class CameraComponent : public Component<> {
   std::unique_ptr<UsbCam> camera_device_;
   std::shared_ptr<Config> camera_config_;
   CameraImagePtr raw_image_ = nullptr;
-  std::vector<std::shared_ptr<Image>> pb_image_buffer_;
+  std::unique_ptr<apollo::drivers::CaptureRing<Image>> image_ring_;
   uint32_t spin_rate_ = 200;
   uint32_t device_wait_ = 2000;
-  int index_ = 0;
-  int buffer_size_ = 16;
+  uint32_t buffer_size_ = 16;
+  uint64_t last_overrun_num_ = 0;
   const int32_t MAX_IMAGE_SIZE = 20 * 1024 * 1024;
   std::future<void> async_result_;
   std::atomic<bool> running_ = {false};
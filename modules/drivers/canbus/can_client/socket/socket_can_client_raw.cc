@@ -95,6 +95,33 @@ ErrorCode SocketCanClientRaw::Start() {
     return ErrorCode::CAN_CLIENT_ERROR_BASE;
   }
 
+  // 3. enable kernel receive timestamps, delivered per frame through the
+  // recvmmsg control messages
+  int timestamp_on = 1;
+  ret = ::setsockopt(dev_handler_, SOL_SOCKET, SO_TIMESTAMP, &timestamp_on,
+                     sizeof(timestamp_on));
+  if (ret < 0) {
+    AERROR << "enable kernel receive timestamp error code: " << ret;
+    return ErrorCode::CAN_CLIENT_ERROR_BASE;
+  }
+
+  // preset the batched message headers once; only the control buffers
+  // need to be re-armed per Receive call
+  std::memset(send_msgs_, 0, sizeof(send_msgs_));
+  for (int i = 0; i < MAX_CAN_SEND_FRAME_LEN; ++i) {
+    send_iovecs_[i].iov_base = &send_frames_[i];
+    send_iovecs_[i].iov_len = sizeof(send_frames_[i]);
+    send_msgs_[i].msg_hdr.msg_iov = &send_iovecs_[i];
+    send_msgs_[i].msg_hdr.msg_iovlen = 1;
+  }
+  std::memset(recv_msgs_, 0, sizeof(recv_msgs_));
+  for (int i = 0; i < MAX_CAN_RECV_FRAME_LEN; ++i) {
+    recv_iovecs_[i].iov_base = &recv_frames_[i];
+    recv_iovecs_[i].iov_len = sizeof(recv_frames_[i]);
+    recv_msgs_[i].msg_hdr.msg_iov = &recv_iovecs_[i];
+    recv_msgs_[i].msg_hdr.msg_iovlen = 1;
+  }
+
   std::string can_name("can" + std::to_string(port_));
   std::strncpy(ifr.ifr_name, can_name.c_str(), IFNAMSIZ);
   if (ioctl(dev_handler_, SIOCGIFINDEX, &ifr) < 0) {
@@ -141,6 +168,7 @@ ErrorCode SocketCanClientRaw::Send(const std::vector<CanFrame> &frames,
     AERROR << "Nvidia can client has not been initiated! Please init first!";
     return ErrorCode::CAN_CLIENT_ERROR_SEND_FAILED;
   }
+  int32_t send_num = 0;
   for (size_t i = 0; i < frames.size() && i < MAX_CAN_SEND_FRAME_LEN; ++i) {
     if (frames[i].len != CANBUS_MESSAGE_LENGTH) {
       AERROR << "frames[" << i << "].len = " << frames[i].len
@@ -151,14 +179,19 @@ ErrorCode SocketCanClientRaw::Send(const std::vector<CanFrame> &frames,
     send_frames_[i].can_id = frames[i].id;
     send_frames_[i].can_dlc = frames[i].len;
     std::memcpy(send_frames_[i].data, frames[i].data, frames[i].len);
+    ++send_num;
+  }
 
-    // Synchronous transmission of CAN messages
+  // Synchronous transmission of the whole batch in one syscall
+  int32_t sent = 0;
+  while (sent < send_num) {
     int ret = static_cast<int>(
-        write(dev_handler_, &send_frames_[i], sizeof(send_frames_[i])));
+        sendmmsg(dev_handler_, &send_msgs_[sent], send_num - sent, 0));
     if (ret <= 0) {
       AERROR << "send message failed, error code: " << ret;
       return ErrorCode::CAN_CLIENT_ERROR_BASE;
     }
+    sent += ret;
   }
 
   return ErrorCode::OK;
@@ -179,14 +212,23 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
     return ErrorCode::CAN_CLIENT_ERROR_FRAME_NUM;
   }
 
-  for (int32_t i = 0; i < *frame_num && i < MAX_CAN_RECV_FRAME_LEN; ++i) {
-    CanFrame cf;
-    auto ret = read(dev_handler_, &recv_frames_[i], sizeof(recv_frames_[i]));
+  // re-arm the per-message control buffers, the kernel rewrites their
+  // lengths on every call
+  for (int32_t i = 0; i < *frame_num; ++i) {
+    recv_msgs_[i].msg_hdr.msg_control = recv_cmsg_bufs_[i];
+    recv_msgs_[i].msg_hdr.msg_controllen = sizeof(recv_cmsg_bufs_[i]);
+  }
 
-    if (ret < 0) {
-      AERROR << "receive message failed, error code: " << ret;
-      return ErrorCode::CAN_CLIENT_ERROR_BASE;
-    }
+  // block until the first frame arrives, then drain whatever else is
+  // already queued without further syscalls
+  int ret = recvmmsg(dev_handler_, recv_msgs_, *frame_num, MSG_WAITFORONE,
+                     nullptr);
+  if (ret < 0) {
+    AERROR << "receive message failed, error code: " << ret;
+    return ErrorCode::CAN_CLIENT_ERROR_BASE;
+  }
+
+  for (int32_t i = 0; i < ret; ++i) {
     if (recv_frames_[i].can_dlc != CANBUS_MESSAGE_LENGTH) {
       AERROR << "recv_frames_[" << i
              << "].can_dlc = " << recv_frames_[i].can_dlc
@@ -194,11 +236,21 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
              << CANBUS_MESSAGE_LENGTH << ").";
       return ErrorCode::CAN_CLIENT_ERROR_RECV_FAILED;
     }
+    CanFrame cf;
     cf.id = recv_frames_[i].can_id;
     cf.len = recv_frames_[i].can_dlc;
     std::memcpy(cf.data, recv_frames_[i].data, recv_frames_[i].can_dlc);
+    // propagate the kernel receive timestamp when present
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&recv_msgs_[i].msg_hdr);
+         cmsg != nullptr; cmsg = CMSG_NXTHDR(&recv_msgs_[i].msg_hdr, cmsg)) {
+      if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMP) {
+        std::memcpy(&cf.timestamp, CMSG_DATA(cmsg), sizeof(cf.timestamp));
+        break;
+      }
+    }
     frames->push_back(cf);
   }
+  *frame_num = ret;
   return ErrorCode::OK;
 }
 
@@ -114,6 +114,16 @@ class SocketCanClientRaw : public CanClient {
   CANCardParameter::CANChannelId port_;
   can_frame send_frames_[MAX_CAN_SEND_FRAME_LEN];
   can_frame recv_frames_[MAX_CAN_RECV_FRAME_LEN];
+
+  // preset scatter-gather headers so Send/Receive move a whole batch of
+  // frames per sendmmsg/recvmmsg syscall; the per-message control buffers
+  // carry the kernel receive timestamps
+  struct mmsghdr send_msgs_[MAX_CAN_SEND_FRAME_LEN];
+  struct iovec send_iovecs_[MAX_CAN_SEND_FRAME_LEN];
+  struct mmsghdr recv_msgs_[MAX_CAN_RECV_FRAME_LEN];
+  struct iovec recv_iovecs_[MAX_CAN_RECV_FRAME_LEN];
+  uint8_t recv_cmsg_bufs_[MAX_CAN_RECV_FRAME_LEN]
+                         [CMSG_SPACE(sizeof(struct timeval))];
 };
 
 }  // namespace can
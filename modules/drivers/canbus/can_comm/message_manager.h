@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include <bitset>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -116,6 +117,8 @@ class MessageManager {
   template <class T, bool need_check>
   void AddSendProtocolData();
 
+  void CheckPeriod(CheckIdArg *arg);
+
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> send_protocol_data_;
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> recv_protocol_data_;
 
@@ -123,6 +126,15 @@ class MessageManager {
   std::unordered_map<uint32_t, CheckIdArg> check_ids_;
   std::set<uint32_t> received_ids_;
 
+  // dense dispatch tables indexed by standard (11-bit) CAN id, so the
+  // 1kHz receive path never walks a hash map or the received-id set;
+  // extended ids fall back to the maps above. The CheckIdArg pointers
+  // stay valid because unordered_map never moves its nodes.
+  static constexpr uint32_t STANDARD_ID_RANGE = 2048;
+  ProtocolData<SensorType> *protocol_data_index_[STANDARD_ID_RANGE] = {};
+  CheckIdArg *check_id_index_[STANDARD_ID_RANGE] = {};
+  std::bitset<STANDARD_ID_RANGE> received_flags_;
+
   std::mutex sensor_data_mutex_;
   SensorType sensor_data_;
   bool is_received_on_time_ = false;
@@ -139,11 +151,17 @@ void MessageManager<SensorType>::AddRecvProtocolData() {
     return;
   }
   protocol_data_map_[T::ID] = dt;
+  if (T::ID < STANDARD_ID_RANGE) {
+    protocol_data_index_[T::ID] = dt;
+  }
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
     check_ids_[T::ID].last_time = 0;
     check_ids_[T::ID].error_count = 0;
+    if (T::ID < STANDARD_ID_RANGE) {
+      check_id_index_[T::ID] = &check_ids_[T::ID];
+    }
   }
 }
 
@@ -156,11 +174,17 @@ void MessageManager<SensorType>::AddSendProtocolData() {
     return;
   }
   protocol_data_map_[T::ID] = dt;
+  if (T::ID < STANDARD_ID_RANGE) {
+    protocol_data_index_[T::ID] = dt;
+  }
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
     check_ids_[T::ID].last_time = 0;
     check_ids_[T::ID].error_count = 0;
+    if (T::ID < STANDARD_ID_RANGE) {
+      check_id_index_[T::ID] = &check_ids_[T::ID];
+    }
   }
 }
 
@@ -168,6 +192,13 @@ template <typename SensorType>
 ProtocolData<SensorType>
     *MessageManager<SensorType>::GetMutableProtocolDataById(
         const uint32_t message_id) {
+  if (message_id < STANDARD_ID_RANGE) {
+    if (protocol_data_index_[message_id] == nullptr) {
+      ADEBUG << "Unable to get protocol data because of invalid message_id:"
+             << Byte::byte_to_hex(message_id);
+    }
+    return protocol_data_index_[message_id];
+  }
   if (protocol_data_map_.find(message_id) == protocol_data_map_.end()) {
     ADEBUG << "Unable to get protocol data because of invalid message_id:"
            << Byte::byte_to_hex(message_id);
@@ -188,21 +219,38 @@ void MessageManager<SensorType>::Parse(const uint32_t message_id,
     std::lock_guard<std::mutex> lock(sensor_data_mutex_);
     protocol_data->Parse(data, length, &sensor_data_);
   }
+  if (message_id < STANDARD_ID_RANGE) {
+    // hot path: a bit test instead of a set walk, a table load instead
+    // of a hash lookup
+    if (!received_flags_[message_id]) {
+      received_flags_[message_id] = true;
+      received_ids_.insert(message_id);
+    }
+    if (check_id_index_[message_id] != nullptr) {
+      CheckPeriod(check_id_index_[message_id]);
+    }
+    return;
+  }
   received_ids_.insert(message_id);
   // check if need to check period
   const auto it = check_ids_.find(message_id);
   if (it != check_ids_.end()) {
-    const int64_t time = apollo::common::time::AsInt64<micros>(Clock::Now());
-    it->second.real_period = time - it->second.last_time;
-    // if period 1.5 large than base period, inc error_count
-    const double period_multiplier = 1.5;
-    if (it->second.real_period > (it->second.period * period_multiplier)) {
-      it->second.error_count += 1;
-    } else {
-      it->second.error_count = 0;
-    }
-    it->second.last_time = time;
+    CheckPeriod(&it->second);
+  }
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::CheckPeriod(CheckIdArg *arg) {
+  const int64_t time = apollo::common::time::AsInt64<micros>(Clock::Now());
+  arg->real_period = time - arg->last_time;
+  // if period 1.5 large than base period, inc error_count
+  const double period_multiplier = 1.5;
+  if (arg->real_period > (arg->period * period_multiplier)) {
+    arg->error_count += 1;
+  } else {
+    arg->error_count = 0;
   }
+  arg->last_time = time;
 }
 
 template <typename SensorType>
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace apollo {
+namespace drivers {
+
+/**
+ * @class CaptureRing
+ * @brief Fixed ring of preallocated messages for sensor driver capture
+ * loops. The capture thread borrows the next slot, fills it in place and
+ * hands the same object to a cyber writer, so steady-state capture
+ * neither allocates nor copies. A slot that is still referenced
+ * downstream when its turn comes again is counted as an overrun and
+ * replaced instead of being overwritten under the consumer.
+ *
+ * One ring serves one capture thread; it is not thread safe.
+ */
+template <typename T>
+class CaptureRing {
+ public:
+  using InitFunc = std::function<void(const std::shared_ptr<T>&)>;
+
+  /**
+   * @brief construct a ring of size preallocated messages, each passed
+   * to init once so constant fields and reservations are set up front
+   */
+  explicit CaptureRing(uint32_t size, const InitFunc& init = nullptr)
+      : init_(init) {
+    slots_.reserve(size);
+    for (uint32_t i = 0; i < size; ++i) {
+      slots_.push_back(NewSlot());
+    }
+  }
+
+  /**
+   * @brief borrow the next slot and advance the sequence number
+   */
+  std::shared_ptr<T> Acquire() {
+    auto& slot = slots_[index_];
+    if (slot.use_count() > 1) {
+      // the consumer still holds this slot, replace it instead of
+      // racing the consumer for its contents
+      ++overrun_num_;
+      slot = NewSlot();
+    }
+    index_ = (index_ + 1) % static_cast<uint32_t>(slots_.size());
+    ++sequence_num_;
+    return slot;
+  }
+
+  /**
+   * @brief number of slots handed out since construction
+   */
+  uint64_t sequence_num() const { return sequence_num_; }
+
+  /**
+   * @brief number of acquisitions that found their slot still in use
+   */
+  uint64_t overrun_num() const { return overrun_num_; }
+
+ private:
+  std::shared_ptr<T> NewSlot() {
+    auto slot = std::make_shared<T>();
+    if (init_ != nullptr) {
+      init_(slot);
+    }
+    return slot;
+  }
+
+  InitFunc init_;
+  std::vector<std::shared_ptr<T>> slots_;
+  uint32_t index_ = 0;
+  uint64_t sequence_num_ = 0;
+  uint64_t overrun_num_ = 0;
+};
+
+}  // namespace drivers
+}  // namespace apollo
@@ -217,19 +217,22 @@ void DataParser::DispatchMessage(Parser::MessageType type, MessagePtr message) {
 }
 
 void DataParser::PublishInsStat(const MessagePtr message) {
-  auto ins_stat = std::make_shared<InsStat>(*As<InsStat>(message));
+  auto ins_stat = insstat_pool_.NextSlot();
+  ins_stat->CopyFrom(*As<InsStat>(message));
   common::util::FillHeader("gnss", ins_stat.get());
   insstat_writer_->Write(ins_stat);
 }
 
 void DataParser::PublishBestpos(const MessagePtr message) {
-  auto bestpos = std::make_shared<GnssBestPose>(*As<GnssBestPose>(message));
+  auto bestpos = bestpos_pool_.NextSlot();
+  bestpos->CopyFrom(*As<GnssBestPose>(message));
   common::util::FillHeader("gnss", bestpos.get());
   gnssbestpose_writer_->Write(bestpos);
 }
 
 void DataParser::PublishImu(const MessagePtr message) {
-  auto raw_imu = std::make_shared<Imu>(*As<Imu>(message));
+  auto raw_imu = rawimu_pool_.NextSlot();
+  raw_imu->CopyFrom(*As<Imu>(message));
   Imu *imu = As<Imu>(message);
 
   raw_imu->mutable_linear_acceleration()->set_x(
@@ -247,7 +250,7 @@ void DataParser::PublishImu(const MessagePtr message) {
 
 void DataParser::PublishOdometry(const MessagePtr message) {
   Ins *ins = As<Ins>(message);
-  auto gps = std::make_shared<Gps>();
+  auto gps = gps_pool_.NextSlot();
 
   double unix_sec = apollo::drivers::util::gps2unix(ins->measurement_time());
   gps->mutable_header()->set_timestamp_sec(unix_sec);
@@ -291,7 +294,7 @@ void DataParser::PublishOdometry(const MessagePtr message) {
 
 void DataParser::PublishCorrimu(const MessagePtr message) {
   Ins *ins = As<Ins>(message);
-  auto imu = std::make_shared<CorrectedImu>();
+  auto imu = corrimu_pool_.NextSlot();
   double unix_sec = apollo::drivers::util::gps2unix(ins->measurement_time());
   imu->mutable_header()->set_timestamp_sec(unix_sec);
 
@@ -314,18 +317,20 @@ void DataParser::PublishCorrimu(const MessagePtr message) {
 }
 
 void DataParser::PublishEphemeris(const MessagePtr message) {
-  auto eph = std::make_shared<GnssEphemeris>(*As<GnssEphemeris>(message));
+  auto eph = ephemeris_pool_.NextSlot();
+  eph->CopyFrom(*As<GnssEphemeris>(message));
   gnssephemeris_writer_->Write(eph);
 }
 
 void DataParser::PublishObservation(const MessagePtr message) {
-  auto observation =
-      std::make_shared<EpochObservation>(*As<EpochObservation>(message));
+  auto observation = observation_pool_.NextSlot();
+  observation->CopyFrom(*As<EpochObservation>(message));
   epochobservation_writer_->Write(observation);
 }
 
 void DataParser::PublishHeading(const MessagePtr message) {
-  auto heading = std::make_shared<Heading>(*As<Heading>(message));
+  auto heading = heading_pool_.NextSlot();
+  heading->CopyFrom(*As<Heading>(message));
   heading_writer_->Write(heading);
 }
 
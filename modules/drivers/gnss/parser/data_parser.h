@@ -19,6 +19,7 @@
 #include <proj_api.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cyber/cyber.h"
 #include "modules/transform/transform_broadcaster.h"
@@ -40,6 +41,37 @@ namespace apollo {
 namespace drivers {
 namespace gnss {
 
+/**@brief A fixed ring of preallocated messages.
+ *
+ * Publishing through the pool reuses a slot instead of allocating a
+ * fresh protobuf for every parsed sentence. If a reader still holds a
+ * reference when a slot comes around again, that slot alone is replaced
+ * with a fresh message, so published data is never overwritten. */
+template <typename MessageType>
+class MessagePool {
+ public:
+  explicit MessagePool(int size) : messages_(size), index_(0) {
+    for (auto &msg : messages_) {
+      msg = std::make_shared<MessageType>();
+    }
+  }
+
+  std::shared_ptr<MessageType> NextSlot() {
+    auto &msg = messages_[index_];
+    index_ = (index_ + 1) % static_cast<int>(messages_.size());
+    if (msg.use_count() > 1) {
+      msg = std::make_shared<MessageType>();
+    } else {
+      msg->Clear();
+    }
+    return msg;
+  }
+
+ private:
+  std::vector<std::shared_ptr<MessageType>> messages_;
+  int index_;
+};
+
 class DataParser {
  public:
   using MessagePtr = ::google::protobuf::Message *;
@@ -93,6 +125,19 @@ class DataParser {
   std::shared_ptr<apollo::cyber::Writer<EpochObservation>>
       epochobservation_writer_ = nullptr;
   std::shared_ptr<apollo::cyber::Writer<Heading>> heading_writer_ = nullptr;
+
+  // message rings for the per-sentence publish paths; sized so in-flight
+  // readers never hold more than a fraction of a ring
+  static constexpr int MESSAGE_POOL_SIZE = 8;
+  MessagePool<InsStat> insstat_pool_{MESSAGE_POOL_SIZE};
+  MessagePool<GnssBestPose> bestpos_pool_{MESSAGE_POOL_SIZE};
+  MessagePool<Imu> rawimu_pool_{MESSAGE_POOL_SIZE};
+  MessagePool<apollo::localization::Gps> gps_pool_{MESSAGE_POOL_SIZE};
+  MessagePool<apollo::localization::CorrectedImu> corrimu_pool_{
+      MESSAGE_POOL_SIZE};
+  MessagePool<GnssEphemeris> ephemeris_pool_{MESSAGE_POOL_SIZE};
+  MessagePool<EpochObservation> observation_pool_{MESSAGE_POOL_SIZE};
+  MessagePool<Heading> heading_pool_{MESSAGE_POOL_SIZE};
 };
 
 }  // namespace gnss
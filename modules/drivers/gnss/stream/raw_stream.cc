@@ -480,11 +480,7 @@ void RawStream::DataSpin() {
   while (cyber::OK()) {
     size_t length = data_stream_->read(buffer_, BUFFER_SIZE);
     if (length > 0) {
-      std::shared_ptr<RawData> msg_pub = std::make_shared<RawData>();
-      if (!msg_pub) {
-        AERROR << "New data sting msg failed.";
-        continue;
-      }
+      std::shared_ptr<RawData> msg_pub = raw_ring_.Acquire();
       msg_pub->set_data(reinterpret_cast<const char *>(buffer_), length);
       raw_writer_->Write(msg_pub);
       data_parser_ptr_->ParseRawData(msg_pub->data());
@@ -521,7 +517,7 @@ void RawStream::RtkSpin() {
 }
 
 void RawStream::PublishRtkData(const size_t length) {
-  std::shared_ptr<RawData> rtk_msg = std::make_shared<RawData>();
+  std::shared_ptr<RawData> rtk_msg = rtk_ring_.Acquire();
   CHECK_NOTNULL(rtk_msg);
   rtk_msg->set_data(reinterpret_cast<const char *>(buffer_rtk_), length);
   rtcm_writer_->Write(rtk_msg);
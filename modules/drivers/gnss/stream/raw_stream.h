@@ -27,6 +27,7 @@
 #include "modules/drivers/gnss/proto/config.pb.h"
 #include "modules/drivers/gnss/proto/gnss_status.pb.h"
 
+#include "modules/drivers/common/capture_ring.h"
 #include "modules/drivers/gnss/parser/data_parser.h"
 #include "modules/drivers/gnss/parser/rtcm_parser.h"
 #include "modules/drivers/gnss/stream/stream.h"
@@ -69,6 +70,10 @@ class RawStream {
   uint8_t buffer_[BUFFER_SIZE] = {0};
   uint8_t buffer_rtk_[BUFFER_SIZE] = {0};
 
+  // message rings for the data and rtk spin threads, one ring per thread
+  CaptureRing<RawData> raw_ring_{8};
+  CaptureRing<RawData> rtk_ring_{8};
+
   std::shared_ptr<Stream> data_stream_;
   std::shared_ptr<Stream> command_stream_;
   std::shared_ptr<Stream> in_rtk_stream_;
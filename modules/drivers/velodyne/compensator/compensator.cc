@@ -157,6 +157,12 @@ void Compensator::MotionCompensation(
     double theta = acos(abs_d);
     double sin_theta = sin(theta);
     double c1_sign = (d > 0) ? 1 : -1;
+    // points of the same firing column carry the same timestamp, so the
+    // interpolated pose only changes between columns; cache it keyed by
+    // timestamp and apply it as a plain rotation + offset per point
+    uint64_t cached_tp = std::numeric_limits<uint64_t>::max();
+    Eigen::Matrix3d rotation = Eigen::Matrix3d::Identity();
+    Eigen::Vector3d offset = Eigen::Vector3d::Zero();
     for (const auto& point : msg->point()) {
       float x_scalar = point.x();
       if (std::isnan(x_scalar)) {
@@ -173,16 +179,18 @@ void Compensator::MotionCompensation(
       Eigen::Vector3d p(x_scalar, y_scalar, z_scalar);
 
       uint64_t tp = point.timestamp();
-      double t = static_cast<double>(timestamp_max - tp) * f;
-
-      Eigen::Translation3d ti(t * translation);
+      if (tp != cached_tp) {
+        double t = static_cast<double>(timestamp_max - tp) * f;
 
-      double c0 = sin((1 - t) * theta) / sin_theta;
-      double c1 = sin(t * theta) / sin_theta * c1_sign;
-      Eigen::Quaterniond qi(c0 * q0.coeffs() + c1 * q1.coeffs());
+        double c0 = sin((1 - t) * theta) / sin_theta;
+        double c1 = sin(t * theta) / sin_theta * c1_sign;
+        Eigen::Quaterniond qi(c0 * q0.coeffs() + c1 * q1.coeffs());
 
-      Eigen::Affine3d trans = ti * qi;
-      p = trans * p;
+        rotation = qi.toRotationMatrix();
+        offset = t * translation;
+        cached_tp = tp;
+      }
+      p = rotation * p + offset;
 
       auto* point_new = msg_compensated->add_point();
       point_new->set_intensity(point.intensity());
@@ -194,6 +202,8 @@ void Compensator::MotionCompensation(
     return;
   }
   // Not a "significant" rotation. Do translation only.
+  uint64_t cached_tp = std::numeric_limits<uint64_t>::max();
+  Eigen::Vector3d offset = Eigen::Vector3d::Zero();
   for (auto& point : msg->point()) {
     float x_scalar = point.x();
     if (std::isnan(x_scalar)) {
@@ -205,10 +215,12 @@ void Compensator::MotionCompensation(
     Eigen::Vector3d p(x_scalar, y_scalar, z_scalar);
 
     uint64_t tp = point.timestamp();
-    double t = static_cast<double>(timestamp_max - tp) * f;
-    Eigen::Translation3d ti(t * translation);
-
-    p = ti * p;
+    if (tp != cached_tp) {
+      double t = static_cast<double>(timestamp_max - tp) * f;
+      offset = t * translation;
+      cached_tp = tp;
+    }
+    p += offset;
 
     auto* point_new = msg_compensated->add_point();
     point_new->set_intensity(point.intensity());
@@ -34,6 +34,10 @@ void Velodyne128Parser::GeneratePointcloud(
   out_msg->mutable_header()->set_timestamp_sec(cyber::Time().Now().ToSecond());
   out_msg->set_height(1);
 
+  // pre-size the point pool so Unpack never reallocates mid-scan
+  out_msg->mutable_point()->Reserve(scan_msg->firing_pkts_size() *
+                                    SCANS_PER_PACKET);
+
   // us
   gps_base_usec_ = scan_msg->basetime();
 
@@ -70,16 +74,25 @@ void Velodyne128Parser::Order(std::shared_ptr<PointCloud> cloud) {
 
 void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
                                std::shared_ptr<PointCloud> pc) {
-  float azimuth_diff, azimuth_corrected_f;
-  float last_azimuth_diff = 0.0f;
   uint16_t azimuth = 0;
   uint16_t azimuth_next = 0;
-  uint16_t azimuth_corrected = 0;
   const RawPacket* raw = (const RawPacket*)pkt.data().c_str();
   double basetime = raw->gps_timestamp;
 
+  if (soa_corrections_.dist_correction.empty()) {
+    AERROR << "SoA corrections not initialized, check calibration config";
+    return;
+  }
+
+  // per-block decode buffers, one slot per laser of a firing block
+  uint16_t raw_units[SCANS_PER_BLOCK];
+  float raw_distances[SCANS_PER_BLOCK];
+  uint16_t rotations[SCANS_PER_BLOCK];
+  float xs[SCANS_PER_BLOCK];
+  float ys[SCANS_PER_BLOCK];
+  float zs[SCANS_PER_BLOCK];
+
   for (int block = 0; block < BLOCKS_PER_PACKET; block++) {
-    // Calculate difference between current and next block's azimuth angle.
     if (block == 0) {
       azimuth = raw->blocks[block].rotation;
     } else {
@@ -87,30 +100,33 @@ void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
     }
     if (block < (BLOCKS_PER_PACKET - 1)) {
       azimuth_next = raw->blocks[block + 1].rotation;
-      azimuth_diff =
-          static_cast<float>((36000 + azimuth_next - azimuth) % 36000);
-      last_azimuth_diff = azimuth_diff;
-    } else {
-      azimuth_diff = last_azimuth_diff;
     }
 
-    /*condition added to avoid calculating points which are not
-      in the interesting defined area (min_angle < area < max_angle)*/
+    // the firing order is fixed at zero for the VLS128, so the per-firing
+    // azimuth correction degenerates to the block azimuth
+    const uint16_t azimuth_corrected = azimuth % 36000;
+    const int first_laser = (block % 4) * 32;
+
+    // distance extraction for the whole block, then one vectorizable
+    // coordinate pass over its 32 lasers
     for (int j = 0, k = 0; j < SCANS_PER_BLOCK; j++, k += RAW_SCAN_SIZE) {
-      uint8_t group = static_cast<uint8_t>(block % 4);
-      uint8_t chan_id = static_cast<uint8_t>(j + group * 32);
-      uint8_t firing_order = chan_id / 8;
-      firing_order = 0;
-      LaserCorrection& corrections = calibration_.laser_corrections_[chan_id];
-      // distance extraction
-      // union two_bytes tmp;
       union RawDistance raw_distance;
       raw_distance.bytes[0] = raw->blocks[block].data[k];
       raw_distance.bytes[1] = raw->blocks[block].data[k + 1];
-
-      float real_distance =
+      raw_units[j] = raw_distance.raw_distance;
+      raw_distances[j] =
           raw_distance.raw_distance * VSL128_DISTANCE_RESOLUTION;
-      float distance = real_distance + corrections.dist_correction;
+      rotations[j] = azimuth_corrected;
+    }
+    ComputeCoordsBlock(raw_distances, rotations, first_laser, SCANS_PER_BLOCK,
+                       xs, ys, zs);
+
+    /*condition added to avoid calculating points which are not
+      in the interesting defined area (min_angle < area < max_angle)*/
+    for (int j = 0, k = 0; j < SCANS_PER_BLOCK; j++, k += RAW_SCAN_SIZE) {
+      uint8_t chan_id = static_cast<uint8_t>(j + first_laser);
+      LaserCorrection& corrections = calibration_.laser_corrections_[chan_id];
+      float distance = raw_distances[j] + corrections.dist_correction;
 
       uint64_t timestamp = static_cast<uint64_t>(GetTimestamp(
           basetime, (*inner_time_)[block][j], static_cast<uint16_t>(block)));
@@ -127,29 +143,20 @@ void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
         continue;
       }
 
-      // if (pointInRange(distance)) {
       int intensity = static_cast<int>(raw->blocks[block].data[k + 2]);
 
-      /** correct for the laser rotation as a function of timing during the
-       * firings **/
-      azimuth_corrected_f =
-          azimuth +
-          (azimuth_diff * (firing_order * CHANNEL_TDURATION) / SEQ_TDURATION);
-      azimuth_corrected =
-          (static_cast<uint16_t>(round(azimuth_corrected_f))) % 36000;
-
       // add new point
       PointXYZIT* point_new = pc->add_point();
 
       // compute time , time offset is zero
       point_new->set_timestamp(timestamp);
-      ComputeCoords(real_distance, corrections, azimuth_corrected, point_new);
+      point_new->set_x(xs[j]);
+      point_new->set_y(ys[j]);
+      point_new->set_z(zs[j]);
 
-      intensity = IntensityCompensate(corrections, raw_distance.raw_distance,
-                                      intensity);
+      intensity = IntensityCompensate(corrections, raw_units[j], intensity);
       point_new->set_intensity(intensity);
     }
-    // }
   }
 }
 
@@ -167,6 +167,9 @@ void Velodyne64Parser::GeneratePointcloud(
 
   bool skip = false;
   size_t packets_size = scan_msg->firing_pkts_size();
+  // pre-size the point pool so Unpack never reallocates mid-scan
+  pointcloud->mutable_point()->Reserve(static_cast<int>(packets_size) *
+                                       SCANS_PER_PACKET);
   for (size_t i = 0; i < packets_size; ++i) {
     if (gps_base_usec_[0] == 0) {
       // only set one time type when call this function, so cannot break
@@ -103,6 +103,32 @@ void VelodyneParser::setup() {
   init_angle_params(config_.view_direction(), config_.view_width());
   init_sin_cos_rot_table(sin_rot_table_, cos_rot_table_, ROTATION_MAX_UNITS,
                          ROTATION_RESOLUTION);
+  if (calibration_.initialized_) {
+    init_soa_corrections();
+  }
+}
+
+void VelodyneParser::init_soa_corrections() {
+  int num_lasers = calibration_.num_lasers_;
+  soa_corrections_.dist_correction.resize(num_lasers);
+  soa_corrections_.cos_rot_correction.resize(num_lasers);
+  soa_corrections_.sin_rot_correction.resize(num_lasers);
+  soa_corrections_.cos_vert_correction.resize(num_lasers);
+  soa_corrections_.sin_vert_correction.resize(num_lasers);
+  soa_corrections_.vert_offset_correction.resize(num_lasers);
+  soa_corrections_.horiz_offset_correction.resize(num_lasers);
+  for (int i = 0; i < num_lasers; ++i) {
+    const LaserCorrection& corrections = calibration_.laser_corrections_[i];
+    soa_corrections_.dist_correction[i] = corrections.dist_correction;
+    soa_corrections_.cos_rot_correction[i] = corrections.cos_rot_correction;
+    soa_corrections_.sin_rot_correction[i] = corrections.sin_rot_correction;
+    soa_corrections_.cos_vert_correction[i] = corrections.cos_vert_correction;
+    soa_corrections_.sin_vert_correction[i] = corrections.sin_vert_correction;
+    soa_corrections_.vert_offset_correction[i] =
+        corrections.vert_offset_correction;
+    soa_corrections_.horiz_offset_correction[i] =
+        corrections.horiz_offset_correction;
+  }
 }
 
 bool VelodyneParser::is_scan_valid(int rotation, float range) {
@@ -200,6 +226,41 @@ void VelodyneParser::ComputeCoords(const float &raw_distance,
   point->set_z(static_cast<float>(z));
 }
 
+void VelodyneParser::ComputeCoordsBlock(const float* raw_distances,
+                                        const uint16_t* rotations,
+                                        int first_laser, int count, float* xs,
+                                        float* ys, float* zs) {
+  const float* dist_corr = &soa_corrections_.dist_correction[first_laser];
+  const float* cos_rot_corr = &soa_corrections_.cos_rot_correction[first_laser];
+  const float* sin_rot_corr = &soa_corrections_.sin_rot_correction[first_laser];
+  const float* cos_vert_corr =
+      &soa_corrections_.cos_vert_correction[first_laser];
+  const float* sin_vert_corr =
+      &soa_corrections_.sin_vert_correction[first_laser];
+  const float* vert_offset =
+      &soa_corrections_.vert_offset_correction[first_laser];
+  const float* horiz_offset =
+      &soa_corrections_.horiz_offset_correction[first_laser];
+
+  for (int i = 0; i < count; ++i) {
+    float distance = raw_distances[i] + dist_corr[i];
+    float cos_rot = cos_rot_table_[rotations[i]];
+    float sin_rot = sin_rot_table_[rotations[i]];
+    // cos(a-b) = cos(a)*cos(b) + sin(a)*sin(b)
+    // sin(a-b) = sin(a)*cos(b) - cos(a)*sin(b)
+    float cos_rot_angle = cos_rot * cos_rot_corr[i] + sin_rot * sin_rot_corr[i];
+    float sin_rot_angle = sin_rot * cos_rot_corr[i] - cos_rot * sin_rot_corr[i];
+    float xy_distance = distance * cos_vert_corr[i];
+    float x = xy_distance * sin_rot_angle - horiz_offset[i] * cos_rot_angle;
+    float y = xy_distance * cos_rot_angle + horiz_offset[i] * sin_rot_angle;
+    float z = distance * sin_vert_corr[i] + vert_offset[i];
+    /** Use standard ROS coordinate system (right-hand rule) */
+    xs[i] = y;
+    ys[i] = -x;
+    zs[i] = z;
+  }
+}
+
 VelodyneParser *VelodyneParserFactory::CreateParser(Config source_config) {
   Config config = source_config;
   if (config.model() == VLP16) {
@@ -57,6 +57,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "modules/drivers/velodyne/parser/calibration.h"
 #include "modules/drivers/velodyne/parser/const_variables.h"
@@ -252,6 +253,18 @@ class VelodyneParser {
   Calibration calibration_;
   float sin_rot_table_[ROTATION_MAX_UNITS];
   float cos_rot_table_[ROTATION_MAX_UNITS];
+  // per-laser calibration constants in structure-of-arrays layout,
+  // indexed by laser id; empty until init_soa_corrections() has run
+  struct SoACorrections {
+    std::vector<float> dist_correction;
+    std::vector<float> cos_rot_correction;
+    std::vector<float> sin_rot_correction;
+    std::vector<float> cos_vert_correction;
+    std::vector<float> sin_vert_correction;
+    std::vector<float> vert_offset_correction;
+    std::vector<float> horiz_offset_correction;
+  };
+  SoACorrections soa_corrections_;
   double last_time_stamp_;
   Config config_;
   // Last Velodyne packet time stamp. (Full time)
@@ -270,6 +283,25 @@ class VelodyneParser {
                      const LaserCorrection& corrections,
                      const uint16_t rotation, PointXYZIT* point);
 
+  /**
+   * \brief Decode a whole firing block of lasers
+   * [first_laser, first_laser + count) into coordinate arrays
+   *
+   * The per-laser corrections are read from soa_corrections_, so the loop
+   * body is straight-line single-precision math the compiler can
+   * vectorize. Does not apply the two-point distance correction; callers
+   * with need_two_pt_correction_ must use ComputeCoords instead.
+   */
+  void ComputeCoordsBlock(const float* raw_distances,
+                          const uint16_t* rotations, int first_laser,
+                          int count, float* xs, float* ys, float* zs);
+
+  /**
+   * \brief Rearrange per-laser calibration constants into
+   * structure-of-arrays form for ComputeCoordsBlock
+   */
+  void init_soa_corrections();
+
   bool is_scan_valid(int rotation, float distance);
 
   /**
@@ -46,8 +46,11 @@ bool CompCameraH265Compressed::Init() {
       AINFO_IF(ret == 0) << "Command execute sucessfuly";
     }
   }
-  pb_image_.reset(new CompressedImage);
-  pb_image_->mutable_data()->reserve(1920 * 1080 * 4);
+  image_ring_.reset(
+      new apollo::drivers::CaptureRing<CompressedImage>(
+          8, [](const std::shared_ptr<CompressedImage>& pb_image) {
+            pb_image->mutable_data()->reserve(1920 * 1080 * 4);
+          }));
 
   writer_ = node_->CreateWriter<CompressedImage>(
       video_config.compress_conf().output_channel());
@@ -71,18 +74,25 @@ void CompCameraH265Compressed::VideoPoll() {
     if (!fout) AERROR << "open " << name << "  fail";
   }
   while (!apollo::cyber::IsShutdown()) {
-    if (camera_deivce_->Poll(pb_image_)) {
-      pb_image_->mutable_header()->set_timestamp_sec(
+    auto pb_image = image_ring_->Acquire();
+    uint64_t overrun_num = image_ring_->overrun_num();
+    if (overrun_num != last_overrun_num_) {
+      AWARN << "image ring overrun, downstream is holding frames, total "
+            << overrun_num;
+      last_overrun_num_ = overrun_num;
+    }
+    if (camera_deivce_->Poll(pb_image)) {
+      pb_image->mutable_header()->set_timestamp_sec(
           cyber::Time::Now().ToSecond());
       AINFO << "Send CompressedImage";
-      writer_->Write(pb_image_);
+      writer_->Write(pb_image);
     } else {
       AERROR << "port " << camera_deivce_->Port() << " h265 poll fail....";
       continue;
     }
 
     if (camera_deivce_->Record()) {
-      fout.write(pb_image_->data().c_str(), pb_image_->data().size());
+      fout.write(pb_image->data().c_str(), pb_image->data().size());
     }
   }
 
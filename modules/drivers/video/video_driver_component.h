@@ -22,6 +22,7 @@
 
 #include "cyber/base/concurrent_object_pool.h"
 #include "cyber/cyber.h"
+#include "modules/drivers/common/capture_ring.h"
 #include "modules/drivers/proto/sensor_image.pb.h"
 #include "modules/drivers/video/driver.h"
 #include "modules/drivers/video/proto/video_h265cfg.pb.h"
@@ -52,7 +53,11 @@ class CompCameraH265Compressed : public Component<> {
   volatile bool runing_;
   std::unique_ptr<CameraDriver> camera_deivce_;
   std::string record_folder_;
-  std::shared_ptr<CompressedImage> pb_image_ = nullptr;
+  // frames are written through the ring so the previous frame may still
+  // be in flight while the next one is being received
+  std::unique_ptr<apollo::drivers::CaptureRing<CompressedImage>>
+      image_ring_;
+  uint64_t last_overrun_num_ = 0;
 };
 
 CYBER_REGISTER_COMPONENT(CompCameraH265Compressed);
@@ -43,6 +43,10 @@ bool GuardianComponent::Init() {
       FLAGS_control_command_topic,
       [this](const std::shared_ptr<ControlCommand>& cmd) {
         ADEBUG << "Received control data: run control callback.";
+        if (guardian_conf_.enable_fast_path_relay()) {
+          RelayControlCommand(cmd);
+          return;
+        }
         std::lock_guard<std::mutex> lock(mutex_);
         control_cmd_.CopyFrom(*cmd);
       });
@@ -68,6 +72,30 @@ bool GuardianComponent::Proc() {
     safety_mode_triggered = system_status_.has_safety_mode_trigger_time();
   }
 
+  if (guardian_conf_.enable_fast_path_relay()) {
+    // the timer acts purely as a deadline watchdog: the relay callback
+    // publishes on arrival, and this path takes over within one timer
+    // interval once safety mode triggers or control commands stop coming
+    if (guardian_conf_.guardian_enable()) {
+      const double now = apollo::cyber::Time::Now().ToSecond();
+      const bool control_command_stale =
+          now - last_control_command_time_.load(std::memory_order_relaxed) >
+          guardian_conf_.control_command_timeout_sec();
+      if (safety_mode_triggered || control_command_stale) {
+        AERROR_IF(control_command_stale && !safety_mode_triggered)
+            << "Control command deadline missed, engage safety mode";
+        safety_mode_engaged_.store(true, std::memory_order_release);
+        TriggerSafetyMode();
+        common::util::FillHeader(node_->Name(), &guardian_cmd_);
+        guardian_writer_->Write(
+            std::make_shared<GuardianCommand>(guardian_cmd_));
+        return true;
+      }
+      safety_mode_engaged_.store(false, std::memory_order_release);
+    }
+    return true;
+  }
+
   if (safety_mode_triggered) {
     ADEBUG << "Safety mode triggered, enable safty mode";
     TriggerSafetyMode();
@@ -86,6 +114,22 @@ void GuardianComponent::PassThroughControlCommand() {
   guardian_cmd_.mutable_control_command()->CopyFrom(control_cmd_);
 }
 
+void GuardianComponent::RelayControlCommand(
+    const std::shared_ptr<ControlCommand>& cmd) {
+  const double recv_time = apollo::cyber::Time::Now().ToSecond();
+  last_control_command_time_.store(recv_time, std::memory_order_relaxed);
+  if (safety_mode_engaged_.load(std::memory_order_acquire)) {
+    // the watchdog owns the channel while safety mode is engaged
+    return;
+  }
+  GuardianCommand guardian_cmd;
+  guardian_cmd.mutable_control_command()->CopyFrom(*cmd);
+  guardian_cmd.set_control_command_recv_time_sec(recv_time);
+  common::util::FillHeader(node_->Name(), &guardian_cmd);
+  guardian_cmd.set_relay_time_sec(apollo::cyber::Time::Now().ToSecond());
+  guardian_writer_->Write(std::make_shared<GuardianCommand>(guardian_cmd));
+}
+
 void GuardianComponent::TriggerSafetyMode() {
   AINFO << "Safety state triggered, with system safety mode trigger time : "
         << system_status_.safety_mode_trigger_time();
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "cyber/common/macros.h"
@@ -48,6 +49,11 @@ class GuardianComponent : public apollo::cyber::TimerComponent {
   void PassThroughControlCommand();
   void TriggerSafetyMode();
 
+  // fast path: relay the control command the moment it arrives, stamped
+  // with its receive and relay times
+  void RelayControlCommand(
+      const std::shared_ptr<apollo::control::ControlCommand>& cmd);
+
   apollo::guardian::GuardianConf guardian_conf_;
   apollo::canbus::Chassis chassis_;
   apollo::monitor::SystemStatus system_status_;
@@ -64,6 +70,11 @@ class GuardianComponent : public apollo::cyber::TimerComponent {
       guardian_writer_;
 
   std::mutex mutex_;
+
+  // shared between the relay callback and the watchdog timer without
+  // touching mutex_ on the actuation path
+  std::atomic<bool> safety_mode_engaged_{false};
+  std::atomic<double> last_control_command_time_{0.0};
 };
 
 CYBER_REGISTER_COMPONENT(GuardianComponent)
@@ -191,6 +191,8 @@ DEFINE_double(ndt_line_search_step_size, 0.1,
               "line search step size for ndt matching");
 DEFINE_double(ndt_transformation_epsilon, 0.01,
               "iteration convergence condition on transformation");
+DEFINE_int32(ndt_num_threads, 4,
+             "number of worker threads for ndt derivative accumulation");
 DEFINE_int32(ndt_filter_size_x, 48, "x size for ndt searching area");
 DEFINE_int32(ndt_filter_size_y, 48, "y size for ndt searching area");
 DEFINE_int32(ndt_bad_score_count_threshold, 10,
@@ -198,3 +200,9 @@ DEFINE_int32(ndt_bad_score_count_threshold, 10,
 DEFINE_double(ndt_warnning_ndt_score, 1.0,
               "warnning ndt fitness score threshold");
 DEFINE_double(ndt_error_ndt_score, 2.0, "error ndt fitness score threshold");
+
+// shared pose block
+DEFINE_bool(enable_shared_pose_block, false,
+            "publish localization pose into a cross-process shm state block");
+DEFINE_int32(shared_pose_shm_key, 0x504F5345,
+             "System V shm key of the shared pose state block");
@@ -0,0 +1,199 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/localization/common/shared_pose_block.h"
+
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+
+#include "Eigen/Core"
+#include "Eigen/Geometry"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace localization {
+
+constexpr int SharedPoseReader::MAX_READ_RETRY;
+constexpr double SharedPoseReader::MAX_EXTRAPOLATION_TIME;
+
+SharedPoseState* AttachSharedPoseState(int shm_key) {
+  int shmid = shmget(static_cast<key_t>(shm_key), sizeof(SharedPoseState),
+                     0644 | IPC_CREAT);
+  if (shmid == -1) {
+    AERROR << "shmget failed, key: " << shm_key
+           << ", error: " << strerror(errno);
+    return nullptr;
+  }
+  void* managed_shm = shmat(shmid, nullptr, 0);
+  if (managed_shm == reinterpret_cast<void*>(-1)) {
+    AERROR << "shmat failed, key: " << shm_key
+           << ", error: " << strerror(errno);
+    return nullptr;
+  }
+  // a freshly created segment is zero-filled, which reads as sequence 0,
+  // i.e. no pose published yet
+  return reinterpret_cast<SharedPoseState*>(managed_shm);
+}
+
+SharedPoseWriter::~SharedPoseWriter() {
+  if (state_ != nullptr) {
+    shmdt(state_);
+    state_ = nullptr;
+  }
+}
+
+bool SharedPoseWriter::Init(int shm_key) {
+  state_ = AttachSharedPoseState(shm_key);
+  return state_ != nullptr;
+}
+
+void SharedPoseWriter::Update(const LocalizationEstimate& localization) {
+  if (state_ == nullptr) {
+    return;
+  }
+  const auto& pose = localization.pose();
+
+  uint64_t sequence = state_->sequence.load(std::memory_order_relaxed);
+  state_->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  SharedPoseData& data = state_->data;
+  data.measurement_time = localization.measurement_time();
+  data.position[0] = pose.position().x();
+  data.position[1] = pose.position().y();
+  data.position[2] = pose.position().z();
+  data.orientation[0] = pose.orientation().qx();
+  data.orientation[1] = pose.orientation().qy();
+  data.orientation[2] = pose.orientation().qz();
+  data.orientation[3] = pose.orientation().qw();
+  data.linear_velocity[0] = pose.linear_velocity().x();
+  data.linear_velocity[1] = pose.linear_velocity().y();
+  data.linear_velocity[2] = pose.linear_velocity().z();
+  data.linear_acceleration[0] = pose.linear_acceleration().x();
+  data.linear_acceleration[1] = pose.linear_acceleration().y();
+  data.linear_acceleration[2] = pose.linear_acceleration().z();
+  data.angular_velocity[0] = pose.angular_velocity().x();
+  data.angular_velocity[1] = pose.angular_velocity().y();
+  data.angular_velocity[2] = pose.angular_velocity().z();
+
+  std::atomic_thread_fence(std::memory_order_release);
+  state_->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+SharedPoseReader::~SharedPoseReader() {
+  if (state_ != nullptr) {
+    shmdt(state_);
+    state_ = nullptr;
+  }
+}
+
+bool SharedPoseReader::Init(int shm_key) {
+  state_ = AttachSharedPoseState(shm_key);
+  return state_ != nullptr;
+}
+
+bool SharedPoseReader::ReadData(SharedPoseData* data) const {
+  if (state_ == nullptr) {
+    return false;
+  }
+  for (int retry = 0; retry < MAX_READ_RETRY; ++retry) {
+    uint64_t sequence = state_->sequence.load(std::memory_order_acquire);
+    if (sequence == 0) {
+      return false;
+    }
+    if (sequence & 1) {
+      continue;
+    }
+    *data = state_->data;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (state_->sequence.load(std::memory_order_relaxed) == sequence) {
+      return true;
+    }
+  }
+  AWARN << "Cannot get a consistent pose snapshot, writer too busy.";
+  return false;
+}
+
+bool SharedPoseReader::GetPoseAtTime(double timestamp_sec, Pose* pose) const {
+  CHECK_NOTNULL(pose);
+  SharedPoseData data;
+  if (!ReadData(&data)) {
+    return false;
+  }
+  const double dt = timestamp_sec - data.measurement_time;
+  if (std::fabs(dt) > MAX_EXTRAPOLATION_TIME) {
+    AWARN << "Query time " << timestamp_sec << " is too far from latest pose "
+          << data.measurement_time << ", diff: " << dt;
+    return false;
+  }
+
+  const Eigen::Vector3d position(data.position[0], data.position[1],
+                                 data.position[2]);
+  const Eigen::Vector3d velocity(data.linear_velocity[0],
+                                 data.linear_velocity[1],
+                                 data.linear_velocity[2]);
+  const Eigen::Vector3d acceleration(data.linear_acceleration[0],
+                                     data.linear_acceleration[1],
+                                     data.linear_acceleration[2]);
+  const Eigen::Vector3d angular_velocity(data.angular_velocity[0],
+                                         data.angular_velocity[1],
+                                         data.angular_velocity[2]);
+
+  const Eigen::Vector3d position_t =
+      position + velocity * dt + 0.5 * acceleration * dt * dt;
+  const Eigen::Vector3d velocity_t = velocity + acceleration * dt;
+
+  Eigen::Quaterniond orientation(data.orientation[3], data.orientation[0],
+                                 data.orientation[1], data.orientation[2]);
+  const double angle = angular_velocity.norm() * dt;
+  if (std::fabs(angle) > 1e-10) {
+    const Eigen::Quaterniond rotation(
+        Eigen::AngleAxisd(angle, angular_velocity.normalized()));
+    orientation = rotation * orientation;
+    orientation.normalize();
+  }
+
+  auto* mutable_position = pose->mutable_position();
+  mutable_position->set_x(position_t[0]);
+  mutable_position->set_y(position_t[1]);
+  mutable_position->set_z(position_t[2]);
+  auto* mutable_orientation = pose->mutable_orientation();
+  mutable_orientation->set_qx(orientation.x());
+  mutable_orientation->set_qy(orientation.y());
+  mutable_orientation->set_qz(orientation.z());
+  mutable_orientation->set_qw(orientation.w());
+  auto* mutable_velocity = pose->mutable_linear_velocity();
+  mutable_velocity->set_x(velocity_t[0]);
+  mutable_velocity->set_y(velocity_t[1]);
+  mutable_velocity->set_z(velocity_t[2]);
+  auto* mutable_acceleration = pose->mutable_linear_acceleration();
+  mutable_acceleration->set_x(acceleration[0]);
+  mutable_acceleration->set_y(acceleration[1]);
+  mutable_acceleration->set_z(acceleration[2]);
+  auto* mutable_angular_velocity = pose->mutable_angular_velocity();
+  mutable_angular_velocity->set_x(angular_velocity[0]);
+  mutable_angular_velocity->set_y(angular_velocity[1]);
+  mutable_angular_velocity->set_z(angular_velocity[2]);
+  return true;
+}
+
+}  // namespace localization
+}  // namespace apollo
@@ -0,0 +1,112 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file shared_pose_block.h
+ * @brief Cross-process lock-free pose extrapolation facility
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "modules/localization/proto/localization.pb.h"
+
+/**
+ * @namespace apollo::localization
+ * @brief apollo::localization
+ */
+namespace apollo {
+namespace localization {
+
+/**@brief The pose payload stored in the shared state block. All fields
+ * are expressed in the map frame. */
+struct SharedPoseData {
+  double measurement_time;
+  double position[3];
+  double orientation[4];  // qx, qy, qz, qw
+  double linear_velocity[3];
+  double linear_acceleration[3];
+  double angular_velocity[3];
+};
+
+/**@brief The state block placed in shared memory. The sequence counter
+ * implements a seqlock: the writer makes it odd before touching the
+ * payload and even afterwards, so readers can detect torn snapshots
+ * without any lock. A value of zero means no pose has been published. */
+struct SharedPoseState {
+  std::atomic<uint64_t> sequence;
+  SharedPoseData data;
+};
+
+/**
+ * @class SharedPoseWriter
+ *
+ * @brief publish the latest localization pose into a shm state block,
+ * readable from other processes at arbitrary query time
+ */
+class SharedPoseWriter {
+ public:
+  SharedPoseWriter() = default;
+  ~SharedPoseWriter();
+
+  /**@brief Create the shm segment if needed and attach the state block. */
+  bool Init(int shm_key);
+  /**@brief Write the pose of the given localization into the block. */
+  void Update(const LocalizationEstimate& localization);
+
+ private:
+  SharedPoseState* state_ = nullptr;
+};
+
+/**
+ * @class SharedPoseReader
+ *
+ * @brief query the shared pose at an arbitrary timestamp; the latest
+ * published pose is extrapolated with its own velocity, acceleration
+ * and angular velocity, so a 100hz consumer gets a fresh pose between
+ * sensor-rate updates without interpolating by itself
+ */
+class SharedPoseReader {
+ public:
+  SharedPoseReader() = default;
+  ~SharedPoseReader();
+
+  /**@brief Create the shm segment if needed and attach the state block. */
+  bool Init(int shm_key);
+  /**@brief Extrapolate the latest pose to the given timestamp. Returns
+   * false when no pose has been published yet or the requested time is
+   * too far from the latest update. */
+  bool GetPoseAtTime(double timestamp_sec, Pose* pose) const;
+
+ private:
+  /**@brief Take a consistent snapshot of the payload. */
+  bool ReadData(SharedPoseData* data) const;
+
+  SharedPoseState* state_ = nullptr;
+
+  static constexpr int MAX_READ_RETRY = 8;
+  static constexpr double MAX_EXTRAPOLATION_TIME = 0.5;
+};
+
+/**@brief Attach the state block at the given key, creating the segment
+ * on first use. Shared by the writer and the reader so either side may
+ * start first. */
+SharedPoseState* AttachSharedPoseState(int shm_key);
+
+}  // namespace localization
+}  // namespace apollo
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/localization/common/shared_pose_block.h"
+
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace localization {
+
+namespace {
+constexpr int kTestShmKey = 0x504F5354;
+}  // namespace
+
+class SharedPoseBlockTest : public ::testing::Test {
+ public:
+  virtual void SetUp() {
+    ASSERT_TRUE(writer_.Init(kTestShmKey));
+    ASSERT_TRUE(reader_.Init(kTestShmKey));
+  }
+  virtual void TearDown() {
+    int shmid = shmget(kTestShmKey, sizeof(SharedPoseState), 0644);
+    if (shmid != -1) {
+      shmctl(shmid, IPC_RMID, nullptr);
+    }
+  }
+
+ protected:
+  SharedPoseWriter writer_;
+  SharedPoseReader reader_;
+};
+
+TEST_F(SharedPoseBlockTest, EmptyBlock) {
+  Pose pose;
+  EXPECT_FALSE(reader_.GetPoseAtTime(0.0, &pose));
+}
+
+TEST_F(SharedPoseBlockTest, Extrapolation) {
+  LocalizationEstimate localization;
+  localization.set_measurement_time(100.0);
+  auto* pose = localization.mutable_pose();
+  pose->mutable_position()->set_x(10.0);
+  pose->mutable_position()->set_y(20.0);
+  pose->mutable_position()->set_z(0.0);
+  pose->mutable_orientation()->set_qx(0.0);
+  pose->mutable_orientation()->set_qy(0.0);
+  pose->mutable_orientation()->set_qz(0.0);
+  pose->mutable_orientation()->set_qw(1.0);
+  pose->mutable_linear_velocity()->set_x(5.0);
+  pose->mutable_linear_velocity()->set_y(0.0);
+  pose->mutable_linear_velocity()->set_z(0.0);
+  pose->mutable_linear_acceleration()->set_x(2.0);
+  pose->mutable_linear_acceleration()->set_y(0.0);
+  pose->mutable_linear_acceleration()->set_z(0.0);
+  pose->mutable_angular_velocity()->set_x(0.0);
+  pose->mutable_angular_velocity()->set_y(0.0);
+  pose->mutable_angular_velocity()->set_z(0.0);
+  writer_.Update(localization);
+
+  Pose query_pose;
+  ASSERT_TRUE(reader_.GetPoseAtTime(100.1, &query_pose));
+  // x(t) = x + v * dt + 0.5 * a * dt^2
+  EXPECT_NEAR(query_pose.position().x(), 10.51, 1e-6);
+  EXPECT_NEAR(query_pose.position().y(), 20.0, 1e-6);
+  EXPECT_NEAR(query_pose.linear_velocity().x(), 5.2, 1e-6);
+  EXPECT_NEAR(query_pose.orientation().qw(), 1.0, 1e-6);
+}
+
+TEST_F(SharedPoseBlockTest, RejectStaleQuery) {
+  LocalizationEstimate localization;
+  localization.set_measurement_time(100.0);
+  localization.mutable_pose()->mutable_orientation()->set_qw(1.0);
+  writer_.Update(localization);
+
+  Pose query_pose;
+  EXPECT_FALSE(reader_.GetPoseAtTime(101.0, &query_pose));
+}
+
+}  // namespace localization
+}  // namespace apollo
@@ -36,8 +36,11 @@ LocalizationIntegProcess::LocalizationIntegProcess()
       ins_pva_(),
       pva_covariance_{0.0},
       keep_running_(false),
-      measure_data_queue_size_(150),
-      delay_output_counter_(0) {}
+      delay_output_counter_(0) {
+  for (int i = 0; i < MEASURE_QUEUE_NUM; ++i) {
+    measure_data_queues_[i].Init(MEASURE_QUEUE_SIZE);
+  }
+}
 
 LocalizationIntegProcess::~LocalizationIntegProcess() {
   StopThreadLoop();
@@ -243,14 +246,23 @@ void LocalizationIntegProcess::GetResult(IntegState *state, InsPva *sins_pva,
 
 void LocalizationIntegProcess::MeasureDataProcess(
     const MeasureData &measure_msg) {
-  measure_data_queue_mutex_.lock();
-  measure_data_queue_.push(measure_msg);
-  measure_data_queue_mutex_.unlock();
+  int queue_index = GNSS_MEASURE_QUEUE;
+  if (measure_msg.measure_type == MeasureType::POINT_CLOUD_POS) {
+    queue_index = LIDAR_MEASURE_QUEUE;
+  } else if (measure_msg.measure_type == MeasureType::GNSS_DOUBLE_ANT_YAW) {
+    queue_index = HEADING_MEASURE_QUEUE;
+  }
+  auto &queue = measure_data_queues_[queue_index];
+  // lock-free enqueue; on overflow drop the oldest entry, matching the
+  // trim policy of the old mutex-guarded queue
+  MeasureData dropped;
+  while (!queue.Enqueue(measure_msg)) {
+    queue.Dequeue(&dropped);
+  }
 }
 
 void LocalizationIntegProcess::StartThreadLoop() {
   keep_running_ = true;
-  measure_data_queue_size_ = 150;
   cyber::Async(&LocalizationIntegProcess::MeasureDataThreadLoop, this);
 }
 
@@ -262,35 +274,40 @@ void LocalizationIntegProcess::StopThreadLoop() {
 
 void LocalizationIntegProcess::MeasureDataThreadLoop() {
   AINFO << "Started measure data process thread";
+  MeasureData staged_measure[MEASURE_QUEUE_NUM];
+  bool staged_valid[MEASURE_QUEUE_NUM] = {false};
   while (keep_running_.load()) {
-    {
-      std::unique_lock<std::mutex> lock(measure_data_queue_mutex_);
-      int size = static_cast<int>(measure_data_queue_.size());
-      while (size > measure_data_queue_size_) {
-        measure_data_queue_.pop();
-        --size;
-      }
-      if (measure_data_queue_.empty()) {
-        lock.unlock();
-        cyber::Yield();
-        continue;
+    // refill the staging slot of every ring, then fuse the staged
+    // measurement with the smallest timestamp so the update order is
+    // deterministic regardless of producer scheduling
+    bool any_staged = false;
+    int waiting_num = 0;
+    for (int i = 0; i < MEASURE_QUEUE_NUM; ++i) {
+      if (!staged_valid[i]) {
+        staged_valid[i] = measure_data_queues_[i].Dequeue(&staged_measure[i]);
       }
+      any_staged = any_staged || staged_valid[i];
+      waiting_num += static_cast<int>(measure_data_queues_[i].Size());
     }
-
-    MeasureData measure;
-    int waiting_num = 0;
-    {
-      std::unique_lock<std::mutex> lock(measure_data_queue_mutex_);
-      measure = measure_data_queue_.front();
-      measure_data_queue_.pop();
-      waiting_num = static_cast<int>(measure_data_queue_.size());
+    if (!any_staged) {
+      cyber::Yield();
+      continue;
     }
 
-    if (waiting_num > measure_data_queue_size_ / 4) {
+    if (waiting_num > MEASURE_QUEUE_SIZE / 4) {
       AWARN << waiting_num << " measure are waiting to process.";
     }
 
-    MeasureDataProcessImpl(measure);
+    int earliest = -1;
+    for (int i = 0; i < MEASURE_QUEUE_NUM; ++i) {
+      if (staged_valid[i] &&
+          (earliest < 0 ||
+           staged_measure[i].time < staged_measure[earliest].time)) {
+        earliest = i;
+      }
+    }
+    staged_valid[earliest] = false;
+    MeasureDataProcessImpl(staged_measure[earliest]);
   }
   AINFO << "Exited measure data process thread";
 }
@@ -16,11 +16,11 @@
 
 #pragma once
 
-#include <queue>
 #include <string>
 
 #include "Eigen/Core"
 #include "Eigen/Geometry"
+#include "cyber/base/bounded_queue.h"
 #include "cyber/cyber.h"
 
 #include "include/sins.h"
@@ -65,6 +65,15 @@ class LocalizationIntegProcess {
   void MeasureDataProcess(const MeasureData &measure_msg);
 
  private:
+  // one lock-free ring per measurement source, so producers on different
+  // reader threads never contend on a shared mutex
+  enum MeasureQueueIndex {
+    LIDAR_MEASURE_QUEUE = 0,
+    GNSS_MEASURE_QUEUE,
+    HEADING_MEASURE_QUEUE,
+    MEASURE_QUEUE_NUM
+  };
+
   bool CheckIntegMeasureData(const MeasureData &measure_data);
 
   bool LoadGnssAntennaExtrinsic(const std::string &file_path,
@@ -90,9 +99,9 @@ class LocalizationIntegProcess {
   double pva_covariance_[9][9];
 
   std::atomic<bool> keep_running_;
-  std::queue<MeasureData> measure_data_queue_;
-  int measure_data_queue_size_ = 150;
-  std::mutex measure_data_queue_mutex_;
+  cyber::base::BoundedQueue<MeasureData> measure_data_queues_
+      [MEASURE_QUEUE_NUM];
+  static constexpr int MEASURE_QUEUE_SIZE = 150;
 
   int delay_output_counter_ = 0;
 };
@@ -36,7 +36,7 @@ MeasureRepublishProcess::MeasureRepublishProcess()
     : pre_bestgnsspose_(),
       pre_bestgnsspose_valid_(false),
       send_init_bestgnsspose_(false),
-      pva_buffer_size_(150),
+      integ_pva_count_(0),
       local_utm_zone_id_(50),
       is_trans_gpstime_to_utctime_(true),
       map_height_time_(0.0),
@@ -49,8 +49,6 @@ Status MeasureRepublishProcess::Init(const LocalizationIntegParam& params) {
   is_trans_gpstime_to_utctime_ = params.is_trans_gpstime_to_utctime;
   gnss_mode_ = GnssMode(params.gnss_mode);
 
-  pva_buffer_size_ = 150;
-
   map_height_time_ = 0.0;
 
   novatel_heading_time_ = 0.0;
@@ -220,11 +218,9 @@ void MeasureRepublishProcess::GnssLocalProcess(
 
   if (is_sins_align) {
     measure_data.measure_type = MeasureType::GNSS_POS_ONLY;
-    height_mutex_.lock();
-    if ((measure_data.time - 1.0 < map_height_time_)) {
+    if (measure_data.time - 1.0 < map_height_time_.load()) {
       measure_data.measure_type = MeasureType::GNSS_POS_XY;
     }
-    height_mutex_.unlock();
     measure_data.is_have_variance = true;
   } else {
     measure_data.measure_type = MeasureType::GNSS_POS_VEL;
@@ -320,15 +316,23 @@ void MeasureRepublishProcess::GnssLocalProcess(
 }
 
 void MeasureRepublishProcess::IntegPvaProcess(const InsPva& inspva_msg) {
-  const InsPva& integ_pva = inspva_msg;
+  uint64_t count = integ_pva_count_.load(std::memory_order_relaxed);
+  integ_pva_ring_[count % INTEG_PVA_RING_SIZE] = inspva_msg;
+  integ_pva_count_.store(count + 1, std::memory_order_release);
+}
 
-  std::lock_guard<std::mutex> lock(integ_pva_mutex_);
-  if (integ_pva_list_.size() < pva_buffer_size_) {
-    integ_pva_list_.push_back(integ_pva);
-  } else {
-    integ_pva_list_.pop_front();
-    integ_pva_list_.push_back(integ_pva);
+bool MeasureRepublishProcess::GetLatestIntegPva(InsPva* pva) {
+  uint64_t count = integ_pva_count_.load(std::memory_order_acquire);
+  while (count > 0) {
+    *pva = integ_pva_ring_[(count - 1) % INTEG_PVA_RING_SIZE];
+    uint64_t new_count = integ_pva_count_.load(std::memory_order_acquire);
+    if (new_count - count < INTEG_PVA_RING_SIZE) {
+      // the slot was not overwritten while we copied it
+      return true;
+    }
+    count = new_count;
   }
+  return false;
 }
 
 bool MeasureRepublishProcess::LidarLocalProcess(
@@ -355,13 +359,7 @@ bool MeasureRepublishProcess::LidarLocalProcess(
   common::math::EulerAnglesZXYd euler(temp_quat.w(), temp_quat.x(),
                                       temp_quat.y(), temp_quat.z());
 
-  height_mutex_.lock();
-  Eigen::Vector3d trans(lidar_local_msg.pose().position().x(),
-                        lidar_local_msg.pose().position().y(),
-                        lidar_local_msg.pose().position().z());
-
   map_height_time_ = measure_data.time;
-  height_mutex_.unlock();
 
   measure_data.gnss_att.yaw = euler.yaw();
   measure_data.measure_type = MeasureType::POINT_CLOUD_POS;
@@ -396,8 +394,8 @@ bool MeasureRepublishProcess::LidarLocalProcess(
 }
 
 bool MeasureRepublishProcess::IsSinsAlign() {
-  std::lock_guard<std::mutex> lock(integ_pva_mutex_);
-  return !integ_pva_list_.empty() && integ_pva_list_.back().init_and_alignment;
+  InsPva latest_pva;
+  return GetLatestIntegPva(&latest_pva) && latest_pva.init_and_alignment;
 }
 
 void MeasureRepublishProcess::TransferXYZFromBestgnsspose(
@@ -423,11 +421,9 @@ void MeasureRepublishProcess::TransferXYZFromBestgnsspose(
 
   measure->measure_type = MeasureType::GNSS_POS_ONLY;
   measure->frame_type = FrameType::ENU;
-  height_mutex_.lock();
-  if ((measure->time - 1.0 < map_height_time_)) {
+  if (measure->time - 1.0 < map_height_time_.load()) {
     measure->measure_type = MeasureType::GNSS_POS_XY;
   }
-  height_mutex_.unlock();
   measure->is_have_variance = true;
   return;
 }
@@ -561,14 +557,10 @@ bool MeasureRepublishProcess::GnssHeadingProcess(
     measure_data->time = GpsToUnixSeconds(measure_data->time);
   }
 
-  novatel_heading_mutex_.lock();
   novatel_heading_time_ = measure_data->time;
-  novatel_heading_mutex_.unlock();
 
-  double delta_time_between_height = 0.0;
-  height_mutex_.lock();
-  delta_time_between_height = measure_data->time - map_height_time_;
-  height_mutex_.unlock();
+  double delta_time_between_height =
+      measure_data->time - map_height_time_.load();
 
   if (delta_time_between_height < 1.0) {
     AINFO << "the heading time and delta time: " << std::setprecision(15)
@@ -576,10 +568,10 @@ bool MeasureRepublishProcess::GnssHeadingProcess(
     return false;
   }
 
-  integ_pva_mutex_.lock();
-  bool is_sins_align =
-      integ_pva_list_.back().init_and_alignment && (integ_pva_list_.size() > 1);
-  integ_pva_mutex_.unlock();
+  InsPva latest_pva;
+  bool is_sins_align = GetLatestIntegPva(&latest_pva) &&
+                       latest_pva.init_and_alignment &&
+                       integ_pva_count_.load(std::memory_order_acquire) > 1;
 
   if (is_sins_align) {
     static double pre_publish_time = 0.0;
@@ -21,8 +21,8 @@
 
 #pragma once
 
-#include <list>
-#include <mutex>
+#include <atomic>
+#include <cstdint>
 #include <string>
 
 #include "Eigen/Core"
@@ -84,6 +84,7 @@ class MeasureRepublishProcess {
 
  protected:
   bool IsSinsAlign();
+  bool GetLatestIntegPva(InsPva* pva);
   bool CheckBestgnssposeStatus(const GnssBestPose& bestgnsspos_msg);
   bool CheckBestgnssPoseXYStd(const GnssBestPose& bestgnsspos_msg);
   void TransferXYZFromBestgnsspose(const GnssBestPose& bestgnsspos_msg,
@@ -101,19 +102,21 @@ class MeasureRepublishProcess {
   bool pre_bestgnsspose_valid_;
   bool send_init_bestgnsspose_;
 
-  std::list<InsPva> integ_pva_list_;
-  size_t pva_buffer_size_;
-  std::mutex integ_pva_mutex_;
+  // latest-value ring written only by the 200Hz imu thread in
+  // IntegPvaProcess; readers copy the newest slot through
+  // GetLatestIntegPva and retry when the writer laps them, so the imu
+  // path never takes a mutex
+  static constexpr size_t INTEG_PVA_RING_SIZE = 8;
+  InsPva integ_pva_ring_[INTEG_PVA_RING_SIZE];
+  std::atomic<uint64_t> integ_pva_count_;
 
   int local_utm_zone_id_;
   bool is_trans_gpstime_to_utctime_;
 
-  double map_height_time_;
-  std::mutex height_mutex_;
+  std::atomic<double> map_height_time_;
 
   bool is_using_novatel_heading_;
-  double novatel_heading_time_;
-  std::mutex novatel_heading_mutex_;
+  std::atomic<double> novatel_heading_time_;
 
   GnssMode gnss_mode_;
 
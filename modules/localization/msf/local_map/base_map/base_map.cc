@@ -16,6 +16,8 @@
 
 #include "modules/localization/msf/local_map/base_map/base_map.h"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -274,6 +276,24 @@ void BaseMap::PreloadMapArea(const Eigen::Vector3d& location,
   std::set<MapNodeIndex> map_ids;
   float map_pixel_resolution =
       this->map_config_->map_resolutions_[resolution_id];
+  // velocity-extrapolated look-ahead: with the fixed 1.5 node margin a
+  // fast vehicle crosses the next tile boundary before the ~100ms load
+  // finishes, so extend the horizon with the per-frame translation,
+  // clamped to keep the preload set within the cacheL2 capacity
+  const double kPreloadHorizonFrames = 10.0;
+  const double kPreloadMaxNodeRad = 3.0;
+  const double node_rad_x = static_cast<double>(
+      this->map_config_->map_node_size_x_ * map_pixel_resolution);
+  const double node_rad_y = static_cast<double>(
+      this->map_config_->map_node_size_y_ * map_pixel_resolution);
+  const double lookahead_x =
+      std::min(std::max(std::abs(trans_diff[0]) * kPreloadHorizonFrames,
+                        1.5 * node_rad_x),
+               kPreloadMaxNodeRad * node_rad_x);
+  const double lookahead_y =
+      std::min(std::max(std::abs(trans_diff[1]) * kPreloadHorizonFrames,
+                        1.5 * node_rad_y),
+               kPreloadMaxNodeRad * node_rad_y);
   /// top left
   Eigen::Vector3d pt_top_left;
   pt_top_left[0] =
@@ -359,40 +379,36 @@ void BaseMap::PreloadMapArea(const Eigen::Vector3d& location,
                                          resolution_id, zone_id);
   map_ids.insert(map_id);
 
-  for (int i = -1; i < 2; ++i) {
-    Eigen::Vector3d pt;
-    pt[0] = location[0] + x_direction * 1.5 *
-                              this->map_config_->map_node_size_x_ *
-                              map_pixel_resolution;
-    pt[1] = location[1] + static_cast<double>(i) *
-                              this->map_config_->map_node_size_y_ *
-                              map_pixel_resolution;
-    pt[2] = 0;
-    map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
-                                           resolution_id, zone_id);
-    map_ids.insert(map_id);
+  // preload every node row crossed up to the look-ahead distance, so a
+  // fast vehicle does not skip over an unfetched intermediate tile
+  for (double dist = 1.5 * node_rad_x; dist <= lookahead_x + 1e-6;
+       dist += node_rad_x) {
+    for (int i = -1; i < 2; ++i) {
+      Eigen::Vector3d pt;
+      pt[0] = location[0] + x_direction * dist;
+      pt[1] = location[1] + static_cast<double>(i) * node_rad_y;
+      pt[2] = 0;
+      map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
+                                             resolution_id, zone_id);
+      map_ids.insert(map_id);
+    }
   }
-  for (int i = -1; i < 2; ++i) {
-    Eigen::Vector3d pt;
-    pt[0] = location[0] + static_cast<double>(i) *
-                              this->map_config_->map_node_size_x_ *
-                              map_pixel_resolution;
-    pt[1] = location[1] + y_direction * 1.5 *
-                              this->map_config_->map_node_size_y_ *
-                              map_pixel_resolution;
-    pt[2] = 0;
-    map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
-                                           resolution_id, zone_id);
-    map_ids.insert(map_id);
+  for (double dist = 1.5 * node_rad_y; dist <= lookahead_y + 1e-6;
+       dist += node_rad_y) {
+    for (int i = -1; i < 2; ++i) {
+      Eigen::Vector3d pt;
+      pt[0] = location[0] + static_cast<double>(i) * node_rad_x;
+      pt[1] = location[1] + y_direction * dist;
+      pt[2] = 0;
+      map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
+                                             resolution_id, zone_id);
+      map_ids.insert(map_id);
+    }
   }
   {
     Eigen::Vector3d pt;
-    pt[0] = location[0] + x_direction * 1.5 *
-                              this->map_config_->map_node_size_x_ *
-                              map_pixel_resolution;
-    pt[1] = location[1] + y_direction * 1.5 *
-                              this->map_config_->map_node_size_y_ *
-                              map_pixel_resolution;
+    pt[0] = location[0] + x_direction * lookahead_x;
+    pt[1] = location[1] + y_direction * lookahead_y;
     pt[2] = 0;
     map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
                                            resolution_id, zone_id);
@@ -58,6 +58,7 @@ void LidarLocatorNdt::Init(const Eigen::Affine3d& init_location,
   ndt_target_resolution_ = FLAGS_ndt_target_resolution;
   ndt_line_search_step_size_ = FLAGS_ndt_line_search_step_size;
   ndt_transformation_epsilon_ = FLAGS_ndt_transformation_epsilon;
+  ndt_num_threads_ = FLAGS_ndt_num_threads;
 
   if (!is_map_loaded_) {
     map_preload_node_pool_.Initial(&(map_.GetConfig()));
@@ -84,6 +85,7 @@ void LidarLocatorNdt::Init(const Eigen::Affine3d& init_location,
   reg_.SetResolution(static_cast<float>(ndt_target_resolution_));
   reg_.SetStepSize(ndt_line_search_step_size_);
   reg_.SetTransformationEpsilon(ndt_transformation_epsilon_);
+  reg_.SetNumThreads(static_cast<unsigned int>(std::max(ndt_num_threads_, 1)));
 
   is_initialized_ = true;
 }
@@ -189,6 +189,12 @@ class NormalDistributionsTransform {
     max_iterations_ = nr_iterations;
   }
 
+  /**@brief Set/change the number of worker threads used to accumulate the
+   * per-point score, gradient and hessian contributions. */
+  inline void SetNumThreads(unsigned int num_threads) {
+    num_threads_ = num_threads > 0 ? num_threads : 1;
+  }
+
   /**@brief Set the transformation epsilon (maximum allowable difference
    * between two consecutive transformations. */
   inline void SetTransformationEpsilon(double epsilon) {
@@ -254,6 +260,16 @@ class NormalDistributionsTransform {
                             Eigen::Matrix<double, 6, 1> *p,
                             bool ComputeHessian = true);
 
+  /**@brief Accumulate the derivative contributions of the source points in
+   * index range [idx_begin, idx_end), used as the per-thread body of
+   * ComputeDerivatives. Accumulators are thread local; only the angular
+   * derivatives and the voxel grid are shared and read-only. */
+  double ComputeDerivativesRange(Eigen::Matrix<double, 6, 1> *score_gradient,
+                                 Eigen::Matrix<double, 6, 6> *hessian,
+                                 const PointCloudSource &trans_cloud,
+                                 size_t idx_begin, size_t idx_end,
+                                 bool ComputeHessian);
+
   /**@brief Compute individual point contirbutions to derivatives of
    * probability function w.r.t. the transformation vector. */
   double UpdateDerivatives(Eigen::Matrix<double, 6, 1> *score_gradient,
@@ -262,6 +278,16 @@ class NormalDistributionsTransform {
                            const Eigen::Matrix3d &c_inv,
                            bool ComputeHessian = true);
 
+  /**@brief Stateless variant of UpdateDerivatives operating on the caller's
+   * point derivatives, safe to run concurrently. */
+  double UpdateDerivatives(Eigen::Matrix<double, 6, 1> *score_gradient,
+                           Eigen::Matrix<double, 6, 6> *hessian,
+                           const Eigen::Vector3d &x_trans,
+                           const Eigen::Matrix3d &c_inv,
+                           const Eigen::Matrix<double, 3, 6> &point_gradient,
+                           const Eigen::Matrix<double, 18, 6> &point_hessian,
+                           bool ComputeHessian = true) const;
+
   /**@brief Precompute anglular components of derivatives. */
   void ComputeAngleDerivatives(const Eigen::Matrix<double, 6, 1> &p,
                                bool ComputeHessian = true);
@@ -270,18 +296,40 @@ class NormalDistributionsTransform {
   void ComputePointDerivatives(const Eigen::Vector3d &x,
                                bool ComputeHessian = true);
 
+  /**@brief Stateless variant of ComputePointDerivatives writing into the
+   * caller's matrices, safe to run concurrently. */
+  void ComputePointDerivatives(const Eigen::Vector3d &x,
+                               Eigen::Matrix<double, 3, 6> *point_gradient,
+                               Eigen::Matrix<double, 18, 6> *point_hessian,
+                               bool ComputeHessian = true) const;
+
   /**@brief Compute hessian of probability function w.r.t. the transformation
    * vector. */
   void ComputeHessian(Eigen::Matrix<double, 6, 6> *hessian,
                       const PointCloudSource &trans_cloud,
                       Eigen::Matrix<double, 6, 1> *p);
 
+  /**@brief Accumulate the hessian contributions of the source points in
+   * index range [idx_begin, idx_end), used as the per-thread body of
+   * ComputeHessian. */
+  void ComputeHessianRange(Eigen::Matrix<double, 6, 6> *hessian,
+                           const PointCloudSource &trans_cloud,
+                           size_t idx_begin, size_t idx_end);
+
   /**@brief Compute individual point contirbutions to hessian of probability
    * function. */
   void UpdateHessian(Eigen::Matrix<double, 6, 6> *hessian,
                      const Eigen::Vector3d &x_trans,
                      const Eigen::Matrix3d &c_inv);
 
+  /**@brief Stateless variant of UpdateHessian operating on the caller's
+   * point derivatives, safe to run concurrently. */
+  void UpdateHessian(Eigen::Matrix<double, 6, 6> *hessian,
+                     const Eigen::Vector3d &x_trans,
+                     const Eigen::Matrix3d &c_inv,
+                     const Eigen::Matrix<double, 3, 6> &point_gradient,
+                     const Eigen::Matrix<double, 18, 6> &point_hessian) const;
+
   /**@brief Compute line search step length and update transform and probability
    * derivatives. */
   double ComputeStepLengthMt(const Eigen::Matrix<double, 6, 1> &x,
@@ -338,6 +386,8 @@ class NormalDistributionsTransform {
 
   /**@brief max iterations. */
   int max_iterations_;
+  /**@brief number of worker threads for derivative accumulation. */
+  unsigned int num_threads_;
   /**@brief Transformation epsilon parameter. */
   double transformation_epsilon_;
   /**@brief The side length of voxels. */
@@ -56,6 +56,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <thread>
 #include <vector>
 
 namespace apollo {
@@ -206,6 +207,7 @@ NormalDistributionsTransform<PointSource,
 
   transformation_epsilon_ = 0.1;
   max_iterations_ = 35;
+  num_threads_ = 1;
 }
 
 template <typename PointSource, typename PointTarget>
@@ -324,6 +326,64 @@ NormalDistributionsTransform<PointSource, PointTarget>::ComputeDerivatives(
     Eigen::Matrix<double, 6, 1> *score_gradient,
     Eigen::Matrix<double, 6, 6> *hessian, PointCloudSourcePtr trans_cloud,
     Eigen::Matrix<double, 6, 1> *p, bool compute_hessian) {
+  score_gradient->setZero();
+  hessian->setZero();
+
+  // Precompute Angular Derivatives (eq. 6.19 and 6.21)[Magnusson 2009].
+  // They are read-only below, so the point loop can run in parallel.
+  ComputeAngleDerivatives(*p);
+
+  size_t nr_points = input_->points.size();
+  size_t nr_threads =
+      std::min(static_cast<size_t>(std::max(num_threads_, 1u)), nr_points);
+  if (nr_threads <= 1) {
+    return ComputeDerivativesRange(score_gradient, hessian, *trans_cloud, 0,
+                                   nr_points, compute_hessian);
+  }
+
+  // Split the cloud into chunks, accumulate into per-thread gradients and
+  // hessians and reduce after the join, line 17 in Algorithm 2 [Magnusson
+  // 2009]
+  std::vector<double> scores(nr_threads, 0.0);
+  std::vector<Eigen::Matrix<double, 6, 1>,
+              Eigen::aligned_allocator<Eigen::Matrix<double, 6, 1>>>
+      score_gradients(nr_threads, Eigen::Matrix<double, 6, 1>::Zero());
+  std::vector<Eigen::Matrix<double, 6, 6>,
+              Eigen::aligned_allocator<Eigen::Matrix<double, 6, 6>>>
+      hessians(nr_threads, Eigen::Matrix<double, 6, 6>::Zero());
+  std::vector<std::thread> workers;
+  workers.reserve(nr_threads);
+  size_t chunk_size = (nr_points + nr_threads - 1) / nr_threads;
+  for (size_t t = 0; t < nr_threads; ++t) {
+    size_t idx_begin = t * chunk_size;
+    size_t idx_end = std::min(idx_begin + chunk_size, nr_points);
+    workers.emplace_back([this, t, idx_begin, idx_end, &scores,
+                          &score_gradients, &hessians, &trans_cloud,
+                          compute_hessian]() {
+      scores[t] =
+          ComputeDerivativesRange(&score_gradients[t], &hessians[t],
+                                  *trans_cloud, idx_begin, idx_end,
+                                  compute_hessian);
+    });
+  }
+  double score = 0;
+  for (size_t t = 0; t < nr_threads; ++t) {
+    workers[t].join();
+    score += scores[t];
+    *score_gradient += score_gradients[t];
+    *hessian += hessians[t];
+  }
+  return (score);
+}
+
+template <typename PointSource, typename PointTarget>
+double
+NormalDistributionsTransform<PointSource, PointTarget>::
+    ComputeDerivativesRange(Eigen::Matrix<double, 6, 1> *score_gradient,
+                            Eigen::Matrix<double, 6, 6> *hessian,
+                            const PointCloudSource &trans_cloud,
+                            size_t idx_begin, size_t idx_end,
+                            bool compute_hessian) {
   // Original Point and Transformed Point
   PointSource x_pt, x_trans_pt;
   // Original Point and Transformed Point (for math)
@@ -332,18 +392,19 @@ NormalDistributionsTransform<PointSource, PointTarget>::ComputeDerivatives(
   TargetGridLeafConstPtr cell;
   // Inverse Covariance of Occupied Voxel
   Eigen::Matrix3d c_inv;
+  // Thread local point derivatives, Equations 6.18 and 6.20 [Magnusson 2009]
+  Eigen::Matrix<double, 3, 6> point_gradient;
+  Eigen::Matrix<double, 18, 6> point_hessian;
+  point_gradient.setZero();
+  point_gradient.block<3, 3>(0, 0).setIdentity();
+  point_hessian.setZero();
 
-  score_gradient->setZero();
-  hessian->setZero();
   double score = 0;
 
-  // Precompute Angular Derivatives (eq. 6.19 and 6.21)[Magnusson 2009]
-  ComputeAngleDerivatives(*p);
-
   // Update gradient and hessian for each point, line 17 in Algorithm 2
   // [Magnusson 2009]
-  for (size_t idx = 0; idx < input_->points.size(); idx++) {
-    x_trans_pt = trans_cloud->points[idx];
+  for (size_t idx = idx_begin; idx < idx_end; idx++) {
+    x_trans_pt = trans_cloud.points[idx];
 
     // Find nieghbors (Radius search has been experimentally faster than
     // direct neighbor checking.
@@ -368,11 +429,13 @@ NormalDistributionsTransform<PointSource, PointTarget>::ComputeDerivatives(
 
       // Compute derivative of transform function w.r.t. transform vector,
       // J_E and H_E in Equations 6.18 and 6.20 [Magnusson 2009]
-      ComputePointDerivatives(x);
+      ComputePointDerivatives(x, &point_gradient, &point_hessian,
+                              compute_hessian);
       // Update score, gradient and hessian, lines 19-21 in Algorithm 2,
       // according to Equations 6.10, 6.12 and 6.13, respectively [Magnusson
       // 2009]
       score += UpdateDerivatives(score_gradient, hessian, x_trans, c_inv,
+                                 point_gradient, point_hessian,
                                  compute_hessian);
     }
   }
@@ -453,17 +516,27 @@ template <typename PointSource, typename PointTarget>
 void NormalDistributionsTransform<
     PointSource, PointTarget>::ComputePointDerivatives(const Eigen::Vector3d &x,
                                                        bool compute_hessian) {
+  ComputePointDerivatives(x, &point_gradient_, &point_hessian_,
+                          compute_hessian);
+}
+
+template <typename PointSource, typename PointTarget>
+void NormalDistributionsTransform<PointSource, PointTarget>::
+    ComputePointDerivatives(const Eigen::Vector3d &x,
+                            Eigen::Matrix<double, 3, 6> *point_gradient,
+                            Eigen::Matrix<double, 18, 6> *point_hessian,
+                            bool compute_hessian) const {
   // Calculate first derivative of Transformation Equation 6.17 w.r.t. transform
   // vector p. Derivative w.r.t. ith element of transform vector corresponds to
   // column i, Equation 6.18 and 6.19 [Magnusson 2009]
-  point_gradient_(1, 3) = x.dot(j_ang_a_);
-  point_gradient_(2, 3) = x.dot(j_ang_b_);
-  point_gradient_(0, 4) = x.dot(j_ang_c_);
-  point_gradient_(1, 4) = x.dot(j_ang_d_);
-  point_gradient_(2, 4) = x.dot(j_ang_e_);
-  point_gradient_(0, 5) = x.dot(j_ang_f_);
-  point_gradient_(1, 5) = x.dot(j_ang_g_);
-  point_gradient_(2, 5) = x.dot(j_ang_h_);
+  (*point_gradient)(1, 3) = x.dot(j_ang_a_);
+  (*point_gradient)(2, 3) = x.dot(j_ang_b_);
+  (*point_gradient)(0, 4) = x.dot(j_ang_c_);
+  (*point_gradient)(1, 4) = x.dot(j_ang_d_);
+  (*point_gradient)(2, 4) = x.dot(j_ang_e_);
+  (*point_gradient)(0, 5) = x.dot(j_ang_f_);
+  (*point_gradient)(1, 5) = x.dot(j_ang_g_);
+  (*point_gradient)(2, 5) = x.dot(j_ang_h_);
 
   if (compute_hessian) {
     // Vectors from Equation 6.21 [Magnusson 2009]
@@ -480,15 +553,15 @@ void NormalDistributionsTransform<
     // transform vector p. Derivative w.r.t. ith and jth elements of transform
     // vector corresponds to the 3x1 block matrix starting at (3i,j),
     // Equation 6.20 and 6.21 [Magnusson 2009]
-    point_hessian_.block<3, 1>(9, 3) = a;
-    point_hessian_.block<3, 1>(12, 3) = b;
-    point_hessian_.block<3, 1>(15, 3) = c;
-    point_hessian_.block<3, 1>(9, 4) = b;
-    point_hessian_.block<3, 1>(12, 4) = d;
-    point_hessian_.block<3, 1>(15, 4) = e;
-    point_hessian_.block<3, 1>(9, 5) = c;
-    point_hessian_.block<3, 1>(12, 5) = e;
-    point_hessian_.block<3, 1>(15, 5) = f;
+    point_hessian->block<3, 1>(9, 3) = a;
+    point_hessian->block<3, 1>(12, 3) = b;
+    point_hessian->block<3, 1>(15, 3) = c;
+    point_hessian->block<3, 1>(9, 4) = b;
+    point_hessian->block<3, 1>(12, 4) = d;
+    point_hessian->block<3, 1>(15, 4) = e;
+    point_hessian->block<3, 1>(9, 5) = c;
+    point_hessian->block<3, 1>(12, 5) = e;
+    point_hessian->block<3, 1>(15, 5) = f;
   }
 }
 
@@ -498,6 +571,19 @@ NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
     Eigen::Matrix<double, 6, 1> *score_gradient,
     Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
     const Eigen::Matrix3d &c_inv, bool compute_hessian) {
+  return UpdateDerivatives(score_gradient, hessian, x_trans, c_inv,
+                           point_gradient_, point_hessian_, compute_hessian);
+}
+
+template <typename PointSource, typename PointTarget>
+double
+NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
+    Eigen::Matrix<double, 6, 1> *score_gradient,
+    Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
+    const Eigen::Matrix3d &c_inv,
+    const Eigen::Matrix<double, 3, 6> &point_gradient,
+    const Eigen::Matrix<double, 18, 6> &point_hessian,
+    bool compute_hessian) const {
   Eigen::Vector3d cov_dxd_pi;
   // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9 [Magnusson
   // 2009]
@@ -519,7 +605,7 @@ NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
   for (int i = 0; i < 6; i++) {
     // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13
     // [Magnusson 2009]
-    cov_dxd_pi = c_inv * point_gradient_.col(i);
+    cov_dxd_pi = c_inv * point_gradient.col(i);
 
     // Update gradient, Equation 6.12 [Magnusson 2009]
     (*score_gradient)(i) += x_trans.dot(cov_dxd_pi) * e_x_cov_x;
@@ -530,9 +616,9 @@ NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
         (*hessian)(i, j) +=
             e_x_cov_x *
             (-gauss_d2_ * x_trans.dot(cov_dxd_pi) *
-                 x_trans.dot(c_inv * point_gradient_.col(j)) +
-             x_trans.dot(c_inv * point_hessian_.block<3, 1>(3 * i, j)) +
-             point_gradient_.col(j).dot(cov_dxd_pi));
+                 x_trans.dot(c_inv * point_gradient.col(j)) +
+             x_trans.dot(c_inv * point_hessian.block<3, 1>(3 * i, j)) +
+             point_gradient.col(j).dot(cov_dxd_pi));
       }
     }
   }
@@ -544,6 +630,46 @@ template <typename PointSource, typename PointTarget>
 void NormalDistributionsTransform<PointSource, PointTarget>::ComputeHessian(
     Eigen::Matrix<double, 6, 6> *hessian, const PointCloudSource &trans_cloud,
     Eigen::Matrix<double, 6, 1> *p) {
+  hessian->setZero();
+
+  // Precompute Angular Derivatives unessisary because only used after regular
+  // derivative calculation
+
+  size_t nr_points = input_->points.size();
+  size_t nr_threads =
+      std::min(static_cast<size_t>(std::max(num_threads_, 1u)), nr_points);
+  if (nr_threads <= 1) {
+    ComputeHessianRange(hessian, trans_cloud, 0, nr_points);
+    return;
+  }
+
+  // Same chunked accumulation with per-thread reduction as in
+  // ComputeDerivatives
+  std::vector<Eigen::Matrix<double, 6, 6>,
+              Eigen::aligned_allocator<Eigen::Matrix<double, 6, 6>>>
+      hessians(nr_threads, Eigen::Matrix<double, 6, 6>::Zero());
+  std::vector<std::thread> workers;
+  workers.reserve(nr_threads);
+  size_t chunk_size = (nr_points + nr_threads - 1) / nr_threads;
+  for (size_t t = 0; t < nr_threads; ++t) {
+    size_t idx_begin = t * chunk_size;
+    size_t idx_end = std::min(idx_begin + chunk_size, nr_points);
+    workers.emplace_back(
+        [this, t, idx_begin, idx_end, &hessians, &trans_cloud]() {
+          ComputeHessianRange(&hessians[t], trans_cloud, idx_begin, idx_end);
+        });
+  }
+  for (size_t t = 0; t < nr_threads; ++t) {
+    workers[t].join();
+    *hessian += hessians[t];
+  }
+}
+
+template <typename PointSource, typename PointTarget>
+void NormalDistributionsTransform<PointSource, PointTarget>::
+    ComputeHessianRange(Eigen::Matrix<double, 6, 6> *hessian,
+                        const PointCloudSource &trans_cloud, size_t idx_begin,
+                        size_t idx_end) {
   // Original Point and Transformed Point
   PointSource x_pt, x_trans_pt;
   // Original Point and Transformed Point (for math)
@@ -552,14 +678,15 @@ void NormalDistributionsTransform<PointSource, PointTarget>::ComputeHessian(
   TargetGridLeafConstPtr cell;
   // Inverse Covariance of Occupied Voxel
   Eigen::Matrix3d c_inv;
-
-  hessian->setZero();
-
-  // Precompute Angular Derivatives unessisary because only used after regular
-  // derivative calculation
+  // Thread local point derivatives, Equations 6.18 and 6.20 [Magnusson 2009]
+  Eigen::Matrix<double, 3, 6> point_gradient;
+  Eigen::Matrix<double, 18, 6> point_hessian;
+  point_gradient.setZero();
+  point_gradient.block<3, 3>(0, 0).setIdentity();
+  point_hessian.setZero();
 
   // Update hessian for each point, line 17 in Algorithm 2 [Magnusson 2009]
-  for (size_t idx = 0; idx < input_->points.size(); idx++) {
+  for (size_t idx = idx_begin; idx < idx_end; idx++) {
     x_trans_pt = trans_cloud.points[idx];
 
     // Find nieghbors (Radius search has been experimentally faster than
@@ -588,10 +715,10 @@ void NormalDistributionsTransform<PointSource, PointTarget>::ComputeHessian(
         // Compute derivative of transform function w.r.t. transform
         // vector, J_E and H_E in Equations 6.18 and 6.20 [Magnusson
         // 2009]
-        ComputePointDerivatives(x);
+        ComputePointDerivatives(x, &point_gradient, &point_hessian);
         // Update hessian, lines 21 in Algorithm 2, according to
         // Equations 6.10, 6.12 and 6.13, respectively [Magnusson 2009]
-        UpdateHessian(hessian, x_trans, c_inv);
+        UpdateHessian(hessian, x_trans, c_inv, point_gradient, point_hessian);
       }
     }
   }
@@ -601,6 +728,15 @@ template <typename PointSource, typename PointTarget>
 void NormalDistributionsTransform<PointSource, PointTarget>::UpdateHessian(
     Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
     const Eigen::Matrix3d &c_inv) {
+  UpdateHessian(hessian, x_trans, c_inv, point_gradient_, point_hessian_);
+}
+
+template <typename PointSource, typename PointTarget>
+void NormalDistributionsTransform<PointSource, PointTarget>::UpdateHessian(
+    Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
+    const Eigen::Matrix3d &c_inv,
+    const Eigen::Matrix<double, 3, 6> &point_gradient,
+    const Eigen::Matrix<double, 18, 6> &point_hessian) const {
   Eigen::Vector3d cov_dxd_pi;
   // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9
   // [Magnusson 2009]
@@ -618,16 +754,16 @@ void NormalDistributionsTransform<PointSource, PointTarget>::UpdateHessian(
   for (int i = 0; i < 6; i++) {
     // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13
     // [Magnusson 2009]
-    cov_dxd_pi = c_inv * point_gradient_.col(i);
+    cov_dxd_pi = c_inv * point_gradient.col(i);
 
     for (int j = 0; j < hessian->cols(); j++) {
       // Update hessian, Equation 6.13 [Magnusson 2009]
       (*hessian)(i, j) +=
           e_x_cov_x *
           (-gauss_d2_ * x_trans.dot(cov_dxd_pi) *
-               x_trans.dot(c_inv * point_gradient_.col(j)) +
-           x_trans.dot(c_inv * point_hessian_.block<3, 1>(3 * i, j)) +
-           point_gradient_.col(j).dot(cov_dxd_pi));
+               x_trans.dot(c_inv * point_gradient.col(j)) +
+           x_trans.dot(c_inv * point_hessian.block<3, 1>(3 * i, j)) +
+           point_gradient.col(j).dot(cov_dxd_pi));
     }
   }
 }
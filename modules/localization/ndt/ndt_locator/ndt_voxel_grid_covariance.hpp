@@ -149,13 +149,18 @@ int VoxelGridCovariance<PointT>::RadiusSearch(
   int k =
       kdtree_.radiusSearch(point, radius, k_indices, *k_sqr_distances, max_nn);
 
-  // Find leaves corresponding to neighbors
+  // Find leaves corresponding to neighbors. Use find() rather than
+  // operator[] so concurrent searches never mutate the leaf map.
   k_leaves->reserve(k);
   for (std::vector<int>::iterator iter = k_indices.begin();
        iter != k_indices.end(); iter++) {
-    k_leaves->push_back(&leaves_[voxel_centroids_leaf_indices_[*iter]]);
+    typename std::map<size_t, Leaf>::const_iterator leaf_iter =
+        leaves_.find(voxel_centroids_leaf_indices_[*iter]);
+    if (leaf_iter != leaves_.end()) {
+      k_leaves->push_back(&leaf_iter->second);
+    }
   }
-  return k;
+  return static_cast<int>(k_leaves->size());
 }
 
 template <typename PointT>
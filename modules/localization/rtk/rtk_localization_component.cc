@@ -16,6 +16,7 @@
 
 #include "modules/localization/rtk/rtk_localization_component.h"
 #include "modules/common/time/time.h"
+#include "modules/localization/common/localization_gflags.h"
 
 namespace apollo {
 namespace localization {
@@ -38,6 +39,14 @@ bool RTKLocalizationComponent::Init() {
     return false;
   }
 
+  if (FLAGS_enable_shared_pose_block) {
+    shared_pose_writer_.reset(new SharedPoseWriter());
+    if (!shared_pose_writer_->Init(FLAGS_shared_pose_shm_key)) {
+      AERROR << "Init shared pose block falseed.";
+      shared_pose_writer_ = nullptr;
+    }
+  }
+
   return true;
 }
 
@@ -131,6 +140,9 @@ void RTKLocalizationComponent::PublishPoseBroadcastTF(
 void RTKLocalizationComponent::PublishPoseBroadcastTopic(
     const LocalizationEstimate& localization) {
   localization_talker_->Write(localization);
+  if (shared_pose_writer_ != nullptr) {
+    shared_pose_writer_->Update(localization);
+  }
   return;
 }
 
@@ -28,6 +28,7 @@
 #include "modules/localization/proto/gps.pb.h"
 #include "modules/localization/proto/imu.pb.h"
 #include "modules/localization/proto/localization.pb.h"
+#include "modules/localization/common/shared_pose_block.h"
 #include "modules/localization/proto/rtk_config.pb.h"
 #include "modules/localization/rtk/rtk_localization.h"
 #include "modules/transform/transform_broadcaster.h"
@@ -74,6 +75,8 @@ class RTKLocalizationComponent final
   std::string broadcast_tf_child_frame_id_ = "";
   std::unique_ptr<apollo::transform::TransformBroadcaster> tf2_broadcaster_;
 
+  std::unique_ptr<SharedPoseWriter> shared_pose_writer_ = nullptr;
+
   std::unique_ptr<RTKLocalization> localization_;
 };
 
@@ -42,6 +42,7 @@ CoordinateConvertTool* CoordinateConvertTool::GetInstance() {
 
 Status CoordinateConvertTool::SetConvertParam(const std::string& source_param,
                                               const std::string& dst_param) {
+  std::lock_guard<std::mutex> lock(mutex_);
   source_convert_param_ = source_param;
   dst_convert_param_ = dst_param;
   if (pj_from_) {
@@ -77,6 +78,7 @@ Status CoordinateConvertTool::CoordiateConvert(const double longitude,
   CHECK_NOTNULL(utm_x);
   CHECK_NOTNULL(utm_y);
   CHECK_NOTNULL(utm_z);
+  std::lock_guard<std::mutex> lock(mutex_);
   if (!pj_from_ || !pj_to_) {
     std::string err_msg = "no transform param";
     return Status(apollo::common::ErrorCode::HDMAP_DATA_ERROR, err_msg);
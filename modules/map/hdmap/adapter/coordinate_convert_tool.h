@@ -15,6 +15,7 @@ limitations under the License.
 #pragma once
 
 #include <proj_api.h>
+#include <mutex>
 #include <string>
 
 #include "modules/map/hdmap/adapter/xml_parser/status.h"
@@ -42,6 +43,10 @@ class CoordinateConvertTool {
   std::string source_convert_param_;
   std::string dst_convert_param_;
 
+  // pj_transform is not reentrant on shared projPJ handles; conversions are
+  // serialized so the road parsers can run concurrently.
+  std::mutex mutex_;
+
   projPJ pj_from_;
   projPJ pj_to_;
 };
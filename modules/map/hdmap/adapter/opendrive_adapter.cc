@@ -14,12 +14,33 @@ limitations under the License.
 =========================================================================*/
 #include "modules/map/hdmap/adapter/opendrive_adapter.h"
 
+#include <sys/stat.h>
+
 #include <vector>
 
+#include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "modules/map/hdmap/adapter/proto_organizer.h"
 #include "modules/map/hdmap/adapter/xml_parser/status.h"
 
+namespace {
+
+// Bump the version in this suffix whenever the adapter changes what it
+// writes into the proto, so stale caches are ignored.
+constexpr char kBinaryCacheSuffix[] = ".cache.v1.bin";
+
+bool IsCacheFresh(const std::string& xml_file, const std::string& cache_file) {
+  struct stat xml_stat;
+  struct stat cache_stat;
+  if (stat(xml_file.c_str(), &xml_stat) != 0 ||
+      stat(cache_file.c_str(), &cache_stat) != 0) {
+    return false;
+  }
+  return cache_stat.st_mtime >= xml_stat.st_mtime;
+}
+
+}  // namespace
+
 namespace apollo {
 namespace hdmap {
 namespace adapter {
@@ -28,6 +49,13 @@ bool OpendriveAdapter::LoadData(const std::string& filename,
                                 apollo::hdmap::Map* pb_map) {
   CHECK_NOTNULL(pb_map);
 
+  const std::string cache_file = filename + kBinaryCacheSuffix;
+  if (IsCacheFresh(filename, cache_file) &&
+      cyber::common::GetProtoFromBinaryFileZeroCopy(cache_file, pb_map)) {
+    AINFO << "load opendrive map from binary cache " << cache_file;
+    return true;
+  }
+
   tinyxml2::XMLDocument document;
   if (document.LoadFile(filename.c_str()) != tinyxml2::XML_SUCCESS) {
     AERROR << "fail to load file " << filename;
@@ -67,6 +95,11 @@ bool OpendriveAdapter::LoadData(const std::string& filename,
   proto_organizer.GetOverlapElements(roads, junctions);
   proto_organizer.OutputData(pb_map);
 
+  // Best effort: the next load of the same xml can skip parsing entirely.
+  if (!cyber::common::SetProtoToBinaryFile(*pb_map, cache_file)) {
+    AWARN << "fail to write opendrive binary cache " << cache_file;
+  }
+
   return true;
 }
 
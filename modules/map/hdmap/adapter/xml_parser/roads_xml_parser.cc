@@ -12,7 +12,9 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 =========================================================================*/
+#include <algorithm>
 #include <string>
+#include <thread>
 
 #include "modules/map/hdmap/adapter/xml_parser/lanes_xml_parser.h"
 #include "modules/map/hdmap/adapter/xml_parser/objects_xml_parser.h"
@@ -35,48 +37,87 @@ Status RoadsXmlParser::Parse(const tinyxml2::XMLElement& xml_node,
                              std::vector<RoadInternal>* roads) {
   CHECK_NOTNULL(roads);
 
+  std::vector<const tinyxml2::XMLElement*> road_nodes;
   auto road_node = xml_node.FirstChildElement("road");
   while (road_node) {
-    // road attributes
-    std::string id;
-    std::string junction_id;
-    int checker = UtilXmlParser::QueryStringAttribute(*road_node, "id", &id);
-    checker += UtilXmlParser::QueryStringAttribute(*road_node, "junction",
-                                                   &junction_id);
-    if (checker != tinyxml2::XML_SUCCESS) {
-      std::string err_msg = "Error parsing road attributes";
-      return Status(apollo::common::ErrorCode::HDMAP_DATA_ERROR, err_msg);
-    }
+    road_nodes.push_back(road_node);
+    road_node = road_node->NextSiblingElement("road");
+  }
 
-    RoadInternal road_internal;
-    road_internal.id = id;
-    road_internal.road.mutable_id()->set_id(id);
-    if (IsRoadBelongToJunction(junction_id)) {
-      road_internal.road.mutable_junction_id()->set_id(junction_id);
+  roads->resize(road_nodes.size());
+
+  // Roads are independent of each other, and the workers only read the
+  // document, so the per-road bodies can be parsed concurrently.
+  const size_t thread_num =
+      std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                       road_nodes.size());
+  std::vector<Status> road_status(road_nodes.size(), Status::OK());
+  if (thread_num <= 1) {
+    for (size_t i = 0; i < road_nodes.size(); ++i) {
+      road_status[i] = ParseRoad(*road_nodes[i], &(*roads)[i]);
     }
-
-    std::string type;
-    checker = UtilXmlParser::QueryStringAttribute(*road_node, "type", &type);
-    if (checker != tinyxml2::XML_SUCCESS) {
-      // forward compatibility with old data
-      type = "CITYROAD";
+  } else {
+    std::vector<std::thread> workers;
+    workers.reserve(thread_num);
+    for (size_t worker = 0; worker < thread_num; ++worker) {
+      workers.emplace_back([&road_nodes, &road_status, roads, worker,
+                            thread_num]() {
+        for (size_t i = worker; i < road_nodes.size(); i += thread_num) {
+          road_status[i] = ParseRoad(*road_nodes[i], &(*roads)[i]);
+        }
+      });
     }
-    PbRoadType pb_road_type;
-    RETURN_IF_ERROR(to_pb_road_type(type, &pb_road_type));
-    road_internal.road.set_type(pb_road_type);
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+
+  for (const auto& status : road_status) {
+    RETURN_IF_ERROR(status);
+  }
+
+  return Status::OK();
+}
 
-    // lanes
-    RETURN_IF_ERROR(LanesXmlParser::Parse(*road_node, road_internal.id,
-                                          &road_internal.sections));
+Status RoadsXmlParser::ParseRoad(const tinyxml2::XMLElement& road_node,
+                                 RoadInternal* road_internal) {
+  CHECK_NOTNULL(road_internal);
+
+  // road attributes
+  std::string id;
+  std::string junction_id;
+  int checker = UtilXmlParser::QueryStringAttribute(road_node, "id", &id);
+  checker += UtilXmlParser::QueryStringAttribute(road_node, "junction",
+                                                 &junction_id);
+  if (checker != tinyxml2::XML_SUCCESS) {
+    std::string err_msg = "Error parsing road attributes";
+    return Status(apollo::common::ErrorCode::HDMAP_DATA_ERROR, err_msg);
+  }
 
-    // objects
-    Parse_road_objects(*road_node, &road_internal);
-    // signals
-    Parse_road_signals(*road_node, &road_internal);
+  road_internal->id = id;
+  road_internal->road.mutable_id()->set_id(id);
+  if (IsRoadBelongToJunction(junction_id)) {
+    road_internal->road.mutable_junction_id()->set_id(junction_id);
+  }
 
-    roads->push_back(road_internal);
-    road_node = road_node->NextSiblingElement("road");
+  std::string type;
+  checker = UtilXmlParser::QueryStringAttribute(road_node, "type", &type);
+  if (checker != tinyxml2::XML_SUCCESS) {
+    // forward compatibility with old data
+    type = "CITYROAD";
   }
+  PbRoadType pb_road_type;
+  RETURN_IF_ERROR(to_pb_road_type(type, &pb_road_type));
+  road_internal->road.set_type(pb_road_type);
+
+  // lanes
+  RETURN_IF_ERROR(LanesXmlParser::Parse(road_node, road_internal->id,
+                                        &road_internal->sections));
+
+  // objects
+  Parse_road_objects(road_node, road_internal);
+  // signals
+  Parse_road_signals(road_node, road_internal);
 
   return Status::OK();
 }
@@ -139,6 +139,12 @@ int HDMap::GetPNCJunctions(
   return impl_.GetPNCJunctions(point, distance, pnc_junctions);
 }
 
+int HDMap::GetMapElements(const apollo::common::PointENU& point,
+                          double distance, uint32_t layer_mask,
+                          MapElementIds* ids) const {
+  return impl_.GetMapElements(point, distance, layer_mask, ids);
+}
+
 int HDMap::GetNearestLane(const common::PointENU& point,
                           LaneInfoConstPtr* nearest_lane, double* nearest_s,
                           double* nearest_l) const {
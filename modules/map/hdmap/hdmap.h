@@ -180,6 +180,17 @@ class HDMap {
   int GetPNCJunctions(
       const apollo::common::PointENU& point, double distance,
       std::vector<PNCJunctionInfoConstPtr>* pnc_junctions) const;
+  /**
+   * @brief get elements of several layers in certain range with a single
+   *        traversal of the unified element index
+   * @param point the central point of the range
+   * @param distance the search radius
+   * @param layer_mask bitwise-or of MapElementLayer flags to query
+   * @param ids per-layer element ids; only requested layers are filled
+   * @return 0:success, otherwise failed
+   */
+  int GetMapElements(const apollo::common::PointENU& point, double distance,
+                     uint32_t layer_mask, MapElementIds* ids) const;
   /**
    * @brief get nearest lane from target point,
    * @param point the target point
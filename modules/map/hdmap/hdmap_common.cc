@@ -39,6 +39,10 @@ const double kDuplicatedPointsEpsilon = 1e-7;
 // Margin for comparation
 const double kEpsilon = 0.1;
 
+// Number of segments scanned on each side of the hint before falling back
+// to a full scan in GetProjection.
+const int kProjectionHintWindow = 8;
+
 // Maximum x-coordinate of utm
 // const double kMaxXCoordinate = 834000;
 // Minimum x-coordinate of utm
@@ -148,6 +152,21 @@ void LaneInfo::Init() {
   accumulated_s_.push_back(s);
   total_length_ = s;
   CHECK(!unit_directions_.empty());
+
+  const int seg_num = static_cast<int>(segments_.size());
+  seg_start_x_.resize(seg_num);
+  seg_start_y_.resize(seg_num);
+  seg_unit_x_.resize(seg_num);
+  seg_unit_y_.resize(seg_num);
+  seg_length_.resize(seg_num);
+  for (int i = 0; i < seg_num; ++i) {
+    seg_start_x_[i] = segments_[i].start().x();
+    seg_start_y_[i] = segments_[i].start().y();
+    seg_unit_x_[i] = unit_directions_[i].x();
+    seg_unit_y_[i] = unit_directions_[i].y();
+    seg_length_[i] = segments_[i].length();
+  }
+
   unit_directions_.push_back(unit_directions_.back());
   for (const auto &direction : unit_directions_) {
     headings_.push_back(direction.Angle());
@@ -417,8 +436,34 @@ PointENU LaneInfo::GetNearestPoint(const Vec2d &point, double *distance) const {
   return PointFromVec2d(nearest_point);
 }
 
+int LaneInfo::NearestSegmentIndex(const Vec2d &point, const int begin,
+                                  const int end, double *min_dist_sqr) const {
+  const int count = end - begin;
+  const auto start_x = seg_start_x_.segment(begin, count);
+  const auto start_y = seg_start_y_.segment(begin, count);
+  const auto unit_x = seg_unit_x_.segment(begin, count);
+  const auto unit_y = seg_unit_y_.segment(begin, count);
+  const Eigen::ArrayXd rel_x = point.x() - start_x;
+  const Eigen::ArrayXd rel_y = point.y() - start_y;
+  const Eigen::ArrayXd proj = (rel_x * unit_x + rel_y * unit_y)
+                                  .max(0.0)
+                                  .min(seg_length_.segment(begin, count));
+  const Eigen::ArrayXd diff_x = rel_x - unit_x * proj;
+  const Eigen::ArrayXd diff_y = rel_y - unit_y * proj;
+  Eigen::Index offset = 0;
+  *min_dist_sqr = (diff_x * diff_x + diff_y * diff_y).minCoeff(&offset);
+  return begin + static_cast<int>(offset);
+}
+
 bool LaneInfo::GetProjection(const Vec2d &point, double *accumulate_s,
                              double *lateral) const {
+  int segment_hint = -1;
+  return GetProjection(point, &segment_hint, accumulate_s, lateral);
+}
+
+bool LaneInfo::GetProjection(const Vec2d &point, int *segment_hint,
+                             double *accumulate_s, double *lateral) const {
+  RETURN_VAL_IF_NULL(segment_hint, false);
   RETURN_VAL_IF_NULL(accumulate_s, false);
   RETURN_VAL_IF_NULL(lateral, false);
 
@@ -427,14 +472,23 @@ bool LaneInfo::GetProjection(const Vec2d &point, double *accumulate_s,
   }
   double min_dist = std::numeric_limits<double>::infinity();
   int seg_num = static_cast<int>(segments_.size());
-  int min_index = 0;
-  for (int i = 0; i < seg_num; ++i) {
-    const double distance = segments_[i].DistanceSquareTo(point);
-    if (distance < min_dist) {
-      min_index = i;
-      min_dist = distance;
+  int min_index = -1;
+  if (*segment_hint >= 0 && *segment_hint < seg_num) {
+    const int begin = std::max(0, *segment_hint - kProjectionHintWindow);
+    const int end =
+        std::min(seg_num, *segment_hint + kProjectionHintWindow + 1);
+    min_index = NearestSegmentIndex(point, begin, end, &min_dist);
+    // A minimum on the window edge may be beaten by a segment outside the
+    // window; fall back to the full scan in that case.
+    if ((min_index == begin && begin > 0) ||
+        (min_index == end - 1 && end < seg_num)) {
+      min_index = -1;
     }
   }
+  if (min_index < 0) {
+    min_index = NearestSegmentIndex(point, 0, seg_num, &min_dist);
+  }
+  *segment_hint = min_index;
   min_dist = std::sqrt(min_dist);
   const auto &nearest_seg = segments_[min_index];
   const auto prod = nearest_seg.ProductOntoUnit(point);
@@ -20,6 +20,8 @@ limitations under the License.
 #include <utility>
 #include <vector>
 
+#include "Eigen/Dense"
+
 #include "modules/common/math/aabox2d.h"
 #include "modules/common/math/aaboxkdtree2d.h"
 #include "modules/common/math/math_utils.h"
@@ -219,6 +221,18 @@ class LaneInfo {
       const apollo::common::math::Vec2d &point, double *distance) const;
   bool GetProjection(const apollo::common::math::Vec2d &point,
                      double *accumulate_s, double *lateral) const;
+  /**
+   * @brief Project a point onto the lane center line with a segment-index
+   *        hint. When *segment_hint is a valid index from a previous call,
+   *        only a small window of segments around it is scanned and a full
+   *        scan runs only if the minimum falls on the window edge, so
+   *        sequential callers walking along a lane pay O(1) per query.
+   *        Pass -1 to force a full scan. *segment_hint is updated to the
+   *        index of the nearest segment.
+   */
+  bool GetProjection(const apollo::common::math::Vec2d &point,
+                     int *segment_hint, double *accumulate_s,
+                     double *lateral) const;
 
  private:
   friend class HDMapImpl;
@@ -228,6 +242,11 @@ class LaneInfo {
   void UpdateOverlaps(const HDMapImpl &map_instance);
   double GetWidthFromSample(const std::vector<LaneInfo::SampledWidth> &samples,
                             const double s) const;
+  // Find the segment nearest to the point among [begin, end) using the SoA
+  // geometry arrays; returns its index and the clamped squared distance.
+  int NearestSegmentIndex(const apollo::common::math::Vec2d &point,
+                          const int begin, const int end,
+                          double *min_dist_sqr) const;
   void CreateKDTree();
   void set_road_id(const Id &road_id) { road_id_ = road_id; }
   void set_section_id(const Id &section_id) { section_id_ = section_id; }
@@ -239,6 +258,14 @@ class LaneInfo {
   std::vector<double> headings_;
   std::vector<apollo::common::math::LineSegment2d> segments_;
   std::vector<double> accumulated_s_;
+  // SoA copies of the segment geometry (start point, unit direction and
+  // length per segment) so the projection kernel vectorizes over
+  // contiguous arrays instead of chasing LineSegment2d objects.
+  Eigen::ArrayXd seg_start_x_;
+  Eigen::ArrayXd seg_start_y_;
+  Eigen::ArrayXd seg_unit_x_;
+  Eigen::ArrayXd seg_unit_y_;
+  Eigen::ArrayXd seg_length_;
   std::vector<std::string> overlap_ids_;
   std::vector<OverlapInfoConstPtr> overlaps_;
   std::vector<OverlapInfoConstPtr> cross_lanes_;
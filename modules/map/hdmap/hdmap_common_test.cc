@@ -494,6 +494,41 @@ TEST_F(HDMapCommonTestSuite, GetProjection) {
   EXPECT_NEAR(lateral, 2.0, 1E-3);
 }
 
+TEST_F(HDMapCommonTestSuite, GetProjectionWithHint) {
+  Lane lane;
+  InitLaneObj(&lane);
+  LaneInfo lane_info(lane);
+
+  double accumulate_s = 0.0;
+  double lateral = 0.0;
+  int segment_hint = -1;
+  EXPECT_TRUE(lane_info.GetProjection({170001.4, 3.0}, &segment_hint,
+                                      &accumulate_s, &lateral));
+  EXPECT_EQ(0, segment_hint);
+  EXPECT_NEAR(accumulate_s, 0.4, 1E-3);
+  EXPECT_NEAR(lateral, 2.0, 1E-3);
+
+  // Walking forward along the lane reuses the hint from the last call and
+  // matches the hint-less projection.
+  for (double x = 170001.5; x < 170005.0; x += 0.5) {
+    EXPECT_TRUE(lane_info.GetProjection({x, 3.0}, &segment_hint, &accumulate_s,
+                                        &lateral));
+    double expected_s = 0.0;
+    double expected_l = 0.0;
+    EXPECT_TRUE(lane_info.GetProjection({x, 3.0}, &expected_s, &expected_l));
+    EXPECT_NEAR(expected_s, accumulate_s, 1E-9);
+    EXPECT_NEAR(expected_l, lateral, 1E-9);
+  }
+  EXPECT_EQ(3, segment_hint);
+
+  // A stale hint far from the query point still yields the right segment.
+  segment_hint = 3;
+  EXPECT_TRUE(lane_info.GetProjection({170001.4, 3.0}, &segment_hint,
+                                      &accumulate_s, &lateral));
+  EXPECT_EQ(0, segment_hint);
+  EXPECT_NEAR(accumulate_s, 0.4, 1E-3);
+}
+
 TEST_F(HDMapCommonTestSuite, TestJunctionInfo) {
   Junction junction;
   InitJunctionObj(&junction);
@@ -18,6 +18,7 @@ limitations under the License.
 #include <algorithm>
 #include <limits>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "cyber/common/file.h"
@@ -43,6 +44,22 @@ constexpr double kLanesSearchRange = 10.0;
 // backward search distance in GetForwardNearestSignalsOnLane
 constexpr int kBackwardDistance = 4;
 
+// Builds one map layer in a single contiguous block and fills its id table
+// with aliasing pointers into the block. The block is reserved up front, so
+// the info objects never move once constructed.
+template <class Info, class Element, class Table>
+void BuildInfoBlock(
+    const google::protobuf::RepeatedPtrField<Element>& elements,
+    std::shared_ptr<std::vector<Info>>* const block, Table* const table) {
+  *block = std::make_shared<std::vector<Info>>();
+  (*block)->reserve(elements.size());
+  for (const auto& element : elements) {
+    (*block)->emplace_back(element);
+    (*table)[element.id().id()] =
+        std::shared_ptr<Info>(*block, &(*block)->back());
+  }
+}
+
 }  // namespace
 
 int HDMapImpl::LoadMapFromFile(const std::string& map_filename) {
@@ -53,7 +70,7 @@ int HDMapImpl::LoadMapFromFile(const std::string& map_filename) {
     if (!adapter::OpendriveAdapter::LoadData(map_filename, &map_)) {
       return -1;
     }
-  } else if (!cyber::common::GetProtoFromFile(map_filename, &map_)) {
+  } else if (!cyber::common::GetProtoFromFileZeroCopy(map_filename, &map_)) {
     return -1;
   }
 
@@ -65,48 +82,22 @@ int HDMapImpl::LoadMapFromProto(const Map& map_proto) {
     Clear();
     map_ = map_proto;
   }
-  for (const auto& lane : map_.lane()) {
-    lane_table_[lane.id().id()].reset(new LaneInfo(lane));
-  }
-  for (const auto& junction : map_.junction()) {
-    junction_table_[junction.id().id()].reset(new JunctionInfo(junction));
-  }
-  for (const auto& signal : map_.signal()) {
-    signal_table_[signal.id().id()].reset(new SignalInfo(signal));
-  }
-  for (const auto& crosswalk : map_.crosswalk()) {
-    crosswalk_table_[crosswalk.id().id()].reset(new CrosswalkInfo(crosswalk));
-  }
-  for (const auto& stop_sign : map_.stop_sign()) {
-    stop_sign_table_[stop_sign.id().id()].reset(new StopSignInfo(stop_sign));
-  }
-  for (const auto& yield_sign : map_.yield()) {
-    yield_sign_table_[yield_sign.id().id()].reset(
-        new YieldSignInfo(yield_sign));
-  }
-  for (const auto& clear_area : map_.clear_area()) {
-    clear_area_table_[clear_area.id().id()].reset(
-        new ClearAreaInfo(clear_area));
-  }
-  for (const auto& speed_bump : map_.speed_bump()) {
-    speed_bump_table_[speed_bump.id().id()].reset(
-        new SpeedBumpInfo(speed_bump));
-  }
-  for (const auto& parking_space : map_.parking_space()) {
-    parking_space_table_[parking_space.id().id()].reset(
-        new ParkingSpaceInfo(parking_space));
-  }
-  for (const auto& pnc_junction : map_.pnc_junction()) {
-    pnc_junction_table_[pnc_junction.id().id()].reset(
-        new PNCJunctionInfo(pnc_junction));
-  }
-  for (const auto& overlap : map_.overlap()) {
-    overlap_table_[overlap.id().id()].reset(new OverlapInfo(overlap));
-  }
-
-  for (const auto& road : map_.road()) {
-    road_table_[road.id().id()].reset(new RoadInfo(road));
-  }
+  BuildInfoBlock(map_.lane(), &lane_info_block_, &lane_table_);
+  BuildInfoBlock(map_.junction(), &junction_info_block_, &junction_table_);
+  BuildInfoBlock(map_.signal(), &signal_info_block_, &signal_table_);
+  BuildInfoBlock(map_.crosswalk(), &crosswalk_info_block_, &crosswalk_table_);
+  BuildInfoBlock(map_.stop_sign(), &stop_sign_info_block_, &stop_sign_table_);
+  BuildInfoBlock(map_.yield(), &yield_sign_info_block_, &yield_sign_table_);
+  BuildInfoBlock(map_.clear_area(), &clear_area_info_block_,
+                 &clear_area_table_);
+  BuildInfoBlock(map_.speed_bump(), &speed_bump_info_block_,
+                 &speed_bump_table_);
+  BuildInfoBlock(map_.parking_space(), &parking_space_info_block_,
+                 &parking_space_table_);
+  BuildInfoBlock(map_.pnc_junction(), &pnc_junction_info_block_,
+                 &pnc_junction_table_);
+  BuildInfoBlock(map_.overlap(), &overlap_info_block_, &overlap_table_);
+  BuildInfoBlock(map_.road(), &road_info_block_, &road_table_);
   for (const auto& road_ptr_pair : road_table_) {
     const auto& road_id = road_ptr_pair.second->id();
     for (const auto& road_section : road_ptr_pair.second->sections()) {
@@ -141,6 +132,7 @@ int HDMapImpl::LoadMapFromProto(const Map& map_proto) {
   BuildSpeedBumpSegmentKDTree();
   BuildParkingSpacePolygonKDTree();
   BuildPNCJunctionPolygonKDTree();
+  BuildMapElementKDTree();
   return 0;
 }
 
@@ -484,6 +476,47 @@ int HDMapImpl::GetPNCJunctions(
   return 0;
 }
 
+int HDMapImpl::GetMapElements(const PointENU& point, double distance,
+                              uint32_t layer_mask, MapElementIds* ids) const {
+  return GetMapElements({point.x(), point.y()}, distance, layer_mask, ids);
+}
+
+int HDMapImpl::GetMapElements(const Vec2d& point, double distance,
+                              uint32_t layer_mask, MapElementIds* ids) const {
+  if (ids == nullptr || map_element_kdtree_ == nullptr) {
+    return -1;
+  }
+  *ids = MapElementIds();
+
+  // One traversal collects every layer; elements with several geometry
+  // pieces (e.g. lane segments) show up once per piece and are deduped here.
+  std::unordered_map<uint32_t, std::unordered_set<std::string>> layer_ids;
+  for (const auto* box : map_element_kdtree_->GetObjects(point, distance)) {
+    if ((box->layer() & layer_mask) != 0) {
+      layer_ids[box->layer()].insert(box->id());
+    }
+  }
+
+  const auto copy_layer = [&layer_ids](const MapElementLayer layer,
+                                       std::vector<std::string>* result) {
+    const auto it = layer_ids.find(layer);
+    if (it != layer_ids.end()) {
+      result->assign(it->second.begin(), it->second.end());
+    }
+  };
+  copy_layer(LAYER_LANE, &ids->lane_ids);
+  copy_layer(LAYER_JUNCTION, &ids->junction_ids);
+  copy_layer(LAYER_CROSSWALK, &ids->crosswalk_ids);
+  copy_layer(LAYER_SIGNAL, &ids->signal_ids);
+  copy_layer(LAYER_STOP_SIGN, &ids->stop_sign_ids);
+  copy_layer(LAYER_YIELD_SIGN, &ids->yield_sign_ids);
+  copy_layer(LAYER_CLEAR_AREA, &ids->clear_area_ids);
+  copy_layer(LAYER_SPEED_BUMP, &ids->speed_bump_ids);
+  copy_layer(LAYER_PARKING_SPACE, &ids->parking_space_ids);
+  copy_layer(LAYER_PNC_JUNCTION, &ids->pnc_junction_ids);
+  return 0;
+}
+
 int HDMapImpl::GetNearestLane(const PointENU& point,
                               LaneInfoConstPtr* nearest_lane, double* nearest_s,
                               double* nearest_l) const {
@@ -1283,6 +1316,44 @@ void HDMapImpl::BuildPNCJunctionPolygonKDTree() {
                      &pnc_junction_polygon_kdtree_);
 }
 
+void HDMapImpl::BuildMapElementKDTree() {
+  map_element_boxes_.clear();
+  const auto add_segments = [this](const auto& table,
+                                   const MapElementLayer layer) {
+    for (const auto& info_with_id : table) {
+      for (const auto& segment : info_with_id.second->segments()) {
+        map_element_boxes_.emplace_back(
+            apollo::common::math::AABox2d(segment.start(), segment.end()),
+            layer, &info_with_id.first, &segment);
+      }
+    }
+  };
+  const auto add_polygons = [this](const auto& table,
+                                   const MapElementLayer layer) {
+    for (const auto& info_with_id : table) {
+      const auto& polygon = info_with_id.second->polygon();
+      map_element_boxes_.emplace_back(polygon.AABoundingBox(), layer,
+                                      &info_with_id.first, &polygon);
+    }
+  };
+  add_segments(lane_table_, LAYER_LANE);
+  add_polygons(junction_table_, LAYER_JUNCTION);
+  add_polygons(crosswalk_table_, LAYER_CROSSWALK);
+  add_segments(signal_table_, LAYER_SIGNAL);
+  add_segments(stop_sign_table_, LAYER_STOP_SIGN);
+  add_segments(yield_sign_table_, LAYER_YIELD_SIGN);
+  add_polygons(clear_area_table_, LAYER_CLEAR_AREA);
+  add_segments(speed_bump_table_, LAYER_SPEED_BUMP);
+  add_polygons(parking_space_table_, LAYER_PARKING_SPACE);
+  add_polygons(pnc_junction_table_, LAYER_PNC_JUNCTION);
+
+  AABoxKDTreeParams params;
+  params.max_leaf_dimension = 5.0;  // meters.
+  params.max_leaf_size = 16;
+  map_element_kdtree_.reset(
+      new MapElementKDTree(map_element_boxes_, params));
+}
+
 template <class KDTree>
 int HDMapImpl::SearchObjects(const Vec2d& center, const double radius,
                              const KDTree& kdtree,
@@ -1310,7 +1381,24 @@ void HDMapImpl::Clear() {
   crosswalk_table_.clear();
   stop_sign_table_.clear();
   yield_sign_table_.clear();
+  clear_area_table_.clear();
+  speed_bump_table_.clear();
   overlap_table_.clear();
+  road_table_.clear();
+  parking_space_table_.clear();
+  pnc_junction_table_.clear();
+  lane_info_block_.reset();
+  junction_info_block_.reset();
+  crosswalk_info_block_.reset();
+  signal_info_block_.reset();
+  stop_sign_info_block_.reset();
+  yield_sign_info_block_.reset();
+  clear_area_info_block_.reset();
+  speed_bump_info_block_.reset();
+  overlap_info_block_.reset();
+  road_info_block_.reset();
+  parking_space_info_block_.reset();
+  pnc_junction_info_block_.reset();
   lane_segment_boxes_.clear();
   lane_segment_kdtree_.reset(nullptr);
   junction_polygon_boxes_.clear();
@@ -1331,6 +1419,8 @@ void HDMapImpl::Clear() {
   parking_space_polygon_kdtree_.reset(nullptr);
   pnc_junction_polygon_boxes_.clear();
   pnc_junction_polygon_kdtree_.reset(nullptr);
+  map_element_boxes_.clear();
+  map_element_kdtree_.reset(nullptr);
 }
 
 }  // namespace hdmap
@@ -15,6 +15,7 @@ limitations under the License.
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -48,6 +49,80 @@ limitations under the License.
 namespace apollo {
 namespace hdmap {
 
+/**
+ * @brief Bit flags selecting map element layers in GetMapElements().
+ *        Combine with bitwise-or to request several layers at once.
+ */
+enum MapElementLayer : uint32_t {
+  LAYER_LANE = 1U << 0,
+  LAYER_JUNCTION = 1U << 1,
+  LAYER_CROSSWALK = 1U << 2,
+  LAYER_SIGNAL = 1U << 3,
+  LAYER_STOP_SIGN = 1U << 4,
+  LAYER_YIELD_SIGN = 1U << 5,
+  LAYER_CLEAR_AREA = 1U << 6,
+  LAYER_SPEED_BUMP = 1U << 7,
+  LAYER_PARKING_SPACE = 1U << 8,
+  LAYER_PNC_JUNCTION = 1U << 9,
+  LAYER_ALL = (1U << 10) - 1,
+};
+
+/**
+ * @brief Ids of all map elements found by GetMapElements(), grouped by
+ *        layer. Only the requested layers are filled; look the ids up in
+ *        the per-layer GetXxxById() accessors to obtain the info objects.
+ */
+struct MapElementIds {
+  std::vector<std::string> lane_ids;
+  std::vector<std::string> junction_ids;
+  std::vector<std::string> crosswalk_ids;
+  std::vector<std::string> signal_ids;
+  std::vector<std::string> stop_sign_ids;
+  std::vector<std::string> yield_sign_ids;
+  std::vector<std::string> clear_area_ids;
+  std::vector<std::string> speed_bump_ids;
+  std::vector<std::string> parking_space_ids;
+  std::vector<std::string> pnc_junction_ids;
+};
+
+/**
+ * @brief An entry of the unified map element KD-tree. References one
+ *        geometry piece (a center-line segment or a boundary polygon) of a
+ *        map element together with its layer and id; the geometry itself is
+ *        owned by the per-layer info tables.
+ */
+class MapElementBox {
+ public:
+  MapElementBox(const apollo::common::math::AABox2d &aabox,
+                const MapElementLayer layer, const std::string *id,
+                const apollo::common::math::LineSegment2d *segment)
+      : aabox_(aabox), layer_(layer), id_(id), segment_(segment) {}
+  MapElementBox(const apollo::common::math::AABox2d &aabox,
+                const MapElementLayer layer, const std::string *id,
+                const apollo::common::math::Polygon2d *polygon)
+      : aabox_(aabox), layer_(layer), id_(id), polygon_(polygon) {}
+  const apollo::common::math::AABox2d &aabox() const { return aabox_; }
+  double DistanceTo(const apollo::common::math::Vec2d &point) const {
+    return segment_ != nullptr ? segment_->DistanceTo(point)
+                               : polygon_->DistanceTo(point);
+  }
+  double DistanceSquareTo(const apollo::common::math::Vec2d &point) const {
+    return segment_ != nullptr ? segment_->DistanceSquareTo(point)
+                               : polygon_->DistanceSquareTo(point);
+  }
+  MapElementLayer layer() const { return layer_; }
+  const std::string &id() const { return *id_; }
+
+ private:
+  apollo::common::math::AABox2d aabox_;
+  MapElementLayer layer_;
+  const std::string *id_ = nullptr;
+  const apollo::common::math::LineSegment2d *segment_ = nullptr;
+  const apollo::common::math::Polygon2d *polygon_ = nullptr;
+};
+
+using MapElementKDTree = apollo::common::math::AABoxKDTree2d<MapElementBox>;
+
 /**
  * @class HDMapImpl
  *
@@ -210,6 +285,20 @@ class HDMapImpl {
       const apollo::common::PointENU& point, double distance,
       std::vector<PNCJunctionInfoConstPtr>* pnc_junctions) const;
 
+  /**
+   * @brief get elements of several layers in certain range with a single
+   *        traversal of the unified element index. Equivalent to calling
+   *        GetLanes(), GetSignals() etc. for each requested layer, but the
+   *        spatial search runs only once.
+   * @param point the central point of the range
+   * @param distance the search radius
+   * @param layer_mask bitwise-or of MapElementLayer flags to query
+   * @param ids per-layer element ids; only requested layers are filled
+   * @return 0:success, otherwise failed
+   */
+  int GetMapElements(const apollo::common::PointENU& point, double distance,
+                     uint32_t layer_mask, MapElementIds* ids) const;
+
   /**
    * @brief get nearest lane from target point,
    * @param point the target point
@@ -365,6 +454,8 @@ class HDMapImpl {
                           std::vector<LaneInfoConstPtr>* lanes) const;
   int GetRoads(const apollo::common::math::Vec2d& point, double distance,
                std::vector<RoadInfoConstPtr>* roads) const;
+  int GetMapElements(const apollo::common::math::Vec2d& point, double distance,
+                     uint32_t layer_mask, MapElementIds* ids) const;
 
   template <class Table, class BoxTable, class KDTree>
   static void BuildSegmentKDTree(
@@ -386,6 +477,7 @@ class HDMapImpl {
   void BuildSpeedBumpSegmentKDTree();
   void BuildParkingSpacePolygonKDTree();
   void BuildPNCJunctionPolygonKDTree();
+  void BuildMapElementKDTree();
 
   template <class KDTree>
   static int SearchObjects(const apollo::common::math::Vec2d& center,
@@ -409,6 +501,23 @@ class HDMapImpl {
   ParkingSpaceTable parking_space_table_;
   PNCJunctionTable pnc_junction_table_;
 
+  // Contiguous per-layer storage of the info objects. The tables above hold
+  // aliasing shared pointers into these blocks, so each layer costs a single
+  // allocation instead of one per element and elements that are iterated
+  // together stay adjacent in memory.
+  std::shared_ptr<std::vector<LaneInfo>> lane_info_block_;
+  std::shared_ptr<std::vector<JunctionInfo>> junction_info_block_;
+  std::shared_ptr<std::vector<CrosswalkInfo>> crosswalk_info_block_;
+  std::shared_ptr<std::vector<SignalInfo>> signal_info_block_;
+  std::shared_ptr<std::vector<StopSignInfo>> stop_sign_info_block_;
+  std::shared_ptr<std::vector<YieldSignInfo>> yield_sign_info_block_;
+  std::shared_ptr<std::vector<ClearAreaInfo>> clear_area_info_block_;
+  std::shared_ptr<std::vector<SpeedBumpInfo>> speed_bump_info_block_;
+  std::shared_ptr<std::vector<OverlapInfo>> overlap_info_block_;
+  std::shared_ptr<std::vector<RoadInfo>> road_info_block_;
+  std::shared_ptr<std::vector<ParkingSpaceInfo>> parking_space_info_block_;
+  std::shared_ptr<std::vector<PNCJunctionInfo>> pnc_junction_info_block_;
+
   std::vector<LaneSegmentBox> lane_segment_boxes_;
   std::unique_ptr<LaneSegmentKDTree> lane_segment_kdtree_;
 
@@ -438,6 +547,9 @@ class HDMapImpl {
 
   std::vector<PNCJunctionPolygonBox> pnc_junction_polygon_boxes_;
   std::unique_ptr<PNCJunctionPolygonKDTree> pnc_junction_polygon_kdtree_;
+
+  std::vector<MapElementBox> map_element_boxes_;
+  std::unique_ptr<MapElementKDTree> map_element_kdtree_;
 };
 
 }  // namespace hdmap
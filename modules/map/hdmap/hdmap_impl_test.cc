@@ -14,6 +14,9 @@ limitations under the License.
 =========================================================================*/
 
 #include "modules/map/hdmap/hdmap_impl.h"
+
+#include <set>
+
 #include "cyber/common/file.h"
 #include "gtest/gtest.h"
 
@@ -244,6 +247,41 @@ TEST_F(HDMapImplTestSuite, GetStopSigns) {
   EXPECT_EQ("1276", stop_signs[0]->id().id());
 }
 
+TEST_F(HDMapImplTestSuite, GetMapElements) {
+  apollo::common::PointENU point;
+  point.set_x(586440.37);
+  point.set_y(4140738.64);
+  point.set_z(0.0);
+
+  MapElementIds ids;
+  EXPECT_EQ(0, hdmap_impl_.GetMapElements(
+                   point, 12.0, LAYER_LANE | LAYER_JUNCTION | LAYER_SIGNAL,
+                   &ids));
+
+  // Must match the per-layer queries at the same point and radius.
+  std::vector<LaneInfoConstPtr> lanes;
+  EXPECT_EQ(0, hdmap_impl_.GetLanes(point, 12.0, &lanes));
+  EXPECT_EQ(lanes.size(), ids.lane_ids.size());
+  std::set<std::string> lane_id_set(ids.lane_ids.begin(), ids.lane_ids.end());
+  for (const auto& lane : lanes) {
+    EXPECT_EQ(1, lane_id_set.count(lane->id().id()));
+  }
+
+  std::vector<SignalInfoConstPtr> signals;
+  EXPECT_EQ(0, hdmap_impl_.GetSignals(point, 12.0, &signals));
+  ASSERT_EQ(1, signals.size());
+  ASSERT_EQ(1, ids.signal_ids.size());
+  EXPECT_EQ(signals[0]->id().id(), ids.signal_ids[0]);
+
+  std::vector<JunctionInfoConstPtr> junctions;
+  EXPECT_EQ(0, hdmap_impl_.GetJunctions(point, 12.0, &junctions));
+  EXPECT_EQ(junctions.size(), ids.junction_ids.size());
+
+  // Layers outside the mask stay empty.
+  EXPECT_TRUE(ids.crosswalk_ids.empty());
+  EXPECT_TRUE(ids.stop_sign_ids.empty());
+}
+
 TEST_F(HDMapImplTestSuite, GetYieldSigns) {
   std::vector<YieldSignInfoConstPtr> yield_signs;
 
@@ -0,0 +1,393 @@
+/* Copyright 2019 The Apollo Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+=========================================================================*/
+
+#include "modules/map/hdmap/hdmap_tile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <utility>
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace hdmap {
+namespace {
+
+constexpr char kTileIndexFile[] = "tile_index.bin";
+
+std::pair<int, int> TileOf(const double x, const double y,
+                           const double tile_size) {
+  return {static_cast<int>(std::floor(x / tile_size)),
+          static_cast<int>(std::floor(y / tile_size))};
+}
+
+std::string TileFileName(const std::pair<int, int>& tile) {
+  return "tile_" + std::to_string(tile.first) + "_" +
+         std::to_string(tile.second) + ".bin";
+}
+
+bool FirstCurvePoint(const Curve& curve, apollo::common::PointENU* point) {
+  for (const auto& segment : curve.segment()) {
+    if (segment.has_line_segment() && segment.line_segment().point_size() > 0) {
+      *point = segment.line_segment().point(0);
+      return true;
+    }
+    if (segment.has_start_position()) {
+      *point = segment.start_position();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FirstPolygonPoint(const Polygon& polygon,
+                       apollo::common::PointENU* point) {
+  if (polygon.point_size() == 0) {
+    return false;
+  }
+  *point = polygon.point(0);
+  return true;
+}
+
+}  // namespace
+
+TiledHDMap::~TiledHDMap() { WaitForPrefetch(); }
+
+int TiledHDMap::SplitMap(const Map& map_proto, const double tile_size,
+                         const std::string& tile_dir) {
+  if (tile_size <= 0.0) {
+    AERROR << "Invalid tile size: " << tile_size;
+    return -1;
+  }
+  if (!cyber::common::EnsureDirectory(tile_dir)) {
+    AERROR << "Failed to create tile directory " << tile_dir;
+    return -1;
+  }
+
+  // Per-tile map content, plus the tile of every element id so overlaps can
+  // follow their participating objects.
+  std::map<std::pair<int, int>, Map> tiles;
+  std::unordered_map<std::string, std::pair<int, int>> object_tiles;
+  const auto assign = [&](const std::string& id,
+                          const apollo::common::PointENU& point)
+      -> Map* {
+    const auto tile = TileOf(point.x(), point.y(), tile_size);
+    object_tiles[id] = tile;
+    return &tiles[tile];
+  };
+
+  apollo::common::PointENU point;
+  for (const auto& lane : map_proto.lane()) {
+    if (FirstCurvePoint(lane.central_curve(), &point)) {
+      *assign(lane.id().id(), point)->add_lane() = lane;
+    } else {
+      AWARN << "Lane " << lane.id().id() << " has no geometry, dropped.";
+    }
+  }
+  for (const auto& junction : map_proto.junction()) {
+    if (FirstPolygonPoint(junction.polygon(), &point)) {
+      *assign(junction.id().id(), point)->add_junction() = junction;
+    }
+  }
+  for (const auto& crosswalk : map_proto.crosswalk()) {
+    if (FirstPolygonPoint(crosswalk.polygon(), &point)) {
+      *assign(crosswalk.id().id(), point)->add_crosswalk() = crosswalk;
+    }
+  }
+  for (const auto& signal : map_proto.signal()) {
+    if (signal.stop_line_size() > 0 &&
+        FirstCurvePoint(signal.stop_line(0), &point)) {
+      *assign(signal.id().id(), point)->add_signal() = signal;
+    }
+  }
+  for (const auto& stop_sign : map_proto.stop_sign()) {
+    if (stop_sign.stop_line_size() > 0 &&
+        FirstCurvePoint(stop_sign.stop_line(0), &point)) {
+      *assign(stop_sign.id().id(), point)->add_stop_sign() = stop_sign;
+    }
+  }
+  for (const auto& yield_sign : map_proto.yield()) {
+    if (yield_sign.stop_line_size() > 0 &&
+        FirstCurvePoint(yield_sign.stop_line(0), &point)) {
+      *assign(yield_sign.id().id(), point)->add_yield() = yield_sign;
+    }
+  }
+  for (const auto& clear_area : map_proto.clear_area()) {
+    if (FirstPolygonPoint(clear_area.polygon(), &point)) {
+      *assign(clear_area.id().id(), point)->add_clear_area() = clear_area;
+    }
+  }
+  for (const auto& speed_bump : map_proto.speed_bump()) {
+    if (speed_bump.position_size() > 0 &&
+        FirstCurvePoint(speed_bump.position(0), &point)) {
+      *assign(speed_bump.id().id(), point)->add_speed_bump() = speed_bump;
+    }
+  }
+  for (const auto& parking_space : map_proto.parking_space()) {
+    if (FirstPolygonPoint(parking_space.polygon(), &point)) {
+      *assign(parking_space.id().id(), point)->add_parking_space() =
+          parking_space;
+    }
+  }
+  for (const auto& pnc_junction : map_proto.pnc_junction()) {
+    if (FirstPolygonPoint(pnc_junction.polygon(), &point)) {
+      *assign(pnc_junction.id().id(), point)->add_pnc_junction() =
+          pnc_junction;
+    }
+  }
+
+  // A road follows its lanes and may span several tiles.
+  for (const auto& road : map_proto.road()) {
+    std::set<std::pair<int, int>> road_tiles;
+    for (const auto& section : road.section()) {
+      for (const auto& lane_id : section.lane_id()) {
+        const auto iter = object_tiles.find(lane_id.id());
+        if (iter != object_tiles.end()) {
+          road_tiles.insert(iter->second);
+        }
+      }
+    }
+    for (const auto& tile : road_tiles) {
+      *tiles[tile].add_road() = road;
+    }
+  }
+
+  // An overlap goes wherever any of its objects went, duplicated across
+  // tiles so each tile stays self-contained.
+  for (const auto& overlap : map_proto.overlap()) {
+    std::set<std::pair<int, int>> overlap_tiles;
+    for (const auto& object : overlap.object()) {
+      const auto iter = object_tiles.find(object.id().id());
+      if (iter != object_tiles.end()) {
+        overlap_tiles.insert(iter->second);
+      }
+    }
+    for (const auto& tile : overlap_tiles) {
+      *tiles[tile].add_overlap() = overlap;
+    }
+  }
+
+  MapTileIndex index;
+  index.set_tile_size(tile_size);
+  for (auto& tile : tiles) {
+    if (map_proto.has_header()) {
+      *tile.second.mutable_header() = map_proto.header();
+    }
+    const std::string file_name = TileFileName(tile.first);
+    if (!cyber::common::SetProtoToBinaryFile(tile.second,
+                                             tile_dir + "/" + file_name)) {
+      AERROR << "Failed to write tile " << file_name;
+      return -1;
+    }
+    auto* meta = index.add_tiles();
+    meta->set_file_name(file_name);
+    meta->set_tile_x(tile.first.first);
+    meta->set_tile_y(tile.first.second);
+    for (const auto& lane : tile.second.lane()) {
+      meta->add_lane_id(lane.id().id());
+    }
+  }
+  if (!cyber::common::SetProtoToBinaryFile(index,
+                                           tile_dir + "/" + kTileIndexFile)) {
+    AERROR << "Failed to write tile index.";
+    return -1;
+  }
+  return 0;
+}
+
+int TiledHDMap::LoadTileIndex(const std::string& tile_dir) {
+  if (!cyber::common::GetProtoFromBinaryFileZeroCopy(
+          tile_dir + "/" + kTileIndexFile, &index_)) {
+    AERROR << "Failed to load tile index from " << tile_dir;
+    return -1;
+  }
+  tile_dir_ = tile_dir;
+  tiles_.clear();
+  tiles_.resize(index_.tiles_size());
+  lane_to_tile_.clear();
+  for (int i = 0; i < index_.tiles_size(); ++i) {
+    for (const auto& lane_id : index_.tiles(i).lane_id()) {
+      lane_to_tile_[lane_id] = i;
+    }
+  }
+  return 0;
+}
+
+bool TiledHDMap::LoadTile(const int tile_index) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tiles_[tile_index] != nullptr) {
+      return true;
+    }
+  }
+  // Parse outside the lock; concurrent loads of the same tile are resolved
+  // below by keeping the first one.
+  Map tile_proto;
+  const std::string path =
+      tile_dir_ + "/" + index_.tiles(tile_index).file_name();
+  if (!cyber::common::GetProtoFromBinaryFileZeroCopy(path, &tile_proto)) {
+    AERROR << "Failed to load tile " << path;
+    return false;
+  }
+  std::unique_ptr<HDMapImpl> tile_map(new HDMapImpl());
+  if (tile_map->LoadMapFromProto(tile_proto) != 0) {
+    AERROR << "Failed to build indexes of tile " << path;
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (tiles_[tile_index] == nullptr) {
+    tiles_[tile_index] = std::move(tile_map);
+  }
+  return true;
+}
+
+int TiledHDMap::EnsureTilesAround(const apollo::common::PointENU& point,
+                                  const double radius) {
+  if (index_.tiles_size() == 0) {
+    AERROR << "Tile index is not loaded.";
+    return -1;
+  }
+  const double tile_size = index_.tile_size();
+  const auto min_tile =
+      TileOf(point.x() - radius, point.y() - radius, tile_size);
+  const auto max_tile =
+      TileOf(point.x() + radius, point.y() + radius, tile_size);
+  bool success = true;
+  for (int i = 0; i < index_.tiles_size(); ++i) {
+    const auto& meta = index_.tiles(i);
+    if (meta.tile_x() >= min_tile.first && meta.tile_x() <= max_tile.first &&
+        meta.tile_y() >= min_tile.second && meta.tile_y() <= max_tile.second) {
+      success = LoadTile(i) && success;
+    }
+  }
+  return success ? 0 : -1;
+}
+
+void TiledHDMap::PrefetchRoute(const routing::RoutingResponse& routing) {
+  std::set<int> tile_indices;
+  for (const auto& road : routing.road()) {
+    for (const auto& passage : road.passage()) {
+      for (const auto& segment : passage.segment()) {
+        const auto iter = lane_to_tile_.find(segment.id());
+        if (iter != lane_to_tile_.end()) {
+          tile_indices.insert(iter->second);
+        }
+      }
+    }
+  }
+  if (tile_indices.empty()) {
+    return;
+  }
+  WaitForPrefetch();
+  prefetch_thread_ = std::thread([this, tile_indices]() {
+    for (const int tile_index : tile_indices) {
+      LoadTile(tile_index);
+    }
+  });
+}
+
+void TiledHDMap::WaitForPrefetch() {
+  if (prefetch_thread_.joinable()) {
+    prefetch_thread_.join();
+  }
+}
+
+std::vector<const HDMapImpl*> TiledHDMap::LoadedMaps() const {
+  std::vector<const HDMapImpl*> maps;
+  std::lock_guard<std::mutex> lock(mutex_);
+  maps.reserve(tiles_.size());
+  for (const auto& tile : tiles_) {
+    if (tile != nullptr) {
+      maps.push_back(tile.get());
+    }
+  }
+  return maps;
+}
+
+LaneInfoConstPtr TiledHDMap::GetLaneById(const Id& id) const {
+  for (const HDMapImpl* map : LoadedMaps()) {
+    auto lane = map->GetLaneById(id);
+    if (lane != nullptr) {
+      return lane;
+    }
+  }
+  return nullptr;
+}
+
+RoadInfoConstPtr TiledHDMap::GetRoadById(const Id& id) const {
+  for (const HDMapImpl* map : LoadedMaps()) {
+    auto road = map->GetRoadById(id);
+    if (road != nullptr) {
+      return road;
+    }
+  }
+  return nullptr;
+}
+
+int TiledHDMap::GetLanes(const apollo::common::PointENU& point,
+                         double distance,
+                         std::vector<LaneInfoConstPtr>* lanes) const {
+  if (lanes == nullptr) {
+    return -1;
+  }
+  lanes->clear();
+  std::set<std::string> seen;
+  for (const HDMapImpl* map : LoadedMaps()) {
+    std::vector<LaneInfoConstPtr> tile_lanes;
+    if (map->GetLanes(point, distance, &tile_lanes) != 0) {
+      continue;
+    }
+    for (auto& lane : tile_lanes) {
+      if (seen.insert(lane->id().id()).second) {
+        lanes->push_back(std::move(lane));
+      }
+    }
+  }
+  return 0;
+}
+
+int TiledHDMap::GetNearestLane(const apollo::common::PointENU& point,
+                               LaneInfoConstPtr* nearest_lane,
+                               double* nearest_s, double* nearest_l) const {
+  CHECK_NOTNULL(nearest_lane);
+  CHECK_NOTNULL(nearest_s);
+  CHECK_NOTNULL(nearest_l);
+  bool found = false;
+  for (const HDMapImpl* map : LoadedMaps()) {
+    LaneInfoConstPtr lane;
+    double s = 0.0;
+    double l = 0.0;
+    if (map->GetNearestLane(point, &lane, &s, &l) != 0) {
+      continue;
+    }
+    if (!found || std::fabs(l) < std::fabs(*nearest_l)) {
+      *nearest_lane = lane;
+      *nearest_s = s;
+      *nearest_l = l;
+      found = true;
+    }
+  }
+  return found ? 0 : -1;
+}
+
+size_t TiledHDMap::LoadedTileNum() const {
+  return LoadedMaps().size();
+}
+
+}  // namespace hdmap
+}  // namespace apollo
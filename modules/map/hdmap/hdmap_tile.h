@@ -0,0 +1,134 @@
+/* Copyright 2019 The Apollo Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+=========================================================================*/
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "modules/map/hdmap/hdmap_impl.h"
+#include "modules/map/proto/map_tile.pb.h"
+#include "modules/routing/proto/routing.pb.h"
+
+/**
+ * @namespace apollo::hdmap
+ * @brief apollo::hdmap
+ */
+namespace apollo {
+namespace hdmap {
+
+/**
+ * @class TiledHDMap
+ *
+ * @brief Tiled map loader that materializes map content on demand.
+ *
+ * LoadMapFromFile parses the whole base map and builds every KD-tree up
+ * front, which costs tens of seconds and gigabytes on city-scale maps even
+ * though a drive only touches a corridor of it. TiledHDMap works against a
+ * directory of square tiles produced by SplitMap(): loading the index is
+ * cheap (tile bounds and lane ids only), tiles around the vehicle pose are
+ * loaded on demand through EnsureTilesAround(), and PrefetchRoute() walks
+ * the lane ids of a RoutingResponse to pull upcoming tiles in on a
+ * background thread before the vehicle reaches them. Loaded tiles are
+ * complete HDMapImpl instances and are never evicted; queries see the union
+ * of everything loaded so far.
+ */
+class TiledHDMap {
+ public:
+  TiledHDMap() = default;
+  ~TiledHDMap();
+
+  /**
+   * @brief Split a map into square tiles plus an index file. Each element
+   *        goes to the tile containing its first geometry point; roads
+   *        follow their lanes and overlaps are duplicated into the tile of
+   *        every participating object, so per-tile content is
+   *        self-contained.
+   * @param map_proto The full map.
+   * @param tile_size Edge length of a tile in meters.
+   * @param tile_dir Output directory, created when missing.
+   * @return 0:success, otherwise failed
+   */
+  static int SplitMap(const Map& map_proto, const double tile_size,
+                      const std::string& tile_dir);
+
+  /**
+   * @brief Load the tile index of a directory produced by SplitMap().
+   *        No tile content is parsed yet.
+   * @return 0:success, otherwise failed
+   */
+  int LoadTileIndex(const std::string& tile_dir);
+
+  /**
+   * @brief Synchronously load every tile overlapping the square of the
+   *        given radius around a position. Already loaded tiles are kept.
+   * @return 0:success, otherwise failed
+   */
+  int EnsureTilesAround(const apollo::common::PointENU& point,
+                        const double radius);
+
+  /**
+   * @brief Load the tiles holding the lanes of a routing response on a
+   *        background thread. A running prefetch is finished first.
+   */
+  void PrefetchRoute(const routing::RoutingResponse& routing);
+
+  /**
+   * @brief Block until the current background prefetch is done.
+   */
+  void WaitForPrefetch();
+
+  LaneInfoConstPtr GetLaneById(const Id& id) const;
+  RoadInfoConstPtr GetRoadById(const Id& id) const;
+
+  /**
+   * @brief get all loaded lanes in certain range
+   * @return 0:success, otherwise failed
+   */
+  int GetLanes(const apollo::common::PointENU& point, double distance,
+               std::vector<LaneInfoConstPtr>* lanes) const;
+
+  /**
+   * @brief get nearest lane among the loaded tiles
+   * @return 0:success, otherwise failed
+   */
+  int GetNearestLane(const apollo::common::PointENU& point,
+                     LaneInfoConstPtr* nearest_lane, double* nearest_s,
+                     double* nearest_l) const;
+
+  size_t LoadedTileNum() const;
+
+ private:
+  // Load the tile at the given index position; no-op when already loaded.
+  bool LoadTile(const int tile_index);
+  // Snapshot the loaded maps for lock-free querying; tiles are never
+  // unloaded, so the pointers stay valid.
+  std::vector<const HDMapImpl*> LoadedMaps() const;
+
+  std::string tile_dir_;
+  MapTileIndex index_;
+  std::vector<std::unique_ptr<HDMapImpl>> tiles_;
+  std::unordered_map<std::string, int> lane_to_tile_;
+
+  mutable std::mutex mutex_;
+  std::thread prefetch_thread_;
+};
+
+}  // namespace hdmap
+}  // namespace apollo
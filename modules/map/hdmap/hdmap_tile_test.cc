@@ -0,0 +1,117 @@
+/* Copyright 2019 The Apollo Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+=========================================================================*/
+
+#include "modules/map/hdmap/hdmap_tile.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/common/file.h"
+
+namespace apollo {
+namespace hdmap {
+namespace {
+
+void AddLane(Map* map, const std::string& id, const double start_x,
+             const double y) {
+  auto* lane = map->add_lane();
+  lane->mutable_id()->set_id(id);
+  auto* segment = lane->mutable_central_curve()->add_segment();
+  auto* line = segment->mutable_line_segment();
+  for (int i = 0; i <= 10; ++i) {
+    auto* point = line->add_point();
+    point->set_x(start_x + i);
+    point->set_y(y);
+  }
+  segment->set_s(0.0);
+  segment->set_length(10.0);
+  lane->set_length(10.0);
+}
+
+}  // namespace
+
+class TiledHDMapTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    tile_dir_ = "tiled_hdmap_test_data";
+    Map map;
+    // Two lanes in different 500 m tiles, and a road following lane_a.
+    AddLane(&map, "lane_a", 0.0, 0.0);
+    AddLane(&map, "lane_b", 1000.0, 0.0);
+    auto* road = map.add_road();
+    road->mutable_id()->set_id("road_a");
+    road->add_section()->add_lane_id()->set_id("lane_a");
+    ASSERT_EQ(0, TiledHDMap::SplitMap(map, 500.0, tile_dir_));
+  }
+
+  void TearDown() override {
+    cyber::common::RemoveAllFiles(tile_dir_);
+    rmdir(tile_dir_.c_str());
+  }
+
+  std::string tile_dir_;
+};
+
+TEST_F(TiledHDMapTest, LoadOnDemand) {
+  TiledHDMap map;
+  ASSERT_EQ(0, map.LoadTileIndex(tile_dir_));
+  EXPECT_EQ(0, map.LoadedTileNum());
+
+  apollo::common::PointENU position;
+  position.set_x(5.0);
+  position.set_y(0.0);
+  ASSERT_EQ(0, map.EnsureTilesAround(position, 100.0));
+  EXPECT_EQ(1, map.LoadedTileNum());
+
+  Id id;
+  id.set_id("lane_a");
+  EXPECT_NE(nullptr, map.GetLaneById(id));
+  id.set_id("lane_b");
+  EXPECT_EQ(nullptr, map.GetLaneById(id));
+  id.set_id("road_a");
+  EXPECT_NE(nullptr, map.GetRoadById(id));
+
+  std::vector<LaneInfoConstPtr> lanes;
+  EXPECT_EQ(0, map.GetLanes(position, 50.0, &lanes));
+  ASSERT_EQ(1, lanes.size());
+  EXPECT_EQ("lane_a", lanes[0]->id().id());
+
+  LaneInfoConstPtr nearest_lane;
+  double nearest_s = 0.0;
+  double nearest_l = 0.0;
+  ASSERT_EQ(0, map.GetNearestLane(position, &nearest_lane, &nearest_s,
+                                  &nearest_l));
+  EXPECT_EQ("lane_a", nearest_lane->id().id());
+}
+
+TEST_F(TiledHDMapTest, PrefetchRoute) {
+  TiledHDMap map;
+  ASSERT_EQ(0, map.LoadTileIndex(tile_dir_));
+
+  routing::RoutingResponse routing;
+  routing.add_road()->add_passage()->add_segment()->set_id("lane_b");
+  map.PrefetchRoute(routing);
+  map.WaitForPrefetch();
+  EXPECT_EQ(1, map.LoadedTileNum());
+
+  Id id;
+  id.set_id("lane_b");
+  EXPECT_NE(nullptr, map.GetLaneById(id));
+}
+
+}  // namespace hdmap
+}  // namespace apollo
@@ -88,11 +88,11 @@ std::unique_ptr<HDMap> CreateMap(const MapMsg& map_msg) {
   return hdmap;
 }
 
-std::unique_ptr<HDMap> HDMapUtil::base_map_ = nullptr;
+std::shared_ptr<const HDMap> HDMapUtil::base_map_ = nullptr;
 uint64_t HDMapUtil::base_map_seq_ = 0;
 std::mutex HDMapUtil::base_map_mutex_;
 
-std::unique_ptr<HDMap> HDMapUtil::sim_map_ = nullptr;
+std::shared_ptr<const HDMap> HDMapUtil::sim_map_ = nullptr;
 std::mutex HDMapUtil::sim_map_mutex_;
 
 const HDMap* HDMapUtil::BaseMapPtr(const MapMsg& map_msg) {
@@ -156,6 +156,26 @@ const HDMap* HDMapUtil::SimMapPtr() {
 
 const HDMap& HDMapUtil::SimMap() { return *CHECK_NOTNULL(SimMapPtr()); }
 
+std::shared_ptr<const HDMap> HDMapUtil::BaseMapSharedPtr() {
+  if (BaseMapPtr() == nullptr) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(base_map_mutex_);
+  return base_map_;
+}
+
+std::shared_ptr<const HDMap> HDMapUtil::SimMapSharedPtr() {
+  if (SimMapPtr() == nullptr) {
+    return nullptr;
+  }
+  if (FLAGS_use_navigation_mode) {
+    std::lock_guard<std::mutex> lock(base_map_mutex_);
+    return base_map_;
+  }
+  std::lock_guard<std::mutex> lock(sim_map_mutex_);
+  return sim_map_;
+}
+
 bool HDMapUtil::ReloadMaps() {
   {
     std::lock_guard<std::mutex> lock(base_map_mutex_);
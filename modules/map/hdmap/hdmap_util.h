@@ -92,17 +92,26 @@ class HDMapUtil {
   // Guarantee to return a valid sim_map, or else raise fatal error.
   static const HDMap& SimMap();
 
+  // Get an immutable shared snapshot of the base map. Unlike the raw
+  // pointer from BaseMapPtr(), the snapshot stays valid even after
+  // ReloadMaps() swaps in a new map, so holders never observe the map
+  // being replaced underneath them.
+  static std::shared_ptr<const HDMap> BaseMapSharedPtr();
+
+  // Get an immutable shared snapshot of the sim map; see BaseMapSharedPtr().
+  static std::shared_ptr<const HDMap> SimMapSharedPtr();
+
   // Reload maps from the file specified by global flags.
   static bool ReloadMaps();
 
  private:
   HDMapUtil() = delete;
 
-  static std::unique_ptr<HDMap> base_map_;
+  static std::shared_ptr<const HDMap> base_map_;
   static uint64_t base_map_seq_;
   static std::mutex base_map_mutex_;
 
-  static std::unique_ptr<HDMap> sim_map_;
+  static std::shared_ptr<const HDMap> sim_map_;
   static std::mutex sim_map_mutex_;
 };
 
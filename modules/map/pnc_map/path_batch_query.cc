@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file:
+ **/
+
+#include "modules/map/pnc_map/path_batch_query.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "modules/common/math/math_utils.h"
+
+namespace apollo {
+namespace hdmap {
+
+using common::math::Box2d;
+using common::math::Vec2d;
+using common::math::kMathEpsilon;
+
+void PathBatchQuery::Init(const Path &path) {
+  segments_ = path.segments();
+  accumulated_s_ = path.accumulated_s();
+  num_segments_ = static_cast<int>(segments_.size());
+  start_x_.resize(num_segments_);
+  start_y_.resize(num_segments_);
+  unit_x_.resize(num_segments_);
+  unit_y_.resize(num_segments_);
+  length_.resize(num_segments_);
+  for (int i = 0; i < num_segments_; ++i) {
+    start_x_[i] = segments_[i].start().x();
+    start_y_[i] = segments_[i].start().y();
+    unit_x_[i] = segments_[i].unit_direction().x();
+    unit_y_[i] = segments_[i].unit_direction().y();
+    length_[i] = segments_[i].length();
+  }
+}
+
+int PathBatchQuery::NearestSegment(const Vec2d &point,
+                                   double *min_dist_sqr) const {
+  const Eigen::ArrayXd rel_x = point.x() - start_x_;
+  const Eigen::ArrayXd rel_y = point.y() - start_y_;
+  const Eigen::ArrayXd proj =
+      (rel_x * unit_x_ + rel_y * unit_y_).max(0.0).min(length_);
+  const Eigen::ArrayXd diff_x = rel_x - unit_x_ * proj;
+  const Eigen::ArrayXd diff_y = rel_y - unit_y_ * proj;
+  Eigen::Index min_index = 0;
+  *min_dist_sqr = (diff_x * diff_x + diff_y * diff_y).minCoeff(&min_index);
+  return static_cast<int>(min_index);
+}
+
+bool PathBatchQuery::GetProjections(
+    const std::vector<Vec2d> &points,
+    std::vector<PathProjection> *projections) const {
+  if (projections == nullptr || num_segments_ == 0) {
+    return false;
+  }
+  projections->resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const Vec2d &point = points[i];
+    auto &result = (*projections)[i];
+    double min_dist_sqr = std::numeric_limits<double>::infinity();
+    const int min_index = NearestSegment(point, &min_dist_sqr);
+    result.distance = std::sqrt(min_dist_sqr);
+    const auto &nearest_seg = segments_[min_index];
+    const auto prod = nearest_seg.ProductOntoUnit(point);
+    const auto proj = nearest_seg.ProjectOntoUnit(point);
+    if (min_index == 0) {
+      result.accumulate_s = std::min(proj, nearest_seg.length());
+      if (proj < 0) {
+        result.lateral = prod;
+      } else {
+        result.lateral = (prod > 0.0 ? 1 : -1) * result.distance;
+      }
+    } else if (min_index == num_segments_ - 1) {
+      result.accumulate_s = accumulated_s_[min_index] + std::max(0.0, proj);
+      if (proj > 0) {
+        result.lateral = prod;
+      } else {
+        result.lateral = (prod > 0.0 ? 1 : -1) * result.distance;
+      }
+    } else {
+      result.accumulate_s = accumulated_s_[min_index] +
+                            std::max(0.0, std::min(proj, nearest_seg.length()));
+      result.lateral = (prod > 0.0 ? 1 : -1) * result.distance;
+    }
+  }
+  return true;
+}
+
+bool PathBatchQuery::OverlapWith(const std::vector<Box2d> &boxes,
+                                 const double width,
+                                 std::vector<bool> *overlaps) const {
+  if (overlaps == nullptr || num_segments_ == 0) {
+    return false;
+  }
+  overlaps->assign(boxes.size(), false);
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    const Box2d &box = boxes[i];
+    const Vec2d center = box.center();
+    const double radius_sqr =
+        common::math::Sqr(box.diagonal() / 2.0 + width) + kMathEpsilon;
+    // Vectorized coarse filter: squared distance from the box center to
+    // every segment; only survivors get the exact box-segment check.
+    const Eigen::ArrayXd rel_x = center.x() - start_x_;
+    const Eigen::ArrayXd rel_y = center.y() - start_y_;
+    const Eigen::ArrayXd proj =
+        (rel_x * unit_x_ + rel_y * unit_y_).max(0.0).min(length_);
+    const Eigen::ArrayXd diff_x = rel_x - unit_x_ * proj;
+    const Eigen::ArrayXd diff_y = rel_y - unit_y_ * proj;
+    const Eigen::ArrayXd dist_sqr = diff_x * diff_x + diff_y * diff_y;
+    for (int j = 0; j < num_segments_; ++j) {
+      if (dist_sqr[j] > radius_sqr) {
+        continue;
+      }
+      if (box.DistanceTo(segments_[j]) <= width + kMathEpsilon) {
+        (*overlaps)[i] = true;
+        break;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace hdmap
+}  // namespace apollo
@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file:
+ **/
+
+#pragma once
+
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "modules/common/math/box2d.h"
+#include "modules/common/math/line_segment2d.h"
+#include "modules/common/math/vec2d.h"
+#include "modules/map/pnc_map/path.h"
+
+namespace apollo {
+namespace hdmap {
+
+/**
+ * @brief Result of one projection in PathBatchQuery::GetProjections.
+ */
+struct PathProjection {
+  double accumulate_s = 0.0;
+  double lateral = 0.0;
+  double distance = 0.0;
+};
+
+/**
+ * @class PathBatchQuery
+ *
+ * @brief Batched point-projection and box-overlap queries against a Path.
+ *
+ * Planning issues on the order of a hundred obstacle queries against the
+ * same reference path every frame; Path::GetProjection and
+ * Path::OverlapWith answer them one at a time with scalar loops over the
+ * segments. PathBatchQuery copies the segment geometry once into
+ * contiguous arrays at Init() and evaluates each query as one clamped
+ * projection array expression over all segments, so the per-segment math
+ * vectorizes. Results match the non-approximated Path queries exactly;
+ * the geometry copy keeps the engine valid independent of the source
+ * Path's lifetime.
+ */
+class PathBatchQuery {
+ public:
+  PathBatchQuery() = default;
+  explicit PathBatchQuery(const Path &path) { Init(path); }
+
+  /**
+   * @brief (Re)load the segment geometry of a path. Queries issued before
+   *        Init() report failure / no overlap.
+   */
+  void Init(const Path &path);
+
+  int num_segments() const { return num_segments_; }
+
+  /**
+   * @brief Project a batch of points onto the path. Mirrors
+   *        Path::GetProjection for each point.
+   * @param points the query points
+   * @param projections one entry per query point
+   * @return false when the engine is empty or projections is null
+   */
+  bool GetProjections(const std::vector<common::math::Vec2d> &points,
+                      std::vector<PathProjection> *projections) const;
+
+  /**
+   * @brief Check a batch of boxes for overlap with the path. Mirrors
+   *        Path::OverlapWith(box, width) for each box.
+   * @param boxes the obstacle boxes
+   * @param width lateral expansion of the path
+   * @param overlaps one flag per box
+   * @return false when the engine is empty or overlaps is null
+   */
+  bool OverlapWith(const std::vector<common::math::Box2d> &boxes,
+                   const double width, std::vector<bool> *overlaps) const;
+
+ private:
+  // Index of the segment nearest to the point and its squared distance.
+  int NearestSegment(const common::math::Vec2d &point,
+                     double *min_dist_sqr) const;
+
+  int num_segments_ = 0;
+  std::vector<common::math::LineSegment2d> segments_;
+  std::vector<double> accumulated_s_;
+  // SoA segment geometry for the vectorized kernels.
+  Eigen::ArrayXd start_x_;
+  Eigen::ArrayXd start_y_;
+  Eigen::ArrayXd unit_x_;
+  Eigen::ArrayXd unit_y_;
+  Eigen::ArrayXd length_;
+};
+
+}  // namespace hdmap
+}  // namespace apollo
@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/map/pnc_map/path_batch_query.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using Box2d = apollo::common::math::Box2d;
+using Vec2d = apollo::common::math::Vec2d;
+
+namespace apollo {
+namespace hdmap {
+namespace {
+
+MapPathPoint MakeMapPathPoint(double x, double y, double heading = 0) {
+  return MapPathPoint({x, y}, heading);
+}
+
+double RandomDouble(double s, double t) {
+  return s + (t - s) / 16383.0 * (rand() & 16383);  // NOLINT
+}
+
+}  // namespace
+
+TEST(PathBatchQueryTest, GetProjectionsMatchesPath) {
+  std::vector<MapPathPoint> points;
+  // An L-shaped path with a few hundred points, like a reference line.
+  for (int i = 0; i <= 100; ++i) {
+    points.push_back(MakeMapPathPoint(i * 0.5, 0));
+  }
+  for (int i = 1; i <= 100; ++i) {
+    points.push_back(MakeMapPathPoint(50, i * 0.5));
+  }
+  const Path path(points);
+  const PathBatchQuery query(path);
+  EXPECT_EQ(path.num_segments(), query.num_segments());
+
+  std::vector<Vec2d> queries;
+  for (int i = 0; i < 100; ++i) {
+    queries.emplace_back(RandomDouble(-10, 60), RandomDouble(-10, 60));
+  }
+  std::vector<PathProjection> projections;
+  ASSERT_TRUE(query.GetProjections(queries, &projections));
+  ASSERT_EQ(queries.size(), projections.size());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    double accumulate_s = 0.0;
+    double lateral = 0.0;
+    double distance = 0.0;
+    ASSERT_TRUE(
+        path.GetProjection(queries[i], &accumulate_s, &lateral, &distance));
+    EXPECT_NEAR(accumulate_s, projections[i].accumulate_s, 1e-9);
+    EXPECT_NEAR(lateral, projections[i].lateral, 1e-9);
+    EXPECT_NEAR(distance, projections[i].distance, 1e-9);
+  }
+}
+
+TEST(PathBatchQueryTest, OverlapWithMatchesPath) {
+  std::vector<MapPathPoint> points;
+  for (int i = 0; i <= 200; ++i) {
+    points.push_back(MakeMapPathPoint(i * 0.5, 0));
+  }
+  const Path path(points);
+  const PathBatchQuery query(path);
+
+  std::vector<Box2d> boxes;
+  for (int i = 0; i < 100; ++i) {
+    boxes.emplace_back(
+        Vec2d(RandomDouble(-10, 110), RandomDouble(-10, 10)),
+        RandomDouble(0, M_PI), RandomDouble(0.5, 5), RandomDouble(0.5, 2));
+  }
+  const double width = 1.5;
+  std::vector<bool> overlaps;
+  ASSERT_TRUE(query.OverlapWith(boxes, width, &overlaps));
+  ASSERT_EQ(boxes.size(), overlaps.size());
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    EXPECT_EQ(path.OverlapWith(boxes[i], width), overlaps[i]) << i;
+  }
+}
+
+TEST(PathBatchQueryTest, EmptyQuery) {
+  PathBatchQuery query;
+  std::vector<PathProjection> projections;
+  EXPECT_FALSE(query.GetProjections({{0, 0}}, &projections));
+  std::vector<bool> overlaps;
+  EXPECT_FALSE(query.OverlapWith({}, 1.0, &overlaps));
+}
+
+}  // namespace hdmap
+}  // namespace apollo
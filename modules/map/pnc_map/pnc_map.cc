@@ -262,6 +262,7 @@ bool PncMap::UpdateRoutingResponse(const routing::RoutingResponse &routing) {
   }
   routing_ = routing;
   adc_waypoint_ = LaneWaypoint();
+  passage_cache_ = PassageCache();
   stop_for_destination_ = false;
   return true;
 }
@@ -439,13 +440,32 @@ bool PncMap::GetRouteSegments(const VehicleState &vehicle_state,
   const int road_index = route_index[0];
   const int passage_index = route_index[1];
   const auto &road = routing_.road(road_index);
-  // Raw filter to find all neighboring passages
-  auto drive_passages = GetNeighborPassages(road, passage_index);
-  for (const int index : drive_passages) {
+  // Raw filter to find all neighboring passages. The expansion and the
+  // passage-to-segment conversion only change when the adc enters another
+  // passage or passes a routing waypoint, so they are cached across cycles.
+  if (passage_cache_.road_index != road_index ||
+      passage_cache_.passage_index != passage_index ||
+      passage_cache_.next_routing_waypoint_index !=
+          next_routing_waypoint_index_) {
+    passage_cache_.road_index = road_index;
+    passage_cache_.passage_index = passage_index;
+    passage_cache_.next_routing_waypoint_index = next_routing_waypoint_index_;
+    passage_cache_.drive_passages = GetNeighborPassages(road, passage_index);
+    passage_cache_.passage_segments.clear();
+    for (const int index : passage_cache_.drive_passages) {
+      RouteSegments segments;
+      if (!PassageToSegments(road.passage(index), &segments)) {
+        ADEBUG << "Failed to convert passage to lane segments.";
+        segments.clear();
+      }
+      passage_cache_.passage_segments.emplace_back(std::move(segments));
+    }
+  }
+  for (size_t i = 0; i < passage_cache_.drive_passages.size(); ++i) {
+    const int index = passage_cache_.drive_passages[i];
     const auto &passage = road.passage(index);
-    RouteSegments segments;
-    if (!PassageToSegments(passage, &segments)) {
-      ADEBUG << "Failed to convert passage to lane segments.";
+    const RouteSegments &segments = passage_cache_.passage_segments[i];
+    if (segments.empty()) {
       continue;
     }
     PointENU nearest_point =
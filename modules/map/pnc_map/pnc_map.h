@@ -205,6 +205,24 @@ class PncMap {
    */
   LaneWaypoint adc_waypoint_;
 
+  /**
+   * @brief Cached neighbor-passage expansion of the passage the adc is on.
+   * GetNeighborPassages() and PassageToSegments() depend only on the
+   * routing, the adc passage and the next routing waypoint, so while the
+   * adc moves along the same passage GetRouteSegments() reuses this cache
+   * and only re-projects and re-extends around the new position.
+   */
+  struct PassageCache {
+    int road_index = -1;
+    int passage_index = -1;
+    std::size_t next_routing_waypoint_index = 0;
+    std::vector<int> drive_passages;
+    // Converted segments parallel to drive_passages; empty entries mark
+    // passages that failed to convert.
+    std::vector<RouteSegments> passage_segments;
+  };
+  PassageCache passage_cache_;
+
   /**
    * @brief Indicates whether the adc should start consider destination.
    * In a looped routing, the vehicle may need to pass by the destination
@@ -216,6 +234,7 @@ class PncMap {
   bool stop_for_destination_ = false;
 
   FRIEND_TEST(PncMapTest, UpdateRouting);
+  FRIEND_TEST(PncMapTest, GetRouteSegments_PassageCache);
   FRIEND_TEST(PncMapTest, GetNearestPointFromRouting);
   FRIEND_TEST(PncMapTest, UpdateWaypointIndex);
   FRIEND_TEST(PncMapTest, UpdateNextRoutingWaypointIndex);
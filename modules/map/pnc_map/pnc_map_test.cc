@@ -174,6 +174,42 @@ TEST_F(PncMapTest, GetRouteSegments_ChangeLane) {
   EXPECT_FALSE(second.IsOnSegment());
 }
 
+TEST_F(PncMapTest, GetRouteSegments_PassageCache) {
+  auto lane = hdmap_.GetLaneById(hdmap::MakeMapId("9_1_-2"));
+  ASSERT_TRUE(lane);
+  common::VehicleState state;
+  auto point = lane->GetSmoothPoint(0);
+  state.set_x(point.x());
+  state.set_y(point.y());
+  state.set_z(point.y());
+  state.set_heading(M_PI);
+  std::list<RouteSegments> segments;
+  ASSERT_TRUE(pnc_map_->GetRouteSegments(state, 10, 30, &segments));
+  const int cached_road = pnc_map_->passage_cache_.road_index;
+  const int cached_passage = pnc_map_->passage_cache_.passage_index;
+  EXPECT_GE(cached_road, 0);
+
+  // Moving along the same passage keeps the cached expansion and yields the
+  // same passages.
+  point = lane->GetSmoothPoint(1.0);
+  state.set_x(point.x());
+  state.set_y(point.y());
+  std::list<RouteSegments> moved_segments;
+  ASSERT_TRUE(pnc_map_->GetRouteSegments(state, 10, 30, &moved_segments));
+  EXPECT_EQ(cached_road, pnc_map_->passage_cache_.road_index);
+  EXPECT_EQ(cached_passage, pnc_map_->passage_cache_.passage_index);
+  ASSERT_EQ(segments.size(), moved_segments.size());
+  auto iter = segments.begin();
+  auto moved_iter = moved_segments.begin();
+  for (; iter != segments.end(); ++iter, ++moved_iter) {
+    EXPECT_EQ(iter->Id(), moved_iter->Id());
+  }
+
+  // A new routing drops the cache.
+  EXPECT_TRUE(pnc_map_->UpdateRoutingResponse(routing_));
+  EXPECT_EQ(-1, pnc_map_->passage_cache_.road_index);
+}
+
 TEST_F(PncMapTest, NextWaypointIndex) {
   EXPECT_EQ(0, pnc_map_->NextWaypointIndex(-2));
   EXPECT_EQ(0, pnc_map_->NextWaypointIndex(-1));
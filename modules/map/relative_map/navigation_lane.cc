@@ -148,6 +148,7 @@ void NavigationLane::UpdateNavigationInfo(
     const NavigationInfo &navigation_path) {
   navigation_info_ = navigation_path;
   last_project_index_map_.clear();
+  navi_window_map_.clear();
   navigation_path_list_.clear();
   current_navi_path_tuple_ = std::make_tuple(-1, -1.0, -1.0, nullptr);
   if (FLAGS_enable_cyclic_rerouting) {
@@ -551,12 +552,72 @@ bool NavigationLane::ConvertNavigationLineToPath(const int line_index,
   if (dist < 20) {
     return false;
   }
-  gen_navi_path_loop_func(std::max(0, current_project_index - 3),
-                          navigation_path.path_point_size(), 0.0,
-                          config_.max_len_from_navigation_line(), path);
+
+  // Cut the window around the vehicle out of the entire navigation line and
+  // convert it to FLU coordinates. The window is cached in ENU coordinates
+  // across cycles: between two adjacent perception updates it usually just
+  // slides forward a few points, so only the points newly entering the
+  // window are copied from the entire navigation line and only the cheap
+  // conversion to the current vehicle frame is redone for the rest.
+  const int start_index = std::max(0, current_project_index - 3);
+  const double ref_s = navigation_path.path_point(start_index).s();
+  const int path_point_size = navigation_path.path_point_size();
+  int end_index = start_index;
+  while (end_index < path_point_size) {
+    const double accumulated_s =
+        navigation_path.path_point(end_index).s() - ref_s;
+    ++end_index;
+    if (accumulated_s > config_.max_len_from_navigation_line()) {
+      break;
+    }
+  }
+
+  const auto &navi_window =
+      UpdateNaviWindow(line_index, start_index, end_index);
+  for (const auto &enu_point : navi_window.enu_path.path_point()) {
+    auto *point = path->add_path_point();
+    point->CopyFrom(enu_point);
+    double flu_x = 0.0;
+    double flu_y = 0.0;
+    double flu_theta = 0.0;
+    enu_to_flu_func(point->x(), point->y(), point->theta(), &flu_x, &flu_y,
+                    &flu_theta);
+    point->set_x(flu_x);
+    point->set_y(flu_y);
+    point->set_theta(flu_theta);
+    point->set_s(enu_point.s() - ref_s);
+  }
   return true;
 }
 
+const NaviWindow &NavigationLane::UpdateNaviWindow(const int line_index,
+                                                   const int start_index,
+                                                   const int end_index) {
+  auto &navi_window = navi_window_map_[line_index];
+  const auto &navigation_path =
+      navigation_info_.navigation_path(line_index).path();
+  auto *enu_points = navi_window.enu_path.mutable_path_point();
+
+  if (navi_window.start_index >= 0 && start_index >= navi_window.start_index &&
+      start_index < navi_window.end_index &&
+      end_index >= navi_window.end_index) {
+    // The window slid forward: drop the points which left it and append the
+    // points which entered it.
+    enu_points->DeleteSubrange(0, start_index - navi_window.start_index);
+    for (int i = navi_window.end_index; i < end_index; ++i) {
+      enu_points->Add()->CopyFrom(navigation_path.path_point(i));
+    }
+  } else {
+    enu_points->Clear();
+    for (int i = start_index; i < end_index; ++i) {
+      enu_points->Add()->CopyFrom(navigation_path.path_point(i));
+    }
+  }
+  navi_window.start_index = start_index;
+  navi_window.end_index = end_index;
+  return navi_window;
+}
+
 // project adc_state_ onto path
 ProjIndexPair NavigationLane::UpdateProjectionIndex(const common::Path &path,
                                                     const int line_index) {
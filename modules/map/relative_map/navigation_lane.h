@@ -72,6 +72,23 @@ typedef std::pair<int, int> StitchIndexPair;
 // projection position in the current navigation line.
 typedef std::pair<int, double> ProjIndexPair;
 
+// A cached navigation line window.
+//
+// The window is the portion of an entire navigation line which is cut out
+// around the vehicle, kept in the original ENU coordinates. Between two
+// adjacent perception cycles the window usually just slides forward a few
+// points, so the unchanged points are reused and only the points entering
+// the window are copied from the entire navigation line.
+//
+// "start_index"/"end_index" are the indices of the window in the entire
+// navigation line; [start_index, end_index). Negative values indicate an
+// empty cache.
+struct NaviWindow {
+  int start_index = -1;
+  int end_index = -1;
+  common::Path enu_path;
+};
+
 /**
  * @class NavigationLane
  * @brief NavigationLane generates a real-time relative map based on navagation
@@ -251,6 +268,21 @@ class NavigationLane {
   ProjIndexPair UpdateProjectionIndex(const common::Path& path,
                                       const int line_index);
 
+  /**
+   * @brief Update the cached ENU window of an entire navigation line so that
+   * it covers [start_index, end_index). The points shared with the window of
+   * the previous cycle are reused; only the points newly entering the window
+   * are copied from the entire navigation line.
+   * @param line_index The index of the whole navigation line vector stored in
+   * a `NavigationInfo` object.
+   * @param start_index The first point index of the new window.
+   * @param end_index One past the last point index of the new window.
+   * @return The updated window.
+   */
+  const NaviWindow& UpdateNaviWindow(const int line_index,
+                                     const int start_index,
+                                     const int end_index);
+
   /**
    * @brief If an entire navigation line is a cyclic/circular
    * route, the closest matching point at the starting and end positions is
@@ -296,6 +328,10 @@ class NavigationLane {
   // value: stitching index pair in the "key" line.
   std::unordered_map<int, StitchIndexPair> stitch_index_map_;
 
+  // key: line index,
+  // value: the cached ENU window of the "key" line, reused across cycles.
+  std::unordered_map<int, NaviWindow> navi_window_map_;
+
   // in world coordination: ENU
   localization::Pose original_pose_;
 };
@@ -223,5 +223,22 @@ TEST_F(NavigationLaneTest, GenerateThreeLaneMap) {
   }
 }
 
+TEST_F(NavigationLaneTest, ReuseCachedWindowAcrossCycles) {
+  navigation_line_filenames_.emplace_back(data_file_dir_ + "left.smoothed");
+  EXPECT_TRUE(
+      GenerateNavigationInfo(navigation_line_filenames_, &navigation_info_));
+  navigation_lane_.UpdateNavigationInfo(navigation_info_);
+
+  // The second cycle reuses the cached navigation line window; since the
+  // vehicle has not moved, its output must be identical to the first cycle.
+  EXPECT_TRUE(navigation_lane_.GeneratePath());
+  const std::string first_cycle =
+      navigation_lane_.Path().SerializeAsString();
+  EXPECT_TRUE(navigation_lane_.GeneratePath());
+  const std::string second_cycle =
+      navigation_lane_.Path().SerializeAsString();
+  EXPECT_EQ(first_cycle, second_cycle);
+}
+
 }  // namespace relative_map
 }  // namespace apollo
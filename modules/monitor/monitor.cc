@@ -24,12 +24,17 @@
 #include "modules/monitor/software/channel_monitor.h"
 #include "modules/monitor/software/functional_safety_monitor.h"
 #include "modules/monitor/software/localization_monitor.h"
+#include "modules/monitor/software/metric_monitor.h"
 #include "modules/monitor/software/process_monitor.h"
 #include "modules/monitor/software/summary_monitor.h"
 
 DEFINE_bool(enable_functional_safety, true,
             "Whether to enable functional safety check.");
 
+DEFINE_bool(enable_metric_monitor, false,
+            "Whether to scan the shared metric region for process "
+            "heartbeats, cycle times and queue depths.");
+
 namespace apollo {
 namespace monitor {
 
@@ -47,6 +52,11 @@ bool Monitor::Init() {
   runners_.emplace_back(new LocalizationMonitor());
   // Monitor if processes are running.
   runners_.emplace_back(new ProcessMonitor());
+  // Monitor live process metrics from the shared metric region; detects a
+  // stalled process much faster than the /proc scan above.
+  if (FLAGS_enable_metric_monitor) {
+    runners_.emplace_back(new MetricMonitor());
+  }
   // Monitor if channel messages are updated in time.
   runners_.emplace_back(new ChannelMonitor());
   // Monitor if resources are sufficient.
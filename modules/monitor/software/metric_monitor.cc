@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/monitor/software/metric_monitor.h"
+
+#include <algorithm>
+
+#include "cyber/common/log.h"
+#include "gflags/gflags.h"
+#include "modules/common/util/map_util.h"
+#include "modules/common/util/string_util.h"
+#include "modules/monitor/common/monitor_manager.h"
+#include "modules/monitor/software/summary_monitor.h"
+
+DEFINE_string(metric_monitor_name, "MetricMonitor",
+              "Name of the metric monitor.");
+
+DEFINE_double(metric_monitor_interval, 0.2,
+              "Metric region scanning interval in seconds.");
+
+DEFINE_double(metric_heartbeat_fatal_sec, 1.0,
+              "Maximum heartbeat age before a process is considered stalled.");
+
+DEFINE_uint64(metric_queue_depth_warn, 16,
+              "Pending queue depth which triggers a warning.");
+
+namespace apollo {
+namespace monitor {
+
+using apollo::common::util::StrCat;
+using apollo::cyber::common::MetricSlot;
+
+MetricMonitor::MetricMonitor()
+    : RecurrentRunner(FLAGS_metric_monitor_name,
+                      FLAGS_metric_monitor_interval) {
+  region_ = apollo::cyber::common::AttachMetricRegion();
+  AERROR_IF(region_ == nullptr)
+      << "Failed to attach metric region, metric monitor disabled";
+}
+
+void MetricMonitor::RunOnce(const double current_time) {
+  if (region_ == nullptr) {
+    return;
+  }
+  auto manager = MonitorManager::Instance();
+  const auto& mode = manager->GetHMIMode();
+  auto* components = manager->GetStatus()->mutable_components();
+  for (const auto& iter : mode.monitored_components()) {
+    const std::string& name = iter.first;
+    if (iter.second.has_process() &&
+        apollo::common::util::ContainsKey(*components, name)) {
+      UpdateStatus(current_time, FindSlot(name),
+                   components->at(name).mutable_other_status());
+    }
+  }
+}
+
+void MetricMonitor::UpdateStatus(const double current_time, MetricSlot* slot,
+                                 ComponentStatus* status) {
+  if (slot == nullptr) {
+    // the process either is not running, which ProcessMonitor reports, or
+    // does not publish metrics; stay silent instead of guessing
+    return;
+  }
+  status->clear_status();
+
+  const double heartbeat_age =
+      current_time -
+      static_cast<double>(slot->heartbeat_ns.load(std::memory_order_relaxed)) *
+          1e-9;
+  if (heartbeat_age > FLAGS_metric_heartbeat_fatal_sec) {
+    SummaryMonitor::EscalateStatus(
+        ComponentStatus::FATAL,
+        StrCat("process stalled, last heartbeat ", heartbeat_age,
+               " seconds ago"),
+        status);
+    return;
+  }
+
+  const uint64_t depth = slot->max_queue_depth.exchange(0);
+  if (depth > FLAGS_metric_queue_depth_warn) {
+    SummaryMonitor::EscalateStatus(
+        ComponentStatus::WARN, StrCat("pending queue depth reached ", depth),
+        status);
+    return;
+  }
+
+  SummaryMonitor::EscalateStatus(ComponentStatus::OK, "", status);
+}
+
+MetricSlot* MetricMonitor::FindSlot(const std::string& name) {
+  std::string lower_name = name;
+  std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(),
+                 ::tolower);
+  for (auto& slot : region_->slots) {
+    if (slot.pid.load(std::memory_order_relaxed) == 0) {
+      continue;
+    }
+    std::string process_name(slot.process_name);
+    std::transform(process_name.begin(), process_name.end(),
+                   process_name.begin(), ::tolower);
+    if (process_name.find(lower_name) != std::string::npos) {
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace monitor
+}  // namespace apollo
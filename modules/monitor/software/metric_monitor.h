@@ -0,0 +1,56 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "cyber/common/metric_region.h"
+#include "modules/monitor/common/recurrent_runner.h"
+#include "modules/monitor/proto/system_status.pb.h"
+
+namespace apollo {
+namespace monitor {
+
+/**
+ * @class MetricMonitor
+ *
+ * @brief scans the shared metric region that every cyber process writes
+ * heartbeats, cycle times and queue depths into. The scan is a handful
+ * of atomic loads, so it runs at a much shorter interval than the /proc
+ * based ProcessMonitor and detects a stalled process within a fraction
+ * of a second instead of seconds.
+ */
+class MetricMonitor : public RecurrentRunner {
+ public:
+  MetricMonitor();
+
+  void RunOnce(const double current_time) override;
+
+ private:
+  void UpdateStatus(const double current_time,
+                    apollo::cyber::common::MetricSlot *slot,
+                    ComponentStatus *status);
+
+  // find the slot of the process whose name contains the component name;
+  // returns nullptr when the process has no slot
+  apollo::cyber::common::MetricSlot *FindSlot(const std::string &name);
+
+  apollo::cyber::common::MetricRegion *region_ = nullptr;
+};
+
+}  // namespace monitor
+}  // namespace apollo
@@ -86,6 +86,9 @@ void Blob<Dtype>::Reshape(const std::vector<int>& shape) {
   if (!shape_data_ || shape_data_->size() < shape.size() * sizeof(int)) {
     shape_data_.reset(
         new SyncedMemory(shape.size() * sizeof(int), use_cuda_host_malloc_));
+#ifndef PERCEPTION_CPU_ONLY
+    shape_data_->set_stream(stream_);
+#endif
   }
   int* shape_data = static_cast<int*>(shape_data_->mutable_cpu_data());
   for (int i = 0; i < shape.size(); ++i) {
@@ -101,6 +104,9 @@ void Blob<Dtype>::Reshape(const std::vector<int>& shape) {
     capacity_ = count_;
     data_.reset(
         new SyncedMemory(capacity_ * sizeof(Dtype), use_cuda_host_malloc_));
+#ifndef PERCEPTION_CPU_ONLY
+    data_->set_stream(stream_);
+#endif
   }
 }
 
@@ -144,6 +150,9 @@ void Blob<Dtype>::set_cpu_data(Dtype* data) {
   size_t size = count_ * sizeof(Dtype);
   if (data_->size() != size) {
     data_.reset(new SyncedMemory(size, use_cuda_host_malloc_));
+#ifndef PERCEPTION_CPU_ONLY
+    data_->set_stream(stream_);
+#endif
   }
   data_->set_cpu_data(data);
 }
@@ -161,6 +170,9 @@ void Blob<Dtype>::set_gpu_data(Dtype* data) {
   size_t size = count_ * sizeof(Dtype);
   if (data_->size() != size) {
     data_.reset(new SyncedMemory(size, use_cuda_host_malloc_));
+#ifndef PERCEPTION_CPU_ONLY
+    data_->set_stream(stream_);
+#endif
   }
   data_->set_gpu_data(data);
 }
@@ -289,6 +289,24 @@ class Blob {
   void set_head_cpu() { data_->set_head_cpu(); }
   SyncedMemory::SyncedHead head() const { return data_->head(); }
 
+#ifndef PERCEPTION_CPU_ONLY
+  /**
+   * @brief Plumb the owning pipeline's CUDA stream into the underlying
+   *        SyncedMemory, so head flips issue stream-ordered copies that
+   *        overlap with work on other pipelines' streams. The stream is
+   *        kept across Reshape.
+   */
+  void set_stream(const cudaStream_t& stream) {
+    stream_ = stream;
+    if (data_) {
+      data_->set_stream(stream);
+    }
+    if (shape_data_) {
+      shape_data_->set_stream(stream);
+    }
+  }
+#endif
+
   /**
    * @brief Set the data_ std::shared_ptr to point to the SyncedMemory holding
    * the
@@ -307,6 +325,9 @@ class Blob {
   int count_;
   int capacity_;
   bool use_cuda_host_malloc_;
+#ifndef PERCEPTION_CPU_ONLY
+  cudaStream_t stream_ = nullptr;
+#endif
 };  // class Blob
 
 template <typename Dtype>
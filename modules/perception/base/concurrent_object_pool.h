@@ -15,11 +15,14 @@
  *****************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <deque>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "modules/perception/base/object_pool.h"
@@ -31,13 +34,19 @@ namespace base {
 
 static const size_t kPoolDefaultExtendNum = 10;
 static const size_t kPoolDefaultSize = 100;
+// @brief max number of free objects a thread keeps privately before
+// spilling them back to the shared queue in one locked bulk push
+static const size_t kPoolThreadCacheSize = 64;
 
 // @brief default initializer used in concurrent object pool
 template <class T>
 struct ObjectPoolDefaultInitializer {
   void operator()(T* t) const {}
 };
-// @brief concurrent object pool with dynamic size
+// @brief concurrent object pool with dynamic size. Each thread front-ends
+// the shared locked queue with a small private free list, so the steady
+// per-frame get/release churn stays lock free; the mutex is only taken to
+// refill or spill a whole batch
 template <class ObjectType, size_t N = kPoolDefaultSize,
           class Initializer = ObjectPoolDefaultInitializer<ObjectType>>
 class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
@@ -49,26 +58,47 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
     static ConcurrentObjectPool pool(N);
     return pool;
   }
+  // @brief named instance, one pool per sensor pipeline, so concurrent
+  // pipelines (e.g. lidar and camera frames landing together) do not
+  // contend on one mutex and free list
+  static ConcurrentObjectPool& Instance(const std::string& name) {
+    static std::mutex pool_map_mutex;
+    static std::unordered_map<std::string, ConcurrentObjectPool*> pool_map;
+    std::lock_guard<std::mutex> lock(pool_map_mutex);
+    auto iter = pool_map.find(name);
+    if (iter == pool_map.end()) {
+      iter = pool_map.emplace(name, new ConcurrentObjectPool(N)).first;
+    }
+    return *(iter->second);
+  }
   // @brief overrided function to get object smart pointer
   std::shared_ptr<ObjectType> Get() override {
 // TODO(All): remove conditional build
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     ObjectType* ptr = nullptr;
-    {
+    ThreadLocalCache& cache = LocalCache();
+    if (cache.pool == nullptr) {
+      cache.pool = this;
+    }
+    if (cache.pool == this && !cache.objects.empty()) {
+      ptr = cache.objects.back();
+      cache.objects.pop_back();
+      ++cache_hit_count_;
+    } else {
       std::lock_guard<std::mutex> lock(mutex_);
       if (queue_.empty()) {
         Add(1 + kPoolDefaultExtendNum);
+        ++exhausted_count_;
       }
       ptr = queue_.front();
       queue_.pop();
+      ++cache_miss_count_;
     }
     // For efficiency consideration, intialization should be invoked
     // after releasing the mutex
     kInitializer(ptr);
-    return std::shared_ptr<ObjectType>(ptr, [&](ObjectType* obj_ptr) {
-      std::lock_guard<std::mutex> lock(mutex_);
-      queue_.push(obj_ptr);
-    });
+    return std::shared_ptr<ObjectType>(
+        ptr, [this](ObjectType* obj_ptr) { Release(obj_ptr); });
 #else
     return std::shared_ptr<ObjectType>(new ObjectType);
 #endif
@@ -80,25 +110,13 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
                 std::vector<std::shared_ptr<ObjectType>>* data) override {
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     std::vector<ObjectType*> buffer(num, nullptr);
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      if (queue_.size() < num) {
-        Add(num - queue_.size() + kPoolDefaultExtendNum);
-      }
-      for (size_t i = 0; i < num; ++i) {
-        buffer[i] = queue_.front();
-        queue_.pop();
-      }
-    }
+    BatchAcquire(num, &buffer);
     // For efficiency consideration, intialization should be invoked
     // after releasing the mutex
     for (size_t i = 0; i < num; ++i) {
       kInitializer(buffer[i]);
-      data->emplace_back(
-          std::shared_ptr<ObjectType>(buffer[i], [&](ObjectType* obj_ptr) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            queue_.push(obj_ptr);
-          }));
+      data->emplace_back(std::shared_ptr<ObjectType>(
+          buffer[i], [this](ObjectType* obj_ptr) { Release(obj_ptr); }));
     }
 #else
     for (size_t i = 0; i < num; ++i) {
@@ -114,31 +132,15 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
                 std::list<std::shared_ptr<ObjectType>>* data) override {
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     std::vector<ObjectType*> buffer(num, nullptr);
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      if (queue_.size() < num) {
-        Add(num - queue_.size() + kPoolDefaultExtendNum);
-      }
-      for (size_t i = 0; i < num; ++i) {
-        buffer[i] = queue_.front();
-        queue_.pop();
-      }
-    }
+    BatchAcquire(num, &buffer);
     // For efficiency consideration, intialization should be invoked
     // after releasing the mutex
     for (size_t i = 0; i < num; ++i) {
       kInitializer(buffer[i]);
-      is_front ? data->emplace_front(std::shared_ptr<ObjectType>(
-                     buffer[i],
-                     [&](ObjectType* obj_ptr) {
-                       std::lock_guard<std::mutex> lock(mutex_);
-                       queue_.push(obj_ptr);
-                     }))
-               : data->emplace_back(std::shared_ptr<ObjectType>(
-                     buffer[i], [&](ObjectType* obj_ptr) {
-                       std::lock_guard<std::mutex> lock(mutex_);
-                       queue_.push(obj_ptr);
-                     }));
+      std::shared_ptr<ObjectType> ptr(
+          buffer[i], [this](ObjectType* obj_ptr) { Release(obj_ptr); });
+      is_front ? data->emplace_front(std::move(ptr))
+               : data->emplace_back(std::move(ptr));
     }
 #else
     for (size_t i = 0; i < num; ++i) {
@@ -156,29 +158,13 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
                 std::deque<std::shared_ptr<ObjectType>>* data) override {
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     std::vector<ObjectType*> buffer(num, nullptr);
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      if (queue_.size() < num) {
-        Add(num - queue_.size() + kPoolDefaultExtendNum);
-      }
-      for (size_t i = 0; i < num; ++i) {
-        buffer[i] = queue_.front();
-        queue_.pop();
-      }
-    }
+    BatchAcquire(num, &buffer);
     for (size_t i = 0; i < num; ++i) {
       kInitializer(buffer[i]);
-      is_front ? data->emplace_front(std::shared_ptr<ObjectType>(
-                     buffer[i],
-                     [&](ObjectType* obj_ptr) {
-                       std::lock_guard<std::mutex> lock(mutex_);
-                       queue_.push(obj_ptr);
-                     }))
-               : data->emplace_back(std::shared_ptr<ObjectType>(
-                     buffer[i], [&](ObjectType* obj_ptr) {
-                       std::lock_guard<std::mutex> lock(mutex_);
-                       queue_.push(obj_ptr);
-                     }));
+      std::shared_ptr<ObjectType> ptr(
+          buffer[i], [this](ObjectType* obj_ptr) { Release(obj_ptr); });
+      is_front ? data->emplace_front(std::move(ptr))
+               : data->emplace_back(std::move(ptr));
     }
 #else
     for (size_t i = 0; i < num; ++i) {
@@ -198,6 +184,12 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   }
   // @brief get remained object number
   size_t RemainedNum() override { return queue_.size(); }
+  // @brief pool telemetry: gets served from the thread local cache
+  uint64_t CacheHitCount() const { return cache_hit_count_.load(); }
+  // @brief pool telemetry: gets that had to take the shared queue lock
+  uint64_t CacheMissCount() const { return cache_miss_count_.load(); }
+  // @brief pool telemetry: times the shared queue ran dry and had to grow
+  uint64_t ExhaustedCount() const { return exhausted_count_.load(); }
 #endif
   // @brief destructor to release the cached memory
   ~ConcurrentObjectPool() override {
@@ -212,8 +204,67 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   }
 
  protected:
-// @brief add num objects, should add lock before invoke this function
 #ifndef PERCEPTION_BASE_DISABLE_POOL
+  // @brief per-thread free list; on thread exit the remaining objects are
+  // given back to the owning pool, whose static storage outlives threads
+  struct ThreadLocalCache {
+    ConcurrentObjectPool* pool = nullptr;
+    std::vector<ObjectType*> objects;
+    ~ThreadLocalCache() {
+      if (pool != nullptr && !objects.empty()) {
+        std::lock_guard<std::mutex> lock(pool->mutex_);
+        for (auto* ptr : objects) {
+          pool->queue_.push(ptr);
+        }
+      }
+    }
+  };
+  static ThreadLocalCache& LocalCache() {
+    static thread_local ThreadLocalCache cache;
+    return cache;
+  }
+  // @brief return an object, preferring the thread local cache; the cache
+  // binds to the first pool of this type used on the thread, objects of
+  // other same-typed pools go straight back to their shared queue
+  void Release(ObjectType* ptr) {
+    ThreadLocalCache& cache = LocalCache();
+    if (cache.pool == this && cache.objects.size() < kPoolThreadCacheSize) {
+      cache.objects.push_back(ptr);
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(ptr);
+  }
+  // @brief acquire num raw objects, draining the thread local cache first
+  // and topping up from the shared queue under a single lock
+  void BatchAcquire(size_t num, std::vector<ObjectType*>* buffer) {
+    size_t acquired = 0;
+    ThreadLocalCache& cache = LocalCache();
+    if (cache.pool == nullptr) {
+      cache.pool = this;
+    }
+    if (cache.pool == this) {
+      while (acquired < num && !cache.objects.empty()) {
+        (*buffer)[acquired++] = cache.objects.back();
+        cache.objects.pop_back();
+      }
+      cache_hit_count_ += acquired;
+    }
+    if (acquired < num) {
+      const size_t remain = num - acquired;
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (queue_.size() < remain) {
+        Add(remain - queue_.size() + kPoolDefaultExtendNum);
+        ++exhausted_count_;
+      }
+      for (; acquired < num; ++acquired) {
+        (*buffer)[acquired] = queue_.front();
+        queue_.pop();
+      }
+      cache_miss_count_ += remain;
+    }
+  }
+  // @brief add num objects, should add lock before invoke this function
   void Add(size_t num) {
     for (size_t i = 0; i < num; ++i) {
       ObjectType* ptr = new ObjectType;
@@ -241,6 +292,10 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   const size_t kDefaultCacheSize;
   // @brief list to store extended memory, not as efficient
   std::list<ObjectType*> extended_cache_;
+  // @brief telemetry counters, only updated when pooling is enabled
+  std::atomic<uint64_t> cache_hit_count_{0};
+  std::atomic<uint64_t> cache_miss_count_{0};
+  std::atomic<uint64_t> exhausted_count_{0};
   static const Initializer kInitializer;
 };
 
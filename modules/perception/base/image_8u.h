@@ -39,10 +39,19 @@ const std::map<Color, int> kChannelsMap{
  * @brief A wrapper around Blob holders serving as the basic
  *        computational unit for images.
  *
+ * Freshly allocated images pad each row to kRowAlignmentPixels pixels so
+ * every row starts on a 64-byte boundary, which matches GPU texture pitch
+ * requirements. Consumers must therefore address rows through width_step()
+ * or the row pointer accessors instead of assuming packed pixel data.
+ *
  * TODO(dox): more thorough description.
  */
 class Image8U {
  public:
+  // rows of allocated images are padded to this pixel count, so the byte
+  // stride is a multiple of 64 for any channel number in kChannelsMap
+  static constexpr int kRowAlignmentPixels = 64;
+
   Image8U()
       : rows_(0),
         cols_(0),
@@ -66,7 +75,9 @@ class Image8U {
   Image8U(int rows, int cols, Color type)
       : rows_(rows), cols_(cols), type_(type), offset_(0) {
     channels_ = kChannelsMap.at(type);
-    blob_.reset(new Blob<uint8_t>({rows_, cols_, channels_}));
+    const int aligned_cols = (cols_ + kRowAlignmentPixels - 1) /
+                             kRowAlignmentPixels * kRowAlignmentPixels;
+    blob_.reset(new Blob<uint8_t>({rows_, aligned_cols, channels_}));
     width_step_ = blob_->offset({1, 0, 0}) * static_cast<int>(sizeof(uint8_t));
   }
 
@@ -123,7 +134,15 @@ class Image8U {
   int width_step() const { return width_step_; }
   // @brief: returns the total number of pixels.
   int total() const { return rows_ * cols_ * channels_; }
+  // @brief: true when rows are tightly packed with no alignment padding,
+  //         i.e. the pixel data can be traversed as one contiguous block.
+  bool contiguous() const {
+    return width_step_ ==
+           cols_ * channels_ * static_cast<int>(sizeof(uint8_t));
+  }
 
+  // @brief: returns a zero-copy view onto the given region; the view shares
+  //         this image's blob and keeps its width_step, so no pixels move.
   Image8U operator()(const Rect<int> &roi) {
     int offset = offset_ + blob_->offset({roi.y, roi.x, 0});
     // return Image8U(roi.height, roi.width, type_, blob_, offset);
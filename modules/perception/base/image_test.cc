@@ -47,6 +47,7 @@ TEST(ImageTest, image8u_test) {
       EXPECT_EQ(image.channels(), 3);
       EXPECT_EQ(image.width_step(), 15);
       EXPECT_EQ(image.total(), 75);
+      EXPECT_TRUE(image.contiguous());
       EXPECT_EQ(image.type(), Color::RGB);
 
       Rect<int> roi(0, 1, 2, 3);
@@ -73,6 +74,10 @@ TEST(ImageTest, image8u_test) {
   {
     Image8U image(5, 5, Color::RGB);
     EXPECT_EQ(image.blob().use_count(), 2);
+    // allocated images pad rows so every row starts 64-byte aligned
+    EXPECT_EQ(image.width_step() % 64, 0);
+    EXPECT_FALSE(image.contiguous());
+    EXPECT_EQ(image.total(), 75);
 
     auto blob = image.blob();
     EXPECT_EQ(blob.use_count(), 2);
@@ -93,10 +98,13 @@ TEST(ImageTest, image8u_test) {
     Rect<int> roi(0, 1, 2, 3);
     Image8U image_roi = image(roi);
     EXPECT_EQ(blob.use_count(), 3);
-    EXPECT_EQ(image_roi.cpu_ptr(0)[0], 15);
-    EXPECT_EQ(image_roi.cpu_ptr(0)[1], 16);
-    EXPECT_EQ(image_roi.cpu_ptr(1)[0], 30);
-    EXPECT_EQ(image_roi.cpu_ptr(1)[1], 31);
+    // the view keeps the parent's (padded) width_step
+    const int ws = image.width_step();
+    EXPECT_EQ(image_roi.width_step(), ws);
+    EXPECT_EQ(image_roi.cpu_ptr(0)[0], static_cast<uint8_t>(ws));
+    EXPECT_EQ(image_roi.cpu_ptr(0)[1], static_cast<uint8_t>(ws + 1));
+    EXPECT_EQ(image_roi.cpu_ptr(1)[0], static_cast<uint8_t>(2 * ws));
+    EXPECT_EQ(image_roi.cpu_ptr(1)[1], static_cast<uint8_t>(2 * ws + 1));
 
     auto ref_blob = image.blob();
     EXPECT_EQ(blob.use_count(), 4);
@@ -34,6 +34,16 @@ TEST(ObjectPoolTest, basic_test) {
 #endif
 }
 
+TEST(ObjectPoolTest, named_instance_test) {
+  // one pool per pipeline name, stable across lookups and distinct from the
+  // anonymous global instance
+  EXPECT_EQ(&ObjectPool::Instance("lidar"), &ObjectPool::Instance("lidar"));
+  EXPECT_NE(&ObjectPool::Instance("lidar"), &ObjectPool::Instance("camera"));
+  EXPECT_NE(&ObjectPool::Instance("lidar"), &ObjectPool::Instance());
+  std::shared_ptr<Object> obj = ObjectPool::Instance("lidar").Get();
+  EXPECT_NE(obj, nullptr);
+}
+
 TEST(ObjectPoolTest, dummy_object_pool_test) {
   typedef DummyObjectPool<Object> TestObjectPool;
   std::shared_ptr<Object> obj = TestObjectPool::Instance().Get();
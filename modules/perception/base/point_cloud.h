@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -29,6 +30,48 @@ namespace apollo {
 namespace perception {
 namespace base {
 
+// @brief apply an affine transform to the xyz channels of packed point
+// arrays in batch. The x/y/z members of a point struct are contiguous, so a
+// point array maps onto an Eigen matrix with an outer stride and the
+// transform runs as vectorized matrix products instead of per-point loops.
+// Input and output may be the same array for an in-place transform; each
+// batch is read into a scratch buffer before its output columns are written.
+template <typename PointInT, typename PointOutT>
+inline void TransformPointArray(const PointInT* points_in, size_t size,
+                                const Eigen::Affine3d& pose,
+                                PointOutT* points_out) {
+  using InType = typename PointInT::Type;
+  using OutType = typename PointOutT::Type;
+  static constexpr int kInStride =
+      static_cast<int>(sizeof(PointInT) / sizeof(InType));
+  static constexpr int kOutStride =
+      static_cast<int>(sizeof(PointOutT) / sizeof(OutType));
+  static constexpr int kBatchSize = 1024;
+  if (size == 0) {
+    return;
+  }
+  Eigen::Map<const Eigen::Matrix<InType, 3, Eigen::Dynamic>, Eigen::Unaligned,
+             Eigen::OuterStride<kInStride>>
+      map_in(&points_in->x, 3, size);
+  Eigen::Map<Eigen::Matrix<OutType, 3, Eigen::Dynamic>, Eigen::Unaligned,
+             Eigen::OuterStride<kOutStride>>
+      map_out(&points_out->x, 3, size);
+  Eigen::Matrix<double, 3, Eigen::Dynamic, Eigen::ColMajor, 3, kBatchSize>
+      source(3, kBatchSize);
+  Eigen::Matrix<double, 3, Eigen::Dynamic, Eigen::ColMajor, 3, kBatchSize>
+      target(3, kBatchSize);
+  for (size_t offset = 0; offset < size; offset += kBatchSize) {
+    const int num =
+        static_cast<int>(std::min<size_t>(kBatchSize, size - offset));
+    source.leftCols(num) =
+        map_in.middleCols(offset, num).template cast<double>();
+    target.leftCols(num).noalias() = pose.linear() * source.leftCols(num);
+    target.leftCols(num).colwise() += pose.translation();
+    map_out.middleCols(offset, num) =
+        target.leftCols(num).template cast<OutType>();
+  }
+}
+
 template <class PointT>
 class PointCloud {
  public:
@@ -173,31 +216,43 @@ class PointCloud {
   }
   // @brief rotate the point cloud and set rotation part of pose to identity
   void RotatePointCloud(bool check_nan = false) {
-    Eigen::Vector3d point3d;
-    Eigen::Matrix3d rotation = sensor_to_world_pose_.linear();
-    for (auto& point : points_) {
-      if (!check_nan || (!std::isnan(point.x) && !std::isnan(point.y) &&
-                         !std::isnan(point.z))) {
-        point3d << point.x, point.y, point.z;
-        point3d = rotation * point3d;
-        point.x = static_cast<typename PointT::Type>(point3d(0));
-        point.y = static_cast<typename PointT::Type>(point3d(1));
-        point.z = static_cast<typename PointT::Type>(point3d(2));
+    if (!check_nan) {
+      Eigen::Affine3d rotation = Eigen::Affine3d::Identity();
+      rotation.linear() = sensor_to_world_pose_.linear();
+      TransformPointArray(points_.data(), points_.size(), rotation,
+                          points_.data());
+    } else {
+      Eigen::Vector3d point3d;
+      Eigen::Matrix3d rotation = sensor_to_world_pose_.linear();
+      for (auto& point : points_) {
+        if (!std::isnan(point.x) && !std::isnan(point.y) &&
+            !std::isnan(point.z)) {
+          point3d << point.x, point.y, point.z;
+          point3d = rotation * point3d;
+          point.x = static_cast<typename PointT::Type>(point3d(0));
+          point.y = static_cast<typename PointT::Type>(point3d(1));
+          point.z = static_cast<typename PointT::Type>(point3d(2));
+        }
       }
     }
     sensor_to_world_pose_.linear().setIdentity();
   }
   // @brief transform the point cloud, set the pose to identity
   void TransformPointCloud(bool check_nan = false) {
-    Eigen::Vector3d point3d;
-    for (auto& point : points_) {
-      if (!check_nan || (!std::isnan(point.x) && !std::isnan(point.y) &&
-                         !std::isnan(point.z))) {
-        point3d << point.x, point.y, point.z;
-        point3d = sensor_to_world_pose_ * point3d;
-        point.x = static_cast<typename PointT::Type>(point3d(0));
-        point.y = static_cast<typename PointT::Type>(point3d(1));
-        point.z = static_cast<typename PointT::Type>(point3d(2));
+    if (!check_nan) {
+      TransformPointArray(points_.data(), points_.size(),
+                          sensor_to_world_pose_, points_.data());
+    } else {
+      Eigen::Vector3d point3d;
+      for (auto& point : points_) {
+        if (!std::isnan(point.x) && !std::isnan(point.y) &&
+            !std::isnan(point.z)) {
+          point3d << point.x, point.y, point.z;
+          point3d = sensor_to_world_pose_ * point3d;
+          point.x = static_cast<typename PointT::Type>(point3d(0));
+          point.y = static_cast<typename PointT::Type>(point3d(1));
+          point.z = static_cast<typename PointT::Type>(point3d(2));
+        }
       }
     }
     sensor_to_world_pose_.setIdentity();
@@ -379,6 +379,40 @@ TEST(PointCloudTest, transform_test) {
   EXPECT_EQ(cloud.sensor_to_world_pose().matrix().determinant(), 1.0);
 }
 
+TEST(PointCloudTest, transform_point_array_test) {
+  Eigen::Affine3d affine = Eigen::Affine3d::Identity();
+  affine.rotate(Eigen::AngleAxisd(M_PI / 3, Eigen::Vector3d(0, 0, 1)));
+  affine.translate(Eigen::Vector3d(10, -5, 2));
+  // more points than one internal batch, to cover the partial tail batch
+  const size_t size = 2000;
+  std::vector<PointF> points(size);
+  for (size_t i = 0; i < size; ++i) {
+    points[i].x = static_cast<float>(i) * 0.1f;
+    points[i].y = static_cast<float>(i) * -0.2f;
+    points[i].z = static_cast<float>(i % 32);
+    points[i].intensity = static_cast<float>(i);
+  }
+  // cross-type batch transform against the per-point reference
+  std::vector<PointD> world_points(size);
+  TransformPointArray(points.data(), size, affine, world_points.data());
+  for (size_t i = 0; i < size; ++i) {
+    Eigen::Vector3d point3d(points[i].x, points[i].y, points[i].z);
+    point3d = affine * point3d;
+    EXPECT_NEAR(world_points[i].x, point3d(0), 1e-6);
+    EXPECT_NEAR(world_points[i].y, point3d(1), 1e-6);
+    EXPECT_NEAR(world_points[i].z, point3d(2), 1e-6);
+    EXPECT_EQ(world_points[i].intensity, 0.0);
+  }
+  // in-place transform leaves the interleaved intensity channel untouched
+  TransformPointArray(points.data(), size, affine, points.data());
+  for (size_t i = 0; i < size; ++i) {
+    EXPECT_NEAR(points[i].x, world_points[i].x, 1e-3);
+    EXPECT_NEAR(points[i].y, world_points[i].y, 1e-3);
+    EXPECT_NEAR(points[i].z, world_points[i].z, 1e-3);
+    EXPECT_EQ(points[i].intensity, static_cast<float>(i));
+  }
+}
+
 template <typename PointT>
 void CloudCheck(const std::shared_ptr<const PointCloud<PointT>> cloud) {
   for (const auto& point : cloud->points()) {
@@ -62,6 +62,8 @@ license and copyright terms herein.
  *****************************************************************************/
 #include "modules/perception/base/syncedmem.h"
 
+#include "modules/perception/base/syncedmem_pool.h"
+
 namespace apollo {
 namespace perception {
 namespace base {
@@ -101,12 +103,12 @@ SyncedMemory::SyncedMemory(size_t size, bool use_cuda)
 SyncedMemory::~SyncedMemory() {
   check_device();
   if (cpu_ptr_ && own_cpu_data_) {
-    PerceptionFreeHost(cpu_ptr_, cpu_malloc_use_cuda_);
+    SyncedMemoryPool::Instance()->ReleaseHost(cpu_ptr_, cpu_malloc_use_cuda_);
   }
 
 #ifndef PERCEPTION_CPU_ONLY
   if (gpu_ptr_ && own_gpu_data_) {
-    BASE_CUDA_CHECK(cudaFree(gpu_ptr_));
+    SyncedMemoryPool::Instance()->ReleaseDevice(gpu_ptr_);
   }
 #endif  // PERCEPTION_CPU_ONLY
 }
@@ -115,7 +117,8 @@ inline void SyncedMemory::to_cpu() {
   check_device();
   switch (head_) {
     case UNINITIALIZED:
-      PerceptionMallocHost(&cpu_ptr_, size_, cpu_malloc_use_cuda_);
+      cpu_ptr_ = SyncedMemoryPool::Instance()->AllocHost(size_,
+                                                         cpu_malloc_use_cuda_);
       if (cpu_ptr_ == nullptr) {
         AERROR << "cpu_ptr_ is null";
         return;
@@ -127,10 +130,20 @@ inline void SyncedMemory::to_cpu() {
     case HEAD_AT_GPU:
 #ifndef PERCEPTION_CPU_ONLY
       if (cpu_ptr_ == nullptr) {
-        PerceptionMallocHost(&cpu_ptr_, size_, cpu_malloc_use_cuda_);
+        cpu_ptr_ = SyncedMemoryPool::Instance()->AllocHost(
+            size_, cpu_malloc_use_cuda_);
         own_cpu_data_ = true;
       }
-      BASE_CUDA_CHECK(cudaMemcpy(cpu_ptr_, gpu_ptr_, size_, cudaMemcpyDefault));
+      if (stream_ != nullptr) {
+        // Stream-ordered copy: only the owning pipeline's stream is
+        // drained before the host reads, not the whole device.
+        BASE_CUDA_CHECK(cudaMemcpyAsync(cpu_ptr_, gpu_ptr_, size_,
+                                        cudaMemcpyDeviceToHost, stream_));
+        BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
+      } else {
+        BASE_CUDA_CHECK(
+            cudaMemcpy(cpu_ptr_, gpu_ptr_, size_, cudaMemcpyDefault));
+      }
       head_ = SYNCED;
 #else
       NO_GPU;
@@ -147,17 +160,30 @@ inline void SyncedMemory::to_gpu() {
 #ifndef PERCEPTION_CPU_ONLY
   switch (head_) {
     case UNINITIALIZED:
-      BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
-      BASE_CUDA_CHECK(cudaMemset(gpu_ptr_, 0, size_));
+      gpu_ptr_ = SyncedMemoryPool::Instance()->AllocDevice(size_);
+      if (stream_ != nullptr) {
+        BASE_CUDA_CHECK(cudaMemsetAsync(gpu_ptr_, 0, size_, stream_));
+      } else {
+        BASE_CUDA_CHECK(cudaMemset(gpu_ptr_, 0, size_));
+      }
       head_ = HEAD_AT_GPU;
       own_gpu_data_ = true;
       break;
     case HEAD_AT_CPU:
       if (gpu_ptr_ == nullptr) {
-        BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
+        gpu_ptr_ = SyncedMemoryPool::Instance()->AllocDevice(size_);
         own_gpu_data_ = true;
       }
-      BASE_CUDA_CHECK(cudaMemcpy(gpu_ptr_, cpu_ptr_, size_, cudaMemcpyDefault));
+      if (stream_ != nullptr) {
+        // Stream-ordered copy: consumers on the same pipeline stream are
+        // ordered behind it, so no synchronization is needed and the
+        // transfer overlaps with other pipelines' kernels.
+        BASE_CUDA_CHECK(cudaMemcpyAsync(gpu_ptr_, cpu_ptr_, size_,
+                                        cudaMemcpyHostToDevice, stream_));
+      } else {
+        BASE_CUDA_CHECK(
+            cudaMemcpy(gpu_ptr_, cpu_ptr_, size_, cudaMemcpyDefault));
+      }
       head_ = SYNCED;
       break;
     case HEAD_AT_GPU:
@@ -179,7 +205,7 @@ void SyncedMemory::set_cpu_data(void* data) {
   check_device();
   CHECK(data);
   if (own_cpu_data_) {
-    PerceptionFreeHost(cpu_ptr_, cpu_malloc_use_cuda_);
+    SyncedMemoryPool::Instance()->ReleaseHost(cpu_ptr_, cpu_malloc_use_cuda_);
   }
   cpu_ptr_ = data;
   head_ = HEAD_AT_CPU;
@@ -202,7 +228,7 @@ void SyncedMemory::set_gpu_data(void* data) {
 #ifndef PERCEPTION_CPU_ONLY
   CHECK(data);
   if (own_gpu_data_) {
-    BASE_CUDA_CHECK(cudaFree(gpu_ptr_));
+    SyncedMemoryPool::Instance()->ReleaseDevice(gpu_ptr_);
   }
   gpu_ptr_ = data;
   head_ = HEAD_AT_GPU;
@@ -236,7 +262,7 @@ void SyncedMemory::async_gpu_push(const cudaStream_t& stream) {
   check_device();
   CHECK_EQ(head_, HEAD_AT_CPU);
   if (gpu_ptr_ == nullptr) {
-    BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
+    gpu_ptr_ = SyncedMemoryPool::Instance()->AllocDevice(size_);
     own_gpu_data_ = true;
   }
   const cudaMemcpyKind put = cudaMemcpyHostToDevice;
@@ -62,6 +62,8 @@ license and copyright terms herein.
  *****************************************************************************/
 #pragma once
 
+#include <cstdlib>
+
 #include "cyber/common/log.h"
 #include "modules/perception/base/common.h"
 
@@ -76,8 +78,10 @@ inline void PerceptionMallocHost(void** ptr, size_t size, bool use_cuda) {
     return;
   }
 #endif
-  *ptr = malloc(size);
-  CHECK(*ptr) << "host allocation of size " << size << " failed";
+  // 64-byte alignment matches Image8U row pitch and cache line size, so
+  // vectorized loads never straddle an allocation boundary
+  CHECK_EQ(posix_memalign(ptr, 64, size), 0)
+      << "host allocation of size " << size << " failed";
 }
 
 inline void PerceptionFreeHost(void* ptr, bool use_cuda) {
@@ -121,6 +125,17 @@ class SyncedMemory {
 
 #ifndef PERCEPTION_CPU_ONLY
   void async_gpu_push(const cudaStream_t& stream);
+
+  /**
+   * @brief Attach the owning pipeline's CUDA stream. Head flips then issue
+   *        stream-ordered async copies: host-to-device copies are ordered
+   *        behind work on this stream without a synchronization, and
+   *        device-to-host copies drain this stream alone instead of the
+   *        whole device, so transfers overlap with other pipelines'
+   *        kernels.
+   */
+  void set_stream(const cudaStream_t& stream) { stream_ = stream; }
+  const cudaStream_t& stream() const { return stream_; }
 #endif
 
  private:
@@ -137,6 +152,9 @@ class SyncedMemory {
   bool cpu_malloc_use_cuda_;
   bool own_gpu_data_;
   int device_;
+#ifndef PERCEPTION_CPU_ONLY
+  cudaStream_t stream_ = nullptr;
+#endif
 };  // class SyncedMemory
 
 }  // namespace base
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/syncedmem_pool.h"
+
+#include "cyber/common/log.h"
+#include "modules/perception/base/syncedmem.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+SyncedMemoryPool::SyncedMemoryPool() {}
+
+size_t SyncedMemoryPool::BucketSize(const size_t size) {
+  size_t bucket = 64;
+  while (bucket < size) {
+    bucket <<= 1;
+  }
+  return bucket;
+}
+
+void* SyncedMemoryPool::AllocHost(const size_t size, const bool use_cuda) {
+  if (!use_cuda) {
+    void* ptr = malloc(size);
+    CHECK(ptr) << "host allocation of size " << size << " failed";
+    return ptr;
+  }
+  const size_t bucket = BucketSize(size);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& free_blocks = free_host_blocks_[bucket];
+    if (!free_blocks.empty()) {
+      void* ptr = free_blocks.back();
+      free_blocks.pop_back();
+      return ptr;
+    }
+  }
+  void* ptr = nullptr;
+  PerceptionMallocHost(&ptr, bucket, true);
+  std::lock_guard<std::mutex> lock(mutex_);
+  host_block_buckets_[ptr] = bucket;
+  return ptr;
+}
+
+void SyncedMemoryPool::ReleaseHost(void* ptr, const bool use_cuda) {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (!use_cuda) {
+    free(ptr);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = host_block_buckets_.find(ptr);
+  if (it == host_block_buckets_.end()) {
+    AERROR << "Releasing a pinned host block unknown to the pool";
+    PerceptionFreeHost(ptr, true);
+    return;
+  }
+  free_host_blocks_[it->second].push_back(ptr);
+}
+
+#ifndef PERCEPTION_CPU_ONLY
+
+void* SyncedMemoryPool::AllocDevice(const size_t size) {
+  const size_t bucket = BucketSize(size);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& free_blocks = free_device_blocks_[bucket];
+    if (!free_blocks.empty()) {
+      void* ptr = free_blocks.back();
+      free_blocks.pop_back();
+      return ptr;
+    }
+  }
+  void* ptr = nullptr;
+  BASE_CUDA_CHECK(cudaMalloc(&ptr, bucket));
+  std::lock_guard<std::mutex> lock(mutex_);
+  device_block_buckets_[ptr] = bucket;
+  return ptr;
+}
+
+void SyncedMemoryPool::ReleaseDevice(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = device_block_buckets_.find(ptr);
+  if (it == device_block_buckets_.end()) {
+    AERROR << "Releasing a device block unknown to the pool";
+    BASE_CUDA_CHECK(cudaFree(ptr));
+    return;
+  }
+  free_device_blocks_[it->second].push_back(ptr);
+}
+
+#endif  // PERCEPTION_CPU_ONLY
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/common/macros.h"
+#include "modules/perception/base/common.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+/**
+ * @brief Process-wide pool of pinned host blocks and device memory blocks.
+ *
+ * The camera and lidar pipelines churn through the same bounded set of blob
+ * sizes on every frame. Pooling the cudaMallocHost/cudaMalloc blocks removes
+ * the per-blob allocation cost as well as the device-wide synchronization
+ * that freeing CUDA memory implies in the middle of a frame. Block sizes are
+ * rounded up to the next power of two so that requests of nearby sizes share
+ * one free list.
+ *
+ * Pageable host memory does not benefit from pooling and is forwarded to
+ * plain malloc/free.
+ */
+class SyncedMemoryPool {
+ public:
+  /**
+   * @brief Allocate a host block of at least the given size; pinned when
+   *        use_cuda is set, in which case the block comes from the pool
+   * @return the allocated block; never null
+   */
+  void* AllocHost(const size_t size, const bool use_cuda);
+
+  /**
+   * @brief Return a block obtained from AllocHost; pinned blocks go back to
+   *        the pool for reuse
+   */
+  void ReleaseHost(void* ptr, const bool use_cuda);
+
+#ifndef PERCEPTION_CPU_ONLY
+  /**
+   * @brief Allocate a device block of at least the given size from the pool
+   * @return the allocated block; never null
+   */
+  void* AllocDevice(const size_t size);
+
+  /**
+   * @brief Return a block obtained from AllocDevice to the pool for reuse
+   */
+  void ReleaseDevice(void* ptr);
+#endif
+
+ private:
+  /**
+   * @brief Round a block size up to its free-list bucket: the next power of
+   *        two, with a floor of one cache line
+   */
+  static size_t BucketSize(const size_t size);
+
+  std::mutex mutex_;
+  // bucket size -> free blocks of that size
+  std::unordered_map<size_t, std::vector<void*>> free_host_blocks_;
+  std::unordered_map<size_t, std::vector<void*>> free_device_blocks_;
+  // live block -> its bucket size, to route releases back to the free list
+  std::unordered_map<void*, size_t> host_block_buckets_;
+  std::unordered_map<void*, size_t> device_block_buckets_;
+
+  DECLARE_SINGLETON(SyncedMemoryPool)
+};  // class SyncedMemoryPool
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,58 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/syncedmem_pool.h"
+
+#include <gtest/gtest.h>
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+class SyncedMemoryPoolTest : public ::testing::Test {};
+
+TEST_F(SyncedMemoryPoolTest, TestPageableHost) {
+  void* ptr = SyncedMemoryPool::Instance()->AllocHost(100, false);
+  EXPECT_TRUE(ptr);
+  SyncedMemoryPool::Instance()->ReleaseHost(ptr, false);
+}
+
+TEST_F(SyncedMemoryPoolTest, TestPinnedHostReuse) {
+  void* ptr = SyncedMemoryPool::Instance()->AllocHost(100, true);
+  EXPECT_TRUE(ptr);
+  SyncedMemoryPool::Instance()->ReleaseHost(ptr, true);
+  // A released block is handed out again for a request of a nearby size
+  // that falls into the same bucket.
+  void* reused_ptr = SyncedMemoryPool::Instance()->AllocHost(120, true);
+  EXPECT_EQ(ptr, reused_ptr);
+  SyncedMemoryPool::Instance()->ReleaseHost(reused_ptr, true);
+}
+
+#ifndef PERCEPTION_CPU_ONLY  // GPU test
+
+TEST_F(SyncedMemoryPoolTest, TestDeviceReuse) {
+  void* ptr = SyncedMemoryPool::Instance()->AllocDevice(1000);
+  EXPECT_TRUE(ptr);
+  SyncedMemoryPool::Instance()->ReleaseDevice(ptr);
+  void* reused_ptr = SyncedMemoryPool::Instance()->AllocDevice(1024);
+  EXPECT_EQ(ptr, reused_ptr);
+  SyncedMemoryPool::Instance()->ReleaseDevice(reused_ptr);
+}
+
+#endif
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
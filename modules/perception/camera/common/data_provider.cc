@@ -46,6 +46,10 @@ bool DataProvider::Init(const DataProvider::InitOptions &options) {
   rgb_->gpu_data();
   bgr_->gpu_data();
 
+  // staging buffer for raw YUV input, sized for the largest case (yuyv)
+  yuv_.Reshape({1, src_height_ * src_width_ * 2});
+  yuv_.gpu_data();
+
   if (options.do_undistortion) {
     handler_.reset(new UndistortionHandler());
     if (!handler_->Init(options.sensor_name, device_id_)) {
@@ -127,58 +131,94 @@ bool DataProvider::FillImageData(int rows, int cols, const uint8_t *data,
     AERROR << "Undistortion DONOT support CPU mode!";
     return false;
   }
+  // source rows are packed while image rows are stride-aligned, so copy
+  // row by row through the row pointer accessors
+  auto fill_cpu = [rows, cols](const uint8_t *src, base::Image8U *dst) {
+    const int src_step = cols * dst->channels();
+    for (int i = 0; i < rows; ++i) {
+      memcpy(dst->mutable_cpu_ptr(i), src + i * src_step,
+             src_step * sizeof(src[0]));
+    }
+  };
   if (encoding == "rgb8") {
-    memcpy(rgb_->mutable_cpu_data(), data, rgb_->count() * sizeof(data[0]));
+    fill_cpu(data, rgb_.get());
     rgb_ready_ = true;
     success = true;
   } else if (encoding == "bgr8") {
-    memcpy(bgr_->mutable_cpu_data(), data, bgr_->count() * sizeof(data[0]));
+    fill_cpu(data, bgr_.get());
     bgr_ready_ = true;
     success = true;
   } else if (encoding == "gray" || encoding == "y") {
-    memcpy(gray_->mutable_cpu_data(), data, gray_->count() * sizeof(data[0]));
+    fill_cpu(data, gray_.get());
     gray_ready_ = true;
     success = true;
+  } else if (encoding == "yuyv" || encoding == "nv12") {
+    success = false;
+    AERROR << "Raw YUV input requires GPU mode: " << encoding;
   } else {
     success = false;
     AERROR << "Unrecognized image encoding: " << encoding;
   }
 #else  // copy to device memory directly
   AINFO << "Fill in GPU mode ...";
+  // pitched copy: source rows are packed, image rows are stride-aligned
+  auto fill_gpu = [rows, cols](const uint8_t *src, base::Image8U *dst) {
+    const int src_step = cols * dst->channels();
+    cudaMemcpy2D(dst->mutable_gpu_data(), dst->width_step(), src, src_step,
+                 src_step, rows, cudaMemcpyDefault);
+  };
   if (encoding == "rgb8") {
     if (handler_ != nullptr) {
-      cudaMemcpy(ori_rgb_->mutable_gpu_data(), data,
-                 ori_rgb_->rows() * ori_rgb_->width_step(), cudaMemcpyDefault);
+      fill_gpu(data, ori_rgb_.get());
       success = handler_->Handle(*ori_rgb_, rgb_.get());
     } else {
-      cudaMemcpy(rgb_->mutable_gpu_data(), data,
-                 rgb_->rows() * rgb_->width_step(), cudaMemcpyDefault);
+      fill_gpu(data, rgb_.get());
       success = true;
     }
     rgb_ready_ = true;
   } else if (encoding == "bgr8") {
     if (handler_ != nullptr) {
-      cudaMemcpy(ori_bgr_->mutable_gpu_data(), data,
-                 ori_bgr_->rows() * ori_bgr_->width_step(), cudaMemcpyDefault);
+      fill_gpu(data, ori_bgr_.get());
       success = handler_->Handle(*ori_bgr_, bgr_.get());
     } else {
-      cudaMemcpy(bgr_->mutable_gpu_data(), data,
-                 bgr_->rows() * bgr_->width_step(), cudaMemcpyDefault);
+      fill_gpu(data, bgr_.get());
       success = true;
     }
     bgr_ready_ = true;
   } else if (encoding == "gray" || encoding == "y") {
     if (handler_ != nullptr) {
-      cudaMemcpy(ori_gray_->mutable_gpu_data(), data,
-                 ori_gray_->rows() * ori_gray_->width_step(),
-                 cudaMemcpyDefault);
+      fill_gpu(data, ori_gray_.get());
       success = handler_->Handle(*ori_gray_, gray_.get());
     } else {
-      cudaMemcpy(gray_->mutable_gpu_data(), data,
-                 gray_->rows() * gray_->width_step(), cudaMemcpyDefault);
+      fill_gpu(data, gray_.get());
       success = true;
     }
     gray_ready_ = true;
+  } else if (encoding == "yuyv" || encoding == "nv12") {
+    // raw frame straight from the driver: upload the packed/planar YUV
+    // (half the bytes of rgb8) and do the color conversion on GPU, so the
+    // driver never touches the pixels on CPU
+    const int yuv_size =
+        (encoding == "nv12") ? rows * cols * 3 / 2 : rows * cols * 2;
+    yuv_.Reshape({1, yuv_size});
+    cudaMemcpy(yuv_.mutable_gpu_data(), data, yuv_size, cudaMemcpyDefault);
+    base::Image8U *rgb = (handler_ != nullptr) ? ori_rgb_.get() : rgb_.get();
+    NppiSize roi;
+    roi.height = rows;
+    roi.width = cols;
+    if (encoding == "nv12") {
+      const uint8_t *src_planes[2] = {yuv_.gpu_data(),
+                                      yuv_.gpu_data() + rows * cols};
+      nppiNV12ToRGB_8u_P2C3R(src_planes, cols, rgb->mutable_gpu_data(),
+                             rgb->width_step(), roi);
+    } else {
+      nppiYCbCr422ToRGB_8u_C2C3R(yuv_.gpu_data(), cols * 2,
+                                 rgb->mutable_gpu_data(), rgb->width_step(),
+                                 roi);
+    }
+    success =
+        (handler_ != nullptr) ? handler_->Handle(*ori_rgb_, rgb_.get()) : true;
+    rgb_ready_ = true;
   } else {
     success = false;
     AERROR << "Unrecognized image encoding: " << encoding;
@@ -93,7 +93,7 @@ bool ExternalFeatureExtractor::Extract(const FeatureExtractorOptions &options,
   image_options.do_crop = true;
   // Timer timer;
   frame->data_provider->GetImage(image_options, image_.get());
-  inference::ResizeGPU(*image_, input_blob, raw_width, 0);
+  inference::ResizeGPU(*image_, input_blob, 0);
   inference_->Infer();
   FeatureExtractorOptions feat_options;
   feat_options.normalized = false;
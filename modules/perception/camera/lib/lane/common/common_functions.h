@@ -63,17 +63,20 @@ bool PolyFit(const std::vector<Eigen::Matrix<Dtype, 2, 1>>& pos_vec,
     return false;
   }
 
-  // create data matrix
+  // create data matrix; the Vandermonde columns are built with vectorized
+  // cumulative products instead of per-element std::pow
   Eigen::Matrix<Dtype, Eigen::Dynamic, Eigen::Dynamic> A(n, order + 1);
+  Eigen::Matrix<Dtype, Eigen::Dynamic, 1> x(n);
   Eigen::Matrix<Dtype, Eigen::Dynamic, 1> y(n);
   Eigen::Matrix<Dtype, Eigen::Dynamic, 1> result;
   for (int i = 0; i < n; ++i) {
-    for (int j = 0; j <= order; ++j) {
-      A(i, j) = static_cast<Dtype>(
-          std::pow(is_x_axis ? pos_vec[i].x() : pos_vec[i].y(), j));
-    }
+    x(i) = is_x_axis ? pos_vec[i].x() : pos_vec[i].y();
     y(i) = is_x_axis ? pos_vec[i].y() : pos_vec[i].x();
   }
+  A.col(0).setOnes();
+  for (int j = 1; j <= order; ++j) {
+    A.col(j) = A.col(j - 1).cwiseProduct(x);
+  }
 
   // solve linear least squares
   result = A.householderQr().solve(y);
@@ -130,6 +133,17 @@ bool RansacFitting(std::vector<Eigen::Matrix<Dtype, 2, 1>>* pos_vec,
   Dtype min_residual = FLT_MAX;
   Dtype early_stop_ratio = 0.95f;
   Dtype good_lane_ratio = 0.666f;
+
+  // evaluate every candidate model against all points with vectorized
+  // expressions over these stacked coordinate arrays
+  Eigen::Array<Dtype, Eigen::Dynamic, 1> xs(n);
+  Eigen::Array<Dtype, Eigen::Dynamic, 1> ys(n);
+  for (int i = 0; i < n; ++i) {
+    xs(i) = (*pos_vec)[i](0);
+    ys(i) = (*pos_vec)[i](1);
+  }
+  const Eigen::Array<Dtype, Eigen::Dynamic, 1> xs2 = xs * xs;
+
   for (int j = 0; j < max_iters; ++j) {
     index[0] = std::rand() % q2;
     index[1] = q2 + std::rand() % q1;
@@ -148,15 +162,11 @@ bool RansacFitting(std::vector<Eigen::Matrix<Dtype, 2, 1>>* pos_vec,
         (*pos_vec)[index[2]](1);
     Eigen::Matrix<Dtype, 3, 1> c = matA.colPivHouseholderQr().solve(matB);
 
-    int num_inliers = 0;
-    Dtype residual = 0;
-    Dtype y = 0;
-    for (int i = 0; i < n; ++i) {
-      y = (*pos_vec)[i](0) * (*pos_vec)[i](0) * c(0) + (*pos_vec)[i](0) * c(1) +
-          c(2);
-      if (std::abs(y - (*pos_vec)[i](1)) <= inlier_thres) ++num_inliers;
-      residual += std::abs(y - (*pos_vec)[i](1));
-    }
+    const Eigen::Array<Dtype, Eigen::Dynamic, 1> residuals =
+        (xs2 * c(0) + xs * c(1) + c(2) - ys).abs();
+    const int num_inliers =
+        static_cast<int>((residuals <= inlier_thres).count());
+    const Dtype residual = residuals.sum();
 
     if (num_inliers > max_inliers ||
         (num_inliers == max_inliers && residual < min_residual)) {
@@ -180,9 +180,9 @@ bool DenselineLaneDetector::Detect(const LaneDetectorOptions &options,
   ADEBUG << "input_blob: " << input_blob->shape_string();
 
   inference::ResizeGPU(
-      image_src_, input_blob, static_cast<int>(crop_width_), 0,
-      static_cast<float>(image_mean_[0]), static_cast<float>(image_mean_[1]),
-      static_cast<float>(image_mean_[2]), false, static_cast<float>(1.0));
+      image_src_, input_blob, 0, static_cast<float>(image_mean_[0]),
+      static_cast<float>(image_mean_[1]), static_cast<float>(image_mean_[2]),
+      false, static_cast<float>(1.0));
   AINFO << "resize gpu finish.";
   cudaDeviceSynchronize();
   rt_net_->Infer();
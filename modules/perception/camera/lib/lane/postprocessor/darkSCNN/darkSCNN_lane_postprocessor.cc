@@ -222,8 +222,35 @@ bool DarkSCNNLanePostprocessor::Process2D(
   std::vector<Eigen::Matrix<float, 4, 1>> img_coeffs;
   coeffs.resize(lane_type_num_);
   img_coeffs.resize(lane_type_num_);
+  if (prev_frame_coeffs_.size() != static_cast<size_t>(lane_type_num_)) {
+    prev_frame_coeffs_.resize(lane_type_num_);
+    prev_frame_coeff_valid_.assign(lane_type_num_, false);
+  }
+  // lateral gate around the previous frame's fit; loose enough to absorb
+  // one frame of ego motion, tight enough to drop gross mis-associations
+  constexpr float kPrevFitFilterThresh = 1.0f;
   for (int i = 1; i < lane_type_num_; ++i) {
     if (xy_points[i].size() < minNumPoints_) continue;
+    // Use the previous frame's fit to discard points that clearly belong to
+    // another lane before ransac sees them; keep the raw set when the filter
+    // would eat too much, e.g. after a lane change.
+    if (prev_frame_coeff_valid_[i]) {
+      const auto& prev_coeff = prev_frame_coeffs_[i];
+      std::vector<Eigen::Matrix<float, 2, 1>> filtered_points;
+      filtered_points.reserve(xy_points[i].size());
+      for (const auto& point : xy_points[i]) {
+        const float y_pred =
+            GetPolyValue(prev_coeff(3), prev_coeff(2), prev_coeff(1),
+                         prev_coeff(0), point(0));
+        if (std::fabs(y_pred - point(1)) <= kPrevFitFilterThresh) {
+          filtered_points.push_back(point);
+        }
+      }
+      if (filtered_points.size() >= minNumPoints_ &&
+          filtered_points.size() * 2 >= xy_points[i].size()) {
+        xy_points[i].swap(filtered_points);
+      }
+    }
     Eigen::Matrix<float, 4, 1> coeff;
     // Solve linear system to estimate polynomial coefficients
     if (RansacFitting(&xy_points[i], &coeff, 200,
@@ -234,6 +261,12 @@ bool DarkSCNNLanePostprocessor::Process2D(
       xy_points[i].clear();
     }
   }
+  for (int i = 1; i < lane_type_num_; ++i) {
+    prev_frame_coeff_valid_[i] = xy_points[i].size() >= minNumPoints_;
+    if (prev_frame_coeff_valid_[i]) {
+      prev_frame_coeffs_[i] = coeffs[i];
+    }
+  }
 
   auto elapsed_2 = std::chrono::high_resolution_clock::now() - start;
   int64_t microseconds_2 =
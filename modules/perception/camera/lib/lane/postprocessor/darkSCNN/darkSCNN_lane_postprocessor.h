@@ -101,6 +101,10 @@ class DarkSCNNLanePostprocessor : public BaseLanePostprocessor {
   // xy points for the ground plane, uv points for image plane
   std::vector<std::vector<Eigen::Matrix<float, 2, 1>>> xy_points;
   std::vector<std::vector<Eigen::Matrix<float, 2, 1>>> uv_points;
+  // previous frame's ground-plane fits per lane type, used to discard gross
+  // outliers before the ransac re-fit of the current frame
+  std::vector<Eigen::Matrix<float, 4, 1>> prev_frame_coeffs_;
+  std::vector<bool> prev_frame_coeff_valid_;
 };
 
 }  // namespace camera
@@ -280,8 +280,7 @@ bool YoloObstacleDetector::Detect(const ObstacleDetectorOptions &options,
   image_options.do_crop = true;
   frame->data_provider->GetImage(image_options, image_.get());
   AINFO << "GetImageBlob: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
-  inference::ResizeGPU(*image_, input_blob, frame->data_provider->src_width(),
-                       0);
+  inference::ResizeGPU(*image_, input_blob, 0);
   AINFO << "Resize: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
 
   /////////////////////////// detection part ///////////////////////////
@@ -164,18 +164,48 @@ bool TrafficLightDetection::Inference(
   resize_scale_list_.clear();
   int img_width = data_provider->src_width();
   int img_height = data_provider->src_height();
-  int resize_index = 0;
   auto batch_num = lights->size();
   auto input_img_blob = rt_net_->get_blob(net_inputs_[0]);
   auto input_param = rt_net_->get_blob(net_inputs_[1]);
 
-  input_img_blob->Reshape(static_cast<int>(batch_num),
+  // Compute the crop boxes first and deduplicate identical ones: lights at
+  // the same intersection often share one crop (always the case with
+  // CropBoxWholeImage), and one inference row serves all of them because the
+  // detections are matched back to the lights globally.
+  for (size_t i = 0; i < batch_num; ++i) {
+    base::TrafficLightPtr light = lights->at(i);
+    base::RectI cbox;
+    crop_->getCropBox(img_width, img_height, light, &cbox);
+    AINFO << "get crop box success " << cbox.x << " " << cbox.y << " "
+          << cbox.width << " " << cbox.height;
+
+    if (!OutOfValidRegion(cbox, img_width, img_height) && cbox.Area() > 0) {
+      light->region.debug_roi[0] = cbox;
+      light->region.crop_roi = cbox;
+
+      if (std::find(crop_box_list_.begin(), crop_box_list_.end(), cbox) ==
+          crop_box_list_.end()) {
+        crop_box_list_.push_back(cbox);
+        resize_scale_list_.push_back(
+            static_cast<float>(detection_param_.min_crop_size()) /
+            static_cast<float>(std::min(cbox.width, cbox.height)));
+      }
+    }
+  }
+
+  if (crop_box_list_.empty()) {
+    AINFO << "no valid crop box, skip inference";
+    return true;
+  }
+  const int crop_num = static_cast<int>(crop_box_list_.size());
+
+  input_img_blob->Reshape(crop_num,
                           static_cast<int>(detection_param_.min_crop_size()),
                           static_cast<int>(detection_param_.min_crop_size()),
                           3);
-  param_blob_->Reshape(static_cast<int>(batch_num), 6, 1, 1);
+  param_blob_->Reshape(crop_num, 6, 1, 1);
   float *param_data = param_blob_->mutable_cpu_data();
-  for (size_t i = 0; i < batch_num; ++i) {
+  for (int i = 0; i < crop_num; ++i) {
     auto offset = i * param_blob_length_;
     param_data[offset + 0] =
         static_cast<float>(detection_param_.min_crop_size());
@@ -189,33 +219,16 @@ bool TrafficLightDetection::Inference(
 
   AINFO << "reshape inputblob " << input_img_blob->shape_string();
 
-  for (size_t i = 0; i < batch_num; ++i) {
-    base::TrafficLightPtr light = lights->at(i);
-    base::RectI cbox;
-    crop_->getCropBox(img_width, img_height, light, &cbox);
-    AINFO << "get crop box success " << cbox.x << " " << cbox.y << " "
-          << cbox.width << " " << cbox.height;
-
-    if (!OutOfValidRegion(cbox, img_width, img_height) && cbox.Area() > 0) {
-      crop_box_list_.push_back(cbox);
-      light->region.debug_roi[0] = cbox;
-      light->region.crop_roi = cbox;
-
-      data_provider_image_option_.do_crop = true;
-      data_provider_image_option_.crop_roi = cbox;
-      data_provider_image_option_.target_color = base::Color::BGR;
-      data_provider->GetImage(data_provider_image_option_, image_.get());
-      AINFO << "get image data success ";
-
-      float resize_scale =
-          static_cast<float>(detection_param_.min_crop_size()) /
-          static_cast<float>(std::min(cbox.width, cbox.height));
-      resize_scale_list_.push_back(resize_scale);
+  for (int i = 0; i < crop_num; ++i) {
+    const base::RectI &cbox = crop_box_list_[i];
+    data_provider_image_option_.do_crop = true;
+    data_provider_image_option_.crop_roi = cbox;
+    data_provider_image_option_.target_color = base::Color::BGR;
+    data_provider->GetImage(data_provider_image_option_, image_.get());
+    AINFO << "get image data success ";
 
-      inference::ResizeGPU(*image_, input_img_blob, img_width, resize_index,
-                           mean_[0], mean_[1], mean_[2], true, 1.0);
-      resize_index++;
-    }
+    inference::ResizeGPU(*image_, input_img_blob, i, mean_[0], mean_[1],
+                         mean_[2], true, 1.0);
   }
   // _detection
   cudaDeviceSynchronize();
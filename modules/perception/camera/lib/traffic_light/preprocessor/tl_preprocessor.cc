@@ -15,6 +15,9 @@
  *****************************************************************************/
 #include "modules/perception/camera/lib/traffic_light/preprocessor/tl_preprocessor.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "modules/perception/camera/common/util.h"
@@ -25,6 +28,28 @@ namespace apollo {
 namespace perception {
 namespace camera {
 
+namespace {
+
+// A cached projection stays valid while the camera pose moved less than
+// these bounds; beyond them the projected ROI may shift by several pixels.
+constexpr double kMaxCachedPoseTranslation = 0.05;  // meters
+constexpr double kMaxCachedPoseRotation = 1e-3;     // radians
+
+bool IsPoseClose(const Eigen::Matrix4d &cached_pose,
+                 const Eigen::Matrix4d &pose) {
+  if ((cached_pose.topRightCorner<3, 1>() - pose.topRightCorner<3, 1>())
+          .norm() > kMaxCachedPoseTranslation) {
+    return false;
+  }
+  const Eigen::Matrix3d rotation_delta = cached_pose.topLeftCorner<3, 3>() *
+                                         pose.topLeftCorner<3, 3>().transpose();
+  const double cos_angle = (rotation_delta.trace() - 1.0) * 0.5;
+  return std::acos(std::min(1.0, std::max(-1.0, cos_angle))) <
+         kMaxCachedPoseRotation;
+}
+
+}  // namespace
+
 bool TLPreprocessor::Init(const TrafficLightPreprocessorInitOptions &options) {
   camera::MultiCamerasInitOption projection_init_option;
   projection_init_option.camera_names = options.camera_names;
@@ -262,9 +287,29 @@ bool TLPreprocessor::ProjectLights(
     return true;
   }
 
+  Eigen::Matrix4d c2w_pose;
+  const bool has_camera_pose = pose.GetCameraPose(camera_name, &c2w_pose);
+  auto &camera_cache = projection_cache_[camera_name];
+
   for (size_t i = 0; i < lights->size(); ++i) {
     base::TrafficLightPtr light_proj(new base::TrafficLight);
     auto light = lights->at(i);
+
+    const auto cached = camera_cache.find(light->id);
+    if (has_camera_pose && cached != camera_cache.end() &&
+        IsPoseClose(cached->second.c2w_pose, c2w_pose)) {
+      // the camera barely moved since this signal was projected; reuse it
+      light->region.projection_roi = cached->second.projection_roi;
+      light->region.outside_image = cached->second.outside_image;
+      *light_proj = *light;
+      if (light->region.outside_image) {
+        lights_outside_image->push_back(light_proj);
+      } else {
+        lights_on_image->push_back(light_proj);
+      }
+      continue;
+    }
+
     if (!projection_.Project(pose, ProjectOption(camera_name), light.get())) {
       light->region.outside_image = true;
       *light_proj = *light;
@@ -274,6 +319,12 @@ bool TLPreprocessor::ProjectLights(
       *light_proj = *light;
       lights_on_image->push_back(light_proj);
     }
+    if (has_camera_pose) {
+      auto &entry = camera_cache[light->id];
+      entry.c2w_pose = c2w_pose;
+      entry.projection_roi = light->region.projection_roi;
+      entry.outside_image = light->region.outside_image;
+    }
   }
   return true;
 }
@@ -90,6 +90,16 @@ class TLPreprocessor {
   std::string GetMinFocalLenWorkingCameraName() const;
   std::string GetMaxFocalLenWorkingCameraName() const;
 
+  // Projection of one signal cached together with the camera pose it was
+  // computed with. While the pose stays within a small translation/rotation
+  // window the ROI is reused, so a vehicle waiting at an intersection does
+  // not re-project every signal on every camera each frame.
+  struct CachedProjection {
+    Eigen::Matrix4d c2w_pose;
+    base::RectI projection_roi;
+    bool outside_image = false;
+  };
+
  private:
   MultiCamerasProjection projection_;
   double last_pub_img_ts_ = 0.0;
@@ -104,6 +114,9 @@ class TLPreprocessor {
   base::TrafficLightPtrs lights_on_image_;
   base::TrafficLightPtrs lights_outside_image_;
   bool projections_outside_all_images_ = false;
+  // camera_name -> signal id -> cached projection
+  std::map<std::string, std::map<std::string, CachedProjection>>
+      projection_cache_;
 };
 
 }  // namespace camera
@@ -146,6 +146,29 @@ TEST(DataProvider, test_fill_image_data) {
         data_provider.FillImageData(gray.rows, gray.cols, gray.data, "none"));
   }
 
+  // test fill with raw yuv frames, as published by the camera driver
+  {
+    std::vector<uint8_t> yuyv(bgr.rows * bgr.cols * 2);
+    for (size_t i = 0; i < yuyv.size(); i += 2) {
+      yuyv[i] = gray.data[i / 2];
+      yuyv[i + 1] = 128;
+    }
+    std::vector<uint8_t> nv12(bgr.rows * bgr.cols * 3 / 2, 128);
+    memcpy(nv12.data(), gray.data, bgr.rows * bgr.cols);
+
+    DataProvider data_provider;
+    EXPECT_TRUE(data_provider.Init(init_options));
+    EXPECT_TRUE(
+        data_provider.FillImageData(bgr.rows, bgr.cols, yuyv.data(), "yuyv"));
+    base::Image8U image;
+    DataProvider::ImageOptions image_options;
+    image_options.target_color = base::Color::RGB;
+    EXPECT_TRUE(data_provider.GetImage(image_options, &image));
+    EXPECT_TRUE(
+        data_provider.FillImageData(bgr.rows, bgr.cols, nv12.data(), "nv12"));
+    EXPECT_TRUE(data_provider.GetImage(image_options, &image));
+  }
+
   // test fill with undistortion
   init_options.do_undistortion = true;
   init_options.sensor_name = "onsemi_obstacle";
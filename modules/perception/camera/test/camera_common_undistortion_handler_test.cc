@@ -48,7 +48,7 @@ TEST(UndistortionHandlerTest, test_init) {
 
     for (int y = 0; y < cv_img.rows; ++y) {
       memcpy(image.mutable_cpu_ptr(y), cv_img.ptr<uint8_t>(y),
-             image.width_step());
+             image.cols() * image.channels());
     }
     UndistortionHandler handler;
 
@@ -90,12 +90,13 @@ TEST(UndistortionHandlerTest, test_undistortion) {
     base::Image8U gray_undistorted(cv_bgr.rows, cv_bgr.cols, base::Color::GRAY);
 
     for (int y = 0; y < cv_bgr.rows; ++y) {
-      memcpy(bgr.mutable_cpu_ptr(y), cv_bgr.ptr<uint8_t>(y), bgr.width_step());
+      memcpy(bgr.mutable_cpu_ptr(y), cv_bgr.ptr<uint8_t>(y),
+             bgr.cols() * bgr.channels());
     }
 
     for (int y = 0; y < cv_gray.rows; ++y) {
       memcpy(gray.mutable_cpu_ptr(y), cv_gray.ptr<uint8_t>(y),
-             gray.width_step());
+             gray.cols() * gray.channels());
     }
 
     UndistortionHandler handler;
@@ -186,7 +187,7 @@ TEST(UndistortionHandlerTest, test_verify) {
 
     for (int y = 0; y < cv_img.rows; ++y) {
       memcpy(image.mutable_cpu_ptr(y), cv_img.ptr<uint8_t>(y),
-             image.width_step());
+             image.cols() * image.channels());
     }
     UndistortionHandler handler;
     lib::Timer timer;
@@ -35,12 +35,6 @@ TEST(YoloCameraDetectorTest, demo_test) {
       "camera/lib/obstacle/detector/yolo/img/test.jpg");
   CHECK(!cv_img.empty()) << "image is empty.";
 
-  base::Image8U image(cv_img.rows, cv_img.cols, base::Color::BGR);
-
-  for (int y = 0; y < cv_img.rows; ++y) {
-    memcpy(image.mutable_cpu_ptr(y), cv_img.ptr<uint8_t>(y),
-           image.width_step());
-  }
   CameraFrame frame;
   DataProvider data_provider;
   frame.data_provider = &data_provider;
@@ -54,8 +48,9 @@ TEST(YoloCameraDetectorTest, demo_test) {
   dp_init_options.image_width = cv_img.cols;
   dp_init_options.device_id = 0;
   CHECK(frame.data_provider->Init(dp_init_options));
+  CHECK(cv_img.isContinuous());
   CHECK(frame.data_provider->FillImageData(cv_img.rows, cv_img.cols,
-                                           image.gpu_data(), "bgr8"));
+                                           cv_img.data, "bgr8"));
 
   ObstacleDetectorInitOptions init_options;
   init_options.root_dir =
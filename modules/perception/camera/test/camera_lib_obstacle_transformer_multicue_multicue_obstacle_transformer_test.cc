@@ -39,12 +39,6 @@ TEST(MultiCueObstacleTransformerTest, multicue_obstacle_transformer_test) {
   cv::Mat cv_img = cv::imread(
       "/apollo/modules/perception/testdata/"
       "camera/lib/obstacle/transformer/multicue/test.jpg");
-  base::Image8U image(cv_img.rows, cv_img.cols, base::Color::BGR);
-  for (int y = 0; y < cv_img.rows; ++y) {
-    memcpy(image.mutable_cpu_ptr(y), cv_img.ptr<uint8_t>(y),
-           image.width_step());
-  }
-
   CameraFrame frame;
   DataProvider data_provider;
   frame.data_provider = &data_provider;
@@ -57,7 +51,7 @@ TEST(MultiCueObstacleTransformerTest, multicue_obstacle_transformer_test) {
   dp_init_options.image_width = cv_img.cols;
   dp_init_options.device_id = 0;
   frame.data_provider->Init(dp_init_options);
-  frame.data_provider->FillImageData(cv_img.rows, cv_img.cols, image.gpu_data(),
+  frame.data_provider->FillImageData(cv_img.rows, cv_img.cols, cv_img.data,
                                      "bgr8");
 
   ObstacleDetectorOptions detector_options;
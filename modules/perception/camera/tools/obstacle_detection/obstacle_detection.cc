@@ -221,15 +221,11 @@ int main() {
         continue;
       }
     } else {
-      base::Image8U image(cv_img.rows, cv_img.cols, base::Color::BGR);
-
-      for (int y = 0; y < cv_img.rows; ++y) {
-        memcpy(image.mutable_cpu_ptr(y), cv_img.ptr<uint8_t>(y),
-               image.width_step());
-      }
-
+      // FillImageData expects packed rows; feed the decoded image directly
+      // instead of staging it in a stride-aligned Image8U
+      CHECK(cv_img.isContinuous());
       CHECK(frame.data_provider->FillImageData(cv_img.rows, cv_img.cols,
-                                               image.gpu_data(), "bgr8"));
+                                               cv_img.data, "bgr8"));
 
       EXPECT_TRUE(detector->Detect(options, &frame));
     }
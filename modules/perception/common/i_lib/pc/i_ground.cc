@@ -412,130 +412,94 @@ void PlaneFitGroundDetector::ComputeSignedGroundHeightLine(
     const GroundPlaneLiDAR *cn, const GroundPlaneLiDAR *dn,
     float *height_above_ground, unsigned int r, unsigned int nr_points,
     unsigned int nr_point_elements) {
-  unsigned int i = 0;
   unsigned int c = 0;
-  unsigned int id = 0;
-  int pos = 0;
-  char label = 0;
-  const float *cptr = nullptr;
-  float dist[] = {0, 0, 0, 0, 0};
   const float *plane[] = {nullptr, nullptr, nullptr, nullptr, nullptr};
-  float min_abs_dist = 0.0f;
   unsigned int nm1 = param_.nr_grids_coarse - 1;
   assert(param_.nr_grids_coarse >= 2);
   plane[0] = cn[0].IsValid() ? cn[0].params : nullptr;
   plane[1] = cn[1].IsValid() ? cn[1].params : nullptr;
   plane[2] = up[0].IsValid() ? up[0].params : nullptr;
   plane[3] = dn[0].IsValid() ? dn[0].params : nullptr;
-  std::vector<int>::const_iterator iter = (*vg_coarse_)(r, 0).indices_.cbegin();
-  while (iter < (*vg_coarse_)(r, 0).indices_.cend()) {
-    pos = *iter;
-    assert(pos < static_cast<int>(nr_points));
-    label = labels_[pos];
-    cptr = point_cloud + (nr_point_elements * pos);
-    dist[0] = plane[0] != nullptr
-                  ? IPlaneToPointSignedDistanceWUnitNorm(plane[0], cptr)
-                  : FLT_MAX;
-    min_abs_dist = IAbs(dist[0]);
-    id = 0;
-    // for candidates we take min dist:
-    if (label) {
-      dist[1] = plane[1] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[1], cptr)
-                    : FLT_MAX;
-      dist[2] = plane[2] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[2], cptr)
-                    : FLT_MAX;
-      dist[3] = plane[3] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[3], cptr)
-                    : FLT_MAX;
-      for (i = 1; i < 4; ++i) {
-        if (min_abs_dist > IAbs(dist[i])) {
-          min_abs_dist = IAbs(dist[i]);
-          id = i;
-        }
-      }
-    }
-    height_above_ground[pos] = dist[id];
-    ++iter;
-  }
-
+  ComputeSignedGroundHeightCell(point_cloud, plane, 4,
+                                (*vg_coarse_)(r, 0).indices_,
+                                height_above_ground, nr_point_elements);
   for (c = 1; c < nm1; ++c) {
     plane[0] = cn[c].IsValid() ? cn[c].params : nullptr;
     plane[1] = cn[c - 1].IsValid() ? cn[c - 1].params : nullptr;
     plane[2] = cn[c + 1].IsValid() ? cn[c + 1].params : nullptr;
     plane[3] = up[c].IsValid() ? up[c].params : nullptr;
     plane[4] = dn[c].IsValid() ? dn[c].params : nullptr;
-    iter = (*vg_coarse_)(r, c).indices_.cbegin();
-    while (iter < (*vg_coarse_)(r, c).indices_.cend()) {
-      pos = *iter;
-      assert(pos < static_cast<int>(nr_points));
-      label = labels_[pos];
-      cptr = point_cloud + (nr_point_elements * pos);
-      dist[0] = plane[0] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[0], cptr)
-                    : FLT_MAX;
-      min_abs_dist = IAbs(dist[0]);
-      id = 0;
-      if (label) {
-        dist[1] = plane[1] != nullptr
-                      ? IPlaneToPointSignedDistanceWUnitNorm(plane[1], cptr)
-                      : FLT_MAX;
-        dist[2] = plane[2] != nullptr
-                      ? IPlaneToPointSignedDistanceWUnitNorm(plane[2], cptr)
-                      : FLT_MAX;
-        dist[3] = plane[3] != nullptr
-                      ? IPlaneToPointSignedDistanceWUnitNorm(plane[3], cptr)
-                      : FLT_MAX;
-        dist[4] = plane[4] != nullptr
-                      ? IPlaneToPointSignedDistanceWUnitNorm(plane[4], cptr)
-                      : FLT_MAX;
-        for (i = 1; i < 5; ++i) {
-          if (min_abs_dist > IAbs(dist[i])) {
-            min_abs_dist = IAbs(dist[i]);
-            id = i;
-          }
-        }
-      }
-      height_above_ground[pos] = dist[id];
-      ++iter;
-    }
+    ComputeSignedGroundHeightCell(point_cloud, plane, 5,
+                                  (*vg_coarse_)(r, c).indices_,
+                                  height_above_ground, nr_point_elements);
   }
   plane[0] = cn[nm1].IsValid() ? cn[nm1].params : nullptr;
   plane[1] = cn[nm1 - 1].IsValid() ? cn[nm1 - 1].params : nullptr;
   plane[2] = up[nm1].IsValid() ? up[nm1].params : nullptr;
   plane[3] = dn[nm1].IsValid() ? dn[nm1].params : nullptr;
-  iter = (*vg_coarse_)(r, nm1).indices_.cbegin();
-  while (iter < (*vg_coarse_)(r, nm1).indices_.cend()) {
-    pos = *iter;
-    assert(pos < static_cast<int>(nr_points));
-    label = labels_[pos];
-    cptr = point_cloud + (nr_point_elements * pos);
-    dist[0] = plane[0] != nullptr
-                  ? IPlaneToPointSignedDistanceWUnitNorm(plane[0], cptr)
-                  : FLT_MAX;
-    min_abs_dist = IAbs(dist[0]);
-    id = 0;
-    // for candidates we take min dist:
-    if (label) {
-      dist[1] = plane[1] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[1], cptr)
-                    : FLT_MAX;
-      dist[2] = plane[2] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[2], cptr)
-                    : FLT_MAX;
-      dist[3] = plane[3] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[3], cptr)
-                    : FLT_MAX;
-      for (i = 1; i < 4; ++i) {
-        if (min_abs_dist > IAbs(dist[i])) {
-          min_abs_dist = IAbs(dist[i]);
-          id = i;
+  ComputeSignedGroundHeightCell(point_cloud, plane, 4,
+                                (*vg_coarse_)(r, nm1).indices_,
+                                height_above_ground, nr_point_elements);
+}
+
+void PlaneFitGroundDetector::ComputeSignedGroundHeightCell(
+    const float *point_cloud, const float *const *plane,
+    unsigned int nr_planes, const std::vector<int> &indices,
+    float *height_above_ground, unsigned int nr_point_elements) {
+  unsigned int nr_cell_points = static_cast<unsigned int>(indices.size());
+  unsigned int i = 0;
+  unsigned int j = 0;
+  if (nr_cell_points == 0) {
+    return;
+  }
+  if (cell_x_.size() < nr_cell_points) {
+    cell_x_.resize(nr_cell_points);
+    cell_y_.resize(nr_cell_points);
+    cell_z_.resize(nr_cell_points);
+    for (j = 0; j < 5; ++j) {
+      cell_dist_[j].resize(nr_cell_points);
+    }
+  }
+  //  gather the cell points once, so the distance loops run at unit stride
+  for (i = 0; i < nr_cell_points; ++i) {
+    const float *cptr = point_cloud + (nr_point_elements * indices[i]);
+    cell_x_[i] = cptr[0];
+    cell_y_[i] = cptr[1];
+    cell_z_[i] = cptr[2];
+  }
+  //  one flat pass per neighbor plane, auto-vectorizable
+  for (j = 0; j < nr_planes; ++j) {
+    float *dist = cell_dist_[j].data();
+    if (plane[j] != nullptr) {
+      const float pa = plane[j][0];
+      const float pb = plane[j][1];
+      const float pc = plane[j][2];
+      const float pd = plane[j][3];
+      for (i = 0; i < nr_cell_points; ++i) {
+        dist[i] = pa * cell_x_[i] + pb * cell_y_[i] + pc * cell_z_[i] + pd;
+      }
+    } else {
+      for (i = 0; i < nr_cell_points; ++i) {
+        dist[i] = FLT_MAX;
+      }
+    }
+  }
+  //  non-candidates take the center plane distance, candidates take the
+  //  neighbor plane with minimum absolute distance, as before
+  for (i = 0; i < nr_cell_points; ++i) {
+    int pos = indices[i];
+    float best = cell_dist_[0][i];
+    if (labels_[pos]) {
+      float min_abs_dist = IAbs(best);
+      for (j = 1; j < nr_planes; ++j) {
+        const float abs_dist = IAbs(cell_dist_[j][i]);
+        if (min_abs_dist > abs_dist) {
+          min_abs_dist = abs_dist;
+          best = cell_dist_[j][i];
         }
       }
     }
-    height_above_ground[pos] = dist[id];
-    ++iter;
+    height_above_ground[pos] = best;
   }
 }
 
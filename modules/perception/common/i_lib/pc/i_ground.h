@@ -305,6 +305,15 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
                                      float *height_above_ground, unsigned int r,
                                      unsigned int nr_points,
                                      unsigned int nr_point_elements);
+  //  classify one grid cell against its neighbor planes: the cell points
+  //  are gathered once and each plane distance runs as a flat
+  //  unit-stride loop the compiler can vectorize
+  void ComputeSignedGroundHeightCell(const float *point_cloud,
+                                     const float *const *plane,
+                                     unsigned int nr_planes,
+                                     const std::vector<int> &indices,
+                                     float *height_above_ground,
+                                     unsigned int nr_point_elements);
 
  protected:
   VoxelGridXY<float> *vg_fine_;
@@ -320,6 +329,11 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
   float *pf_threeds_;
   int *sampled_indices_;
   std::pair<int, int> *order_table_;
+  //  reusable per-cell scratch of the vectorized classification pass
+  std::vector<float> cell_x_;
+  std::vector<float> cell_y_;
+  std::vector<float> cell_z_;
+  std::vector<float> cell_dist_[5];
 };
 
 }  // namespace common
@@ -41,7 +41,8 @@ void TransformPoint(const PointT &point_in, const Eigen::Affine3d &pose,
   point_out->z = static_cast<typename PointT::Type>(point3d.z());
 }
 
-// @brief transform a point cloud
+// @brief transform a point cloud, batched through the strided Eigen map of
+// the packed point storage
 // old name: transform_point_cloud
 template <typename PointT>
 void TransformPointCloud(const base::PointCloud<PointT> &cloud_in,
@@ -50,8 +51,9 @@ void TransformPointCloud(const base::PointCloud<PointT> &cloud_in,
   if (cloud_out->size() < cloud_in.size()) {
     cloud_out->resize(cloud_in.size());
   }
-  for (size_t i = 0; i < cloud_in.size(); ++i) {
-    TransformPoint<PointT>(cloud_in.at(i), pose, &(cloud_out->at(i)));
+  if (cloud_in.size() > 0) {
+    base::TransformPointArray(&cloud_in.at(0), cloud_in.size(), pose,
+                              &cloud_out->at(0));
   }
 }
 
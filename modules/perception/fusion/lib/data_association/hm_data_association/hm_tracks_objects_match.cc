@@ -15,7 +15,9 @@
  *****************************************************************************/
 #include "modules/perception/fusion/lib/data_association/hm_data_association/hm_tracks_objects_match.h"
 
+#include <cmath>
 #include <map>
+#include <unordered_map>
 #include <utility>
 
 #include "modules/perception/common/graph/secure_matrix.h"
@@ -304,33 +306,66 @@ void HMTrackersObjectsAssociation::ComputeAssociationDistanceMat(
   // TODO(linjian) ref_point
   Eigen::Vector3d tmp = Eigen::Vector3d::Zero();
   opt.ref_point = &tmp;
-  association_mat->resize(unassigned_tracks.size());
+  // spatial hash over measurement centers with cell size equal to the
+  // center-distance gate: a pair inside the gate always lands in the same
+  // or an adjacent cell, so only locally dense neighborhoods pay for the
+  // expensive distance computation instead of all tracks x measurements
+  const double cell_size = s_association_center_dist_threshold_;
+  auto cell_key = [](int cell_x, int cell_y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cell_x)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(cell_y));
+  };
+  std::unordered_map<uint64_t, std::vector<size_t>> measurement_grid;
+  for (size_t j = 0; j < unassigned_measurements.size(); ++j) {
+    const Eigen::Vector3d& center =
+        sensor_objects[unassigned_measurements[j]]->GetBaseObject()->center;
+    measurement_grid[cell_key(
+                         static_cast<int>(std::floor(center(0) / cell_size)),
+                         static_cast<int>(std::floor(center(1) / cell_size)))]
+        .push_back(j);
+  }
+  // pairs beyond the gate keep the slack default distance
+  association_mat->assign(
+      unassigned_tracks.size(),
+      std::vector<double>(unassigned_measurements.size(),
+                          s_match_distance_thresh_));
   for (size_t i = 0; i < unassigned_tracks.size(); ++i) {
     int fusion_idx = static_cast<int>(unassigned_tracks[i]);
-    (*association_mat)[i].resize(unassigned_measurements.size());
     const TrackPtr& fusion_track = fusion_tracks[fusion_idx];
-    for (size_t j = 0; j < unassigned_measurements.size(); ++j) {
-      int sensor_idx = static_cast<int>(unassigned_measurements[j]);
-      const SensorObjectPtr& sensor_object = sensor_objects[sensor_idx];
-      double distance = s_match_distance_thresh_;
-      double center_dist =
-          (sensor_object->GetBaseObject()->center -
-           fusion_track->GetFusedObject()->GetBaseObject()->center)
-              .norm();
-      if (center_dist < s_association_center_dist_threshold_) {
-        distance =
-            track_object_distance_.Compute(fusion_track, sensor_object, opt);
-      } else {
-        ADEBUG << "center_distance " << center_dist
-               << " exceeds slack threshold "
-               << s_association_center_dist_threshold_
-               << ", track_id: " << fusion_track->GetTrackId()
-               << ", obs_id: " << sensor_object->GetBaseObject()->track_id;
+    const Eigen::Vector3d& track_center =
+        fusion_track->GetFusedObject()->GetBaseObject()->center;
+    const int cell_x =
+        static_cast<int>(std::floor(track_center(0) / cell_size));
+    const int cell_y =
+        static_cast<int>(std::floor(track_center(1) / cell_size));
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        auto iter = measurement_grid.find(cell_key(cell_x + dx, cell_y + dy));
+        if (iter == measurement_grid.end()) {
+          continue;
+        }
+        for (size_t j : iter->second) {
+          int sensor_idx = static_cast<int>(unassigned_measurements[j]);
+          const SensorObjectPtr& sensor_object = sensor_objects[sensor_idx];
+          double distance = s_match_distance_thresh_;
+          double center_dist =
+              (sensor_object->GetBaseObject()->center - track_center).norm();
+          if (center_dist < s_association_center_dist_threshold_) {
+            distance = track_object_distance_.Compute(fusion_track,
+                                                      sensor_object, opt);
+          } else {
+            ADEBUG << "center_distance " << center_dist
+                   << " exceeds slack threshold "
+                   << s_association_center_dist_threshold_
+                   << ", track_id: " << fusion_track->GetTrackId()
+                   << ", obs_id: " << sensor_object->GetBaseObject()->track_id;
+          }
+          (*association_mat)[i][j] = distance;
+          ADEBUG << "track_id: " << fusion_track->GetTrackId()
+                 << ", obs_id: " << sensor_object->GetBaseObject()->track_id
+                 << ", distance: " << distance;
+        }
       }
-      (*association_mat)[i][j] = distance;
-      ADEBUG << "track_id: " << fusion_track->GetTrackId()
-             << ", obs_id: " << sensor_object->GetBaseObject()->track_id
-             << ", distance: " << distance;
     }
   }
 }
@@ -16,6 +16,9 @@
 
 #include "modules/perception/inference/inference_factory.h"
 
+#include <map>
+#include <mutex>
+
 #include "modules/perception/inference/caffe/caffe_net.h"
 #include "modules/perception/inference/tensorrt/rt_net.h"
 
@@ -39,6 +42,24 @@ Inference *CreateInferenceByName(const std::string &name,
   return nullptr;
 }
 
+std::shared_ptr<Inference> GetSharedInferenceByName(
+    const std::string &name, const std::string &proto_file,
+    const std::string &weight_file, const std::vector<std::string> &outputs,
+    const std::vector<std::string> &inputs, const std::string &model_root) {
+  static std::mutex shared_map_mutex;
+  static std::map<std::string, std::weak_ptr<Inference>> shared_map;
+  const std::string key =
+      name + ":" + proto_file + ":" + weight_file + ":" + model_root;
+  std::lock_guard<std::mutex> lock(shared_map_mutex);
+  std::shared_ptr<Inference> instance = shared_map[key].lock();
+  if (instance == nullptr) {
+    instance.reset(CreateInferenceByName(name, proto_file, weight_file,
+                                         outputs, inputs, model_root));
+    shared_map[key] = instance;
+  }
+  return instance;
+}
+
 }  // namespace inference
 }  // namespace perception
 }  // namespace apollo
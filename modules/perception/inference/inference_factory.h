@@ -15,6 +15,7 @@
  *****************************************************************************/
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -31,6 +32,16 @@ Inference *CreateInferenceByName(const std::string &name,
                                  const std::vector<std::string> &inputs,
                                  const std::string &model_root = "");
 
+// @brief get an inference instance shared by all callers with the same
+// type and model files, so detectors running the same model (e.g. several
+// cameras) hold one engine instead of one per camera. Only the first
+// caller should run Init; callers must serialize Infer on the shared
+// instance or batch their inputs into its blobs
+std::shared_ptr<Inference> GetSharedInferenceByName(
+    const std::string &name, const std::string &proto_file,
+    const std::string &weight_file, const std::vector<std::string> &outputs,
+    const std::vector<std::string> &inputs, const std::string &model_root = "");
+
 }  // namespace inference
 }  // namespace perception
 }  // namespace apollo
@@ -17,6 +17,10 @@
 #include "modules/perception/inference/tensorrt/rt_net.h"
 
 #include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iterator>
+#include <sstream>
 #include <utility>
 
 #include "cyber/common/log.h"
@@ -37,6 +41,22 @@ namespace apollo {
 namespace perception {
 namespace inference {
 
+namespace {
+// @brief FNV-1a hash over raw file content, used as engine cache key part
+uint64_t HashFileContent(const std::string &path) {
+  uint64_t hash = 14695981039346656037ULL;
+  std::ifstream fin(path, std::ios::binary);
+  char buffer[4096];
+  while (fin.read(buffer, sizeof(buffer)) || fin.gcount() > 0) {
+    for (std::streamsize i = 0; i < fin.gcount(); ++i) {
+      hash ^= static_cast<uint8_t>(buffer[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+}  // namespace
+
 void RTNet::ConstructMap(const LayerParameter &layer_param,
                          nvinfer1::ILayer *layer, TensorMap *tensor_map,
                          TensorModifyMap *tensor_modify_map) {
@@ -536,6 +556,8 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
+  net_file_ = net_file;
+  model_file_ = model_file;
 }
 RTNet::RTNet(const std::string &net_file, const std::string &model_file,
              const std::vector<std::string> &outputs,
@@ -545,6 +567,8 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
+  net_file_ = net_file;
+  model_file_ = model_file;
   calibrator_ = calibrator;
   is_own_calibrator_ = false;
 }
@@ -556,6 +580,8 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
+  net_file_ = net_file;
+  model_file_ = model_file;
   model_root_ = model_root;
   BatchStream stream;
 
@@ -599,6 +625,9 @@ void RTNet::init_blob(std::vector<std::string> *names) {
     std::shared_ptr<apollo::perception::base::Blob<float>> blob;
     blob.reset(new apollo::perception::base::Blob<float>(shape));
     blob->set_gpu_data(reinterpret_cast<float *>(buffers_[bindingIndex]));
+    // bind the blob to the net stream, so host to device uploads are
+    // issued asynchronously and stay ordered before enqueue
+    blob->set_stream(stream_);
     blobs_.insert(std::make_pair(name, blob));
   }
 }
@@ -610,7 +639,12 @@ bool RTNet::Init(const std::map<std::string, std::vector<int>> &shapes) {
   }
   BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   // stream will only be destoried for gpu_id_ >= 0
-  cudaStreamCreate(&stream_);
+  if (stream_ == 0) {
+    cudaStreamCreate(&stream_);
+    own_stream_ = true;
+  }
+  BASE_CUDA_CHECK(
+      cudaEventCreateWithFlags(&infer_done_event_, cudaEventDisableTiming));
 
   builder_ = nvinfer1::createInferBuilder(rt_gLogger);
   network_ = builder_->createNetwork();
@@ -630,13 +664,92 @@ bool RTNet::Init(const std::map<std::string, std::vector<int>> &shapes) {
 
   builder_->setDebugSync(true);
 
-  nvinfer1::ICudaEngine *engine = builder_->buildCudaEngine(*network_);
+  nvinfer1::ICudaEngine *engine = nullptr;
+  std::string engine_cache_path;
+  if (!engine_cache_dir_.empty()) {
+    // custom plugin layers carry no serialized state, an engine holding
+    // them cannot be restored, so fall back to building from scratch
+    if (!argmax_plugins_.empty() || !softmax_plugins_.empty() ||
+        !slice_plugins_.empty()) {
+      AWARN << "Engine cache disabled: net " << net_file_
+            << " uses custom plugin layers which do not serialize.";
+    } else {
+      engine_cache_path = engine_cache_dir_ + "/" +
+                          engineCacheKey(prop.name, int8_mode) + ".engine";
+      engine = loadCachedEngine(engine_cache_path);
+    }
+  }
+  if (engine == nullptr) {
+    engine = builder_->buildCudaEngine(*network_);
+    if (!engine_cache_path.empty()) {
+      saveCachedEngine(engine, engine_cache_path);
+    }
+  }
   context_ = engine->createExecutionContext();
   buffers_.resize(input_names_.size() + output_names_.size());
   init_blob(&input_names_);
   init_blob(&output_names_);
   return true;
 }
+std::string RTNet::engineCacheKey(const std::string &gpu_name,
+                                  bool int8_mode) {
+  uint64_t model_hash = HashFileContent(net_file_);
+  model_hash ^= HashFileContent(model_file_) + 0x9e3779b97f4a7c15ULL +
+                (model_hash << 6) + (model_hash >> 2);
+  std::string arch = gpu_name;
+  std::replace_if(
+      arch.begin(), arch.end(),
+      [](char c) { return !isalnum(static_cast<unsigned char>(c)); }, '_');
+  std::ostringstream key;
+  key << "v1_" << std::hex << model_hash << std::dec << "_" << arch << "_"
+      << (int8_mode ? "int8" : "fp32") << "_b" << max_batch_size_ << "_trt"
+      << NV_TENSORRT_MAJOR << "." << NV_TENSORRT_MINOR << "."
+      << NV_TENSORRT_PATCH;
+  return key.str();
+}
+
+nvinfer1::ICudaEngine *RTNet::loadCachedEngine(const std::string &path) {
+  std::ifstream fin(path, std::ios::binary);
+  if (!fin.good()) {
+    AINFO << "No serialized engine found at " << path << ", will build.";
+    return nullptr;
+  }
+  std::vector<char> data((std::istreambuf_iterator<char>(fin)),
+                         std::istreambuf_iterator<char>());
+  if (data.empty()) {
+    return nullptr;
+  }
+  if (runtime_ == nullptr) {
+    runtime_ = nvinfer1::createInferRuntime(rt_gLogger);
+  }
+  nvinfer1::ICudaEngine *engine =
+      runtime_->deserializeCudaEngine(data.data(), data.size(), nullptr);
+  if (engine == nullptr) {
+    AWARN << "Failed to deserialize engine " << path << ", will rebuild.";
+  } else {
+    AINFO << "Loaded serialized engine from " << path;
+  }
+  return engine;
+}
+
+void RTNet::saveCachedEngine(nvinfer1::ICudaEngine *engine,
+                             const std::string &path) {
+  nvinfer1::IHostMemory *serialized = engine->serialize();
+  if (serialized == nullptr) {
+    AWARN << "Failed to serialize engine for " << path;
+    return;
+  }
+  std::ofstream fout(path, std::ios::binary);
+  if (fout.good()) {
+    fout.write(reinterpret_cast<const char *>(serialized->data()),
+               serialized->size());
+    AINFO << "Saved serialized engine to " << path;
+  } else {
+    AWARN << "Failed to open engine cache file " << path << " for writing.";
+  }
+  serialized->destroy();
+}
+
 bool RTNet::checkInt8(const std::string &gpu_name,
                       nvinfer1::IInt8Calibrator *calibrator) {
   if (calibrator == nullptr) {
@@ -716,19 +829,40 @@ RTNet::~RTNet() {
     delete calibrator_;
   }
   if (gpu_id_ >= 0) {
-    BASE_CUDA_CHECK(cudaStreamDestroy(stream_));
+    if (own_stream_) {
+      BASE_CUDA_CHECK(cudaStreamDestroy(stream_));
+    }
+    if (infer_done_event_ != nullptr) {
+      BASE_CUDA_CHECK(cudaEventDestroy(infer_done_event_));
+    }
     network_->destroy();
     builder_->destroy();
     context_->destroy();
+    if (runtime_ != nullptr) {
+      runtime_->destroy();
+    }
     for (auto buf : buffers_) {
       cudaFree(buf);
     }
   }
 }
 
+void RTNet::set_stream(const cudaStream_t &stream) {
+  stream_ = stream;
+  own_stream_ = false;
+}
+
 void RTNet::Infer() {
   BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
+  InferAsync();
+  Synchronize();
+}
+
+void RTNet::InferAsync() {
+  BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
+  // input uploads and enqueue below are stream ordered behind any work
+  // still pending on stream_, no host synchronization is needed here
   for (auto name : input_names_) {
     auto blob = get_blob(name);
     if (blob != nullptr) {
@@ -748,8 +882,9 @@ void RTNet::Infer() {
     }
   }
   context_->enqueue(max_batch_size_, &buffers_[0], stream_, nullptr);
-  BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
+  BASE_CUDA_CHECK(cudaEventRecord(infer_done_event_, stream_));
 
+  // no device work, only flip HEAD so the next cpu_data() syncs back
   for (auto name : output_names_) {
     auto blob = get_blob(name);
     if (blob != nullptr) {
@@ -757,6 +892,10 @@ void RTNet::Infer() {
     }
   }
 }
+
+void RTNet::Synchronize() {
+  BASE_CUDA_CHECK(cudaEventSynchronize(infer_done_event_));
+}
 std::shared_ptr<apollo::perception::base::Blob<float>> RTNet::get_blob(
     const std::string &name) {
   auto iter = blobs_.find(name);
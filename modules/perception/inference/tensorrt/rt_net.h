@@ -71,6 +71,34 @@ class RTNet : public Inference {
 
   void Infer() override;
 
+  // @brief enqueue inference on the net stream without blocking the host;
+  // completion is recorded on infer_done_event(), so several nets on
+  // different streams can run concurrently and chain dependencies with
+  // cudaStreamWaitEvent
+  void InferAsync();
+
+  // @brief block until the work of the last InferAsync finished
+  void Synchronize();
+
+  // @brief run on an externally owned stream (e.g. one stream per camera)
+  // instead of creating one; must be called before Init, the stream is not
+  // destroyed with the net
+  void set_stream(const cudaStream_t &stream);
+
+  cudaStream_t stream() const { return stream_; }
+
+  // @brief event recorded on the net stream after each enqueue
+  cudaEvent_t infer_done_event() const { return infer_done_event_; }
+
+  // @brief directory holding serialized engines reused across process
+  // restarts; empty (the default) disables caching and Init always builds
+  // from the caffe net. Cache entries are keyed on model file content, GPU
+  // name, precision, batch size and TensorRT version, so a stale or
+  // foreign entry is never loaded; must be called before Init
+  void set_engine_cache_dir(const std::string &dir) {
+    engine_cache_dir_ = dir;
+  }
+
   std::shared_ptr<apollo::perception::base::Blob<float>> get_blob(
       const std::string &name) override;
 
@@ -174,9 +202,18 @@ class RTNet : public Inference {
   bool loadWeights(const std::string &model_file, WeightMap *weight_map);
   void init_blob(std::vector<std::string> *names);
 
+  // @brief cache file base name encoding everything a serialized engine
+  // depends on
+  std::string engineCacheKey(const std::string &gpu_name, bool int8_mode);
+  nvinfer1::ICudaEngine *loadCachedEngine(const std::string &path);
+  void saveCachedEngine(nvinfer1::ICudaEngine *engine,
+                        const std::string &path);
+
  private:
   nvinfer1::IExecutionContext *context_ = nullptr;
   cudaStream_t stream_ = 0;
+  bool own_stream_ = true;
+  cudaEvent_t infer_done_event_ = nullptr;
   std::vector<std::shared_ptr<ArgMax1Plugin>> argmax_plugins_;
   std::vector<std::shared_ptr<SoftmaxPlugin>> softmax_plugins_;
   std::vector<std::shared_ptr<SLICEPlugin>> slice_plugins_;
@@ -191,6 +228,10 @@ class RTNet : public Inference {
   nvinfer1::Int8EntropyCalibrator *calibrator_ = nullptr;
   bool is_own_calibrator_ = true;
   std::string model_root_;
+  std::string net_file_;
+  std::string model_file_;
+  std::string engine_cache_dir_;
+  nvinfer1::IRuntime *runtime_ = nullptr;
   nvinfer1::IBuilder *builder_ = nullptr;
   nvinfer1::INetworkDefinition *network_ = nullptr;
   std::vector<std::shared_ptr<float>> weights_mem_;
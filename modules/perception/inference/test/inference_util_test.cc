@@ -154,7 +154,7 @@ TEST(UtilTest, test_resize_gpu) {
                               img.channels()};
     std::shared_ptr<apollo::perception::base::Blob<float>> dst_blob(
         new apollo::perception::base::Blob<float>(shape));
-    EXPECT_TRUE(inference::ResizeGPU(src_image, dst_blob, width, 0));
+    EXPECT_TRUE(inference::ResizeGPU(src_image, dst_blob, 0));
     EXPECT_EQ(dst_blob->shape(0), 1);
     EXPECT_EQ(dst_blob->shape(1), src_image.rows() * 0.5);
     EXPECT_EQ(dst_blob->shape(2), src_image.cols() * 0.5);
@@ -165,7 +165,7 @@ TEST(UtilTest, test_resize_gpu) {
     std::vector<int> shape = {1, img.rows * 0.5, img.cols * 0.5, 0};
     std::shared_ptr<apollo::perception::base::Blob<float>> dst_blob(
         new apollo::perception::base::Blob<float>(shape));
-    EXPECT_FALSE(inference::ResizeGPU(src_image, dst_blob, width, 0));
+    EXPECT_FALSE(inference::ResizeGPU(src_image, dst_blob, 0));
   }
 
   {
@@ -174,7 +174,7 @@ TEST(UtilTest, test_resize_gpu) {
     std::shared_ptr<apollo::perception::base::Blob<float>> dst_blob(
         new apollo::perception::base::Blob<float>(shape));
     int mean_bgr[3] = {128, 128, 128};
-    EXPECT_TRUE(inference::ResizeGPU(src_image, dst_blob, width, 0, mean_bgr[0],
+    EXPECT_TRUE(inference::ResizeGPU(src_image, dst_blob, 0, mean_bgr[0],
                                      mean_bgr[1], mean_bgr[2], true, 1.0));
     EXPECT_EQ(dst_blob->shape(0), 1);
     EXPECT_EQ(dst_blob->shape(1), src_image.rows() * 0.5);
@@ -188,7 +188,7 @@ TEST(UtilTest, test_resize_gpu) {
     std::shared_ptr<apollo::perception::base::Blob<float>> dst_blob(
         new apollo::perception::base::Blob<float>(shape));
     int mean_bgr[3] = {128, 128, 128};
-    EXPECT_TRUE(inference::ResizeGPU(src_image, dst_blob, width, 0, mean_bgr[0],
+    EXPECT_TRUE(inference::ResizeGPU(src_image, dst_blob, 0, mean_bgr[0],
                                      mean_bgr[1], mean_bgr[2], false, 1.0));
     EXPECT_EQ(dst_blob->shape(0), 1);
     EXPECT_EQ(dst_blob->shape(1), src_image.channels());
@@ -201,9 +201,8 @@ TEST(UtilTest, test_resize_gpu) {
     std::shared_ptr<apollo::perception::base::Blob<float>> dst_blob(
         new apollo::perception::base::Blob<float>(shape));
     int mean_bgr[3] = {128, 128, 128};
-    EXPECT_FALSE(inference::ResizeGPU(src_image, dst_blob, width, 0,
-                                      mean_bgr[0], mean_bgr[1], mean_bgr[2],
-                                      true, 1.0));
+    EXPECT_FALSE(inference::ResizeGPU(src_image, dst_blob, 0, mean_bgr[0],
+                                      mean_bgr[1], mean_bgr[2], true, 1.0));
   }
 
   {
@@ -160,7 +160,6 @@ __global__ void resize_linear_kernel_mean(const unsigned char *src,
 
 bool ResizeGPU(const base::Image8U &src,
                std::shared_ptr<apollo::perception::base::Blob<float> > dst,
-               int stepwidth,
                int start_axis) {
   int width = dst->shape(2);
   int height = dst->shape(1);
@@ -168,6 +167,9 @@ bool ResizeGPU(const base::Image8U &src,
   int origin_channel = src.channels();
   int origin_height = src.rows();
   int origin_width = src.cols();
+  // row stride of the underlying blob in pixels; an ROI view keeps its
+  // parent's width_step, so this stays valid for zero-copy crops
+  int stepwidth = src.width_step() / origin_channel;
 
   if (origin_channel != dst->shape(3)) {
     AERROR << "channel should be the same after resize.";
@@ -234,7 +236,6 @@ bool ResizeGPU(const apollo::perception::base::Blob<uint8_t> &src_gpu,
 
 bool ResizeGPU(const base::Image8U &src,
                std::shared_ptr<apollo::perception::base::Blob<float> > dst,
-               int stepwidth,
                int start_axis,
                float mean_b,
                float mean_g,
@@ -247,6 +248,7 @@ bool ResizeGPU(const base::Image8U &src,
   int origin_channel = src.channels();
   int origin_height = src.rows();
   int origin_width = src.cols();
+  int stepwidth = src.width_step() / origin_channel;
 
   if (!channel_axis) {
     // channel_axis: false
@@ -25,9 +25,11 @@ namespace apollo {
 namespace perception {
 namespace inference {
 
+// the Image8U overloads read the row stride from the image itself, so both
+// stride-aligned images and zero-copy ROI views resize correctly
 bool ResizeGPU(const base::Image8U &src,
                std::shared_ptr<apollo::perception::base::Blob<float>> dst,
-               int stepwidth, int start_axis);
+               int start_axis);
 
 bool ResizeGPU(const apollo::perception::base::Blob<uint8_t> &src_gpu,
                std::shared_ptr<apollo::perception::base::Blob<float>> dst,
@@ -36,8 +38,8 @@ bool ResizeGPU(const apollo::perception::base::Blob<uint8_t> &src_gpu,
 
 bool ResizeGPU(const base::Image8U &src,
                std::shared_ptr<apollo::perception::base::Blob<float>> dst,
-               int stepwidth, int start_axis, float mean_b, float mean_g,
-               float mean_r, bool channel_axis, float scale);
+               int start_axis, float mean_b, float mean_g, float mean_r,
+               bool channel_axis, float scale);
 
 }  // namespace inference
 }  // namespace perception
@@ -90,14 +90,16 @@ bool PointCloudPreprocessor::Preprocess(
           continue;
         }
       }
-      Eigen::Vector3d vec3d_lidar(pt.x(), pt.y(), pt.z());
-      Eigen::Vector3d vec3d_novatel =
-          options.sensor2novatel_extrinsics * vec3d_lidar;
-      if (filter_nearby_box_points_ && vec3d_novatel[0] < box_forward_x_ &&
-          vec3d_novatel[0] > box_backward_x_ &&
-          vec3d_novatel[1] < box_forward_y_ &&
-          vec3d_novatel[1] > box_backward_y_) {
-        continue;
+      if (filter_nearby_box_points_) {
+        Eigen::Vector3d vec3d_lidar(pt.x(), pt.y(), pt.z());
+        Eigen::Vector3d vec3d_novatel =
+            options.sensor2novatel_extrinsics * vec3d_lidar;
+        if (vec3d_novatel[0] < box_forward_x_ &&
+            vec3d_novatel[0] > box_backward_x_ &&
+            vec3d_novatel[1] < box_forward_y_ &&
+            vec3d_novatel[1] > box_backward_y_) {
+          continue;
+        }
       }
       if (filter_high_z_points_ && pt.z() > z_threshold_) {
         continue;
@@ -139,15 +141,17 @@ bool PointCloudPreprocessor::Preprocess(
           continue;
         }
       }
-      Eigen::Vector3d vec3d_lidar(pt.x, pt.y, pt.z);
-      Eigen::Vector3d vec3d_novatel =
-          options.sensor2novatel_extrinsics * vec3d_lidar;
-      if (filter_nearby_box_points_ && vec3d_novatel[0] < box_forward_x_ &&
-          vec3d_novatel[0] > box_backward_x_ &&
-          vec3d_novatel[1] < box_forward_y_ &&
-          vec3d_novatel[1] > box_backward_y_) {
-        frame->cloud->SwapPoint(i, size--);
-        continue;
+      if (filter_nearby_box_points_) {
+        Eigen::Vector3d vec3d_lidar(pt.x, pt.y, pt.z);
+        Eigen::Vector3d vec3d_novatel =
+            options.sensor2novatel_extrinsics * vec3d_lidar;
+        if (vec3d_novatel[0] < box_forward_x_ &&
+            vec3d_novatel[0] > box_backward_x_ &&
+            vec3d_novatel[1] < box_forward_y_ &&
+            vec3d_novatel[1] > box_backward_y_) {
+          frame->cloud->SwapPoint(i, size--);
+          continue;
+        }
       }
       if (filter_high_z_points_ && pt.z > z_threshold_) {
         frame->cloud->SwapPoint(i, size--);
@@ -168,19 +172,19 @@ bool PointCloudPreprocessor::TransformCloud(
   if (local_cloud == nullptr) {
     return false;
   }
+  const size_t size = local_cloud->size();
   world_cloud->clear();
-  world_cloud->reserve(local_cloud->size());
-  for (size_t i = 0; i < local_cloud->size(); ++i) {
-    auto& pt = local_cloud->at(i);
-    Eigen::Vector3d trans_point(pt.x, pt.y, pt.z);
-    trans_point = pose * trans_point;
-    base::PointD world_point;
-    world_point.x = trans_point(0);
-    world_point.y = trans_point(1);
-    world_point.z = trans_point(2);
-    world_point.intensity = pt.intensity;
-    world_cloud->push_back(world_point, local_cloud->points_timestamp(i),
-                           FLT_MAX, local_cloud->points_beam_id()[i], 0);
+  world_cloud->resize(size);
+  if (size > 0) {
+    // batch-transform the xyz channels; resize already filled the height and
+    // label attributes with the defaults the per-point loop used to push
+    base::TransformPointArray(&local_cloud->at(0), size, pose,
+                              &world_cloud->at(0));
+    for (size_t i = 0; i < size; ++i) {
+      world_cloud->at(i).intensity = local_cloud->at(i).intensity;
+    }
+    *world_cloud->mutable_points_timestamp() = local_cloud->points_timestamp();
+    *world_cloud->mutable_points_beam_id() = local_cloud->points_beam_id();
   }
   return true;
 }
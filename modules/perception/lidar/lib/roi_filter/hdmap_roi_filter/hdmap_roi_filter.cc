@@ -54,6 +54,7 @@ bool HdmapROIFilter::Init(const ROIFilterInitOptions& options) {
   extend_dist_ = config.extend_dist();
   no_edge_table_ = config.no_edge_table();
   set_roi_service_ = config.set_roi_service();
+  roi_cache_distance_ = config.roi_cache_distance();
 
   // reserve mem
   const size_t KPolygonMaxNum = 100;
@@ -71,7 +72,8 @@ bool HdmapROIFilter::Init(const ROIFilterInitOptions& options) {
         << " range: " << range_ << " cell_size: " << cell_size_
         << " extend_dist: " << extend_dist_
         << " no_edge_table: " << no_edge_table_
-        << " set_roi_service: " << set_roi_service_;
+        << " set_roi_service: " << set_roi_service_
+        << " roi_cache_distance: " << roi_cache_distance_;
   return true;
 }
 
@@ -82,6 +84,25 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
     return false;
   }
 
+  const Eigen::Vector3d vel_location = frame->lidar2world_pose.translation();
+  if (roi_cache_distance_ > 0.0 && bitmap_cached_ &&
+      (vel_location - cached_anchor_location_).head<2>().cwiseAbs().maxCoeff() <
+          roi_cache_distance_) {
+    // the cached bitmap still covers the scene; query it in the frame it was
+    // rasterized in instead of re-running the polygon scan conversion
+    base::PointFCloudPtr cloud_local = base::PointFCloudPool::Instance().Get();
+    TransformCloudToAnchor(frame->cloud, frame->lidar2world_pose,
+                           cached_anchor_location_, &cloud_local);
+    const Eigen::Vector2d vel_position =
+        (vel_location - cached_anchor_location_).head<2>();
+    if (Bitmap2dFilter(cloud_local, bitmap_, &(frame->roi_indices),
+                       vel_position)) {
+      return true;
+    }
+    // e.g. the car left the rasterized roi; fall through and re-rasterize
+    bitmap_cached_ = false;
+  }
+
   // get map polygon of roi
   auto& road_polygons = frame->hdmap_struct->road_polygons;
   auto& junction_polygons = frame->hdmap_struct->junction_polygons;
@@ -109,6 +130,9 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
   bool ret = FilterWithPolygonMask(cloud_local, polygons_local_,
                                    &(frame->roi_indices));
 
+  bitmap_cached_ = ret;
+  cached_anchor_location_ = vel_location;
+
   // set roi points label
   if (ret) {
     /*
@@ -215,10 +239,31 @@ void HdmapROIFilter::TransformFrame(
   }
 }
 
+void HdmapROIFilter::TransformCloudToAnchor(
+    const base::PointFCloudPtr& cloud, const Eigen::Affine3d& vel_pose,
+    const Eigen::Vector3d& anchor_location,
+    base::PointFCloudPtr* cloud_local) {
+  Eigen::Vector3d offset = vel_pose.translation() - anchor_location;
+  Eigen::Matrix3d vel_rot = vel_pose.linear();
+  Eigen::Vector3d x_axis = vel_rot.row(0);
+  Eigen::Vector3d y_axis = vel_rot.row(1);
+
+  (*cloud_local)->clear();
+  (*cloud_local)->resize(cloud->size());
+  for (size_t i = 0; i < (*cloud_local)->size(); ++i) {
+    const auto& pt = cloud->at(i);
+    auto& local_pt = (*cloud_local)->at(i);
+    Eigen::Vector3d e_pt(pt.x, pt.y, pt.z);
+    local_pt.x = static_cast<float>(x_axis.dot(e_pt) + offset.x());
+    local_pt.y = static_cast<float>(y_axis.dot(e_pt) + offset.y());
+  }
+}
+
 bool HdmapROIFilter::Bitmap2dFilter(const base::PointFCloudPtr& in_cloud,
                                     const Bitmap2D& bitmap,
-                                    base::PointIndices* roi_indices) {
-  if (!bitmap.Check(Eigen::Vector2d(0.0, 0.0))) {
+                                    base::PointIndices* roi_indices,
+                                    const Eigen::Vector2d& vel_position) {
+  if (!bitmap.Check(vel_position)) {
     AWARN << " Car is not in roi!!.";
     return false;
   }
@@ -51,13 +51,22 @@ class HdmapROIFilter : public BaseROIFilter {
                       std::vector<base::PolygonDType>* polygons_local,
                       base::PointFCloudPtr* cloud_local);
 
+  // transform cloud into the frame the cached bitmap was rasterized in,
+  // centered at anchor_location instead of the current vehicle location
+  void TransformCloudToAnchor(const base::PointFCloudPtr& cloud,
+                              const Eigen::Affine3d& vel_pose,
+                              const Eigen::Vector3d& anchor_location,
+                              base::PointFCloudPtr* cloud_local);
+
   bool FilterWithPolygonMask(
       const base::PointFCloudPtr& cloud,
       const std::vector<base::PolygonDType>& map_polygons,
       base::PointIndices* roi_indices);
 
-  bool Bitmap2dFilter(const base::PointFCloudPtr& in_cloud,
-                      const Bitmap2D& bitmap, base::PointIndices* roi_indices);
+  bool Bitmap2dFilter(
+      const base::PointFCloudPtr& in_cloud, const Bitmap2D& bitmap,
+      base::PointIndices* roi_indices,
+      const Eigen::Vector2d& vel_position = Eigen::Vector2d(0.0, 0.0));
 
   // parameters for polygons scans convert
   double range_ = 120.0;
@@ -65,6 +74,14 @@ class HdmapROIFilter : public BaseROIFilter {
   double extend_dist_ = 0.0;
   bool no_edge_table_ = false;
   bool set_roi_service_ = false;
+  // reuse the rasterized bitmap until the vehicle moves this far from the
+  // location it was rasterized at; the bitmap covers range_ around that
+  // anchor, so a small cache distance only trades the outermost cells and a
+  // little ROI staleness for skipping the per-frame polygon scan conversion.
+  // zero rasterizes every frame
+  double roi_cache_distance_ = 0.0;
+  bool bitmap_cached_ = false;
+  Eigen::Vector3d cached_anchor_location_;
   std::vector<base::PolygonDType*> polygons_world_;
   std::vector<base::PolygonDType> polygons_local_;
   Bitmap2D bitmap_;
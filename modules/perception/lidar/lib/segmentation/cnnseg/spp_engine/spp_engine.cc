@@ -30,6 +30,9 @@ void SppEngine::Init(size_t width, size_t height, float range,
   detector_2d_cc_.SetData(data_.obs_prob_data_ref, data_.offset_data,
                           static_cast<float>(height) / (2.f * range),
                           data_.objectness_threshold);
+#ifndef PERCEPTION_CPU_ONLY
+  detector_2d_cc_.SetGpuData(data_.category_pt_blob, data_.instance_pt_blob);
+#endif
   // initialize label image
   labels_2d_.Init(width, height, sensor_name);
   labels_2d_.InitRangeMask(range, param.confidence_range);
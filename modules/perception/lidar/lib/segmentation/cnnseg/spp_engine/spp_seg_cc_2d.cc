@@ -67,11 +67,18 @@ bool SppCCDetector::CleanNodes() {
 
 size_t SppCCDetector::Detect(SppLabelImage* labels) {
   Timer timer;
-  if (!first_process_) {
-    worker_.Join();  // sync for cleaning nodes
+  bool built_on_gpu = false;
+#ifndef PERCEPTION_CPU_ONLY
+  // the kernel writes fully initialized nodes, no host cleaning is needed
+  built_on_gpu = BuildNodesGPU();
+#endif
+  if (!built_on_gpu) {
+    if (!first_process_) {
+      worker_.Join();  // sync for cleaning nodes
+    }
+    first_process_ = false;
+    BuildNodes(0, rows_);
   }
-  first_process_ = false;
-  BuildNodes(0, rows_);
   double init_time = timer.toc(true);
 
   double sync_time = timer.toc(true);
@@ -83,7 +90,9 @@ size_t SppCCDetector::Detect(SppLabelImage* labels) {
   double union_time = timer.toc(true);
 
   size_t num = ToLabelMap(labels);
-  worker_.WakeUp();  // for next use
+  if (!built_on_gpu) {
+    worker_.WakeUp();  // for next use
+  }
   double collect_time = timer.toc(true);
 
   AINFO << "SppSegCC2D: init: " << init_time << "\tsync: " << sync_time
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/lidar/lib/segmentation/cnnseg/spp_engine/spp_seg_cc_2d.h"
+
+#include "modules/perception/base/common.h"
+
+namespace apollo {
+namespace perception {
+namespace lidar {
+
+#define CUDA_KERNEL_LOOP(i, n) \
+  for (int i = blockIdx.x * blockDim.x + threadIdx.x; \
+       i < (n); \
+       i += blockDim.x * gridDim.x)
+
+__global__ void BuildNodesKernel(const int rows, const int cols,
+                                 const float* prob_map,
+                                 const float* offset_map, const float scale,
+                                 const float objectness_threshold,
+                                 SppCCDetector::Node* nodes) {
+  const int size = rows * cols;
+  CUDA_KERNEL_LOOP(idx, size) {
+    const int row = idx / cols;
+    const int col = idx - row * cols;
+    SppCCDetector::Node node;
+    node.parent = idx;
+    node.id = 0;
+    // is_object flag lives in bit 14 of status, every other field starts
+    // cleared, matching CleanNodes plus BuildNodes on the host
+    node.status = prob_map[idx] >= objectness_threshold ? 16384 : 0;
+    int center_row = static_cast<int>(offset_map[idx] * scale +
+                                      static_cast<float>(row) + 0.5f);
+    int center_col = static_cast<int>(offset_map[size + idx] * scale +
+                                      static_cast<float>(col) + 0.5f);
+    center_row = max(0, min(rows - 1, center_row));
+    center_col = max(0, min(cols - 1, center_col));
+    node.center_node = center_row * cols + center_col;
+    nodes[idx] = node;
+  }
+}
+
+bool SppCCDetector::BuildNodesGPU() {
+  if (category_pt_blob_ == nullptr || instance_pt_blob_ == nullptr) {
+    return false;
+  }
+  const int size = rows_ * cols_;
+  if (nodes_gpu_size_ != size) {
+    ReleaseGPUMemory();
+    BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void**>(&nodes_gpu_),
+                               size * sizeof(Node)));
+    nodes_gpu_size_ = size;
+  }
+  const float* prob_map = category_pt_blob_->gpu_data();
+  const float* offset_map = instance_pt_blob_->gpu_data();
+  const int block_size = (size + kGPUThreadSize - 1) / kGPUThreadSize;
+  BuildNodesKernel<<<block_size, kGPUThreadSize>>>(
+      rows_, cols_, prob_map, offset_map, scale_, objectness_threshold_,
+      nodes_gpu_);
+  BASE_CUDA_CHECK(cudaMemcpy(nodes_[0], nodes_gpu_, size * sizeof(Node),
+                             cudaMemcpyDeviceToHost));
+  return true;
+}
+
+void SppCCDetector::ReleaseGPUMemory() {
+  if (nodes_gpu_ != nullptr) {
+    BASE_CUDA_CHECK(cudaFree(nodes_gpu_));
+    nodes_gpu_ = nullptr;
+    nodes_gpu_size_ = 0;
+  }
+}
+
+}  // namespace lidar
+}  // namespace perception
+}  // namespace apollo
@@ -17,6 +17,7 @@
 
 #include <vector>
 
+#include "modules/perception/base/blob.h"
 #include "modules/perception/common/i_lib/core/i_alloc.h"
 #include "modules/perception/lib/thread/thread_worker.h"
 #include "modules/perception/lidar/lib/segmentation/cnnseg/spp_engine/spp_label_image.h"
@@ -33,7 +34,51 @@ class SppCCDetector {
     if (nodes_ != nullptr) {
       common::IFree2(&nodes_);
     }
+#ifndef PERCEPTION_CPU_ONLY
+    ReleaseGPUMemory();
+#endif
   }
+
+  struct Node {
+    uint32_t center_node = 0;
+    uint32_t parent = 0;
+    uint16_t id = 0;
+    // Note, we compress node_rank, traversed, is_center and is_object
+    // in one 16bits variable, the arrangemant is as following
+    // |is_center(1bit)|is_object(1bit)|traversed(3bit)|node_rank(11bit)|
+    uint16_t status = 0;
+
+    inline uint16_t get_node_rank() { return status & 2047; }
+    inline void set_node_rank(uint16_t node_rank) {
+      status &= 63488;
+      status |= node_rank;
+    }
+    inline uint16_t get_traversed() {
+      uint16_t pattern = 14336;
+      return static_cast<uint16_t>((status & pattern) >> 11);
+    }
+    inline void set_traversed(uint16_t traversed) {
+      status &= 51199;
+      uint16_t pattern = 7;
+      status |= static_cast<uint16_t>((traversed & pattern) << 11);
+    }
+    inline bool is_center() { return static_cast<bool>(status & 32768); }
+    inline void set_is_center(bool is_center) {
+      if (is_center) {
+        status |= 32768;
+      } else {
+        status &= 32767;
+      }
+    }
+    inline bool is_object() { return static_cast<bool>(status & 16384); }
+    inline void set_is_object(bool is_object) {
+      if (is_object) {
+        status |= 16384;  // 2^14
+      } else {
+        status &= 49151;  // 65535 - 2^14
+      }
+    }
+  };
   // @brief: initialize detector
   // @param [in]: rows of feature map
   // @param [in]: cols of feature map
@@ -55,6 +100,17 @@ class SppCCDetector {
   // @param [in]: objectness threshold
   void SetData(const float* const* prob_map, const float* offset_map,
                float scale, float objectness_threshold);
+#ifndef PERCEPTION_CPU_ONLY
+  // @brief: set device blobs, node matrix is then built on GPU directly
+  //         from the inference output instead of the synced host copies
+  // @param [in]: category blob holding the objectness probability map
+  // @param [in]: instance blob holding the center offset map
+  void SetGpuData(base::Blob<float>* category_pt_blob,
+                  base::Blob<float>* instance_pt_blob) {
+    category_pt_blob_ = category_pt_blob;
+    instance_pt_blob_ = instance_pt_blob;
+  }
+#endif
   // @brief: detect clusters
   // @param [out]: label image
   // @return: label number
@@ -66,6 +122,14 @@ class SppCCDetector {
   // @param [in]: end row index, exclusive
   // @param [out]: state of build nodes
   bool BuildNodes(int start_row_index, int end_row_index);
+#ifndef PERCEPTION_CPU_ONLY
+  // @brief: build the fully initialized node matrix on GPU from the device
+  //         blobs and copy it back in one transfer
+  // @return: false when device blobs are not set, caller falls back to CPU
+  bool BuildNodesGPU();
+  // @brief: release the device node buffer
+  void ReleaseGPUMemory();
+#endif
   // @brief: traverse node matrix
   void TraverseNodes();
   // @brief: union adjacent nodes
@@ -76,46 +140,6 @@ class SppCCDetector {
   bool CleanNodes();
 
  private:
-  struct Node {
-    uint32_t center_node = 0;
-    uint32_t parent = 0;
-    uint16_t id = 0;
-    // Note, we compress node_rank, traversed, is_center and is_object
-    // in one 16bits variable, the arrangemant is as following
-    // |is_center(1bit)|is_object(1bit)|traversed(3bit)|node_rank(11bit)|
-    uint16_t status = 0;
-
-    inline uint16_t get_node_rank() { return status & 2047; }
-    inline void set_node_rank(uint16_t node_rank) {
-      status &= 63488;
-      status |= node_rank;
-    }
-    inline uint16_t get_traversed() {
-      uint16_t pattern = 14336;
-      return static_cast<uint16_t>((status & pattern) >> 11);
-    }
-    inline void set_traversed(uint16_t traversed) {
-      status &= 51199;
-      uint16_t pattern = 7;
-      status |= static_cast<uint16_t>((traversed & pattern) << 11);
-    }
-    inline bool is_center() { return static_cast<bool>(status & 32768); }
-    inline void set_is_center(bool is_center) {
-      if (is_center) {
-        status |= 32768;
-      } else {
-        status &= 32767;
-      }
-    }
-    inline bool is_object() { return static_cast<bool>(status & 16384); }
-    inline void set_is_object(bool is_object) {
-      if (is_object) {
-        status |= 16384;  // 2^14
-      } else {
-        status &= 49151;  // 65535 - 2^14
-      }
-    }
-  };
   // @brief: tranverse a node
   // @param [in]: input node
   void Traverse(Node* x);
@@ -141,6 +165,13 @@ class SppCCDetector {
   float scale_ = 0.f;
   float objectness_threshold_ = 0.f;
 
+  // param for managing gpu memory, only for cuda code
+  base::Blob<float>* category_pt_blob_ = nullptr;
+  base::Blob<float>* instance_pt_blob_ = nullptr;
+  Node* nodes_gpu_ = nullptr;
+  int nodes_gpu_size_ = 0;
+  const int kGPUThreadSize = 512;
+
   lib::ThreadWorker worker_;
   bool first_process_ = true;
 
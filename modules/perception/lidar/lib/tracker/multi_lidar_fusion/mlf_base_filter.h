@@ -16,6 +16,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "cyber/common/macros.h"
 #include "modules/perception/lib/registerer/registerer.h"
@@ -46,6 +47,21 @@ class MlfBaseFilter {
                                 const MlfTrackDataConstPtr& track_data,
                                 TrackedObjectPtr new_object) = 0;
 
+  // @brief: batched version of UpdateWithObject over all pairs matched
+  //         in one frame; the default forwards to the per-pair interface,
+  //         filters with batchable state may override it
+  // @params [in]: options for updating
+  // @params [in]: track data vector, parallel to objects
+  // @params [in/out]: new objects for updating
+  virtual void UpdateWithObjects(
+      const MlfFilterOptions& options,
+      const std::vector<MlfTrackDataPtr>& tracks,
+      const std::vector<TrackedObjectPtr>& objects) {
+    for (size_t i = 0; i < tracks.size(); ++i) {
+      UpdateWithObject(options, tracks[i], objects[i]);
+    }
+  }
+
   // @brief: interface for updating filter without object
   // @params [in]: options for updating
   // @params [in]: current timestamp
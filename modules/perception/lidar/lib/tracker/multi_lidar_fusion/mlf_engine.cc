@@ -170,15 +170,30 @@ void MlfEngine::TrackObjectMatchAndAssign(
 
 void MlfEngine::TrackStateFilter(const std::vector<MlfTrackDataPtr>& tracks,
                                  double frame_timestamp) {
-  std::vector<TrackedObjectPtr> objects;
-  for (auto& track_data : tracks) {
-    track_data->GetAndCleanCachedObjectsInTimeInterval(&objects);
-    for (auto& obj : objects) {
-      tracker_->UpdateTrackDataWithObject(track_data, obj);
+  std::vector<std::vector<TrackedObjectPtr>> cached_objects(tracks.size());
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    tracks[i]->GetAndCleanCachedObjectsInTimeInterval(&cached_objects[i]);
+    if (cached_objects[i].empty()) {
+      tracker_->UpdateTrackDataWithoutObject(frame_timestamp, tracks[i]);
     }
-    if (objects.empty()) {
-      tracker_->UpdateTrackDataWithoutObject(frame_timestamp, track_data);
+  }
+  // batch matched pairs across tracks round by round, so a track with
+  // several cached objects still consumes them in time order
+  std::vector<MlfTrackDataPtr> update_tracks;
+  std::vector<TrackedObjectPtr> update_objects;
+  for (size_t round = 0;; ++round) {
+    update_tracks.clear();
+    update_objects.clear();
+    for (size_t i = 0; i < tracks.size(); ++i) {
+      if (round < cached_objects[i].size()) {
+        update_tracks.push_back(tracks[i]);
+        update_objects.push_back(cached_objects[i][round]);
+      }
+    }
+    if (update_tracks.empty()) {
+      break;
     }
+    tracker_->UpdateTrackDataWithObjects(update_tracks, update_objects);
   }
 }
 
@@ -137,14 +137,106 @@ void MlfMotionFilter::InitializeTrackState(TrackedObjectPtr new_object) {
   BeliefToOutput(new_object);
 }
 
+void MlfMotionFilter::UpdateWithObjects(
+    const MlfFilterOptions& options, const std::vector<MlfTrackDataPtr>& tracks,
+    const std::vector<TrackedObjectPtr>& objects) {
+  // 1. scalar pre-pass: track initialization, background short-circuit
+  // and motion measurement, all branchy per-track work
+  std::vector<size_t> update_indices;
+  update_indices.reserve(objects.size());
+  for (size_t i = 0; i < objects.size(); ++i) {
+    if (tracks[i]->age_ == 0) {
+      InitializeTrackState(objects[i]);
+      continue;
+    }
+    if (objects[i]->is_background) {
+      objects[i]->output_velocity.setZero();
+      objects[i]->output_velocity_uncertainty = Eigen::Matrix3d::Identity();
+      continue;
+    }
+    motion_measurer_->ComputeMotionMeasurment(tracks[i], objects[i]);
+    if (!use_adaptive_) {
+      objects[i]->update_quality = 1.0;
+    }
+    update_indices.push_back(i);
+  }
+  // 2. kalman updates over gathered SoA state
+  BatchKalmanUpdate(tracks, objects, update_indices);
+  // 3. scalar post-pass: boostup, cliping, refine and covariance, same
+  // per-track sequence as the per-pair interface
+  for (size_t i : update_indices) {
+    const MlfTrackDataConstPtr track_data = tracks[i];
+    TrackedObjectPtr new_object = objects[i];
+    TrackedObjectConstPtr latest_object = track_data->GetLatestObject().second;
+    StateToBelief(new_object);
+    if (use_convergence_boostup_) {
+      ConvergenceEstimationAndBoostUp(track_data, latest_object, new_object);
+    }
+    ClipingState(new_object);
+    StateToBelief(new_object);
+    BeliefToOutput(new_object);
+    if (motion_refiner_->Refine(track_data, new_object)) {
+      ComputeConvergenceConfidence(track_data, new_object, false);
+      UpdateConverged(track_data, new_object);
+    }
+    OnlineCovarianceEstimation(track_data, new_object);
+  }
+}
+
+void MlfMotionFilter::BatchKalmanUpdate(
+    const std::vector<MlfTrackDataPtr>& tracks,
+    const std::vector<TrackedObjectPtr>& objects,
+    const std::vector<size_t>& update_indices) {
+  const int num = static_cast<int>(update_indices.size());
+  if (num == 0) {
+    return;
+  }
+  if (batch_states_.cols() < num) {
+    batch_states_.resize(4, num);
+    batch_covariances_.resize(4, 4 * num);
+  }
+  std::vector<TrackedObjectConstPtr> latest_objects(num);
+  // gather priors once, so the update sweeps contiguous scratch columns
+  // instead of chasing per-track heap objects
+  for (int k = 0; k < num; ++k) {
+    latest_objects[k] =
+        tracks[update_indices[k]]->GetLatestObject().second;
+    batch_states_.col(k) = latest_objects[k]->state;
+    batch_covariances_.block<4, 4>(0, 4 * k) =
+        latest_objects[k]->state_covariance;
+  }
+  for (int k = 0; k < num; ++k) {
+    const size_t i = update_indices[k];
+    KalmanStateUpdate(tracks[i], latest_objects[k], objects[i],
+                      batch_states_.col(k),
+                      batch_covariances_.block<4, 4>(0, 4 * k));
+  }
+  // scatter posteriors back to the per-track view
+  for (int k = 0; k < num; ++k) {
+    const size_t i = update_indices[k];
+    objects[i]->state = batch_states_.col(k);
+    objects[i]->state_covariance = batch_covariances_.block<4, 4>(0, 4 * k);
+  }
+}
+
 void MlfMotionFilter::KalmanFilterUpdateWithPartialObservation(
     const MlfTrackDataConstPtr& track_data,
     const TrackedObjectConstPtr& latest_object, TrackedObjectPtr new_object) {
+  new_object->state = latest_object->state;
+  new_object->state_covariance = latest_object->state_covariance;
+  KalmanStateUpdate(track_data, latest_object, new_object, new_object->state,
+                    new_object->state_covariance);
+}
+
+void MlfMotionFilter::KalmanStateUpdate(
+    const MlfTrackDataConstPtr& track_data,
+    const TrackedObjectConstPtr& latest_object, TrackedObjectPtr new_object,
+    Eigen::Ref<Eigen::Vector4d> state,
+    Eigen::Ref<Eigen::Matrix4d> state_covariance) {
   double range = new_object->object_ptr->center.norm();
 
-  const Eigen::Vector4d& last_state = latest_object->state;
-  const Eigen::Matrix4d& last_state_covariance =
-      latest_object->state_covariance;
+  const Eigen::Vector4d last_state = state;
+  const Eigen::Matrix4d last_state_covariance = state_covariance;
 
   double time_diff = new_object->object_ptr->latest_tracked_time -
                      latest_object->object_ptr->latest_tracked_time;
@@ -171,8 +263,6 @@ void MlfMotionFilter::KalmanFilterUpdateWithPartialObservation(
     transition = rot_extend * transition;
   }
 
-  auto& state = new_object->state;
-  auto& state_covariance = new_object->state_covariance;
   auto measurement_covariance =
       new_object->measurement_covariance.block<2, 2>(0, 0);
   // 1. prediction stage
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "modules/perception/lidar/lib/tracker/multi_lidar_fusion/mlf_base_filter.h"
 #include "modules/perception/lidar/lib/tracker/multi_lidar_fusion/mlf_motion_measurement.h"
@@ -42,6 +43,16 @@ class MlfMotionFilter : public MlfBaseFilter {
                         const MlfTrackDataConstPtr& track_data,
                         TrackedObjectPtr new_object) override;
 
+  // @brief: batched update over all pairs matched in one frame. The
+  //         branchy per-track stages stay scalar, while the kalman state
+  //         update runs over state gathered into SoA scratch columns
+  // @params [in]: options for updating
+  // @params [in]: track data vector, parallel to objects
+  // @params [in/out]: new objects for updating
+  void UpdateWithObjects(const MlfFilterOptions& options,
+                         const std::vector<MlfTrackDataPtr>& tracks,
+                         const std::vector<TrackedObjectPtr>& objects) override;
+
   // @brief: updating motion filter without object
   // @params [in]: options for updating
   // @params [in]: current timestamp
@@ -66,6 +77,29 @@ class MlfMotionFilter : public MlfBaseFilter {
       const MlfTrackDataConstPtr& track_data,
       const TrackedObjectConstPtr& latest_object, TrackedObjectPtr new_object);
 
+  // @brief: kalman update core working on externally owned state storage,
+  //         so the same math serves both the per-track members and the
+  //         batched SoA scratch
+  // @params [in]: history track data
+  // @params [in]: latest object in the track data
+  // @params [in/out]: new object to be updated
+  // @params [in/out]: state, prior on entry, posterior on exit
+  // @params [in/out]: state covariance, prior on entry, posterior on exit
+  void KalmanStateUpdate(const MlfTrackDataConstPtr& track_data,
+                         const TrackedObjectConstPtr& latest_object,
+                         TrackedObjectPtr new_object,
+                         Eigen::Ref<Eigen::Vector4d> state,
+                         Eigen::Ref<Eigen::Matrix4d> state_covariance);
+
+  // @brief: run kalman updates of the selected pairs over SoA scratch,
+  //         gathering priors once and scattering posteriors once
+  // @params [in]: track data vector, parallel to objects
+  // @params [in/out]: new objects for updating
+  // @params [in]: indices of pairs needing a kalman update
+  void BatchKalmanUpdate(const std::vector<MlfTrackDataPtr>& tracks,
+                         const std::vector<TrackedObjectPtr>& objects,
+                         const std::vector<size_t>& update_indices);
+
   // @brief: adjust kalman state gain with several strategies
   // @params [in]: history track data
   // @params [in]: latest object in the track data
@@ -144,6 +178,10 @@ class MlfMotionFilter : public MlfBaseFilter {
   double converged_confidence_minimum_ = 0.5;
   double noise_maximum_ = 0.1;
   double trust_orientation_range_ = 40.0;
+  // SoA scratch for batched kalman updates, reused across frames; states
+  // are stored as columns and covariances as consecutive 4x4 blocks
+  Eigen::Matrix<double, 4, Eigen::Dynamic> batch_states_;
+  Eigen::Matrix<double, 4, Eigen::Dynamic> batch_covariances_;
 };  // class MlfMotionFilter
 
 }  // namespace lidar
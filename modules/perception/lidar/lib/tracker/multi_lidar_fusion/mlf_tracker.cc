@@ -69,6 +69,20 @@ void MlfTracker::UpdateTrackDataWithObject(MlfTrackDataPtr track_data,
   track_data->is_current_state_predicted_ = false;
 }
 
+void MlfTracker::UpdateTrackDataWithObjects(
+    const std::vector<MlfTrackDataPtr>& tracks,
+    const std::vector<TrackedObjectPtr>& objects) {
+  // 1. state filters and store belief in new objects
+  for (auto& filter : filters_) {
+    filter->UpdateWithObjects(filter_options_, tracks, objects);
+  }
+  // 2. push new objects to track data
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    tracks[i]->PushTrackedObjectToTrack(objects[i]);
+    tracks[i]->is_current_state_predicted_ = false;
+  }
+}
+
 void MlfTracker::UpdateTrackDataWithoutObject(double timestamp,
                                               MlfTrackDataPtr track_data) {
   for (auto& filter : filters_) {
@@ -53,6 +53,12 @@ class MlfTracker {
   void UpdateTrackDataWithObject(MlfTrackDataPtr track_data,
                                  TrackedObjectPtr new_object);
 
+  // @brief: batch update of several track data, one matched object each
+  // @params [in/out]: history track data, parallel to objects
+  // @params [in/out]: new objects
+  void UpdateTrackDataWithObjects(const std::vector<MlfTrackDataPtr>& tracks,
+                                  const std::vector<TrackedObjectPtr>& objects);
+
   // @brief: update track data without object
   // @params [in]: timestamp
   // @params [in/out]: history track data
@@ -63,6 +63,7 @@ bool HDMapInput::InitInternal() {
 bool HDMapInput::Reset() {
   lib::MutexLock lock(&mutex_);
   inited_ = false;
+  roi_cache_.clear();
   return InitInternal();
 }
 
@@ -80,6 +81,11 @@ bool HDMapInput::InitHDMap() {
     AERROR << "hdmap_sample_step not found.";
     hdmap_sample_step_ = 5;
   }
+  if (!model_config->get_value("roi_cache_distance", &roi_cache_distance_)) {
+    AERROR << "roi_cache_distance not found.";
+    roi_cache_distance_ = 1.0;
+  }
+  roi_cache_.clear();
 
   // TO DO: Decide which map to use
   // Option 1: Use global hdmap_ = apollo::hdmap::HDMapUtil::BaseMapPtr();
@@ -108,6 +114,25 @@ bool HDMapInput::GetRoiHDMapStruct(
     std::shared_ptr<base::HdmapStruct> hdmap_struct_prt) {
   lib::MutexLock lock(&mutex_);
   CHECK_NOTNULL(hdmap_.get());
+  if (hdmap_struct_prt == nullptr) {
+    return false;
+  }
+  // Reuse the last result while the query point stays close to the cached
+  // one; at typical frame rates the boundaries are identical within
+  // roi_cache_distance_ of ego motion
+  if (roi_cache_distance_ > 0.0) {
+    auto cache_iter = roi_cache_.find(distance);
+    if (cache_iter != roi_cache_.end()) {
+      const base::PointD& cached_point = cache_iter->second.point;
+      const double dx = pointd.x - cached_point.x;
+      const double dy = pointd.y - cached_point.y;
+      if (dx * dx + dy * dy <=
+          roi_cache_distance_ * roi_cache_distance_) {
+        *hdmap_struct_prt = *(cache_iter->second.roi);
+        return true;
+      }
+    }
+  }
   // Get original road boundary and junction
   std::vector<RoadRoiPtr> road_boundary_vec;
   std::vector<JunctionInfoConstPtr> junctions_vec;
@@ -120,9 +145,6 @@ bool HDMapInput::GetRoiHDMapStruct(
     AERROR << "Failed to get road boundary, point: " << point.DebugString();
     return false;
   }
-  if (hdmap_struct_prt == nullptr) {
-    return false;
-  }
   hdmap_struct_prt->hole_polygons.clear();
   hdmap_struct_prt->junction_polygons.clear();
   hdmap_struct_prt->road_boundary.clear();
@@ -137,6 +159,11 @@ bool HDMapInput::GetRoiHDMapStruct(
   GetRoadBoundaryFilteredByJunctions(road_boundaries,
                                      hdmap_struct_prt->junction_polygons,
                                      &(hdmap_struct_prt->road_boundary));
+  if (roi_cache_distance_ > 0.0) {
+    CachedRoi& cached = roi_cache_[distance];
+    cached.point = pointd;
+    cached.roi = std::make_shared<base::HdmapStruct>(*hdmap_struct_prt);
+  }
   return true;
 }
 
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -76,6 +77,15 @@ class HDMapInput {
   std::unique_ptr<apollo::hdmap::HDMap> hdmap_;
   int hdmap_sample_step_ = 5;
   std::string hdmap_file_;
+  // last ROI query result per search distance; reused while the query point
+  // stays within roi_cache_distance_ of the cached one, so the lidar and
+  // radar ROI paths share a single map lookup between pose jumps
+  struct CachedRoi {
+    base::PointD point;
+    std::shared_ptr<base::HdmapStruct> roi;
+  };
+  std::map<double, CachedRoi> roi_cache_;
+  double roi_cache_distance_ = 1.0;
 
   DECLARE_SINGLETON(HDMapInput)
 };
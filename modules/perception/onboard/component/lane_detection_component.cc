@@ -302,8 +302,8 @@ void LaneDetectionComponent::OnReceiveImage(
   apollo::common::ErrorCode error_code = apollo::common::OK;
 
   // prefused msg
-  std::shared_ptr<SensorFrameMessage> prefused_message(new (std::nothrow)
-                                                           SensorFrameMessage);
+  std::shared_ptr<SensorFrameMessage> prefused_message =
+      SensorFrameMessagePool::Instance().Get();
   if (InternalProc(message, camera_name, &error_code, prefused_message.get(),
                    out_message.get()) != cyber::SUCC) {
     AERROR << "InternalProc failed, error_code: " << error_code;
@@ -673,8 +673,10 @@ int LaneDetectionComponent::InternalProc(
                            cv::Scalar(0, 0, 0));
       base::Image8U out_image(image_height_, image_width_, base::Color::RGB);
       camera_frame.data_provider->GetImage(image_options, &out_image);
-      memcpy(output_image.data, out_image.cpu_data(),
-             out_image.total() * sizeof(uint8_t));
+      cv::Mat out_wrap(out_image.rows(), out_image.cols(), CV_8UC3,
+                       const_cast<uint8_t*>(out_image.cpu_data()),
+                       out_image.width_step());
+      out_wrap.copyTo(output_image);
       visualize_.ShowResult_all_info_single_camera(output_image, camera_frame,
                                                    mot_buffer_);
     }
@@ -19,6 +19,7 @@
 #include <string>
 
 #include "cyber/cyber.h"
+#include "modules/perception/base/concurrent_object_pool.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 #include "modules/perception/onboard/inner_component_messages/inner_component_messages.h"
 #include "modules/perception/proto/perception_obstacle.pb.h"
@@ -39,6 +40,17 @@ class LidarFrameMessage {
 
   LidarFrameMessage* New() const { return new LidarFrameMessage; }
 
+  // @brief reset payload fields for pooled reuse; the generation tag is
+  //        bumped so a stale holder can detect the message was recycled
+  void Reset() {
+    timestamp_ = 0.0;
+    seq_num_ = 0;
+    process_stage_ = ProcessStage::UNKNOWN_STAGE;
+    error_code_ = apollo::common::ErrorCode::OK;
+    lidar_frame_.reset();
+    ++generation_;
+  }
+
  public:
   double timestamp_ = 0.0;
   uint32_t seq_num_ = 0;
@@ -46,8 +58,21 @@ class LidarFrameMessage {
   ProcessStage process_stage_ = ProcessStage::UNKNOWN_STAGE;
   apollo::common::ErrorCode error_code_ = apollo::common::ErrorCode::OK;
   std::shared_ptr<lidar::LidarFrame> lidar_frame_;
+  // generation of pooled reuse, bumped each Reset
+  uint64_t generation_ = 0;
+};
+
+struct LidarFrameMessageInitializer {
+  void operator()(LidarFrameMessage* message) const { message->Reset(); }
 };
 
+static const size_t kLidarFrameMessagePoolSize = 50;
+
+typedef base::ConcurrentObjectPool<LidarFrameMessage,
+                                   kLidarFrameMessagePoolSize,
+                                   LidarFrameMessageInitializer>
+    LidarFrameMessagePool;
+
 }  // namespace onboard
 }  // namespace perception
 }  // namespace apollo
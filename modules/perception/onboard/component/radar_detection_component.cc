@@ -60,8 +60,8 @@ bool RadarDetectionComponent::Proc(const std::shared_ptr<ContiRadar>& message) {
   AINFO << "Enter radar preprocess, message timestamp: "
         << std::to_string(message->header().timestamp_sec())
         << " current timestamp " << lib::TimeUtil::GetCurrentTime();
-  std::shared_ptr<SensorFrameMessage> out_message(new (std::nothrow)
-                                                      SensorFrameMessage);
+  std::shared_ptr<SensorFrameMessage> out_message =
+      SensorFrameMessagePool::Instance().Get();
   if (!InternalProc(message, out_message)) {
     return false;
   }
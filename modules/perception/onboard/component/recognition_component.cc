@@ -26,6 +26,14 @@ namespace apollo {
 namespace perception {
 namespace onboard {
 
+RecognitionComponent::~RecognitionComponent() {
+  if (pipeline_thread_ != nullptr) {
+    // nullptr message is the stop sentinel of the worker
+    input_queue_->Push(nullptr);
+    pipeline_thread_->join();
+  }
+}
+
 bool RecognitionComponent::Init() {
   LidarRecognitionComponentConfig comp_config;
   if (!GetProtoConfig(&comp_config)) {
@@ -39,6 +47,17 @@ bool RecognitionComponent::Init() {
     AERROR << "Failed to init recongnition component algorithm plugin.";
     return false;
   }
+
+  enable_pipeline_ = comp_config.enable_pipeline();
+  if (enable_pipeline_) {
+    input_queue_.reset(
+        new lib::FixedSizeConQueue<std::shared_ptr<LidarFrameMessage>>(
+            comp_config.pipeline_queue_size()));
+    pipeline_thread_.reset(
+        new std::thread(&RecognitionComponent::PipelineCore, this));
+    AINFO << "Recognition pipeline enabled, queue size: "
+          << comp_config.pipeline_queue_size();
+  }
   return true;
 }
 
@@ -48,8 +67,15 @@ bool RecognitionComponent::Proc(
         << std::to_string(message->timestamp_) << " current timestamp: "
         << std::to_string(lib::TimeUtil::GetCurrentTime());
 
+  if (enable_pipeline_) {
+    // hand the frame to the worker, blocking only when the bounded
+    // in-flight queue is full, and let the reader accept the next message
+    input_queue_->Push(message);
+    return true;
+  }
+
   std::shared_ptr<SensorFrameMessage> out_message =
-      std::make_shared<SensorFrameMessage>();
+      SensorFrameMessagePool::Instance().Get();
 
   if (InternalProc(message, out_message)) {
     writer_->Write(out_message);
@@ -59,6 +85,22 @@ bool RecognitionComponent::Proc(
   return false;
 }
 
+void RecognitionComponent::PipelineCore() {
+  while (true) {
+    std::shared_ptr<LidarFrameMessage> message;
+    input_queue_->Pop(&message);
+    if (message == nullptr) {
+      break;
+    }
+    std::shared_ptr<SensorFrameMessage> out_message =
+        SensorFrameMessagePool::Instance().Get();
+    if (InternalProc(message, out_message)) {
+      writer_->Write(out_message);
+      AINFO << "Send lidar recognition output message.";
+    }
+  }
+}
+
 bool RecognitionComponent::InitAlgorithmPlugin() {
   tracker_.reset(new lidar::LidarObstacleTracking);
   if (tracker_ == nullptr) {
@@ -17,10 +17,12 @@
 
 #include <memory>
 #include <string>
+#include <thread>
 
 #include "cyber/cyber.h"
 
 #include "modules/perception/base/sensor_meta.h"
+#include "modules/perception/lib/thread/concurrent_queue.h"
 #include "modules/perception/lidar/app/lidar_obstacle_tracking.h"
 #include "modules/perception/onboard/component/lidar_inner_component_messages.h"
 #include "modules/perception/onboard/inner_component_messages/inner_component_messages.h"
@@ -33,7 +35,7 @@ namespace onboard {
 class RecognitionComponent : public cyber::Component<LidarFrameMessage> {
  public:
   RecognitionComponent() : tracker_(nullptr) {}
-  ~RecognitionComponent() = default;
+  ~RecognitionComponent();
 
   bool Init() override;
   bool Proc(const std::shared_ptr<LidarFrameMessage>& message) override;
@@ -42,7 +44,16 @@ class RecognitionComponent : public cyber::Component<LidarFrameMessage> {
   bool InitAlgorithmPlugin();
   bool InternalProc(const std::shared_ptr<const LidarFrameMessage>& in_message,
                     const std::shared_ptr<SensorFrameMessage>& out_message);
+  // @brief: worker loop draining the in-flight queue in FIFO order,
+  //         so pipelined frames are still published in sequence
+  void PipelineCore();
   std::unique_ptr<lidar::LidarObstacleTracking> tracker_;
+  // track frames in a dedicated worker, so the reader can accept the next
+  // segmented frame while the previous one is still being tracked
+  bool enable_pipeline_ = false;
+  std::unique_ptr<lib::FixedSizeConQueue<std::shared_ptr<LidarFrameMessage>>>
+      input_queue_;
+  std::unique_ptr<std::thread> pipeline_thread_;
   base::SensorInfo sensor_info_;
   std::string main_sensor_name_;
   std::string output_channel_name_;
@@ -30,6 +30,14 @@ namespace onboard {
 uint32_t SegmentationComponent::s_seq_num_ = 0;
 std::mutex SegmentationComponent::s_mutex_;
 
+SegmentationComponent::~SegmentationComponent() {
+  if (pipeline_thread_ != nullptr) {
+    // nullptr message is the stop sentinel of the worker
+    input_queue_->Push(nullptr);
+    pipeline_thread_->join();
+  }
+}
+
 bool SegmentationComponent::Init() {
   LidarSegmentationComponentConfig comp_config;
   if (!GetProtoConfig(&comp_config)) {
@@ -49,6 +57,17 @@ bool SegmentationComponent::Init() {
     AERROR << "Failed to init segmentation component algorithm plugin.";
     return false;
   }
+
+  enable_pipeline_ = comp_config.enable_pipeline();
+  if (enable_pipeline_) {
+    input_queue_.reset(
+        new lib::FixedSizeConQueue<std::shared_ptr<drivers::PointCloud>>(
+            comp_config.pipeline_queue_size()));
+    pipeline_thread_.reset(
+        new std::thread(&SegmentationComponent::PipelineCore, this));
+    AINFO << "Segmentation pipeline enabled, queue size: "
+          << comp_config.pipeline_queue_size();
+  }
   return true;
 }
 
@@ -58,8 +77,15 @@ bool SegmentationComponent::Proc(
         << std::to_string(message->measurement_time()) << " current timestamp: "
         << std::to_string(lib::TimeUtil::GetCurrentTime());
 
-  std::shared_ptr<LidarFrameMessage> out_message(new (std::nothrow)
-                                                     LidarFrameMessage);
+  if (enable_pipeline_) {
+    // hand the frame to the worker, blocking only when the bounded
+    // in-flight queue is full, and let the reader accept the next message
+    input_queue_->Push(message);
+    return true;
+  }
+
+  std::shared_ptr<LidarFrameMessage> out_message =
+      LidarFrameMessagePool::Instance().Get();
 
   bool status = InternalProc(message, out_message);
   if (status) {
@@ -69,6 +95,22 @@ bool SegmentationComponent::Proc(
   return status;
 }
 
+void SegmentationComponent::PipelineCore() {
+  while (true) {
+    std::shared_ptr<drivers::PointCloud> message;
+    input_queue_->Pop(&message);
+    if (message == nullptr) {
+      break;
+    }
+    std::shared_ptr<LidarFrameMessage> out_message =
+        LidarFrameMessagePool::Instance().Get();
+    if (InternalProc(message, out_message)) {
+      writer_->Write(out_message);
+      AINFO << "Send lidar segment output message.";
+    }
+  }
+}
+
 bool SegmentationComponent::InitAlgorithmPlugin() {
   CHECK(common::SensorManager::Instance()->GetSensorInfo(sensor_name_,
                                                          &sensor_info_));
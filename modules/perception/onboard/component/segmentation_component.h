@@ -17,9 +17,11 @@
 
 #include <memory>
 #include <string>
+#include <thread>
 
 #include "cyber/cyber.h"
 #include "modules/drivers/proto/pointcloud.pb.h"
+#include "modules/perception/lib/thread/concurrent_queue.h"
 #include "modules/perception/lidar/app/lidar_obstacle_segmentation.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 #include "modules/perception/onboard/component/lidar_inner_component_messages.h"
@@ -34,7 +36,7 @@ class SegmentationComponent : public cyber::Component<drivers::PointCloud> {
  public:
   SegmentationComponent() : segmentor_(nullptr) {}
 
-  ~SegmentationComponent() = default;
+  ~SegmentationComponent();
 
   bool Init() override;
   bool Proc(const std::shared_ptr<drivers::PointCloud>& message) override;
@@ -44,12 +46,21 @@ class SegmentationComponent : public cyber::Component<drivers::PointCloud> {
   bool InternalProc(
       const std::shared_ptr<const drivers::PointCloud>& in_message,
       const std::shared_ptr<LidarFrameMessage>& out_message);
+  // @brief: worker loop draining the in-flight queue in FIFO order,
+  //         so pipelined frames are still published in sequence
+  void PipelineCore();
 
  private:
   static std::mutex s_mutex_;
   static uint32_t s_seq_num_;
   std::string sensor_name_;
   bool enable_hdmap_ = true;
+  // process frames in a dedicated worker, overlapping segmentation of the
+  // next frame with downstream tracking of the previous one
+  bool enable_pipeline_ = false;
+  std::unique_ptr<lib::FixedSizeConQueue<std::shared_ptr<drivers::PointCloud>>>
+      input_queue_;
+  std::unique_ptr<std::thread> pipeline_thread_;
   float lidar_query_tf_offset_ = 20.0f;
   std::string lidar2novatel_tf2_child_frame_id_;
   std::string output_channel_name_;
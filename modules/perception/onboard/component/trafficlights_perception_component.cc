@@ -983,8 +983,10 @@ void TrafficLightsPerceptionComponent::Visualize(
   camera::DataProvider::ImageOptions image_options;
   image_options.target_color = base::Color::BGR;
   frame.data_provider->GetImage(image_options, &out_image);
-  memcpy(output_image.data, out_image.cpu_data(),
-         out_image.total() * sizeof(uint8_t));
+  cv::Mat out_wrap(out_image.rows(), out_image.cols(), CV_8UC3,
+                   const_cast<uint8_t*>(out_image.cpu_data()),
+                   out_image.width_step());
+  out_wrap.copyTo(output_image);
 
   for (const auto& light : lights) {
     // Crop ROI
@@ -18,6 +18,7 @@
 #include <string>
 
 #include "cyber/cyber.h"
+#include "modules/perception/base/concurrent_object_pool.h"
 #include "modules/perception/base/frame.h"
 #include "modules/perception/base/hdmap_struct.h"
 #include "modules/perception/base/impending_collision_edge.h"
@@ -53,6 +54,19 @@ class SensorFrameMessage {
   std::string GetTypeName() { return type_name_; }
   SensorFrameMessage* New() const { return new SensorFrameMessage; }
 
+  // @brief reset payload fields for pooled reuse; the generation tag is
+  //        bumped so a stale holder can detect the message was recycled
+  void Reset() {
+    error_code_ = apollo::common::ErrorCode::OK;
+    sensor_id_.clear();
+    timestamp_ = 0.0;
+    seq_num_ = 0;
+    hdmap_.reset();
+    frame_.reset();
+    process_stage_ = ProcessStage::UNKNOWN_STAGE;
+    ++generation_;
+  }
+
  public:
   apollo::common::ErrorCode error_code_ = apollo::common::ErrorCode::OK;
 
@@ -65,8 +79,21 @@ class SensorFrameMessage {
   base::FramePtr frame_;
 
   ProcessStage process_stage_ = ProcessStage::UNKNOWN_STAGE;
+  // generation of pooled reuse, bumped each Reset
+  uint64_t generation_ = 0;
+};
+
+struct SensorFrameMessageInitializer {
+  void operator()(SensorFrameMessage* message) const { message->Reset(); }
 };
 
+static const size_t kSensorFrameMessagePoolSize = 50;
+
+typedef base::ConcurrentObjectPool<SensorFrameMessage,
+                                   kSensorFrameMessagePoolSize,
+                                   SensorFrameMessageInitializer>
+    SensorFrameMessagePool;
+
 }  // namespace onboard
 }  // namespace perception
 }  // namespace apollo
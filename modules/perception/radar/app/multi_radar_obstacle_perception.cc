@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/radar/app/multi_radar_obstacle_perception.h"
+
+#include <algorithm>
+
+#include "modules/perception/lib/config_manager/config_manager.h"
+#include "modules/perception/lib/registerer/registerer.h"
+#include "modules/perception/lib/utils/perf.h"
+
+using apollo::perception::lib::ConfigManager;
+using apollo::perception::lib::ModelConfig;
+
+namespace apollo {
+namespace perception {
+namespace radar {
+
+bool MultiRadarObstaclePerception::Init(const std::string& pipeline_name) {
+  std::string model_name = pipeline_name;
+  const ModelConfig* model_config = nullptr;
+  CHECK(ConfigManager::Instance()->GetModelConfig(model_name, &model_config))
+      << "not found model: " << model_name;
+
+  std::string detector_name;
+  CHECK(model_config->get_value("Detector", &detector_name))
+      << "Detector not found";
+
+  std::string roi_filter_name;
+  CHECK(model_config->get_value("RoiFilter", &roi_filter_name))
+      << "RoiFilter not found";
+
+  std::string tracker_name;
+  CHECK(model_config->get_value("Tracker", &tracker_name))
+      << "Tracker not found";
+
+  BaseDetector* detector =
+      BaseDetectorRegisterer::GetInstanceByName(detector_name);
+  CHECK_NOTNULL(detector);
+  detector_.reset(detector);
+
+  BaseRoiFilter* roi_filter =
+      BaseRoiFilterRegisterer::GetInstanceByName(roi_filter_name);
+  CHECK_NOTNULL(roi_filter);
+  roi_filter_.reset(roi_filter);
+
+  BaseTracker* tracker = BaseTrackerRegisterer::GetInstanceByName(tracker_name);
+  CHECK_NOTNULL(tracker);
+  tracker_.reset(tracker);
+
+  CHECK(detector_->Init()) << "radar detector init error";
+  CHECK(roi_filter_->Init()) << "radar roi filter init error";
+  CHECK(tracker_->Init()) << "radar tracker init error";
+
+  return true;
+}
+
+bool MultiRadarObstaclePerception::Perceive(
+    const drivers::ContiRadar& corrected_obstacles,
+    const RadarPerceptionOptions& options,
+    std::vector<base::ObjectPtr>* objects) {
+  return PerceiveBatch({corrected_obstacles}, {options}, objects);
+}
+
+bool MultiRadarObstaclePerception::PerceiveBatch(
+    const std::vector<drivers::ContiRadar>& radar_frames,
+    const std::vector<RadarPerceptionOptions>& options,
+    std::vector<base::ObjectPtr>* objects) {
+  PERCEPTION_PERF_FUNCTION();
+  if (radar_frames.empty() || radar_frames.size() != options.size()) {
+    AERROR << "Invalid batch, frames: " << radar_frames.size()
+           << " options: " << options.size();
+    return false;
+  }
+  // 1. detect each frame with its own sensor calibration and merge the
+  // detections into one frame in world coordinates
+  PERCEPTION_PERF_BLOCK_START();
+  base::FramePtr merged_frame_ptr(new base::Frame());
+  for (size_t i = 0; i < radar_frames.size(); ++i) {
+    base::FramePtr detect_frame_ptr(new base::Frame());
+    CHECK(detector_->Detect(radar_frames[i], options[i].detector_options,
+                            detect_frame_ptr))
+        << "radar detect error";
+    ADEBUG << options[i].sensor_name << " detected frame objects number: "
+           << detect_frame_ptr->objects.size();
+    merged_frame_ptr->objects.insert(merged_frame_ptr->objects.end(),
+                                     detect_frame_ptr->objects.begin(),
+                                     detect_frame_ptr->objects.end());
+    merged_frame_ptr->timestamp =
+        std::max(merged_frame_ptr->timestamp, detect_frame_ptr->timestamp);
+    if (i == 0) {
+      merged_frame_ptr->sensor_info = detect_frame_ptr->sensor_info;
+      merged_frame_ptr->sensor2world_pose = detect_frame_ptr->sensor2world_pose;
+    }
+  }
+  PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(options[0].sensor_name,
+                                           "batch_detector");
+  // 2. roi filter once on the merged frame against the shared hdmap query
+  if (!roi_filter_->RoiFilter(options[0].roi_filter_options,
+                              merged_frame_ptr)) {
+    ADEBUG << "All radar objects were filtered out";
+  }
+  ADEBUG << "RoiFiltered merged frame objects number: "
+         << merged_frame_ptr->objects.size();
+  PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(options[0].sensor_name,
+                                           "batch_roi_filter");
+  // 3. track once, so all sensors share one track store
+  base::FramePtr tracker_frame_ptr = std::make_shared<base::Frame>();
+  CHECK(tracker_->Track(*merged_frame_ptr, options[0].track_options,
+                        tracker_frame_ptr))
+      << "radar track error";
+  ADEBUG << "tracked merged frame objects number: "
+         << tracker_frame_ptr->objects.size();
+  PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(options[0].sensor_name,
+                                           "batch_tracker");
+
+  *objects = tracker_frame_ptr->objects;
+
+  return true;
+}
+
+std::string MultiRadarObstaclePerception::Name() const {
+  return "MultiRadarObstaclePerception";
+}
+
+PERCEPTION_REGISTER_RADAR_OBSTACLE_PERCEPTION(MultiRadarObstaclePerception);
+
+}  // namespace radar
+}  // namespace perception
+}  // namespace apollo
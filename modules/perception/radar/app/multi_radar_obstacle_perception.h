@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/perception/radar/lib/interface/base_radar_obstacle_perception.h"
+
+namespace apollo {
+namespace perception {
+namespace radar {
+
+// @brief batch pipeline for several radars with overlapping fields of view:
+//        each frame is detected with its own sensor calibration, detections
+//        are merged into one frame, roi filtering runs once against a shared
+//        hdmap query and a single track store covers all sensors
+class MultiRadarObstaclePerception : public BaseRadarObstaclePerception {
+ public:
+  MultiRadarObstaclePerception() {}
+  virtual ~MultiRadarObstaclePerception() {}
+
+  bool Init(const std::string& pipeline_name) override;
+
+  // @brief single frame entry, kept for api compatibility, equivalent to
+  //        a batch of one
+  bool Perceive(const drivers::ContiRadar& corrected_obstacles,
+                const RadarPerceptionOptions& options,
+                std::vector<base::ObjectPtr>* objects) override;
+
+  // @brief process the same-cycle frames of several radars in one pass.
+  //        per-sensor calibration is applied at ingest through each entry
+  //        of options; the roi of the first entry is used for the merged
+  //        frame and should cover the union field of view
+  bool PerceiveBatch(const std::vector<drivers::ContiRadar>& radar_frames,
+                     const std::vector<RadarPerceptionOptions>& options,
+                     std::vector<base::ObjectPtr>* objects);
+
+  std::string Name() const override;
+
+ private:
+  std::shared_ptr<BaseDetector> detector_;
+  std::shared_ptr<BaseRoiFilter> roi_filter_;
+  std::shared_ptr<BaseTracker> tracker_;
+};
+
+}  // namespace radar
+}  // namespace perception
+}  // namespace apollo
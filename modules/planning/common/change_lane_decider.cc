@@ -178,14 +178,24 @@ bool ChangeLaneDecider::IsClearToChangeLane(
     double start_l = std::numeric_limits<double>::max();
     double end_l = -std::numeric_limits<double>::max();
 
-    for (const auto& p : obstacle->PerceptionPolygon().points()) {
-      SLPoint sl_point;
-      reference_line_info->reference_line().XYToSL({p.x(), p.y()}, &sl_point);
-      start_s = std::fmin(start_s, sl_point.s());
-      end_s = std::fmax(end_s, sl_point.s());
+    const auto& sl_boundary = obstacle->PerceptionSLBoundary();
+    if (sl_boundary.has_start_s()) {
+      // reuse the extents cached when the obstacle joined this reference line
+      start_s = sl_boundary.start_s();
+      end_s = sl_boundary.end_s();
+      start_l = sl_boundary.start_l();
+      end_l = sl_boundary.end_l();
+    } else {
+      for (const auto& p : obstacle->PerceptionPolygon().points()) {
+        SLPoint sl_point;
+        reference_line_info->reference_line().XYToSL({p.x(), p.y()},
+                                                     &sl_point);
+        start_s = std::fmin(start_s, sl_point.s());
+        end_s = std::fmax(end_s, sl_point.s());
 
-      start_l = std::fmin(start_l, sl_point.l());
-      end_l = std::fmax(end_l, sl_point.l());
+        start_l = std::fmin(start_l, sl_point.l());
+        end_l = std::fmax(end_l, sl_point.l());
+      }
     }
 
     if (reference_line_info->IsChangeLanePath()) {
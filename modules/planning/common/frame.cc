@@ -22,6 +22,8 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <string>
+#include <utility>
 
 #include "modules/routing/proto/routing.pb.h"
 
@@ -361,13 +363,12 @@ Status Frame::InitFrameData() {
          << FLAGS_align_prediction_time;
 
   if (FLAGS_align_prediction_time) {
-    auto prediction = *(local_view_.prediction_obstacles);
-    AlignPredictionTime(vehicle_state_.timestamp(), &prediction);
-    local_view_.prediction_obstacles->CopyFrom(prediction);
+    AlignPredictionTime(vehicle_state_.timestamp(),
+                        local_view_.prediction_obstacles.get());
   }
   for (auto &ptr :
        Obstacle::CreateObstacles(*local_view_.prediction_obstacles)) {
-    AddObstacle(*ptr);
+    AddObstacle(std::move(*ptr));
   }
   if (planning_start_point_.v() < 1e-3) {
     const auto *collision_obstacle = FindCollisionObstacle();
@@ -472,6 +473,12 @@ void Frame::AddObstacle(const Obstacle &obstacle) {
   obstacles_.Add(obstacle.Id(), obstacle);
 }
 
+void Frame::AddObstacle(Obstacle &&obstacle) {
+  // the id has to outlive the moved-from obstacle
+  const std::string id = obstacle.Id();
+  obstacles_.Add(id, std::move(obstacle));
+}
+
 void Frame::ReadTrafficLights() {
   traffic_lights_.clear();
 
@@ -191,6 +191,8 @@ class Frame {
 
   void AddObstacle(const Obstacle &obstacle);
 
+  void AddObstacle(Obstacle &&obstacle);
+
   void ReadTrafficLights();
 
  private:
@@ -21,58 +21,71 @@
 #pragma once
 
 #include <memory>
-#include <queue>
-#include <unordered_map>
 #include <utility>
-
-#include "modules/common/util/map_util.h"
+#include <vector>
 
 namespace apollo {
 namespace planning {
 
+/**
+ * A bounded id-indexed history. With a positive capacity the storage is a
+ * preallocated ring whose slots are reused in place, so steady-state Add does
+ * no node allocation or rehashing; the capacity is expected to be small, and
+ * Find is a linear scan over the ring.
+ */
 template <typename I, typename T>
 class IndexedQueue {
  public:
   // Get infinite capacity with 0.
-  explicit IndexedQueue(size_t capacity) : capacity_(capacity) {}
+  explicit IndexedQueue(size_t capacity) : capacity_(capacity) {
+    if (capacity_ > 0) {
+      ring_.reserve(capacity_);
+    }
+  }
 
   const T *Find(const I id) const {
-    auto *result = apollo::common::util::FindOrNull(map_, id);
-    return result ? result->get() : nullptr;
+    for (const auto &item : ring_) {
+      if (item.first == id) {
+        return item.second.get();
+      }
+    }
+    return nullptr;
   }
 
   const T *Latest() const {
-    if (queue_.empty()) {
+    if (ring_.empty()) {
       return nullptr;
     }
-    return Find(queue_.back().first);
+    return ring_[(head_ + ring_.size() - 1) % ring_.size()].second.get();
   }
 
   bool Add(const I id, std::unique_ptr<T> ptr) {
     if (Find(id)) {
       return false;
     }
-    if (capacity_ > 0 && queue_.size() == capacity_) {
-      map_.erase(queue_.front().first);
-      queue_.pop();
+    if (capacity_ > 0 && ring_.size() == capacity_) {
+      // overwrite the oldest slot in place
+      ring_[head_] = std::make_pair(id, std::move(ptr));
+      head_ = (head_ + 1) % capacity_;
+    } else {
+      // still growing towards capacity (or unbounded); head_ stays at the
+      // front, so the newest element is the back of the vector
+      ring_.emplace_back(id, std::move(ptr));
     }
-    queue_.push(std::make_pair(id, ptr.get()));
-    map_[id] = std::move(ptr);
     return true;
   }
 
   void Clear() {
     capacity_ = 0;
-    while (!queue_.empty()) {
-      queue_.pop();
-    }
-    map_.clear();
+    head_ = 0;
+    ring_.clear();
   }
 
  public:
   size_t capacity_ = 0;
-  std::queue<std::pair<I, const T *>> queue_;
-  std::unordered_map<I, std::unique_ptr<T>> map_;
+  // index of the oldest element once the ring is full
+  size_t head_ = 0;
+  std::vector<std::pair<I, std::unique_ptr<T>>> ring_;
 };
 
 }  // namespace planning
@@ -59,5 +59,18 @@ TEST(IndexedQueue, QueueSize2) {
   ASSERT_EQ("three", *object.Latest());
 }
 
+TEST(IndexedQueue, RingWrapAround) {
+  StringIndexedQueue object(2);
+  for (int i = 1; i <= 7; ++i) {
+    ASSERT_TRUE(
+        object.Add(i, std::make_unique<std::string>(std::to_string(i))));
+    ASSERT_EQ(std::to_string(i), *object.Latest());
+  }
+  // only the last two survive after several wrap-arounds
+  ASSERT_TRUE(object.Find(5) == nullptr);
+  ASSERT_TRUE(object.Find(6) != nullptr);
+  ASSERT_TRUE(object.Find(7) != nullptr);
+}
+
 }  // namespace planning
 }  // namespace apollo
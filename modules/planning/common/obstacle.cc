@@ -288,6 +288,26 @@ bool Obstacle::IsValidTrajectoryPoint(const common::TrajectoryPoint& point) {
 
 void Obstacle::SetPerceptionSlBoundary(const SLBoundary& sl_boundary) {
   sl_boundary_ = sl_boundary;
+
+  // Cache the projected hull together with the boundary so that the deciders
+  // reuse one SL projection per obstacle instead of re-projecting corners.
+  std::vector<common::math::Vec2d> sl_points;
+  sl_points.reserve(sl_boundary.boundary_point_size());
+  for (const auto& sl_point : sl_boundary.boundary_point()) {
+    sl_points.emplace_back(sl_point.s(), sl_point.l());
+  }
+  if (sl_points.size() < 3) {
+    // The boundary was computed without the projected corner points; fall
+    // back to the corners of the bounding SL rectangle.
+    sl_points = {{sl_boundary.start_s(), sl_boundary.start_l()},
+                 {sl_boundary.end_s(), sl_boundary.start_l()},
+                 {sl_boundary.end_s(), sl_boundary.end_l()},
+                 {sl_boundary.start_s(), sl_boundary.end_l()}};
+  }
+  if (!common::math::Polygon2d::ComputeConvexHull(sl_points, &sl_polygon_)) {
+    // degenerate projection; leave the polygon empty so callers fall back
+    sl_polygon_ = common::math::Polygon2d();
+  }
 }
 
 double Obstacle::MinRadiusStopDistance(
@@ -690,6 +710,10 @@ const SLBoundary& Obstacle::PerceptionSLBoundary() const {
   return sl_boundary_;
 }
 
+const common::math::Polygon2d& Obstacle::PerceptionSLPolygon() const {
+  return sl_polygon_;
+}
+
 void Obstacle::SetStBoundary(const STBoundary& boundary) {
   st_boundary_ = boundary;
 }
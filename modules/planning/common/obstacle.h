@@ -33,6 +33,7 @@
 #include "modules/prediction/proto/prediction_obstacle.pb.h"
 
 #include "modules/common/math/box2d.h"
+#include "modules/common/math/polygon2d.h"
 #include "modules/common/math/vec2d.h"
 #include "modules/planning/common/indexed_list.h"
 #include "modules/planning/common/speed/st_boundary.h"
@@ -146,6 +147,16 @@ class Obstacle {
 
   const SLBoundary& PerceptionSLBoundary() const;
 
+  /**
+   * @brief The perception polygon projected onto the frenet frame of the
+   * current reference line. It is cached by SetPerceptionSlBoundary so that
+   * the deciders share one projection per obstacle per cycle instead of
+   * re-projecting the corners themselves. For each polygon point, x() is s
+   * and y() is l. The polygon is empty (num_points() == 0) when no valid
+   * projection is available.
+   */
+  const common::math::Polygon2d& PerceptionSLPolygon() const;
+
   const STBoundary& reference_line_st_boundary() const;
 
   const STBoundary& st_boundary() const;
@@ -248,6 +259,7 @@ class Obstacle {
   std::vector<ObjectDecisionType> decisions_;
   std::vector<std::string> decider_tags_;
   SLBoundary sl_boundary_;
+  common::math::Polygon2d sl_polygon_;
 
   STBoundary reference_line_st_boundary_;
   STBoundary st_boundary_;
@@ -102,6 +102,14 @@ DEFINE_double(rtk_trajectory_resolution, 0.01,
 DEFINE_bool(publish_estop, false, "publish estop decision in planning");
 DEFINE_bool(enable_trajectory_stitcher, true, "enable stitching trajectory");
 
+DEFINE_bool(enable_trajectory_delta_publish, false,
+            "Publish differential trajectories between full publications. "
+            "Only enable when every downstream reader of the planning "
+            "channel understands ADCTrajectoryDelta.");
+DEFINE_int32(trajectory_delta_full_publish_interval, 10,
+             "Publish a full trajectory at least every this many cycles so "
+             "receivers that dropped a delta can resynchronize.");
+
 DEFINE_bool(enable_reference_line_stitching, true,
             "Enable stitching reference line, which can reducing computing "
             "time and improve stability");
@@ -312,6 +320,12 @@ DEFINE_bool(
     "Enable multiple thread to calculation curve cost in dp_poly_path.");
 DEFINE_bool(enable_multi_thread_in_dp_st_graph, false,
             "Enable multiple thread to calculation curve cost in dp_st_graph.");
+DEFINE_bool(enable_multi_thread_in_lattice, false,
+            "Enable multiple thread to evaluate trajectory pairs in "
+            "lattice planner.");
+DEFINE_bool(enable_multi_thread_in_piecewise_jerk_path, false,
+            "Enable multiple thread to solve the candidate path boundary "
+            "QPs in piecewise jerk path optimizer.");
 
 /// Lattice Planner
 DEFINE_double(lattice_epsilon, 1e-6, "Epsilon in lattice planner.");
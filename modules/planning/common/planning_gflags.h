@@ -67,6 +67,8 @@ DECLARE_double(max_collision_distance);
 DECLARE_bool(ignore_overlapped_obstacle);
 DECLARE_bool(publish_estop);
 DECLARE_bool(enable_trajectory_stitcher);
+DECLARE_bool(enable_trajectory_delta_publish);
+DECLARE_int32(trajectory_delta_full_publish_interval);
 
 DECLARE_int32(max_history_frame_num);
 
@@ -156,6 +158,8 @@ DECLARE_uint32(max_planning_thread_pool_size);
 DECLARE_bool(use_multi_thread_to_add_obstacles);
 DECLARE_bool(enable_multi_thread_in_dp_poly_path);
 DECLARE_bool(enable_multi_thread_in_dp_st_graph);
+DECLARE_bool(enable_multi_thread_in_lattice);
+DECLARE_bool(enable_multi_thread_in_piecewise_jerk_path);
 
 // lattice planner
 DECLARE_double(lattice_epsilon);
@@ -86,6 +86,8 @@ bool ReferenceLineInfo::Init(const std::vector<const Obstacle*>& obstacles) {
 
   InitFirstOverlaps();
 
+  InitOverlapIndex();
+
   if (sl_boundary_info_.adc_sl_boundary_.end_s() < 0 ||
       sl_boundary_info_.adc_sl_boundary_.start_s() > reference_line_.Length()) {
     AWARN << "Vehicle SL "
@@ -281,6 +283,50 @@ void ReferenceLineInfo::InitFirstOverlaps() {
   }
 }
 
+void ReferenceLineInfo::InitOverlapIndex() {
+  const auto& map_path = reference_line_.map_path();
+  overlap_index_.clear();
+  const auto append = [this](const OverlapType type,
+                             const std::vector<hdmap::PathOverlap>& overlaps) {
+    for (const auto& overlap : overlaps) {
+      overlap_index_.emplace_back(type, &overlap);
+    }
+  };
+  append(CLEAR_AREA, map_path.clear_area_overlaps());
+  append(CROSSWALK, map_path.crosswalk_overlaps());
+  append(PNC_JUNCTION, map_path.pnc_junction_overlaps());
+  append(SIGNAL, map_path.signal_overlaps());
+  append(SPEED_BUMP, map_path.speed_bump_overlaps());
+  append(STOP_SIGN, map_path.stop_sign_overlaps());
+  append(YIELD_SIGN, map_path.yield_sign_overlaps());
+
+  std::sort(overlap_index_.begin(), overlap_index_.end(),
+            [](const std::pair<OverlapType, const hdmap::PathOverlap*>& a,
+               const std::pair<OverlapType, const hdmap::PathOverlap*>& b) {
+              return a.second->start_s < b.second->start_s;
+            });
+}
+
+void ReferenceLineInfo::GetOverlapsWithinRange(
+    const OverlapType type, const double start_s, const double end_s,
+    std::vector<const hdmap::PathOverlap*>* const overlaps) const {
+  CHECK_NOTNULL(overlaps);
+  overlaps->clear();
+  // entries are sorted by overlap start_s, so everything past end_s is
+  // outside the window regardless of type
+  const auto upper = std::upper_bound(
+      overlap_index_.begin(), overlap_index_.end(), end_s,
+      [](const double s,
+         const std::pair<OverlapType, const hdmap::PathOverlap*>& item) {
+        return s < item.second->start_s;
+      });
+  for (auto it = overlap_index_.begin(); it != upper; ++it) {
+    if (it->first == type && it->second->end_s >= start_s) {
+      overlaps->push_back(it->second);
+    }
+  }
+}
+
 bool WithinOverlap(const hdmap::PathOverlap& overlap, double s) {
   constexpr double kEpsilon = 1e-2;
   return overlap.start_s - kEpsilon <= s && s <= overlap.end_s + kEpsilon;
@@ -215,6 +215,7 @@ class ReferenceLineInfo {
     SIGNAL = 5,
     STOP_SIGN = 6,
     YIELD_SIGN = 7,
+    SPEED_BUMP = 8,
   };
 
   const std::vector<std::pair<OverlapType, hdmap::PathOverlap>>&
@@ -222,12 +223,24 @@ class ReferenceLineInfo {
     return first_encounter_overlaps_;
   }
 
+  /**
+   * @brief Get all overlaps of the given type whose [start_s, end_s] range
+   * intersects [start_s, end_s], in increasing start_s order. Backed by a
+   * per-cycle index sorted by s, so traffic rules only walk the overlaps
+   * inside their own horizon window instead of the whole reference line.
+   */
+  void GetOverlapsWithinRange(
+      const OverlapType type, const double start_s, const double end_s,
+      std::vector<const hdmap::PathOverlap*>* const overlaps) const;
+
   int GetPnCJunction(const double s,
                      hdmap::PathOverlap* pnc_junction_overlap) const;
 
  private:
   void InitFirstOverlaps();
 
+  void InitOverlapIndex();
+
   bool CheckChangeLane() const;
 
   void ExportTurnSignal(common::VehicleSignal* signal) const;
@@ -316,6 +329,14 @@ class ReferenceLineInfo {
   std::vector<std::pair<OverlapType, hdmap::PathOverlap>>
       first_encounter_overlaps_;
 
+  /**
+   * All overlaps along the reference line sorted by start_s, tagged with
+   * their type; shared by the traffic rules through GetOverlapsWithinRange.
+   * The pointers reference the overlap storage inside the map path.
+   */
+  std::vector<std::pair<OverlapType, const hdmap::PathOverlap*>>
+      overlap_index_;
+
   /**
    * @brief Data generated by speed_bounds_decider for constructing st_graph for
    * different st optimizer
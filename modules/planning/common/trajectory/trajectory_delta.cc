@@ -0,0 +1,156 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file trajectory_delta.cc
+ **/
+
+#include "modules/planning/common/trajectory/trajectory_delta.h"
+
+#include <cmath>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace planning {
+namespace {
+
+// Stitching copies points verbatim, so matching only needs to absorb floating
+// point noise, not real geometric differences.
+constexpr double kMatchEpsilon = 1e-6;
+
+// Publishing a delta only pays off when the reused run saves a meaningful
+// share of the point list.
+constexpr int kMinReusedPointNum = 10;
+
+bool PointsMatch(const common::TrajectoryPoint& base_point,
+                 const common::TrajectoryPoint& point,
+                 const double time_shift, const double s_shift) {
+  return std::fabs(base_point.path_point().x() - point.path_point().x()) <
+             kMatchEpsilon &&
+         std::fabs(base_point.path_point().y() - point.path_point().y()) <
+             kMatchEpsilon &&
+         std::fabs(base_point.path_point().s() - s_shift -
+                   point.path_point().s()) < kMatchEpsilon &&
+         std::fabs(base_point.relative_time() - time_shift -
+                   point.relative_time()) < kMatchEpsilon &&
+         std::fabs(base_point.v() - point.v()) < kMatchEpsilon &&
+         std::fabs(base_point.a() - point.a()) < kMatchEpsilon;
+}
+
+}  // namespace
+
+bool TrajectoryDelta::Encode(const ADCTrajectory& base,
+                             const ADCTrajectory& current,
+                             ADCTrajectoryDelta* delta) {
+  CHECK_NOTNULL(delta);
+  if (base.trajectory_point_size() == 0 ||
+      current.trajectory_point_size() < kMinReusedPointNum) {
+    return false;
+  }
+  if (current.is_replan()) {
+    // A replan starts from the vehicle state, not from the previous
+    // trajectory; there is nothing to reuse.
+    return false;
+  }
+
+  // Locate the head of the current trajectory inside the base points. The
+  // stitched prefix starts somewhere behind the base's head because the
+  // vehicle has moved on since the base was published.
+  const auto& head = current.trajectory_point(0);
+  int base_index = -1;
+  double time_shift = 0.0;
+  double s_shift = 0.0;
+  for (int i = 0; i < base.trajectory_point_size(); ++i) {
+    const auto& candidate = base.trajectory_point(i);
+    if (std::fabs(candidate.path_point().x() - head.path_point().x()) <
+            kMatchEpsilon &&
+        std::fabs(candidate.path_point().y() - head.path_point().y()) <
+            kMatchEpsilon &&
+        std::fabs(candidate.v() - head.v()) < kMatchEpsilon) {
+      base_index = i;
+      time_shift = candidate.relative_time() - head.relative_time();
+      s_shift = candidate.path_point().s() - head.path_point().s();
+      break;
+    }
+  }
+  if (base_index < 0) {
+    return false;
+  }
+
+  int reused_num = 0;
+  while (base_index + reused_num < base.trajectory_point_size() &&
+         reused_num < current.trajectory_point_size() &&
+         PointsMatch(base.trajectory_point(base_index + reused_num),
+                     current.trajectory_point(reused_num), time_shift,
+                     s_shift)) {
+    ++reused_num;
+  }
+  if (reused_num < kMinReusedPointNum) {
+    return false;
+  }
+
+  delta->Clear();
+  delta->mutable_header()->CopyFrom(current.header());
+  delta->set_base_sequence_num(base.header().sequence_num());
+  delta->set_base_point_index(base_index);
+  delta->set_reused_point_num(reused_num);
+  delta->set_time_shift(time_shift);
+  delta->set_s_shift(s_shift);
+  delta->mutable_trajectory()->CopyFrom(current);
+  delta->mutable_trajectory()->mutable_trajectory_point()->DeleteSubrange(
+      0, reused_num);
+  return true;
+}
+
+bool TrajectoryDelta::Decode(const ADCTrajectory& base,
+                             const ADCTrajectoryDelta& delta,
+                             ADCTrajectory* trajectory) {
+  CHECK_NOTNULL(trajectory);
+  if (delta.base_sequence_num() != base.header().sequence_num()) {
+    AWARN << "Trajectory delta is based on sequence "
+          << delta.base_sequence_num() << " but the receiver holds sequence "
+          << base.header().sequence_num();
+    return false;
+  }
+  const int base_index = delta.base_point_index();
+  const int reused_num = delta.reused_point_num();
+  if (base_index + reused_num > base.trajectory_point_size()) {
+    AWARN << "Trajectory delta reuses points [" << base_index << ", "
+          << base_index + reused_num << ") but base only has "
+          << base.trajectory_point_size() << " points";
+    return false;
+  }
+
+  trajectory->CopyFrom(delta.trajectory());
+  google::protobuf::RepeatedPtrField<common::TrajectoryPoint> points;
+  points.Reserve(reused_num + trajectory->trajectory_point_size());
+  for (int i = 0; i < reused_num; ++i) {
+    auto* point = points.Add();
+    point->CopyFrom(base.trajectory_point(base_index + i));
+    point->set_relative_time(point->relative_time() - delta.time_shift());
+    point->mutable_path_point()->set_s(point->path_point().s() -
+                                       delta.s_shift());
+  }
+  for (auto& point : *trajectory->mutable_trajectory_point()) {
+    points.Add()->Swap(&point);
+  }
+  trajectory->mutable_trajectory_point()->Swap(&points);
+  return true;
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file trajectory_delta.h
+ **/
+
+#pragma once
+
+#include "modules/planning/proto/planning.pb.h"
+#include "modules/planning/proto/trajectory_delta.pb.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class TrajectoryDelta
+ * @brief Codec for differential trajectory publication. Consecutive planning
+ * cycles share the stitched prefix of their trajectory points, so a cycle can
+ * be published as an ADCTrajectoryDelta against the previous cycle and
+ * rebuilt by the receiver. Both sides only exchange the points that changed.
+ */
+class TrajectoryDelta {
+ public:
+  TrajectoryDelta() = delete;
+
+  /**
+   * @brief Encode `current` as a delta against `base`. The reused run is
+   * found by matching the head of `current` inside the points of `base`
+   * under a constant time/s shift, which is exactly what trajectory
+   * stitching produces.
+   * @return false when no run long enough to be worth publishing
+   * differentially exists, e.g. after a replan; the caller should then
+   * publish the full trajectory.
+   */
+  static bool Encode(const ADCTrajectory& base, const ADCTrajectory& current,
+                     ADCTrajectoryDelta* delta);
+
+  /**
+   * @brief Rebuild the full trajectory from `base` and `delta`.
+   * @return false when the delta was computed against a different base
+   * message, e.g. after the receiver dropped a cycle; the caller should keep
+   * its last trajectory and wait for the next full publication.
+   */
+  static bool Decode(const ADCTrajectory& base, const ADCTrajectoryDelta& delta,
+                     ADCTrajectory* trajectory);
+};
+
+}  // namespace planning
+}  // namespace apollo
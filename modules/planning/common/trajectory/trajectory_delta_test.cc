@@ -0,0 +1,112 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/common/trajectory/trajectory_delta.h"
+
+#include "cyber/common/file.h"
+#include "gtest/gtest.h"
+
+#include "modules/common/util/util.h"
+
+namespace apollo {
+namespace planning {
+
+namespace {
+
+// Build the trajectory of the next cycle by dropping the first `shift` points
+// of `base` and re-basing relative_time and s, the way stitching does, then
+// appending `appended` fresh points at the tail.
+ADCTrajectory MakeNextCycle(const ADCTrajectory& base, const int shift,
+                            const int appended) {
+  ADCTrajectory next = base;
+  next.mutable_trajectory_point()->DeleteSubrange(0, shift);
+  const double time_shift = next.trajectory_point(0).relative_time();
+  const double s_shift = next.trajectory_point(0).path_point().s();
+  for (auto& point : *next.mutable_trajectory_point()) {
+    point.set_relative_time(point.relative_time() - time_shift);
+    point.mutable_path_point()->set_s(point.path_point().s() - s_shift);
+  }
+  auto last = next.trajectory_point(next.trajectory_point_size() - 1);
+  for (int i = 0; i < appended; ++i) {
+    auto* point = next.add_trajectory_point();
+    point->CopyFrom(last);
+    point->set_relative_time(last.relative_time() + 0.1 * (i + 1));
+    point->mutable_path_point()->set_s(last.path_point().s() + 1.0 * (i + 1));
+    point->mutable_path_point()->set_x(last.path_point().x() + 1.0 * (i + 1));
+  }
+  next.mutable_header()->set_sequence_num(base.header().sequence_num() + 1);
+  return next;
+}
+
+}  // namespace
+
+TEST(TrajectoryDeltaTest, EncodeDecodeRoundTrip) {
+  const std::string path_of_standard_trajectory =
+      "modules/planning/testdata/trajectory_data/standard_trajectory.pb.txt";
+  ADCTrajectory base;
+  EXPECT_TRUE(
+      cyber::common::GetProtoFromFile(path_of_standard_trajectory, &base));
+  base.mutable_header()->set_sequence_num(7);
+
+  const ADCTrajectory current = MakeNextCycle(base, 3, 5);
+
+  ADCTrajectoryDelta delta;
+  ASSERT_TRUE(TrajectoryDelta::Encode(base, current, &delta));
+  EXPECT_EQ(delta.base_sequence_num(), 7);
+  EXPECT_EQ(delta.base_point_index(), 3);
+  EXPECT_EQ(delta.reused_point_num(), base.trajectory_point_size() - 3);
+  EXPECT_EQ(delta.trajectory().trajectory_point_size(), 5);
+
+  ADCTrajectory rebuilt;
+  ASSERT_TRUE(TrajectoryDelta::Decode(base, delta, &rebuilt));
+  ASSERT_EQ(rebuilt.trajectory_point_size(), current.trajectory_point_size());
+  for (int i = 0; i < current.trajectory_point_size(); ++i) {
+    EXPECT_NEAR(rebuilt.trajectory_point(i).relative_time(),
+                current.trajectory_point(i).relative_time(), 1e-9);
+    EXPECT_NEAR(rebuilt.trajectory_point(i).path_point().s(),
+                current.trajectory_point(i).path_point().s(), 1e-9);
+    EXPECT_NEAR(rebuilt.trajectory_point(i).path_point().x(),
+                current.trajectory_point(i).path_point().x(), 1e-9);
+  }
+}
+
+TEST(TrajectoryDeltaTest, RejectsReplanAndStaleBase) {
+  const std::string path_of_standard_trajectory =
+      "modules/planning/testdata/trajectory_data/standard_trajectory.pb.txt";
+  ADCTrajectory base;
+  EXPECT_TRUE(
+      cyber::common::GetProtoFromFile(path_of_standard_trajectory, &base));
+  base.mutable_header()->set_sequence_num(7);
+
+  ADCTrajectory replanned = MakeNextCycle(base, 3, 5);
+  replanned.set_is_replan(true);
+  ADCTrajectoryDelta delta;
+  EXPECT_FALSE(TrajectoryDelta::Encode(base, replanned, &delta));
+
+  const ADCTrajectory current = MakeNextCycle(base, 3, 5);
+  ASSERT_TRUE(TrajectoryDelta::Encode(base, current, &delta));
+  ADCTrajectory wrong_base = base;
+  wrong_base.mutable_header()->set_sequence_num(8);
+  ADCTrajectory rebuilt;
+  EXPECT_FALSE(TrajectoryDelta::Decode(wrong_base, delta, &rebuilt));
+}
+
+}  // namespace planning
+}  // namespace apollo
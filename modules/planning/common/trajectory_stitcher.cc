@@ -159,7 +159,7 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
     return ComputeReinitStitchingTrajectory(planning_cycle_time, vehicle_state);
   }
 
-  auto time_matched_point = prev_trajectory->TrajectoryPointAt(
+  const auto& time_matched_point = prev_trajectory->TrajectoryPointAt(
       static_cast<uint32_t>(time_matched_index));
 
   if (!time_matched_point.has_path_point()) {
@@ -202,10 +202,7 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
   }
 
   double forward_rel_time =
-      prev_trajectory
-          ->TrajectoryPointAt(static_cast<uint32_t>(time_matched_index))
-          .relative_time() +
-      planning_cycle_time;
+      time_matched_point.relative_time() + planning_cycle_time;
 
   size_t forward_time_index =
       prev_trajectory->QueryLowerBoundPoint(forward_rel_time);
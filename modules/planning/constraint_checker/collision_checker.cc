@@ -35,7 +35,6 @@ namespace planning {
 using apollo::common::PathPoint;
 using apollo::common::TrajectoryPoint;
 using apollo::common::math::Box2d;
-using apollo::common::math::PathMatcher;
 using apollo::common::math::Vec2d;
 
 CollisionChecker::CollisionChecker(
@@ -119,6 +118,11 @@ void CollisionChecker::BuildPredictedEnvironment(
     const std::vector<PathPoint>& discretized_reference_line) {
   CHECK(predicted_bounding_rectangles_.empty());
 
+  // One matcher for every obstacle of this frame, instead of a linear scan
+  // of the reference line per obstacle.
+  const common::math::IndexedPathMatcher reference_line_matcher(
+      discretized_reference_line);
+
   // If the ego vehicle is in lane,
   // then, ignore all obstacles from the same lane.
   bool ego_vehicle_in_lane = IsEgoVehicleInLane(ego_vehicle_s, ego_vehicle_d);
@@ -129,7 +133,7 @@ void CollisionChecker::BuildPredictedEnvironment(
     }
     if (ego_vehicle_in_lane &&
         (IsObstacleBehindEgoVehicle(obstacle, ego_vehicle_s,
-                                    discretized_reference_line) ||
+                                    reference_line_matcher) ||
          !ptr_path_time_graph_->IsObstacleInGraph(obstacle->Id()))) {
       continue;
     }
@@ -165,12 +169,12 @@ bool CollisionChecker::IsEgoVehicleInLane(const double ego_vehicle_s,
 
 bool CollisionChecker::IsObstacleBehindEgoVehicle(
     const Obstacle* obstacle, const double ego_vehicle_s,
-    const std::vector<PathPoint>& discretized_reference_line) {
+    const common::math::IndexedPathMatcher& reference_line_matcher) {
   double half_lane_width = FLAGS_default_reference_line_width * 0.5;
   TrajectoryPoint point = obstacle->GetPointAtTime(0.0);
-  auto obstacle_reference_line_position = PathMatcher::GetPathFrenetCoordinate(
-      discretized_reference_line, point.path_point().x(),
-      point.path_point().y());
+  auto obstacle_reference_line_position =
+      reference_line_matcher.GetPathFrenetCoordinate(point.path_point().x(),
+                                                     point.path_point().y());
 
   if (obstacle_reference_line_position.first < ego_vehicle_s &&
       std::fabs(obstacle_reference_line_position.second) < half_lane_width) {
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "modules/common/math/box2d.h"
+#include "modules/common/math/path_matcher.h"
 #include "modules/planning/common/obstacle.h"
 #include "modules/planning/common/reference_line_info.h"
 #include "modules/planning/common/trajectory/discretized_trajectory.h"
@@ -59,7 +60,7 @@ class CollisionChecker {
 
   bool IsObstacleBehindEgoVehicle(
       const Obstacle* obstacle, const double ego_vehicle_s,
-      const std::vector<apollo::common::PathPoint>& discretized_reference_line);
+      const common::math::IndexedPathMatcher& reference_line_matcher);
 
  private:
   const ReferenceLineInfo* ptr_reference_line_info_;
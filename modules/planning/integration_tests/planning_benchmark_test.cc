@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/time/time.h"
+#include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/integration_tests/planning_test_base.h"
+
+namespace apollo {
+namespace planning {
+
+DECLARE_string(test_routing_response_file);
+DECLARE_string(test_localization_file);
+DECLARE_string(test_chassis_file);
+
+/**
+ * @class PlanningBenchmarkTest
+ * @brief This is a deterministic replay benchmark: it runs recorded scenario
+ * inputs through RunOnce in a tight loop and fails when the p99 cycle time
+ * exceeds the per-scenario budget. Per-task latency breakdowns are reported
+ * through the log.
+ */
+class PlanningBenchmarkTest : public PlanningTestBase {
+ public:
+  virtual void SetUp() {
+    FLAGS_use_multi_thread_to_add_obstacles = false;
+    FLAGS_enable_multi_thread_in_dp_poly_path = false;
+    FLAGS_enable_multi_thread_in_dp_st_graph = false;
+    FLAGS_use_navigation_mode = false;
+    FLAGS_map_dir = "modules/planning/testdata/garage_map";
+    FLAGS_base_map_filename = "base_map.txt";
+    FLAGS_test_data_dir = "modules/planning/testdata/garage_test";
+    FLAGS_planning_upper_speed_limit = 12.5;
+    FLAGS_test_routing_response_file = "garage_routing.pb.txt";
+    FLAGS_test_previous_planning_file = "";
+    FLAGS_test_prediction_file = "";
+    FLAGS_test_localization_file = "";
+    FLAGS_test_chassis_file = "";
+    FLAGS_enable_lag_prediction = false;
+    FLAGS_enable_rss_info = false;
+
+    FLAGS_enable_scenario_side_pass = false;
+    FLAGS_enable_scenario_stop_sign = false;
+    FLAGS_enable_scenario_traffic_light = false;
+  }
+};
+
+/*
+ * benchmark a cycle with a blocking obstacle ahead; the budget is one
+ * planning cycle at the 10 Hz loop rate
+ */
+TEST_F(PlanningBenchmarkTest, stop_obstacle_cycle_time) {
+  FLAGS_test_prediction_file = "stop_obstacle_prediction.pb.txt";
+  FLAGS_test_localization_file = "stop_obstacle_localization.pb.txt";
+  FLAGS_test_chassis_file = "stop_obstacle_chassis.pb.txt";
+
+  PlanningTestBase::SetUp();
+
+  RUN_BENCHMARK_TEST(100.0);
+}
+
+/*
+ * benchmark a follow cycle with a moving head vehicle
+ */
+TEST_F(PlanningBenchmarkTest, follow_cycle_time) {
+  FLAGS_test_prediction_file = "follow_prediction.pb.txt";
+  FLAGS_test_localization_file = "follow_localization.pb.txt";
+  FLAGS_test_chassis_file = "follow_chassis.pb.txt";
+
+  PlanningTestBase::SetUp();
+
+  RUN_BENCHMARK_TEST(100.0);
+}
+
+}  // namespace planning
+}  // namespace apollo
+
+TMAIN;
@@ -16,6 +16,12 @@
 
 #include "modules/planning/integration_tests/planning_test_base.h"
 
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <vector>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 
@@ -48,6 +54,10 @@ DEFINE_string(test_traffic_light_file, "", "The traffic light test file");
 DEFINE_string(test_relative_map_file, "", "The relative map test file");
 DEFINE_string(test_previous_planning_file, "",
               "The previous planning test file");
+DEFINE_int32(test_benchmark_iterations, 50,
+             "Number of measured planning cycles in a benchmark replay");
+DEFINE_int32(test_benchmark_warmup_iterations, 5,
+             "Number of unmeasured warm-up cycles before a benchmark replay");
 
 void PlanningTestBase::SetUpTestCase() {
   FLAGS_use_multi_thread_to_add_obstacles = false;
@@ -270,6 +280,67 @@ bool PlanningTestBase::RunPlanning(const std::string& test_case_name,
   return true;
 }
 
+bool PlanningTestBase::RunPlanningBenchmark(const std::string& test_case_name,
+                                            const double cycle_time_budget_ms) {
+  const int warmup_iterations = FLAGS_test_benchmark_warmup_iterations;
+  const int iterations = FLAGS_test_benchmark_iterations;
+  if (iterations <= 0) {
+    AERROR << "FLAGS_test_benchmark_iterations must be positive";
+    return false;
+  }
+
+  std::vector<double> cycle_times_ms;
+  cycle_times_ms.reserve(iterations);
+  // task name -> (accumulated time_ms, max time_ms)
+  std::map<std::string, std::pair<double, double>> task_latency_ms;
+
+  for (int i = 0; i < warmup_iterations + iterations; ++i) {
+    // re-feed the recorded inputs so every cycle replays the same scenario
+    UpdateData();
+    ADCTrajectory adc_trajectory_pb;
+    const auto start_time = std::chrono::steady_clock::now();
+    planning_->RunOnce(local_view_, &adc_trajectory_pb);
+    const auto end_time = std::chrono::steady_clock::now();
+    if (i < warmup_iterations) {
+      continue;
+    }
+    cycle_times_ms.push_back(
+        std::chrono::duration<double, std::milli>(end_time - start_time)
+            .count());
+    for (const auto& task_stat :
+         adc_trajectory_pb.latency_stats().task_stats()) {
+      auto& latency = task_latency_ms[task_stat.name()];
+      latency.first += task_stat.time_ms();
+      latency.second = std::max(latency.second, task_stat.time_ms());
+    }
+  }
+
+  std::sort(cycle_times_ms.begin(), cycle_times_ms.end());
+  const double total_time_ms =
+      std::accumulate(cycle_times_ms.begin(), cycle_times_ms.end(), 0.0);
+  const double mean_ms = total_time_ms / cycle_times_ms.size();
+  const size_t p99_index = (cycle_times_ms.size() - 1) * 99 / 100;
+  const double p99_ms = cycle_times_ms[p99_index];
+
+  AINFO << "Benchmark [" << test_case_name << "] cycles: "
+        << cycle_times_ms.size() << ", mean: " << mean_ms
+        << " ms, p99: " << p99_ms << " ms, max: " << cycle_times_ms.back()
+        << " ms";
+  for (const auto& task_latency : task_latency_ms) {
+    AINFO << "Benchmark [" << test_case_name
+          << "] task: " << task_latency.first
+          << ", mean: " << task_latency.second.first / cycle_times_ms.size()
+          << " ms, max: " << task_latency.second.second << " ms";
+  }
+
+  if (p99_ms > cycle_time_budget_ms) {
+    AERROR << "Benchmark [" << test_case_name << "] p99 cycle time " << p99_ms
+           << " ms exceeds budget " << cycle_time_budget_ms << " ms";
+    return false;
+  }
+  return true;
+}
+
 bool PlanningTestBase::IsValidTrajectory(const ADCTrajectory& trajectory) {
   for (int i = 0; i < trajectory.trajectory_point_size(); ++i) {
     const auto& point = trajectory.trajectory_point(i);
@@ -50,6 +50,15 @@ namespace planning {
     EXPECT_TRUE(run_planning_success);                                     \
   }
 
+#define RUN_BENCHMARK_TEST(cycle_time_budget_ms)                       \
+  {                                                                    \
+    const ::testing::TestInfo* const test_info =                       \
+        ::testing::UnitTest::GetInstance()->current_test_info();       \
+    bool run_benchmark_success =                                       \
+        RunPlanningBenchmark(test_info->name(), cycle_time_budget_ms); \
+    EXPECT_TRUE(run_benchmark_success);                                \
+  }
+
 #define TMAIN                                            \
   int main(int argc, char** argv) {                      \
     ::apollo::cyber::Init("planning_test");              \
@@ -70,6 +79,8 @@ DECLARE_string(test_prediction_file);
 DECLARE_string(test_traffic_light_file);
 DECLARE_string(test_relative_map_file);
 DECLARE_string(test_previous_planning_file);
+DECLARE_int32(test_benchmark_iterations);
+DECLARE_int32(test_benchmark_warmup_iterations);
 
 class PlanningTestBase : public ::testing::Test {
  public:
@@ -85,6 +96,15 @@ class PlanningTestBase : public ::testing::Test {
   bool RunPlanning(const std::string& test_case_name, int case_num,
                    bool no_trajectory_point);
 
+  /**
+   * Replay the loaded scenario inputs through RunOnce in a tight loop and
+   * check the p99 cycle time against the given per-scenario budget.
+   * Per-task latency breakdowns are reported through the log.
+   * @return true if the p99 cycle time is within the budget.
+   */
+  bool RunPlanningBenchmark(const std::string& test_case_name,
+                            const double cycle_time_budget_ms);
+
   TrafficRuleConfig* GetTrafficRuleConfig(
       const TrafficRuleConfig::RuleId& rule_id);
 
@@ -37,7 +37,6 @@ using apollo::common::PathPoint;
 using apollo::common::TrajectoryPoint;
 using apollo::common::math::Box2d;
 using apollo::common::math::lerp;
-using apollo::common::math::PathMatcher;
 using apollo::common::math::Polygon2d;
 
 PathTimeGraph::PathTimeGraph(
@@ -45,7 +44,8 @@ PathTimeGraph::PathTimeGraph(
     const std::vector<PathPoint>& discretized_ref_points,
     const ReferenceLineInfo* ptr_reference_line_info, const double s_start,
     const double s_end, const double t_start, const double t_end,
-    const std::array<double, 3>& init_d) {
+    const std::array<double, 3>& init_d)
+    : ref_point_matcher_(discretized_ref_points) {
   CHECK_LT(s_start, s_end);
   CHECK_LT(t_start, t_end);
   path_range_.first = s_start;
@@ -55,20 +55,22 @@ PathTimeGraph::PathTimeGraph(
   ptr_reference_line_info_ = ptr_reference_line_info;
   init_d_ = init_d;
 
-  SetupObstacles(obstacles, discretized_ref_points);
+  SetupObstacles(obstacles);
 }
 
 SLBoundary PathTimeGraph::ComputeObstacleBoundary(
-    const std::vector<common::math::Vec2d>& vertices,
-    const std::vector<PathPoint>& discretized_ref_points) const {
+    const std::vector<common::math::Vec2d>& vertices) const {
   double start_s(std::numeric_limits<double>::max());
   double end_s(std::numeric_limits<double>::lowest());
   double start_l(std::numeric_limits<double>::max());
   double end_l(std::numeric_limits<double>::lowest());
 
+  // The vertices of one obstacle are close together, so after the first
+  // vertex every lookup reuses the previous match as a hint.
+  int index_hint = -1;
   for (const auto& point : vertices) {
-    auto sl_point = PathMatcher::GetPathFrenetCoordinate(discretized_ref_points,
-                                                         point.x(), point.y());
+    auto sl_point = ref_point_matcher_.GetPathFrenetCoordinate(
+        point.x(), point.y(), &index_hint);
     start_s = std::fmin(start_s, sl_point.first);
     end_s = std::fmax(end_s, sl_point.first);
     start_l = std::fmin(start_l, sl_point.second);
@@ -85,16 +87,15 @@ SLBoundary PathTimeGraph::ComputeObstacleBoundary(
 }
 
 void PathTimeGraph::SetupObstacles(
-    const std::vector<const Obstacle*>& obstacles,
-    const std::vector<PathPoint>& discretized_ref_points) {
+    const std::vector<const Obstacle*>& obstacles) {
   for (const Obstacle* obstacle : obstacles) {
     if (obstacle->IsVirtual()) {
       continue;
     }
     if (!obstacle->HasTrajectory()) {
-      SetStaticObstacle(obstacle, discretized_ref_points);
+      SetStaticObstacle(obstacle);
     } else {
-      SetDynamicObstacle(obstacle, discretized_ref_points);
+      SetDynamicObstacle(obstacle);
     }
   }
 
@@ -108,14 +109,11 @@ void PathTimeGraph::SetupObstacles(
   }
 }
 
-void PathTimeGraph::SetStaticObstacle(
-    const Obstacle* obstacle,
-    const std::vector<PathPoint>& discretized_ref_points) {
+void PathTimeGraph::SetStaticObstacle(const Obstacle* obstacle) {
   const Polygon2d& polygon = obstacle->PerceptionPolygon();
 
   std::string obstacle_id = obstacle->Id();
-  SLBoundary sl_boundary =
-      ComputeObstacleBoundary(polygon.GetAllVertices(), discretized_ref_points);
+  SLBoundary sl_boundary = ComputeObstacleBoundary(polygon.GetAllVertices());
 
   double left_width = FLAGS_default_reference_line_width * 0.5;
   double right_width = FLAGS_default_reference_line_width * 0.5;
@@ -146,15 +144,12 @@ void PathTimeGraph::SetStaticObstacle(
          << ", end_l : " << sl_boundary.end_l();
 }
 
-void PathTimeGraph::SetDynamicObstacle(
-    const Obstacle* obstacle,
-    const std::vector<PathPoint>& discretized_ref_points) {
+void PathTimeGraph::SetDynamicObstacle(const Obstacle* obstacle) {
   double relative_time = time_range_.first;
   while (relative_time < time_range_.second) {
     TrajectoryPoint point = obstacle->GetPointAtTime(relative_time);
     Box2d box = obstacle->GetBoundingBox(point);
-    SLBoundary sl_boundary =
-        ComputeObstacleBoundary(box.GetAllCorners(), discretized_ref_points);
+    SLBoundary sl_boundary = ComputeObstacleBoundary(box.GetAllCorners());
 
     double left_width = FLAGS_default_reference_line_width * 0.5;
     double right_width = FLAGS_default_reference_line_width * 0.5;
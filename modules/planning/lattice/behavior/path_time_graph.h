@@ -27,6 +27,7 @@
 
 #include "modules/common/proto/geometry.pb.h"
 
+#include "modules/common/math/path_matcher.h"
 #include "modules/common/math/polygon2d.h"
 #include "modules/planning/common/frame.h"
 #include "modules/planning/common/obstacle.h"
@@ -72,24 +73,17 @@ class PathTimeGraph {
       const double s_start, const double s_end, const double s_resolution);
 
  private:
-  void SetupObstacles(
-      const std::vector<const Obstacle*>& obstacles,
-      const std::vector<common::PathPoint>& discretized_ref_points);
+  void SetupObstacles(const std::vector<const Obstacle*>& obstacles);
 
   SLBoundary ComputeObstacleBoundary(
-      const std::vector<common::math::Vec2d>& vertices,
-      const std::vector<common::PathPoint>& discretized_ref_points) const;
+      const std::vector<common::math::Vec2d>& vertices) const;
 
   STPoint SetPathTimePoint(const std::string& obstacle_id, const double s,
                            const double t) const;
 
-  void SetStaticObstacle(
-      const Obstacle* obstacle,
-      const std::vector<common::PathPoint>& discretized_ref_points);
+  void SetStaticObstacle(const Obstacle* obstacle);
 
-  void SetDynamicObstacle(
-      const Obstacle* obstacle,
-      const std::vector<common::PathPoint>& discretized_ref_points);
+  void SetDynamicObstacle(const Obstacle* obstacle);
 
   void UpdateLateralBoundsByObstacle(
       const SLBoundary& sl_boundary,
@@ -101,6 +95,10 @@ class PathTimeGraph {
   std::pair<double, double> path_range_;
   const ReferenceLineInfo* ptr_reference_line_info_;
   std::array<double, 3> init_d_;
+  // built once from the discretized reference points; every obstacle
+  // boundary computation of this graph queries it instead of scanning the
+  // reference line
+  common::math::IndexedPathMatcher ref_point_matcher_;
 
   std::unordered_map<std::string, STBoundary> path_time_obstacle_map_;
   std::vector<STBoundary> path_time_obstacles_;
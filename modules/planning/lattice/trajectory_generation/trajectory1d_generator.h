@@ -98,10 +98,12 @@ inline void Trajectory1dGenerator::GenerateTrajectory1DBundle<4>(
 
   ptr_trajectory_bundle->reserve(end_conditions.size());
   for (const auto& end_condition : end_conditions) {
-    auto ptr_trajectory1d = std::make_shared<LatticeTrajectory1d>(
-        std::shared_ptr<Curve1d>(new QuarticPolynomialCurve1d(
-            init_state, {end_condition.first[1], end_condition.first[2]},
-            end_condition.second)));
+    auto ptr_trajectory1d =
+        std::make_shared<LatticeTrajectory1d>(
+            std::make_shared<QuarticPolynomialCurve1d>(
+                init_state, std::array<double, 2>{end_condition.first[1],
+                                                  end_condition.first[2]},
+                end_condition.second));
 
     ptr_trajectory1d->set_target_velocity(end_condition.first[1]);
     ptr_trajectory1d->set_target_time(end_condition.second);
@@ -120,8 +122,8 @@ inline void Trajectory1dGenerator::GenerateTrajectory1DBundle<5>(
   ptr_trajectory_bundle->reserve(end_conditions.size());
   for (const auto& end_condition : end_conditions) {
     auto ptr_trajectory1d = std::make_shared<LatticeTrajectory1d>(
-        std::shared_ptr<Curve1d>(new QuinticPolynomialCurve1d(
-            init_state, end_condition.first, end_condition.second)));
+        std::make_shared<QuinticPolynomialCurve1d>(
+            init_state, end_condition.first, end_condition.second));
 
     ptr_trajectory1d->set_target_position(end_condition.first[0]);
     ptr_trajectory1d->set_target_velocity(end_condition.first[1]);
@@ -24,6 +24,7 @@
 #include <limits>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/math/path_matcher.h"
 #include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/common/trajectory1d/piecewise_acceleration_trajectory1d.h"
@@ -64,6 +65,8 @@ TrajectoryEvaluator::TrajectoryEvaluator(
   if (planning_target.has_stop_point()) {
     stop_point = planning_target.stop_point().s();
   }
+  // cheap per-lon-trajectory pruning before any pair is costed
+  std::vector<PtrTrajectory1d> pruned_lon_trajectories;
   for (const auto& lon_trajectory : lon_trajectories) {
     double lon_end_s = lon_trajectory->Evaluate(0, end_time);
     if (init_s[0] < stop_point &&
@@ -74,22 +77,64 @@ TrajectoryEvaluator::TrajectoryEvaluator(
     if (!ConstraintChecker1d::IsValidLongitudinalTrajectory(*lon_trajectory)) {
       continue;
     }
-    for (const auto& lat_trajectory : lat_trajectories) {
-      /**
-       * The validity of the code needs to be verified.
-      if (!ConstraintChecker1d::IsValidLateralTrajectory(*lat_trajectory,
-                                                         *lon_trajectory)) {
-        continue;
-      }
-      */
-      double cost = Evaluate(planning_target, lon_trajectory, lat_trajectory);
-      cost_queue_.emplace(Trajectory1dPair(lon_trajectory, lat_trajectory),
-                          cost);
+    pruned_lon_trajectories.emplace_back(lon_trajectory);
+  }
+
+  // the lon. trajectory dependent costs are shared by every lat. trajectory,
+  // so each bundle is evaluated as a whole; bundles are independent of each
+  // other and can go to the planning thread pool
+  std::vector<std::vector<PairCost>> pair_costs(
+      pruned_lon_trajectories.size());
+  if (FLAGS_enable_multi_thread_in_lattice) {
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < pruned_lon_trajectories.size(); ++i) {
+      results.push_back(cyber::Async(&TrajectoryEvaluator::EvaluateBundle,
+                                     this, &planning_target,
+                                     pruned_lon_trajectories[i],
+                                     &lat_trajectories, &pair_costs[i]));
+    }
+    for (auto& result : results) {
+      result.get();
+    }
+  } else {
+    for (size_t i = 0; i < pruned_lon_trajectories.size(); ++i) {
+      EvaluateBundle(&planning_target, pruned_lon_trajectories[i],
+                     &lat_trajectories, &pair_costs[i]);
+    }
+  }
+
+  for (const auto& bundle_costs : pair_costs) {
+    for (const auto& pair_cost : bundle_costs) {
+      cost_queue_.emplace(pair_cost);
     }
   }
   ADEBUG << "Number of valid 1d trajectory pairs: " << cost_queue_.size();
 }
 
+void TrajectoryEvaluator::EvaluateBundle(
+    const PlanningTarget* planning_target,
+    const PtrTrajectory1d lon_trajectory,
+    const std::vector<PtrTrajectory1d>* lat_trajectories,
+    std::vector<PairCost>* pair_costs) const {
+  std::vector<double> s_values;
+  double lon_cost = EvaluateLonCost(*planning_target, lon_trajectory,
+                                    &s_values);
+  pair_costs->reserve(lat_trajectories->size());
+  for (const auto& lat_trajectory : *lat_trajectories) {
+    /**
+     * The validity of the code needs to be verified.
+    if (!ConstraintChecker1d::IsValidLateralTrajectory(*lat_trajectory,
+                                                       *lon_trajectory)) {
+      continue;
+    }
+    */
+    double cost =
+        lon_cost + EvaluateLatCost(lon_trajectory, lat_trajectory, s_values);
+    pair_costs->emplace_back(Trajectory1dPair(lon_trajectory, lat_trajectory),
+                             cost);
+  }
+}
+
 bool TrajectoryEvaluator::has_more_trajectory_pairs() const {
   return !cost_queue_.empty();
 }
@@ -121,7 +166,17 @@ double TrajectoryEvaluator::Evaluate(
   // 3. Cost of logitudinal collision
   // 4. Cost of lateral offsets
   // 5. Cost of lateral comfort
+  std::vector<double> s_values;
+  double lon_cost = EvaluateLonCost(planning_target, lon_trajectory, &s_values,
+                                    cost_components);
+  return lon_cost + EvaluateLatCost(lon_trajectory, lat_trajectory, s_values,
+                                    cost_components);
+}
 
+double TrajectoryEvaluator::EvaluateLonCost(
+    const PlanningTarget& planning_target,
+    const PtrTrajectory1d& lon_trajectory, std::vector<double>* s_values,
+    std::vector<double>* cost_components) const {
   // Longitudinal costs
   double lon_objective_cost =
       LonObjectiveCost(lon_trajectory, planning_target, reference_s_dot_);
@@ -136,29 +191,37 @@ double TrajectoryEvaluator::Evaluate(
   double evaluation_horizon =
       std::min(FLAGS_decision_horizon,
                lon_trajectory->Evaluate(0, lon_trajectory->ParamLength()));
-  std::vector<double> s_values;
   for (double s = 0.0; s < evaluation_horizon;
        s += FLAGS_trajectory_space_resolution) {
-    s_values.emplace_back(s);
+    s_values->emplace_back(s);
   }
 
-  // Lateral costs
-  double lat_offset_cost = LatOffsetCost(lat_trajectory, s_values);
-
-  double lat_comfort_cost = LatComfortCost(lon_trajectory, lat_trajectory);
-
   if (cost_components != nullptr) {
     cost_components->emplace_back(lon_objective_cost);
     cost_components->emplace_back(lon_jerk_cost);
     cost_components->emplace_back(lon_collision_cost);
-    cost_components->emplace_back(lat_offset_cost);
   }
 
   return lon_objective_cost * FLAGS_weight_lon_objective +
          lon_jerk_cost * FLAGS_weight_lon_jerk +
          lon_collision_cost * FLAGS_weight_lon_collision +
-         centripetal_acc_cost * FLAGS_weight_centripetal_acceleration +
-         lat_offset_cost * FLAGS_weight_lat_offset +
+         centripetal_acc_cost * FLAGS_weight_centripetal_acceleration;
+}
+
+double TrajectoryEvaluator::EvaluateLatCost(
+    const PtrTrajectory1d& lon_trajectory,
+    const PtrTrajectory1d& lat_trajectory, const std::vector<double>& s_values,
+    std::vector<double>* cost_components) const {
+  // Lateral costs
+  double lat_offset_cost = LatOffsetCost(lat_trajectory, s_values);
+
+  double lat_comfort_cost = LatComfortCost(lon_trajectory, lat_trajectory);
+
+  if (cost_components != nullptr) {
+    cost_components->emplace_back(lat_offset_cost);
+  }
+
+  return lat_offset_cost * FLAGS_weight_lat_offset +
          lat_comfort_cost * FLAGS_weight_lat_comfort;
 }
 
@@ -74,6 +74,24 @@ class TrajectoryEvaluator {
                   const std::shared_ptr<Curve1d>& lat_trajectory,
                   std::vector<double>* cost_components = nullptr) const;
 
+  // evaluates the lon. trajectory dependent costs once and combines them
+  // with every lat. trajectory; results are appended to pair_costs
+  void EvaluateBundle(const PlanningTarget* planning_target,
+                      const std::shared_ptr<Curve1d> lon_trajectory,
+                      const std::vector<std::shared_ptr<Curve1d>>*
+                          lat_trajectories,
+                      std::vector<PairCost>* pair_costs) const;
+
+  double EvaluateLonCost(const PlanningTarget& planning_target,
+                         const std::shared_ptr<Curve1d>& lon_trajectory,
+                         std::vector<double>* s_values,
+                         std::vector<double>* cost_components = nullptr) const;
+
+  double EvaluateLatCost(const std::shared_ptr<Curve1d>& lon_trajectory,
+                         const std::shared_ptr<Curve1d>& lat_trajectory,
+                         const std::vector<double>& s_values,
+                         std::vector<double>* cost_components = nullptr) const;
+
   double LatOffsetCost(const std::shared_ptr<Curve1d>& lat_trajectory,
                        const std::vector<double>& s_values) const;
 
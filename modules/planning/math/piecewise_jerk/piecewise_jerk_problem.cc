@@ -29,6 +29,15 @@ namespace {
 constexpr double kMaxVariableRange = 1e10;
 }  // namespace
 
+PiecewiseJerkProblem::~PiecewiseJerkProblem() { FreeWorkspace(); }
+
+void PiecewiseJerkProblem::FreeWorkspace() {
+  if (work_ != nullptr) {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+  }
+}
+
 void PiecewiseJerkProblem::InitProblem(
     const size_t num_of_knots, const double delta_s,
     const std::array<double, 5>& w, const double max_x_third_order_derivative,
@@ -181,51 +190,121 @@ void PiecewiseJerkProblem::SetVariableSecondOrderDerivativeBounds(
   ProcessBound(ddx_bounds, &ddx_bounds_);
 }
 
+void PiecewiseJerkProblem::SetWarmStart(const std::vector<double>& x,
+                                        const std::vector<double>& dx,
+                                        const std::vector<double>& ddx,
+                                        const size_t knot_shift) {
+  if (x.size() != num_of_knots_ || dx.size() != num_of_knots_ ||
+      ddx.size() != num_of_knots_) {
+    AWARN << "Warm start solution size " << x.size()
+          << " does not match num_of_knots " << num_of_knots_ << ", ignored.";
+    warm_start_x_.clear();
+    return;
+  }
+  warm_start_x_.resize(3 * num_of_knots_);
+  for (size_t i = 0; i < num_of_knots_; ++i) {
+    const size_t src = std::min(i + knot_shift, num_of_knots_ - 1);
+    warm_start_x_[i] = x[src];
+    warm_start_x_[num_of_knots_ + i] = dx[src];
+    warm_start_x_[2 * num_of_knots_ + i] = ddx[src];
+  }
+}
+
 bool PiecewiseJerkProblem::Optimize(const int max_iter) {
-  // calculate kernel
-  std::vector<c_float> P_data;
-  std::vector<c_int> P_indices;
-  std::vector<c_int> P_indptr;
-  CalculateKernel(&P_data, &P_indices, &P_indptr);
-
-  // calculate affine constraints
-  std::vector<c_float> A_data;
-  std::vector<c_int> A_indices;
-  std::vector<c_int> A_indptr;
+  const std::array<double, 5> weights = {
+      weight_.x_w, weight_.x_derivative_w, weight_.x_second_order_derivative_w,
+      weight_.x_third_order_derivative_w, weight_.x_mid_line_w};
+  const bool reuse_workspace =
+      work_ != nullptr && num_of_knots_ == cached_num_of_knots_ &&
+      delta_s_ == cached_delta_s_ && weights == cached_weights_ &&
+      max_iter == cached_max_iter_;
+
   std::vector<c_float> lower_bounds;
   std::vector<c_float> upper_bounds;
-  CalculateAffineConstraint(&A_data, &A_indices, &A_indptr, &lower_bounds,
-                            &upper_bounds);
-
-  // calculate offset
   std::vector<c_float> q;
-  CalculateOffset(&q);
-
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-  OSQPSettings* settings =
-      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  // Define Solver settings
-  osqp_set_default_settings(settings);
-  settings->max_iter = max_iter;
-  settings->polish = true;
-  settings->verbose = FLAGS_enable_osqp_debug;
-  settings->scaled_termination = true;
-
-  OSQPWorkspace* work = nullptr;
-
-  bool res =
-      OptimizeWithOsqp(3 * num_of_knots_, lower_bounds.size(), P_data,
-                       P_indices, P_indptr, A_data, A_indices, A_indptr,
-                       lower_bounds, upper_bounds, q, data, &work, settings);
-  if (res == false || work == nullptr || work->solution == nullptr) {
-    AERROR << "Failed to find solution.";
-    // Cleanup
-    osqp_cleanup(work);
+
+  if (reuse_workspace) {
+    // The P and A matrices are pure functions of the cached signature, so
+    // the workspace built on a previous cycle still holds the right
+    // matrices and factorization. Only the offset and the bounds vectors
+    // are rewritten here.
+    CalculateConstraintBounds(&lower_bounds, &upper_bounds);
+    CalculateOffset(&q);
+    osqp_update_lin_cost(work_, q.data());
+    osqp_update_bounds(work_, lower_bounds.data(), upper_bounds.data());
+  } else {
+    FreeWorkspace();
+
+    // calculate kernel
+    std::vector<c_float> P_data;
+    std::vector<c_int> P_indices;
+    std::vector<c_int> P_indptr;
+    CalculateKernel(&P_data, &P_indices, &P_indptr);
+
+    // calculate affine constraints
+    std::vector<c_float> A_data;
+    std::vector<c_int> A_indices;
+    std::vector<c_int> A_indptr;
+    CalculateAffineConstraint(&A_data, &A_indices, &A_indptr, &lower_bounds,
+                              &upper_bounds);
+
+    // calculate offset
+    CalculateOffset(&q);
+
+    CHECK_EQ(upper_bounds.size(), lower_bounds.size());
+
+    OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+    OSQPSettings* settings =
+        reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+    // Define Solver settings
+    osqp_set_default_settings(settings);
+    settings->max_iter = max_iter;
+    settings->polish = true;
+    settings->verbose = FLAGS_enable_osqp_debug;
+    settings->scaled_termination = true;
+    settings->warm_start = true;
+
+    data->n = 3 * num_of_knots_;
+    data->m = lower_bounds.size();
+    data->P = csc_matrix(data->n, data->n, P_data.size(), P_data.data(),
+                         P_indices.data(), P_indptr.data());
+    data->q = q.data();
+    data->A = csc_matrix(data->m, data->n, A_data.size(), A_data.data(),
+                         A_indices.data(), A_indptr.data());
+    data->l = lower_bounds.data();
+    data->u = upper_bounds.data();
+
+    // osqp_setup() copies the problem data into the workspace, so the csc
+    // wrappers can be released right away while work_ stays cached.
+    work_ = osqp_setup(data, settings);
     c_free(data->A);
     c_free(data->P);
     c_free(data);
     c_free(settings);
 
+    if (work_ == nullptr) {
+      AERROR << "Failed to set up osqp workspace.";
+      return false;
+    }
+
+    cached_num_of_knots_ = num_of_knots_;
+    cached_delta_s_ = delta_s_;
+    cached_weights_ = weights;
+    cached_max_iter_ = max_iter;
+  }
+
+  if (warm_start_x_.size() == 3 * num_of_knots_) {
+    osqp_warm_start_x(work_, warm_start_x_.data());
+    warm_start_x_.clear();
+  }
+
+  // Solve Problem
+  osqp_solve(work_);
+
+  auto status = work_->info->status_val;
+  if (status < 0 || work_->solution == nullptr) {
+    AERROR << "failed optimization status:\t" << work_->info->status;
+    FreeWorkspace();
     return false;
   }
 
@@ -234,19 +313,12 @@ bool PiecewiseJerkProblem::Optimize(const int max_iter) {
   dx_.resize(num_of_knots_);
   ddx_.resize(num_of_knots_);
   for (size_t i = 0; i < num_of_knots_; ++i) {
-    x_.at(i) = work->solution->x[i];
-    dx_.at(i) = work->solution->x[i + num_of_knots_];
-    ddx_.at(i) = work->solution->x[i + 2 * num_of_knots_];
+    x_.at(i) = work_->solution->x[i];
+    dx_.at(i) = work_->solution->x[i + num_of_knots_];
+    ddx_.at(i) = work_->solution->x[i + 2 * num_of_knots_];
   }
-  dx_.back() = work->solution->x[2 * num_of_knots_ - 1];
-  ddx_.back() = work->solution->x[3 * num_of_knots_ - 1];
-
-  // Cleanup
-  osqp_cleanup(work);
-  c_free(data->A);
-  c_free(data->P);
-  c_free(data);
-  c_free(settings);
+  dx_.back() = work_->solution->x[2 * num_of_knots_ - 1];
+  ddx_.back() = work_->solution->x[3 * num_of_knots_ - 1];
 
   return true;
 }
@@ -320,8 +392,7 @@ void PiecewiseJerkProblem::CalculateAffineConstraint(
   const int N = static_cast<int>(num_of_knots_);
   const int kNumParam = 3 * N;
   const int kNumConstraint = kNumParam + 3 * (N - 1) + 3;
-  lower_bounds->resize(kNumConstraint);
-  upper_bounds->resize(kNumConstraint);
+  CalculateConstraintBounds(lower_bounds, upper_bounds);
 
   std::vector<std::vector<std::pair<c_int, c_float>>> columns;
   columns.resize(kNumParam);
@@ -330,16 +401,6 @@ void PiecewiseJerkProblem::CalculateAffineConstraint(
   // set x, x', x'' bounds
   for (int i = 0; i < kNumParam; ++i) {
     columns[i].emplace_back(constraint_index, 1.0);
-    if (i < N) {
-      lower_bounds->at(constraint_index) = std::get<0>(x_bounds_[i]);
-      upper_bounds->at(constraint_index) = std::get<1>(x_bounds_[i]);
-    } else if (i < 2 * N) {
-      lower_bounds->at(constraint_index) = std::get<0>(dx_bounds_[i - N]);
-      upper_bounds->at(constraint_index) = std::get<1>(dx_bounds_[i - N]);
-    } else {
-      lower_bounds->at(constraint_index) = std::get<0>(ddx_bounds_[i - 2 * N]);
-      upper_bounds->at(constraint_index) = std::get<1>(ddx_bounds_[i - 2 * N]);
-    }
     ++constraint_index;
   }
   CHECK_EQ(constraint_index, kNumParam);
@@ -348,10 +409,6 @@ void PiecewiseJerkProblem::CalculateAffineConstraint(
   for (int i = 0; i + 1 < N; ++i) {
     columns[2 * N + i].emplace_back(constraint_index, -1.0);
     columns[2 * N + i + 1].emplace_back(constraint_index, 1.0);
-    lower_bounds->at(constraint_index) =
-        -max_x_third_order_derivative_ * delta_s_;
-    upper_bounds->at(constraint_index) =
-        max_x_third_order_derivative_ * delta_s_;
     ++constraint_index;
   }
 
@@ -361,8 +418,6 @@ void PiecewiseJerkProblem::CalculateAffineConstraint(
     columns[N + i + 1].emplace_back(constraint_index, 1.0);
     columns[2 * N + i].emplace_back(constraint_index, -0.5 * delta_s_);
     columns[2 * N + i + 1].emplace_back(constraint_index, -0.5 * delta_s_);
-    lower_bounds->at(constraint_index) = 0.0;
-    upper_bounds->at(constraint_index) = 0.0;
     ++constraint_index;
   }
 
@@ -373,26 +428,17 @@ void PiecewiseJerkProblem::CalculateAffineConstraint(
     columns[N + i].emplace_back(constraint_index, -delta_s_);
     columns[2 * N + i].emplace_back(constraint_index, -delta_s_sq_ / 3.0);
     columns[2 * N + i + 1].emplace_back(constraint_index, -delta_s_sq_ / 6.0);
-
-    lower_bounds->at(constraint_index) = 0.0;
-    upper_bounds->at(constraint_index) = 0.0;
     ++constraint_index;
   }
 
   // constrain on x_init
   columns[0].emplace_back(constraint_index, 1.0);
-  lower_bounds->at(constraint_index) = x_init_[0];
-  upper_bounds->at(constraint_index) = x_init_[0];
   ++constraint_index;
 
   columns[N].emplace_back(constraint_index, 1.0);
-  lower_bounds->at(constraint_index) = x_init_[1];
-  upper_bounds->at(constraint_index) = x_init_[1];
   ++constraint_index;
 
   columns[2 * N].emplace_back(constraint_index, 1.0);
-  lower_bounds->at(constraint_index) = x_init_[2];
-  upper_bounds->at(constraint_index) = x_init_[2];
   ++constraint_index;
 
   CHECK_EQ(constraint_index, kNumConstraint);
@@ -409,6 +455,56 @@ void PiecewiseJerkProblem::CalculateAffineConstraint(
   A_indptr->push_back(ind_p);
 }
 
+void PiecewiseJerkProblem::CalculateConstraintBounds(
+    std::vector<c_float>* lower_bounds, std::vector<c_float>* upper_bounds) {
+  const int N = static_cast<int>(num_of_knots_);
+  const int kNumParam = 3 * N;
+  const int kNumConstraint = kNumParam + 3 * (N - 1) + 3;
+  lower_bounds->resize(kNumConstraint);
+  upper_bounds->resize(kNumConstraint);
+  int constraint_index = 0;
+
+  // x, x', x'' bounds
+  for (int i = 0; i < kNumParam; ++i) {
+    if (i < N) {
+      lower_bounds->at(constraint_index) = std::get<0>(x_bounds_[i]);
+      upper_bounds->at(constraint_index) = std::get<1>(x_bounds_[i]);
+    } else if (i < 2 * N) {
+      lower_bounds->at(constraint_index) = std::get<0>(dx_bounds_[i - N]);
+      upper_bounds->at(constraint_index) = std::get<1>(dx_bounds_[i - N]);
+    } else {
+      lower_bounds->at(constraint_index) = std::get<0>(ddx_bounds_[i - 2 * N]);
+      upper_bounds->at(constraint_index) = std::get<1>(ddx_bounds_[i - 2 * N]);
+    }
+    ++constraint_index;
+  }
+
+  // third order derivative bounds
+  for (int i = 0; i + 1 < N; ++i) {
+    lower_bounds->at(constraint_index) =
+        -max_x_third_order_derivative_ * delta_s_;
+    upper_bounds->at(constraint_index) =
+        max_x_third_order_derivative_ * delta_s_;
+    ++constraint_index;
+  }
+
+  // x' and x continuity equalities
+  for (int i = 0; i + 1 < 2 * N - 1; ++i) {
+    lower_bounds->at(constraint_index) = 0.0;
+    upper_bounds->at(constraint_index) = 0.0;
+    ++constraint_index;
+  }
+
+  // x_init equalities
+  for (size_t i = 0; i < 3; ++i) {
+    lower_bounds->at(constraint_index) = x_init_[i];
+    upper_bounds->at(constraint_index) = x_init_[i];
+    ++constraint_index;
+  }
+
+  CHECK_EQ(constraint_index, kNumConstraint);
+}
+
 void PiecewiseJerkProblem::CalculateOffset(std::vector<c_float>* q) {
   CHECK_NOTNULL(q);
   const int N = static_cast<int>(num_of_knots_);
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <array>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -50,7 +51,11 @@ class PiecewiseJerkProblem {
  public:
   PiecewiseJerkProblem() = default;
 
-  virtual ~PiecewiseJerkProblem() = default;
+  virtual ~PiecewiseJerkProblem();
+
+  // The problem owns a cached osqp workspace; copying would double-free it.
+  PiecewiseJerkProblem(const PiecewiseJerkProblem&) = delete;
+  PiecewiseJerkProblem& operator=(const PiecewiseJerkProblem&) = delete;
 
   /*
    * @param
@@ -111,6 +116,19 @@ class PiecewiseJerkProblem {
 
   virtual bool Optimize(const int max_iter = 4000);
 
+  /*
+   * @brief Seed the next solve with a solution from a previous planning
+   * cycle. knot_shift is the number of knots the vehicle advanced along s
+   * since that solution was computed; the seed is shifted accordingly and
+   * its tail is padded with the last knot. The seed is consumed by the next
+   * Optimize() call and is ignored when its dimension does not match the
+   * current problem.
+   */
+  void SetWarmStart(const std::vector<double>& x,
+                    const std::vector<double>& dx,
+                    const std::vector<double>& ddx,
+                    const size_t knot_shift = 0);
+
   const std::vector<double>& x() const { return x_; }
 
   const std::vector<double>& x_derivative() const { return dx_; }
@@ -131,6 +149,12 @@ class PiecewiseJerkProblem {
                                          std::vector<c_float>* lower_bounds,
                                          std::vector<c_float>* upper_bounds);
 
+  // Fills only the constraint bounds, in the row layout produced by
+  // CalculateAffineConstraint. Used on the fast path where the A matrix
+  // from the previous cycle is still valid.
+  virtual void CalculateConstraintBounds(std::vector<c_float>* lower_bounds,
+                                         std::vector<c_float>* upper_bounds);
+
   bool OptimizeWithOsqp(
       const size_t kernel_dim, const size_t num_affine_constraint,
       std::vector<c_float>& P_data, std::vector<c_int>& P_indices,    // NOLINT
@@ -145,6 +169,8 @@ class PiecewiseJerkProblem {
       const std::vector<std::tuple<double, double, double>>& src,
       std::vector<std::pair<double, double>>* dst);
 
+  void FreeWorkspace();
+
  protected:
   size_t num_of_knots_ = 0;
 
@@ -171,6 +197,23 @@ class PiecewiseJerkProblem {
 
   double delta_s_ = 1.0;
   double delta_s_sq_ = 1.0;
+
+  // Cached osqp workspace together with the formulation signature it was
+  // built from. The P and A matrices are pure functions of the signature
+  // members, so as long as they are unchanged the next Optimize() call
+  // skips the matrix construction entirely and only rewrites the offset
+  // and bounds vectors through osqp_update_lin_cost() /
+  // osqp_update_bounds(); the solver keeps its factorization and
+  // warm-starts from the last solution. Subclasses overriding the
+  // formulation must keep it a pure function of these members.
+  OSQPWorkspace* work_ = nullptr;
+  size_t cached_num_of_knots_ = 0;
+  double cached_delta_s_ = 0.0;
+  std::array<double, 5> cached_weights_{{0.0, 0.0, 0.0, 0.0, 0.0}};
+  int cached_max_iter_ = 0;
+
+  // One-shot primal seed provided through SetWarmStart().
+  std::vector<c_float> warm_start_x_;
 };
 
 }  // namespace planning
@@ -29,7 +29,9 @@
 namespace apollo {
 namespace planning {
 
+using apollo::common::math::BlockDiagonalToCSCMatrix;
 using apollo::common::math::DenseToCSCMatrix;
+using apollo::common::math::StackedDenseToCSCMatrix;
 using Eigen::MatrixXd;
 
 OsqpSpline1dSolver::OsqpSpline1dSolver(const std::vector<double>& x_knots,
@@ -87,26 +89,35 @@ bool OsqpSpline1dSolver::Solve() {
   std::vector<c_float> P_data;
   std::vector<c_int> P_indices;
   std::vector<c_int> P_indptr;
-  DenseToCSCMatrix(P, &P_data, &P_indices, &P_indptr);
+  if (kernel_.is_block_diagonal()) {
+    // built-in kernels only touch per-segment diagonal blocks, so the
+    // quadratic dense scan can be skipped
+    BlockDiagonalToCSCMatrix(P, static_cast<int>(spline_.spline_order()) + 1,
+                             &P_data, &P_indices, &P_indptr);
+  } else {
+    DenseToCSCMatrix(P, &P_data, &P_indices, &P_indptr);
+  }
 
-  // change A to csc format
+  // change A to csc format without materializing the stacked dense matrix
   const MatrixXd& inequality_constraint_matrix =
       constraint_.inequality_constraint().constraint_matrix();
   const MatrixXd& equality_constraint_matrix =
       constraint_.equality_constraint().constraint_matrix();
-  MatrixXd A(
-      inequality_constraint_matrix.rows() + equality_constraint_matrix.rows(),
-      inequality_constraint_matrix.cols());
-  A << inequality_constraint_matrix, equality_constraint_matrix;
-  ADEBUG << "A: " << A.rows() << ", " << A.cols();
-  if (A.rows() == 0) {
+  ADEBUG << "A: "
+         << inequality_constraint_matrix.rows() +
+                equality_constraint_matrix.rows()
+         << ", " << inequality_constraint_matrix.cols();
+  if (inequality_constraint_matrix.rows() + equality_constraint_matrix.rows() ==
+      0) {
     return false;
   }
 
   std::vector<c_float> A_data;
   std::vector<c_int> A_indices;
   std::vector<c_int> A_indptr;
-  DenseToCSCMatrix(A, &A_data, &A_indices, &A_indptr);
+  StackedDenseToCSCMatrix(inequality_constraint_matrix,
+                          equality_constraint_matrix, &A_data, &A_indices,
+                          &A_indptr);
 
   // set q, l, u: l < A < u
   const MatrixXd& q_eigen = kernel_.offset();
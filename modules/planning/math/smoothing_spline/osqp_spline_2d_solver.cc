@@ -33,18 +33,42 @@ namespace {
 constexpr double kRoadBound = 1e10;
 }
 
+using apollo::common::math::BlockDiagonalToCSCMatrix;
 using apollo::common::math::DenseToCSCMatrix;
+using apollo::common::math::StackedDenseToCSCMatrix;
 using Eigen::MatrixXd;
 
 OsqpSpline2dSolver::OsqpSpline2dSolver(const std::vector<double>& t_knots,
                                        const uint32_t order)
     : Spline2dSolver(t_knots, order) {}
 
+OsqpSpline2dSolver::~OsqpSpline2dSolver() {
+  CleanUp();
+  if (osqp_settings_ != nullptr) {
+    c_free(osqp_settings_);
+    osqp_settings_ = nullptr;
+  }
+}
+
+void OsqpSpline2dSolver::CleanUp() {
+  if (work_ != nullptr) {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+  }
+  if (data_ != nullptr) {
+    c_free(data_->A);
+    c_free(data_->P);
+    c_free(data_);
+    data_ = nullptr;
+  }
+}
+
 void OsqpSpline2dSolver::Reset(const std::vector<double>& t_knots,
                                const uint32_t order) {
   spline_ = Spline2d(t_knots, order);
   kernel_ = Spline2dKernel(t_knots, order);
   constraint_ = Spline2dConstraint(t_knots, order);
+  last_problem_success_ = false;
 }
 
 // customize setup
@@ -70,30 +94,39 @@ bool OsqpSpline2dSolver::Solve() {
   std::vector<c_float> P_data;
   std::vector<c_int> P_indices;
   std::vector<c_int> P_indptr;
-  DenseToCSCMatrix(P, &P_data, &P_indices, &P_indptr);
+  if (kernel_.is_block_diagonal()) {
+    // built-in kernels only touch per-segment diagonal blocks, so the
+    // quadratic dense scan can be skipped
+    BlockDiagonalToCSCMatrix(P, static_cast<int>(spline_.spline_order()) + 1,
+                             &P_data, &P_indices, &P_indptr);
+  } else {
+    DenseToCSCMatrix(P, &P_data, &P_indices, &P_indptr);
+  }
 
-  // change A to csc format
+  // change A to csc format without materializing the stacked dense matrix
   const MatrixXd& inequality_constraint_matrix =
       constraint_.inequality_constraint().constraint_matrix();
   const MatrixXd& equality_constraint_matrix =
       constraint_.equality_constraint().constraint_matrix();
-  MatrixXd A(
-      inequality_constraint_matrix.rows() + equality_constraint_matrix.rows(),
-      inequality_constraint_matrix.cols());
-  A << inequality_constraint_matrix, equality_constraint_matrix;
-  ADEBUG << "A: " << A.rows() << ", " << A.cols();
-  if (A.rows() == 0) {
+  ADEBUG << "A: "
+         << inequality_constraint_matrix.rows() +
+                equality_constraint_matrix.rows()
+         << ", " << inequality_constraint_matrix.cols();
+  if (inequality_constraint_matrix.rows() + equality_constraint_matrix.rows() ==
+      0) {
     return false;
   }
 
   std::vector<c_float> A_data;
   std::vector<c_int> A_indices;
   std::vector<c_int> A_indptr;
-  DenseToCSCMatrix(A, &A_data, &A_indices, &A_indptr);
+  StackedDenseToCSCMatrix(inequality_constraint_matrix,
+                          equality_constraint_matrix, &A_data, &A_indices,
+                          &A_indptr);
 
   // set q, l, u: l < A < u
   const MatrixXd& q_eigen = kernel_.offset();
-  c_float q[q_eigen.rows()];  // NOLINT
+  std::vector<c_float> q(q_eigen.rows());
   for (int i = 0; i < q_eigen.size(); ++i) {
     q[i] = q_eigen(i);
   }
@@ -108,8 +141,8 @@ bool OsqpSpline2dSolver::Solve() {
 
   constexpr float kEpsilon = 1e-9f;
   constexpr float kUpperLimit = 1e9f;
-  c_float l[constraint_num];  // NOLINT
-  c_float u[constraint_num];  // NOLINT
+  std::vector<c_float> l(constraint_num);
+  std::vector<c_float> u(constraint_num);
   for (int i = 0; i < constraint_num; ++i) {
     if (i < inequality_constraint_boundary.rows()) {
       l[i] = inequality_constraint_boundary(i, 0);
@@ -121,51 +154,81 @@ bool OsqpSpline2dSolver::Solve() {
     }
   }
 
-  // Problem settings
-  OSQPSettings* settings =
-      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-
-  // Populate data
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-  data->n = P.rows();
-  data->m = constraint_num;
-  data->P = csc_matrix(data->n, data->n, P_data.size(), P_data.data(),
-                       P_indices.data(), P_indptr.data());
-  data->q = q;
-  data->A = csc_matrix(data->m, data->n, A_data.size(), A_data.data(),
-                       A_indices.data(), A_indptr.data());
-  data->l = l;
-  data->u = u;
-
-  // Define Solver settings as default
-  osqp_set_default_settings(settings);
-  settings->alpha = 1.0;  // Change alpha parameter
-  settings->eps_abs = 1.0e-05;
-  settings->eps_rel = 1.0e-05;
-  settings->max_iter = 5000;
-  settings->polish = true;
-  settings->verbose = FLAGS_enable_osqp_debug;
-
-  // Setup workspace
-  OSQPWorkspace* work = osqp_setup(data, settings);
+  // The cached workspace is valid when P and A are unchanged down to the
+  // sparsity pattern; then only q, l and u moved, the KKT factorization is
+  // still valid, and the previous solution warm starts ADMM.
+  const bool reuse_workspace =
+      work_ != nullptr && last_problem_success_ &&
+      static_cast<int>(P.rows()) == last_num_param_ &&
+      static_cast<int>(constraint_num) == last_num_constraint_ &&
+      P_data == P_data_ && P_indices == P_indices_ && P_indptr == P_indptr_ &&
+      A_data == A_data_ && A_indices == A_indices_ && A_indptr == A_indptr_;
+
+  q_ = std::move(q);
+  l_ = std::move(l);
+  u_ = std::move(u);
+
+  if (reuse_workspace) {
+    osqp_update_lin_cost(work_, q_.data());
+    osqp_update_bounds(work_, l_.data(), u_.data());
+  } else {
+    CleanUp();
+    P_data_ = std::move(P_data);
+    P_indices_ = std::move(P_indices);
+    P_indptr_ = std::move(P_indptr);
+    A_data_ = std::move(A_data);
+    A_indices_ = std::move(A_indices);
+    A_indptr_ = std::move(A_indptr);
+
+    if (osqp_settings_ == nullptr) {
+      osqp_settings_ =
+          reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+      osqp_set_default_settings(osqp_settings_);
+      osqp_settings_->alpha = 1.0;  // Change alpha parameter
+      osqp_settings_->eps_abs = 1.0e-05;
+      osqp_settings_->eps_rel = 1.0e-05;
+      osqp_settings_->max_iter = 5000;
+      osqp_settings_->polish = true;
+      osqp_settings_->verbose = FLAGS_enable_osqp_debug;
+    }
+
+    // Populate data
+    data_ = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+    data_->n = P.rows();
+    data_->m = constraint_num;
+    data_->P = csc_matrix(data_->n, data_->n, P_data_.size(), P_data_.data(),
+                          P_indices_.data(), P_indptr_.data());
+    data_->q = q_.data();
+    data_->A = csc_matrix(data_->m, data_->n, A_data_.size(), A_data_.data(),
+                          A_indices_.data(), A_indptr_.data());
+    data_->l = l_.data();
+    data_->u = u_.data();
+
+    // Setup workspace
+    work_ = osqp_setup(data_, osqp_settings_);
+    if (work_ == nullptr) {
+      AERROR << "Failed to set up the OSQP workspace";
+      last_problem_success_ = false;
+      return false;
+    }
+  }
 
   // Solve Problem
-  osqp_solve(work);
+  osqp_solve(work_);
 
   MatrixXd solved_params = MatrixXd::Zero(P.rows(), 1);
   for (int i = 0; i < P.rows(); ++i) {
-    solved_params(i, 0) = work->solution->x[i];
+    solved_params(i, 0) = work_->solution->x[i];
   }
 
   last_num_param_ = static_cast<int>(P.rows());
   last_num_constraint_ = static_cast<int>(constraint_num);
-
-  // Cleanup
-  osqp_cleanup(work);
-  c_free(data->A);
-  c_free(data->P);
-  c_free(data);
-  c_free(settings);
+  last_problem_success_ = work_->info->status_val == OSQP_SOLVED;
+  if (!last_problem_success_) {
+    // Do not carry a workspace whose iterates did not converge into the
+    // next cycle.
+    CleanUp();
+  }
 
   return spline_.set_splines(solved_params, spline_.spline_order());
 }
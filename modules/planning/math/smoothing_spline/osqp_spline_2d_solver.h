@@ -35,6 +35,8 @@ class OsqpSpline2dSolver final : public Spline2dSolver {
  public:
   OsqpSpline2dSolver(const std::vector<double>& t_knots, const uint32_t order);
 
+  ~OsqpSpline2dSolver() override;
+
   void Reset(const std::vector<double>& t_knots, const uint32_t order) override;
 
   // customize setup
@@ -49,6 +51,9 @@ class OsqpSpline2dSolver final : public Spline2dSolver {
   const Spline2d& spline() const override;
 
  private:
+  // Releases the cached workspace and problem data, if any.
+  void CleanUp();
+
   FRIEND_TEST(OSQPSolverTest, basic_test);
 
  private:
@@ -56,6 +61,20 @@ class OsqpSpline2dSolver final : public Spline2dSolver {
   OSQPWorkspace* work_ = nullptr;  // Workspace
   OSQPData* data_ = nullptr;       // OSQPData
 
+  // CSC form of the last P and A; when the next cycle produces identical
+  // matrices (only q / l / u changed, the common case for a reference-line
+  // smoother re-solving with shifted bounds), the cached workspace with its
+  // KKT factorization is reused instead of a full osqp_setup.
+  std::vector<c_float> P_data_;
+  std::vector<c_int> P_indices_;
+  std::vector<c_int> P_indptr_;
+  std::vector<c_float> A_data_;
+  std::vector<c_int> A_indices_;
+  std::vector<c_int> A_indptr_;
+  std::vector<c_float> q_;
+  std::vector<c_float> l_;
+  std::vector<c_float> u_;
+
   int last_num_constraint_ = 0;
   int last_num_param_ = 0;
   bool last_problem_success_ = false;
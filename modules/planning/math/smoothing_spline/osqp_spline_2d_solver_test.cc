@@ -144,6 +144,19 @@ TEST(OSQPSolverTest, solver_test_01) {
                 std::fmax(3e-3, gold_res(i, 2) * 1e-4));
     t += 0.1;
   }
+
+  // A repeated solve of the same problem goes through the cached workspace
+  // and must reproduce the same spline.
+  EXPECT_TRUE(spline_solver.Solve());
+  t = 0;
+  for (int i = 0; i < 51; ++i) {
+    auto xy = spline_solver.spline()(t);
+    EXPECT_NEAR(xy.first, gold_res(i, 1),
+                std::fmax(3e-3, gold_res(i, 1) * 1e-4));
+    EXPECT_NEAR(xy.second, gold_res(i, 2),
+                std::fmax(3e-3, gold_res(i, 2) * 1e-4));
+    t += 0.1;
+  }
 }
 
 }  // namespace planning
@@ -60,6 +60,7 @@ bool Spline1dKernel::AddKernel(const Eigen::MatrixXd& kernel,
   }
   kernel_matrix_ += kernel * weight;
   offset_ += offset * weight;
+  is_block_diagonal_ = false;
   return true;
 }
 
@@ -70,6 +71,7 @@ bool Spline1dKernel::AddKernel(const Eigen::MatrixXd& kernel,
 }
 
 Eigen::MatrixXd* Spline1dKernel::mutable_kernel_matrix() {
+  is_block_diagonal_ = false;
   return &kernel_matrix_;
 }
 
@@ -70,6 +70,12 @@ class Spline1dKernel {
   // go)
   void AddDistanceOffset(const double weight);
 
+  // whether every kernel term added so far only touches the aligned
+  // (1 + spline_order) sized diagonal blocks, so the kernel matrix is block
+  // diagonal and can be converted to sparse form in linear time. The flag is
+  // cleared once a caller adds a custom kernel or grabs mutable access.
+  bool is_block_diagonal() const { return is_block_diagonal_; }
+
  private:
   void AddNthDerivativekernelMatrix(const uint32_t n, const double weight);
   void AddNthDerivativekernelMatrixForSplineK(const uint32_t n,
@@ -83,6 +89,7 @@ class Spline1dKernel {
   std::vector<double> x_knots_;
   uint32_t spline_order_;
   uint32_t total_params_;
+  bool is_block_diagonal_ = true;
 };
 
 }  // namespace planning
@@ -56,6 +56,7 @@ bool Spline2dKernel::AddKernel(const Eigen::MatrixXd& kernel,
   }
   kernel_matrix_ += kernel * weight;
   offset_ += offset * weight;
+  is_block_diagonal_ = false;
   return true;
 }
 
@@ -66,6 +67,7 @@ bool Spline2dKernel::AddKernel(const Eigen::MatrixXd& kernel,
 }
 
 Eigen::MatrixXd* Spline2dKernel::mutable_kernel_matrix() {
+  is_block_diagonal_ = false;
   return &kernel_matrix_;
 }
 
@@ -57,6 +57,12 @@ class Spline2dKernel {
       const std::vector<double>& t_coord,
       const std::vector<common::math::Vec2d>& ref_points, const double weight);
 
+  // whether every kernel term added so far only touches the aligned
+  // (1 + spline_order) sized diagonal blocks, so the kernel matrix is block
+  // diagonal and can be converted to sparse form in linear time. The flag is
+  // cleared once a caller adds a custom kernel or grabs mutable access.
+  bool is_block_diagonal() const { return is_block_diagonal_; }
+
  private:
   void AddNthDerivativeKernelMatrix(const uint32_t n, const double weight);
   uint32_t find_index(const double x) const;
@@ -67,6 +73,7 @@ class Spline2dKernel {
   std::vector<double> t_knots_;
   uint32_t spline_order_;
   size_t total_params_;
+  bool is_block_diagonal_ = true;
 };
 
 }  // namespace planning
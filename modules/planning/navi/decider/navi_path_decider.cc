@@ -116,6 +116,22 @@ apollo::common::Status NaviPathDecider::Process(
     start_plan_a_ = init_point.a();
   }
 
+  // when all the plan inputs repeat the last cycle (stable perception lane
+  // lines and obstacles), the generated path would be identical, so reuse it
+  // and skip the regeneration
+  std::string plan_input_key = ComputePlanInputKey(reference_line, obstacles);
+  if (plan_input_key == last_plan_input_key_ && !last_path_points_.empty()) {
+    ADEBUG << "plan inputs are stable, reuse path from last plan cycle";
+    path_data->SetReferenceLine(&(reference_line_info_->reference_line()));
+    if (!path_data->SetDiscretizedPath(DiscretizedPath(last_path_points_))) {
+      AERROR << "Set path data failed.";
+      return Status(apollo::common::ErrorCode::PLANNING_ERROR,
+                    "NaviPathDecider SetDiscretizedPath");
+    }
+    return Status::OK();
+  }
+  last_plan_input_key_.clear();
+
   // intercept path points from reference line
   std::vector<apollo::common::PathPoint> path_points;
   if (!GetBasicPathData(reference_line, &path_points)) {
@@ -143,9 +159,38 @@ apollo::common::Status NaviPathDecider::Process(
                   "NaviPathDecider SetDiscretizedPath");
   }
 
+  last_plan_input_key_ = std::move(plan_input_key);
+  last_path_points_ = std::move(path_points);
+
   return Status::OK();
 }
 
+std::string NaviPathDecider::ComputePlanInputKey(
+    const ReferenceLine& reference_line,
+    const std::vector<const Obstacle*>& obstacles) {
+  std::string key = cur_reference_line_lane_id_;
+  key += "|" + std::to_string(start_plan_point_.x());
+  key += "|" + std::to_string(start_plan_point_.y());
+  key += "|" + std::to_string(start_plan_point_.theta());
+  key += "|" + std::to_string(start_plan_v_);
+  key += "|" + std::to_string(start_plan_a_);
+  key += "|" + std::to_string(reference_line.Length());
+  const auto& reference_points = reference_line.reference_points();
+  if (!reference_points.empty()) {
+    key += "|" + std::to_string(reference_points.front().x());
+    key += "|" + std::to_string(reference_points.front().y());
+    key += "|" + std::to_string(reference_points.back().x());
+    key += "|" + std::to_string(reference_points.back().y());
+  }
+  for (const auto* obstacle : obstacles) {
+    const auto& perception_box = obstacle->PerceptionBoundingBox();
+    key += "|" + obstacle->Id();
+    key += ":" + std::to_string(perception_box.center_x());
+    key += "," + std::to_string(perception_box.center_y());
+  }
+  return key;
+}
+
 void NaviPathDecider::MoveToDestLane(
     const double dest_ref_line_y,
     std::vector<common::PathPoint>* const path_points) {
@@ -169,14 +214,9 @@ void NaviPathDecider::MoveToDestLane(
   ADEBUG << "in current plan cycle move to dest lane, adc shift to dest "
             "reference line : "
          << lateral_shift_value;
-  std::transform(path_points->begin(), path_points->end(), path_points->begin(),
-                 [lateral_shift_value](common::PathPoint& old_path_point) {
-                   common::PathPoint new_path_point = old_path_point;
-                   double new_path_point_y =
-                       old_path_point.y() + lateral_shift_value;
-                   new_path_point.set_y(new_path_point_y);
-                   return new_path_point;
-                 });
+  for (auto& path_point : *path_points) {
+    path_point.set_y(path_point.y() + lateral_shift_value);
+  }
 
   return;
 }
@@ -209,14 +249,9 @@ void NaviPathDecider::KeepLane(
 
     ADEBUG << "in current plan cycle keep lane, actual dest : "
            << actual_dest_point_y << " adc shift to dest : " << actual_shift_y;
-    std::transform(
-        path_points->begin(), path_points->end(), path_points->begin(),
-        [actual_shift_y](common::PathPoint& old_path_point) {
-          common::PathPoint new_path_point = old_path_point;
-          double new_path_point_y = old_path_point.y() + actual_shift_y;
-          new_path_point.set_y(new_path_point_y);
-          return new_path_point;
-        });
+    for (auto& path_point : *path_points) {
+      path_point.set_y(path_point.y() + actual_shift_y);
+    }
   }
 
   return;
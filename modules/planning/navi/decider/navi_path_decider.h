@@ -141,6 +141,19 @@ class NaviPathDecider : public NaviTask {
    */
   double CalculateDistanceToDestLane();
 
+  /**
+   * @brief compose a key of all the inputs the generated path depends on:
+   * start plan point, reference line geometry and obstacle poses. When the
+   * key repeats across cycles the perception lane lines are stable and the
+   * path from the last cycle can be reused without regeneration.
+   * @param reference_line input reference line
+   * @param obstacles unhandled obstacle information.
+   * @return the composed key.
+   */
+  std::string ComputePlanInputKey(
+      const ReferenceLine &reference_line,
+      const std::vector<const Obstacle *> &obstacles);
+
  private:
   double max_keep_lane_distance_ = 0.0;
   double min_keep_lane_offset_ = 0.0;
@@ -157,6 +170,10 @@ class NaviPathDecider : public NaviTask {
 
   std::string cur_reference_line_lane_id_;
   std::map<std::string, bool> last_lane_id_to_nudge_flag_;
+  // plan input key and generated path of the last successful cycle, used to
+  // skip path regeneration when the inputs did not change
+  std::string last_plan_input_key_;
+  std::vector<common::PathPoint> last_path_points_;
   NaviObstacleDecider obstacle_decider_;
   common::VehicleState vehicle_state_;
   NaviPathDeciderConfig config_;
@@ -83,33 +83,34 @@ bool HybridAStar::ValidityCheck(std::shared_ptr<Node3d> node) {
     return true;
   }
   size_t node_step_size = node->GetStepSize();
-  size_t last_check_index = 0;
-  std::vector<double> traversed_x;
-  std::vector<double> traversed_y;
-  std::vector<double> traversed_phi;
-  traversed_x = node->GetXs();
-  traversed_y = node->GetYs();
-  traversed_phi = node->GetPhis();
-  std::reverse(traversed_x.begin(), traversed_x.end());
-  std::reverse(traversed_y.begin(), traversed_y.end());
-  std::reverse(traversed_phi.begin(), traversed_phi.end());
+  const auto& traversed_x = node->GetXs();
+  const auto& traversed_y = node->GetYs();
+  const auto& traversed_phi = node->GetPhis();
   // The first {x, y, phi} is collision free unless they are start and end
   // configuration of search problem
-  if (node_step_size == 1) {
-    last_check_index = 1;
-  } else {
-    last_check_index = node_step_size - 1;
+  size_t check_start_index = 0;
+  if (node_step_size != 1) {
+    check_start_index = 1;
   }
-  for (size_t i = 0; i < last_check_index; ++i) {
+  for (size_t i = check_start_index; i < node_step_size; ++i) {
     if (traversed_x[i] > XYbounds_[1] || traversed_x[i] < XYbounds_[0] ||
         traversed_y[i] > XYbounds_[3] || traversed_y[i] < XYbounds_[2]) {
       return false;
     }
     Box2d bounding_box = Node3d::GetBoundingBox(
         vehicle_param_, traversed_x[i], traversed_y[i], traversed_phi[i]);
-    for (const auto& obstacle_linesegments : obstacles_linesegments_vec_) {
+    for (size_t j = 0; j < obstacles_linesegments_vec_.size(); ++j) {
+      // reject obstacles whose axis-aligned box cannot touch the vehicle
+      // box before running the exact segment overlap tests
+      const auto& aabox = obstacles_aaboxes_vec_[j];
+      if (bounding_box.max_x() < aabox.min_x() ||
+          bounding_box.min_x() > aabox.max_x() ||
+          bounding_box.max_y() < aabox.min_y() ||
+          bounding_box.min_y() > aabox.max_y()) {
+        continue;
+      }
       for (const common::math::LineSegment2d& linesegment :
-           obstacle_linesegments) {
+           obstacles_linesegments_vec_[j]) {
         if (bounding_box.HasOverlap(linesegment)) {
           return false;
         }
@@ -326,6 +327,7 @@ bool HybridAStar::Plan(
 
   std::vector<std::vector<common::math::LineSegment2d>>
       obstacles_linesegments_vec;
+  std::vector<common::math::AABox2d> obstacles_aaboxes_vec;
   for (const auto& obstacle_vertices : obstacles_vertices_vec) {
     size_t vertices_num = obstacle_vertices.size();
     std::vector<common::math::LineSegment2d> obstacle_linesegments;
@@ -335,8 +337,10 @@ bool HybridAStar::Plan(
       obstacle_linesegments.emplace_back(line_segment);
     }
     obstacles_linesegments_vec.emplace_back(obstacle_linesegments);
+    obstacles_aaboxes_vec.emplace_back(obstacle_vertices);
   }
   obstacles_linesegments_vec_ = std::move(obstacles_linesegments_vec);
+  obstacles_aaboxes_vec_ = std::move(obstacles_aaboxes_vec);
 
   // load XYbounds
   XYbounds_ = XYbounds;
@@ -394,11 +398,13 @@ bool HybridAStar::Plan(
       if (close_set_.find(next_node->GetIndex()) != close_set_.end()) {
         continue;
       }
-      // collision check
-      if (!ValidityCheck(next_node)) {
-        continue;
-      }
+      // check if the node is already in the open set before paying for the
+      // collision check, since such nodes are discarded anyway
       if (open_set_.find(next_node->GetIndex()) == open_set_.end()) {
+        // collision check
+        if (!ValidityCheck(next_node)) {
+          continue;
+        }
         explored_node_num++;
         start_time = Clock::NowInSeconds();
         CalculateNodeCost(current_node, next_node);
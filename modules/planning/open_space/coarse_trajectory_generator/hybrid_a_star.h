@@ -111,6 +111,9 @@ class HybridAStar {
   std::shared_ptr<Node3d> final_node_;
   std::vector<std::vector<common::math::LineSegment2d>>
       obstacles_linesegments_vec_;
+  // axis-aligned bounding box of each obstacle, used to reject far-away
+  // obstacles before the exact segment overlap tests in ValidityCheck()
+  std::vector<common::math::AABox2d> obstacles_aaboxes_vec_;
 
   struct cmp {
     bool operator()(const std::pair<std::string, double>& left,
@@ -60,77 +60,75 @@ bool DistanceApproachProblem::Solve(
 
   Ipopt::SmartPtr<Ipopt::TNLP> problem = ptop;
 
-  // Create an instance of the IpoptApplication
-  Ipopt::SmartPtr<Ipopt::IpoptApplication> app = IpoptApplicationFactory();
-
-  app->Options()->SetIntegerValue(
-      "print_level", planner_open_space_config_.distance_approach_config()
-                         .ipopt_config()
-                         .ipopt_print_level());
-  app->Options()->SetIntegerValue(
-      "mumps_mem_percent", planner_open_space_config_.distance_approach_config()
-                               .ipopt_config()
-                               .mumps_mem_percent());
-  app->Options()->SetNumericValue(
-      "mumps_pivtol", planner_open_space_config_.distance_approach_config()
-                          .ipopt_config()
-                          .mumps_pivtol());
-  app->Options()->SetIntegerValue(
-      "max_iter", planner_open_space_config_.distance_approach_config()
-                      .ipopt_config()
-                      .ipopt_max_iter());
-  app->Options()->SetNumericValue(
-      "tol", planner_open_space_config_.distance_approach_config()
-                 .ipopt_config()
-                 .ipopt_tol());
-  app->Options()->SetNumericValue(
-      "acceptable_constr_viol_tol",
-      planner_open_space_config_.distance_approach_config()
-          .ipopt_config()
-          .ipopt_acceptable_constr_viol_tol());
-  app->Options()->SetNumericValue(
-      "min_hessian_perturbation",
-      planner_open_space_config_.distance_approach_config()
-          .ipopt_config()
-          .ipopt_min_hessian_perturbation());
-  app->Options()->SetNumericValue(
-      "jacobian_regularization_value",
-      planner_open_space_config_.distance_approach_config()
-          .ipopt_config()
-          .ipopt_jacobian_regularization_value());
-  app->Options()->SetStringValue(
-      "print_timing_statistics",
+  // Create the IpoptApplication on the first solve and keep it afterwards,
+  // so that option parsing and solver initialization are only paid once;
+  // the options never change between solves
+  if (!Ipopt::IsValid(app_)) {
+    const auto& ipopt_config =
+        planner_open_space_config_.distance_approach_config().ipopt_config();
+    Ipopt::SmartPtr<Ipopt::IpoptApplication> app = IpoptApplicationFactory();
+
+    app->Options()->SetIntegerValue("print_level",
+                                    ipopt_config.ipopt_print_level());
+    app->Options()->SetIntegerValue("mumps_mem_percent",
+                                    ipopt_config.mumps_mem_percent());
+    app->Options()->SetNumericValue("mumps_pivtol",
+                                    ipopt_config.mumps_pivtol());
+    app->Options()->SetIntegerValue("max_iter", ipopt_config.ipopt_max_iter());
+    app->Options()->SetNumericValue("tol", ipopt_config.ipopt_tol());
+    app->Options()->SetNumericValue(
+        "acceptable_constr_viol_tol",
+        ipopt_config.ipopt_acceptable_constr_viol_tol());
+    app->Options()->SetNumericValue(
+        "min_hessian_perturbation",
+        ipopt_config.ipopt_min_hessian_perturbation());
+    app->Options()->SetNumericValue(
+        "jacobian_regularization_value",
+        ipopt_config.ipopt_jacobian_regularization_value());
+    app->Options()->SetStringValue(
+        "print_timing_statistics",
+        ipopt_config.ipopt_print_timing_statistics());
+    app->Options()->SetStringValue("alpha_for_y",
+                                   ipopt_config.ipopt_alpha_for_y());
+    app->Options()->SetStringValue("recalc_y", ipopt_config.ipopt_recalc_y());
+    app->Options()->SetNumericValue("mu_init", ipopt_config.ipopt_mu_init());
+    if (ipopt_config.ipopt_max_cpu_time() > 0.0) {
+      app->Options()->SetNumericValue("max_cpu_time",
+                                      ipopt_config.ipopt_max_cpu_time());
+    }
+
+    if (app->Initialize() != Ipopt::Solve_Succeeded) {
+      AERROR << "*** Distiance Approach problem error during initialization!";
+      return false;
+    }
+    app_ = app;
+  }
+
+  Ipopt::ApplicationReturnStatus status = app_->OptimizeTNLP(problem);
+
+  bool solved = status == Ipopt::Solve_Succeeded ||
+                status == Ipopt::Solved_To_Acceptable_Level;
+
+  // with the iteration/time budget exhausted, ipopt hands back its last
+  // iterate; optionally keep it as a degraded result so that downstream
+  // partitioning can still proceed
+  if (!solved &&
+      (status == Ipopt::Maximum_Iterations_Exceeded ||
+       status == Ipopt::Maximum_CpuTime_Exceeded) &&
       planner_open_space_config_.distance_approach_config()
           .ipopt_config()
-          .ipopt_print_timing_statistics());
-  app->Options()->SetStringValue(
-      "alpha_for_y", planner_open_space_config_.distance_approach_config()
-                         .ipopt_config()
-                         .ipopt_alpha_for_y());
-  app->Options()->SetStringValue(
-      "recalc_y", planner_open_space_config_.distance_approach_config()
-                      .ipopt_config()
-                      .ipopt_recalc_y());
-  app->Options()->SetNumericValue(
-      "mu_init", planner_open_space_config_.distance_approach_config()
-                     .ipopt_config()
-                     .ipopt_mu_init());
-
-  Ipopt::ApplicationReturnStatus status = app->Initialize();
-  if (status != Ipopt::Solve_Succeeded) {
-    AERROR << "*** Distiance Approach problem error during initialization!";
-    return false;
+          .ipopt_accept_budget_exhausted_iterate()) {
+    AWARN << "Distance approach budget exhausted, return status: "
+          << int(status) << ", keeping last iterate as degraded result";
+    solved = true;
   }
 
-  status = app->OptimizeTNLP(problem);
-
-  if (status == Ipopt::Solve_Succeeded ||
-      status == Ipopt::Solved_To_Acceptable_Level) {
+  if (solved) {
     // Retrieve some statistics about the solve
-    Ipopt::Index iter_count = app->Statistics()->IterationCount();
+    Ipopt::Index iter_count = app_->Statistics()->IterationCount();
     ADEBUG << "*** The problem solved in " << iter_count << " iterations!";
 
-    Ipopt::Number final_obj = app->Statistics()->FinalObjective();
+    Ipopt::Number final_obj = app_->Statistics()->FinalObjective();
     ADEBUG << "*** The final value of the objective function is " << final_obj
            << '.';
 
@@ -145,8 +143,7 @@ bool DistanceApproachProblem::Solve(
   ptop->get_optimization_results(state_result, control_result, time_result,
                                  dual_l_result, dual_n_result);
 
-  return status == Ipopt::Solve_Succeeded ||
-         status == Ipopt::Solved_To_Acceptable_Level;
+  return solved;
 }
 
 }  // namespace planning
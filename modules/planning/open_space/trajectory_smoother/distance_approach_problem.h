@@ -57,6 +57,11 @@ class DistanceApproachProblem {
 
  private:
   PlannerOpenSpaceConfig planner_open_space_config_;
+
+  // ipopt application kept across solves so that option parsing and solver
+  // initialization are only paid once; the TNLP itself is rebuilt per solve
+  // since its dimensions follow the warm start horizon and obstacle edges
+  Ipopt::SmartPtr<Ipopt::IpoptApplication> app_;
 };
 
 }  // namespace planning
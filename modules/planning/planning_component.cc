@@ -23,6 +23,7 @@
 #include "modules/map/hdmap/hdmap_util.h"
 #include "modules/map/pnc_map/pnc_map.h"
 #include "modules/planning/common/planning_context.h"
+#include "modules/planning/common/trajectory/trajectory_delta.h"
 #include "modules/planning/navi_planning.h"
 #include "modules/planning/on_lane_planning.h"
 #include "modules/planning/open_space_planning.h"
@@ -89,6 +90,10 @@ bool PlanningComponent::Init() {
   }
   planning_writer_ =
       node_->CreateWriter<ADCTrajectory>(FLAGS_planning_trajectory_topic);
+  if (FLAGS_enable_trajectory_delta_publish) {
+    planning_delta_writer_ = node_->CreateWriter<ADCTrajectoryDelta>(
+        FLAGS_planning_trajectory_delta_topic);
+  }
 
   rerouting_writer_ =
       node_->CreateWriter<RoutingRequest>(FLAGS_routing_request_topic);
@@ -144,10 +149,35 @@ bool PlanningComponent::Proc(
   for (auto& p : *adc_trajectory_pb.mutable_trajectory_point()) {
     p.set_relative_time(p.relative_time() + dt);
   }
-  planning_writer_->Write(std::make_shared<ADCTrajectory>(adc_trajectory_pb));
+  PublishPlanningPb(adc_trajectory_pb);
   return true;
 }
 
+void PlanningComponent::PublishPlanningPb(const ADCTrajectory& trajectory_pb) {
+  auto trajectory_to_publish = std::make_shared<ADCTrajectory>(trajectory_pb);
+  if (!FLAGS_enable_trajectory_delta_publish) {
+    planning_writer_->Write(trajectory_to_publish);
+    return;
+  }
+
+  // Publish the stitched cycles differentially against the previous cycle;
+  // fall back to a full publication on replans, when the shared prefix is too
+  // short, and periodically so receivers that dropped a delta resynchronize.
+  ADCTrajectoryDelta delta;
+  if (last_published_trajectory_ != nullptr &&
+      cycles_since_full_publish_ + 1 <
+          FLAGS_trajectory_delta_full_publish_interval &&
+      TrajectoryDelta::Encode(*last_published_trajectory_, trajectory_pb,
+                              &delta)) {
+    planning_delta_writer_->Write(std::make_shared<ADCTrajectoryDelta>(delta));
+    ++cycles_since_full_publish_;
+  } else {
+    planning_writer_->Write(trajectory_to_publish);
+    cycles_since_full_publish_ = 0;
+  }
+  last_published_trajectory_ = trajectory_to_publish;
+}
+
 void PlanningComponent::CheckRerouting() {
   auto* rerouting =
       PlanningContext::MutablePlanningStatus()->mutable_rerouting();
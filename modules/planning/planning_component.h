@@ -30,6 +30,7 @@
 #include "modules/planning/proto/pad_msg.pb.h"
 #include "modules/planning/proto/planning.pb.h"
 #include "modules/planning/proto/planning_config.pb.h"
+#include "modules/planning/proto/trajectory_delta.pb.h"
 #include "modules/prediction/proto/prediction_obstacle.pb.h"
 #include "modules/routing/proto/routing.pb.h"
 
@@ -56,6 +57,7 @@ class PlanningComponent final
  private:
   void CheckRerouting();
   bool CheckInput();
+  void PublishPlanningPb(const ADCTrajectory& trajectory_pb);
 
   std::shared_ptr<cyber::Reader<perception::TrafficLightDetection>>
       traffic_light_reader_;
@@ -64,8 +66,14 @@ class PlanningComponent final
   std::shared_ptr<cyber::Reader<relative_map::MapMsg>> relative_map_reader_;
 
   std::shared_ptr<cyber::Writer<ADCTrajectory>> planning_writer_;
+  std::shared_ptr<cyber::Writer<ADCTrajectoryDelta>> planning_delta_writer_;
   std::shared_ptr<cyber::Writer<routing::RoutingRequest>> rerouting_writer_;
 
+  // the previous cycle's full trajectory, used as the base for differential
+  // publication when FLAGS_enable_trajectory_delta_publish is on
+  std::shared_ptr<ADCTrajectory> last_published_trajectory_;
+  int cycles_since_full_publish_ = 0;
+
   std::mutex mutex_;
   perception::TrafficLightDetection traffic_light_;
   routing::RoutingResponse routing_;
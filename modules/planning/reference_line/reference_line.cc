@@ -120,6 +120,7 @@ bool ReferenceLine::Stitch(const ReferenceLine& other) {
   }
   map_path_ = MapPath(std::move(std::vector<hdmap::MapPathPoint>(
       reference_points_.begin(), reference_points_.end())));
+  map_speed_limit_valid_ = false;
   return true;
 }
 
@@ -174,6 +175,7 @@ bool ReferenceLine::Shrink(const double s, double look_backward,
   }
   map_path_ = MapPath(std::move(std::vector<hdmap::MapPathPoint>(
       reference_points_.begin(), reference_points_.end())));
+  map_speed_limit_valid_ = false;
   return true;
 }
 
@@ -401,6 +403,67 @@ bool ReferenceLine::XYToSL(const common::math::Vec2d& xy_point,
   return true;
 }
 
+bool ReferenceLine::XYToSLBatch(
+    const std::vector<common::math::Vec2d>& xy_points,
+    std::vector<SLPoint>* const sl_points) const {
+  CHECK_NOTNULL(sl_points);
+  sl_points->clear();
+  sl_points->reserve(xy_points.size());
+  // extra margin around the hinted window to absorb path curvature.
+  constexpr double kHintBuffer = 5.0;
+  bool has_hint = false;
+  common::math::Vec2d hint_point;
+  double hint_s = 0.0;
+  double hint_distance = 0.0;
+  for (const auto& xy_point : xy_points) {
+    double s = 0.0;
+    double l = 0.0;
+    double distance = 0.0;
+    if (has_hint) {
+      // The nearest point of the previous input bounds how far away the
+      // projection of this one can be, so only segments inside that window
+      // need to be scanned.
+      const double radius =
+          hint_distance + hint_point.DistanceTo(xy_point) + kHintBuffer;
+      if (!map_path_.GetProjectionWithHueristicParams(
+              xy_point, hint_s - radius, hint_s + radius, &s, &l, &distance)) {
+        AERROR << "Cannot get nearest point from path.";
+        return false;
+      }
+    } else {
+      if (!map_path_.GetProjection(xy_point, &s, &l, &distance)) {
+        AERROR << "Cannot get nearest point from path.";
+        return false;
+      }
+    }
+    has_hint = true;
+    hint_point = xy_point;
+    hint_s = s;
+    hint_distance = distance;
+    SLPoint sl_point;
+    sl_point.set_s(s);
+    sl_point.set_l(l);
+    sl_points->push_back(std::move(sl_point));
+  }
+  return true;
+}
+
+bool ReferenceLine::SLToXYBatch(
+    const std::vector<SLPoint>& sl_points,
+    std::vector<common::math::Vec2d>* const xy_points) const {
+  CHECK_NOTNULL(xy_points);
+  xy_points->clear();
+  xy_points->reserve(sl_points.size());
+  for (const auto& sl_point : sl_points) {
+    common::math::Vec2d xy_point;
+    if (!SLToXY(sl_point, &xy_point)) {
+      return false;
+    }
+    xy_points->push_back(xy_point);
+  }
+  return true;
+}
+
 ReferencePoint ReferenceLine::InterpolateWithMatchedIndex(
     const ReferencePoint& p0, const double s0, const ReferencePoint& p1,
     const double s1, const InterpolatedIndex& index) const {
@@ -651,31 +714,29 @@ bool ReferenceLine::GetSLBoundary(const common::math::Box2d& box,
   std::vector<common::math::Vec2d> corners;
   box.GetAllCorners(&corners);
 
-  // The order must be counter-clockwise
-  std::vector<SLPoint> sl_corners;
-  for (const auto& point : corners) {
-    SLPoint sl_point;
-    if (!XYToSL(point, &sl_point)) {
-      AERROR << "Failed to get projection for point: " << point.DebugString()
-             << " on reference line.";
-      return false;
-    }
-    sl_corners.push_back(std::move(sl_point));
+  // Project the corners and the edge midpoints in one batch, so the eight
+  // clustered points share one full nearest-segment search.
+  std::vector<common::math::Vec2d> query_points = corners;
+  for (size_t i = 0; i < corners.size(); ++i) {
+    query_points.push_back(
+        (corners[i] + corners[(i + 1) % corners.size()]) * 0.5);
+  }
+  std::vector<SLPoint> query_sl_points;
+  if (!XYToSLBatch(query_points, &query_sl_points)) {
+    AERROR << "Failed to get projection for box: " << box.DebugString()
+           << " on reference line.";
+    return false;
   }
 
+  // The order must be counter-clockwise
+  const std::vector<SLPoint> sl_corners(
+      query_sl_points.begin(), query_sl_points.begin() + corners.size());
+
   for (size_t i = 0; i < corners.size(); ++i) {
     auto index0 = i;
     auto index1 = (i + 1) % corners.size();
-    const auto& p0 = corners[index0];
-    const auto& p1 = corners[index1];
-
-    const auto p_mid = (p0 + p1) * 0.5;
-    SLPoint sl_point_mid;
-    if (!XYToSL(p_mid, &sl_point_mid)) {
-      AERROR << "Failed to get projection for point: " << p_mid.DebugString()
-             << " on reference line.";
-      return false;
-    }
+
+    const auto& sl_point_mid = query_sl_points[corners.size() + i];
 
     Vec2d v0(sl_corners[index1].s() - sl_corners[index0].s(),
              sl_corners[index1].l() - sl_corners[index0].l());
@@ -716,13 +777,17 @@ bool ReferenceLine::GetSLBoundary(const hdmap::Polygon& polygon,
   double end_s(std::numeric_limits<double>::lowest());
   double start_l(std::numeric_limits<double>::max());
   double end_l(std::numeric_limits<double>::lowest());
+  std::vector<common::math::Vec2d> xy_points;
+  xy_points.reserve(polygon.point_size());
   for (const auto& point : polygon.point()) {
-    SLPoint sl_point;
-    if (!XYToSL(point, &sl_point)) {
-      AERROR << "Failed to get projection for point: " << point.DebugString()
-             << " on reference line.";
-      return false;
-    }
+    xy_points.emplace_back(point.x(), point.y());
+  }
+  std::vector<SLPoint> sl_points;
+  if (!XYToSLBatch(xy_points, &sl_points)) {
+    AERROR << "Failed to get projection for polygon on reference line.";
+    return false;
+  }
+  for (const auto& sl_point : sl_points) {
     start_s = std::fmin(start_s, sl_point.s());
     end_s = std::fmax(end_s, sl_point.s());
     start_l = std::fmin(start_l, sl_point.l());
@@ -776,23 +841,93 @@ std::string ReferenceLine::DebugString() const {
           reference_points_.begin(), reference_points_.begin() + limit, ""));
 }
 
+void ReferenceLine::BuildMapSpeedLimit() const {
+  map_speed_limit_.clear();
+  const auto& accumulated_s = map_path_.accumulated_s();
+  for (size_t i = 0; i < reference_points_.size(); ++i) {
+    double limit = FLAGS_planning_upper_speed_limit;
+    for (const auto& lane_waypoint : reference_points_[i].lane_waypoints()) {
+      if (lane_waypoint.lane == nullptr) {
+        AWARN << "lane_waypoint.lane is nullptr.";
+        continue;
+      }
+      limit = std::fmin(lane_waypoint.lane->lane().speed_limit(), limit);
+    }
+    if (map_speed_limit_.empty() ||
+        map_speed_limit_.back().speed_limit != limit) {
+      map_speed_limit_.emplace_back(accumulated_s[i], accumulated_s[i], limit);
+    }
+    map_speed_limit_.back().end_s = accumulated_s[i];
+  }
+  map_speed_limit_valid_ = true;
+}
+
 double ReferenceLine::GetSpeedLimitFromS(const double s) const {
-  for (const auto& speed_limit : speed_limit_) {
-    if (s >= speed_limit.start_s && s <= speed_limit.end_s) {
-      return speed_limit.speed_limit;
+  // The override intervals are kept sorted and disjoint by AddSpeedLimit, so
+  // a binary search replaces the per-call linear scan.
+  auto it = std::upper_bound(speed_limit_.begin(), speed_limit_.end(), s,
+                             [](const double s, const SpeedLimit& limit) {
+                               return s < limit.start_s;
+                             });
+  if (it != speed_limit_.begin()) {
+    const auto& limit = *(it - 1);
+    if (s <= limit.end_s) {
+      return limit.speed_limit;
     }
   }
-  const auto& map_path_point = GetReferencePoint(s);
-  double speed_limit = FLAGS_planning_upper_speed_limit;
-  for (const auto& lane_waypoint : map_path_point.lane_waypoints()) {
-    if (lane_waypoint.lane == nullptr) {
-      AWARN << "lane_waypoint.lane is nullptr.";
+  if (!map_speed_limit_valid_) {
+    BuildMapSpeedLimit();
+  }
+  if (map_speed_limit_.empty()) {
+    return FLAGS_planning_upper_speed_limit;
+  }
+  auto map_it =
+      std::upper_bound(map_speed_limit_.begin(), map_speed_limit_.end(), s,
+                       [](const double s, const SpeedLimit& limit) {
+                         return s < limit.start_s;
+                       });
+  if (map_it != map_speed_limit_.begin()) {
+    --map_it;
+  }
+  return map_it->speed_limit;
+}
+
+void ReferenceLine::GetSpeedLimitsFromS(
+    const std::vector<double>& s_list,
+    std::vector<double>* speed_limits) const {
+  CHECK_NOTNULL(speed_limits);
+  speed_limits->clear();
+  speed_limits->reserve(s_list.size());
+  if (!map_speed_limit_valid_) {
+    BuildMapSpeedLimit();
+  }
+  size_t override_index = 0;
+  size_t map_index = 0;
+  double prev_s = -std::numeric_limits<double>::max();
+  for (const double s : s_list) {
+    if (s < prev_s) {
+      // Out-of-order s; fall back to a stabbing query for this point.
+      speed_limits->push_back(GetSpeedLimitFromS(s));
       continue;
     }
-    speed_limit =
-        std::fmin(lane_waypoint.lane->lane().speed_limit(), speed_limit);
+    prev_s = s;
+    while (override_index < speed_limit_.size() &&
+           s > speed_limit_[override_index].end_s) {
+      ++override_index;
+    }
+    if (override_index < speed_limit_.size() &&
+        s >= speed_limit_[override_index].start_s) {
+      speed_limits->push_back(speed_limit_[override_index].speed_limit);
+      continue;
+    }
+    while (map_index + 1 < map_speed_limit_.size() &&
+           s >= map_speed_limit_[map_index + 1].start_s) {
+      ++map_index;
+    }
+    speed_limits->push_back(map_speed_limit_.empty()
+                                ? FLAGS_planning_upper_speed_limit
+                                : map_speed_limit_[map_index].speed_limit);
   }
-  return speed_limit;
 }
 
 void ReferenceLine::AddSpeedLimit(double start_s, double end_s,
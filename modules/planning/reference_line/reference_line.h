@@ -117,6 +117,23 @@ class ReferenceLine {
     return XYToSL(common::math::Vec2d(xy.x(), xy.y()), sl_point);
   }
 
+  /**
+   * @brief Batched version of XYToSL for clustered points such as the
+   *        corners of one obstacle polygon. The first point is projected
+   *        with a full nearest-segment search and each result seeds a
+   *        search window for the next point, so n points cost one full
+   *        scan of the reference line instead of n.
+   */
+  bool XYToSLBatch(const std::vector<common::math::Vec2d>& xy_points,
+                   std::vector<common::SLPoint>* const sl_points) const;
+
+  /**
+   * @brief Batched version of SLToXY; fails if any point cannot be
+   *        converted.
+   */
+  bool SLToXYBatch(const std::vector<common::SLPoint>& sl_points,
+                   std::vector<common::math::Vec2d>* const xy_points) const;
+
   bool GetLaneWidth(const double s, double* const lane_left_width,
                     double* const lane_right_width) const;
 
@@ -168,6 +185,14 @@ class ReferenceLine {
 
   double GetSpeedLimitFromS(const double s) const;
 
+  /**
+   * @brief Batch version of GetSpeedLimitFromS for a non-decreasing list of
+   * s values, e.g. the s array of a discretized path. The merged speed limit
+   * intervals are walked once instead of being queried point by point.
+   */
+  void GetSpeedLimitsFromS(const std::vector<double>& s_list,
+                           std::vector<double>* speed_limits) const;
+
   void AddSpeedLimit(double start_s, double end_s, double speed_limit);
 
   uint32_t GetPriority() const { return priority_; }
@@ -215,10 +240,24 @@ class ReferenceLine {
     SpeedLimit(double _start_s, double _end_s, double _speed_limit)
         : start_s(_start_s), end_s(_end_s), speed_limit(_speed_limit) {}
   };
+  /**
+   * @brief Rebuild the merged speed limit intervals from the lane speed
+   * limits along map_path_. The intervals are sorted, disjoint and cover
+   * [0, Length()], so queries can binary search instead of interpolating a
+   * reference point per call.
+   */
+  void BuildMapSpeedLimit() const;
+
   /**
    * This speed limit overrides the lane speed limit
    **/
   std::vector<SpeedLimit> speed_limit_;
+  /**
+   * Merged lane speed limit intervals, built lazily from map_path_ and
+   * invalidated whenever the path is re-assembled (Stitch/Shrink).
+   **/
+  mutable std::vector<SpeedLimit> map_speed_limit_;
+  mutable bool map_speed_limit_valid_ = false;
   std::vector<ReferencePoint> reference_points_;
   hdmap::Path map_path_;
   uint32_t priority_ = 0;
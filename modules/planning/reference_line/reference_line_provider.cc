@@ -141,46 +141,47 @@ void ReferenceLineProvider::UpdateReferenceLine(
            << ") are different";
     return;
   }
-  std::lock_guard<std::mutex> lock(reference_lines_mutex_);
-  if (reference_lines_.size() != reference_lines.size()) {
-    reference_lines_ = reference_lines;
-    route_segments_ = route_segments;
-
+  // The new snapshot is assembled without holding any lock; the smoothing
+  // work and the copies below never block the planning thread.
+  const auto previous = std::atomic_load(&snapshot_);
+  auto snapshot = std::make_shared<ReferenceLineSnapshot>();
+  if (previous == nullptr ||
+      previous->reference_lines.size() != reference_lines.size()) {
+    snapshot->reference_lines = reference_lines;
+    snapshot->route_segments = route_segments;
   } else {
     auto segment_iter = route_segments.begin();
-    auto internal_iter = reference_lines_.begin();
-    auto internal_segment_iter = route_segments_.begin();
-    for (auto iter = reference_lines.begin();
-         iter != reference_lines.end() &&
-         segment_iter != route_segments.end() &&
-         internal_iter != reference_lines_.end() &&
-         internal_segment_iter != route_segments_.end();
-         ++iter, ++segment_iter, ++internal_iter, ++internal_segment_iter) {
-      if (iter->reference_points().empty()) {
-        *internal_iter = *iter;
-        *internal_segment_iter = *segment_iter;
-        continue;
-      }
-      if (common::util::SamePointXY(
+    auto previous_iter = previous->reference_lines.begin();
+    auto previous_segment_iter = previous->route_segments.begin();
+    for (auto iter = reference_lines.begin(); iter != reference_lines.end();
+         ++iter, ++segment_iter, ++previous_iter, ++previous_segment_iter) {
+      // keep the previous line when the new one matches it, so downstream
+      // consumers see stable geometry across cycles.
+      if (!iter->reference_points().empty() &&
+          common::util::SamePointXY(
               iter->reference_points().front(),
-              internal_iter->reference_points().front()) &&
-          common::util::SamePointXY(iter->reference_points().back(),
-                                    internal_iter->reference_points().back()) &&
-          std::fabs(iter->Length() - internal_iter->Length()) <
+              previous_iter->reference_points().front()) &&
+          common::util::SamePointXY(
+              iter->reference_points().back(),
+              previous_iter->reference_points().back()) &&
+          std::fabs(iter->Length() - previous_iter->Length()) <
               common::math::kMathEpsilon) {
-        continue;
+        snapshot->reference_lines.push_back(*previous_iter);
+        snapshot->route_segments.push_back(*previous_segment_iter);
+      } else {
+        snapshot->reference_lines.push_back(*iter);
+        snapshot->route_segments.push_back(*segment_iter);
       }
-      *internal_iter = *iter;
-      *internal_segment_iter = *segment_iter;
     }
   }
+  std::atomic_store(&snapshot_,
+                    std::shared_ptr<const ReferenceLineSnapshot>(snapshot));
   // update history
-  reference_line_history_.push(reference_lines_);
-  route_segments_history_.push(route_segments_);
-  constexpr int kMaxHistoryNum = 3;
-  if (reference_line_history_.size() > kMaxHistoryNum) {
-    reference_line_history_.pop();
-    route_segments_history_.pop();
+  std::lock_guard<std::mutex> lock(snapshot_history_mutex_);
+  snapshot_history_.push(std::move(snapshot));
+  constexpr size_t kMaxHistoryNum = 3;
+  if (snapshot_history_.size() > kMaxHistoryNum) {
+    snapshot_history_.pop();
   }
 }
 
@@ -201,19 +202,17 @@ void ReferenceLineProvider::GenerateThread() {
     }
     UpdateReferenceLine(reference_lines, segments);
     const double end_time = Clock::NowInSeconds();
-    std::lock_guard<std::mutex> lock(reference_lines_mutex_);
     last_calculation_time_ = end_time - start_time;
   }
 }
 
 double ReferenceLineProvider::LastTimeDelay() {
-  if (FLAGS_enable_reference_line_provider_thread &&
-      !FLAGS_use_navigation_mode) {
-    std::lock_guard<std::mutex> lock(reference_lines_mutex_);
-    return last_calculation_time_;
-  } else {
-    return last_calculation_time_;
-  }
+  return last_calculation_time_;
+}
+
+std::shared_ptr<const ReferenceLineSnapshot>
+ReferenceLineProvider::GetReferenceLineSnapshot() const {
+  return std::atomic_load(&snapshot_);
 }
 
 bool ReferenceLineProvider::GetReferenceLines(
@@ -234,10 +233,12 @@ bool ReferenceLineProvider::GetReferenceLines(
   }
 
   if (FLAGS_enable_reference_line_provider_thread) {
-    std::lock_guard<std::mutex> lock(reference_lines_mutex_);
-    if (!reference_lines_.empty()) {
-      reference_lines->assign(reference_lines_.begin(), reference_lines_.end());
-      segments->assign(route_segments_.begin(), route_segments_.end());
+    const auto snapshot = std::atomic_load(&snapshot_);
+    if (snapshot != nullptr && !snapshot->reference_lines.empty()) {
+      reference_lines->assign(snapshot->reference_lines.begin(),
+                              snapshot->reference_lines.end());
+      segments->assign(snapshot->route_segments.begin(),
+                       snapshot->route_segments.end());
       return true;
     }
   } else {
@@ -251,15 +252,22 @@ bool ReferenceLineProvider::GetReferenceLines(
   }
 
   AWARN << "Reference line is NOT ready.";
-  if (reference_line_history_.empty()) {
+  std::shared_ptr<const ReferenceLineSnapshot> history;
+  {
+    std::lock_guard<std::mutex> lock(snapshot_history_mutex_);
+    if (!snapshot_history_.empty()) {
+      history = snapshot_history_.back();
+    }
+  }
+  if (history == nullptr) {
     AERROR << "Failed to use reference line latest history";
     return false;
   }
 
-  reference_lines->assign(reference_line_history_.back().begin(),
-                          reference_line_history_.back().end());
-  segments->assign(route_segments_history_.back().begin(),
-                   route_segments_history_.back().end());
+  reference_lines->assign(history->reference_lines.begin(),
+                          history->reference_lines.end());
+  segments->assign(history->route_segments.begin(),
+                   history->route_segments.end());
   AWARN << "Use reference line from history!";
   return true;
 }
@@ -607,17 +615,21 @@ bool ReferenceLineProvider::ExtendReferenceLine(const VehicleState &state,
                                                 ReferenceLine *reference_line) {
   RouteSegments segment_properties;
   segment_properties.SetProperties(*segments);
-  auto prev_segment = route_segments_.begin();
-  auto prev_ref = reference_lines_.begin();
-  while (prev_segment != route_segments_.end()) {
+  const auto previous = std::atomic_load(&snapshot_);
+  if (previous == nullptr) {
+    return SmoothRouteSegment(*segments, reference_line);
+  }
+  auto prev_segment = previous->route_segments.begin();
+  auto prev_ref = previous->reference_lines.begin();
+  while (prev_segment != previous->route_segments.end()) {
     if (prev_segment->IsConnectedSegment(*segments)) {
       break;
     }
     ++prev_segment;
     ++prev_ref;
   }
-  if (prev_segment == route_segments_.end()) {
-    if (!route_segments_.empty() && segments->IsOnSegment()) {
+  if (prev_segment == previous->route_segments.end()) {
+    if (!previous->route_segments.empty() && segments->IsOnSegment()) {
       AWARN << "Current route segment is not connected with previous route "
                "segment";
     }
@@ -859,7 +871,10 @@ bool ReferenceLineProvider::SmoothPrefixedReferenceLine(
   // generate anchor points:
   std::vector<AnchorPoint> anchor_points;
   GetAnchorPoints(raw_ref, &anchor_points);
-  // modify anchor points based on prefix_ref
+  // Pin every anchor point that lies on prefix_ref to the already smoothed
+  // geometry. The solver then only has freedom on the newly extended
+  // anchors, while the pinned overlap blends the seam with the spline's
+  // built-in continuity constraints instead of re-solving the whole window.
   for (auto &point : anchor_points) {
     common::SLPoint sl_point;
     Vec2d xy{point.path_point.x(), point.path_point.y()};
@@ -877,7 +892,6 @@ bool ReferenceLineProvider::SmoothPrefixedReferenceLine(
     point.longitudinal_bound = 1e-6;
     point.lateral_bound = 1e-6;
     point.enforced = true;
-    break;
   }
 
   smoother_->SetAnchorPoints(anchor_points);
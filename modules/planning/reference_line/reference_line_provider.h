@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <memory>
 #include <queue>
@@ -52,6 +53,18 @@
 namespace apollo {
 namespace planning {
 
+/**
+ * @struct ReferenceLineSnapshot
+ * @brief An immutable bundle of reference lines and their route segments,
+ *        published by the provider as a whole. Consumers hold it through a
+ *        shared_ptr, so reading never blocks the generation thread and a
+ *        snapshot stays valid while newer ones are published.
+ */
+struct ReferenceLineSnapshot {
+  std::list<ReferenceLine> reference_lines;
+  std::list<hdmap::RouteSegments> route_segments;
+};
+
 /**
  * @class ReferenceLineProvider
  * @brief The class of ReferenceLineProvider.
@@ -80,6 +93,13 @@ class ReferenceLineProvider {
   bool GetReferenceLines(std::list<ReferenceLine>* reference_lines,
                          std::list<hdmap::RouteSegments>* segments);
 
+  /**
+   * @brief Get the latest published snapshot without copying any reference
+   *        line. Returns nullptr before the first snapshot is published.
+   */
+  std::shared_ptr<const ReferenceLineSnapshot> GetReferenceLineSnapshot()
+      const;
+
   double LastTimeDelay();
 
   std::vector<routing::LaneWaypoint> FutureRouteWaypoints();
@@ -172,13 +192,17 @@ class ReferenceLineProvider {
   routing::RoutingResponse routing_;
   bool has_routing_ = false;
 
-  std::mutex reference_lines_mutex_;
-  std::list<ReferenceLine> reference_lines_;
-  std::list<hdmap::RouteSegments> route_segments_;
-  double last_calculation_time_ = 0.0;
+  // The latest published snapshot. Accessed only through std::atomic_load /
+  // std::atomic_store; the generation thread assembles a new snapshot off to
+  // the side and swaps the pointer, so the planning thread never waits for
+  // smoothing.
+  std::shared_ptr<const ReferenceLineSnapshot> snapshot_;
+
+  std::atomic<double> last_calculation_time_{0.0};
 
-  std::queue<std::list<ReferenceLine>> reference_line_history_;
-  std::queue<std::list<hdmap::RouteSegments>> route_segments_history_;
+  // Recently published snapshots, kept as a fallback when generation fails.
+  std::mutex snapshot_history_mutex_;
+  std::queue<std::shared_ptr<const ReferenceLineSnapshot>> snapshot_history_;
 
   std::future<void> task_future_;
 };
@@ -91,7 +91,12 @@ bool Stage::ExecuteTaskOnReferenceLine(
 
     auto ret = common::Status::OK();
     for (auto* task : task_list_) {
+      const double start_timestamp = Clock::NowInSeconds();
       ret = task->Execute(frame, &reference_line_info);
+      const double end_timestamp = Clock::NowInSeconds();
+      const double time_diff_ms = (end_timestamp - start_timestamp) * 1000;
+      ADEBUG << task->Name() << " time spend: " << time_diff_ms << " ms.";
+      RecordDebugInfo(&reference_line_info, task->Name(), time_diff_ms);
       if (!ret.ok()) {
         AERROR << "Failed to run tasks[" << task->Name()
                << "], Error message: " << ret.error_message();
@@ -121,10 +126,33 @@ bool Stage::ExecuteTaskOnReferenceLine(
   return true;
 }
 
+void Stage::RecordDebugInfo(ReferenceLineInfo* reference_line_info,
+                            const std::string& name,
+                            const double time_diff_ms) {
+  if (!FLAGS_enable_record_debug) {
+    ADEBUG << "Skip record debug info";
+    return;
+  }
+  if (reference_line_info == nullptr) {
+    AERROR << "Reference line info is null.";
+    return;
+  }
+
+  auto ptr_latency_stats = reference_line_info->mutable_latency_stats();
+
+  auto ptr_stats = ptr_latency_stats->add_task_stats();
+  ptr_stats->set_name(name);
+  ptr_stats->set_time_ms(time_diff_ms);
+}
+
 bool Stage::ExecuteTaskOnOpenSpace(Frame* frame) {
   auto ret = common::Status::OK();
   for (auto* task : task_list_) {
+    const double start_timestamp = Clock::NowInSeconds();
     ret = task->Execute(frame);
+    const double end_timestamp = Clock::NowInSeconds();
+    ADEBUG << task->Name() << " time spend: "
+           << (end_timestamp - start_timestamp) * 1000 << " ms.";
     if (!ret.ok()) {
       AERROR << "Failed to run tasks[" << task->Name()
              << "], Error message: " << ret.error_message();
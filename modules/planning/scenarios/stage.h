@@ -86,6 +86,9 @@ class Stage {
 
   bool ExecuteTaskOnOpenSpace(Frame* frame);
 
+  void RecordDebugInfo(ReferenceLineInfo* reference_line_info,
+                       const std::string& name, const double time_diff_ms);
+
   virtual Stage::StageStatus FinishScenario();
 
  protected:
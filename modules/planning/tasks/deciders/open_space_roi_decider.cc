@@ -51,7 +51,6 @@ Status OpenSpaceRoiDecider::Process(Frame *frame) {
   }
 
   vehicle_state_ = frame->vehicle_state();
-  ROI_parking_boundary_.clear();
   obstacles_by_frame_ = frame->GetObstacleList();
   const auto &routing_request = frame->local_view().routing->routing_request();
   if (routing_request.has_parking_space() &&
@@ -262,6 +261,25 @@ bool OpenSpaceRoiDecider::GetOpenSpaceROI(Frame *frame) {
     return false;
   }
 
+  // The parking boundary only depends on map geometry, so it stays the same
+  // across cycles as long as the target parking spot does. Rebuild it when
+  // the spot changes and reuse the cached products otherwise
+  if (target_parking_spot_id_ != cached_parking_spot_id_) {
+    if (!BuildParkingSpotROI(target_parking_spot, &nearby_path)) {
+      return false;
+    }
+    cached_parking_spot_id_ = target_parking_spot_id_;
+  }
+
+  return LoadRoiIntoFrame(frame);
+}
+
+bool OpenSpaceRoiDecider::BuildParkingSpotROI(
+    ParkingSpaceInfoConstPtr target_parking_spot,
+    std::shared_ptr<Path> *nearby_path_ptr) {
+  const std::shared_ptr<Path> &nearby_path = *nearby_path_ptr;
+  ROI_parking_boundary_.clear();
+
   // left or right of the parking lot is decided when viewing the parking spot
   // open upward
   Vec2d left_top = target_parking_spot->polygon().points().at(3);
@@ -281,13 +299,10 @@ bool OpenSpaceRoiDecider::GetOpenSpaceROI(Frame *frame) {
   average_l = (left_top_l + right_top_l) / 2.0;
   // start or end, left or right of the lane and s is decided by the lane's
   // heading
+  const auto &roi_config = config_.open_space_roi_decider_config();
   double center_line_s = (left_top_s + right_top_s) / 2.0;
-  double start_s =
-      center_line_s -
-      config_.open_space_roi_decider_config().roi_longitudinal_range();
-  double end_s =
-      center_line_s +
-      config_.open_space_roi_decider_config().roi_longitudinal_range();
+  double start_s = center_line_s - roi_config.roi_longitudinal_range();
+  double end_s = center_line_s + roi_config.roi_longitudinal_range();
 
   std::vector<Vec2d> left_lane_boundary;
   std::vector<Vec2d> right_lane_boundary;
@@ -306,13 +321,10 @@ bool OpenSpaceRoiDecider::GetOpenSpaceROI(Frame *frame) {
     double check_point_heading = check_point.heading();
     if (std::abs(common::math::NormalizeAngle(check_point_heading -
                                               last_check_point_heading)) <
-            config_.open_space_roi_decider_config()
-                .roi_linesegment_min_angle() &&
+            roi_config.roi_linesegment_min_angle() &&
         check_point_s != start_s && check_point_s != end_s) {
       index += 1.0;
-      check_point_s =
-          index *
-          config_.open_space_roi_decider_config().roi_linesegment_length();
+      check_point_s = index * roi_config.roi_linesegment_length();
       check_point_s = check_point_s >= end_s ? end_s : check_point_s;
       last_check_point_heading = check_point_heading;
       continue;
@@ -341,9 +353,7 @@ bool OpenSpaceRoiDecider::GetOpenSpaceROI(Frame *frame) {
       break;
     }
     index += 1.0;
-    check_point_s =
-        index *
-        config_.open_space_roi_decider_config().roi_linesegment_length();
+    check_point_s = index * roi_config.roi_linesegment_length();
     check_point_s = check_point_s >= end_s ? end_s : check_point_s;
     last_check_point_heading = check_point_heading;
   }
@@ -351,11 +361,8 @@ bool OpenSpaceRoiDecider::GetOpenSpaceROI(Frame *frame) {
   // rotate the points to have the lane to be horizontal to x axis positive
   // direction and scale them base on the origin point
   Vec2d heading_vec = right_top - left_top;
-  frame->mutable_open_space_info()->set_origin_heading(heading_vec.Angle());
-  frame->mutable_open_space_info()->mutable_origin_point()->set_x(left_top.x());
-  frame->mutable_open_space_info()->mutable_origin_point()->set_y(left_top.y());
-  const auto &origin_point = frame->open_space_info().origin_point();
-  const auto &origin_heading = frame->open_space_info().origin_heading();
+  const double origin_heading = heading_vec.Angle();
+  const Vec2d origin_point(left_top.x(), left_top.y());
 
   DCHECK_EQ(right_lane_boundary.size(), left_lane_boundary.size());
   DCHECK_EQ(center_lane_boundary.size(), left_lane_boundary.size());
@@ -566,32 +573,16 @@ bool OpenSpaceRoiDecider::GetOpenSpaceROI(Frame *frame) {
   auto yminmax = std::minmax_element(
       boundary_points.begin(), boundary_points.end(),
       [](const Vec2d &a, const Vec2d &b) { return a.y() < b.y(); });
-  std::vector<double> ROI_xy_boundary{xminmax.first->x(), xminmax.second->x(),
-                                      yminmax.first->y(), yminmax.second->y()};
-  auto *xy_boundary =
-      frame_->mutable_open_space_info()->mutable_ROI_xy_boundary();
-  xy_boundary->assign(ROI_xy_boundary.begin(), ROI_xy_boundary.end());
-
-  Vec2d vehicle_xy = Vec2d(vehicle_state_.x(), vehicle_state_.y());
-  vehicle_xy -= origin_point;
-  vehicle_xy.SelfRotate(-origin_heading);
-  if (vehicle_xy.x() < ROI_xy_boundary[0] ||
-      vehicle_xy.x() > ROI_xy_boundary[1] ||
-      vehicle_xy.y() < ROI_xy_boundary[2] ||
-      vehicle_xy.y() > ROI_xy_boundary[3]) {
-    AERROR << "vehicle outside of xy boundary of parking ROI";
-    return false;
-  }
+  cached_xy_boundary_ = {xminmax.first->x(), xminmax.second->x(),
+                         yminmax.first->y(), yminmax.second->y()};
 
   // Get end_pose of the parking spot
   double parking_spot_heading = (left_down - left_top).Angle();
   double end_x = (left_top.x() + right_top.x()) / 2.0;
   double end_y = 0.0;
-  const double parking_depth_buffer =
-      config_.open_space_roi_decider_config().parking_depth_buffer();
+  const double parking_depth_buffer = roi_config.parking_depth_buffer();
   CHECK_GE(parking_depth_buffer, 0.0);
-  const bool parking_inwards =
-      config_.open_space_roi_decider_config().parking_inwards();
+  const bool parking_inwards = roi_config.parking_inwards();
   const double top_to_down_distance = left_top.y() - left_down.y();
   if (parking_spot_heading > common::math::kMathEpsilon) {
     if (parking_inwards) {
@@ -618,17 +609,48 @@ bool OpenSpaceRoiDecider::GetOpenSpaceROI(Frame *frame) {
     }
   }
 
-  auto *end_pose =
-      frame_->mutable_open_space_info()->mutable_open_space_end_pose();
-  end_pose->emplace_back(end_x);
-  end_pose->emplace_back(end_y);
-  if (config_.open_space_roi_decider_config().parking_inwards()) {
-    end_pose->emplace_back(parking_spot_heading);
+  cached_end_pose_.clear();
+  cached_end_pose_.emplace_back(end_x);
+  cached_end_pose_.emplace_back(end_y);
+  if (parking_inwards) {
+    cached_end_pose_.emplace_back(parking_spot_heading);
   } else {
-    end_pose->emplace_back(
+    cached_end_pose_.emplace_back(
         common::math::NormalizeAngle(parking_spot_heading + M_PI));
   }
-  end_pose->emplace_back(0.0);
+  cached_end_pose_.emplace_back(0.0);
+
+  cached_origin_heading_ = origin_heading;
+  cached_origin_point_ = origin_point;
+
+  return true;
+}
+
+bool OpenSpaceRoiDecider::LoadRoiIntoFrame(Frame *frame) {
+  frame->mutable_open_space_info()->set_origin_heading(cached_origin_heading_);
+  frame->mutable_open_space_info()->mutable_origin_point()->set_x(
+      cached_origin_point_.x());
+  frame->mutable_open_space_info()->mutable_origin_point()->set_y(
+      cached_origin_point_.y());
+
+  auto *xy_boundary =
+      frame->mutable_open_space_info()->mutable_ROI_xy_boundary();
+  xy_boundary->assign(cached_xy_boundary_.begin(), cached_xy_boundary_.end());
+
+  Vec2d vehicle_xy = Vec2d(vehicle_state_.x(), vehicle_state_.y());
+  vehicle_xy -= cached_origin_point_;
+  vehicle_xy.SelfRotate(-cached_origin_heading_);
+  if (vehicle_xy.x() < cached_xy_boundary_[0] ||
+      vehicle_xy.x() > cached_xy_boundary_[1] ||
+      vehicle_xy.y() < cached_xy_boundary_[2] ||
+      vehicle_xy.y() > cached_xy_boundary_[3]) {
+    AERROR << "vehicle outside of xy boundary of parking ROI";
+    return false;
+  }
+
+  auto *end_pose =
+      frame->mutable_open_space_info()->mutable_open_space_end_pose();
+  end_pose->assign(cached_end_pose_.begin(), cached_end_pose_.end());
 
   return true;
 }
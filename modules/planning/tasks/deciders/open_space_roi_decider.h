@@ -77,6 +77,17 @@ class OpenSpaceRoiDecider : public Decider {
   // ROI_xy_boundary_ and ROI_parking_boundary_
   bool GetOpenSpaceROI(Frame *frame);
 
+  // @brief discretize the lane boundary around the parking spot and build
+  // ROI_parking_boundary_ together with the cached xy boundary and end pose.
+  // The result only depends on map geometry, so it is rebuilt only when the
+  // target parking spot changes
+  bool BuildParkingSpotROI(hdmap::ParkingSpaceInfoConstPtr target_parking_spot,
+                           std::shared_ptr<hdmap::Path> *nearby_path);
+
+  // @brief load the cached ROI products into the frame and check that the
+  // vehicle is still inside the ROI xy boundary
+  bool LoadRoiIntoFrame(Frame *frame);
+
   // @brief Represent the obstacles in vertices and load it into
   // obstacles_vertices_vec_ in clock wise order. Take different approach
   // towards warm start and distance approach
@@ -124,6 +135,21 @@ class OpenSpaceRoiDecider : public Decider {
 
   // @brief parking_spot_id from routing
   std::string target_parking_spot_id_;
+
+  // @brief id of the parking spot ROI_parking_boundary_ and the cached
+  // products below were built for, so that boundary discretization runs
+  // once per parking spot instead of once per planning cycle
+  std::string cached_parking_spot_id_;
+
+  double cached_origin_heading_ = 0.0;
+
+  common::math::Vec2d cached_origin_point_;
+
+  // @brief cached {x_min, x_max, y_min, y_max} of the ROI
+  std::vector<double> cached_xy_boundary_;
+
+  // @brief cached {x, y, heading, speed} of the parking end pose
+  std::vector<double> cached_end_pose_;
 };
 }  // namespace planning
 }  // namespace apollo
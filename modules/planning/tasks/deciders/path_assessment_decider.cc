@@ -347,12 +347,18 @@ bool PathAssessmentDecider::IsCollidingWithStaticObstacles(
         kMinObstacleArea) {
       continue;
     }
-    // Convert into polygon and save it.
-    obstacle_polygons.push_back(
-        Polygon2d({Vec2d(obstacle_sl.start_s(), obstacle_sl.start_l()),
-                   Vec2d(obstacle_sl.start_s(), obstacle_sl.end_l()),
-                   Vec2d(obstacle_sl.end_s(), obstacle_sl.end_l()),
-                   Vec2d(obstacle_sl.end_s(), obstacle_sl.start_l())}));
+    // Reuse the SL hull cached when the obstacle joined the reference line;
+    // fall back to the SL bounding rectangle when it is unavailable.
+    const auto& sl_polygon = obstacle->PerceptionSLPolygon();
+    if (sl_polygon.num_points() >= 3) {
+      obstacle_polygons.push_back(sl_polygon);
+    } else {
+      obstacle_polygons.push_back(
+          Polygon2d({Vec2d(obstacle_sl.start_s(), obstacle_sl.start_l()),
+                     Vec2d(obstacle_sl.start_s(), obstacle_sl.end_l()),
+                     Vec2d(obstacle_sl.end_s(), obstacle_sl.end_l()),
+                     Vec2d(obstacle_sl.end_s(), obstacle_sl.start_l())}));
+    }
   }
 
   // Go through all the four corner points at every path pt, check collision.
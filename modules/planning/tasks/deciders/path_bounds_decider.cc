@@ -195,6 +195,35 @@ void PathBoundsDecider::InitPathBoundsDecider(
   } else {
     adc_lane_width_ = lane_left_width + lane_right_width;
   }
+
+  InitLaneWidthCache(reference_line);
+}
+
+void PathBoundsDecider::InitLaneWidthCache(
+    const ReferenceLine& reference_line) {
+  // The fallback and every lane-borrow candidate walk the same s-grid, so
+  // the lane widths are fetched once here and shared by all of them.
+  lane_widths_by_s_.clear();
+  double past_lane_left_width = adc_lane_width_ / 2.0;
+  double past_lane_right_width = adc_lane_width_ / 2.0;
+  for (double curr_s = adc_frenet_s_;
+       curr_s < std::min(adc_frenet_s_ + kPathBoundsDeciderHorizon,
+                         reference_line.Length());
+       curr_s += kPathBoundsDeciderResolution) {
+    double curr_lane_left_width = 0.0;
+    double curr_lane_right_width = 0.0;
+    if (!reference_line.GetLaneWidth(curr_s, &curr_lane_left_width,
+                                     &curr_lane_right_width)) {
+      AWARN << "Failed to get lane width at s = " << curr_s;
+      curr_lane_left_width = past_lane_left_width;
+      curr_lane_right_width = past_lane_right_width;
+    } else {
+      past_lane_left_width = curr_lane_left_width;
+      past_lane_right_width = curr_lane_right_width;
+    }
+    lane_widths_by_s_.emplace_back(curr_lane_left_width,
+                                   curr_lane_right_width);
+  }
 }
 
 std::string PathBoundsDecider::GenerateRegularPathBound(
@@ -308,11 +337,17 @@ bool PathBoundsDecider::GetBoundaryFromLanesAndADC(
   bool borrowing_reverse_lane = false;
   for (size_t i = 0; i < path_bound->size(); ++i) {
     double curr_s = std::get<0>((*path_bound)[i]);
-    // 1. Get the current lane width at current point.
+    // 1. Get the current lane width at current point, preferably from the
+    //    widths sampled once per cycle in InitLaneWidthCache().
     double curr_lane_left_width = 0.0;
     double curr_lane_right_width = 0.0;
-    if (!reference_line.GetLaneWidth(curr_s, &curr_lane_left_width,
-                                     &curr_lane_right_width)) {
+    if (i < lane_widths_by_s_.size()) {
+      curr_lane_left_width = lane_widths_by_s_[i].first;
+      curr_lane_right_width = lane_widths_by_s_[i].second;
+      past_lane_left_width = curr_lane_left_width;
+      past_lane_right_width = curr_lane_right_width;
+    } else if (!reference_line.GetLaneWidth(curr_s, &curr_lane_left_width,
+                                            &curr_lane_right_width)) {
       AWARN << "Failed to get lane width at s = " << curr_s;
       curr_lane_left_width = past_lane_left_width;
       curr_lane_right_width = past_lane_right_width;
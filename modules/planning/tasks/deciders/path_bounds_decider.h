@@ -25,6 +25,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -62,6 +63,12 @@ class PathBoundsDecider : public Decider {
   void InitPathBoundsDecider(const Frame& frame,
                              const ReferenceLineInfo& reference_line_info);
 
+  /** @brief Samples the lane width over the whole planning horizon in one
+   *   pass, so that every candidate boundary generated in this cycle reads
+   *   the cached widths instead of re-querying the map point by point.
+   */
+  void InitLaneWidthCache(const ReferenceLine& reference_line);
+
   /** @brief The regular path boundary generation considers the ADC itself
    *   and other static environments:
    *   - ADC's position (lane-changing considerations)
@@ -196,6 +203,9 @@ class PathBoundsDecider : public Decider {
   double adc_frenet_ld_ = 0.0;
   double adc_lane_width_ = 0.0;
   hdmap::LaneInfoConstPtr adc_lane_info_;
+  // (left, right) lane width at s = adc_frenet_s_ + i * resolution, on the
+  // same grid as the path bounds; refreshed once per Process() call.
+  std::vector<std::pair<double, double>> lane_widths_by_s_;
 
   FRIEND_TEST(PathBoundsDeciderTest, InitPathBoundary);
   FRIEND_TEST(PathBoundsDeciderTest, GetBoundaryFromLanesAndADC);
@@ -83,36 +83,30 @@ Status SpeedBoundsDecider::Process(
     return Status(ErrorCode::PLANNING_ERROR, msg);
   }
 
-  std::vector<const STBoundary *> boundaries;
-  for (auto *obstacle : path_decision->obstacles().Items()) {
-    const auto &id = obstacle->Id();
-    const auto &st_boundary = obstacle->st_boundary();
-    if (!st_boundary.IsEmpty()) {
-      if (st_boundary.boundary_type() == STBoundary::BoundaryType::KEEP_CLEAR) {
-        path_decision->Find(id)->SetBlockingObstacle(false);
-      } else {
-        path_decision->Find(id)->SetBlockingObstacle(true);
-      }
-      boundaries.push_back(&st_boundary);
-    }
-  }
-
-  // Set min_s_on_st_boundaries to guide speed fallback. Different stop distance
-  // is taken when there is an obstacle moving in opposite direction of ADV
+  // Collect the mapped st boundaries and set min_s_on_st_boundaries to guide
+  // speed fallback in one pass. Different stop distance is taken when there
+  // is an obstacle moving in opposite direction of ADV
   constexpr double kEpsilon = 1.0e-6;
   double min_s_non_reverse = std::numeric_limits<double>::infinity();
   double min_s_reverse = std::numeric_limits<double>::infinity();
+  std::vector<const STBoundary *> boundaries;
   for (auto *obstacle : path_decision->obstacles().Items()) {
-    const auto &st_boundary = obstacle->st_boundary();
-    if (!st_boundary.IsEmpty()) {
-      const auto &left_bottom_point = st_boundary.bottom_left_point();
-      const auto &right_bottom_point = st_boundary.bottom_right_point();
-      if (right_bottom_point.s() - left_bottom_point.s() > kEpsilon &&
-          min_s_reverse > left_bottom_point.s()) {
-        min_s_reverse = left_bottom_point.s();
-      } else if (min_s_non_reverse > left_bottom_point.s()) {
-        min_s_non_reverse = left_bottom_point.s();
-      }
+    auto *mutable_obstacle = path_decision->Find(obstacle->Id());
+    const auto &st_boundary = mutable_obstacle->st_boundary();
+    if (st_boundary.IsEmpty()) {
+      continue;
+    }
+    mutable_obstacle->SetBlockingObstacle(
+        st_boundary.boundary_type() != STBoundary::BoundaryType::KEEP_CLEAR);
+    boundaries.push_back(&st_boundary);
+
+    const auto &left_bottom_point = st_boundary.bottom_left_point();
+    const auto &right_bottom_point = st_boundary.bottom_right_point();
+    if (right_bottom_point.s() - left_bottom_point.s() > kEpsilon &&
+        min_s_reverse > left_bottom_point.s()) {
+      min_s_reverse = left_bottom_point.s();
+    } else if (min_s_non_reverse > left_bottom_point.s()) {
+      min_s_non_reverse = left_bottom_point.s();
     }
   }
   const double min_s_on_st_boundaries =
@@ -22,6 +22,7 @@
 
 #include <limits>
 #include <tuple>
+#include <vector>
 
 #include "modules/common/proto/pnc_point.pb.h"
 #include "modules/planning/proto/decision.pb.h"
@@ -97,6 +98,16 @@ Status SpeedLimitDecider::GetSpeedLimits(
              frenet_path.back().s());
   }
 
+  // Batch-evaluate the map speed limits over the path's s array so the merged
+  // intervals are walked once instead of queried per point.
+  std::vector<double> frenet_s;
+  frenet_s.reserve(frenet_path.size());
+  for (const auto& frenet_point : frenet_path) {
+    frenet_s.push_back(frenet_point.s());
+  }
+  std::vector<double> map_speed_limits;
+  reference_line_.GetSpeedLimitsFromS(frenet_s, &map_speed_limits);
+
   for (uint32_t i = 0; i < discretized_path.size(); ++i) {
     const double path_s = discretized_path.at(i).s();
     const double frenet_point_s = frenet_path.at(i).s();
@@ -108,8 +119,7 @@ Status SpeedLimitDecider::GetSpeedLimits(
     }
 
     // (1) speed limit from map
-    double speed_limit_on_reference_line =
-        reference_line_.GetSpeedLimitFromS(frenet_point_s);
+    double speed_limit_on_reference_line = map_speed_limits.at(i);
 
     // (2) speed limit from path curvature
     //  -- 2.1: limit by centripetal force (acceleration)
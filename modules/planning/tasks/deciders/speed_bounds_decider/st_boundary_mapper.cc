@@ -67,7 +67,39 @@ StBoundaryMapper::StBoundaryMapper(const SLBoundary& adc_sl_boundary,
       vehicle_param_(common::VehicleConfigHelper::GetConfig().vehicle_param()),
       planning_distance_(planning_distance),
       planning_time_(planning_time),
-      is_change_lane_(is_change_lane) {}
+      is_change_lane_(is_change_lane) {
+  BuildAdcSweptBoxes();
+}
+
+void StBoundaryMapper::BuildAdcSweptBoxes() {
+  const auto& path_points = path_data_.discretized_path();
+  if (path_points.size() < 2) {
+    return;
+  }
+  const size_t default_num_point = 50;
+  if (path_points.size() > 2 * default_num_point) {
+    const auto ratio = path_points.size() / default_num_point;
+    std::vector<PathPoint> sampled_path_points;
+    for (size_t i = 0; i < path_points.size(); ++i) {
+      if (i % ratio == 0) {
+        sampled_path_points.push_back(path_points[i]);
+      }
+    }
+    sampled_path_ = DiscretizedPath(sampled_path_points);
+  } else {
+    sampled_path_ = DiscretizedPath(path_points);
+  }
+
+  const double step_length = vehicle_param_.front_edge_to_center();
+  const double path_len =
+      std::min(FLAGS_max_trajectory_len, sampled_path_.Length());
+  for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
+    const auto curr_adc_path_point =
+        sampled_path_.Evaluate(path_s + sampled_path_.front().s());
+    adc_swept_boxes_.push_back(ComputeAdcBoundingBox(
+        curr_adc_path_point, speed_bounds_config_.boundary_buffer()));
+  }
+}
 
 Status StBoundaryMapper::CreateStBoundary(PathDecision* path_decision) const {
   const auto& obstacles = path_decision->obstacles();
@@ -280,20 +312,7 @@ bool StBoundaryMapper::GetOverlapBoundaryPoints(
       }
     }
   } else {
-    const int default_num_point = 50;
-    DiscretizedPath discretized_path;
-    if (path_points.size() > 2 * default_num_point) {
-      const auto ratio = path_points.size() / default_num_point;
-      std::vector<PathPoint> sampled_path_points;
-      for (size_t i = 0; i < path_points.size(); ++i) {
-        if (i % ratio == 0) {
-          sampled_path_points.push_back(path_points[i]);
-        }
-      }
-      discretized_path = DiscretizedPath(sampled_path_points);
-    } else {
-      discretized_path = DiscretizedPath(path_points);
-    }
+    const size_t default_num_point = 50;
     for (int i = 0; i < trajectory.trajectory_point_size(); ++i) {
       const auto& trajectory_point = trajectory.trajectory_point(i);
       const Box2d obs_box = obstacle.GetBoundingBox(trajectory_point);
@@ -305,13 +324,12 @@ bool StBoundaryMapper::GetOverlapBoundaryPoints(
       }
 
       const double step_length = vehicle_param_.front_edge_to_center();
-      auto path_len =
-          std::min(FLAGS_max_trajectory_len, discretized_path.Length());
-      for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
-        const auto curr_adc_path_point =
-            discretized_path.Evaluate(path_s + discretized_path.front().s());
-        if (CheckOverlap(curr_adc_path_point, obs_box,
-                         speed_bounds_config_.boundary_buffer())) {
+      // The adc swept boxes along the sampled path are precomputed by
+      // BuildAdcSweptBoxes() and shared across obstacles and trajectory
+      // points.
+      for (size_t k = 0; k < adc_swept_boxes_.size(); ++k) {
+        const double path_s = static_cast<double>(k) * step_length;
+        if (obs_box.HasOverlap(adc_swept_boxes_[k])) {
           // found overlap, start searching with higher resolution
           const double backward_distance = -step_length;
           const double forward_distance = vehicle_param_.length() +
@@ -319,21 +337,21 @@ bool StBoundaryMapper::GetOverlapBoundaryPoints(
                                           obs_box.length() + obs_box.width();
           const double default_min_step = 0.1;  // in meters
           const double fine_tuning_step_length = std::fmin(
-              default_min_step, discretized_path.Length() / default_num_point);
+              default_min_step, sampled_path_.Length() / default_num_point);
 
           bool find_low = false;
           bool find_high = false;
           double low_s = std::fmax(0.0, path_s + backward_distance);
           double high_s =
-              std::fmin(discretized_path.Length(), path_s + forward_distance);
+              std::fmin(sampled_path_.Length(), path_s + forward_distance);
 
           while (low_s < high_s) {
             if (find_low && find_high) {
               break;
             }
             if (!find_low) {
-              const auto& point_low = discretized_path.Evaluate(
-                  low_s + discretized_path.front().s());
+              const auto& point_low =
+                  sampled_path_.Evaluate(low_s + sampled_path_.front().s());
               if (!CheckOverlap(point_low, obs_box,
                                 speed_bounds_config_.boundary_buffer())) {
                 low_s += fine_tuning_step_length;
@@ -342,8 +360,8 @@ bool StBoundaryMapper::GetOverlapBoundaryPoints(
               }
             }
             if (!find_high) {
-              const auto& point_high = discretized_path.Evaluate(
-                  high_s + discretized_path.front().s());
+              const auto& point_high =
+                  sampled_path_.Evaluate(high_s + sampled_path_.front().s());
               if (!CheckOverlap(point_high, obs_box,
                                 speed_bounds_config_.boundary_buffer())) {
                 high_s -= fine_tuning_step_length;
@@ -430,6 +448,11 @@ Status StBoundaryMapper::MapWithDecision(
 bool StBoundaryMapper::CheckOverlap(const PathPoint& path_point,
                                     const Box2d& obs_box,
                                     const double buffer) const {
+  return obs_box.HasOverlap(ComputeAdcBoundingBox(path_point, buffer));
+}
+
+Box2d StBoundaryMapper::ComputeAdcBoundingBox(const PathPoint& path_point,
+                                              const double buffer) const {
   double left_delta_l = 0.0;
   double right_delta_l = 0.0;
   if (is_change_lane_) {
@@ -451,10 +474,9 @@ bool StBoundaryMapper::CheckOverlap(const PathPoint& path_point,
           .rotate(path_point.theta());
   Vec2d center = Vec2d(path_point.x(), path_point.y()) + vec_to_center;
 
-  const Box2d adc_box =
-      Box2d(center, path_point.theta(), vehicle_param_.length() + 2 * buffer,
-            vehicle_param_.width() + 2 * buffer);
-  return obs_box.HasOverlap(adc_box);
+  return Box2d(center, path_point.theta(),
+               vehicle_param_.length() + 2 * buffer,
+               vehicle_param_.width() + 2 * buffer);
 }
 
 }  // namespace planning
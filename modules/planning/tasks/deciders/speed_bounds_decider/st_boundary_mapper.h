@@ -26,7 +26,9 @@
 #include "modules/common/configs/proto/vehicle_config.pb.h"
 #include "modules/planning/proto/speed_bounds_decider_config.pb.h"
 
+#include "modules/common/math/box2d.h"
 #include "modules/common/status/status.h"
+#include "modules/planning/common/path/discretized_path.h"
 #include "modules/planning/common/path/path_data.h"
 #include "modules/planning/common/path_decision.h"
 #include "modules/planning/common/speed/st_boundary.h"
@@ -54,6 +56,17 @@ class StBoundaryMapper {
                     const apollo::common::math::Box2d& obs_box,
                     const double buffer) const;
 
+  apollo::common::math::Box2d ComputeAdcBoundingBox(
+      const apollo::common::PathPoint& path_point, const double buffer) const;
+
+  /**
+   * Samples the planned path at coarse resolution and precomputes the adc
+   * footprint (inflated by the boundary buffer) at each sample, so the
+   * swept volume is built once per cycle instead of once per obstacle
+   * trajectory point.
+   */
+  void BuildAdcSweptBoxes();
+
   /**
    * Creates valid st boundary upper_points and lower_points
    * If return true, upper_points.size() > 1 and
@@ -81,6 +94,12 @@ class StBoundaryMapper {
   const double planning_distance_;
   const double planning_time_;
   bool is_change_lane_ = false;
+
+  // Coarsely sampled planned path and the adc swept boxes along it;
+  // adc_swept_boxes_[i] is the footprint at s = i * front_edge_to_center()
+  // on sampled_path_. Shared by every obstacle in CreateStBoundary().
+  DiscretizedPath sampled_path_;
+  std::vector<apollo::common::math::Box2d> adc_swept_boxes_;
 };
 
 }  // namespace planning
@@ -113,7 +113,9 @@ double DpStCost::GetObstacleCost(const StGraphPoint& st_graph_point) {
       continue;
     }
 
-    auto boundary = obstacle->st_boundary();
+    // st_boundary() returns a reference; taking a copy here used to clone
+    // the whole boundary polygon for every obstacle at every graph point.
+    const auto& boundary = obstacle->st_boundary();
     const double kIgnoreDistance = 200.0;
     if (boundary.min_s() > kIgnoreDistance) {
       continue;
@@ -44,13 +44,13 @@ namespace {
 
 constexpr double kInf = std::numeric_limits<double>::infinity();
 
+// The boundaries are expected to be prefiltered by UpdateColumnBoundaries(),
+// which already drops KEEP_CLEAR boundaries and the ones outside the time
+// window of the edges ending at the current column.
 bool CheckOverlapOnDpStGraph(const std::vector<const STBoundary*>& boundaries,
                              const StGraphPoint& p1, const StGraphPoint& p2) {
   const common::math::LineSegment2d seg(p1.point(), p2.point());
   for (const auto* boundary : boundaries) {
-    if (boundary->boundary_type() == STBoundary::BoundaryType::KEEP_CLEAR) {
-      continue;
-    }
     if (boundary->HasOverlap(seg)) {
       return true;
     }
@@ -158,6 +158,19 @@ Status DpStGraph::InitCostTable() {
       cost_table_i[j].Init(i, j, STPoint(curr_s, curr_t));
     }
   }
+
+  // The speed limits only depend on the s row; sample them once instead of
+  // once per graph point inside CalculateCostAt().
+  speed_limit_by_row_.resize(dim_s);
+  soft_speed_limit_by_row_.resize(dim_s);
+  for (uint32_t j = 0; j < dim_s; ++j) {
+    speed_limit_by_row_[j] =
+        st_graph_data_.speed_limit().GetSpeedLimitByS(unit_s_ * j);
+    soft_speed_limit_by_row_[j] =
+        FLAGS_enable_soft_speed_limit
+            ? st_graph_data_.speed_limit().GetSoftSpeedLimitByS(unit_s_ * j)
+            : speed_limit_by_row_[j];
+  }
   return Status::OK();
 }
 
@@ -175,6 +188,7 @@ Status DpStGraph::CalculateTotalCost() {
     int count = static_cast<int>(next_highest_row) -
                 static_cast<int>(next_lowest_row) + 1;
     if (count > 0) {
+      UpdateColumnBoundaries(static_cast<uint32_t>(c));
       std::vector<std::future<void>> results;
       for (size_t r = next_lowest_row; r <= next_highest_row; ++r) {
         auto msg = std::make_shared<StGraphMessage>(c, r);
@@ -209,6 +223,24 @@ Status DpStGraph::CalculateTotalCost() {
   return Status::OK();
 }
 
+void DpStGraph::UpdateColumnBoundaries(const uint32_t c) {
+  // The edges evaluated for column c span t in [t(c - 1), t(c)], so
+  // boundaries outside that window can be skipped by every worker of the
+  // column instead of being tested segment by segment.
+  boundaries_of_curr_col_.clear();
+  const double t_min = (c < 1 ? 0.0 : (c - 1) * unit_t_);
+  const double t_max = c * unit_t_;
+  for (const auto* boundary : st_graph_data_.st_boundaries()) {
+    if (boundary->boundary_type() == STBoundary::BoundaryType::KEEP_CLEAR) {
+      continue;
+    }
+    if (boundary->max_t() < t_min || boundary->min_t() > t_max) {
+      continue;
+    }
+    boundaries_of_curr_col_.push_back(boundary);
+  }
+}
+
 void DpStGraph::GetRowRange(const StGraphPoint& point, size_t* next_highest_row,
                             size_t* next_lowest_row) {
   double v0 = 0.0;
@@ -257,12 +289,8 @@ void DpStGraph::CalculateCostAt(const std::shared_ptr<StGraphMessage>& msg) {
     return;
   }
 
-  const double speed_limit =
-      st_graph_data_.speed_limit().GetSpeedLimitByS(unit_s_ * r);
-  const double soft_speed_limit =
-      FLAGS_enable_soft_speed_limit
-          ? st_graph_data_.speed_limit().GetSoftSpeedLimitByS(unit_s_ * r)
-          : speed_limit;
+  const double speed_limit = speed_limit_by_row_[r];
+  const double soft_speed_limit = soft_speed_limit_by_row_[r];
 
   if (c == 1) {
     const double acc = (r * unit_s_ / unit_t_ - init_point_.v()) / unit_t_;
@@ -271,7 +299,7 @@ void DpStGraph::CalculateCostAt(const std::shared_ptr<StGraphMessage>& msg) {
       return;
     }
 
-    if (CheckOverlapOnDpStGraph(st_graph_data_.st_boundaries(), cost_cr,
+    if (CheckOverlapOnDpStGraph(boundaries_of_curr_col_, cost_cr,
                                 cost_init)) {
       return;
     }
@@ -299,7 +327,7 @@ void DpStGraph::CalculateCostAt(const std::shared_ptr<StGraphMessage>& msg) {
         continue;
       }
 
-      if (CheckOverlapOnDpStGraph(st_graph_data_.st_boundaries(), cost_cr,
+      if (CheckOverlapOnDpStGraph(boundaries_of_curr_col_, cost_cr,
                                   pre_col[r_pre])) {
         continue;
       }
@@ -329,7 +357,7 @@ void DpStGraph::CalculateCostAt(const std::shared_ptr<StGraphMessage>& msg) {
         curr_a < vehicle_param_.max_deceleration()) {
       continue;
     }
-    if (CheckOverlapOnDpStGraph(st_graph_data_.st_boundaries(), cost_cr,
+    if (CheckOverlapOnDpStGraph(boundaries_of_curr_col_, cost_cr,
                                 pre_col[r_pre])) {
       continue;
     }
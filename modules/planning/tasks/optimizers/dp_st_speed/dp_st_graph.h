@@ -80,6 +80,8 @@ class DpStGraph {
   void GetRowRange(const StGraphPoint& point, size_t* highest_row,
                    size_t* lowest_row);
 
+  void UpdateColumnBoundaries(const uint32_t c);
+
  private:
   const StGraphData& st_graph_data_;
 
@@ -107,6 +109,15 @@ class DpStGraph {
   // cost_table_[t][s]
   // row: s, col: t --- NOTICE: Please do NOT change.
   std::vector<std::vector<StGraphPoint>> cost_table_;
+
+  // speed limits sampled once per s row; shared read-only by the workers
+  // dispatched in CalculateTotalCost().
+  std::vector<double> speed_limit_by_row_;
+  std::vector<double> soft_speed_limit_by_row_;
+
+  // st boundaries that can interact with edges ending at the current
+  // column; rebuilt serially before each column is dispatched.
+  std::vector<const STBoundary*> boundaries_of_curr_col_;
 };
 
 }  // namespace planning
@@ -20,11 +20,13 @@
 
 #include "modules/planning/tasks/optimizers/piecewise_jerk_path/piecewise_jerk_path_optimizer.h"
 
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "cyber/task/task.h"
 #include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/common/trajectory1d/piecewise_jerk_trajectory1d.h"
 #include "modules/planning/math/piecewise_jerk/fem_1d_qp_problem.h"
@@ -57,7 +59,11 @@ common::Status PiecewiseJerkPathOptimizer::Process(
       reference_line_info_->GetCandidatePathBoundaries();
   ADEBUG << "There are " << path_boundaries.size() << " path boundaries.";
 
-  std::vector<PathData> candidate_path_data;
+  // gather the eligible boundary candidates first; each candidate QP is
+  // independent and owns its own solver workspace, so they can be solved
+  // concurrently on the planning worker threads
+  std::vector<const PathBoundary*> eligible_boundaries;
+  std::vector<int> max_iters;
   for (const auto& path_boundary : path_boundaries) {
     // if the path_boundary is normal, it is possible to have less than 2 points
     // skip path boundary of this kind
@@ -73,28 +79,59 @@ common::Status PiecewiseJerkPathOptimizer::Process(
     }
 
     CHECK_GT(path_boundary.boundary().size(), 1);
+    eligible_boundaries.push_back(&path_boundary);
+    max_iters.push_back(max_iter);
+  }
 
-    std::vector<double> opt_l;
-    std::vector<double> opt_dl;
-    std::vector<double> opt_ddl;
-    bool res_opt = OptimizePath(init_frenet_state, path_boundary.delta_s(),
-                                path_boundary.boundary(), w, &opt_l, &opt_dl,
-                                &opt_ddl, max_iter);
-
-    if (res_opt) {
-      auto frenet_frame_path =
-          ToPiecewiseJerkPath(opt_l, opt_dl, opt_ddl, path_boundary.delta_s(),
-                              path_boundary.start_s());
-
-      // TODO(all): double-check this;
-      // final_path_data might carry info from upper stream
-      PathData path_data = *final_path_data;
-      path_data.SetReferenceLine(&reference_line);
-      path_data.SetFrenetPath(FrenetFramePath(frenet_frame_path));
-      path_data.set_path_label(path_boundary.label());
-      path_data.set_blocking_obstacle_id(path_boundary.blocking_obstacle_id());
-      candidate_path_data.push_back(std::move(path_data));
+  const size_t candidate_num = eligible_boundaries.size();
+  // vector<bool> packs bits, use bytes so concurrent writes do not race
+  std::vector<uint8_t> res_opts(candidate_num, 0);
+  std::vector<std::vector<double>> opt_ls(candidate_num);
+  std::vector<std::vector<double>> opt_dls(candidate_num);
+  std::vector<std::vector<double>> opt_ddls(candidate_num);
+
+  auto solve_candidate = [this, &init_frenet_state, &w, &eligible_boundaries,
+                          &max_iters, &res_opts, &opt_ls, &opt_dls,
+                          &opt_ddls](const size_t i) {
+    const auto* path_boundary = eligible_boundaries[i];
+    res_opts[i] = OptimizePath(init_frenet_state, path_boundary->delta_s(),
+                               path_boundary->boundary(), w, &opt_ls[i],
+                               &opt_dls[i], &opt_ddls[i], max_iters[i]);
+  };
+
+  if (FLAGS_enable_multi_thread_in_piecewise_jerk_path && candidate_num > 1) {
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < candidate_num; ++i) {
+      results.emplace_back(cyber::Async(solve_candidate, i));
+    }
+    for (auto& result : results) {
+      result.get();
+    }
+  } else {
+    for (size_t i = 0; i < candidate_num; ++i) {
+      solve_candidate(i);
+    }
+  }
+
+  // collect the feasible results in boundary order, as before
+  std::vector<PathData> candidate_path_data;
+  for (size_t i = 0; i < candidate_num; ++i) {
+    if (!res_opts[i]) {
+      continue;
     }
+    const auto& path_boundary = *eligible_boundaries[i];
+    auto frenet_frame_path =
+        ToPiecewiseJerkPath(opt_ls[i], opt_dls[i], opt_ddls[i],
+                            path_boundary.delta_s(), path_boundary.start_s());
+
+    // TODO(all): double-check this;
+    // final_path_data might carry info from upper stream
+    PathData path_data = *final_path_data;
+    path_data.SetReferenceLine(&reference_line);
+    path_data.SetFrenetPath(FrenetFramePath(frenet_frame_path));
+    path_data.set_path_label(path_boundary.label());
+    path_data.set_blocking_obstacle_id(path_boundary.blocking_obstacle_id());
+    candidate_path_data.push_back(std::move(path_data));
   }
   if (candidate_path_data.empty()) {
     return Status(ErrorCode::PLANNING_ERROR,
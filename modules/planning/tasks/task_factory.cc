@@ -49,10 +49,9 @@
 namespace apollo {
 namespace planning {
 
-apollo::common::util::Factory<
+apollo::common::util::DenseEnumFactory<
     TaskConfig::TaskType, Task, Task* (*)(const TaskConfig& config),
-    std::unordered_map<TaskConfig::TaskType,
-                       Task* (*)(const TaskConfig& config), std::hash<int>>>
+    TaskConfig::TaskType_ARRAYSIZE>
     TaskFactory::task_factory_;
 
 std::unordered_map<TaskConfig::TaskType, TaskConfig, std::hash<int>>
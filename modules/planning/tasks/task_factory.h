@@ -37,10 +37,11 @@ class TaskFactory {
   static std::unique_ptr<Task> CreateTask(const TaskConfig &task_config);
 
  private:
-  static apollo::common::util::Factory<
+  // Dense creator table: task types are a small dense enum, and scenario
+  // switches create whole task lists, so lookups should not hash or allocate.
+  static apollo::common::util::DenseEnumFactory<
       TaskConfig::TaskType, Task, Task *(*)(const TaskConfig &config),
-      std::unordered_map<TaskConfig::TaskType,
-                         Task *(*)(const TaskConfig &config), std::hash<int>>>
+      TaskConfig::TaskType_ARRAYSIZE>
       task_factory_;
   static std::unordered_map<TaskConfig::TaskType, TaskConfig, std::hash<int>>
       default_task_configs_;
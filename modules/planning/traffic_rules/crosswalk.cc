@@ -100,28 +100,31 @@ void Crosswalk::MakeDecisions(Frame* const frame,
         mutable_crosswalk_status->finished_crosswalk(i));
   }
 
+  // crosswalk_overlaps_ only holds crosswalks the vehicle has not passed
+  // beyond the pass buffer; once the tracked crosswalk drops out of that
+  // set, the vehicle body has passed its stop line
+  if (mutable_crosswalk_status->has_crosswalk_id()) {
+    const std::string& tracked_crosswalk_id =
+        mutable_crosswalk_status->crosswalk_id();
+    const bool tracked_crosswalk_ahead = std::any_of(
+        crosswalk_overlaps_.begin(), crosswalk_overlaps_.end(),
+        [&tracked_crosswalk_id](const hdmap::PathOverlap* overlap) {
+          return overlap->object_id == tracked_crosswalk_id;
+        });
+    if (!tracked_crosswalk_ahead) {
+      ADEBUG << "PASSED: crosswalk_id[" << tracked_crosswalk_id
+             << "]. adc_front_edge passes crosswalk_end_s + buffer.";
+      mutable_crosswalk_status->clear_crosswalk_id();
+      mutable_crosswalk_status->clear_stop_time();
+    }
+  }
+
   const auto& reference_line = reference_line_info->reference_line();
   for (auto crosswalk_overlap : crosswalk_overlaps_) {
     auto crosswalk_ptr = HDMapUtil::BaseMap().GetCrosswalkById(
         hdmap::MakeMapId(crosswalk_overlap->object_id));
     std::string crosswalk_id = crosswalk_ptr->id().id();
 
-    // skip crosswalk if master vehicle body already passes the stop line
-    if (adc_front_edge_s - crosswalk_overlap->end_s >
-        config_.crosswalk().min_pass_s_distance()) {
-      if (mutable_crosswalk_status->has_crosswalk_id() &&
-          mutable_crosswalk_status->crosswalk_id() == crosswalk_id) {
-        mutable_crosswalk_status->clear_crosswalk_id();
-        mutable_crosswalk_status->clear_stop_time();
-      }
-
-      ADEBUG << "SKIP: crosswalk_id[" << crosswalk_id
-             << "] crosswalk_overlap_end_s[" << crosswalk_overlap->end_s
-             << "] adc_front_edge_s[" << adc_front_edge_s
-             << "]. adc_front_edge passes crosswalk_end_s + buffer.";
-      continue;
-    }
-
     // check if crosswalk already finished
     if (finished_crosswalks.end() != std::find(finished_crosswalks.begin(),
                                                finished_crosswalks.end(),
@@ -251,12 +254,13 @@ void Crosswalk::MakeDecisions(Frame* const frame,
 bool Crosswalk::FindCrosswalks(ReferenceLineInfo* const reference_line_info) {
   CHECK_NOTNULL(reference_line_info);
 
-  crosswalk_overlaps_.clear();
-  const std::vector<hdmap::PathOverlap>& crosswalk_overlaps =
-      reference_line_info->reference_line().map_path().crosswalk_overlaps();
-  for (const hdmap::PathOverlap& crosswalk_overlap : crosswalk_overlaps) {
-    crosswalk_overlaps_.push_back(&crosswalk_overlap);
-  }
+  // only crosswalks the vehicle front edge has not yet passed beyond the
+  // pass buffer can still affect the decision
+  const double adc_front_edge_s = reference_line_info->AdcSlBoundary().end_s();
+  reference_line_info->GetOverlapsWithinRange(
+      ReferenceLineInfo::CROSSWALK,
+      adc_front_edge_s - config_.crosswalk().min_pass_s_distance(),
+      reference_line_info->reference_line().Length(), &crosswalk_overlaps_);
   return crosswalk_overlaps_.size() > 0;
 }
 
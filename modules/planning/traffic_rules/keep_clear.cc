@@ -44,19 +44,24 @@ Status KeepClear::ApplyRule(Frame* const frame,
 
   // keep_clear zone
   if (config_.keep_clear().enable_keep_clear_zone()) {
-    const std::vector<PathOverlap>& keep_clear_overlaps =
-        reference_line_info->reference_line().map_path().clear_area_overlaps();
-    for (const auto& keep_clear_overlap : keep_clear_overlaps) {
+    const double adc_front_edge_s =
+        reference_line_info->AdcSlBoundary().end_s();
+    std::vector<const PathOverlap*> keep_clear_overlaps;
+    reference_line_info->GetOverlapsWithinRange(
+        ReferenceLineInfo::CLEAR_AREA,
+        adc_front_edge_s - config_.keep_clear().min_pass_s_distance(),
+        reference_line_info->reference_line().Length(), &keep_clear_overlaps);
+    for (const auto* keep_clear_overlap : keep_clear_overlaps) {
       const auto obstacle_id =
-          KEEP_CLEAR_VO_ID_PREFIX + keep_clear_overlap.object_id;
+          KEEP_CLEAR_VO_ID_PREFIX + keep_clear_overlap->object_id;
 
       if (BuildKeepClearObstacle(frame, reference_line_info, obstacle_id,
-                                 keep_clear_overlap.start_s,
-                                 keep_clear_overlap.end_s)) {
+                                 keep_clear_overlap->start_s,
+                                 keep_clear_overlap->end_s)) {
         ADEBUG << "KEEP_CLAER for keep_clear_zone["
-               << keep_clear_overlap.object_id << "] s["
-               << keep_clear_overlap.start_s << ", " << keep_clear_overlap.end_s
-               << "] BUILD";
+               << keep_clear_overlap->object_id << "] s["
+               << keep_clear_overlap->start_s << ", "
+               << keep_clear_overlap->end_s << "] BUILD";
       }
     }
   }
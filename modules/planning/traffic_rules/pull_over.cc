@@ -21,6 +21,7 @@
 #include "modules/planning/traffic_rules/pull_over.h"
 
 #include <algorithm>
+#include <array>
 #include <vector>
 
 #include "modules/common/configs/vehicle_config_helper.h"
@@ -238,64 +239,26 @@ int PullOver::GetPullOverStopPoint(PointENU* stop_point) {
  * @brief: check if s is on overlaps
  */
 bool PullOver::OnOverlap(const double start_s, const double end_s) {
-  const auto& reference_line = reference_line_info_->reference_line();
-
-  // crosswalk
-  const std::vector<PathOverlap>& crosswalk_overlaps =
-      reference_line.map_path().crosswalk_overlaps();
-  for (const auto& crosswalk_overlap : crosswalk_overlaps) {
-    if (start_s <= crosswalk_overlap.end_s &&
-        end_s >= crosswalk_overlap.start_s) {
-      ADEBUG << "s[" << start_s << ", " << end_s << "] on crosswalk_overlap["
-             << crosswalk_overlap.object_id << "] s["
-             << crosswalk_overlap.start_s << ", " << crosswalk_overlap.end_s
-             << "]";
-      return true;
-    }
-  }
-
-  // junction
-  const std::vector<PathOverlap>& pnc_junction_overlaps =
-      reference_line.map_path().pnc_junction_overlaps();
-  for (const auto& pnc_junction_overlap : pnc_junction_overlaps) {
-    if (start_s <= pnc_junction_overlap.end_s &&
-        end_s >= pnc_junction_overlap.start_s) {
-      ADEBUG << "s[" << start_s << ", " << end_s << "] on pnc_junction_overlap["
-             << pnc_junction_overlap.object_id << "] s["
-             << pnc_junction_overlap.start_s << ", "
-             << pnc_junction_overlap.end_s << "]";
+  static constexpr std::array<ReferenceLineInfo::OverlapType, 4>
+      kBlockingOverlapTypes = {{
+          ReferenceLineInfo::CROSSWALK,
+          ReferenceLineInfo::PNC_JUNCTION,
+          ReferenceLineInfo::CLEAR_AREA,
+          ReferenceLineInfo::SPEED_BUMP,
+      }};
+
+  std::vector<const PathOverlap*> overlaps;
+  for (const auto overlap_type : kBlockingOverlapTypes) {
+    reference_line_info_->GetOverlapsWithinRange(overlap_type, start_s, end_s,
+                                                 &overlaps);
+    if (!overlaps.empty()) {
+      ADEBUG << "s[" << start_s << ", " << end_s << "] on overlap type["
+             << overlap_type << "] id[" << overlaps.front()->object_id
+             << "] s[" << overlaps.front()->start_s << ", "
+             << overlaps.front()->end_s << "]";
       return true;
     }
   }
-
-  // clear_area
-  const std::vector<PathOverlap>& clear_area_overlaps =
-      reference_line.map_path().clear_area_overlaps();
-  for (const auto& clear_area_overlap : clear_area_overlaps) {
-    if (start_s <= clear_area_overlap.end_s &&
-        end_s >= clear_area_overlap.start_s) {
-      ADEBUG << "s[" << start_s << ", " << end_s << "] on clear_area_overlap["
-             << clear_area_overlap.object_id << "] s["
-             << clear_area_overlap.start_s << ", " << clear_area_overlap.end_s
-             << "]";
-      return true;
-    }
-  }
-
-  // speed_bump
-  const std::vector<PathOverlap>& speed_bump_overlaps =
-      reference_line.map_path().speed_bump_overlaps();
-  for (const auto& speed_bump_overlap : speed_bump_overlaps) {
-    if (start_s <= speed_bump_overlap.end_s &&
-        end_s >= speed_bump_overlap.start_s) {
-      ADEBUG << "s[" << start_s << ", " << end_s << "] on speed_bump_overlap["
-             << speed_bump_overlap.object_id << "] s["
-             << speed_bump_overlap.start_s << ", " << speed_bump_overlap.end_s
-             << "]";
-      return true;
-    }
-  }
-
   return false;
 }
 
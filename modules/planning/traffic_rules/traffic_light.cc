@@ -74,18 +74,16 @@ void TrafficLight::MakeDecisions(Frame* const frame,
   signal_light_debug->set_adc_speed(
       common::VehicleStateProvider::Instance()->linear_velocity());
 
-  const std::vector<PathOverlap>& traffic_light_overlaps =
-      reference_line_info->reference_line().map_path().signal_overlaps();
-  for (const auto& traffic_light_overlap : traffic_light_overlaps) {
-    if (traffic_light_overlap.end_s <= adc_back_edge_s) {
-      continue;
-    }
-
+  std::vector<const PathOverlap*> traffic_light_overlaps;
+  reference_line_info->GetOverlapsWithinRange(
+      ReferenceLineInfo::SIGNAL, adc_back_edge_s,
+      reference_line_info->reference_line().Length(), &traffic_light_overlaps);
+  for (const auto* traffic_light_overlap : traffic_light_overlaps) {
     // check if traffic-light-stop already finished, set by scenario/stage
     bool traffic_light_done = false;
     for (const auto& done_traffic_light_overlap_id :
          traffic_light_status.done_traffic_light_overlap_id()) {
-      if (traffic_light_overlap.object_id == done_traffic_light_overlap_id) {
+      if (traffic_light_overlap->object_id == done_traffic_light_overlap_id) {
         traffic_light_done = true;
         break;
       }
@@ -98,7 +96,7 @@ void TrafficLight::MakeDecisions(Frame* const frame,
     constexpr double kSDiscrepanceTolerance = 10.0;
     const auto& reference_line = reference_line_info->reference_line();
     common::SLPoint traffic_light_sl;
-    traffic_light_sl.set_s(traffic_light_overlap.start_s);
+    traffic_light_sl.set_s(traffic_light_overlap->start_s);
     traffic_light_sl.set_l(0);
     common::math::Vec2d traffic_light_point;
     reference_line.SLToXY(traffic_light_sl, &traffic_light_point);
@@ -107,24 +105,24 @@ void TrafficLight::MakeDecisions(Frame* const frame,
         common::VehicleStateProvider::Instance()->y()};
     const double distance =
         common::util::DistanceXY(traffic_light_point, adc_position);
-    const double s_distance = traffic_light_overlap.start_s - adc_front_edge_s;
-    ADEBUG << "traffic_light[" << traffic_light_overlap.object_id
-           << "] start_s[" << traffic_light_overlap.start_s
+    const double s_distance = traffic_light_overlap->start_s - adc_front_edge_s;
+    ADEBUG << "traffic_light[" << traffic_light_overlap->object_id
+           << "] start_s[" << traffic_light_overlap->start_s
            << "] s_distance[" << s_distance
            << "] actual_distance[" << distance << "]";
     if (s_distance >= 0 &&
         fabs(s_distance - distance) > kSDiscrepanceTolerance) {
-      ADEBUG << "SKIP traffic_light[" << traffic_light_overlap.object_id
+      ADEBUG << "SKIP traffic_light[" << traffic_light_overlap->object_id
              << "] close in position, but far away along reference line";
       continue;
     }
 
     auto signal_color =
-        frame->GetSignal(traffic_light_overlap.object_id).color();
+        frame->GetSignal(traffic_light_overlap->object_id).color();
     const double stop_deceleration = util::GetADCStopDeceleration(
-        adc_front_edge_s, traffic_light_overlap.start_s);
-    ADEBUG << "traffic_light_id[" << traffic_light_overlap.object_id
-           << "] start_s[" << traffic_light_overlap.start_s
+        adc_front_edge_s, traffic_light_overlap->start_s);
+    ADEBUG << "traffic_light_id[" << traffic_light_overlap->object_id
+           << "] start_s[" << traffic_light_overlap->start_s
            << "] color[" << signal_color
            << "] stop_deceleration[" << stop_deceleration << "]";
 
@@ -133,8 +131,8 @@ void TrafficLight::MakeDecisions(Frame* const frame,
         signal_light_debug->add_signal();
     signal_debug->set_adc_stop_deceleration(stop_deceleration);
     signal_debug->set_color(signal_color);
-    signal_debug->set_light_id(traffic_light_overlap.object_id);
-    signal_debug->set_light_stop_s(traffic_light_overlap.start_s);
+    signal_debug->set_light_id(traffic_light_overlap->object_id);
+    signal_debug->set_light_stop_s(traffic_light_overlap->start_s);
 
     if (signal_color == perception::TrafficLight::GREEN) {
       continue;
@@ -148,13 +146,13 @@ void TrafficLight::MakeDecisions(Frame* const frame,
 
     // build stop decision
     ADEBUG << "BuildStopDecision: traffic_light["
-           << traffic_light_overlap.object_id
-           << "] start_s[" << traffic_light_overlap.start_s << "]";
+           << traffic_light_overlap->object_id
+           << "] start_s[" << traffic_light_overlap->start_s << "]";
     std::string virtual_obstacle_id =
-        TRAFFIC_LIGHT_VO_ID_PREFIX + traffic_light_overlap.object_id;
+        TRAFFIC_LIGHT_VO_ID_PREFIX + traffic_light_overlap->object_id;
     const std::vector<std::string> wait_for_obstacles;
     BuildStopDecision(virtual_obstacle_id,
-                      traffic_light_overlap.start_s,
+                      traffic_light_overlap->start_s,
                       config_.traffic_light().stop_distance(),
                       StopReasonCode::STOP_REASON_SIGNAL,
                       wait_for_obstacles,
@@ -27,35 +27,40 @@ namespace apollo {
 namespace prediction {
 
 using apollo::common::PointENU;
-using apollo::hdmap::JunctionInfo;
 using apollo::hdmap::LaneInfo;
 using ConstLaneInfoPtr = std::shared_ptr<const LaneInfo>;
 
-std::shared_ptr<const JunctionInfo> JunctionAnalyzer::junction_info_ptr_;
-std::unordered_map<std::string, JunctionExit> JunctionAnalyzer::junction_exits_;
-std::unordered_map<std::string, JunctionFeature>
-    JunctionAnalyzer::junction_features_;
+std::unordered_map<std::string, JunctionAnalyzer::JunctionFeatureGraph>
+    JunctionAnalyzer::graph_cache_;
+JunctionAnalyzer::JunctionFeatureGraph* JunctionAnalyzer::current_graph_ =
+    nullptr;
 
 void JunctionAnalyzer::Init(const std::string& junction_id) {
-  if (junction_info_ptr_ != nullptr &&
-      junction_info_ptr_->id().id() == junction_id) {
+  if (current_graph_ != nullptr &&
+      current_graph_->junction_info_ptr->id().id() == junction_id) {
     return;
   }
-  Clear();
-  junction_info_ptr_ = PredictionMap::JunctionById(junction_id);
+  auto it = graph_cache_.find(junction_id);
+  if (it != graph_cache_.end()) {
+    current_graph_ = &it->second;
+    return;
+  }
+  // references into unordered_map stay valid across later insertions
+  current_graph_ = &graph_cache_[junction_id];
+  current_graph_->junction_info_ptr = PredictionMap::JunctionById(junction_id);
   SetAllJunctionExits();
 }
 
 void JunctionAnalyzer::Clear() {
   // Clear all data
-  junction_info_ptr_ = nullptr;
-  junction_exits_.clear();
-  junction_features_.clear();
+  current_graph_ = nullptr;
+  graph_cache_.clear();
 }
 
 void JunctionAnalyzer::SetAllJunctionExits() {
-  CHECK_NOTNULL(junction_info_ptr_);
-  for (const auto& overlap_id : junction_info_ptr_->junction().overlap_id()) {
+  CHECK_NOTNULL(current_graph_->junction_info_ptr);
+  for (const auto& overlap_id :
+       current_graph_->junction_info_ptr->junction().overlap_id()) {
     auto overlap_info_ptr = PredictionMap::OverlapById(overlap_id.id());
     if (overlap_info_ptr == nullptr) {
       continue;
@@ -75,7 +80,7 @@ void JunctionAnalyzer::SetAllJunctionExits() {
           junction_exit.set_exit_heading(lane_info_ptr->Heading(s));
           junction_exit.set_exit_width(lane_info_ptr->GetWidth(s));
           // add junction_exit to hashtable
-          junction_exits_[lane_id] = junction_exit;
+          current_graph_->junction_exits[lane_id] = junction_exit;
         }
       }
     }
@@ -98,7 +103,7 @@ std::vector<JunctionExit> JunctionAnalyzer::GetJunctionExits(
     std::unordered_set<std::string> visited_exit_lanes;
     if (IsExitLane(curr_lane_id) &&
         visited_exit_lanes.find(curr_lane_id) == visited_exit_lanes.end()) {
-      junction_exits.push_back(junction_exits_[curr_lane_id]);
+      junction_exits.push_back(current_graph_->junction_exits[curr_lane_id]);
       visited_exit_lanes.insert(curr_lane_id);
       continue;
     }
@@ -116,8 +121,9 @@ std::vector<JunctionExit> JunctionAnalyzer::GetJunctionExits(
 
 const JunctionFeature& JunctionAnalyzer::GetJunctionFeature(
     const std::string& start_lane_id) {
-  if (junction_features_.find(start_lane_id) != junction_features_.end()) {
-    return junction_features_[start_lane_id];
+  auto& junction_features = current_graph_->junction_features;
+  if (junction_features.find(start_lane_id) != junction_features.end()) {
+    return junction_features[start_lane_id];
   }
   JunctionFeature junction_feature;
   junction_feature.set_junction_id(GetJunctionId());
@@ -129,8 +135,8 @@ const JunctionFeature& JunctionAnalyzer::GetJunctionFeature(
   }
   junction_feature.mutable_enter_lane()->set_lane_id(start_lane_id);
   junction_feature.add_start_lane_id(start_lane_id);
-  junction_features_[start_lane_id] = junction_feature;
-  return junction_features_[start_lane_id];
+  junction_features[start_lane_id] = junction_feature;
+  return junction_features[start_lane_id];
 }
 
 JunctionFeature JunctionAnalyzer::GetJunctionFeature(
@@ -161,27 +167,34 @@ JunctionFeature JunctionAnalyzer::GetJunctionFeature(
 }
 
 bool JunctionAnalyzer::IsExitLane(const std::string& lane_id) {
-  return junction_exits_.find(lane_id) != junction_exits_.end();
+  return current_graph_->junction_exits.find(lane_id) !=
+         current_graph_->junction_exits.end();
 }
 
 const std::string& JunctionAnalyzer::GetJunctionId() {
-  CHECK_NOTNULL(junction_info_ptr_);
-  return junction_info_ptr_->id().id();
+  CHECK_NOTNULL(current_graph_);
+  return current_graph_->junction_info_ptr->id().id();
 }
 
 double JunctionAnalyzer::ComputeJunctionRange() {
-  CHECK_NOTNULL(junction_info_ptr_);
-  if (!junction_info_ptr_->junction().has_polygon() ||
-      junction_info_ptr_->junction().polygon().point_size() < 3) {
+  CHECK_NOTNULL(current_graph_);
+  if (current_graph_->junction_range > 0.0) {
+    return current_graph_->junction_range;
+  }
+  const auto& junction_info_ptr = current_graph_->junction_info_ptr;
+  CHECK_NOTNULL(junction_info_ptr);
+  if (!junction_info_ptr->junction().has_polygon() ||
+      junction_info_ptr->junction().polygon().point_size() < 3) {
     AERROR << "Junction [" << GetJunctionId()
            << "] has not enough polygon points to compute range";
-    return FLAGS_defualt_junction_range;
+    current_graph_->junction_range = FLAGS_defualt_junction_range;
+    return current_graph_->junction_range;
   }
   double x_min = std::numeric_limits<double>::infinity();
   double x_max = -std::numeric_limits<double>::infinity();
   double y_min = std::numeric_limits<double>::infinity();
   double y_max = -std::numeric_limits<double>::infinity();
-  for (const auto& point : junction_info_ptr_->junction().polygon().point()) {
+  for (const auto& point : junction_info_ptr->junction().polygon().point()) {
     x_min = std::min(x_min, point.x());
     x_max = std::max(x_max, point.x());
     y_min = std::min(y_min, point.y());
@@ -189,8 +202,8 @@ double JunctionAnalyzer::ComputeJunctionRange() {
   }
   double dx = std::abs(x_max - x_min);
   double dy = std::abs(y_max - y_min);
-  double range = std::sqrt(dx * dx + dy * dy);
-  return range;
+  current_graph_->junction_range = std::sqrt(dx * dx + dy * dy);
+  return current_graph_->junction_range;
 }
 
 }  // namespace prediction
@@ -30,13 +30,14 @@ namespace prediction {
 class JunctionAnalyzer {
  public:
   /**
-   * @brief Initialize by junction ID, if junction id differs from prev cycle
+   * @brief Switch to the junction with the given ID; its feature graph is
+   *        built on first use and cached for the process lifetime
    * @param junction ID
    */
   static void Init(const std::string& junction_id);
 
   /**
-   * @brief Clear all stored data
+   * @brief Clear all cached junction feature graphs
    */
   static void Clear();
 
@@ -90,12 +91,25 @@ class JunctionAnalyzer {
   static bool IsExitLane(const std::string& lane_id);
 
  private:
-  // junction_info pointer associated to the input junction_id
-  static std::shared_ptr<const apollo::hdmap::JunctionInfo> junction_info_ptr_;
-  // Hashtable: exit_lane_id -> junction_exit
-  static std::unordered_map<std::string, JunctionExit> junction_exits_;
-  // Hashtable: start_lane_id -> junction_feature
-  static std::unordered_map<std::string, JunctionFeature> junction_features_;
+  /**
+   * @brief All HDMap-derived data of one junction, built once per junction ID
+   */
+  struct JunctionFeatureGraph {
+    // junction_info pointer associated to the junction_id
+    std::shared_ptr<const apollo::hdmap::JunctionInfo> junction_info_ptr;
+    // diagonal of the junction polygon bounding box, < 0 until computed
+    double junction_range = -1.0;
+    // Hashtable: exit_lane_id -> junction_exit
+    std::unordered_map<std::string, JunctionExit> junction_exits;
+    // Hashtable: start_lane_id -> junction_feature
+    std::unordered_map<std::string, JunctionFeature> junction_features;
+  };
+
+ private:
+  // Hashtable: junction_id -> feature graph, kept for the process lifetime
+  static std::unordered_map<std::string, JunctionFeatureGraph> graph_cache_;
+  // Graph of the junction selected by the latest Init call
+  static JunctionFeatureGraph* current_graph_;
 };
 
 }  // namespace prediction
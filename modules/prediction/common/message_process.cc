@@ -17,6 +17,7 @@
 #include "modules/prediction/common/message_process.h"
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 #include "cyber/common/file.h"
@@ -83,10 +84,16 @@ bool MessageProcess::Init() {
 }
 
 void MessageProcess::OnPerception(
-    const perception::PerceptionObstacles& perception_obstacles,
+    const std::shared_ptr<const perception::PerceptionObstacles>&
+        perception_obstacles,
     PredictionObstacles* const prediction_obstacles) {
   ADEBUG << "Received a perception message ["
-         << perception_obstacles.ShortDebugString() << "].";
+         << perception_obstacles->ShortDebugString() << "].";
+
+  // Publish frame snapshots of the callback-written containers; the
+  // whole frame below reads the snapshots while localization/planning
+  // callbacks keep writing the live containers
+  ContainerManager::Instance()->PublishSnapshots();
 
   // Get obstacles_container
   auto ptr_obstacles_container =
@@ -96,14 +103,15 @@ void MessageProcess::OnPerception(
 
   // Get pose_container
   auto ptr_ego_pose_container =
-      ContainerManager::Instance()->GetContainer<PoseContainer>(
+      ContainerManager::Instance()->GetSnapshotContainer<PoseContainer>(
           AdapterConfig::LOCALIZATION);
   CHECK_NOTNULL(ptr_ego_pose_container);
 
   // Get adc_trajectory_container
   auto ptr_ego_trajectory_container =
-      ContainerManager::Instance()->GetContainer<ADCTrajectoryContainer>(
-          AdapterConfig::PLANNING_TRAJECTORY);
+      ContainerManager::Instance()
+          ->GetSnapshotContainer<ADCTrajectoryContainer>(
+              AdapterConfig::PLANNING_TRAJECTORY);
   CHECK_NOTNULL(ptr_ego_trajectory_container);
 
   // Insert ADC into the obstacle_container.
@@ -119,7 +127,8 @@ void MessageProcess::OnPerception(
     ptr_ego_trajectory_container->SetPosition({x, y});
   }
 
-  // Insert perception_obstacles
+  // Insert perception_obstacles, sharing ownership of the message so the
+  // container can reference the obstacle data in place
   ptr_obstacles_container->Insert(perception_obstacles);
 
   // Ignore some obstacles
@@ -201,8 +210,8 @@ void MessageProcess::ProcessOfflineData(const std::string& record_filename) {
   RecordMessage message;
   while (reader.ReadMessage(&message)) {
     if (message.channel_name == FLAGS_perception_obstacle_topic) {
-      PerceptionObstacles perception_obstacles;
-      if (perception_obstacles.ParseFromString(message.content)) {
+      auto perception_obstacles = std::make_shared<PerceptionObstacles>();
+      if (perception_obstacles->ParseFromString(message.content)) {
         PredictionObstacles prediction_obstacles;
         OnPerception(perception_obstacles, &prediction_obstacles);
       }
@@ -37,7 +37,8 @@ class MessageProcess {
   static bool Init();
 
   static void OnPerception(
-      const perception::PerceptionObstacles &perception_obstacles,
+      const std::shared_ptr<const perception::PerceptionObstacles>
+          &perception_obstacles,
       PredictionObstacles *const prediction_obstacles);
 
   static void OnLocalization(
@@ -53,6 +53,10 @@ DEFINE_double(pedestrian_nearby_lane_search_radius, 5.0,
               "Radius to determine if pedestrian-like obstacle is near lane.");
 DEFINE_int32(road_graph_max_search_horizon, 20,
              "Maximal search depth for building road graph");
+DEFINE_double(lane_graph_range_bucket, 20.0,
+              "Bucket size (in meters) the lane graph search range is "
+              "rounded up to, so memoized lane graphs can be shared "
+              "across obstacles and frames");
 
 // Scenario
 DEFINE_double(junction_distance_threshold, 10.0,
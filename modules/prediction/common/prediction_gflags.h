@@ -41,6 +41,7 @@ DECLARE_double(lane_search_radius_in_junction);
 DECLARE_double(junction_search_radius);
 DECLARE_double(pedestrian_nearby_lane_search_radius);
 DECLARE_int32(road_graph_max_search_horizon);
+DECLARE_double(lane_graph_range_bucket);
 
 // Scenario
 DECLARE_double(junction_distance_threshold);
@@ -37,6 +37,10 @@ DEFINE_string(extract_feature_type, "",
               "The extract feature type, either cruise or junction");
 
 DEFINE_bool(prediction_test_mode, false, "Set prediction to test mode");
+
+DEFINE_bool(enable_multi_thread_predictor, false,
+            "Run predictors of one frame in parallel cyber tasks, with "
+            "obstacles grouped by their selected predictor");
 DEFINE_double(
     prediction_test_duration, std::numeric_limits<double>::infinity(),
     "The runtime duration in test mode (in seconds). Negative value will not "
@@ -28,6 +28,7 @@ DECLARE_string(output_filename);
 DECLARE_string(extract_feature_type);
 
 DECLARE_bool(prediction_test_mode);
+DECLARE_bool(enable_multi_thread_predictor);
 DECLARE_double(prediction_test_duration);
 
 DECLARE_string(prediction_offline_bags);
@@ -37,11 +37,13 @@ ADCTrajectoryContainer::ADCTrajectoryContainer()
 
 void ADCTrajectoryContainer::Insert(
     const ::google::protobuf::Message& message) {
+  // take the lock before clearing so a concurrent snapshot never sees a
+  // half-reset container
+  std::lock_guard<std::mutex> lock(adc_trajectory_mutex_);
   adc_lane_ids_.clear();
   adc_lane_seq_.clear();
   adc_junction_polygon_ = std::move(Polygon2d());
 
-  std::lock_guard<std::mutex> lock(adc_trajectory_mutex_);
   adc_trajectory_.CopyFrom(dynamic_cast<const ADCTrajectory&>(message));
   ADEBUG << "Received a planning message ["
          << adc_trajectory_.ShortDebugString() << "].";
@@ -60,6 +62,21 @@ void ADCTrajectoryContainer::Insert(
          << "].";
 }
 
+std::unique_ptr<Container> ADCTrajectoryContainer::CreateSnapshot() {
+  std::unique_ptr<ADCTrajectoryContainer> snapshot(
+      new ADCTrajectoryContainer());
+  std::lock_guard<std::mutex> lock(adc_trajectory_mutex_);
+  snapshot->adc_trajectory_.CopyFrom(adc_trajectory_);
+  snapshot->adc_junction_polygon_ = adc_junction_polygon_;
+  snapshot->adc_pnc_junction_polygon_ = adc_pnc_junction_polygon_;
+  snapshot->adc_junction_info_ptr_ = adc_junction_info_ptr_;
+  snapshot->adc_pnc_junction_info_ptr_ = adc_pnc_junction_info_ptr_;
+  snapshot->s_dist_to_junction_ = s_dist_to_junction_;
+  snapshot->adc_lane_ids_ = adc_lane_ids_;
+  snapshot->adc_lane_seq_ = adc_lane_seq_;
+  return std::unique_ptr<Container>(snapshot.release());
+}
+
 bool ADCTrajectoryContainer::IsPointInJunction(const PathPoint& point) const {
   if (adc_pnc_junction_info_ptr_ != nullptr) {
     return IsPointInPNCJunction(point);
@@ -52,6 +52,14 @@ class ADCTrajectoryContainer : public Container {
    */
   void Insert(const ::google::protobuf::Message& message) override;
 
+  /**
+   * @brief Create an immutable copy of the trajectory state for the
+   *        evaluate/predict path, so planning callbacks never wait for
+   *        a running predictor
+   * @return Snapshot container
+   */
+  std::unique_ptr<Container> CreateSnapshot() override;
+
   /**
    * @brief Get the right-of-way status of ADC
    * @return The right-of-way status of ADC
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "google/protobuf/message.h"
 
 /**
@@ -47,6 +49,15 @@ class Container {
    * @param Message data in protobuf format
    */
   virtual void Insert(const ::google::protobuf::Message& message) = 0;
+
+  /**
+   * @brief Create an immutable copy of the current container state
+   *        for the evaluate/predict path, so message callbacks can keep
+   *        writing while a frame reads the snapshot
+   * @return Snapshot container, or nullptr if the container does not
+   *         support snapshot publication
+   */
+  virtual std::unique_ptr<Container> CreateSnapshot() { return nullptr; }
 };
 
 }  // namespace prediction
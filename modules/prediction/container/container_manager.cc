@@ -62,5 +62,14 @@ void ContainerManager::RegisterContainer(
   AINFO << "Container [" << type << "] is registered.";
 }
 
+void ContainerManager::PublishSnapshots() {
+  for (const auto& item : containers_) {
+    auto snapshot = item.second->CreateSnapshot();
+    if (snapshot != nullptr) {
+      snapshot_containers_[item.first] = std::move(snapshot);
+    }
+  }
+}
+
 }  // namespace prediction
 }  // namespace apollo
@@ -59,6 +59,32 @@ class ContainerManager {
     return nullptr;
   }
 
+  /**
+   * @brief Publish frame snapshots of every snapshot-capable container.
+   *        Called at the start of a prediction frame; the frame then
+   *        reads the snapshots while message callbacks keep writing the
+   *        live containers without waiting for the frame to finish.
+   */
+  void PublishSnapshots();
+
+  /**
+   * @brief Get the frame snapshot of a container
+   * @param Type of the container
+   * @return Pointer to the snapshot published by the latest
+   *         PublishSnapshots call, or the live container for types
+   *         without snapshot support
+   */
+  template <typename T>
+  T *GetSnapshotContainer(
+      const common::adapter::AdapterConfig::MessageType &type) {
+    auto key_type = static_cast<int>(type);
+    auto itr = snapshot_containers_.find(key_type);
+    if (itr != snapshot_containers_.end()) {
+      return static_cast<T *>(itr->second.get());
+    }
+    return GetContainer<T>(type);
+  }
+
   FRIEND_TEST(FeatureExtractorTest, junction);
   FRIEND_TEST(ScenarioManagerTest, run);
 
@@ -86,6 +112,10 @@ class ContainerManager {
  private:
   std::unordered_map<int, std::unique_ptr<Container>> containers_;
 
+  // per-type frame snapshots, written only by PublishSnapshots between
+  // frames and read by the evaluate/predict path during a frame
+  std::unordered_map<int, std::unique_ptr<Container>> snapshot_containers_;
+
   common::adapter::AdapterManagerConfig config_;
 
   DECLARE_SINGLETON(ContainerManager)
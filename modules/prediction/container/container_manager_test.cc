@@ -49,5 +49,29 @@ TEST_F(ContainerManagerTest, GetContainer) {
                   AdapterConfig::CONTROL_COMMAND) == nullptr);
 }
 
+TEST_F(ContainerManagerTest, GetSnapshotContainer) {
+  std::string conf_file = "modules/prediction/testdata/adapter_conf.pb.txt";
+  bool ret_load_conf = cyber::common::GetProtoFromFile(conf_file, &conf_);
+  EXPECT_TRUE(ret_load_conf);
+
+  manager_->Init(conf_);
+  manager_->PublishSnapshots();
+
+  // snapshot-capable containers get their own frame copy
+  auto* live_pose =
+      manager_->GetContainer<PoseContainer>(AdapterConfig::LOCALIZATION);
+  auto* snapshot_pose = manager_->GetSnapshotContainer<PoseContainer>(
+      AdapterConfig::LOCALIZATION);
+  EXPECT_TRUE(live_pose != nullptr);
+  EXPECT_TRUE(snapshot_pose != nullptr);
+  EXPECT_NE(live_pose, snapshot_pose);
+
+  // containers without snapshot support fall back to the live instance
+  EXPECT_EQ(manager_->GetContainer<ObstaclesContainer>(
+                AdapterConfig::PERCEPTION_OBSTACLES),
+            manager_->GetSnapshotContainer<ObstaclesContainer>(
+                AdapterConfig::PERCEPTION_OBSTACLES));
+}
+
 }  // namespace prediction
 }  // namespace apollo
@@ -21,6 +21,7 @@
 #include <limits>
 #include <list>
 #include <unordered_set>
+#include <utility>
 
 #include "modules/prediction/common/junction_analyzer.h"
 #include "modules/prediction/common/prediction_gflags.h"
@@ -188,7 +189,7 @@ bool Obstacle::Insert(const PerceptionObstacle& perception_obstacle,
   }
 
   // Insert obstacle feature to history
-  InsertFeatureToHistory(feature);
+  InsertFeatureToHistory(std::move(feature));
 
   // Set obstacle motion status
   if (FLAGS_use_navigation_mode) {
@@ -1475,8 +1476,8 @@ void Obstacle::SetMotionStatusBySpeed() {
   }
 }
 
-void Obstacle::InsertFeatureToHistory(const Feature& feature) {
-  feature_history_.emplace_front(feature);
+void Obstacle::InsertFeatureToHistory(Feature feature) {
+  feature_history_.emplace_front(std::move(feature));
   ADEBUG << "Obstacle [" << id_ << "] inserted a frame into the history.";
 }
 
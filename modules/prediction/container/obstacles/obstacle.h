@@ -305,7 +305,7 @@ class Obstacle {
 
   void SetMotionStatusBySpeed();
 
-  void InsertFeatureToHistory(const Feature& feature);
+  void InsertFeatureToHistory(Feature feature);
 
   void SetJunctionFeatureWithEnterLane(const std::string& enter_lane_id,
                                        Feature* const feature_ptr);
@@ -17,8 +17,11 @@
 #include "modules/prediction/container/obstacles/obstacle_clusters.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <utility>
 
+#include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/common/road_graph.h"
 
 namespace apollo {
@@ -26,7 +29,8 @@ namespace prediction {
 
 using ::apollo::hdmap::LaneInfo;
 
-std::unordered_map<std::string, LaneGraph> ObstacleClusters::lane_graphs_;
+std::unordered_map<std::string, ObstacleClusters::LaneGraphEntry>
+    ObstacleClusters::lane_graphs_;
 std::unordered_map<std::string, std::vector<LaneObstacle>>
     ObstacleClusters::lane_obstacles_;
 std::unordered_map<std::string, StopSign>
@@ -38,37 +42,48 @@ void ObstacleClusters::Clear() {
   lane_id_stop_sign_map_.clear();
 }
 
-void ObstacleClusters::Init() { Clear(); }
+void ObstacleClusters::Init() {
+  // Lane graphs and stop signs derive from the static HDMap only, so their
+  // memo tables survive across frames; reset the per-frame obstacle state
+  lane_obstacles_.clear();
+}
 
 const LaneGraph& ObstacleClusters::GetLaneGraph(
     const double start_s, const double length, const bool is_on_lane,
     std::shared_ptr<const LaneInfo> lane_info_ptr) {
-  std::string lane_id = lane_info_ptr->id().id();
-  if (lane_graphs_.find(lane_id) != lane_graphs_.end()) {
-    // If this lane_segment has been used for constructing LaneGraph,
-    // fetch the previously saved LaneGraph, modify its start_s,
-    // then return this (save the time to construct the entire LaneGraph).
-    LaneGraph* lane_graph = &lane_graphs_[lane_id];
-    for (int i = 0; i < lane_graph->lane_sequence_size(); ++i) {
-      LaneSequence* lane_seq_ptr = lane_graph->mutable_lane_sequence(i);
-      if (lane_seq_ptr->lane_segment_size() == 0) {
-        continue;
-      }
-      LaneSegment* first_lane_seg_ptr = lane_seq_ptr->mutable_lane_segment(0);
-      if (first_lane_seg_ptr->lane_id() != lane_id) {
-        continue;
-      }
-      first_lane_seg_ptr->set_start_s(start_s);
+  const std::string& lane_id = lane_info_ptr->id().id();
+  // Round the search range up to a bucket, so that nearby ranges share one
+  // memoized graph and a cached graph always covers the requested range
+  const double bucketed_range =
+      std::ceil(length / FLAGS_lane_graph_range_bucket) *
+      FLAGS_lane_graph_range_bucket;
+  std::string key = lane_id + (is_on_lane ? "|on" : "|off");
+  auto it = lane_graphs_.find(key);
+  if (it == lane_graphs_.end() || it->second.built_range < bucketed_range) {
+    // Construct the LaneGraph if this lane_segment has not been used yet,
+    // or if the cached graph is shallower than the requested range.
+    RoadGraph road_graph(start_s, bucketed_range, is_on_lane, lane_info_ptr);
+    LaneGraphEntry entry;
+    entry.built_range = bucketed_range;
+    road_graph.BuildLaneGraph(&entry.lane_graph);
+    lane_graphs_[key] = std::move(entry);
+    it = lane_graphs_.find(key);
+  }
+  // Fetch the memoized LaneGraph and modify its start_s for this query
+  // (save the time to construct the entire LaneGraph).
+  LaneGraph* lane_graph = &it->second.lane_graph;
+  for (int i = 0; i < lane_graph->lane_sequence_size(); ++i) {
+    LaneSequence* lane_seq_ptr = lane_graph->mutable_lane_sequence(i);
+    if (lane_seq_ptr->lane_segment_size() == 0) {
+      continue;
+    }
+    LaneSegment* first_lane_seg_ptr = lane_seq_ptr->mutable_lane_segment(0);
+    if (first_lane_seg_ptr->lane_id() != lane_id) {
+      continue;
     }
-  } else {
-    // If this lane_segment has not been used for constructing LaneGraph,
-    // construct the LaneGraph and return.
-    RoadGraph road_graph(start_s, length, is_on_lane, lane_info_ptr);
-    LaneGraph lane_graph;
-    road_graph.BuildLaneGraph(&lane_graph);
-    lane_graphs_[lane_id] = std::move(lane_graph);
+    first_lane_seg_ptr->set_start_s(start_s);
   }
-  return lane_graphs_[lane_id];
+  return *lane_graph;
 }
 
 LaneGraph ObstacleClusters::GetLaneGraphWithoutMemorizing(
@@ -32,12 +32,15 @@ namespace prediction {
 class ObstacleClusters {
  public:
   /**
-   * @brief Remove all lane graphs
+   * @brief Reset all per-frame obstacle state; memoized lane graphs are
+   *        kept, they derive from the static HDMap only
    */
   static void Init();
 
   /**
-   * @brief Obtain a lane graph given a lane info and s
+   * @brief Obtain a lane graph given a lane info and s; graphs are memoized
+   *        by (lane ID, on/off lane) with the search range rounded up to a
+   *        bucket, and shared across obstacles and frames
    * @param lane start s
    * @param lane total length
    * @param if the obstacle is on lane
@@ -130,8 +133,17 @@ class ObstacleClusters {
 
   static void Clear();
 
+  /**
+   * @brief A memoized lane graph and the search range it was built with
+   */
+  struct LaneGraphEntry {
+    double built_range = 0.0;
+    LaneGraph lane_graph;
+  };
+
  private:
-  static std::unordered_map<std::string, LaneGraph> lane_graphs_;
+  // Hashtable: (lane_id, on/off lane) -> lane graph, kept across frames
+  static std::unordered_map<std::string, LaneGraphEntry> lane_graphs_;
   static std::unordered_map<std::string, std::vector<LaneObstacle>>
       lane_obstacles_;
   static std::unordered_map<std::string, StopSign> lane_id_stop_sign_map_;
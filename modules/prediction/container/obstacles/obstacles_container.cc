@@ -16,6 +16,7 @@
 
 #include "modules/prediction/container/obstacles/obstacles_container.h"
 
+#include <memory>
 #include <unordered_set>
 #include <utility>
 
@@ -38,16 +39,25 @@ ObstaclesContainer::ObstaclesContainer()
 // This is called by Perception module at every frame to insert all
 // detected obstacles.
 void ObstaclesContainer::Insert(const ::google::protobuf::Message& message) {
-  // Clean up the history and get the PerceptionObstacles
+  // This overload cannot share ownership of the message; take one copy of
+  // the frame so the per-obstacle views stay valid
+  auto owned_message = std::make_shared<PerceptionObstacles>();
+  owned_message->CopyFrom(dynamic_cast<const PerceptionObstacles&>(message));
+  Insert(owned_message);
+}
+
+void ObstaclesContainer::Insert(
+    const std::shared_ptr<const PerceptionObstacles>& message) {
+  // Clean up the history and keep the new frame's message alive, so the
+  // per-obstacle entries can reference its data in place
   curr_frame_id_mapping_.clear();
   curr_frame_movable_obstacle_ids_.clear();
   curr_frame_unmovable_obstacle_ids_.clear();
   curr_frame_considered_obstacle_ids_.clear();
   curr_frame_id_perception_obstacle_map_.clear();
+  curr_frame_message_ = message;
 
-  PerceptionObstacles perception_obstacles;
-  perception_obstacles.CopyFrom(
-      dynamic_cast<const PerceptionObstacles&>(message));
+  const PerceptionObstacles& perception_obstacles = *message;
 
   // Get the new timestamp and update it in the class
   // - If it's more than 10sec later than the most recent one, clear the
@@ -126,7 +136,9 @@ void ObstaclesContainer::Insert(const ::google::protobuf::Message& message) {
     ADEBUG << "Perception obstacle [" << perception_obstacle.id() << "] "
            << "was inserted";
   }
-  // 3. Sort the Obstacles
+  // 3. Rebuild the considered-obstacle list once for the whole frame
+  SetConsideredObstacleIds();
+  // 4. Sort the Obstacles
   ObstacleClusters::SortObstacles();
 }
 
@@ -149,6 +161,8 @@ Obstacle* ObstaclesContainer::GetObstacleWithLRUUpdate(const int obstacle_id) {
 void ObstaclesContainer::Clear() {
   ptr_obstacles_.Clear();
   id_mapping_.Clear();
+  curr_frame_id_perception_obstacle_map_.clear();
+  curr_frame_message_ = nullptr;
   timestamp_ = -1.0;
 }
 
@@ -156,7 +170,7 @@ const PerceptionObstacle& ObstaclesContainer::GetPerceptionObstacle(
     const int id) {
   CHECK(curr_frame_id_perception_obstacle_map_.find(id) !=
         curr_frame_id_perception_obstacle_map_.end());
-  return curr_frame_id_perception_obstacle_map_[id];
+  return *curr_frame_id_perception_obstacle_map_[id];
 }
 
 const std::vector<int>& ObstaclesContainer::curr_frame_movable_obstacle_ids() {
@@ -205,7 +219,7 @@ void ObstaclesContainer::InsertPerceptionObstacle(
     ADEBUG << "Obstacle have got AdaptTracking, with perception id: "
            << perception_obstacle.id() << ", and prediction id: " << id;
   }
-  curr_frame_id_perception_obstacle_map_[id] = perception_obstacle;
+  curr_frame_id_perception_obstacle_map_[id] = &perception_obstacle;
   if (id < -1) {
     AERROR << "Invalid ID [" << id << "]";
     return;
@@ -235,7 +249,6 @@ void ObstaclesContainer::InsertPerceptionObstacle(
   if (id != -1) {
     curr_frame_movable_obstacle_ids_.push_back(id);
   }
-  SetConsideredObstacleIds();
 }
 
 void ObstaclesContainer::InsertFeatureProto(const Feature& feature) {
@@ -46,13 +46,24 @@ class ObstaclesContainer : public Container {
   virtual ~ObstaclesContainer() = default;
 
   /**
-   * @brief Insert a data message into the container
+   * @brief Insert a data message into the container; the message is copied
+   *        once so the per-obstacle views stay valid for the frame
    * @param Data message to be inserted in protobuf
    */
   void Insert(const ::google::protobuf::Message& message) override;
 
   /**
-   * @brief Insert an perception obstacle
+   * @brief Insert a frame of perception obstacles while sharing ownership
+   *        of the message, so per-obstacle data is referenced in place
+   *        instead of copied
+   * @param Perception obstacles message from the reader
+   */
+  void Insert(
+      const std::shared_ptr<const perception::PerceptionObstacles>& message);
+
+  /**
+   * @brief Insert an perception obstacle; the referenced obstacle must stay
+   *        alive for the rest of the frame
    * @param Perception obstacle
    *        Timestamp
    */
@@ -160,8 +171,11 @@ class ObstaclesContainer : public Container {
   std::vector<int> curr_frame_considered_obstacle_ids_;
   // perception_id -> prediction_id
   std::unordered_map<int, int> curr_frame_id_mapping_;
-  // prediction_id -> perception_obstacle
-  std::unordered_map<int, apollo::perception::PerceptionObstacle>
+  // keeps the current frame's message alive for the views below
+  std::shared_ptr<const apollo::perception::PerceptionObstacles>
+      curr_frame_message_;
+  // prediction_id -> view into the current frame's perception obstacle
+  std::unordered_map<int, const apollo::perception::PerceptionObstacle*>
       curr_frame_id_perception_obstacle_map_;
 };
 
@@ -29,9 +29,19 @@ using Point = apollo::common::Point3D;
 void PoseContainer::Insert(const ::google::protobuf::Message& message) {
   localization::LocalizationEstimate localization;
   localization.CopyFrom(dynamic_cast<const LocalizationEstimate&>(message));
+  std::lock_guard<std::mutex> lock(pose_mutex_);
   Update(localization);
 }
 
+std::unique_ptr<Container> PoseContainer::CreateSnapshot() {
+  std::unique_ptr<PoseContainer> snapshot(new PoseContainer());
+  std::lock_guard<std::mutex> lock(pose_mutex_);
+  if (obstacle_ptr_ != nullptr) {
+    snapshot->obstacle_ptr_.reset(new PerceptionObstacle(*obstacle_ptr_));
+  }
+  return std::unique_ptr<Container>(snapshot.release());
+}
+
 void PoseContainer::Update(
     const localization::LocalizationEstimate& localization) {
   if (!localization.has_header() ||
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "modules/localization/proto/localization.pb.h"
 #include "modules/perception/proto/perception_obstacle.pb.h"
@@ -48,6 +49,13 @@ class PoseContainer : public Container {
    */
   void Insert(const ::google::protobuf::Message& message) override;
 
+  /**
+   * @brief Create an immutable copy of the latest pose for the
+   *        evaluate/predict path
+   * @return Snapshot container
+   */
+  std::unique_ptr<Container> CreateSnapshot() override;
+
   /**
    * @brief Transform pose to a perception obstacle.
    * @return A pointer to a perception obstacle.
@@ -73,6 +81,7 @@ class PoseContainer : public Container {
 
  private:
   std::unique_ptr<perception::PerceptionObstacle> obstacle_ptr_;
+  std::mutex pose_mutex_;
 };
 
 }  // namespace prediction
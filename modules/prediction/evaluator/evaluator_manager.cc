@@ -219,7 +219,7 @@ void EvaluatorManager::BuildCurrentFrameEnv() {
           AdapterConfig::PERCEPTION_OBSTACLES);
   CHECK_NOTNULL(obstacles_container);
   auto ego_pose_container =
-      ContainerManager::Instance()->GetContainer<PoseContainer>(
+      ContainerManager::Instance()->GetSnapshotContainer<PoseContainer>(
           AdapterConfig::LOCALIZATION);
   CHECK_NOTNULL(ego_pose_container);
   FrameEnv curr_frame_env;
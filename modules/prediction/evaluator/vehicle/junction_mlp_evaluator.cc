@@ -251,7 +251,7 @@ void JunctionMLPEvaluator::SetEgoVehicleFeatureValues(
   feature_values->clear();
   *feature_values = std::vector<double>(4, 0.0);
   auto ego_pose_container_ptr =
-      ContainerManager::Instance()->GetContainer<PoseContainer>(
+      ContainerManager::Instance()->GetSnapshotContainer<PoseContainer>(
           AdapterConfig::LOCALIZATION);
   if (ego_pose_container_ptr == nullptr) {
     (*feature_values)[0] = 100.0;
@@ -75,25 +75,53 @@ void MLPEvaluator::Evaluate(Obstacle* obstacle_ptr) {
     return;
   }
 
-  for (int i = 0; i < lane_graph_ptr->lane_sequence_size(); ++i) {
+  // Extract the features of all lane sequences first, so that the model can
+  // run one batched forward pass instead of one pass per sequence
+  const int num_lane_sequence = lane_graph_ptr->lane_sequence_size();
+  std::vector<std::vector<double>> sequence_feature_values(num_lane_sequence);
+  for (int i = 0; i < num_lane_sequence; ++i) {
     LaneSequence* lane_sequence_ptr = lane_graph_ptr->mutable_lane_sequence(i);
     CHECK(lane_sequence_ptr != nullptr);
-    std::vector<double> feature_values;
-    ExtractFeatureValues(obstacle_ptr, lane_sequence_ptr, &feature_values);
+    ExtractFeatureValues(obstacle_ptr, lane_sequence_ptr,
+                         &sequence_feature_values[i]);
     // Insert features to DataForLearning
     if (FLAGS_prediction_offline_mode == 2 && !obstacle_ptr->IsNearJunction()) {
-      FeatureOutput::InsertDataForLearning(*latest_feature_ptr, feature_values,
-                                           "mlp");
+      FeatureOutput::InsertDataForLearning(*latest_feature_ptr,
+                                           sequence_feature_values[i], "mlp");
       ADEBUG << "Save extracted features for learning locally.";
       return;  // Skip Compute probability for offline mode
     }
-    double probability = ComputeProbability(feature_values);
+  }
+
+  const int dim_input = model_ptr_->dim_input();
+  Eigen::VectorXd probabilities = Eigen::VectorXd::Zero(num_lane_sequence);
+  bool valid_feature_size = true;
+  for (const auto& feature_values : sequence_feature_values) {
+    if (static_cast<int>(feature_values.size()) != dim_input) {
+      ADEBUG << "Model feature size not consistent with model proto "
+             << "definition. model input dim = " << dim_input
+             << "; feature value size = " << feature_values.size();
+      valid_feature_size = false;
+      break;
+    }
+  }
+  if (valid_feature_size) {
+    Eigen::MatrixXd feature_matrix(num_lane_sequence, dim_input);
+    for (int i = 0; i < num_lane_sequence; ++i) {
+      for (int j = 0; j < dim_input; ++j) {
+        feature_matrix(i, j) = sequence_feature_values[i][j];
+      }
+    }
+    probabilities = ComputeProbabilities(feature_matrix);
+  }
 
+  for (int i = 0; i < num_lane_sequence; ++i) {
+    LaneSequence* lane_sequence_ptr = lane_graph_ptr->mutable_lane_sequence(i);
     double centripetal_acc_probability =
         ValidationChecker::ProbabilityByCentripetalAcceleration(
             *lane_sequence_ptr, speed);
-    probability *= centripetal_acc_probability;
-    lane_sequence_ptr->set_probability(probability);
+    lane_sequence_ptr->set_probability(probabilities(i) *
+                                       centripetal_acc_probability);
   }
 }
 
@@ -335,68 +363,105 @@ void MLPEvaluator::LoadModel(const std::string& model_file) {
   CHECK(cyber::common::GetProtoFromFile(model_file, model_ptr_.get()))
       << "Unable to load model file: " << model_file << ".";
 
+  // mirror the model into Eigen storage for batched inference; the epsilon
+  // matches math_util::Normalize
+  const double eps = 1e-10;
+  const int dim_input = model_ptr_->dim_input();
+  samples_mean_.resize(dim_input);
+  samples_std_.resize(dim_input);
+  for (int i = 0; i < dim_input; ++i) {
+    samples_mean_(i) = model_ptr_->samples_mean().columns(i);
+    samples_std_(i) = model_ptr_->samples_std().columns(i) + eps;
+  }
+
+  layer_weights_.clear();
+  layer_biases_.clear();
+  layer_activations_.clear();
+  for (int i = 0; i < model_ptr_->num_layer(); ++i) {
+    const Layer& layer = model_ptr_->layer(i);
+    Eigen::MatrixXd weight(layer.layer_input_dim(), layer.layer_output_dim());
+    for (int row = 0; row < layer.layer_input_dim(); ++row) {
+      for (int col = 0; col < layer.layer_output_dim(); ++col) {
+        weight(row, col) = layer.layer_input_weight().rows(row).columns(col);
+      }
+    }
+    Eigen::RowVectorXd bias(layer.layer_output_dim());
+    for (int col = 0; col < layer.layer_output_dim(); ++col) {
+      bias(col) = layer.layer_bias().columns(col);
+    }
+    layer_weights_.emplace_back(std::move(weight));
+    layer_biases_.emplace_back(std::move(bias));
+    layer_activations_.push_back(layer.layer_activation_func());
+  }
+
   AINFO << "Succeeded in loading the model file: " << model_file << ".";
 }
 
 double MLPEvaluator::ComputeProbability(
     const std::vector<double>& feature_values) {
   CHECK_NOTNULL(model_ptr_.get());
-  double probability = 0.0;
 
   if (model_ptr_->dim_input() != static_cast<int>(feature_values.size())) {
     ADEBUG << "Model feature size not consistent with model proto definition. "
            << "model input dim = " << model_ptr_->dim_input()
            << "; feature value size = " << feature_values.size();
-    return probability;
+    return 0.0;
   }
-  std::vector<double> layer_input;
-  layer_input.reserve(model_ptr_->dim_input());
-  std::vector<double> layer_output;
-
-  // normalization
+  Eigen::MatrixXd feature_matrix(1, model_ptr_->dim_input());
   for (int i = 0; i < model_ptr_->dim_input(); ++i) {
-    double mean = model_ptr_->samples_mean().columns(i);
-    double std = model_ptr_->samples_std().columns(i);
-    layer_input.push_back(
-        apollo::prediction::math_util::Normalize(feature_values[i], mean, std));
+    feature_matrix(0, i) = feature_values[i];
   }
+  return ComputeProbabilities(feature_matrix)(0);
+}
 
-  for (int i = 0; i < model_ptr_->num_layer(); ++i) {
-    if (i > 0) {
-      layer_input.swap(layer_output);
-      layer_output.clear();
-    }
-    const Layer& layer = model_ptr_->layer(i);
-    for (int col = 0; col < layer.layer_output_dim(); ++col) {
-      double neuron_output = layer.layer_bias().columns(col);
-      for (int row = 0; row < layer.layer_input_dim(); ++row) {
-        double weight = layer.layer_input_weight().rows(row).columns(col);
-        neuron_output += (layer_input[row] * weight);
+Eigen::VectorXd MLPEvaluator::ComputeProbabilities(
+    const Eigen::MatrixXd& feature_matrix) {
+  CHECK_NOTNULL(model_ptr_.get());
+  CHECK_EQ(feature_matrix.cols(), model_ptr_->dim_input());
+
+  // normalization
+  Eigen::MatrixXd layer_values =
+      ((feature_matrix.rowwise() - samples_mean_.transpose())
+           .array()
+           .rowwise() /
+       samples_std_.transpose().array())
+          .matrix();
+
+  for (size_t i = 0; i < layer_weights_.size(); ++i) {
+    layer_values =
+        (layer_values * layer_weights_[i]).rowwise() + layer_biases_[i];
+    switch (layer_activations_[i]) {
+      case Layer::RELU: {
+        layer_values = layer_values.unaryExpr(
+            [](const double value) { return math_util::Relu(value); });
+        break;
       }
-      if (layer.layer_activation_func() == Layer::RELU) {
-        neuron_output = apollo::prediction::math_util::Relu(neuron_output);
-      } else if (layer.layer_activation_func() == Layer::SIGMOID) {
-        neuron_output = apollo::prediction::math_util::Sigmoid(neuron_output);
-      } else if (layer.layer_activation_func() == Layer::TANH) {
-        neuron_output = std::tanh(neuron_output);
-      } else {
-        AERROR << "Undefined activation function ["
-               << layer.layer_activation_func()
+      case Layer::SIGMOID: {
+        layer_values = layer_values.unaryExpr(
+            [](const double value) { return math_util::Sigmoid(value); });
+        break;
+      }
+      case Layer::TANH: {
+        layer_values = layer_values.unaryExpr(
+            [](const double value) { return std::tanh(value); });
+        break;
+      }
+      default: {
+        AERROR << "Undefined activation function [" << layer_activations_[i]
                << "]. A default sigmoid will be used instead.";
-        neuron_output = apollo::prediction::math_util::Sigmoid(neuron_output);
+        layer_values = layer_values.unaryExpr(
+            [](const double value) { return math_util::Sigmoid(value); });
+        break;
       }
-      layer_output.push_back(neuron_output);
     }
   }
 
-  if (layer_output.size() != 1) {
+  if (layer_values.cols() != 1) {
     AERROR << "Model output layer has incorrect # outputs: "
-           << layer_output.size();
-  } else {
-    probability = layer_output[0];
+           << layer_values.cols();
+    return Eigen::VectorXd::Zero(feature_matrix.rows());
   }
-
-  return probability;
+  return layer_values.col(0);
 }
 
 }  // namespace prediction
@@ -21,6 +21,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "Eigen/Dense"
+
 #include "modules/prediction/evaluator/evaluator.h"
 #include "modules/prediction/proto/fnn_vehicle_model.pb.h"
 
@@ -94,6 +96,14 @@ class MLPEvaluator : public Evaluator {
    */
   double ComputeProbability(const std::vector<double>& feature_values);
 
+  /**
+   * @brief Compute probabilities for a batch of feature rows with one
+   *        matrix product per model layer instead of one forward pass
+   *        per row
+   * @param Feature matrix with one row per lane sequence
+   */
+  Eigen::VectorXd ComputeProbabilities(const Eigen::MatrixXd& feature_matrix);
+
   /**
    * @brief Save offline feature values in proto
    * @param Lane sequence
@@ -108,6 +118,14 @@ class MLPEvaluator : public Evaluator {
   static const size_t LANE_FEATURE_SIZE = 40;
 
   std::unique_ptr<FnnVehicleModel> model_ptr_;
+
+  // model weights mirrored into Eigen storage at load time, so inference
+  // does not walk proto accessors for every multiply
+  Eigen::VectorXd samples_mean_;
+  Eigen::VectorXd samples_std_;
+  std::vector<Eigen::MatrixXd> layer_weights_;
+  std::vector<Eigen::RowVectorXd> layer_biases_;
+  std::vector<Layer::ActivationFunc> layer_activations_;
 };
 
 }  // namespace prediction
@@ -82,12 +82,11 @@ bool Dense::Load(const DenseParameter& dense_pb) {
 void Dense::Run(const std::vector<Eigen::MatrixXf>& inputs,
                 Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
-  Eigen::MatrixXf prod = static_cast<Eigen::MatrixXf>(inputs[0] * weights_);
+  output->noalias() = inputs[0] * weights_;
   if (use_bias_) {
-    Eigen::MatrixXf sum = prod.rowwise() + bias_.transpose();
-    prod = sum;
+    output->rowwise() += bias_.transpose();
   }
-  *output = prod.unaryExpr(kactivation_);
+  *output = output->unaryExpr(kactivation_);
   CHECK_EQ(output->cols(), units_);
 }
 
@@ -138,15 +137,11 @@ void Conv1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
   output->resize(output_num_row, output_num_col);
   for (int i = 0; i < output_num_row; ++i) {
     for (int j = 0; j < output_num_col; ++j) {
-      float output_i_j_unbiased = 0.0f;
-      for (int p = 0; p < inputs[0].rows(); ++p) {
-        for (int q = j * stride_; q < j * stride_ + kernel_size; ++q) {
-          output_i_j_unbiased +=
-              inputs[0](p, q) * kernel_[i](p, q - j * stride_);
-        }
-      }
-
-      (*output)(i, j) = output_i_j_unbiased + bias_(i);
+      (*output)(i, j) = inputs[0]
+                            .middleCols(j * stride_, kernel_size)
+                            .cwiseProduct(kernel_[i])
+                            .sum() +
+                        bias_(i);
     }
   }
 }
@@ -184,13 +179,8 @@ void MaxPool1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
   int input_index = 0;
   for (int j = 0; j < output_num_col; ++j) {
     CHECK_LE(input_index + kernel_size_, inputs[0].cols());
-    for (int i = 0; i < output_num_row; ++i) {
-      float output_i_j = -std::numeric_limits<float>::infinity();
-      for (int k = input_index; k < input_index + kernel_size_; ++k) {
-        output_i_j = std::max(output_i_j, inputs[0](i, k));
-      }
-      (*output)(i, j) = output_i_j;
-    }
+    output->col(j) =
+        inputs[0].middleCols(input_index, kernel_size_).rowwise().maxCoeff();
     input_index += stride_;
   }
 }
@@ -228,13 +218,8 @@ void AvgPool1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
   int input_index = 0;
   for (int j = 0; j < output_num_col; ++j) {
     CHECK_LE(input_index + kernel_size_, inputs[0].cols());
-    for (int i = 0; i < output_num_row; ++i) {
-      float output_i_j_sum = 0.0f;
-      for (int k = input_index; k < input_index + kernel_size_; ++k) {
-        output_i_j_sum += inputs[0](i, k);
-      }
-      (*output)(i, j) = output_i_j_sum / static_cast<float>(kernel_size_);
-    }
+    output->col(j) =
+        inputs[0].middleCols(input_index, kernel_size_).rowwise().mean();
     input_index += stride_;
   }
 }
@@ -300,22 +285,25 @@ bool BatchNormalization::Load(const LayerParameter& layer_pb) {
       return false;
     }
   }
+  // Fold the normalization into a per-feature affine transform, so that Run
+  // is a single fused expression: y = x * gain + offset
+  gain_ = (sigma_.array().sqrt() + epsilon_).inverse();
+  if (scale_) {
+    gain_ = gain_.array() * gamma_.array();
+  }
+  offset_ = -(mu_.array() * gain_.array());
+  if (center_) {
+    offset_ += beta_;
+  }
   return true;
 }
 
 void BatchNormalization::Run(const std::vector<Eigen::MatrixXf>& inputs,
                              Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
-  Eigen::MatrixXf temp = (inputs[0].rowwise() - mu_.transpose());
-  Eigen::MatrixXf norm =
-      temp.array().rowwise() / (sigma_.array().sqrt() + epsilon_).transpose();
-  if (scale_) {
-    norm = norm.array().rowwise() * gamma_.transpose().array();
-  }
-  if (center_) {
-    norm = norm.rowwise() + beta_.transpose();
-  }
-  *output = norm;
+  *output = inputs[0];
+  output->array().rowwise() *= gain_.transpose().array();
+  output->rowwise() += offset_.transpose();
 }
 
 bool LSTM::Load(const LayerParameter& layer_pb) {
@@ -423,28 +411,41 @@ bool LSTM::Load(const LayerParameter& layer_pb) {
     AERROR << "Fail to Load reccurent output weights!";
     return false;
   }
+  PackGateWeights();
   ResetState();
   return true;
 }
 
+void LSTM::PackGateWeights() {
+  w_gates_.resize(wi_.rows(), 4 * units_);
+  w_gates_ << wi_, wf_, wc_, wo_;
+  r_w_gates_.resize(r_wi_.rows(), 4 * units_);
+  r_w_gates_ << r_wi_, r_wf_, r_wc_, r_wo_;
+  b_gates_.resize(4 * units_);
+  b_gates_ << bi_.transpose(), bf_.transpose(), bc_.transpose(),
+      bo_.transpose();
+}
+
 void LSTM::Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
                 Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1) {
-  Eigen::MatrixXf x_i = input * wi_ + bi_.transpose();
-  Eigen::MatrixXf x_f = input * wf_ + bf_.transpose();
-  Eigen::MatrixXf x_c = input * wc_ + bc_.transpose();
-  Eigen::MatrixXf x_o = input * wo_ + bo_.transpose();
-
-  Eigen::MatrixXf i = (x_i + (*ht_1) * r_wi_).unaryExpr(krecurrent_activation_);
-  Eigen::MatrixXf f = (x_f + (*ht_1) * r_wf_).unaryExpr(krecurrent_activation_);
-  Eigen::MatrixXf c =
-      f.array() * ct_1->array() +
-      i.array() * ((x_c + (*ht_1) * r_wc_).unaryExpr(kactivation_)).array();
-  Eigen::MatrixXf o = (x_o + (*ht_1) * r_wo_).unaryExpr(krecurrent_activation_);
-  Eigen::MatrixXf h = o.array() * (c.unaryExpr(kactivation_)).array();
-
-  *ht_1 = h;
-  *ct_1 = c;
-  *output = h;
+  // One product against the packed [i|f|c|o] gate weights instead of four
+  // per-gate products; gates_ is a reused workspace so no per-step allocation
+  gates_.noalias() = input * w_gates_;
+  gates_.noalias() += (*ht_1) * r_w_gates_;
+  gates_.rowwise() += b_gates_;
+
+  auto i = gates_.leftCols(units_);
+  auto f = gates_.middleCols(units_, units_);
+  auto c_hat = gates_.middleCols(2 * units_, units_);
+  auto o = gates_.rightCols(units_);
+  i = i.unaryExpr(krecurrent_activation_);
+  f = f.unaryExpr(krecurrent_activation_);
+  c_hat = c_hat.unaryExpr(kactivation_);
+  o = o.unaryExpr(krecurrent_activation_);
+
+  ct_1->array() = f.array() * ct_1->array() + i.array() * c_hat.array();
+  ht_1->array() = o.array() * ct_1->unaryExpr(kactivation_).array();
+  *output = *ht_1;
 }
 
 void LSTM::Run(const std::vector<Eigen::MatrixXf>& inputs,
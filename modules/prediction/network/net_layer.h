@@ -307,6 +307,9 @@ class BatchNormalization : public Layer {
   Eigen::VectorXf sigma_;
   Eigen::VectorXf gamma_;
   Eigen::VectorXf beta_;
+  // per-feature affine transform folded from mu/sigma/gamma/beta at load
+  Eigen::VectorXf gain_;
+  Eigen::VectorXf offset_;
   float epsilon_ = 0.0f;
   float momentum_ = 0.0f;
   int axis_ = 0;
@@ -364,6 +367,12 @@ class LSTM : public Layer {
   void Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
             Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1);
 
+  /**
+   * @brief Concatenate the per-gate weights into packed [i|f|c|o] matrices,
+   *        so that one step costs two matrix products instead of eight
+   */
+  void PackGateWeights();
+
   Eigen::MatrixXf wi_;
   Eigen::MatrixXf wf_;
   Eigen::MatrixXf wc_;
@@ -378,6 +387,12 @@ class LSTM : public Layer {
   Eigen::MatrixXf r_wc_;
   Eigen::MatrixXf r_wo_;
 
+  Eigen::MatrixXf w_gates_;
+  Eigen::MatrixXf r_w_gates_;
+  Eigen::RowVectorXf b_gates_;
+  // workspace reused across steps to avoid per-step allocations
+  Eigen::MatrixXf gates_;
+
   Eigen::MatrixXf ht_1_;
   Eigen::MatrixXf ct_1_;
   std::function<float(float)> kactivation_;
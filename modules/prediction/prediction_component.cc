@@ -17,6 +17,7 @@
 #include "modules/prediction/prediction_component.h"
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 #include "cyber/common/file.h"
@@ -112,8 +113,7 @@ bool PredictionComponent::Proc(
     AERROR << "Prediction: cannot receive any localization message.";
     return false;
   }
-  auto localization_msg = *ptr_localization_msg;
-  MessageProcess::OnLocalization(localization_msg);
+  MessageProcess::OnLocalization(*ptr_localization_msg);
   auto end_time2 = std::chrono::system_clock::now();
   std::chrono::duration<double> diff = end_time2 - end_time1;
   ADEBUG << "Time for updating PoseContainer: " << diff.count() * 1000
@@ -124,39 +124,39 @@ bool PredictionComponent::Proc(
   planning_reader_->Observe();
   auto ptr_trajectory_msg = planning_reader_->GetLatestObserved();
   if (ptr_trajectory_msg != nullptr) {
-    auto trajectory_msg = *ptr_trajectory_msg;
-    MessageProcess::OnPlanning(trajectory_msg);
+    MessageProcess::OnPlanning(*ptr_trajectory_msg);
   }
   auto end_time3 = std::chrono::system_clock::now();
   diff = end_time3 - end_time2;
   ADEBUG << "Time for updating ADCTrajectoryContainer: " << diff.count() * 1000
          << " msec.";
 
-  // Get all perception_obstacles of this frame and call OnPerception to
-  // process them all.
-  auto perception_msg = *perception_obstacles;
-  PredictionObstacles prediction_obstacles;
-  MessageProcess::OnPerception(perception_msg, &prediction_obstacles);
+  // Pass all perception_obstacles of this frame to OnPerception to
+  // process them all, without copying the message
+  auto ptr_prediction_obstacles = std::make_shared<PredictionObstacles>();
+  MessageProcess::OnPerception(perception_obstacles,
+                               ptr_prediction_obstacles.get());
   auto end_time4 = std::chrono::system_clock::now();
   diff = end_time4 - end_time3;
   ADEBUG << "Time for updating PerceptionContainer: " << diff.count() * 1000
          << " msec.";
 
   // Postprocess prediction obstacles message
-  prediction_obstacles.set_start_timestamp(frame_start_time_);
-  prediction_obstacles.set_end_timestamp(Clock::NowInSeconds());
-  prediction_obstacles.mutable_header()->set_lidar_timestamp(
-      perception_msg.header().lidar_timestamp());
-  prediction_obstacles.mutable_header()->set_camera_timestamp(
-      perception_msg.header().camera_timestamp());
-  prediction_obstacles.mutable_header()->set_radar_timestamp(
-      perception_msg.header().radar_timestamp());
-
-  prediction_obstacles.set_perception_error_code(perception_msg.error_code());
+  ptr_prediction_obstacles->set_start_timestamp(frame_start_time_);
+  ptr_prediction_obstacles->set_end_timestamp(Clock::NowInSeconds());
+  ptr_prediction_obstacles->mutable_header()->set_lidar_timestamp(
+      perception_obstacles->header().lidar_timestamp());
+  ptr_prediction_obstacles->mutable_header()->set_camera_timestamp(
+      perception_obstacles->header().camera_timestamp());
+  ptr_prediction_obstacles->mutable_header()->set_radar_timestamp(
+      perception_obstacles->header().radar_timestamp());
+
+  ptr_prediction_obstacles->set_perception_error_code(
+      perception_obstacles->error_code());
 
   if (FLAGS_prediction_test_mode) {
     for (auto const& prediction_obstacle :
-         prediction_obstacles.prediction_obstacle()) {
+         ptr_prediction_obstacles->prediction_obstacle()) {
       for (auto const& trajectory : prediction_obstacle.trajectory()) {
         for (auto const& trajectory_point : trajectory.trajectory_point()) {
           if (!ValidationChecker::ValidTrajectoryPoint(trajectory_point)) {
@@ -173,10 +173,9 @@ bool PredictionComponent::Proc(
   diff = end_time5 - end_time1;
   ADEBUG << "End to end time elapsed: " << diff.count() * 1000 << " msec.";
 
-  // Publish output
-  common::util::FillHeader(node_->Name(), &prediction_obstacles);
-  prediction_writer_->Write(
-      std::make_shared<PredictionObstacles>(prediction_obstacles));
+  // Publish output without taking another copy of the message
+  common::util::FillHeader(node_->Name(), ptr_prediction_obstacles.get());
+  prediction_writer_->Write(ptr_prediction_obstacles);
   return true;
 }
 
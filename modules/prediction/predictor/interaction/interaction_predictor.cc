@@ -141,8 +141,9 @@ void InteractionPredictor::Clear() { Predictor::Clear(); }
 
 void InteractionPredictor::BuildADCTrajectory(const double time_resolution) {
   auto adc_trajectory_container =
-      ContainerManager::Instance()->GetContainer<ADCTrajectoryContainer>(
-          AdapterConfig::PLANNING_TRAJECTORY);
+      ContainerManager::Instance()
+          ->GetSnapshotContainer<ADCTrajectoryContainer>(
+              AdapterConfig::PLANNING_TRAJECTORY);
   if (adc_trajectory_container == nullptr) {
     AERROR << "Null adc trajectory container";
     return;
@@ -323,8 +324,9 @@ double InteractionPredictor::CollisionWithEgoVehicleCost(
 bool InteractionPredictor::LowerRightOfWayThanEgo(
     const Obstacle& obstacle, const LaneSequence& lane_sequence) {
   auto adc_trajectory_container =
-      ContainerManager::Instance()->GetContainer<ADCTrajectoryContainer>(
-          AdapterConfig::PLANNING_TRAJECTORY);
+      ContainerManager::Instance()
+          ->GetSnapshotContainer<ADCTrajectoryContainer>(
+              AdapterConfig::PLANNING_TRAJECTORY);
   if (adc_trajectory_container != nullptr &&
       adc_trajectory_container->IsProtected()) {
     return true;
@@ -16,6 +16,12 @@
 
 #include "modules/prediction/predictor/predictor_manager.h"
 
+#include <future>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cyber/task/task.h"
 #include "modules/prediction/common/feature_output.h"
 #include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/common/prediction_system_gflags.h"
@@ -138,28 +144,76 @@ void PredictorManager::Run() {
           AdapterConfig::PERCEPTION_OBSTACLES);
 
   auto adc_trajectory_container =
-      ContainerManager::Instance()->GetContainer<ADCTrajectoryContainer>(
-          AdapterConfig::PLANNING_TRAJECTORY);
+      ContainerManager::Instance()
+          ->GetSnapshotContainer<ADCTrajectoryContainer>(
+              AdapterConfig::PLANNING_TRAJECTORY);
 
   CHECK_NOTNULL(obstacles_container);
+
+  // 1. Snapshot the obstacles of this frame, so that worker tasks never
+  //    touch the container afterwards
+  std::vector<int> frame_ids;
+  std::vector<Obstacle*> frame_obstacles;
   for (const int id : obstacles_container->curr_frame_obstacle_ids()) {
     if (id < 0) {
       ADEBUG << "The obstacle has invalid id [" << id << "].";
       continue;
     }
+    frame_ids.push_back(id);
+    frame_obstacles.push_back(obstacles_container->GetObstacle(id));
+  }
+  const size_t num_obstacle = frame_ids.size();
+  std::vector<PredictionObstacle> prediction_obstacle_slots(num_obstacle);
 
-    PredictionObstacle prediction_obstacle;
-    Obstacle* obstacle = obstacles_container->GetObstacle(id);
+  // 2. Run the predictors, either serially or as parallel cyber tasks
+  if (FLAGS_enable_multi_thread_predictor) {
+    // Group the obstacles by their selected predictor; a predictor instance
+    // is stateful, so each group must stay on a single task
+    std::unordered_map<Predictor*, std::vector<size_t>> predictor_groups;
+    for (size_t i = 0; i < num_obstacle; ++i) {
+      if (frame_obstacles[i] == nullptr) {
+        continue;
+      }
+      Predictor* predictor =
+          SelectPredictor(frame_obstacles[i], &prediction_obstacle_slots[i]);
+      predictor_groups[predictor].push_back(i);
+    }
+    std::vector<std::future<void>> futures;
+    for (auto& predictor_group : predictor_groups) {
+      futures.emplace_back(cyber::Async(
+          &PredictorManager::PredictObstacleGroup, this, predictor_group.first,
+          &predictor_group.second, &frame_obstacles, &prediction_obstacle_slots,
+          adc_trajectory_container));
+    }
+    for (auto& future : futures) {
+      future.get();
+    }
+  } else {
+    for (size_t i = 0; i < num_obstacle; ++i) {
+      if (frame_obstacles[i] == nullptr) {
+        continue;
+      }
+      Predictor* predictor =
+          SelectPredictor(frame_obstacles[i], &prediction_obstacle_slots[i]);
+      PredictWithPredictor(predictor, frame_obstacles[i],
+                           &prediction_obstacle_slots[i],
+                           adc_trajectory_container);
+    }
+  }
 
+  // 3. Stitch the per-obstacle results serially, in frame order
+  for (size_t i = 0; i < num_obstacle; ++i) {
+    PredictionObstacle& prediction_obstacle = prediction_obstacle_slots[i];
     PerceptionObstacle perception_obstacle =
-        obstacles_container->GetPerceptionObstacle(id);
+        obstacles_container->GetPerceptionObstacle(frame_ids[i]);
     // if obstacle == nullptr, that means obstacle is unmovable
     // Checkout the logic of unmovable in obstacle.cc
-    if (obstacle != nullptr) {
-      PredictObstacle(obstacle, &prediction_obstacle, adc_trajectory_container);
-    } else {  // obstacle == nullptr
+    if (frame_obstacles[i] == nullptr) {
       prediction_obstacle.set_timestamp(perception_obstacle.timestamp());
       prediction_obstacle.set_is_static(true);
+    } else if (FLAGS_prediction_offline_mode == 3) {
+      FeatureOutput::InsertPredictionResult(frame_obstacles[i]->id(),
+                                            prediction_obstacle);
     }
 
     prediction_obstacle.set_predicted_period(
@@ -167,8 +221,8 @@ void PredictorManager::Run() {
     prediction_obstacle.mutable_perception_obstacle()->CopyFrom(
         perception_obstacle);
 
-    prediction_obstacles_.add_prediction_obstacle()->CopyFrom(
-        prediction_obstacle);
+    prediction_obstacles_.add_prediction_obstacle()->Swap(
+        &prediction_obstacle);
   }
 }
 
@@ -176,6 +230,17 @@ void PredictorManager::PredictObstacle(
     Obstacle* obstacle, PredictionObstacle* const prediction_obstacle,
     ADCTrajectoryContainer* adc_trajectory_container) {
   CHECK_NOTNULL(obstacle);
+  Predictor* predictor = SelectPredictor(obstacle, prediction_obstacle);
+  PredictWithPredictor(predictor, obstacle, prediction_obstacle,
+                       adc_trajectory_container);
+  if (FLAGS_prediction_offline_mode == 3) {
+    FeatureOutput::InsertPredictionResult(obstacle->id(), *prediction_obstacle);
+  }
+}
+
+Predictor* PredictorManager::SelectPredictor(
+    Obstacle* obstacle, PredictionObstacle* const prediction_obstacle) {
+  CHECK_NOTNULL(obstacle);
   Predictor* predictor = nullptr;
   prediction_obstacle->set_timestamp(obstacle->timestamp());
   if (obstacle->ToIgnore()) {
@@ -225,7 +290,13 @@ void PredictorManager::PredictObstacle(
       }
     }
   }
+  return predictor;
+}
 
+void PredictorManager::PredictWithPredictor(
+    Predictor* predictor, Obstacle* obstacle,
+    PredictionObstacle* const prediction_obstacle,
+    ADCTrajectoryContainer* adc_trajectory_container) {
   if (predictor != nullptr) {
     predictor->Predict(obstacle);
     if (FLAGS_enable_trim_prediction_trajectory &&
@@ -241,8 +312,17 @@ void PredictorManager::PredictObstacle(
   prediction_obstacle->mutable_priority()->CopyFrom(
       obstacle->latest_feature().priority());
   prediction_obstacle->set_is_static(obstacle->IsStill());
-  if (FLAGS_prediction_offline_mode == 3) {
-    FeatureOutput::InsertPredictionResult(obstacle->id(), *prediction_obstacle);
+}
+
+void PredictorManager::PredictObstacleGroup(
+    Predictor* predictor, const std::vector<size_t>* obstacle_indices,
+    std::vector<Obstacle*>* frame_obstacles,
+    std::vector<PredictionObstacle>* prediction_obstacle_slots,
+    ADCTrajectoryContainer* adc_trajectory_container) {
+  for (const size_t index : *obstacle_indices) {
+    PredictWithPredictor(predictor, (*frame_obstacles)[index],
+                         &(*prediction_obstacle_slots)[index],
+                         adc_trajectory_container);
   }
 }
 
@@ -23,6 +23,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "modules/prediction/predictor/predictor.h"
 #include "modules/prediction/proto/prediction_conf.pb.h"
@@ -75,6 +76,42 @@ class PredictorManager {
   const PredictionObstacles& prediction_obstacles();
 
  private:
+  /**
+   * @brief Select the predictor for an obstacle by its status and type
+   * @param A pointer to the specific obstacle
+   * @param A pointer to prediction_obstacle
+   * @return A pointer to the selected predictor, nullptr if none applies
+   */
+  Predictor* SelectPredictor(Obstacle* obstacle,
+                             PredictionObstacle* const prediction_obstacle);
+
+  /**
+   * @brief Run a selected predictor on an obstacle and fill the
+   *        prediction_obstacle with its trajectories
+   * @param A pointer to the selected predictor
+   * @param A pointer to the specific obstacle
+   * @param A pointer to prediction_obstacle
+   * @param A pointer to adc_trajectory_container
+   */
+  void PredictWithPredictor(Predictor* predictor, Obstacle* obstacle,
+                            PredictionObstacle* const prediction_obstacle,
+                            ADCTrajectoryContainer* adc_trajectory_container);
+
+  /**
+   * @brief Run one predictor over all obstacles assigned to it; a predictor
+   *        instance is stateful, so its whole group stays on a single task
+   * @param A pointer to the predictor shared by the group
+   * @param Indices of the group's obstacles into the frame snapshot
+   * @param A pointer to the frame's obstacle snapshot
+   * @param A pointer to the frame's prediction_obstacle slots
+   * @param A pointer to adc_trajectory_container
+   */
+  void PredictObstacleGroup(
+      Predictor* predictor, const std::vector<size_t>* obstacle_indices,
+      std::vector<Obstacle*>* frame_obstacles,
+      std::vector<PredictionObstacle>* prediction_obstacle_slots,
+      ADCTrajectoryContainer* adc_trajectory_container);
+
   /**
    * @brief Register a predictor by type
    * @param Predictor type
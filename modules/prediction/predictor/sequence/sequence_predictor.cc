@@ -194,11 +194,12 @@ SequencePredictor::LaneChangeType SequencePredictor::GetLaneChangeType(
 double SequencePredictor::GetLaneChangeDistanceWithADC(
     const LaneSequence& lane_sequence) {
   auto pose_container =
-      ContainerManager::Instance()->GetContainer<PoseContainer>(
+      ContainerManager::Instance()->GetSnapshotContainer<PoseContainer>(
           AdapterConfig::LOCALIZATION);
   auto adc_container =
-      ContainerManager::Instance()->GetContainer<ADCTrajectoryContainer>(
-          AdapterConfig::PLANNING_TRAJECTORY);
+      ContainerManager::Instance()
+          ->GetSnapshotContainer<ADCTrajectoryContainer>(
+              AdapterConfig::PLANNING_TRAJECTORY);
 
   CHECK_NOTNULL(pose_container);
   CHECK_NOTNULL(adc_container);
@@ -32,7 +32,7 @@ EnvironmentFeatures FeatureExtractor::ExtractEnvironmentFeatures() {
   EnvironmentFeatures environment_features;
 
   auto ego_state_container =
-      ContainerManager::Instance()->GetContainer<PoseContainer>(
+      ContainerManager::Instance()->GetSnapshotContainer<PoseContainer>(
           AdapterConfig::LOCALIZATION);
 
   if (ego_state_container == nullptr ||
@@ -153,8 +153,9 @@ void FeatureExtractor::ExtractNeighborLaneFeatures(
 void FeatureExtractor::ExtractFrontJunctionFeatures(
     EnvironmentFeatures* ptr_environment_features) {
   auto ego_trajectory_container =
-      ContainerManager::Instance()->GetContainer<ADCTrajectoryContainer>(
-          AdapterConfig::PLANNING_TRAJECTORY);
+      ContainerManager::Instance()
+          ->GetSnapshotContainer<ADCTrajectoryContainer>(
+              AdapterConfig::PLANNING_TRAJECTORY);
   if (ego_trajectory_container == nullptr) {
     AERROR << "Null ego trajectory container";
     return;
@@ -32,3 +32,7 @@ DEFINE_bool(enable_change_lane_in_result, true,
 
 DEFINE_uint32(routing_response_history_interval_ms, 1000,
               "ms, emit routing resposne for this time interval");
+
+DEFINE_uint32(topo_graph_landmark_num, 16,
+              "number of landmark nodes whose distance tables are precomputed "
+              "into the routing topology graph by topo_creator");
@@ -17,6 +17,7 @@
 #include "modules/routing/core/navigator.h"
 
 #include "cyber/common/file.h"
+#include "modules/common/util/util.h"
 #include "modules/routing/common/routing_gflags.h"
 #include "modules/routing/graph/sub_topo_graph.h"
 #include "modules/routing/strategy/a_star_strategy.h"
@@ -81,6 +82,20 @@ void SetErrorCode(const common::ErrorCode& error_code_id,
   }
 }
 
+// Returns the index of the route node whose range contains the way point,
+// or -1 if the way point is not on the route.
+int FindWayPointOnRoute(const std::vector<NodeWithRange>& route_nodes,
+                        const std::string& lane_id, const double s) {
+  for (size_t i = 0; i < route_nodes.size(); ++i) {
+    const auto& node = route_nodes[i];
+    if (node.GetTopoNode()->LaneId() == lane_id && s >= node.StartS() &&
+        s <= node.EndS()) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
 void PrintDebugData(const std::vector<NodeWithRange>& nodes) {
   AINFO << "Route lane id\tis virtual\tstart s\tend s";
   for (const auto& node : nodes) {
@@ -200,6 +215,54 @@ bool Navigator::SearchRouteByStrategy(
   return true;
 }
 
+bool Navigator::SearchRouteIncremental(
+    const RoutingRequest& request,
+    std::vector<NodeWithRange>* const result_nodes) const {
+  if (!has_last_result_ || request.waypoint_size() < 2) {
+    return false;
+  }
+  // The fast path only applies to a mid-route correction: every way point
+  // except the start must be unchanged, and so must the black list, so the
+  // previous route remains both feasible and optimal past the new start.
+  if (request.waypoint_size() != last_request_.waypoint_size() ||
+      request.blacklisted_lane_size() !=
+          last_request_.blacklisted_lane_size() ||
+      request.blacklisted_road_size() !=
+          last_request_.blacklisted_road_size()) {
+    return false;
+  }
+  for (int i = 1; i < request.waypoint_size(); ++i) {
+    if (!common::util::IsProtoEqual(request.waypoint(i),
+                                    last_request_.waypoint(i))) {
+      return false;
+    }
+  }
+  for (int i = 0; i < request.blacklisted_lane_size(); ++i) {
+    if (!common::util::IsProtoEqual(request.blacklisted_lane(i),
+                                    last_request_.blacklisted_lane(i))) {
+      return false;
+    }
+  }
+  for (int i = 0; i < request.blacklisted_road_size(); ++i) {
+    if (request.blacklisted_road(i) != last_request_.blacklisted_road(i)) {
+      return false;
+    }
+  }
+  const auto& start_point = request.waypoint(0);
+  const int start_index = FindWayPointOnRoute(
+      last_result_nodes_, start_point.id(), start_point.s());
+  if (start_index < 0) {
+    ADEBUG << "New start point " << start_point.id()
+           << " is off the previous route, full search needed.";
+    return false;
+  }
+  result_nodes->assign(last_result_nodes_.begin() + start_index,
+                       last_result_nodes_.end());
+  AINFO << "Reused " << result_nodes->size()
+        << " route nodes from the previous search.";
+  return true;
+}
+
 bool Navigator::SearchRoute(const RoutingRequest& request,
                             RoutingResponse* const response) {
   if (!ShowRequestInfo(request, graph_.get())) {
@@ -223,7 +286,8 @@ bool Navigator::SearchRoute(const RoutingRequest& request,
   }
 
   std::vector<NodeWithRange> result_nodes;
-  if (!SearchRouteByStrategy(graph_.get(), way_nodes, way_s, &result_nodes)) {
+  if (!SearchRouteIncremental(request, &result_nodes) &&
+      !SearchRouteByStrategy(graph_.get(), way_nodes, way_s, &result_nodes)) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_RESPONSE,
                  "Failed to find route with request!",
                  response->mutable_status());
@@ -247,6 +311,10 @@ bool Navigator::SearchRoute(const RoutingRequest& request,
   }
   SetErrorCode(ErrorCode::OK, "Success!", response->mutable_status());
 
+  has_last_result_ = true;
+  last_request_ = request;
+  last_result_nodes_ = result_nodes;
+
   PrintDebugData(result_nodes);
   return true;
 }
@@ -51,12 +51,23 @@ class Navigator {
   bool MergeRoute(const std::vector<NodeWithRange>& node_vec,
                   std::vector<NodeWithRange>* const result_node_vec) const;
 
+  bool SearchRouteIncremental(
+      const RoutingRequest& request,
+      std::vector<NodeWithRange>* const result_nodes) const;
+
  private:
   bool is_ready_ = false;
   std::unique_ptr<TopoGraph> graph_;
 
   TopoRangeManager topo_range_manager_;
 
+  // Last successful request and route, kept so that a mid-route correction
+  // which only moves the start point can reuse the surviving route suffix
+  // instead of paying the full search cost again.
+  bool has_last_result_ = false;
+  RoutingRequest last_request_;
+  std::vector<NodeWithRange> last_result_nodes_;
+
   std::unique_ptr<BlackListRangeGenerator> black_list_generator_;
   std::unique_ptr<ResultGenerator> result_generator_;
 };
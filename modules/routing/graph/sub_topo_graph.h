@@ -69,6 +69,10 @@ class SubTopoGraph {
 
   const TopoNode* GetSubNodeWithS(const TopoNode* topo_node, double s) const;
 
+  // True if any origin node was split by a black listed range. When no node
+  // is split, the search runs on the unmodified origin graph.
+  bool HasSubNodes() const;
+
  private:
   void InitSubNodeByValidRange(const TopoNode* topo_node,
                                const std::vector<NodeSRange>& valid_range);
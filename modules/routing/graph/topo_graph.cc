@@ -16,6 +16,7 @@
 
 #include "modules/routing/graph/topo_graph.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace apollo {
@@ -25,6 +26,9 @@ void TopoGraph::Clear() {
   topo_nodes_.clear();
   topo_edges_.clear();
   node_index_map_.clear();
+  node_ptr_index_map_.clear();
+  landmark_distance_from_.clear();
+  landmark_distance_to_.clear();
 }
 
 bool TopoGraph::LoadNodes(const Graph& graph) {
@@ -36,6 +40,8 @@ bool TopoGraph::LoadNodes(const Graph& graph) {
     node_index_map_[node.lane_id()] = static_cast<int>(topo_nodes_.size());
     std::shared_ptr<TopoNode> topo_node;
     topo_node.reset(new TopoNode(node));
+    node_ptr_index_map_[topo_node.get()] =
+        static_cast<int>(topo_nodes_.size());
     road_node_map_[node.road_id()].insert(topo_node.get());
     topo_nodes_.push_back(std::move(topo_node));
   }
@@ -80,10 +86,63 @@ bool TopoGraph::LoadGraph(const Graph& graph) {
     AERROR << "Failed to load edges from topology graph.";
     return false;
   }
+  LoadLandmarks(graph);
   AINFO << "Load Topo data succesful.";
   return true;
 }
 
+void TopoGraph::LoadLandmarks(const Graph& graph) {
+  const int node_size = graph.node_size();
+  for (const auto& landmark : graph.landmark()) {
+    if (landmark.distance_from_size() != node_size ||
+        landmark.distance_to_size() != node_size) {
+      AWARN << "Ignored landmark " << landmark.lane_id()
+            << " whose distance table does not match the node size.";
+      continue;
+    }
+    landmark_distance_from_.emplace_back(landmark.distance_from().begin(),
+                                         landmark.distance_from().end());
+    landmark_distance_to_.emplace_back(landmark.distance_to().begin(),
+                                       landmark.distance_to().end());
+  }
+  if (!landmark_distance_from_.empty()) {
+    AINFO << "Loaded " << landmark_distance_from_.size()
+          << " landmark distance tables.";
+  }
+}
+
+bool TopoGraph::HasLandmarks() const {
+  return !landmark_distance_from_.empty();
+}
+
+double TopoGraph::GetLandmarkLowerBound(const TopoNode* from,
+                                        const TopoNode* to) const {
+  const auto from_iter = node_ptr_index_map_.find(from);
+  const auto to_iter = node_ptr_index_map_.find(to);
+  if (from_iter == node_ptr_index_map_.end() ||
+      to_iter == node_ptr_index_map_.end()) {
+    return 0.0;
+  }
+  const int from_index = from_iter->second;
+  const int to_index = to_iter->second;
+  double lower_bound = 0.0;
+  for (std::size_t i = 0; i < landmark_distance_from_.size(); ++i) {
+    // d(landmark, to) - d(landmark, from) <= d(from, to)
+    const double out_from = landmark_distance_from_[i][from_index];
+    const double out_to = landmark_distance_from_[i][to_index];
+    if (out_from >= 0.0 && out_to >= 0.0) {
+      lower_bound = std::max(lower_bound, out_to - out_from);
+    }
+    // d(from, landmark) - d(to, landmark) <= d(from, to)
+    const double in_from = landmark_distance_to_[i][from_index];
+    const double in_to = landmark_distance_to_[i][to_index];
+    if (in_from >= 0.0 && in_to >= 0.0) {
+      lower_bound = std::max(lower_bound, in_from - in_to);
+    }
+  }
+  return lower_bound;
+}
+
 const std::string& TopoGraph::MapVersion() const { return map_version_; }
 
 const std::string& TopoGraph::MapDistrict() const { return map_district_; }
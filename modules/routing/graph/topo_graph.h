@@ -42,10 +42,18 @@ class TopoGraph {
       const std::string& road_id,
       std::unordered_set<const TopoNode*>* const node_in_road) const;
 
+  // True if the graph carries precomputed landmark distance tables.
+  bool HasLandmarks() const;
+  // Lower bound of the search cost from "from" to "to", derived from the
+  // landmark distance tables via the triangle inequality. Returns 0.0 when
+  // no bound is known (no landmarks, sub nodes, unreachable entries).
+  double GetLandmarkLowerBound(const TopoNode* from, const TopoNode* to) const;
+
  private:
   void Clear();
   bool LoadNodes(const Graph& graph);
   bool LoadEdges(const Graph& graph);
+  void LoadLandmarks(const Graph& graph);
 
  private:
   std::string map_version_;
@@ -53,8 +61,13 @@ class TopoGraph {
   std::vector<std::shared_ptr<TopoNode> > topo_nodes_;
   std::vector<std::shared_ptr<TopoEdge> > topo_edges_;
   std::unordered_map<std::string, int> node_index_map_;
+  std::unordered_map<const TopoNode*, int> node_ptr_index_map_;
   std::unordered_map<std::string, std::unordered_set<const TopoNode*> >
       road_node_map_;
+  // Landmark distance tables aligned with topo_nodes_; negative entries
+  // mark unreachable nodes.
+  std::vector<std::vector<double> > landmark_distance_from_;
+  std::vector<std::vector<double> > landmark_distance_to_;
 };
 
 }  // namespace routing
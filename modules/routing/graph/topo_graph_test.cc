@@ -18,6 +18,7 @@
 
 #include "gtest/gtest.h"
 #include "modules/routing/graph/topo_test_utils.h"
+#include "modules/routing/topo_creator/landmark_creator.h"
 
 namespace apollo {
 namespace routing {
@@ -65,5 +66,42 @@ TEST(TopoGraphTestSuit, test_graph_1) {
   ASSERT_FALSE(node_4->IsSubNode());
 }
 
+TEST(TopoGraphTestSuit, test_landmark_lower_bound) {
+  Graph graph;
+  GetGraphForTest(&graph);
+
+  TopoGraph plain_graph;
+  ASSERT_TRUE(plain_graph.LoadGraph(graph));
+  ASSERT_FALSE(plain_graph.HasLandmarks());
+
+  landmark_creator::AddLandmarks(2, &graph);
+  ASSERT_EQ(2, graph.landmark_size());
+
+  TopoGraph topo_graph;
+  ASSERT_TRUE(topo_graph.LoadGraph(graph));
+  ASSERT_TRUE(topo_graph.HasLandmarks());
+
+  const TopoNode* node_1 = topo_graph.GetNode(TEST_L1);
+  const TopoNode* node_2 = topo_graph.GetNode(TEST_L2);
+  const TopoNode* node_3 = topo_graph.GetNode(TEST_L3);
+  const TopoNode* node_4 = topo_graph.GetNode(TEST_L4);
+
+  ASSERT_DOUBLE_EQ(0.0, topo_graph.GetLandmarkLowerBound(node_1, node_1));
+
+  // L1 is a landmark, so its bound to L4 is the exact search cost: a lane
+  // change edge to L2 plus a forward edge to L4.
+  const double expect_cost = 2 * TEST_EDGE_COST + TEST_LANE_COST;
+  ASSERT_DOUBLE_EQ(expect_cost,
+                   topo_graph.GetLandmarkLowerBound(node_1, node_4));
+
+  // L1 is unreachable from L4; the bound degrades to zero, which is still
+  // a valid lower bound.
+  ASSERT_DOUBLE_EQ(0.0, topo_graph.GetLandmarkLowerBound(node_4, node_1));
+
+  // Admissibility: the bound never exceeds the true search cost.
+  ASSERT_LE(topo_graph.GetLandmarkLowerBound(node_2, node_3),
+            TEST_EDGE_COST + TEST_EDGE_COST + TEST_LANE_COST);
+}
+
 }  // namespace routing
 }  // namespace apollo
@@ -217,6 +217,10 @@ double AStarStrategy::HeuristicCost(const TopoNode* src_node,
   const auto& dest_point = dest_node->AnchorPoint();
   double distance = fabs(src_point.x() - dest_point.x()) +
                     fabs(src_point.y() - dest_point.y());
+  if (use_landmarks_) {
+    distance = std::max(distance,
+                        graph_->GetLandmarkLowerBound(src_node, dest_node));
+  }
   return distance;
 }
 
@@ -227,6 +231,15 @@ bool AStarStrategy::Search(const TopoGraph* graph,
   Clear();
   AINFO << "Start A* search algorithm.";
 
+  // The landmark lower bounds are precomputed on the unmodified graph.
+  // Black listed ranges split nodes into sub nodes which are absent from
+  // the tables, so such queries fall back to the plain distance heuristic.
+  graph_ = graph;
+  use_landmarks_ = graph->HasLandmarks() && !sub_graph->HasSubNodes();
+  if (use_landmarks_) {
+    ADEBUG << "Using landmark heuristic lower bounds for this query.";
+  }
+
   std::priority_queue<SearchNode> open_set_detail;
 
   SearchNode src_search_node(src_node);
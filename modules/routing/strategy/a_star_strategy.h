@@ -42,6 +42,10 @@ class AStarStrategy : public Strategy {
 
  private:
   bool change_lane_enabled_;
+  // The graph being searched; used for landmark heuristic lower bounds.
+  const TopoGraph* graph_ = nullptr;
+  // True when the precomputed landmark tables may be used for this query.
+  bool use_landmarks_ = false;
   std::unordered_set<const TopoNode*> open_set_;
   std::unordered_set<const TopoNode*> closed_set_;
   std::unordered_map<const TopoNode*, const TopoNode*> came_from_;
@@ -25,6 +25,7 @@
 #include "modules/map/hdmap/adapter/opendrive_adapter.h"
 #include "modules/routing/common/routing_gflags.h"
 #include "modules/routing/topo_creator/edge_creator.h"
+#include "modules/routing/topo_creator/landmark_creator.h"
 #include "modules/routing/topo_creator/node_creator.h"
 
 namespace apollo {
@@ -142,6 +143,9 @@ bool GraphCreator::Create() {
     }
   }
 
+  landmark_creator::AddLandmarks(
+      static_cast<int>(FLAGS_topo_graph_landmark_num), &graph_);
+
   if (!EndWith(dump_topo_file_path_, ".bin") &&
       !EndWith(dump_topo_file_path_, ".txt")) {
     AERROR << "Failed to dump topo data into file, incorrect file type "
@@ -0,0 +1,158 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/routing/topo_creator/landmark_creator.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace routing {
+namespace landmark_creator {
+namespace {
+
+// Marks a node which cannot reach (or be reached from) a landmark.
+constexpr double kUnreachable = -1.0;
+
+// first: adjacent node index, second: edge weight.
+typedef std::pair<int, double> WeightedArc;
+
+// Weight of an edge as accumulated by AStarStrategy::Search: the edge cost
+// plus the entered node cost, with half of both node costs refunded for
+// lane change edges. Clamped at zero so that Dijkstra stays valid; an
+// underestimated weight only weakens the resulting lower bounds, it never
+// breaks their admissibility.
+double GetEdgeWeight(const Graph& graph, const Edge& edge,
+                     const std::unordered_map<std::string, int>& node_index) {
+  const auto& from_node = graph.node(node_index.at(edge.from_lane_id()));
+  const auto& to_node = graph.node(node_index.at(edge.to_lane_id()));
+  double weight = edge.cost() + to_node.cost();
+  if (edge.direction_type() != Edge::FORWARD) {
+    weight -= (from_node.cost() + to_node.cost()) / 2.0;
+  }
+  return std::max(0.0, weight);
+}
+
+void Dijkstra(const std::vector<std::vector<WeightedArc>>& arcs,
+              const int source, std::vector<double>* const distance) {
+  distance->assign(arcs.size(), std::numeric_limits<double>::max());
+  (*distance)[source] = 0.0;
+  // first: tentative distance, second: node index.
+  typedef std::pair<double, int> QueueItem;
+  std::priority_queue<QueueItem, std::vector<QueueItem>,
+                      std::greater<QueueItem>>
+      queue;
+  queue.emplace(0.0, source);
+  while (!queue.empty()) {
+    const auto item = queue.top();
+    queue.pop();
+    if (item.first > (*distance)[item.second]) {
+      continue;
+    }
+    for (const auto& arc : arcs[item.second]) {
+      const double next_distance = item.first + arc.second;
+      if (next_distance < (*distance)[arc.first]) {
+        (*distance)[arc.first] = next_distance;
+        queue.emplace(next_distance, arc.first);
+      }
+    }
+  }
+}
+
+void FillDistanceField(
+    const std::vector<double>& distance,
+    ::google::protobuf::RepeatedField<double>* const field) {
+  field->Reserve(static_cast<int>(distance.size()));
+  for (const double value : distance) {
+    field->Add(value == std::numeric_limits<double>::max() ? kUnreachable
+                                                           : value);
+  }
+}
+
+}  // namespace
+
+void AddLandmarks(const int landmark_num, Graph* const graph) {
+  const int node_size = graph->node_size();
+  if (node_size == 0 || landmark_num <= 0) {
+    return;
+  }
+
+  std::unordered_map<std::string, int> node_index;
+  for (int i = 0; i < node_size; ++i) {
+    node_index[graph->node(i).lane_id()] = i;
+  }
+
+  std::vector<std::vector<WeightedArc>> out_arcs(node_size);
+  std::vector<std::vector<WeightedArc>> in_arcs(node_size);
+  for (const auto& edge : graph->edge()) {
+    if (node_index.count(edge.from_lane_id()) != 1 ||
+        node_index.count(edge.to_lane_id()) != 1) {
+      continue;
+    }
+    const int from = node_index[edge.from_lane_id()];
+    const int to = node_index[edge.to_lane_id()];
+    const double weight = GetEdgeWeight(*graph, edge, node_index);
+    out_arcs[from].emplace_back(to, weight);
+    in_arcs[to].emplace_back(from, weight);
+  }
+
+  // Farthest-point landmark selection: the first landmark is the first
+  // node; every further landmark is the node farthest from all landmarks
+  // chosen so far, so the landmarks spread over the graph (including
+  // disconnected components, whose distance stays infinite).
+  std::vector<double> min_distance(
+      node_size, std::numeric_limits<double>::max());
+  std::vector<bool> is_landmark(node_size, false);
+  std::vector<double> distance_from;
+  std::vector<double> distance_to;
+  int next_landmark = 0;
+  const int max_landmark_num = std::min(landmark_num, node_size);
+  for (int i = 0; i < max_landmark_num; ++i) {
+    is_landmark[next_landmark] = true;
+    Dijkstra(out_arcs, next_landmark, &distance_from);
+    Dijkstra(in_arcs, next_landmark, &distance_to);
+
+    auto* landmark = graph->add_landmark();
+    landmark->set_lane_id(graph->node(next_landmark).lane_id());
+    FillDistanceField(distance_from, landmark->mutable_distance_from());
+    FillDistanceField(distance_to, landmark->mutable_distance_to());
+
+    double max_min_distance = -1.0;
+    for (int j = 0; j < node_size; ++j) {
+      min_distance[j] = std::min(min_distance[j], distance_from[j]);
+      if (!is_landmark[j] && min_distance[j] > max_min_distance) {
+        max_min_distance = min_distance[j];
+        next_landmark = j;
+      }
+    }
+    if (max_min_distance <= 0.0) {
+      break;
+    }
+  }
+  AINFO << "Added " << graph->landmark_size()
+        << " landmark distance tables to the topology graph.";
+}
+
+}  // namespace landmark_creator
+}  // namespace routing
+}  // namespace apollo
@@ -0,0 +1,35 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include "modules/routing/proto/topo_graph.pb.h"
+
+namespace apollo {
+namespace routing {
+namespace landmark_creator {
+
+// Select up to "landmark_num" landmark nodes and precompute their shortest
+// path distance tables over the graph. The tables are stored in the graph
+// proto and give the online A* search admissible lower bounds via the
+// triangle inequality, which prunes the search on large graphs. Distances
+// are computed with the same edge weights the search accumulates, so the
+// bounds never overestimate a query cost.
+void AddLandmarks(const int landmark_num, Graph* const graph);
+
+}  // namespace landmark_creator
+}  // namespace routing
+}  // namespace apollo
@@ -20,6 +20,7 @@
 
 #include "modules/third_party_perception/fusion.h"
 
+#include <unordered_set>
 #include <vector>
 
 #include "modules/common/math/polygon2d.h"
@@ -32,6 +33,7 @@ namespace apollo {
 namespace third_party_perception {
 namespace fusion {
 
+using apollo::common::math::Polygon2d;
 using apollo::common::math::Vec2d;
 using apollo::perception::PerceptionObstacle;
 using apollo::perception::PerceptionObstacles;
@@ -45,41 +47,75 @@ std::vector<Vec2d> PerceptionObstacleToVectorVec2d(
   return result;
 }
 
-bool HasOverlap(const PerceptionObstacle& obstacle_1,
-                const PerceptionObstacle& obstacle_2) {
-  common::math::Polygon2d polygon_1(
-      PerceptionObstacleToVectorVec2d(obstacle_1));
-  common::math::Polygon2d polygon_2(
-      PerceptionObstacleToVectorVec2d(obstacle_2));
-  return polygon_1.HasOverlap(polygon_2);
-}
-
-bool HasOverlap(const PerceptionObstacle& obstacle,
-                const PerceptionObstacles& obstacles) {
-  for (const auto& current_obstacle : obstacles.perception_obstacle()) {
-    if (HasOverlap(obstacle, current_obstacle)) {
-      return true;
-    }
-  }
-  return false;
+PerceptionObstacles MobileyeRadarFusion(
+    const PerceptionObstacles& mobileye_obstacles,
+    const PerceptionObstacles& radar_obstacles) {
+  TrackAssociationMap associations;
+  return MobileyeRadarFusion(mobileye_obstacles, radar_obstacles,
+                             &associations);
 }
 
 PerceptionObstacles MobileyeRadarFusion(
     const PerceptionObstacles& mobileye_obstacles,
-    const PerceptionObstacles& radar_obstacles) {
+    const PerceptionObstacles& radar_obstacles,
+    TrackAssociationMap* associations) {
   PerceptionObstacles mobileye_obstacles_fusion = mobileye_obstacles;
-  PerceptionObstacles radar_obstacles_fusion = radar_obstacles;
 
+  // index radar tracks and their polygons by track id, built once per
+  // frame instead of once per candidate pair
+  std::unordered_map<int32_t, const PerceptionObstacle*> radar_by_id;
+  std::unordered_map<int32_t, Polygon2d> radar_polygons;
+  for (const auto& radar_obstacle : radar_obstacles.perception_obstacle()) {
+    radar_by_id[radar_obstacle.id()] = &radar_obstacle;
+    radar_polygons.emplace(
+        radar_obstacle.id(),
+        Polygon2d(PerceptionObstacleToVectorVec2d(radar_obstacle)));
+  }
+
+  std::unordered_set<int32_t> current_mobileye_ids;
   for (auto& mobileye_obstacle :
        *(mobileye_obstacles_fusion.mutable_perception_obstacle())) {
-    for (auto& radar_obstacle :
-         *(radar_obstacles_fusion.mutable_perception_obstacle())) {
-      if (HasOverlap(mobileye_obstacle, radar_obstacle)) {
-        mobileye_obstacle.set_confidence(0.99);
-        mobileye_obstacle.mutable_velocity()->CopyFrom(
-            radar_obstacle.velocity());
+    current_mobileye_ids.insert(mobileye_obstacle.id());
+    Polygon2d mobileye_polygon(
+        PerceptionObstacleToVectorVec2d(mobileye_obstacle));
+
+    // try last frame's partner first, so a stable pairing costs one
+    // overlap test instead of a scan over the radar list
+    int32_t matched_id = -1;
+    auto hint = associations->find(mobileye_obstacle.id());
+    if (hint != associations->end()) {
+      auto radar_iter = radar_polygons.find(hint->second);
+      if (radar_iter != radar_polygons.end() &&
+          mobileye_polygon.HasOverlap(radar_iter->second)) {
+        matched_id = hint->second;
       }
     }
+    if (matched_id < 0) {
+      for (const auto& radar_polygon : radar_polygons) {
+        if (mobileye_polygon.HasOverlap(radar_polygon.second)) {
+          matched_id = radar_polygon.first;
+          break;
+        }
+      }
+    }
+
+    if (matched_id >= 0) {
+      (*associations)[mobileye_obstacle.id()] = matched_id;
+      mobileye_obstacle.set_confidence(0.99);
+      mobileye_obstacle.mutable_velocity()->CopyFrom(
+          radar_by_id[matched_id]->velocity());
+    } else {
+      associations->erase(mobileye_obstacle.id());
+    }
+  }
+
+  // drop associations whose mobileye track vanished
+  for (auto iter = associations->begin(); iter != associations->end();) {
+    if (current_mobileye_ids.count(iter->first) == 0) {
+      iter = associations->erase(iter);
+    } else {
+      ++iter;
+    }
   }
 
   // mobileye_obstacles_fusion.MergeFrom(radar_obstacles_fusion);
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "modules/perception/proto/perception_obstacle.pb.h"
 
 /**
@@ -30,10 +32,21 @@ namespace apollo {
 namespace third_party_perception {
 namespace fusion {
 
+// Mobileye-to-radar track association keyed by track id, carried across
+// frames so each frame starts from the previous frame's pairing and only
+// tracks without a still-valid partner fall back to scanning the radar
+// list.
+using TrackAssociationMap = std::unordered_map<int32_t, int32_t>;
+
 apollo::perception::PerceptionObstacles MobileyeRadarFusion(
     const apollo::perception::PerceptionObstacles& mobileye_obstacles,
     const apollo::perception::PerceptionObstacles& radar_obstacles);
 
+apollo::perception::PerceptionObstacles MobileyeRadarFusion(
+    const apollo::perception::PerceptionObstacles& mobileye_obstacles,
+    const apollo::perception::PerceptionObstacles& radar_obstacles,
+    TrackAssociationMap* associations);
+
 }  // namespace fusion
 }  // namespace third_party_perception
 }  // namespace apollo
@@ -97,8 +97,9 @@ bool ThirdPartyPerception::Process(PerceptionObstacles* const response) {
 
   std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
 
-  *response =
-      fusion::MobileyeRadarFusion(mobileye_obstacles_, radar_obstacles_);
+  *response = fusion::MobileyeRadarFusion(mobileye_obstacles_,
+                                          radar_obstacles_,
+                                          &fusion_associations_);
 
   common::util::FillHeader(FLAGS_third_party_perception_node_name, response);
 
@@ -29,6 +29,7 @@
 #include "modules/drivers/proto/mobileye.pb.h"
 #include "modules/localization/proto/localization.pb.h"
 #include "modules/perception/proto/perception_obstacle.pb.h"
+#include "modules/third_party_perception/fusion.h"
 #include "modules/third_party_perception/proto/radar_obstacle.pb.h"
 
 #include "modules/common/status/status.h"
@@ -69,6 +70,8 @@ class ThirdPartyPerception {
   apollo::canbus::Chassis chassis_;
   RadarObstacles current_radar_obstacles_;
   RadarObstacles last_radar_obstacles_;
+  // mobileye-to-radar pairing carried across frames
+  fusion::TrackAssociationMap fusion_associations_;
 };
 
 }  // namespace third_party_perception
@@ -16,6 +16,9 @@
 
 #include "modules/transform/buffer.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "cyber/cyber.h"
 
 namespace apollo {
@@ -23,6 +26,13 @@ namespace transform {
 
 static constexpr float kSecondToNanoFactor = 1e9f;
 
+namespace {
+// How much transform history each pair cache keeps. Lookups query at most a
+// few hundred milliseconds behind the newest stamp; older times fall back to
+// BufferCore, so the window is kept small to bound the snapshot copy cost.
+constexpr uint64_t kCacheWindowNanoseconds = 1000000000ULL;
+}  // namespace
+
 Buffer::Buffer() : BufferCore() { Init(); }
 
 int Buffer::Init() {
@@ -108,6 +118,147 @@ void Buffer::SubscriptionCallbackImpl(
       AERROR << "Failure to set recieved transform:" << temp.c_str();
     }
   }
+
+  RefreshSnapshot();
+}
+
+void Buffer::RefreshSnapshot() {
+  {
+    std::lock_guard<std::mutex> lock(requested_pairs_mutex_);
+    for (const auto& pair : requested_pairs_) {
+      const std::string key = pair.first + "\t" + pair.second;
+      auto& cache = writer_caches_[key];
+      cache.target_frame = pair.first;
+      cache.source_frame = pair.second;
+    }
+    requested_pairs_.clear();
+  }
+  if (writer_caches_.empty()) {
+    return;
+  }
+
+  for (auto& entry : writer_caches_) {
+    auto& cache = entry.second;
+    try {
+      const geometry_msgs::TransformStamped trans = lookupTransform(
+          cache.target_frame, cache.source_frame, tf2::Time(0));
+      TransformSample sample;
+      sample.stamp = trans.header.stamp;
+      sample.translation[0] = trans.transform.translation.x;
+      sample.translation[1] = trans.transform.translation.y;
+      sample.translation[2] = trans.transform.translation.z;
+      sample.rotation[0] = trans.transform.rotation.x;
+      sample.rotation[1] = trans.transform.rotation.y;
+      sample.rotation[2] = trans.transform.rotation.z;
+      sample.rotation[3] = trans.transform.rotation.w;
+      auto& samples = cache.samples;
+      if (samples.empty() || sample.stamp > samples.back().stamp) {
+        samples.push_back(sample);
+      }
+      while (samples.front().stamp + kCacheWindowNanoseconds <
+             samples.back().stamp) {
+        samples.erase(samples.begin());
+      }
+    } catch (tf2::TransformException& ex) {
+      // The chain is not connected (yet); keep existing samples and retry on
+      // the next update.
+      ADEBUG << "Cannot refresh cached transform " << cache.target_frame
+             << " <- " << cache.source_frame << ": " << ex.what();
+    }
+  }
+
+  auto snapshot = std::make_shared<const CacheSnapshot>(writer_caches_);
+  std::atomic_store(&snapshot_, snapshot);
+}
+
+bool Buffer::LookupFromSnapshot(const std::string& target_frame,
+                                const std::string& source_frame,
+                                const cyber::Time& time,
+                                TransformStamped* trans_stamped) const {
+  const auto snapshot = std::atomic_load(&snapshot_);
+  const auto it = snapshot == nullptr
+                      ? CacheSnapshot::const_iterator()
+                      : snapshot->find(target_frame + "\t" + source_frame);
+  if (snapshot == nullptr || it == snapshot->end()) {
+    std::lock_guard<std::mutex> lock(requested_pairs_mutex_);
+    requested_pairs_.emplace(target_frame, source_frame);
+    return false;
+  }
+
+  const auto& samples = it->second.samples;
+  if (samples.empty()) {
+    return false;
+  }
+  const uint64_t stamp = time.ToNanosecond();
+  TransformSample result;
+  if (stamp == 0 || stamp == samples.back().stamp) {
+    result = samples.back();
+  } else if (stamp < samples.front().stamp || stamp > samples.back().stamp) {
+    // Outside the cached span; leave it to BufferCore so its extrapolation
+    // error reporting applies.
+    return false;
+  } else {
+    const auto upper = std::upper_bound(
+        samples.begin(), samples.end(), stamp,
+        [](const uint64_t value, const TransformSample& sample) {
+          return value < sample.stamp;
+        });
+    Interpolate(*(upper - 1), *upper, stamp, &result);
+  }
+
+  trans_stamped->mutable_header()->set_timestamp_sec(
+      static_cast<double>(result.stamp) / 1e9);
+  trans_stamped->mutable_header()->set_frame_id(target_frame);
+  trans_stamped->set_child_frame_id(source_frame);
+  auto* translation = trans_stamped->mutable_transform()->mutable_translation();
+  translation->set_x(result.translation[0]);
+  translation->set_y(result.translation[1]);
+  translation->set_z(result.translation[2]);
+  auto* rotation = trans_stamped->mutable_transform()->mutable_rotation();
+  rotation->set_qx(result.rotation[0]);
+  rotation->set_qy(result.rotation[1]);
+  rotation->set_qz(result.rotation[2]);
+  rotation->set_qw(result.rotation[3]);
+  return true;
+}
+
+void Buffer::Interpolate(const TransformSample& earlier,
+                         const TransformSample& later, const uint64_t stamp,
+                         TransformSample* result) {
+  const double ratio = static_cast<double>(stamp - earlier.stamp) /
+                       static_cast<double>(later.stamp - earlier.stamp);
+  result->stamp = stamp;
+  for (int i = 0; i < 3; ++i) {
+    result->translation[i] =
+        earlier.translation[i] +
+        ratio * (later.translation[i] - earlier.translation[i]);
+  }
+
+  // Quaternion slerp along the shorter arc.
+  double dot = 0.0;
+  for (int i = 0; i < 4; ++i) {
+    dot += earlier.rotation[i] * later.rotation[i];
+  }
+  const double sign = dot < 0.0 ? -1.0 : 1.0;
+  dot *= sign;
+  double weight_earlier = 1.0 - ratio;
+  double weight_later = ratio;
+  if (dot < 0.9995) {
+    const double theta = std::acos(dot);
+    const double sin_theta = std::sin(theta);
+    weight_earlier = std::sin((1.0 - ratio) * theta) / sin_theta;
+    weight_later = std::sin(ratio * theta) / sin_theta;
+  }
+  double norm = 0.0;
+  for (int i = 0; i < 4; ++i) {
+    result->rotation[i] = weight_earlier * earlier.rotation[i] +
+                          sign * weight_later * later.rotation[i];
+    norm += result->rotation[i] * result->rotation[i];
+  }
+  norm = std::sqrt(norm);
+  for (int i = 0; i < 4; ++i) {
+    result->rotation[i] /= norm;
+  }
 }
 
 void Buffer::TF2MsgToCyber(
@@ -145,6 +296,10 @@ TransformStamped Buffer::lookupTransform(const std::string& target_frame,
                                          const std::string& source_frame,
                                          const cyber::Time& time,
                                          const float timeout_second) const {
+  TransformStamped cached;
+  if (LookupFromSnapshot(target_frame, source_frame, time, &cached)) {
+    return cached;
+  }
   tf2::Time tf2_time(time.ToNanosecond());
   geometry_msgs::TransformStamped tf2_trans_stamped =
       lookupTransform(target_frame, source_frame, tf2_time);
@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "tf2/buffer_core.h"
@@ -116,6 +120,44 @@ class Buffer : public BufferInterface, public tf2::BufferCore {
                             std::string* errstr = nullptr) const;
 
  private:
+  // A time-stamped sample of a target<-source transform, held by the
+  // per-frame-pair interpolation cache.
+  struct TransformSample {
+    uint64_t stamp = 0;
+    double translation[3] = {0.0, 0.0, 0.0};
+    double rotation[4] = {0.0, 0.0, 0.0, 1.0};  // x, y, z, w
+  };
+
+  // Recent samples of one (target, source) pair, oldest first.
+  struct PairCache {
+    std::string target_frame;
+    std::string source_frame;
+    std::vector<TransformSample> samples;
+  };
+
+  // An immutable snapshot of all maintained pair caches, keyed by
+  // "<target>\t<source>". The /tf reader rebuilds it after every update and
+  // publishes it with an atomic shared_ptr store; lookupTransform loads it
+  // wait-free and only falls back to the mutex-guarded BufferCore walk on a
+  // cache miss.
+  using CacheSnapshot = std::map<std::string, PairCache>;
+
+  // Serves a lookup from the published snapshot. Returns false when the pair
+  // is not cached yet or the requested time is outside the cached span; a
+  // miss registers the pair so the /tf reader starts maintaining it.
+  bool LookupFromSnapshot(const std::string& target_frame,
+                          const std::string& source_frame,
+                          const cyber::Time& time,
+                          TransformStamped* trans_stamped) const;
+
+  // Called on the /tf reader thread after new transforms are stored: appends
+  // the latest sample of every registered pair and publishes a new snapshot.
+  void RefreshSnapshot();
+
+  static void Interpolate(const TransformSample& earlier,
+                          const TransformSample& later, const uint64_t stamp,
+                          TransformSample* result);
+
   void SubscriptionCallback(
       const std::shared_ptr<const TransformStampeds>& transform);
   void StaticSubscriptionCallback(
@@ -135,6 +177,14 @@ class Buffer : public BufferInterface, public tf2::BufferCore {
   cyber::Time last_update_;
   std::vector<geometry_msgs::TransformStamped> static_msgs_;
 
+  // Published snapshot; accessed with std::atomic_load / std::atomic_store.
+  std::shared_ptr<const CacheSnapshot> snapshot_;
+  // Working copy of the caches, touched only on the /tf reader thread.
+  CacheSnapshot writer_caches_;
+  // Pairs seen by lookups but not cached yet; drained by RefreshSnapshot.
+  mutable std::mutex requested_pairs_mutex_;
+  mutable std::set<std::pair<std::string, std::string>> requested_pairs_;
+
   DECLARE_SINGLETON(Buffer)
 };  // class
 
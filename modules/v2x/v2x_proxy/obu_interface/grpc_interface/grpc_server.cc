@@ -27,11 +27,22 @@ namespace v2x {
 using apollo::perception::PerceptionObstacles;
 using grpc::Status;
 
+namespace {
+constexpr uint32_t kGrpcMsgPoolSize = 8;
+}  // namespace
+
 GrpcServerImpl::GrpcServerImpl() : node_(cyber::CreateNode("v2x_grpc_server")) {
   CHECK(node_) << "Create v2x grpc server node failed";
   first_flag_writer_ =
       node_->CreateWriter<StatusResponse>("/apollo/v2x/inner/sync_flag");
   CHECK(first_flag_writer_) << "Create sync flag writer failed";
+  trafficlight_pool_.reset(
+      new cyber::base::CCObjectPool<IntersectionTrafficLightData>(
+          kGrpcMsgPoolSize));
+  trafficlight_pool_->ConstructAll();
+  obstacles_pool_.reset(
+      new cyber::base::CCObjectPool<PerceptionObstacles>(kGrpcMsgPoolSize));
+  obstacles_pool_->ConstructAll();
   AINFO << "GrpcServerImpl initial success";
   init_flag_ = true;
 }
@@ -52,9 +63,16 @@ grpc::Status GrpcServerImpl::SendPerceptionObstacles(
     AERROR << "SendPerceptionObstacles request has no header";
     return Status::CANCELLED;
   }
+  auto obstacles = obstacles_pool_->GetObject();
+  if (obstacles == nullptr) {
+    AWARN << "obstacles pool exhausted, allocating a new object.";
+    obstacles = std::make_shared<PerceptionObstacles>();
+  }
+  obstacles->Clear();
+  obstacles->CopyFrom(*request);
   {
     std::lock_guard<std::mutex> guard(obstacles_mutex_);
-    latest_obstacles_.CopyFrom(*request);
+    latest_obstacles_ = obstacles;
   }
   response->set_status(true);
   ADEBUG << "SendPerceptionObstacles response success.";
@@ -78,51 +96,80 @@ grpc::Status GrpcServerImpl::SendV2xTrafficLight(
     AERROR << "SendV2xTrafficLight request has no header";
     return Status::CANCELLED;
   }
+  auto trafficlight = trafficlight_pool_->GetObject();
+  if (trafficlight == nullptr) {
+    AWARN << "traffic light pool exhausted, allocating a new object.";
+    trafficlight = std::make_shared<IntersectionTrafficLightData>();
+  }
+  trafficlight->Clear();
+  trafficlight->CopyFrom(*request);
+  int32_t intersection_id =
+      trafficlight->has_intersection_id() ? trafficlight->intersection_id() : 0;
   {
     std::lock_guard<std::mutex> guard(traffic_light_mutex_);
-    latest_trafficlight_.CopyFrom(*request);
-  }
-  if (first_recv_flag_) {
-    auto msg = std::make_shared<StatusResponse>();
-    msg->set_status(true);
-    if (first_flag_writer_->Write(msg)) {
-      AINFO << "grpc sync flag send success";
-      first_recv_flag_ = false;
-    } else {
-      AERROR << "grpc sync flag send failed";
-    }
+    // a burst of updates for one intersection collapses to the newest
+    // one, the replaced object goes straight back to the pool
+    latest_trafficlight_[intersection_id] = trafficlight;
+    last_updated_intersection_ = intersection_id;
+  }
+  if (first_recv_flag_.exchange(false)) {
+    // keep the grpc handler off the cyber writer path
+    cyber::Async(&GrpcServerImpl::SendSyncFlag, this);
   }
   response->set_status(true);
   ADEBUG << "SendV2xTrafficLight response success.";
   return Status::OK;
 }
 
+void GrpcServerImpl::SendSyncFlag() {
+  auto msg = std::make_shared<StatusResponse>();
+  msg->set_status(true);
+  if (first_flag_writer_->Write(msg)) {
+    AINFO << "grpc sync flag send success";
+  } else {
+    AERROR << "grpc sync flag send failed";
+    // retry on the next traffic light update
+    first_recv_flag_.store(true);
+  }
+}
+
 void GrpcServerImpl::GetMsgFromGrpc(
     const std::shared_ptr<PerceptionObstacles>& ptr) {
-  if (latest_obstacles_.perception_obstacle_size() == 0) {
+  std::shared_ptr<PerceptionObstacles> latest;
+  {
+    std::lock_guard<std::mutex> guard(obstacles_mutex_);
+    latest = latest_obstacles_;
+  }
+  if (latest == nullptr || latest->perception_obstacle_size() == 0) {
     AERROR << "GetMsgFromGrpc PerceptionObstacles is invaild";
     return;
   }
-  if (!latest_obstacles_.has_header()) {
+  if (!latest->has_header()) {
     AERROR << "GetMsgFromGrpc PerceptionObstacles is invaild";
     return;
   }
-  std::lock_guard<std::mutex> guard(obstacles_mutex_);
-  ptr->CopyFrom(latest_obstacles_);
+  ptr->CopyFrom(*latest);
 }
 
 void GrpcServerImpl::GetMsgFromGrpc(
     const std::shared_ptr<IntersectionTrafficLightData>& ptr) {
-  if (!latest_trafficlight_.has_current_lane_trafficlight()) {
+  std::shared_ptr<IntersectionTrafficLightData> latest;
+  {
+    std::lock_guard<std::mutex> guard(traffic_light_mutex_);
+    auto iter = latest_trafficlight_.find(last_updated_intersection_);
+    if (iter != latest_trafficlight_.end()) {
+      latest = iter->second;
+    }
+  }
+  if (latest == nullptr || !latest->has_current_lane_trafficlight()) {
     AERROR << "GetMsgFromGrpc IntersectionTrafficLightData is invaild";
     return;
   }
-  if (!latest_trafficlight_.has_header()) {
+  if (!latest->has_header()) {
     AERROR << "GetMsgFromGrpc IntersectionTrafficLightData is invaild";
     return;
   }
-  std::lock_guard<std::mutex> guard(traffic_light_mutex_);
-  ptr->CopyFrom(latest_trafficlight_);
+  ptr->CopyFrom(*latest);
 }
 
 }  // namespace v2x
@@ -21,8 +21,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <map>
 #include <memory>
 
+#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/cyber.h"
 #include "modules/v2x/proto/v2x_service_obu_to_car.grpc.pb.h"
 
@@ -64,12 +67,27 @@ class GrpcServerImpl final : public ObuToCar::Service {
   void GetMsgFromGrpc(const std::shared_ptr<IntersectionTrafficLightData>& ptr);
 
  private:
+  /* function that send sync flag on a cyber task
+   */
+  void SendSyncFlag();
+
   std::mutex traffic_light_mutex_;
   std::mutex obstacles_mutex_;
-  apollo::perception::PerceptionObstacles latest_obstacles_;
-  IntersectionTrafficLightData latest_trafficlight_;
+  // requests are copied into pooled objects so a burst of roadside
+  // messages does not allocate per message
+  std::shared_ptr<cyber::base::CCObjectPool<IntersectionTrafficLightData>>
+      trafficlight_pool_;
+  std::shared_ptr<
+      cyber::base::CCObjectPool<apollo::perception::PerceptionObstacles>>
+      obstacles_pool_;
+  std::shared_ptr<apollo::perception::PerceptionObstacles> latest_obstacles_;
+  // latest update per intersection; repeated updates of one intersection
+  // collapse to the newest one instead of queueing
+  std::map<int32_t, std::shared_ptr<IntersectionTrafficLightData>>
+      latest_trafficlight_;
+  int32_t last_updated_intersection_ = 0;
   bool init_flag_ = false;
-  bool first_recv_flag_ = true;
+  std::atomic<bool> first_recv_flag_ = {true};
   std::unique_ptr<cyber::Node> node_;
   std::shared_ptr<cyber::Writer<StatusResponse>> first_flag_writer_ = nullptr;
 };
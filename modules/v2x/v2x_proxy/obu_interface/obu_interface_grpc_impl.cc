@@ -107,11 +107,15 @@ void ObuInterFaceGrpcImpl::GetV2xTrafficLightFromObu(
 }
 void ObuInterFaceGrpcImpl::SendCarStatusToObu(
     const std::shared_ptr<CarStatus> &msg) {
-  grpc_client_->SendMsgToGrpc(msg);
+  // the grpc call blocks up to its deadline, run it on a cyber task so
+  // the caller's timer is never held up by OBU round trips
+  auto client = grpc_client_;
+  cyber::Async([client, msg]() { client->SendMsgToGrpc(msg); });
 }
 void ObuInterFaceGrpcImpl::SendObstaclesToObu(
     const std::shared_ptr<PerceptionObstacles> &msg) {
-  grpc_client_->SendMsgToGrpc(msg);
+  auto client = grpc_client_;
+  cyber::Async([client, msg]() { client->SendMsgToGrpc(msg); });
 }
 
 }  // namespace v2x